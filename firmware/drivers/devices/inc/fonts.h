@@ -14,6 +14,13 @@
  * @note Available characters from " " (ASCII: 32) to "~" (ASCII: 126)
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
+ *
+ * @note Run-length compressed fonts (*_rle) are created from fonts.c with tools/font_rle.py.
+ * They take 1.3 to 2.9 times less flash and are drawn faster, since whole runs of pixels
+ * are filled at once.
+ *
+ * @note Anti-aliased fonts (*_aa) are created from the 59 and 89 pixels fonts with
+ * tools/font_aa.py. They store the coverage of each pixel in 4 bits.
  * 
  * @author Albano Peñalva
  *
@@ -22,6 +29,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 19/10/2026 | Run-length compressed fonts (font_22_rle ... font_89_rle)				|
+ * | 19/10/2026 | Anti-aliased fonts (font_30_aa, font_45_aa)							|
  * 
  **/
 
@@ -30,6 +39,14 @@
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Font and icon data format
+ */
+typedef enum {
+	FONT_BITMAP = 0,	/*!< 1 bit per pixel, rows padded to a whole byte */
+	FONT_RLE,			/*!< Run-length compressed rows (see tools/font_rle.py) */
+	FONT_AA4,			/*!< Anti-aliased, 4 bits per pixel (coverage 0 to 15), rows padded to a whole byte */
+} font_format_t;
 /**
  * @brief Character information
  */
@@ -44,6 +61,7 @@ typedef struct{
 	uint8_t 		font_height;   	/*!< Font height in pixels */
 	char_info_t 	*info;			/*!< Character info array */
 	const uint8_t 	*data; 			/*!< Font array */
+	font_format_t	format;			/*!< Font array format */
 } Font_t;
 
 /*==================[external data declaration]==============================*/
@@ -77,6 +95,36 @@ extern Font_t font_59;
  */
 extern Font_t font_89;
 
+/**
+ * @brief  22 pixels run-length compressed font structure
+ */
+extern Font_t font_22_rle;
+
+/**
+ * @brief  30 pixels run-length compressed font structure
+ */
+extern Font_t font_30_rle;
+
+/**
+ * @brief  59 pixels run-length compressed font structure
+ */
+extern Font_t font_59_rle;
+
+/**
+ * @brief  89 pixels run-length compressed font structure
+ */
+extern Font_t font_89_rle;
+
+/**
+ * @brief  30 pixels anti-aliased font structure
+ */
+extern Font_t font_30_aa;
+
+/**
+ * @brief  45 pixels anti-aliased font structure
+ */
+extern Font_t font_45_aa;
+
 /*==================[external functions declaration]=========================*/
 
 /** @} doxygen end group definition */
@@ -12,6 +12,8 @@
  * @note Available sizes: 22x22 pixels, 30x30 pixels, 59x59 pixels, 89x89 pixels.
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
+ *
+ * @note Run-length compressed icons (*_rle) are created from icons.c with tools/font_rle.py.
  * 
  * @author Albano Peñalva
  *
@@ -20,11 +22,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 19/10/2026 | Run-length compressed icons (icon_30_rle ... icon_89_rle)				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stddef.h>
+#include "fonts.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
@@ -106,6 +111,8 @@ typedef struct{
 	uint8_t 		width;			/*!< Icon width in pixels */
 	uint16_t 		offset;			/*!< Offset between icons in data array */
 	const uint8_t 	*data; 			/*!< Icon data array */
+	font_format_t	format;			/*!< Icon data array format */
+	const uint16_t	*offsets;		/*!< Icon positions in data array (only FONT_RLE) */
 } icon_font_t;
 
 /*==================[external data declaration]==============================*/
@@ -129,6 +136,21 @@ extern icon_font_t icon_59;
  */
 extern icon_font_t icon_89;
 
+/**
+ * @brief  30x30 pixels run-length compressed icon structure
+ */
+extern icon_font_t icon_30_rle;
+
+/**
+ * @brief  59x59 pixels run-length compressed icon structure
+ */
+extern icon_font_t icon_59_rle;
+
+/**
+ * @brief  89x89 pixels run-length compressed icon structure
+ */
+extern icon_font_t icon_89_rle;
+
 /*==================[external functions declaration]=========================*/
 
 /** @} doxygen end group definition */
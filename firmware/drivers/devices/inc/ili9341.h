@@ -33,6 +33,13 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Double-buffered DMA transfers and async API    |
+ * | 19/10/2026 | Span rasterization and batch drawing           |
+ * | 19/10/2026 | Glyph cache and single window text runs        |
+ * | 19/10/2026 | Hardware scrolling strip chart                 |
+ * | 19/10/2026 | Run-length compressed images                   |
+ * | 19/10/2026 | Run-length compressed fonts and icons          |
+ * | 19/10/2026 | Anti-aliased (4 bits per pixel) fonts          |
  *
  */
 
@@ -80,6 +87,79 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Callback function for asynchronous transfers end
+ */
+typedef void (*ili9341_callback_t)(void *param);
+
+/**
+ * @brief  Strip chart configuration
+ * @note   The chart scrolls along the 320 pixels side of the LCD: right to left in
+ * 		   landscape orientations and bottom to top in portrait orientations.
+ */
+typedef struct {
+	uint16_t top;			/*!< Pixels before the chart along the 320 pixels side (fixed area) */
+	uint16_t length;		/*!< Chart length along the 320 pixels side (top + length <= 320) */
+	uint16_t pos;			/*!< First pixel of the chart along the 240 pixels side */
+	uint16_t height;		/*!< Chart size along the 240 pixels side (pos + height <= 240) */
+	int32_t min;			/*!< Sample value drawn at the bottom (landscape) or left (portrait) edge */
+	int32_t max;			/*!< Sample value drawn at the top (landscape) or right (portrait) edge */
+	uint16_t foreground;	/*!< Trace color (RGB565) */
+	uint16_t background;	/*!< Chart background color (RGB565) */
+} ili9341_strip_chart_t;
+
+/**
+ * @brief  Run-length compressed image (see firmware/tools/image_rle.py)
+ * @note   Data is a sequence of packets starting with a header byte. If bit 7 of header is set,
+ * 		   the next pixel is repeated (header & 0x7F) + 1 times, otherwise the next header + 1
+ * 		   pixels are copied. Pixels are indexes to palette (1 byte) or RGB565 colors
+ * 		   (2 bytes, high byte first) when palette is NULL.
+ */
+typedef struct {
+	uint16_t width;				/*!< Image width in pixels */
+	uint16_t height;			/*!< Image height in pixels */
+	const uint16_t *palette;	/*!< Up to 256 RGB565 colors, NULL if pixels are RGB565 */
+	uint32_t size;				/*!< Size of data in bytes */
+	const uint8_t *data;		/*!< Compressed pixels */
+} ili9341_rle_image_t;
+
+/**
+ * @brief  Horizontal span of pixels
+ */
+typedef struct {
+	int16_t x0;		/*!< Start column */
+	int16_t x1;		/*!< End column */
+	int16_t y;		/*!< Row */
+} ili9341_span_t;
+
+/**
+ * @brief  Primitives that can be drawn in a batch
+ */
+typedef enum {
+	ILI9341_LINE,				/*!< Line from (x0, y0) to (x1, y1) */
+	ILI9341_RECTANGLE,			/*!< Rectangle with corners (x0, y0) and (x1, y1) */
+	ILI9341_FILLED_RECTANGLE,	/*!< Filled rectangle with corners (x0, y0) and (x1, y1) */
+	ILI9341_CIRCLE,				/*!< Circle with center (x0, y0) and radius r */
+	ILI9341_FILLED_CIRCLE,		/*!< Filled circle with center (x0, y0) and radius r */
+	ILI9341_TRIANGLE,			/*!< Triangle with vertices (x0, y0), (x1, y1) and (x2, y2) */
+	ILI9341_FILLED_TRIANGLE		/*!< Filled triangle with vertices (x0, y0), (x1, y1) and (x2, y2) */
+} ili9341_shape_t;
+
+/**
+ * @brief  Primitive to be drawn with ILI9341DrawBatch
+ */
+typedef struct {
+	ili9341_shape_t shape;	/*!< Kind of primitive */
+	int16_t x0;				/*!< X coordinate of first point or center */
+	int16_t y0;				/*!< Y coordinate of first point or center */
+	int16_t x1;				/*!< X coordinate of second point */
+	int16_t y1;				/*!< Y coordinate of second point */
+	int16_t x2;				/*!< X coordinate of third point */
+	int16_t y2;				/*!< Y coordinate of third point */
+	int16_t r;				/*!< Radius */
+	uint16_t color;			/*!< Color (RGB565) */
+} ili9341_primitive_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -117,6 +197,7 @@ void ILI9341Rotate(ili9341_orientation_t orientation);
 
 /**
  * @brief  		Draw a single character on the LCD
+ * @note		With anti-aliased fonts (FONT_AA4) the edges are blended between foreground and background
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	data: Character to be displayed
@@ -128,7 +209,8 @@ void ILI9341Rotate(ili9341_orientation_t orientation);
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background);
 
 /**
- * @brief  		Draw a single character on the LCD
+ * @brief  		Draw a single icon on the LCD
+ * @note		Both FONT_BITMAP and FONT_RLE icon fonts are supported
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	icon: Icon to be displayed
@@ -164,6 +246,16 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
  */
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Frees the memory used by expanded glyphs
+ * @note		Characters drawn with ILI9341DrawChar, ILI9341DrawInt and ILI9341DrawString
+ * 				are kept expanded (up to 32KB) for each font and color pair, so they are
+ * 				sent straight to the LCD next time.
+ * @param		None
+ * @retval 		None
+ */
+void ILI9341GlyphCacheClear(void);
+
 /**
  * @brief  		Gets width and height of box with text
  * @param[in]  	str: Pointer to first character
@@ -253,6 +345,26 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
  */
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 
+/**
+ * @brief  		Draws a list of horizontal spans on the LCD
+ * @note		Spans are clipped to the screen. Consecutive spans with the same columns
+ * 				on consecutive rows are sent as a single rectangle.
+ * @param[in]  	spans: Pointer to first span
+ * @param[in]  	n: Number of spans
+ * @param[in]  	color: Spans color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawSpans(const ili9341_span_t *spans, uint16_t n, uint16_t color);
+
+/**
+ * @brief  		Draws a list of primitives on the LCD holding the SPI bus
+ * @note		Filled shapes are rasterized as spans and merged into rectangles.
+ * @param[in]  	prims: Pointer to first primitive
+ * @param[in]  	n: Number of primitives
+ * @retval 		None
+ */
+void ILI9341DrawBatch(const ili9341_primitive_t *prims, uint16_t n);
+
 /**
  * @brief  		Draw a picture on the LCD
  * @note		Pictures must be converted to uint8_t array. 
@@ -267,6 +379,78 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a run-length compressed image on the LCD
+ * @note		Images can be converted with firmware/tools/image_rle.py. They are
+ * 				decompressed straight to the DMA buffers while the previous chunk is sent.
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	image: Pointer to compressed image
+ * @retval 		None
+ */
+void ILI9341DrawRleImage(uint16_t x, uint16_t y, const ili9341_rle_image_t *image);
+
+/**
+ * @brief  		Fills entire LCD with color without waiting for the transfer to end
+ * @note		The transfer is performed by a driver task. Any other drawing function
+ * 				called before the transfer ends waits for it.
+ * @param[in]	color: Color to be used in fill (RGB565)
+ * @param[in]	func_p: Function called (from driver task) when the transfer ends, or NULL
+ * @param[in]	param_p: Parameter for func_p
+ * @retval 		None
+ */
+void ILI9341FillAsync(uint16_t color, ili9341_callback_t func_p, void *param_p);
+
+/**
+ * @brief  		Draw a picture on the LCD without waiting for the transfer to end
+ * @note		The transfer is performed by a driver task. pic must remain valid and
+ * 				any other drawing function called before the transfer ends waits for it.
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in] 	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Pointer to first byte of picture
+ * @param[in]	func_p: Function called (from driver task) when the transfer ends, or NULL
+ * @param[in]	param_p: Parameter for func_p
+ * @retval 		None
+ */
+void ILI9341DrawPictureAsync(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic, 
+	ili9341_callback_t func_p, void *param_p);
+
+/**
+ * @brief  	Waits for the asynchronous transfer in progress (if any) to end
+ * @param	None
+ * @retval 	None
+ */
+void ILI9341WaitAsync(void);
+
+/**
+ * @brief  		Starts a strip chart that scrolls using the LCD vertical scrolling
+ * @note		Only one strip chart can be active. Call ILI9341Rotate before this function.
+ * 				While the chart is active, other drawings inside the scrolling area
+ * 				move with it.
+ * 				A length or height past the end of the LCD is clamped to it.
+ * @param[in]  	chart: Pointer to chart configuration
+ * @retval 		false if top or pos are outside the LCD, length or height are 0 or max is
+ * 				less than min (no chart active, ILI9341StripChartAdd does nothing)
+ */
+bool ILI9341StripChartInit(ili9341_strip_chart_t *chart);
+
+/**
+ * @brief  		Adds a sample to the strip chart
+ * @note		Only one line of the chart is drawn, the rest is scrolled by the LCD.
+ * @param[in]  	sample: New sample
+ * @retval 		None
+ */
+void ILI9341StripChartAdd(int32_t sample);
+
+/**
+ * @brief  		Stops the strip chart and restores the LCD to no scrolling
+ * @param		None
+ * @retval 		None
+ */
+void ILI9341StripChartDeInit(void);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
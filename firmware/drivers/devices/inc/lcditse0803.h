@@ -23,6 +23,10 @@
  * | 	SEL3	 	| 	GPIO_9		|
  * | 	Gnd 	    | 	GND     	|
  * 
+ * Each digit takes one data write and one latch strobe (dedicated GPIO channels, 
+ * see gpio_fast_out_mcu.h). Digits that don't change are not written, so repeated
+ * writes of the same value cost nothing.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -30,6 +34,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Dedicated GPIO writes, only changed digits are refreshed				|
  * 
  **/
 
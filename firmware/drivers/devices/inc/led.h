@@ -11,6 +11,14 @@
  *
  * @note ESP-EDU have 3 LEDs LED_1: green, LED_2: yellow, LED_3: red
  * 
+ * After LedsDimInit the LEDs are driven by PWM outputs (pwm_mcu.h) and their
+ * brightness can be set (LedDim) or ramped by the LEDC hardware (LedFade, LedBreathe),
+ * without CPU load while the ramp runs. LedOn, LedOff, LedToggle, LedsOffAll and
+ * LedsMask keep working (full brightness or off).
+ * 
+ * @note Dimmable LEDs use PWM_0 (LED_1), PWM_1 (LED_2) and PWM_2 (LED_3), so they
+ * can't be used with other drivers using those outputs (servo_sg90, l293).
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -18,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Dimmable LEDs with hardware fades (LedsDimInit)						|
  * 
  **/
 
@@ -84,6 +93,45 @@ uint8_t LedsOffAll(void);
  */
 uint8_t LedsMask(uint8_t mask);
 
+/**
+ * @brief Switches the LEDs to PWM outputs, to set their brightness
+ * 
+ * @note LedsInit must not be called after it. LEDs start off.
+ * 
+ * @return uint8_t 
+ */
+uint8_t LedsDimInit(void);
+
+/**
+ * @brief Sets the brightness of a LED (stops its fade or breathing)
+ * 
+ * @param led LED number
+ * @param brightness Brightness in % (0 to 100)
+ * @return uint8_t false: if invalid LED number or LedsDimInit wasn't called
+ */
+uint8_t LedDim(led_t led, uint8_t brightness);
+
+/**
+ * @brief Ramps the brightness of a LED from the current one, in hardware
+ * 
+ * @param led LED number
+ * @param brightness Final brightness in % (0 to 100)
+ * @param time_ms Fade time (ms)
+ * @return uint8_t false: if invalid LED number or LedsDimInit wasn't called
+ */
+uint8_t LedFade(led_t led, uint8_t brightness, uint32_t time_ms);
+
+/**
+ * @brief Fades a LED in and out continuously (until LedDim, LedFade, LedOn ...)
+ * 
+ * @note Each ramp is done in hardware, a timer only starts the next one.
+ * 
+ * @param led LED number
+ * @param period_ms Breathing period (ms), fade in plus fade out
+ * @return uint8_t false: if invalid LED number or LedsDimInit wasn't called
+ */
+uint8_t LedBreathe(led_t led, uint32_t period_ms);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
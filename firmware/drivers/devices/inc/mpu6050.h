@@ -17,11 +17,18 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 19/10/2026 | Register reads in a single I2C transaction	                |
+ * | 19/10/2026 | Configuration registers in I2C shadow, batched init writes	|
+ * | 19/10/2026 | FIFO streaming of timestamped sample blocks			|
+ * | 19/10/2026 | Interrupt driven data ready pipeline				|
+ * | 19/10/2026 | Accelerometer and gyroscope offset registers		|
+ * | 19/10/2026 | Free fall, motion and zero motion events			|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "i2c_mcu.h"
+#include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 #undef pgm_read_byte
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
@@ -409,7 +416,72 @@
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 // note: DMP code memory blocks defined at end of header file
 
+#define MPU6050_STREAM_BLOCK_MAX        32  /*!< Maximum number of samples in a stream block */
+#define MPU6050_STREAM_QUEUE_SIZE       8   /*!< Stream blocks buffered until read */
+
+#define MPU6050_EVENT_FREEFALL          0x01    /*!< Free fall detected */
+#define MPU6050_EVENT_MOTION            0x02    /*!< Motion above threshold detected */
+#define MPU6050_EVENT_STILL             0x04    /*!< Zero motion started */
+#define MPU6050_EVENT_MOVING            0x08    /*!< Zero motion ended */
+
 /*==================[typedef]================================================*/
+/**
+ * @brief Stream configuration
+ */
+typedef struct {
+	gpio_t int_pin;					/*!< GPIO connected to MPU6050 INT pin */
+	uint16_t rate;					/*!< Sample rate in Hz (4 to 1000) */
+	uint8_t block;					/*!< Samples per block (1 to MPU6050_STREAM_BLOCK_MAX) */
+	void (*func_p)(void *param);	/*!< Function called when a new block is available (can be NULL) */
+	void *param_p;					/*!< Parameter for func_p */
+} mpu6050_stream_config_t;
+
+/**
+ * @brief Block of consecutive samples read from the FIFO
+ */
+typedef struct {
+	int64_t timestamp;							/*!< Time of first sample (us since boot) */
+	uint32_t period;							/*!< Time between samples (us) */
+	uint8_t count;								/*!< Number of samples */
+	int16_t accel[MPU6050_STREAM_BLOCK_MAX][3];	/*!< Acceleration X, Y, Z (mg) */
+	int16_t gyro[MPU6050_STREAM_BLOCK_MAX][3];	/*!< Angular rate X, Y, Z (0.1 degrees/s) */
+} mpu6050_block_t;
+
+/**
+ * @brief Sample read on data ready interrupt
+ */
+typedef struct {
+	int64_t timestamp;				/*!< Time of data ready interrupt (us since boot) */
+	float accel[3];					/*!< Acceleration X, Y, Z (g) */
+	float gyro[3];					/*!< Angular rate X, Y, Z (rad/s) */
+	float temperature;				/*!< Temperature (degrees Celsius) */
+} mpu6050_sample_t;
+
+/**
+ * @brief Function called with each sample of the data ready pipeline
+ */
+typedef void (*mpu6050_sample_callback_t)(const mpu6050_sample_t *sample, void *param);
+
+/**
+ * @brief Function called with the detected events (MPU6050_EVENT_* mask)
+ */
+typedef void (*mpu6050_event_callback_t)(uint8_t events, void *param);
+
+/**
+ * @brief Hardware event detection configuration
+ */
+typedef struct {
+	gpio_t int_pin;					/*!< GPIO connected to MPU6050 INT pin */
+	uint8_t events;					/*!< Events to detect (MPU6050_EVENT_* mask) */
+	uint16_t freefall_threshold;	/*!< All axes below this acceleration is free fall (mg, 2 to 510) */
+	uint8_t freefall_duration;		/*!< Free fall time before the event (ms) */
+	uint16_t motion_threshold;		/*!< Any axis above this acceleration is motion (mg, 2 to 510) */
+	uint8_t motion_duration;		/*!< Motion time before the event (ms) */
+	uint16_t still_threshold;		/*!< All axes below this acceleration is zero motion (mg, 2 to 510) */
+	uint16_t still_duration;		/*!< Zero motion time before the event (ms, 64 ms steps) */
+	mpu6050_event_callback_t func_p;	/*!< Function called with the events */
+	void *param_p;					/*!< Parameter for func_p */
+} mpu6050_event_config_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -433,6 +505,12 @@ void MPU6050_ReadRegister(uint8_t reg, uint8_t *data, uint8_t len);
  */
 void MPU6050_initialize();
 
+/** Keep configuration registers in the I2C register shadow (called by MPU6050_initialize).
+ * Bit writes to them don't read the register over the bus.
+ * @see I2C_shadowEnable
+ */
+void MPU6050_enableShadow();
+
 /** Verify the I2C connection.
  * Make sure the device is connected and responds as expected.
  * @return True if connection is valid, false otherwise
@@ -2669,6 +2747,122 @@ uint8_t MPU6050_getDeviceID();
  */
 void MPU6050_setDeviceID(uint8_t id);
 
+// XA_OFFS_* and XG_OFFS_USR* registers
+/** Get accelerometer offset registers.
+ * Added to the accelerometer output, in +/-16g units (2048 LSB/g). They hold a factory 
+ * trimmed value after reset. Bit 0 of each register is reserved (temperature compensation).
+ * @param x 16-bit signed integer container for X-axis offset
+ * @param y 16-bit signed integer container for Y-axis offset
+ * @param z 16-bit signed integer container for Z-axis offset
+ * @see MPU6050_RA_XA_OFFS_H
+ */
+void MPU6050_getAccelOffset(int16_t* x, int16_t* y, int16_t* z);
+
+/** Set accelerometer offset registers.
+ * Bit 0 of each value must be kept as read with getAccelOffset().
+ * @param x New X-axis offset (+/-16g units)
+ * @param y New Y-axis offset (+/-16g units)
+ * @param z New Z-axis offset (+/-16g units)
+ * @see getAccelOffset()
+ * @see MPU6050_RA_XA_OFFS_H
+ */
+void MPU6050_setAccelOffset(int16_t x, int16_t y, int16_t z);
+
+/** Get gyroscope offset registers.
+ * Added to the gyroscope output, in +/-1000 degrees/s units (32.8 LSB/(degrees/s)). 
+ * Zero after reset.
+ * @param x 16-bit signed integer container for X-axis offset
+ * @param y 16-bit signed integer container for Y-axis offset
+ * @param z 16-bit signed integer container for Z-axis offset
+ * @see MPU6050_RA_XG_OFFS_USRH
+ */
+void MPU6050_getGyroOffset(int16_t* x, int16_t* y, int16_t* z);
+
+/** Set gyroscope offset registers.
+ * @param x New X-axis offset (+/-1000 degrees/s units)
+ * @param y New Y-axis offset (+/-1000 degrees/s units)
+ * @param z New Z-axis offset (+/-1000 degrees/s units)
+ * @see getGyroOffset()
+ * @see MPU6050_RA_XG_OFFS_USRH
+ */
+void MPU6050_setGyroOffset(int16_t x, int16_t y, int16_t z);
+
+/** Set accelerometer scale correction.
+ * There are no scale registers: the correction is applied to the samples of the data 
+ * ready pipeline (1 = no correction, default).
+ * @param scale X, Y, Z scale factors
+ */
+void MPU6050_setAccelScale(const float scale[3]);
+
+// FIFO streaming
+
+/** Start streaming accelerometer and gyroscope samples through the FIFO.
+ * The sample rate and FIFO are configured, and the data ready interrupt (INT pin) counts the samples.
+ * Each time a block of samples is complete, a driver task drains it from the FIFO with burst reads 
+ * (a FIFO count read plus one read every 21 samples), scales and timestamps it, and queues it. 
+ * Call it after MPU6050_initialize. Full scale ranges must not change while streaming.
+ * It uses the INT pin, so it fails while the data ready pipeline or event detection run.
+ * @param config Stream configuration
+ * @return Status of operation (true = success)
+ */
+bool MPU6050_streamStart(const mpu6050_stream_config_t *config);
+
+/** Get the oldest sample block of the stream.
+ * @param block Block to copy samples to
+ * @param timeout Maximum time to wait for a block in milliseconds (0 to return right away)
+ * @return true if a block was read, false if there was none
+ */
+bool MPU6050_streamRead(mpu6050_block_t *block, uint32_t timeout);
+
+/** Number of samples lost since the stream started: blocks not read in time or FIFO overflows.
+ * @return Samples lost
+ */
+uint32_t MPU6050_streamLost();
+
+/** Stop streaming samples. FIFO and data ready interrupt are disabled.
+ */
+void MPU6050_streamStop();
+
+// Data ready pipeline
+
+/** Start reading each sample as soon as it is ready.
+ * The data ready interrupt (INT pin) wakes a driver task, which reads accelerometer, temperature and 
+ * gyroscope in one burst read, converts them to g, degrees Celsius and rad/s (hardware offsets 
+ * applied) and calls func_p with the sample. Nothing is polled. 
+ * Call it after MPU6050_initialize. It uses the INT pin, so it fails while the FIFO stream or 
+ * event detection run.
+ * @param int_pin GPIO connected to MPU6050 INT pin
+ * @param rate Sample rate in Hz (4 to 1000)
+ * @param func_p Function called with each sample (from the driver task, keep it short)
+ * @param param_p Parameter for func_p
+ * @return Status of operation (true = success)
+ */
+bool MPU6050_dataReadyStart(gpio_t int_pin, uint16_t rate, mpu6050_sample_callback_t func_p, void *param_p);
+
+/** Stop the data ready pipeline.
+ */
+void MPU6050_dataReadyStop();
+
+// Motion events
+
+/** Start hardware detection of free fall, motion and zero motion.
+ * The MPU6050 compares the high pass filtered acceleration with the thresholds and raises 
+ * the INT pin (latched until read). A driver task, woken by the GPIO interrupt, reads the 
+ * interrupt status and calls func_p: the CPU does nothing between events, and can be put to 
+ * light sleep with the INT pin as wake up source. 
+ * Free fall works on the raw acceleration and motion/zero motion on the high pass filtered 
+ * one; the filter is shared, so free fall can't be combined with the other events. 
+ * Call it after MPU6050_initialize. It uses the INT pin, so it fails while the FIFO stream 
+ * or the data ready pipeline run.
+ * @param config Detectors, thresholds and callback
+ * @return Status of operation (true = success)
+ */
+bool MPU6050_eventStart(const mpu6050_event_config_t *config);
+
+/** Stop event detection.
+ */
+void MPU6050_eventStop();
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
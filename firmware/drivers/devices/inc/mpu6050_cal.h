@@ -0,0 +1,111 @@
+#ifndef _MPU6050_CAL_H_
+#define _MPU6050_CAL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup MPU6050_Cal MPU6050 calibration
+ ** @{ */
+
+/** \brief Calibration of the MPU6050 offsets, persisted in NVS.
+ * 
+ * A short capture with the sensor still gives the gyroscope bias and the accelerometer 
+ * offset (the axis closest to vertical is taken as +/-1 g). Both are written to the 
+ * MPU6050 offset registers, so every reading (polled, FIFO stream or data ready 
+ * pipeline) comes out corrected. The result is saved in NVS: on the next boot 
+ * MPU6050_calibrate() only loads it.
+ * 
+ * Accelerometer scale can't be known from a single position. It is measured with 
+ * MPU6050_calAccelPose(), with the sensor resting on each of its 6 faces, and is 
+ * applied to the samples of the data ready pipeline.
+ * 
+ * Call after MPU6050_initialize and before starting the FIFO stream or the data ready 
+ * pipeline. Calibration belongs to one sensor: erase it if the sensor is replaced.
+ * 
+ * NVS is initialized by the application (nvs_flash_init) before calling these 
+ * functions: load, save and erase fail if it isn't.
+ * 
+ * @author Juan Ignacio Cerrudo
+ *
+ * @section changelog
+ *
+ * |   Date	| Description                                    			|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         		|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MPU6050_CAL_SAMPLES     500     /*!< Default samples of a capture (1 kHz) */
+/*==================[typedef]================================================*/
+/**
+ * @brief MPU6050 calibration
+ */
+typedef struct {
+	int16_t gyro_offset[3];			/*!< Gyroscope offset registers X, Y, Z (+/-1000 degrees/s units) */
+	int16_t accel_offset[3];		/*!< Accelerometer offset registers X, Y, Z (+/-16 g units) */
+	float accel_scale[3];			/*!< Accelerometer scale correction X, Y, Z (1 = none) */
+} mpu6050_cal_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/** @fn bool MPU6050_calibrate(bool force)
+ * @brief Load the calibration from NVS, or run and save it if there is none
+ * The sensor must be still if calibration runs.
+ * @param[in] force Run the calibration even if there is one saved
+ * @return true if the sensor is calibrated
+ */
+bool MPU6050_calibrate(bool force);
+
+/** @fn bool MPU6050_calRun(uint16_t samples)
+ * @brief Capture with the sensor still and update gyroscope and accelerometer offsets
+ * Offset registers are written. Not saved to NVS (see MPU6050_calSave).
+ * @param[in] samples Samples to average (1 kHz)
+ * @return false if the sensor moved during the capture or samples is 0
+ */
+bool MPU6050_calRun(uint16_t samples);
+
+/** @fn bool MPU6050_calAccelPose(uint16_t samples, uint8_t *axes)
+ * @brief Capture one position of the accelerometer scale calibration
+ * Rest the sensor on one face and call it, then repeat on the other faces. When an axis 
+ * has been measured pointing up and down, its offset and scale are updated.
+ * Not saved to NVS (see MPU6050_calSave).
+ * @param[in] samples Samples to average (1 kHz)
+ * @param[out] axes Axes with scale calibrated (bit 0 = X, bit 1 = Y, bit 2 = Z)
+ * @return false if the sensor moved during the capture or samples is 0
+ */
+bool MPU6050_calAccelPose(uint16_t samples, uint8_t *axes);
+
+/** @fn bool MPU6050_calLoad(void)
+ * @brief Load the calibration from NVS and apply it
+ * @return false if there is no calibration saved or NVS isn't initialized
+ */
+bool MPU6050_calLoad(void);
+
+/** @fn bool MPU6050_calSave(void)
+ * @brief Save the current calibration to NVS
+ * @return Status of operation (true = success)
+ */
+bool MPU6050_calSave(void);
+
+/** @fn bool MPU6050_calErase(void)
+ * @brief Erase the calibration saved in NVS
+ * @return Status of operation (true = success)
+ */
+bool MPU6050_calErase(void);
+
+/** @fn void MPU6050_calGet(mpu6050_cal_t *cal)
+ * @brief Get the current calibration
+ * @param[out] cal Calibration
+ */
+void MPU6050_calGet(mpu6050_cal_t *cal);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* _MPU6050_CAL_H_ */
+
+/*==================[end of file]============================================*/
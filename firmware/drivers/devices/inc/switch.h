@@ -12,6 +12,25 @@
  * @note ESP-EDU have 2 switches connected to GPIO_4 and GPIO_15. 
  * The latter is also routed to J2 connector.
  *
+ * Besides reading the switches (SwitchesRead) or attaching an ISR to them
+ * (SwitchActivInt), a task can wait for debounced switch events (SwitchEventsInit):
+ *
+ * @code
+ * static void KeysTask(void *pvParameter){
+ *     switch_event_t event;
+ *     while(1){
+ *         SwitchEventWait(&event, portMAX_DELAY);
+ *         if(event.sw == SWITCH_1 && event.type == SWITCH_EV_CLICK){
+ *             ...
+ *         }
+ *     }
+ * }
+ * @endcode
+ *
+ * A press edge interrupt timestamps the press and starts a 5 ms timer that debounces
+ * the switches and generates the events. The timer stops when all the switches are
+ * released, so idle switches cost nothing.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,19 +38,47 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Debounced switch events (SwitchEventsInit)							|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
 /*==================[macros]=================================================*/
+#define SWITCH_DEBOUNCE_MS	20		/**< Time a switch level must be stable */
+#define SWITCH_LONG_MS		800		/**< Press time to SWITCH_EV_LONG_PRESS */
+#define SWITCH_REPEAT_MS	200		/**< SWITCH_EV_REPEAT period after SWITCH_EV_LONG_PRESS */
+#define SWITCH_DOUBLE_MS	300		/**< Maximum time from release to second press of a double click */
+#define SWITCH_QUEUE_LEN	16		/**< Events waiting to be read */
 
 /*==================[typedef]================================================*/
 typedef enum switches {
     SWITCH_1 = (1 << 0),  /**< Routed to GPIO_4 */
     SWITCH_2 = (1 << 1),  /**< Routed to GPIO_15 */
 } switch_t;
+
+/**
+ * @brief Switch events
+ */
+typedef enum {
+    SWITCH_EV_PRESS,			/**< Switch pressed */
+    SWITCH_EV_RELEASE,			/**< Switch released */
+    SWITCH_EV_CLICK,			/**< Press and release, not followed by a second press (SWITCH_DOUBLE_MS) */
+    SWITCH_EV_DOUBLE_CLICK,		/**< Second press within SWITCH_DOUBLE_MS of a click */
+    SWITCH_EV_LONG_PRESS,		/**< Switch held SWITCH_LONG_MS */
+    SWITCH_EV_REPEAT,			/**< Switch still held, every SWITCH_REPEAT_MS after SWITCH_EV_LONG_PRESS */
+} switch_event_type_t;
+
+/**
+ * @brief Switch event
+ */
+typedef struct {
+    switch_t sw;				/**< Switch */
+    switch_event_type_t type;	/**< Event */
+    uint32_t time;				/**< Time (ms since boot), SWITCH_EV_PRESS: time of the first edge */
+} switch_event_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -58,6 +105,33 @@ int8_t SwitchesRead(void);
  */
 void SwitchActivInt(switch_t tec, void *ptrIntFunc, void *args);
 
+/**
+ * @brief Starts the switch events service
+ * 
+ * @note SwitchesInit must be called first. It uses the switches interruptions, so
+ * SwitchActivInt must not be used with it. A long press generates SWITCH_EV_PRESS,
+ * SWITCH_EV_LONG_PRESS, SWITCH_EV_REPEAT ... and SWITCH_EV_RELEASE, but not SWITCH_EV_CLICK.
+ * 
+ * @return false if the queue or the timer couldn't be created
+ */
+bool SwitchEventsInit(void);
+
+/**
+ * @brief Waits for a switch event
+ * 
+ * @param event Pointer to event
+ * @param timeout Maximum time to wait (ticks, portMAX_DELAY: forever)
+ * @return false if no event arrived within timeout
+ */
+bool SwitchEventWait(switch_event_t *event, TickType_t timeout);
+
+/**
+ * @brief Gets the number of events lost because the queue was full
+ * 
+ * @return uint32_t Events lost
+ */
+uint32_t SwitchEventsDropped(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
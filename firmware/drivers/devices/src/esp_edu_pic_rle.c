@@ -0,0 +1,1787 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "ili9341.h"
+
+/* 240x320 pixels, 256 colors, 52910 bytes (153600 bytes uncompressed). Created with tools/image_rle.py */
+const uint16_t esp_edu_pic_palette[] = {
+ 0x3b08,0x39e7,0xffff,0x19e5,0xce59,0x9cd3,0xc638,0x3186,0x3ae8,0x2a66,0xef7d,0x39c7,
+ 0x32a7,0x18c3,0xf7be,0xffdf,0xfe80,0x19c5,0xe73c,0xf79e,0x3ae7,0x538b,0x31a6,0x2205,
+ 0x32c7,0x62eb,0x2124,0x2226,0x63ec,0xd6da,0x2965,0xdefb,0xb596,0xadb5,0x2a46,0x7cb0,
+ 0xce99,0x6c0e,0x3287,0x3ac7,0x4b6a,0x4b49,0xb5f6,0xe75c,0xef5d,0x9d53,0x5acb,0xff44,
+ 0xbe17,0x6b4d,0xdf1b,0xc658,0xff64,0x18e3,0xbe37,0x8c51,0x2945,0xa594,0x4328,0x4329,
+ 0x2225,0x5aeb,0x744e,0x2a86,0x3ac8,0x2246,0x8c71,0x1a05,0xadd5,0x4208,0x52aa,0x94b2,
+ 0xef9d,0x5bcc,0x2a87,0xd6ba,0x9512,0x9532,0x4a69,0x538a,0xad75,0x746f,0x1082,0x8cf1,
+ 0x528a,0x5bab,0x9d73,0xa574,0x84b0,0x3a07,0xc678,0x536a,0x9cf3,0xf660,0x8410,0x8490,
+ 0xce79,0x8d12,0x4b4a,0x2104,0x6c0d,0x9d33,0x3aa8,0x640d,0x4349,0x0000,0x8cd1,0x9533,
+ 0xadd6,0xb5d6,0x73ae,0xceb9,0x84d1,0x744f,0x632c,0x84d0,0x7c90,0xad55,0xe71c,0xb616,
+ 0x6b6d,0x21e6,0x4308,0x6c2e,0x4a49,0x742e,0xa534,0x7bef,0x4228,0x7c8f,0x9d74,0x31c6,
+ 0x4207,0x94f2,0xa4a3,0x8c91,0x630c,0x6bee,0x7c6f,0xa514,0xf7de,0x63cd,0x2206,0x6b23,
+ 0x8430,0x5bac,0x7bcf,0x8491,0x8cd2,0x3267,0xb5b6,0xff24,0x9553,0xad95,0xa554,0x6c2d,
+ 0xbdf7,0x4a23,0x41e3,0x3a88,0x9492,0xc679,0x2a67,0x84b1,0x2a47,0x9513,0x53ab,0x742f,
+ 0x10a2,0xf6e4,0xa5b5,0x4309,0xbd63,0xdeda,0xd624,0x8cb1,0xeee4,0x7c70,0x4b0a,0xb617,
+ 0x9d54,0x738e,0xa595,0x6303,0xbe58,0xeec4,0xd6fa,0x7c50,0x3aa9,0x63ed,0x5b8c,0x8cf2,
+ 0x740f,0x42e9,0x31e6,0x42c9,0xadb6,0xb5f7,0xbe38,0xceba,0xde44,0xdedb,0xa575,0xbdd7,
+ 0xd6fb,0xfff6,0x9d13,0xf704,0x18c2,0x62c4,0xadf6,0x4a47,0x6b2a,0x4b2a,0x2a26,0x8c03,
+ 0xc618,0x4b69,0x94d2,0x94f3,0xe75d,0x534b,0x3a27,0xc699,0xe601,0xc543,0x63cc,0x63ad,
+ 0x2966,0x536b,0x9d34,0x7363,0x9c83,0xa462,0x9443,0xbd03,0x5bcb,0x3a67,0xa442,0xdf1c,
+ 0x29a6,0xcda9,0xd69a,0x3162,0x2103,0x2943,0x31a3,0xf680,0xc5ef,0x8470,0x8cb2,0x21e5,
+ 0x630b,0xb523,0xa464,0x7c4f,
+};
+
+const uint8_t esp_edu_pic_data[] = {
+ 0xff,0x02,0xff,0x02,0xff,0x02,0xe4,0x02,0x03,0x0e,0xa1,0x39,0x70,0xff,0x23,0xc2,0x23,0x00,0x4b,0x86,0x76,0x01,0xcc,0x53,0x8c,0x23,0x03,0x53,0x39,0x1d,
+ 0x0f,0x8c,0x02,0x01,0xba,0x64,0xff,0x00,0xc5,0x00,0x00,0x32,0x84,0x02,0x03,0x0f,0x02,0x13,0x49,0x8e,0x00,0x02,0x3a,0x51,0x32,0x8a,0x02,0x01,0x24,0x4f,
+ 0xff,0x00,0xc6,0x00,0x00,0x32,0x81,0x02,0x06,0x13,0x36,0x57,0x4c,0x02,0x13,0x49,0x90,0x00,0x01,0x49,0x32,0x88,0x02,0x01,0x0a,0x49,0xff,0x00,0xc7,0x00,
+ 0x09,0x32,0x02,0x36,0x7b,0xaa,0x32,0x0e,0x02,0x13,0x49,0x91,0x00,0x01,0x67,0x0e,0x87,0x02,0x00,0x44,0xff,0x00,0xc8,0x00,0x09,0x32,0x02,0x32,0x53,0x7d,
+ 0x6b,0x24,0x02,0x13,0x49,0x92,0x00,0x00,0x33,0x86,0x02,0x01,0x0f,0x7b,0xf1,0x00,0x83,0x08,0x81,0x00,0x82,0x08,0x82,0x00,0x82,0x08,0x87,0x00,0x04,0x3e,
+ 0x98,0x3e,0x1c,0xe2,0x81,0x00,0x82,0x08,0x82,0x00,0x81,0x08,0x82,0x00,0x82,0x08,0x8e,0x00,0x82,0x08,0x82,0x00,0x00,0x18,0x81,0x0c,0x02,0x08,0x00,0x08,
+ 0x81,0x0c,0x00,0x18,0x8c,0x00,0x00,0x32,0x82,0x02,0x05,0x0f,0x12,0x21,0x02,0x13,0x49,0x92,0x00,0x00,0x58,0x86,0x02,0x01,0x13,0x49,0x89,0x00,0x03,0x3a,
+ 0x28,0x4f,0x28,0x91,0x00,0x05,0x14,0x09,0x1b,0x3c,0x22,0x18,0x88,0x00,0x01,0x14,0x09,0x81,0x1b,0x01,0x22,0x18,0x83,0x00,0x00,0x3a,0x99,0x00,0x02,0x08,
+ 0x14,0x08,0x8b,0x00,0x02,0x08,0x27,0x08,0x89,0x00,0x01,0x14,0x4a,0x83,0x03,0x81,0x09,0x81,0x03,0x03,0x11,0xa2,0xab,0x22,0x82,0x03,0x00,0x26,0x86,0x00,
+ 0x06,0x53,0x2d,0xb3,0x6b,0x65,0x40,0x17,0x82,0x03,0x02,0x3f,0x0c,0x17,0x81,0x03,0x02,0x09,0x7a,0x41,0x82,0x03,0x06,0x26,0x00,0x3b,0x3a,0x00,0x3a,0x00,
+ 0x81,0x3b,0x02,0x3a,0x00,0x18,0x81,0x26,0x00,0x22,0x82,0x03,0x02,0x17,0x4a,0x22,0x82,0x03,0x02,0xa4,0x29,0x95,0x82,0x03,0x01,0x22,0x00,0x81,0x4f,0x05,
+ 0x00,0x29,0x7a,0x3b,0xa6,0x7a,0x82,0x00,0x09,0x32,0x02,0x5a,0x61,0x70,0x61,0x70,0x02,0x13,0x49,0x84,0x00,0x02,0x29,0x4f,0x28,0x8a,0x00,0x00,0x3e,0x86,
+ 0x02,0x01,0x0a,0x15,0x87,0x00,0x07,0x28,0x4d,0xa1,0x2b,0x0a,0x76,0x2a,0xbd,0x8e,0x00,0x07,0x18,0x43,0x11,0x27,0x7a,0x17,0x03,0x09,0x87,0x00,0x01,0x0c,
+ 0x03,0x81,0x7a,0x01,0x22,0x09,0x82,0x00,0x03,0x51,0xb3,0x2a,0x73,0x8f,0x00,0x03,0x15,0x7b,0x67,0x49,0x81,0x00,0x02,0x08,0x09,0x17,0x81,0x03,0x01,0x1b,
+ 0x0c,0x87,0x00,0x06,0x08,0x22,0x03,0x11,0x03,0x1b,0x14,0x86,0x00,0x06,0x0c,0x43,0x03,0xc3,0xc0,0xbb,0xdd,0x81,0x03,0x0a,0xc1,0x85,0xf9,0xc0,0x5c,0xdd,
+ 0x93,0xf9,0xc3,0x03,0x08,0x85,0x00,0x1f,0x53,0x4b,0xbb,0xb4,0x1f,0x95,0xc3,0x7d,0x89,0xb2,0x03,0x11,0xbc,0xc0,0xe3,0x72,0x47,0xdd,0x64,0xbb,0xc3,0x03,
+ 0x27,0x2a,0xaa,0x49,0x82,0x28,0x2d,0x5a,0x49,0x09,0x83,0x03,0x18,0xe3,0xbb,0xc0,0xa4,0x03,0x11,0xbe,0x99,0x65,0x72,0x90,0x72,0xe6,0xc4,0xe3,0x03,0x14,
+ 0x24,0x36,0x74,0x60,0x4f,0x2d,0xc5,0x3b,0x82,0x00,0x09,0x32,0x02,0x21,0x4b,0x53,0x4b,0x8a,0x02,0x13,0x49,0x81,0x00,0x08,0x3b,0x3e,0x2a,0xef,0x48,0x2b,
+ 0x36,0x8a,0x68,0x87,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x01,0x1c,0x1d,0x85,0x02,0x02,0x13,0x4c,0x3a,0x8b,0x00,0x03,0x08,0x17,0x03,0x53,
+ 0x81,0xcd,0x03,0xf8,0x5b,0x03,0x26,0x84,0x00,0x03,0x14,0x18,0xec,0xf8,0x81,0xcd,0x08,0x5a,0x9b,0x18,0x0c,0x00,0x8a,0x24,0x44,0x2d,0x8f,0x00,0x08,0x4f,
+ 0x5a,0x21,0x2a,0x00,0x14,0x17,0x03,0x5b,0x81,0x4f,0x02,0x22,0x03,0x26,0x87,0x00,0x01,0x27,0x5b,0x81,0x4f,0x01,0x7a,0x08,0x85,0x00,0x04,0x0c,0x03,0x17,
+ 0x0c,0xbf,0x81,0x12,0x00,0x21,0x81,0x18,0x0d,0x6b,0x2c,0xf2,0x16,0x1e,0xe4,0x32,0x2c,0x9a,0x03,0x18,0x1c,0x9b,0xa6,0x82,0x00,0x06,0x7b,0xdd,0xa7,0x09,
+ 0x5f,0x08,0x6a,0x81,0x12,0x06,0x6d,0x4a,0x09,0x6a,0x2c,0x1f,0x45,0x81,0x1e,0x0e,0xad,0x2c,0xc4,0x03,0x18,0x24,0xb3,0x70,0x60,0x55,0x4f,0x1d,0xdd,0x03,
+ 0x41,0x81,0x18,0x01,0x40,0x1f,0x81,0x12,0x00,0xbd,0x81,0x18,0x12,0x6b,0x12,0xc9,0x01,0x1e,0x07,0xc9,0x2c,0x9a,0x03,0x18,0xba,0x5a,0x3e,0xc6,0x4f,0x1d,
+ 0x30,0xbd,0x82,0x00,0x0d,0x32,0x02,0x21,0x56,0x58,0x6b,0x58,0x02,0x13,0x49,0x00,0x3b,0xb6,0x8c,0x85,0x02,0x01,0x33,0x15,0x86,0x00,0x00,0x1c,0x86,0x02,
+ 0x01,0x0a,0x15,0x85,0x00,0x01,0x4f,0x32,0x87,0x02,0x01,0x0f,0x61,0x8b,0x00,0x05,0x26,0x03,0x4d,0xcd,0x5a,0x36,0x81,0xcd,0x02,0x27,0x17,0x08,0x83,0x00,
+ 0x05,0x09,0x43,0xf8,0xcd,0x5a,0x36,0x81,0xcd,0x06,0x09,0x3c,0x00,0x8a,0x70,0x57,0xa6,0x8f,0x00,0x07,0x3e,0x2d,0x06,0x61,0x00,0x22,0x03,0xf8,0x82,0xcd,
+ 0x03,0x5a,0x27,0x03,0x14,0x84,0x00,0x02,0x41,0x3a,0xf8,0x83,0xcd,0x02,0xec,0x41,0x08,0x82,0x00,0x05,0x0c,0x03,0x43,0x18,0x08,0x4c,0x81,0x0a,0x17,0x2a,
+ 0x0c,0x26,0xa5,0x2c,0xf2,0x16,0x1e,0xe4,0x32,0x2c,0xca,0x03,0x55,0x2b,0x65,0x2a,0x28,0x00,0x08,0x1b,0x03,0x3f,0x08,0x81,0x0c,0x00,0x6a,0x81,0x13,0x00,
+ 0x30,0x81,0x14,0x03,0x4c,0x2c,0x1f,0x45,0x81,0x1e,0x15,0xad,0x2c,0xc4,0x03,0x18,0x33,0x36,0x55,0x44,0x64,0x9b,0x2d,0x89,0x41,0x08,0x0c,0x26,0x0c,0x1f,
+ 0x0a,0x2c,0xe2,0x81,0x26,0x12,0x6b,0x12,0xc9,0x01,0x1e,0x07,0xc9,0x2c,0x9a,0x03,0x18,0x06,0x44,0x1c,0x5a,0x3e,0x33,0x44,0x7b,0x82,0x00,0x0b,0x32,0x02,
+ 0x0a,0x2a,0x4b,0x1d,0x12,0x02,0x13,0x49,0x3b,0xb6,0x88,0x02,0x01,0x24,0x28,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x01,0x3a,0xb3,0x89,
+ 0x02,0x01,0x48,0x1c,0x8a,0x00,0x01,0x22,0x11,0x81,0xcd,0x06,0x47,0x92,0x5a,0xcd,0x81,0x1b,0x74,0x83,0x53,0x0e,0xd5,0x3a,0xcd,0x2b,0x5e,0x7f,0xad,0xcd,
+ 0x7a,0x03,0x00,0x6d,0xaa,0x1d,0x70,0x8f,0x00,0x0e,0x58,0x5b,0x58,0x28,0x14,0x03,0x4f,0xcd,0x5a,0x50,0x39,0xcd,0x4d,0x11,0xdd,0x83,0x3e,0x0a,0xbd,0x03,
+ 0x1c,0xcd,0x5a,0x50,0x2a,0xcd,0x4d,0x03,0x0c,0x82,0x00,0x05,0x17,0x43,0x18,0x08,0x1b,0xdd,0x81,0x45,0x17,0x3d,0x1b,0x03,0x93,0x06,0x9a,0x80,0x6e,0x3d,
+ 0x9c,0x06,0xd5,0x03,0x25,0x2b,0x53,0x36,0x4f,0x08,0x1b,0x03,0x09,0x00,0x09,0x81,0x03,0x00,0xbe,0x81,0x80,0x17,0x3d,0xd6,0x03,0x89,0x04,0xcb,0x3d,0x78,
+ 0x3d,0x96,0x24,0xb1,0x03,0x18,0x58,0x1c,0x71,0x56,0x58,0x74,0xaf,0xa2,0x08,0x26,0x81,0x03,0x04,0xd6,0x4e,0x45,0x80,0xbc,0x81,0x03,0x12,0xd5,0x85,0xaf,
+ 0x6e,0x5c,0x78,0x6a,0x82,0x8d,0x03,0x14,0x28,0x29,0x28,0x7b,0x49,0x28,0x64,0x7a,0x82,0x00,0x05,0x32,0x02,0x24,0x23,0x44,0x76,0x81,0x02,0x03,0x13,0x49,
+ 0x8a,0x8c,0x89,0x02,0x00,0x4d,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x01,0x49,0x48,0x8a,0x02,0x00,0x39,0x8a,0x00,0x0a,0x1b,0x11,0xcd,
+ 0x8c,0x13,0x0a,0x0f,0xcd,0x44,0xc0,0x58,0x83,0x73,0x03,0x71,0x4c,0xcd,0x48,0x81,0x0a,0x08,0x8c,0xcd,0x3e,0x03,0x08,0x57,0x60,0x6b,0x8a,0x81,0x00,0x01,
+ 0x08,0x18,0x8b,0x00,0x00,0x44,0x81,0x2a,0x07,0x61,0x18,0x03,0xf8,0xcd,0x5a,0x05,0x75,0x81,0xcd,0x01,0x0c,0xc1,0x83,0x8a,0x06,0x25,0x03,0x4d,0xcd,0x5a,
+ 0x05,0x20,0x81,0xcd,0x01,0x11,0x09,0x81,0x00,0x06,0x08,0x03,0x22,0x08,0x1b,0x03,0x47,0x81,0xe4,0x1a,0x5e,0x66,0x11,0x03,0x8e,0x03,0xd6,0xe5,0x95,0x17,
+ 0x0c,0x1b,0x43,0x15,0x3e,0x7b,0x49,0x00,0x26,0x03,0x22,0x00,0x09,0x03,0x41,0x09,0x7e,0x81,0x1e,0x0d,0x72,0xbc,0x11,0x03,0x8e,0x17,0x95,0x8d,0xc3,0x8e,
+ 0x3b,0x1b,0x17,0x08,0x84,0x00,0x08,0x27,0x03,0x09,0x14,0x03,0x17,0x0c,0x7d,0x88,0x81,0x1e,0x01,0xb1,0x03,0x81,0x11,0x81,0x03,0x06,0x1b,0x08,0x8e,0x17,
+ 0x00,0x17,0x3c,0x8b,0x00,0x00,0x32,0x81,0x02,0x07,0x44,0x56,0x53,0x51,0x02,0x13,0x49,0x36,0x8a,0x02,0x01,0x1f,0x68,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x84,0x00,0x00,0x81,0x8b,0x02,0x01,0x6f,0x3b,0x89,0x00,0x02,0x09,0x03,0x77,0x92,0x02,0x03,0x48,0x7a,0x11,0x17,0x83,0x03,0x81,0x1b,0x82,0x03,
+ 0x0c,0x0c,0x00,0x0c,0x22,0x3f,0x26,0x0c,0x71,0x53,0x15,0x26,0xb2,0xa4,0x81,0x17,0x03,0x3c,0x03,0x73,0xcd,0x82,0x02,0x81,0x8c,0x01,0x06,0x9c,0x83,0x36,
+ 0x03,0x30,0x9c,0x32,0x8c,0x82,0x02,0x03,0x8c,0xcd,0x03,0x09,0x81,0x00,0x03,0x08,0x11,0x09,0x14,0x81,0x03,0x1d,0x90,0x1e,0xe4,0x72,0x95,0x03,0xc1,0xbb,
+ 0xb2,0x03,0x08,0x1b,0xa4,0x25,0xc1,0xdd,0x7d,0x36,0x39,0x24,0x28,0x4a,0x11,0x27,0x26,0x03,0x22,0x00,0x09,0x7f,0x81,0x1e,0x0a,0x3d,0x26,0x03,0xd6,0xdd,
+ 0x03,0x17,0x08,0x1b,0x8e,0x64,0x81,0xc1,0x00,0x08,0x84,0x00,0x08,0x27,0x03,0x09,0x18,0x11,0x3f,0x14,0xbe,0x54,0x81,0x1e,0x00,0x89,0x81,0x03,0x07,0x1b,
+ 0x22,0x03,0x22,0x00,0x03,0x26,0x29,0x81,0x22,0x8b,0x00,0x0a,0x32,0x02,0x0a,0x4c,0x81,0x74,0x44,0x02,0x13,0x7b,0x2b,0x8b,0x02,0x00,0x49,0x84,0x00,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0x2d,0x8b,0x02,0x01,0x12,0x29,0x87,0x00,0x09,0x68,0x28,0x18,0x03,0x53,0x02,0x0e,0xcb,0x96,0x0e,0x89,0x02,
+ 0x05,0x60,0x75,0x2c,0x02,0x5a,0x4a,0x81,0x03,0x03,0x6e,0xa5,0xe6,0xdd,0x81,0x43,0x04,0x09,0x08,0x17,0x03,0x1b,0x83,0x03,0x05,0xc1,0xca,0xdd,0x99,0x9f,
+ 0x95,0x81,0xe3,0x00,0xd6,0x81,0x11,0x01,0x5b,0x8c,0x81,0x02,0x00,0x0e,0x8b,0x02,0x81,0x0f,0x81,0x02,0x02,0x4d,0x03,0x0c,0x81,0x00,0x06,0x08,0x11,0x09,
+ 0x14,0x03,0x11,0xe3,0x81,0x7e,0x0e,0x87,0x09,0x17,0xa3,0x2c,0x85,0x03,0x14,0x17,0xb2,0x2c,0x06,0xaf,0x8d,0x67,0x82,0x00,0x08,0x4a,0x03,0x27,0x4a,0x03,
+ 0x18,0x00,0x22,0x91,0x81,0x5c,0x0d,0xbb,0x41,0x17,0x9a,0x12,0xa7,0x03,0x08,0x03,0xbe,0x12,0x2a,0xfa,0x62,0x84,0x00,0x08,0x27,0x03,0x09,0x18,0x11,0x3f,
+ 0x0c,0x09,0xe6,0x81,0x7e,0x0d,0xbc,0x3c,0xd6,0x33,0x76,0xb2,0x1b,0x18,0x03,0x94,0x12,0x93,0xda,0x7a,0x8a,0x00,0x0a,0x32,0x02,0x1d,0x33,0x13,0x02,0x0f,
+ 0x02,0x13,0x8a,0x0a,0x8b,0x02,0x00,0x51,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0x53,0x8b,0x02,0x01,0x32,0x29,0x87,0x00,0x06,0x53,
+ 0x36,0x00,0x49,0x93,0x02,0x9c,0x81,0x19,0x00,0x75,0x88,0x02,0x09,0x1f,0x72,0x19,0x7f,0x02,0xb8,0x3e,0x26,0x03,0x99,0x81,0x2c,0x00,0x39,0x81,0x08,0x02,
+ 0x55,0x5a,0x0c,0x81,0x03,0x09,0x1b,0x55,0xab,0x0c,0xe5,0x6a,0x08,0x85,0xab,0x6a,0x81,0x12,0x01,0xc4,0x11,0x81,0x03,0x05,0x1f,0x02,0x20,0x5e,0x20,0x0f,
+ 0x88,0x02,0x07,0x60,0x90,0x47,0x13,0x0f,0x7d,0x0c,0x08,0x81,0x00,0x06,0x08,0x03,0x09,0x14,0x03,0x11,0xa3,0x81,0x0a,0x0d,0x2a,0x7a,0x14,0x4c,0x0a,0x57,
+ 0x0c,0x00,0x17,0xb2,0x0a,0x33,0xaf,0x29,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x81,0x00,0x00,0xbf,0x81,0x0a,0x0d,0x36,0x00,0x18,0x99,0x13,0x85,
+ 0x26,0x00,0x03,0x89,0x13,0xc5,0xfa,0x62,0x84,0x00,0x08,0x27,0x03,0x09,0x18,0x11,0x3f,0x00,0x3a,0x32,0x81,0x0a,0x0d,0x7d,0x00,0x7a,0x4b,0x0a,0x15,0x26,
+ 0x18,0x03,0xbf,0x13,0x85,0xda,0x7a,0x8a,0x00,0x00,0x32,0x84,0x02,0x04,0x99,0x02,0x13,0x7b,0x2b,0x8b,0x02,0x00,0x7b,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x84,0x00,0x01,0x67,0x0f,0x8a,0x02,0x01,0x36,0x7a,0x87,0x00,0x06,0x29,0x49,0x00,0x58,0x9a,0x02,0x96,0x81,0x19,0x00,0x8b,0x82,0x02,0x00,0x0e,
+ 0x81,0x0a,0x82,0x02,0x09,0xc9,0x72,0x19,0x5e,0x02,0xb8,0x4c,0x18,0x03,0x85,0x81,0x1f,0x00,0x6b,0x81,0x0c,0x11,0x08,0x67,0x1b,0x03,0x11,0x0c,0x12,0x81,
+ 0x14,0x91,0x58,0x5f,0x70,0x00,0x6a,0x13,0x0e,0xc4,0x81,0x03,0x06,0xe3,0x1f,0x0e,0x88,0x19,0x78,0x2c,0x87,0x02,0x01,0x0f,0x37,0x81,0x19,0x03,0x60,0x0f,
+ 0x65,0xbd,0x82,0x00,0x06,0x08,0x11,0x09,0x14,0x03,0x11,0x8d,0x81,0x60,0x05,0xa3,0x09,0x5b,0x6a,0x24,0x85,0x81,0x08,0x05,0xd6,0xc3,0x24,0x21,0x87,0x29,
+ 0x83,0x00,0x10,0x4a,0x03,0x27,0x4a,0x03,0x18,0x08,0x09,0xbd,0x60,0xf2,0xa5,0x26,0x08,0x2d,0x4b,0x85,0x81,0x00,0x08,0xfb,0x89,0xad,0x99,0x94,0x62,0x3b,
+ 0xec,0x55,0x81,0x00,0x1a,0x27,0x03,0x09,0x18,0x03,0x3f,0x0c,0x22,0x94,0x60,0x33,0xdd,0x17,0x22,0x06,0x24,0x1c,0x00,0x18,0x03,0x6a,0x24,0xaf,0xda,0x7a,
+ 0x00,0x29,0x88,0x00,0x02,0x32,0x02,0x24,0x82,0x6b,0x04,0x7d,0x02,0x13,0x49,0x6f,0x8a,0x02,0x01,0x0e,0x28,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,
+ 0x84,0x00,0x01,0x3b,0x4b,0x8a,0x02,0x00,0x23,0x8b,0x00,0x09,0x58,0x57,0x02,0x13,0x8b,0x5c,0x2c,0x02,0x12,0x47,0x82,0x78,0x0c,0x7f,0x60,0x02,0x0f,0x96,
+ 0x5c,0x1f,0x02,0xb8,0x4d,0x14,0x17,0xb2,0x81,0x45,0x01,0x6e,0x8e,0x81,0x03,0x19,0x17,0x03,0x17,0x03,0x3c,0x62,0x0c,0x43,0xbe,0x30,0xa5,0xb4,0x66,0xb2,
+ 0x46,0x54,0xb2,0x8e,0x03,0x71,0x1f,0x0f,0x92,0x19,0x7f,0x13,0x81,0x02,0x04,0x76,0x30,0xcb,0xf2,0x0e,0x81,0x02,0x06,0x8b,0x19,0x31,0x1f,0x0f,0x9a,0x64,
+ 0x82,0x00,0x0e,0x08,0x11,0x09,0x14,0x03,0x11,0x03,0xab,0x3b,0x17,0x03,0x7e,0xfc,0xb5,0xfc,0x81,0x2e,0x81,0x46,0x03,0xb5,0x31,0x87,0x29,0x83,0x00,0x10,
+ 0x4a,0x11,0x27,0x4a,0x03,0x18,0x00,0x41,0x03,0xc1,0x62,0xd6,0x03,0xf9,0xfc,0xb5,0xfc,0x81,0x46,0x1b,0x54,0x2e,0xb5,0x72,0x05,0x62,0x39,0x30,0x44,0x51,
+ 0x00,0x27,0x03,0x09,0x18,0x03,0x3f,0x14,0x43,0x8e,0x62,0x40,0x03,0x95,0x78,0x6e,0x37,0x46,0x82,0x4e,0x08,0x88,0xa0,0x72,0x5c,0x7a,0x30,0x2a,0x6c,0x15,
+ 0x86,0x00,0x02,0x32,0x02,0x48,0x82,0x32,0x04,0x5f,0x02,0x13,0x49,0x4c,0x8a,0x02,0x01,0x33,0x3a,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x85,0x00,
+ 0x01,0x3e,0x0f,0x88,0x02,0x01,0xa1,0x3b,0x8b,0x00,0x01,0x58,0x57,0x84,0x02,0x01,0xf2,0x31,0x84,0x19,0x02,0xfc,0x8b,0x0f,0x83,0x02,0x04,0xb8,0x4d,0x00,
+ 0x0c,0x5e,0x81,0x1e,0x01,0xdb,0xa4,0x81,0x11,0x03,0x03,0x11,0x3f,0x26,0x82,0x03,0x06,0x11,0x26,0xc3,0x11,0x03,0xa4,0x42,0x81,0x1e,0x0c,0x92,0xb2,0x11,
+ 0xb1,0x1f,0x02,0x0a,0x60,0x2c,0x02,0x12,0x42,0x72,0x81,0x19,0x0a,0xfc,0xb5,0x04,0x02,0x0e,0x60,0x76,0x02,0x0f,0x9a,0x64,0x82,0x00,0x06,0x08,0x03,0x09,
+ 0x14,0x03,0x1b,0xab,0x81,0x62,0x02,0x0c,0x18,0x50,0x88,0x19,0x01,0xa0,0x62,0x83,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x81,0x00,0x05,0x62,0x8a,0x23,
+ 0x64,0x0c,0xce,0x88,0x19,0x14,0x5c,0xe5,0x1f,0xaa,0x2d,0x53,0x00,0x27,0x03,0x09,0x18,0x11,0x3f,0x00,0x08,0xbd,0x81,0x71,0x7a,0xb2,0x42,0x87,0x19,0x06,
+ 0x2e,0x5c,0x15,0x0a,0x58,0x82,0x67,0x86,0x00,0x00,0x32,0x84,0x02,0x05,0x4b,0x02,0x13,0x49,0x28,0x12,0x88,0x02,0x01,0x0e,0x7b,0x85,0x00,0x00,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x86,0x00,0x00,0x65,0x87,0x02,0x01,0x1f,0x15,0x87,0x00,0x06,0x3e,0x5b,0x61,0x67,0x00,0x58,0x57,0x83,0x02,0x01,0x0a,0x88,0x87,0x19,
+ 0x00,0x30,0x83,0x02,0x04,0xb8,0x4d,0x08,0x1b,0x6e,0x81,0x1e,0x11,0x46,0x17,0x66,0xc0,0x89,0xbc,0x03,0x08,0x14,0x26,0x3f,0x03,0x1b,0xb2,0xc1,0x03,0x8e,
+ 0xbb,0x81,0x1e,0x04,0xb5,0xc3,0x17,0x70,0x32,0x83,0x02,0x01,0x76,0xb5,0x86,0x19,0x00,0x30,0x83,0x02,0x02,0x0f,0x9a,0x64,0x82,0x00,0x0b,0x29,0x03,0x09,
+ 0x14,0x03,0x09,0xaa,0x1f,0x36,0x67,0x00,0x50,0x88,0x19,0x01,0xa0,0x4f,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x81,0x00,0x05,0xa6,0x6d,0x33,0x30,
+ 0x28,0x7e,0x88,0x19,0x0c,0x5c,0x4f,0x6d,0x23,0x8a,0x15,0x00,0x27,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x05,0x70,0xba,0x2a,0x1c,0x5b,0x42,0x87,0x19,0x06,
+ 0x2e,0xce,0x28,0x21,0x4c,0x70,0x7a,0x86,0x00,0x03,0x32,0x1f,0x2a,0x0e,0x83,0x02,0x04,0x13,0x49,0x00,0x1c,0x0a,0x86,0x02,0x01,0x0f,0x53,0x86,0x00,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x02,0x81,0x12,0x0f,0x82,0x02,0x02,0x13,0xb3,0x28,0x88,0x00,0x06,0x2a,0x6a,0x21,0x39,0x00,0x58,0x57,0x83,0x02,
+ 0x00,0x05,0x88,0x19,0x01,0x31,0x0a,0x82,0x02,0x04,0xb8,0x4d,0x18,0x03,0x9a,0x81,0x24,0x02,0xf9,0x11,0x7e,0x81,0x2c,0x02,0x21,0x0c,0x08,0x81,0x00,0x02,
+ 0x27,0x03,0x93,0x81,0x12,0x02,0x6d,0x41,0xb2,0x81,0x42,0x04,0xdd,0x17,0x27,0x70,0x1f,0x82,0x02,0x01,0x0f,0x37,0x87,0x19,0x01,0x88,0x12,0x82,0x02,0x11,
+ 0x0f,0x9a,0x64,0x15,0x56,0x6d,0x36,0x66,0x09,0x14,0x03,0x09,0x30,0x5a,0x30,0x49,0x00,0x50,0x88,0x19,0x01,0x47,0x4f,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,
+ 0x03,0x18,0x81,0x00,0x05,0x68,0x82,0x6c,0x39,0x3b,0x7e,0x88,0x19,0x14,0xce,0x4f,0x24,0x2d,0x3e,0x4c,0x00,0x27,0x03,0x09,0x18,0x11,0x3f,0x00,0x3a,0x6d,
+ 0xb6,0x24,0xa6,0x4f,0x42,0x87,0x19,0x06,0x2e,0x65,0x28,0x30,0x1c,0x82,0x9b,0x86,0x00,0x09,0x32,0x02,0x6f,0x58,0x4d,0x1d,0x0f,0x02,0x13,0x49,0x81,0x00,
+ 0x02,0x4f,0x24,0x0e,0x82,0x02,0x02,0x0f,0xcc,0x64,0x87,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x88,0x00,0x05,0x3a,0x51,0x61,0x2d,0x73,0x15,0x8a,0x00,
+ 0x06,0x7b,0x6c,0x64,0x6a,0x00,0x58,0x57,0x82,0x02,0x01,0x0f,0x78,0x88,0x19,0x01,0x2e,0xf2,0x82,0x02,0x04,0xb8,0x4d,0x0c,0x03,0x50,0x81,0x2c,0x02,0x85,
+ 0x11,0xce,0x81,0x0e,0x01,0x6d,0x08,0x82,0x00,0x02,0x18,0x03,0x85,0x81,0x0e,0x02,0x33,0x08,0x4c,0x81,0x0a,0x04,0x33,0x00,0x27,0xb1,0x1f,0x82,0x02,0x01,
+ 0xf2,0xfc,0x88,0x19,0x00,0x7e,0x82,0x02,0x1c,0x0f,0x9a,0x64,0x29,0x2a,0x44,0x70,0xdd,0x09,0x14,0x03,0x09,0x6a,0x58,0x39,0x29,0x00,0x58,0x66,0x9f,0xde,
+ 0x3d,0x8b,0x90,0xde,0x9f,0x4e,0x6e,0x28,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x81,0x00,0x00,0x7b,0x81,0x8a,0x02,0x3e,0x7a,0x5f,0x81,0x4e,0x04,
+ 0x80,0x31,0x47,0x78,0x80,0x81,0x4e,0x14,0xff,0x28,0x39,0x53,0xb3,0x51,0x00,0x27,0x03,0x09,0x18,0x03,0x3f,0x00,0x3a,0x73,0x49,0x53,0x3a,0x5b,0x90,0x81,
+ 0x54,0x0c,0x4e,0x31,0x6e,0x46,0x4e,0x54,0x4e,0xda,0x3a,0x77,0x30,0x24,0x67,0x86,0x00,0x00,0x32,0x82,0x02,0x05,0x2c,0x39,0x73,0x4b,0x13,0x49,0x83,0x00,
+ 0x04,0x49,0x73,0x2d,0x53,0x3e,0x89,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x99,0x00,0x00,0x71,0x81,0x36,0x03,0x81,0x00,0x58,0x57,0x82,0x02,0x01,0x0a,
+ 0x88,0x89,0x19,0x00,0xd8,0x82,0x02,0x04,0xb8,0x4d,0x18,0x03,0x25,0x81,0xc5,0x02,0x89,0x03,0xb2,0x81,0x75,0x02,0x7d,0x8e,0x14,0x81,0x00,0x02,0x27,0x03,
+ 0x6e,0x81,0xcb,0x09,0x5c,0x17,0xbe,0x4b,0x1d,0xb1,0x41,0x17,0x71,0x1f,0x82,0x02,0x00,0x20,0x89,0x19,0x00,0xb5,0x82,0x02,0x0f,0x0f,0x9a,0x64,0x3a,0x1c,
+ 0x58,0x4c,0x17,0x09,0x14,0x03,0x09,0x36,0x57,0x60,0x67,0x82,0x00,0x06,0x08,0x17,0xbe,0x1f,0x21,0x03,0x0c,0x86,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,
+ 0x81,0x00,0x04,0x58,0x33,0x44,0x57,0x68,0x81,0x00,0x06,0x08,0x03,0xf9,0xad,0xa3,0x03,0x18,0x87,0x00,0x15,0x27,0x03,0x09,0x18,0x03,0x3f,0x00,0x3b,0x1f,
+ 0x6c,0x30,0x4f,0x00,0x3b,0x00,0x0c,0xfb,0xc4,0x1f,0x89,0x17,0x08,0x83,0x00,0x00,0x15,0x81,0x3b,0x86,0x00,0x00,0x32,0x84,0x02,0x03,0x0e,0x2c,0x13,0x49,
+ 0x92,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x99,0x00,0x02,0x53,0x2c,0x6c,0x81,0x00,0x01,0x58,0x57,0x82,0x02,0x01,0x0e,0xfc,0x89,0x19,0x00,0xd8,0x82,
+ 0x02,0x02,0x36,0xbf,0x0c,0x81,0x03,0x08,0x09,0x41,0x03,0x11,0x90,0xf8,0x05,0x5c,0x66,0x83,0x00,0x01,0x41,0x7d,0x81,0x05,0x04,0x42,0xa4,0x03,0xab,0x5b,
+ 0x82,0x03,0x01,0x71,0x1f,0x82,0x02,0x00,0x8b,0x89,0x19,0x01,0xb5,0x0f,0x81,0x02,0x0b,0x0f,0x9a,0x64,0x5b,0x5a,0x0a,0x58,0x8e,0x09,0x14,0x03,0x09,0x81,
+ 0x57,0x01,0x49,0x29,0x82,0x00,0x06,0x08,0x17,0xbe,0x13,0xc5,0x03,0x0c,0x86,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x81,0x00,0x81,0x64,0x02,0x3a,0x55,
+ 0x7a,0x81,0x00,0x06,0x08,0x03,0x93,0x0e,0xbf,0x03,0x18,0x87,0x00,0x0b,0x27,0x03,0x09,0x18,0x03,0x3f,0x00,0x7a,0x51,0xa6,0x49,0x3a,0x82,0x00,0x06,0x0c,
+ 0x11,0x30,0x0e,0x89,0x03,0x08,0x8d,0x00,0x09,0x32,0x02,0x33,0x61,0x0e,0x76,0x98,0x02,0x13,0x49,0x92,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x99,0x00,
+ 0x06,0x67,0x53,0xaa,0x70,0x00,0x58,0x57,0x83,0x02,0x00,0x92,0x89,0x19,0x00,0x1f,0x82,0x02,0x01,0xc5,0xb1,0x81,0x03,0x0a,0x8e,0xbd,0x8d,0x95,0x03,0x7f,
+ 0xf8,0x05,0x6e,0x22,0x08,0x82,0x00,0x01,0x1b,0x37,0x81,0x05,0x09,0x90,0xa4,0x03,0xab,0x5b,0x03,0x11,0x03,0x71,0x1f,0x82,0x02,0x00,0x20,0x89,0x19,0x00,
+ 0x92,0x82,0x02,0x0b,0x0f,0x9a,0x64,0x62,0x44,0x1f,0x2d,0x11,0x09,0x14,0x03,0x09,0x86,0x00,0x06,0x14,0x03,0xdd,0x4b,0x93,0x03,0x0c,0x86,0x00,0x05,0x4a,
+ 0x03,0x27,0x4a,0x03,0x18,0x81,0x00,0x04,0x58,0x24,0x15,0x21,0x28,0x81,0x00,0x06,0x08,0x03,0x89,0x76,0x93,0x03,0x18,0x87,0x00,0x0b,0x27,0x03,0x09,0x18,
+ 0x03,0x3f,0x00,0x3a,0x2a,0x53,0x6f,0x49,0x82,0x00,0x06,0x0c,0x03,0xc5,0x12,0x8d,0x03,0x08,0x8d,0x00,0x09,0x32,0x02,0x30,0x6b,0x44,0x0f,0x81,0x02,0x13,
+ 0x49,0x92,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x99,0x00,0x06,0x44,0x74,0x49,0x2d,0x00,0x58,0x57,0x83,0x02,0x00,0x9c,0x88,0x19,0x01,0x90,0x0f,0x82,
+ 0x02,0x04,0x36,0x6a,0x4a,0x26,0x9a,0x81,0x12,0x02,0xa5,0x41,0xf9,0x81,0xad,0x02,0x85,0x03,0x18,0x81,0x00,0x02,0x08,0x41,0x7f,0x81,0xd8,0x05,0x05,0x03,
+ 0xc0,0xc9,0x1f,0x85,0x81,0x03,0x01,0x71,0x1f,0x82,0x02,0x01,0x4b,0x88,0x88,0x19,0x00,0x8b,0x82,0x02,0x0b,0x0f,0x9a,0x64,0x68,0x1c,0xbd,0x51,0x11,0x09,
+ 0x14,0x03,0x09,0x84,0x00,0x0a,0x08,0x22,0x43,0x03,0x26,0x7a,0x17,0x03,0x43,0x1b,0x0c,0x84,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x81,0x00,0x0f,0x8a,
+ 0x61,0x30,0x6c,0x68,0x00,0x4a,0x1b,0x03,0x22,0x28,0xa2,0x03,0x1b,0x22,0x18,0x85,0x00,0x16,0x27,0x03,0x09,0x18,0x03,0x3f,0x00,0x3a,0x24,0x33,0x53,0x15,
+ 0x00,0x0c,0x09,0x1b,0x03,0xc1,0x91,0x8e,0x03,0x22,0x0c,0x8c,0x00,0x09,0x32,0x02,0x30,0x1f,0x2d,0x61,0x8a,0x02,0x13,0x49,0x92,0x00,0x00,0x1c,0x86,0x02,
+ 0x01,0x0a,0x15,0x82,0x00,0x00,0x29,0x95,0x00,0x06,0x6c,0x57,0x2a,0x21,0x00,0x58,0x57,0x84,0x02,0x00,0x42,0x86,0x19,0x01,0xb5,0x76,0x83,0x02,0x04,0x36,
+ 0x61,0x27,0x14,0x44,0x81,0x0e,0x02,0x21,0x00,0xb6,0x81,0x13,0x02,0x57,0x03,0x18,0x83,0x00,0x00,0x2d,0x81,0x0e,0x02,0x30,0x03,0x93,0x81,0x0a,0x00,0x30,
+ 0x81,0x03,0x01,0x71,0x1f,0x83,0x02,0x00,0x37,0x87,0x19,0x01,0x78,0x2c,0x82,0x02,0x1c,0x0f,0x9a,0x64,0x49,0x4b,0x36,0x32,0xc1,0x09,0x14,0x03,0x09,0x15,
+ 0x29,0x3b,0x55,0x28,0x1b,0x03,0xc3,0xb2,0x15,0x5f,0xd5,0x95,0xb2,0x95,0x03,0x18,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x81,0x00,0x05,0x7a,0x3a,
+ 0x3b,0x3a,0x00,0x09,0x81,0x03,0x03,0x8e,0x62,0x53,0x7d,0x83,0x03,0x00,0x18,0x84,0x00,0x05,0x3b,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x01,0x3b,0x68,0x81,
+ 0x00,0x00,0x18,0x82,0x03,0x03,0x1b,0x64,0x51,0xa4,0x82,0x03,0x00,0x4a,0x8b,0x00,0x09,0x32,0x02,0x2c,0x0e,0x02,0x32,0x48,0x02,0x13,0x49,0x8a,0x00,0x02,
+ 0x55,0x58,0x7b,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x03,0x71,0x61,0x28,0x68,0x93,0x00,0x05,0x3a,0x1c,0x68,0x00,0x58,0x57,0x81,0x02,
+ 0x04,0x0a,0x13,0x02,0x0e,0x8b,0x83,0x19,0x0c,0xfc,0x6e,0x76,0x02,0x0e,0x0a,0x0f,0x02,0xc5,0xb1,0x11,0x03,0xb2,0x81,0x72,0x02,0xbe,0x03,0xa7,0x81,0x4b,
+ 0x02,0x93,0x03,0x27,0x81,0x00,0x07,0x08,0x09,0x71,0xef,0x76,0x94,0x03,0xc3,0x81,0x5e,0x00,0xdd,0x81,0x03,0x01,0x71,0x1f,0x83,0x02,0x01,0x0a,0x7f,0x85,
+ 0x19,0x01,0x78,0x04,0x83,0x02,0x1c,0x0f,0x9a,0x64,0x28,0x58,0x00,0x08,0x03,0x09,0x14,0x03,0x09,0x33,0x36,0x73,0x36,0x6c,0x03,0xbe,0x12,0x2c,0x4e,0x1e,
+ 0xe4,0x20,0x2c,0x6d,0x17,0x0c,0x83,0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x86,0x00,0x16,0x03,0xb2,0x12,0x2b,0xdd,0x80,0x7c,0xda,0x12,0x9c,0x8e,0xc1,
+ 0x60,0x5a,0x64,0xd2,0x00,0x4d,0xc3,0x09,0x18,0x03,0x3f,0x85,0x00,0x13,0x09,0x8e,0x4b,0x76,0x47,0x3d,0x72,0x78,0x2c,0xc9,0xc3,0x1b,0x30,0xa1,0x3e,0x4d,
+ 0x4f,0x85,0x24,0x57,0x83,0x00,0x00,0xc7,0x86,0x02,0x01,0x2b,0x55,0x89,0x00,0x01,0x58,0x0e,0x81,0x02,0x01,0x33,0x62,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x82,0x00,0x03,0x3b,0x82,0xb6,0x58,0x97,0x00,0x03,0x58,0x57,0x02,0xc9,0x81,0x31,0x00,0xf2,0x81,0x02,0x16,0xc9,0x50,0x7e,0x75,0xf2,0x0f,0x02,
+ 0x0a,0x7f,0x19,0x75,0x02,0x36,0x70,0x09,0xa2,0x5e,0x1e,0xe4,0xfa,0xa4,0x03,0x11,0x81,0x03,0x00,0x1b,0x83,0x00,0x06,0x1b,0xd6,0x15,0x91,0x03,0xa4,0x37,
+ 0x81,0x1e,0x19,0x92,0xb2,0x03,0x71,0x1f,0x02,0x12,0xcb,0x1f,0x02,0x13,0x7e,0x31,0x88,0xfc,0x72,0x90,0x1f,0x02,0x13,0x30,0x4b,0x02,0x0f,0x9a,0x64,0x82,
+ 0x00,0x0f,0x08,0x03,0x09,0x14,0x03,0x09,0x24,0x33,0x64,0xbd,0x2a,0x8e,0xa7,0x12,0x2c,0x4e,0x81,0xe4,0x04,0x20,0x0a,0xc5,0x03,0x26,0x83,0x00,0x05,0x4a,
+ 0x11,0x27,0x4a,0x03,0x18,0x86,0x00,0x04,0x03,0x89,0x12,0x0a,0x46,0x81,0xe4,0x04,0x05,0x0a,0x33,0xd6,0xc1,0x81,0x5a,0x08,0x3e,0x44,0x00,0x2a,0x30,0x09,
+ 0x18,0x03,0x3f,0x85,0x00,0x04,0x09,0x8e,0x1f,0x0a,0x47,0x81,0x1e,0x0c,0x31,0x0e,0x76,0xab,0x1b,0xc6,0x2a,0x4c,0xc6,0x1c,0x00,0x82,0x15,0x83,0x00,0x02,
+ 0x28,0x77,0x0f,0x83,0x02,0x01,0x6f,0x67,0x89,0x00,0x01,0x4f,0x48,0x83,0x02,0x00,0x6b,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x04,0x64,
+ 0x30,0x5a,0x21,0x3b,0x96,0x00,0x03,0x58,0x57,0x02,0x20,0x81,0x19,0x00,0x05,0x88,0x02,0x00,0x60,0x81,0x19,0x0d,0xb5,0x0f,0xb8,0x4c,0x00,0xa2,0x78,0x1e,
+ 0xe4,0x90,0xa4,0x3f,0xab,0xe5,0x81,0x08,0x83,0x00,0x06,0x14,0x22,0x18,0x00,0x1b,0xd6,0x90,0x81,0x1e,0x09,0x6e,0xb2,0x03,0x71,0x1f,0x0f,0x78,0x19,0x6e,
+ 0x0a,0x81,0x02,0x03,0x0a,0x4b,0x60,0x76,0x82,0x02,0x06,0x5c,0x19,0x72,0xc9,0x0f,0x9a,0x64,0x82,0x00,0x0c,0x08,0x03,0x09,0x14,0x03,0x09,0xc5,0x56,0x70,
+ 0x2d,0xb3,0x1b,0x89,0x81,0x1f,0x07,0x4e,0x7c,0x80,0x9a,0x76,0xc4,0x03,0x26,0x83,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x86,0x00,0x04,0x43,0xbe,0x12,
+ 0x0a,0x2e,0x81,0x0b,0x04,0x05,0x2c,0x9c,0x03,0x40,0x81,0x44,0x08,0xec,0x44,0xa6,0x6a,0x60,0x09,0x18,0x11,0x3f,0x85,0x00,0x04,0x09,0x8e,0x1f,0x0a,0x47,
+ 0x81,0x1e,0x0b,0x31,0x0e,0x76,0xb2,0x1b,0x2a,0x36,0x49,0x39,0x51,0x29,0x77,0x85,0x00,0x06,0x7a,0x81,0x2b,0x02,0x13,0x2d,0x29,0x8a,0x00,0x00,0x51,0x84,
+ 0x02,0x00,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x04,0x3e,0x36,0x24,0x36,0x29,0x96,0x00,0x06,0x71,0xda,0x02,0x1f,0x92,0xb5,0xf2,
+ 0x88,0x02,0x12,0x13,0x37,0x31,0x50,0x02,0xb8,0x81,0x18,0x03,0x6e,0x87,0xa0,0xe3,0x03,0x55,0x30,0x61,0x21,0x29,0x87,0x00,0x02,0x08,0x43,0xc3,0x81,0x88,
+ 0x09,0xb2,0x8e,0x03,0x71,0x1f,0x0f,0x88,0x19,0x31,0x12,0x87,0x02,0x01,0x0f,0x42,0x81,0x19,0x03,0x60,0x0f,0x9a,0x64,0x82,0x00,0x16,0x08,0x11,0x09,0x14,
+ 0x03,0x09,0x15,0x3b,0x4f,0x67,0x4f,0x22,0x03,0xc1,0xbc,0x95,0xf9,0x89,0x26,0x55,0x66,0x03,0x27,0x83,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x86,0x00,
+ 0x01,0x22,0xd6,0x81,0xd5,0x12,0xc1,0xf9,0xff,0xc3,0x67,0xc1,0x03,0x0c,0x4f,0xa6,0x1c,0x7b,0xbd,0x27,0xc3,0x09,0x18,0x11,0x3f,0x85,0x00,0x12,0x26,0x03,
+ 0xb2,0xbe,0xb2,0x93,0xdb,0xc3,0x71,0x89,0x95,0x09,0x1c,0x4f,0xbd,0x53,0x23,0x3a,0x49,0x83,0x00,0x00,0x3b,0x82,0x58,0x03,0x65,0x1f,0x21,0xa3,0x81,0x58,
+ 0x00,0x4f,0x88,0x00,0x06,0x81,0x02,0x48,0x1f,0x32,0x02,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x03,0x3a,0x49,0xec,0xa6,0x96,0x00,
+ 0x02,0x27,0xd6,0xff,0x81,0x02,0x01,0x13,0x0a,0x8a,0x02,0x08,0x0e,0x2c,0x0f,0x02,0x24,0x27,0x17,0x03,0xc4,0x81,0x0a,0x06,0xa5,0x03,0x91,0x4d,0x3a,0x21,
+ 0x28,0x87,0x00,0x02,0x14,0x03,0xf9,0x81,0x13,0x08,0x6d,0x03,0x8e,0xbe,0x1f,0x02,0x06,0x37,0x9c,0x89,0x02,0x06,0xc9,0x42,0x75,0x0e,0x0f,0xa3,0x15,0x82,
+ 0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x84,0x00,0x02,0x22,0x03,0xc1,0x83,0xdb,0x03,0xa5,0x2d,0xdb,0x5f,0x84,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,
+ 0x86,0x00,0x03,0x0c,0x03,0x1b,0x93,0x82,0xdb,0x01,0xa5,0x2d,0x81,0xdb,0x00,0x29,0x84,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x83,0x00,0x05,0x18,0x4a,
+ 0x41,0x03,0x11,0xe3,0x83,0x93,0x03,0x4c,0x85,0x65,0x8d,0x8a,0x00,0x01,0x5b,0x57,0x86,0x6e,0x01,0xf9,0x3e,0x88,0x00,0x06,0x81,0x13,0x2d,0x30,0x39,0x36,
+ 0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x9d,0x00,0x03,0x3f,0x03,0xf8,0x8c,0x83,0x02,0x00,0x48,0x87,0x12,0x00,0x8c,0x83,0x02,0x0d,0xcd,0x7a,
+ 0x11,0x03,0x94,0x76,0x12,0x94,0x11,0xbd,0x4d,0x3a,0x74,0x3b,0x87,0x00,0x02,0x14,0x03,0x89,0x81,0x12,0x00,0xb4,0x81,0x03,0x01,0x09,0x32,0x81,0x02,0x00,
+ 0x0f,0x8b,0x02,0x00,0x0f,0x82,0x02,0x02,0x3e,0x1b,0x14,0x81,0x00,0x16,0x08,0x03,0x09,0x14,0x03,0x09,0x58,0x6b,0x29,0x58,0x15,0x03,0xe3,0x9a,0x21,0xa3,
+ 0x93,0x94,0x50,0x21,0xc3,0x93,0x14,0x83,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x86,0x00,0x04,0x3c,0xa4,0x25,0x85,0xa7,0x81,0xc0,0x0f,0x94,0x4d,0x25,
+ 0xdb,0x6a,0x30,0x3e,0x39,0x2a,0xa6,0x27,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x01,0x08,0x22,0x83,0x03,0x02,0x6d,0x24,0x36,0x81,0xc4,0x09,0x6d,0x1d,0x33,
+ 0xa7,0x7d,0x36,0x21,0x8a,0x36,0x56,0x85,0x00,0x01,0x5b,0x5c,0x86,0x19,0x01,0x92,0x3e,0x85,0x00,0x09,0x3b,0x7a,0x00,0x81,0x2b,0x2a,0x30,0x1f,0x44,0xa1,
+ 0x82,0x00,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x55,0x4e,0x86,0x01,0x00,0xed,0x93,0x00,0x0a,0x1b,0x11,0xcd,0x2b,0x24,0x04,0x32,0xcd,0x81,0x1b,0x00,0x83,
+ 0x3b,0x03,0x22,0x4f,0xcd,0x2b,0x81,0x04,0x02,0x2b,0xcd,0x3e,0x81,0x11,0x02,0x0c,0x08,0x1b,0x81,0x17,0x04,0x8a,0x1d,0x53,0x2a,0xa6,0x88,0x00,0x09,0x3c,
+ 0x03,0xe2,0x7b,0x43,0x03,0x11,0xec,0xcd,0x0f,0x81,0x02,0x03,0x8c,0xad,0xa5,0x2d,0x83,0x39,0x04,0x82,0xa5,0x6f,0x48,0x0f,0x81,0x02,0x03,0x48,0xf8,0x03,
+ 0x26,0x81,0x00,0x0c,0x08,0x11,0x09,0x14,0x03,0x09,0x21,0x81,0x4c,0x5a,0x15,0x03,0x94,0x81,0x2b,0x00,0x13,0x81,0x02,0x04,0xad,0x2b,0x9a,0xb1,0x18,0x83,
+ 0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x86,0x00,0x04,0x03,0xbe,0x12,0x2b,0x0a,0x81,0x0f,0x0f,0x12,0x2b,0x33,0xce,0xbf,0x64,0x33,0x29,0x57,0x49,0x27,
+ 0x03,0x09,0x18,0x11,0x3f,0x81,0x00,0x08,0x0c,0x03,0xa2,0x40,0x08,0x7a,0x32,0x2b,0x12,0x81,0x02,0x09,0x12,0x2b,0x76,0x93,0x64,0x6c,0x98,0x1c,0x2a,0x53,
+ 0x85,0x00,0x01,0xd5,0x5c,0x86,0x19,0x01,0x92,0x3e,0x85,0x00,0x09,0x81,0x2b,0x3a,0x81,0x8c,0x44,0xd2,0x1d,0x0a,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x03,
+ 0x0a,0x15,0x51,0x46,0x82,0x0b,0x81,0x01,0x81,0x0b,0x00,0xde,0x93,0x00,0x01,0x1b,0x03,0x81,0xcd,0x06,0x50,0x05,0xad,0xcd,0x81,0x1b,0x74,0x82,0x53,0x12,
+ 0x6a,0xc3,0x29,0xcd,0x2b,0x5c,0x05,0xad,0xcd,0x9b,0x11,0x03,0x40,0x3b,0xa4,0xa2,0x08,0x15,0x3e,0x81,0x53,0x00,0x3a,0x88,0x00,0x0b,0x0c,0x03,0x40,0x7a,
+ 0x1b,0x03,0x11,0xf8,0xcd,0x24,0x8b,0x20,0x81,0xcd,0x01,0x27,0x22,0x83,0x3a,0x0a,0x0c,0x03,0x4d,0xcd,0x60,0x8b,0x6d,0x48,0xcd,0x11,0x09,0x81,0x00,0x0c,
+ 0x08,0x03,0x09,0x14,0x03,0x09,0x21,0x3e,0x53,0x58,0x91,0x03,0x94,0x81,0x2b,0x00,0x13,0x81,0x02,0x04,0xad,0x2b,0xb4,0xb1,0x18,0x83,0x00,0x05,0x4a,0x11,
+ 0x27,0x4a,0x03,0x18,0x85,0x00,0x05,0x22,0x03,0x89,0x12,0x2b,0x0a,0x81,0x02,0x81,0x2b,0x0d,0x33,0xce,0xbf,0x6a,0x2a,0x82,0x4d,0x3a,0x27,0x03,0x09,0x18,
+ 0x11,0x3f,0x81,0x00,0x08,0x22,0x11,0x9b,0x0a,0x3b,0x26,0x32,0x2b,0x32,0x81,0x0f,0x06,0x12,0x2b,0x76,0x93,0x64,0x30,0x2a,0x81,0x1c,0x00,0xaa,0x84,0x00,
+ 0x02,0x0c,0x9f,0x5c,0x81,0x19,0x02,0x92,0xf8,0xf9,0x81,0x19,0x01,0x92,0x3e,0x86,0x00,0x08,0x1c,0x00,0x81,0x13,0x82,0x53,0x1c,0x77,0xa1,0x82,0x00,0x00,
+ 0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x16,0x83,0x63,0x05,0x1a,0x0b,0x59,0x00,0x29,0x2d,0x89,0xaa,0x02,0x39,0x23,0x68,0x83,0x00,0x03,0x09,0x03,0xf8,
+ 0xcd,0x81,0x8c,0x81,0xcd,0x02,0x7a,0x8e,0x55,0x82,0x49,0x04,0x91,0x26,0x03,0xf8,0xcd,0x81,0x8c,0x81,0xcd,0x00,0x7a,0x81,0x03,0x03,0xff,0x4b,0x06,0x6b,
+ 0x8e,0x00,0x0f,0x18,0x95,0xca,0x24,0x9c,0xd5,0x03,0x73,0xcd,0xad,0x30,0x04,0xcd,0xf8,0x1b,0x8d,0x83,0x82,0x0a,0xa3,0x03,0x4d,0xcd,0xad,0x30,0x24,0xcd,
+ 0xf8,0x11,0x09,0x81,0x00,0x16,0x08,0x03,0x09,0x14,0x03,0x09,0x4c,0x6d,0x55,0x21,0x99,0x8e,0xbe,0x21,0x2a,0x93,0xff,0xbb,0xce,0x99,0xbc,0x93,0x14,0x83,
+ 0x00,0x05,0x4a,0x03,0x27,0x4a,0x03,0x18,0x84,0x00,0x06,0x26,0x03,0x22,0x28,0x06,0x33,0x99,0x81,0xca,0x0f,0x2a,0x06,0xa7,0xfa,0x25,0x70,0x55,0x73,0x53,
+ 0x4f,0x27,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x08,0x09,0x03,0x08,0x3e,0xa2,0x03,0xe3,0xaf,0xbb,0x81,0xc0,0x09,0xa7,0xa3,0xb1,0xa7,0x64,0x4d,0x81,0x1c,
+ 0x6b,0x67,0x83,0x00,0x03,0x0c,0x03,0x9f,0x5c,0x81,0x19,0x02,0xff,0xcd,0xf8,0x81,0x19,0x01,0x92,0x3e,0x88,0x00,0x06,0x81,0x0f,0xb8,0x39,0x60,0x0f,0xa1,
+ 0x82,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9d,0x81,0xfd,0x05,0x86,0xf4,0x0b,0x59,0x00,0x6b,0x81,0x0f,0x07,0x1d,0x5a,0x2b,0x0a,0x2b,
+ 0x48,0x4b,0x1d,0x82,0x02,0x01,0x33,0x3b,0x82,0x00,0x03,0x27,0x03,0x7a,0xf8,0x82,0xcd,0x02,0x73,0x03,0x09,0x84,0x00,0x03,0x27,0x3f,0x4f,0x5a,0x82,0xcd,
+ 0x07,0x73,0x18,0x17,0x03,0xff,0x36,0xc5,0x53,0x8e,0x00,0x07,0x18,0xa4,0x65,0x60,0xca,0xd5,0x03,0x09,0x84,0xcd,0x02,0x53,0x03,0x0c,0x83,0x00,0x02,0x08,
+ 0x03,0x55,0x81,0xcd,0x00,0x32,0x81,0xcd,0x02,0x9b,0x03,0x18,0x81,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x84,0x00,0x03,0x41,0x03,0x5b,0x6b,0x81,0x94,
+ 0x00,0xda,0x81,0x94,0x01,0xda,0x61,0x84,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x84,0x00,0x01,0x09,0x03,0x81,0x08,0x00,0x95,0x81,0xa3,0x01,0x6a,0xaf,
+ 0x82,0xa3,0x01,0xe6,0x29,0x84,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x81,0x00,0x04,0x08,0x17,0x03,0x11,0x03,0x81,0x17,0x03,0xc0,0x85,0xa5,0xce,0x82,
+ 0x85,0x01,0xa5,0x15,0x87,0x00,0x04,0x0c,0x03,0x17,0x62,0x5c,0x81,0x19,0x02,0x78,0xf9,0x92,0x81,0x19,0x01,0x92,0x3e,0x88,0x00,0x02,0x81,0x13,0x4c,0x81,
+ 0x57,0x01,0x4b,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x0b,0xcf,0xf3,0x0b,0xde,0x1c,0x0a,0x02,0x2a,0xb8,0x70,
+ 0x2a,0x53,0x81,0x2a,0x02,0xb6,0x44,0x24,0x82,0x02,0x00,0x8a,0x83,0x00,0x02,0x0c,0x03,0x17,0x81,0x5b,0x02,0x27,0x03,0x1b,0x87,0x00,0x01,0x18,0x0c,0x81,
+ 0x5b,0x04,0x3a,0x0c,0x00,0x0c,0x03,0x81,0x08,0x01,0xbe,0x7d,0x8e,0x00,0x0c,0x18,0x66,0x4c,0x5b,0xa7,0x40,0x26,0x03,0x7a,0xf8,0xcd,0x5a,0x4d,0x81,0x1b,
+ 0x85,0x00,0x03,0x18,0x00,0x81,0xf8,0x81,0xcd,0x02,0x4d,0x3a,0x0c,0x82,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x84,0x00,0x05,0x09,0x03,0x08,0x0c,0x03,
+ 0x43,0x83,0x18,0x81,0x00,0x01,0x27,0x18,0x81,0x00,0x05,0x4a,0x11,0x27,0x4a,0x03,0x18,0x84,0x00,0x08,0x22,0x03,0x08,0x18,0x03,0x95,0xab,0x7b,0x91,0x81,
+ 0xc1,0x01,0xab,0x3b,0x85,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x82,0x00,0x03,0x14,0x09,0x22,0x4a,0x81,0x08,0x04,0x14,0x08,0x4f,0x29,0x08,0x81,0x14,
+ 0x86,0x00,0x07,0x08,0x0c,0x4a,0x03,0x17,0x27,0x5b,0x5c,0x86,0x19,0x01,0x92,0x3e,0x88,0x00,0x06,0x81,0x48,0x4d,0x2d,0x98,0xb3,0xa1,0x82,0x00,0x00,0x1c,
+ 0x86,0x02,0x05,0x0a,0x15,0x49,0x4e,0x07,0xe7,0x81,0x2f,0x04,0xcf,0xf3,0x0b,0xed,0x39,0x81,0x02,0x09,0x2d,0x0e,0x56,0x2a,0x2d,0x53,0x30,0x98,0x4b,0xb3,
+ 0x82,0x02,0x00,0x4d,0x84,0x00,0x05,0x18,0x41,0x43,0x03,0x3c,0x09,0x88,0x00,0x0c,0x18,0x1b,0x17,0x03,0x1b,0x26,0x00,0x18,0x03,0xa3,0x82,0x25,0x2d,0x8e,
+ 0x00,0x07,0x18,0xc1,0x4b,0x71,0xa3,0xbd,0x00,0x09,0x81,0x03,0x04,0x7a,0x22,0x03,0x1b,0x14,0x86,0x00,0x06,0x08,0x3c,0x1b,0x7a,0x26,0x03,0x27,0x83,0x00,
+ 0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x84,0x00,0x06,0x09,0x03,0x14,0x49,0xca,0xd5,0x3c,0x83,0x41,0x00,0x1b,0x81,0x03,0x07,0x1b,0x14,0x4a,0x11,0x27,0x4a,
+ 0x03,0x18,0x83,0x00,0x0a,0x08,0x43,0x41,0x39,0x49,0x43,0x22,0x2d,0x13,0x12,0x74,0x88,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x88,0x00,0x04,0x3a,0x53,
+ 0x12,0x4b,0x1c,0x87,0x00,0x01,0x08,0x1b,0x81,0x03,0x04,0x17,0x18,0x00,0x5b,0x5c,0x86,0x19,0x01,0x92,0x3e,0x88,0x00,0x06,0x81,0x2b,0x2a,0x0e,0x12,0x44,
+ 0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x14,0x01,0x07,0x8f,0x81,0xc8,0x10,0xae,0xf5,0x0b,0x59,0x49,0x13,0x02,0xb3,0xaa,0x53,0x2a,0x24,0x74,
+ 0x33,0x2a,0x39,0x6f,0x82,0x02,0x00,0x81,0x86,0x00,0x81,0x08,0x85,0x00,0x02,0x3b,0x23,0x4f,0x83,0x00,0x81,0x08,0x82,0x00,0x05,0x18,0x03,0x0c,0x15,0xdb,
+ 0xbf,0x8e,0x00,0x05,0x18,0x26,0x6a,0x2d,0x9c,0x62,0x81,0x00,0x05,0x18,0x22,0x41,0x22,0x26,0x08,0x88,0x00,0x04,0x18,0x09,0x41,0x22,0x0c,0x84,0x00,0x05,
+ 0x08,0x03,0x09,0x14,0x03,0x09,0x84,0x00,0x06,0x0c,0x03,0x93,0x2c,0x02,0x13,0x85,0x84,0x03,0x02,0x41,0x22,0x03,0x81,0x17,0x04,0x03,0x14,0x4a,0x03,0x18,
+ 0x83,0x00,0x06,0x14,0x43,0x41,0x2d,0x81,0xdd,0x60,0x82,0x02,0x02,0x0f,0x2a,0x28,0x86,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x87,0x00,0x02,0x4f,0x33,
+ 0x0f,0x81,0x02,0x02,0x0e,0x4d,0x3b,0x85,0x00,0x09,0x26,0x03,0xe6,0xc6,0x06,0x55,0x0c,0x3b,0x96,0x78,0x84,0x19,0x02,0x72,0x75,0x67,0x88,0x00,0x06,0x81,
+ 0x0f,0xb6,0x2d,0x4d,0x2b,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x27,0x01,0x16,0x83,0xf4,0x04,0x63,0x0b,0x59,0x00,0x61,0x81,0x02,0x05,0x2b,
+ 0x1f,0x0a,0x0e,0xdc,0x13,0x81,0x1f,0x82,0x02,0x01,0x36,0x3a,0x8d,0x00,0x04,0x49,0x33,0x02,0x0a,0x58,0x87,0x00,0x05,0x18,0x03,0x4a,0x18,0x03,0x0c,0x8e,
+ 0x00,0x05,0x18,0x03,0x0c,0x08,0x17,0x4a,0x89,0x00,0x03,0x3a,0x70,0x1d,0x7b,0x8c,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x84,0x00,0x01,0x4f,0x33,0x84,
+ 0x02,0x01,0xc7,0xec,0x82,0x00,0x09,0x56,0x36,0x41,0x11,0x03,0x26,0x00,0x22,0x03,0x18,0x84,0x00,0x04,0x22,0x03,0x1b,0xa5,0x0e,0x85,0x02,0x01,0x12,0x51,
+ 0x85,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x86,0x00,0x01,0x58,0x0a,0x85,0x02,0x01,0x6f,0x49,0x82,0x00,0x04,0x9b,0x53,0xe5,0x03,0xf2,0x81,0x0a,0x03,
+ 0xa7,0x4a,0x27,0x4e,0x86,0x19,0x00,0x3d,0x89,0x00,0x00,0x8a,0x81,0x02,0x81,0x0f,0x01,0x02,0xa1,0x82,0x00,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x08,0x01,
+ 0x83,0x0b,0x00,0x01,0x81,0x0b,0x03,0x95,0x00,0x68,0x53,0x8a,0x4d,0x01,0x81,0x3a,0x8c,0x00,0x02,0x3b,0x53,0x0a,0x83,0x02,0x01,0x36,0x15,0x85,0x00,0x05,
+ 0x0c,0x03,0x4a,0x18,0x03,0x3f,0x8e,0x00,0x05,0x18,0x03,0x26,0x14,0x03,0x4a,0x88,0x00,0x01,0xa6,0x33,0x81,0x02,0x02,0x0f,0x21,0x29,0x8a,0x00,0x05,0x08,
+ 0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x02,0x3a,0x6a,0x0a,0x86,0x02,0x0c,0x0e,0x4d,0x08,0x0c,0x3e,0x49,0x17,0x03,0x26,0x08,0x41,0x03,0x09,0x85,0x00,0x02,
+ 0x08,0x26,0x60,0x88,0x02,0x02,0x0f,0x57,0x7a,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x01,0x29,0x36,0x88,0x02,0x08,0x0e,0x61,0x7a,0x29,
+ 0x33,0x51,0xc6,0xc3,0x04,0x81,0x76,0x03,0xe3,0x4a,0x27,0x4e,0x86,0x19,0x01,0x2e,0x14,0x88,0x00,0x01,0x3b,0x6d,0x82,0x0a,0x02,0xc9,0x64,0x08,0x81,0x00,
+ 0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x67,0x4e,0x86,0x01,0x01,0x78,0x29,0x9a,0x00,0x01,0x49,0x36,0x86,0x02,0x02,0x2c,0x23,0x3a,0x83,0x00,0x03,0x1b,0x03,
+ 0x4f,0x55,0x81,0x17,0x00,0x08,0x8d,0x00,0x05,0x18,0x03,0x26,0x14,0x03,0x4a,0x86,0x00,0x02,0x3b,0x73,0x0a,0x84,0x02,0x02,0x32,0x9b,0x7a,0x88,0x00,0x05,
+ 0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x01,0x7b,0x0f,0x89,0x02,0x0a,0xbb,0x11,0x03,0x17,0x03,0x26,0x08,0x22,0x03,0x22,0x08,0x86,0x00,0x01,0x91,0x0e,
+ 0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x0d,0x24,0x3a,0x68,0x2d,0x00,0x6b,0xb2,0x90,
+ 0x05,0xa0,0x9f,0x4a,0x27,0x4e,0x81,0x19,0x02,0xd4,0xb5,0xd4,0x81,0x19,0x01,0x2e,0x14,0x87,0x00,0x00,0x29,0x81,0x0b,0x83,0x01,0x04,0x0b,0x01,0xc1,0x00,
+ 0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x0b,0x84,0x16,0x04,0x0b,0x42,0x5b,0x00,0x28,0x8d,0x15,0x00,0x68,0x88,0x00,0x01,0xe2,0x2b,0x88,0x02,0x01,0x0f,
+ 0x2d,0x83,0x00,0x06,0x43,0x03,0x56,0x5a,0x1b,0x03,0x08,0x8d,0x00,0x05,0x4a,0x03,0x26,0x14,0x03,0x41,0x85,0x00,0x02,0xa6,0x36,0x0f,0x86,0x02,0x02,0x0e,
+ 0x39,0x68,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x01,0x4c,0x22,0x81,0x03,0x05,0x26,0x08,0x22,0x03,0x22,0x08,0x87,
+ 0x00,0x03,0x91,0x0e,0x02,0x0a,0x85,0xef,0x03,0x0e,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x03,0x55,0x13,0x02,0x0e,0x85,
+ 0x0a,0x09,0x8c,0x02,0x24,0x3a,0x5b,0x2d,0x29,0x6a,0x8d,0x7e,0x81,0x05,0x03,0x47,0x4a,0x27,0x4e,0x81,0x19,0x02,0x90,0xcd,0xf8,0x81,0x19,0x01,0xfc,0x3b,
+ 0x87,0x00,0x01,0x70,0x01,0x84,0x0b,0x81,0x01,0x02,0xaf,0x7a,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xf5,0x82,0x9d,0x05,0xf4,0x0b,0x42,0x5b,0x55,
+ 0x1d,0x8d,0x0a,0x02,0x1f,0x4d,0x3b,0x86,0x00,0x00,0x7d,0x8a,0x02,0x00,0x30,0x83,0x00,0x05,0x22,0x03,0x08,0x29,0x03,0x3c,0x8e,0x00,0x06,0x1b,0x17,0x7d,
+ 0x2d,0x41,0x03,0x08,0x84,0x00,0x00,0x39,0x8a,0x02,0x00,0x7b,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x00,0x21,0x84,
+ 0x57,0x0b,0x39,0x48,0x02,0x4c,0x3c,0x03,0x26,0x08,0x22,0x03,0x22,0x08,0x88,0x00,0x03,0x91,0x0e,0x02,0x70,0x85,0x29,0x03,0x36,0x02,0x1d,0x3b,0x83,0x00,
+ 0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x03,0x55,0x13,0x02,0x4d,0x85,0x55,0x0f,0x36,0x02,0x24,0x3a,0x15,0x77,0x44,0x1f,0xc1,0x42,0x75,0x8b,0xb2,
+ 0x4a,0x27,0x4e,0x81,0x19,0x02,0x5e,0xf8,0x47,0x81,0x19,0x01,0x92,0x3e,0x87,0x00,0x02,0x6a,0x01,0x1e,0x83,0x63,0x04,0x1a,0x01,0x87,0x00,0x1c,0x86,0x02,
+ 0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0xcf,0x05,0xb9,0xf3,0x0b,0x42,0x4f,0x2a,0x81,0x02,0x0b,0x30,0x33,0x0f,0x6c,0x39,0x12,0x02,0x57,0x0a,0x24,0x2d,
+ 0x5a,0x81,0x02,0x01,0x0f,0x6a,0x86,0x00,0x00,0x7d,0x87,0x02,0x03,0x1d,0x13,0x02,0x30,0x83,0x00,0x05,0x14,0x17,0x11,0x03,0x43,0x0c,0x8e,0x00,0x06,0x1b,
+ 0x3c,0x7b,0x53,0x1b,0x03,0x14,0x84,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x01,
+ 0x15,0x64,0x83,0x3e,0x0a,0x81,0x2b,0x02,0x94,0x03,0x4a,0x08,0x22,0x03,0x22,0x08,0x89,0x00,0x04,0x91,0x0e,0x02,0x23,0x4d,0x84,0xba,0x03,0x13,0x02,0x1d,
+ 0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x04,0x55,0x13,0x02,0x73,0x61,0x84,0xa1,0x09,0x2b,0x02,0x24,0x3a,0x00,0x81,0x74,0x9b,0x3b,
+ 0x4b,0x81,0x13,0x03,0xc0,0x4a,0x27,0x4e,0x81,0x19,0x00,0xfc,0x81,0xd4,0x81,0x19,0x01,0x92,0x3e,0x87,0x00,0x03,0x6a,0x01,0x1a,0xd7,0x81,0xac,0x05,0x86,
+ 0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,0x0b,0x42,0x4c,0x0f,0x81,0x02,0x0b,0x4c,0x2d,0x13,0x2d,
+ 0x48,0x0f,0x02,0x0a,0x02,0x57,0x32,0x0f,0x82,0x02,0x00,0x36,0x86,0x00,0x00,0x7d,0x86,0x02,0x04,0x0e,0x64,0x1d,0x02,0x30,0x84,0x00,0x00,0x08,0x81,0x0c,
+ 0x00,0x08,0x8f,0x00,0x01,0x09,0x03,0x81,0x41,0x01,0x11,0x1b,0x85,0x00,0x00,0x21,0x86,0x02,0x01,0x2b,0x53,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,
+ 0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x01,0x49,0x1f,0x84,0x0f,0x81,0x02,0x06,0xfa,0x4a,0x00,0x22,0x03,0x22,0x08,0x87,0x00,0x00,0x3a,0x81,
+ 0x00,0x04,0x91,0x0e,0x02,0x23,0x44,0x86,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x04,0x55,0x13,0x02,0x73,0x2a,0x86,
+ 0x02,0x01,0x24,0x3a,0x82,0x00,0x02,0x08,0x27,0x4b,0x81,0x2c,0x03,0x89,0x4a,0x27,0x4e,0x86,0x19,0x02,0x92,0x6b,0x49,0x82,0x00,0x01,0x4f,0x3e,0x81,0x00,
+ 0x03,0x6a,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x07,0xcf,0xf3,0x0b,0x42,
+ 0xbf,0x0f,0x02,0x0a,0x81,0xaa,0x02,0x48,0x77,0x2d,0x83,0x02,0x02,0xcc,0x71,0x0e,0x82,0x02,0x00,0xb8,0x86,0x00,0x03,0x7d,0x02,0x0f,0x4b,0x83,0x60,0x04,
+ 0xc6,0x55,0xc7,0x02,0x30,0x99,0x00,0x00,0x09,0x81,0x03,0x01,0x1b,0x08,0x85,0x00,0x00,0x21,0x86,0x02,0x01,0x1f,0x29,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,
+ 0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x01,0x2b,0x32,0x86,0x02,0x05,0x6b,0x00,0x22,0x03,0x41,0x08,0x87,0x00,0x08,0x4f,0x48,0x3e,
+ 0x00,0x91,0x0e,0x02,0x23,0x44,0x86,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x04,0x55,0x13,0x02,0x73,0x2a,0x86,0x02,
+ 0x01,0x24,0x3a,0x82,0x00,0x08,0x0c,0x03,0xe3,0x93,0x5f,0x26,0x4a,0x27,0xde,0x83,0x19,0x82,0xfc,0x07,0x6e,0x30,0x48,0x6a,0x3a,0x51,0x12,0x77,0x81,0x00,
+ 0x03,0x6a,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xf3,0x82,0xb7,0x0c,0xf4,0x0b,0x42,0x15,
+ 0x30,0x02,0x6f,0x32,0x4b,0x6f,0x4c,0x57,0x12,0x82,0x02,0x02,0x30,0xbf,0x60,0x81,0x02,0x01,0x0f,0x73,0x86,0x00,0x03,0x7d,0x02,0x0f,0x51,0x84,0x28,0x03,
+ 0x3a,0xc7,0x02,0x30,0x9a,0x00,0x81,0x08,0x87,0x00,0x03,0x21,0x02,0x0a,0x81,0x83,0x51,0x01,0x7b,0x68,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,
+ 0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x01,0x4c,0x32,0x86,0x02,0x04,0x6b,0x09,0x03,0x41,0x08,0x89,0x00,0x07,0x9b,0x4f,0x00,0x91,0x0e,0x02,0x2d,
+ 0x36,0x86,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x04,0x55,0x13,0x02,0x53,0xb3,0x86,0x02,0x01,0x24,0x3a,0x83,0x00,
+ 0x00,0x22,0x83,0x03,0x03,0x26,0x18,0x03,0x95,0x81,0x40,0x00,0x8d,0x82,0x65,0x01,0x6b,0x56,0x81,0x02,0x00,0x1f,0x81,0x02,0x00,0x77,0x81,0x00,0x03,0x6a,
+ 0x01,0x1a,0xd7,0x81,0xae,0x05,0xfd,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x0b,0x84,0x07,0x04,0x0b,0x42,0x5b,0x15,0x1f,0x8d,0x48,
+ 0x02,0x12,0x61,0x3a,0x86,0x00,0x00,0x7d,0x81,0x02,0x84,0x0f,0x04,0x48,0x1c,0xc7,0x02,0x30,0xa4,0x00,0x03,0x21,0x02,0x48,0x2d,0x83,0x98,0x01,0x58,0x68,
+ 0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x01,0x2a,0x0a,0x86,0x02,0x03,0x94,0x03,0x41,0x08,0x8d,
+ 0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x3a,0x83,0x00,
+ 0x16,0x08,0x43,0x11,0x03,0x22,0x08,0x09,0x11,0x22,0xe2,0x68,0x49,0x00,0x64,0x4f,0x00,0x70,0x13,0x36,0x2a,0x30,0x12,0x77,0x81,0x00,0x02,0x6a,0x01,0x1e,
+ 0x83,0x63,0x04,0x1a,0x01,0x87,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x83,0x01,0x00,0x0b,0x81,0x01,0x03,0x42,0x5b,0x00,0x28,0x8d,0x55,0x00,0x29,
+ 0x88,0x00,0x00,0x7d,0x86,0x02,0x04,0x0e,0x81,0x1f,0x02,0x30,0xa4,0x00,0x00,0x21,0x86,0x02,0x01,0x1f,0x29,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,
+ 0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x86,0x0a,0x04,0x0f,0x02,0xfa,0x41,0x08,0x8e,0x00,0x03,0x91,0x0e,0x02,0x77,0x85,0x4c,0x03,0x1d,0x02,
+ 0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x05,0x55,0x13,0x02,0x33,0x57,0x21,0x83,0x44,0x03,0x32,0x02,0x24,0x3a,0x82,0x00,0x01,
+ 0x14,0x17,0x81,0x03,0x02,0x22,0x08,0x3f,0x81,0x03,0x0e,0x1b,0x99,0xa3,0x2a,0x5b,0xb3,0x30,0x00,0x70,0x0f,0x32,0x70,0x32,0x13,0x77,0x81,0x00,0x01,0x6a,
+ 0x01,0x81,0x0b,0x01,0x01,0x0b,0x82,0x01,0x02,0x87,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x81,0x0b,0x81,0x01,0x00,0x0b,0x81,0x01,0x03,0x42,0x5b,
+ 0x00,0x29,0x89,0x62,0x00,0x29,0x8c,0x00,0x00,0x7d,0x87,0x02,0x00,0x0e,0x81,0x02,0x00,0x30,0x8a,0x00,0x00,0x55,0x81,0x49,0x00,0x15,0x84,0x00,0x02,0x28,
+ 0x9b,0x1c,0x83,0x00,0x00,0x68,0x82,0x49,0x00,0x68,0x84,0x00,0x00,0x21,0x86,0x02,0x01,0x0a,0x44,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,
+ 0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x81,0x55,0x08,0x15,0xc1,0xbc,0x62,0xe2,0x12,0x02,0x85,0x08,0x8f,0x00,0x05,0x91,0x0e,0x02,0x23,0x49,0x3e,0x81,
+ 0xa6,0x05,0x3e,0x28,0x77,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x05,0x55,0x13,0x02,0x25,0x66,0xe5,0x81,0x4f,0x05,0x64,
+ 0x28,0x2a,0x02,0x24,0x3a,0x82,0x00,0x17,0x26,0x03,0xe6,0xc5,0x30,0x91,0x3c,0x85,0xc5,0x9c,0x30,0xb2,0x39,0x67,0x4d,0x6c,0x00,0x70,0x13,0x2a,0x8a,0x44,
+ 0x32,0x77,0x81,0x00,0x03,0x6a,0x01,0x0b,0x01,0x81,0x0b,0x81,0x01,0x03,0x0b,0x87,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x16,0x83,0x1a,0x02,0x38,
+ 0x0b,0x42,0x81,0x5b,0x00,0x6f,0x89,0x2b,0x02,0x12,0x1d,0x58,0x8a,0x00,0x03,0x7d,0x02,0x0f,0xb8,0x85,0x44,0x02,0x0a,0x02,0x30,0x8a,0x00,0x00,0x12,0x81,
+ 0x13,0x01,0x0a,0x4c,0x82,0x00,0x04,0x55,0x1d,0x0f,0x0e,0x56,0x82,0x00,0x01,0x3e,0x0a,0x81,0x13,0x01,0xba,0x1c,0x83,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,
+ 0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x09,0x3b,0x2a,0x33,0xbc,0x65,0x5a,0xd5,0x32,0x02,0x65,0x90,0x00,0x0d,0x91,
+ 0x0e,0x02,0x23,0x2a,0x02,0x2d,0x4d,0x0f,0x81,0x77,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x0d,0x55,0x13,0x02,0x23,0x21,
+ 0x0e,0x6b,0x61,0x0e,0x23,0x2a,0x02,0x24,0x3a,0x82,0x00,0x02,0x3f,0x11,0x24,0x81,0x2c,0x12,0x58,0x08,0x5a,0x2c,0x0a,0xca,0xbb,0xc7,0x8a,0x36,0x44,0x00,
+ 0x70,0x0f,0x4b,0x30,0x5a,0x0e,0x77,0x81,0x00,0x00,0x6a,0x81,0x0b,0x84,0x16,0x03,0x0b,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9d,0x81,
+ 0xac,0x10,0xfd,0xf5,0x0b,0x42,0x15,0x44,0x02,0x1d,0x0a,0x12,0x4b,0x6c,0x99,0x1d,0x57,0x6c,0x4b,0x81,0x02,0x01,0x0f,0x7b,0x89,0x00,0x0c,0x7d,0x02,0x8c,
+ 0x9b,0x49,0x9b,0x29,0xe2,0x64,0x29,0xc7,0x02,0x30,0x8a,0x00,0x05,0x82,0x33,0x0a,0x2c,0x2b,0x29,0x81,0x00,0x05,0x44,0x0e,0x39,0xdf,0x0e,0x49,0x81,0x00,
+ 0x05,0xec,0x39,0x0e,0x24,0x0a,0x2a,0x83,0x00,0x03,0x21,0x02,0xdc,0x55,0x84,0x4f,0x00,0xec,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,
+ 0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x09,0x29,0x2b,0x0f,0x91,0x6f,0x02,0xb2,0x32,0x02,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0x23,0x77,0x02,0x2d,0x98,0x02,
+ 0x23,0x77,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x02,0x55,0x13,0x02,0x81,0x2b,0x08,0x02,0x85,0x53,0x02,0x58,0x2a,0x02,
+ 0x24,0x3a,0x82,0x00,0x02,0x26,0x11,0x99,0x81,0x9c,0x12,0xd5,0x1b,0x7e,0x30,0x9c,0xdd,0xa4,0x62,0x68,0x29,0x3b,0x00,0x70,0x12,0x82,0x60,0x39,0xb8,0x2a,
+ 0x81,0x27,0x03,0x70,0x01,0x38,0xf3,0x82,0x9d,0x04,0x35,0x0b,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x10,0xcf,0xf3,0x0b,
+ 0x42,0x58,0x0e,0x02,0x0a,0x8a,0x58,0x33,0x44,0x1d,0x33,0x4c,0x2c,0x32,0x82,0x02,0x00,0x36,0x89,0x00,0x0c,0x7d,0x02,0x8c,0x9b,0x24,0x0f,0x81,0x36,0x0e,
+ 0x64,0xc7,0x02,0x30,0x8b,0x00,0x04,0x64,0x0f,0x02,0x1f,0x68,0x81,0x00,0x05,0x5a,0x12,0x5b,0x23,0x02,0x23,0x83,0x00,0x81,0x68,0x01,0x5a,0x44,0x83,0x00,
+ 0x09,0x21,0x02,0x12,0x68,0x56,0x4d,0x15,0x4d,0x61,0x68,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,
+ 0x09,0x29,0x2b,0x0f,0x67,0x4b,0x02,0x5b,0x32,0x02,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0x73,0x77,0x02,0xcc,0xba,0x02,0x2d,0x5a,0x02,0x1d,0x3b,0x83,0x00,
+ 0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x0d,0x55,0x13,0x02,0x4c,0x60,0x02,0x06,0x30,0x02,0x73,0x77,0x02,0x24,0x3a,0x82,0x00,0x02,0x27,0xb2,0x88,
+ 0x81,0xe4,0x02,0xb2,0xbc,0x72,0x81,0xe4,0x01,0xb2,0x22,0x84,0x00,0x06,0x70,0x32,0x2a,0x02,0x24,0x36,0xc4,0x81,0x03,0x03,0xff,0x01,0x1a,0x86,0x81,0x97,
+ 0x05,0xc8,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,0x0b,0x42,0x61,0x0f,0x81,0x02,0x08,0x4c,0x99,
+ 0xcc,0x44,0x1d,0x24,0x1f,0x4d,0x36,0x82,0x02,0x00,0x60,0x89,0x00,0x0c,0x7d,0x02,0x8c,0x9b,0x6f,0x02,0x81,0xc6,0x0e,0x64,0xc7,0x02,0x30,0x8a,0x00,0x04,
+ 0x29,0x5b,0x2d,0x36,0x3e,0x82,0x00,0x05,0x56,0x02,0x33,0x2c,0x13,0x49,0x81,0x00,0x00,0x55,0x82,0x39,0x01,0x6c,0x70,0x83,0x00,0x09,0x21,0x02,0x12,0x29,
+ 0x02,0x0a,0x64,0x2c,0x12,0xd9,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x03,0x4c,0x48,0x02,0x0f,
+ 0x81,0x02,0x03,0x6d,0x48,0x02,0x65,0x90,0x00,0x02,0x91,0x0e,0x02,0x81,0x0e,0x86,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x82,
+ 0x00,0x06,0x08,0x18,0x15,0x13,0x02,0x2c,0x13,0x83,0x02,0x00,0x0f,0x81,0x02,0x00,0x60,0x81,0x09,0x0d,0x14,0x00,0x08,0x8d,0xb5,0xe4,0x1e,0xf9,0xd5,0x92,
+ 0xe4,0x1e,0xf9,0x0c,0x84,0x00,0x06,0x70,0x0f,0x1d,0x13,0xf2,0x13,0x6d,0x81,0x09,0x03,0x5f,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x0b,0x87,0x00,0x1c,
+ 0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xb7,0x82,0xae,0x04,0xf5,0x0b,0x42,0x55,0x33,0x81,0x02,0x08,0x39,0x44,0x0e,0x82,0x61,0x6f,0x6a,0x2d,0x30,0x82,
+ 0x02,0x00,0x81,0x89,0x00,0x0c,0x7d,0x02,0x0f,0x3e,0xc7,0x02,0x30,0x1f,0x0f,0x81,0xba,0x02,0x30,0x8a,0x00,0x00,0x12,0x82,0x0a,0x01,0x1f,0x29,0x81,0x00,
+ 0x04,0x68,0x39,0x33,0x24,0x70,0x82,0x00,0x01,0x3e,0x48,0x82,0x13,0x00,0x44,0x83,0x00,0x09,0x21,0x02,0x12,0x29,0x02,0x0a,0x3e,0x0a,0x12,0xd9,0x81,0x02,
+ 0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x81,0x2c,0x00,0x2b,0x81,0x2c,0x04,0x2b,0x2c,0x0f,0x02,0x65,0x90,
+ 0x00,0x03,0x91,0x0e,0x02,0x21,0x85,0x73,0x03,0x6f,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x81,0x00,0x00,0x0c,0x81,0x03,0x0d,0xc3,
+ 0x13,0x02,0xc5,0x85,0xdb,0x2d,0x82,0xa5,0x85,0x4b,0x02,0xa1,0x1b,0x81,0x03,0x81,0x17,0x0b,0xa4,0x4e,0x45,0x80,0xb2,0xa4,0x46,0x45,0x80,0xb2,0x3c,0x08,
+ 0x83,0x00,0x06,0x70,0x48,0x99,0xff,0x87,0xc5,0x77,0x81,0x14,0x03,0x70,0x01,0x1a,0xe8,0x81,0x97,0x05,0xc8,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x04,0x0a,
+ 0x15,0x51,0x46,0x16,0x83,0x0d,0x07,0x35,0x0b,0x42,0x40,0x55,0x2b,0x0e,0x13,0x82,0x0e,0x82,0x13,0x00,0x0a,0x81,0x0e,0x01,0x0a,0x39,0x8a,0x00,0x00,0x7d,
+ 0x81,0x02,0x01,0x32,0x0e,0x83,0x02,0x00,0x0e,0x81,0x02,0x00,0x30,0x8a,0x00,0x00,0x30,0x81,0x12,0x81,0x2b,0x00,0x29,0x81,0x00,0x00,0x61,0x81,0x5a,0x02,
+ 0x33,0x4d,0x3a,0x81,0x00,0x05,0x29,0x49,0x36,0x61,0x49,0x4f,0x83,0x00,0x09,0x21,0x02,0x2c,0x7b,0x02,0x0f,0x12,0x0f,0x0a,0x39,0x81,0x02,0x00,0x3e,0x87,
+ 0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x02,0x28,0xab,0x95,0x81,0xab,0x04,0x95,0x62,0x12,0x02,0x65,0x90,0x00,0x04,0x91,
+ 0x0e,0x02,0x81,0x64,0x82,0x58,0x05,0x74,0x28,0x6c,0x02,0x1d,0x3b,0x83,0x00,0x19,0x27,0x03,0x09,0x18,0x03,0x3f,0x00,0x08,0x43,0x03,0x4a,0xb2,0x13,0x02,
+ 0x8d,0x66,0xd5,0xe5,0x67,0x49,0xa4,0xb4,0x02,0x24,0x9b,0x08,0x83,0x3c,0x00,0x06,0x81,0x12,0x02,0xc0,0x11,0x30,0x81,0x12,0x01,0x5f,0x0c,0x84,0x00,0x0c,
+ 0x70,0x0f,0xa1,0x6e,0x30,0x36,0xc4,0x03,0x11,0x71,0x0b,0x38,0xf3,0x82,0x9d,0x04,0x35,0x0b,0x87,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x83,0x01,
+ 0x00,0x0b,0x81,0x01,0x03,0x42,0x95,0x1b,0xa6,0x8a,0x1c,0x01,0x55,0x7a,0x8a,0x00,0x00,0x7d,0x82,0x02,0x01,0x1f,0xb3,0x81,0x2a,0x01,0x5a,0x13,0x81,0x02,
+ 0x00,0x30,0x8a,0x00,0x05,0x24,0x02,0x0f,0x13,0x1d,0x3b,0x81,0x00,0x06,0x56,0x13,0x0f,0x2c,0x0f,0x4c,0x3b,0x82,0x00,0x01,0x33,0x73,0x85,0x00,0x00,0x21,
+ 0x81,0x02,0x01,0x0f,0x02,0x81,0x0f,0x84,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x05,0x51,0x02,0x8c,0x68,0x30,0x33,0x81,
+ 0xa1,0x04,0xc6,0xe5,0x76,0x02,0x65,0x90,0x00,0x04,0x91,0x0e,0x02,0x81,0x36,0x83,0x02,0x04,0x81,0x77,0x02,0x1d,0x3b,0x83,0x00,0x0f,0x27,0x03,0x09,0x18,
+ 0x03,0x3f,0x00,0x27,0x11,0x3f,0x44,0x51,0x13,0x02,0xe3,0x99,0x83,0x0f,0x05,0x89,0xca,0x02,0x24,0x1d,0x3e,0x82,0x18,0x01,0x08,0x4b,0x81,0x2c,0x02,0x89,
+ 0x8e,0x06,0x81,0x2c,0x01,0x70,0x08,0x84,0x00,0x06,0x70,0x0a,0x6d,0x1f,0x36,0x0e,0xc4,0x81,0x11,0x00,0x71,0x81,0x0b,0x84,0x16,0x03,0x01,0x87,0x00,0x1c,
+ 0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x81,0x0b,0x81,0x01,0x00,0x0b,0x81,0x01,0x04,0x42,0x40,0x03,0x1b,0x08,0x96,0x00,0x00,0x7d,0x81,0x02,0x09,0x21,0x5b,
+ 0xe2,0x9b,0x67,0x29,0x7b,0x13,0x02,0x30,0x8a,0x00,0x04,0x4b,0x2d,0x44,0x24,0x3e,0x82,0x00,0x0d,0x2d,0x12,0x0a,0x12,0x02,0xb8,0x82,0x00,0x3b,0x39,0xef,
+ 0x32,0xc7,0x4d,0x83,0x00,0x00,0x21,0x81,0x02,0x01,0x6f,0x58,0x82,0x49,0x01,0x61,0x2c,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,
+ 0x82,0x00,0x00,0x51,0x81,0x02,0x01,0x29,0x2c,0x82,0x02,0x04,0x0e,0xab,0x12,0x02,0x65,0x90,0x00,0x04,0x91,0x0e,0x02,0x73,0x4c,0x82,0x02,0x05,0x48,0x1c,
+ 0x1d,0x02,0x1d,0x3b,0x83,0x00,0x0f,0x27,0x03,0x09,0x18,0x11,0x3f,0x00,0x08,0x03,0x17,0x15,0xe2,0x13,0x02,0xa7,0x94,0x82,0x02,0x06,0x0e,0xc1,0x30,0x02,
+ 0xa1,0xab,0x09,0x83,0x03,0x0a,0xff,0xaf,0x94,0x66,0x03,0xc0,0x2d,0x6b,0xc1,0x1b,0x08,0x82,0x00,0x07,0x08,0xf9,0x0a,0x65,0x1d,0xb1,0x24,0xc4,0x81,0x03,
+ 0x03,0x71,0x0b,0x01,0x0b,0x83,0x01,0x03,0x0b,0x87,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x86,0x0b,0x04,0x42,0x28,0x09,0x03,0x1b,0x96,0x00,0x0c,
+ 0x7d,0x02,0x0e,0x64,0x2a,0x0e,0x0f,0x0e,0x32,0x55,0x6f,0x02,0x30,0x8a,0x00,0x04,0x74,0x32,0x13,0xba,0x1c,0x82,0x00,0x00,0x39,0x82,0x12,0x06,0x77,0x28,
+ 0x1c,0x00,0x8a,0x0f,0x2b,0x81,0x12,0x00,0x39,0x83,0x00,0x09,0x21,0x02,0x0e,0x28,0x3e,0x21,0xb3,0x98,0x67,0x7b,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,
+ 0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x09,0x1c,0x70,0x2b,0x0e,0x0a,0xda,0x62,0x0f,0x02,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0xb8,0x3a,
+ 0x3e,0x4c,0x61,0x1c,0x67,0x13,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x12,0x22,0x11,0x03,0xd5,0x13,0x02,0x6d,0xa4,0xbb,
+ 0x85,0x2d,0x64,0xc3,0x48,0x02,0x33,0x17,0x03,0x22,0x81,0x4a,0x01,0x41,0xb2,0x81,0x89,0x06,0xbe,0xa2,0xbe,0x81,0x51,0x66,0x0c,0x82,0x00,0x0b,0x08,0x1b,
+ 0xff,0x1f,0x24,0x85,0x4b,0xb6,0xc4,0x03,0x11,0x71,0x81,0x01,0x00,0x0b,0x84,0x01,0x02,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xa8,0x83,
+ 0xd0,0x05,0x0b,0x42,0xab,0x28,0x24,0x0a,0x81,0x48,0x00,0x13,0x81,0x48,0x00,0x13,0x81,0x48,0x81,0x13,0x01,0x32,0x23,0x8a,0x00,0x04,0x7d,0x02,0x0e,0x67,
+ 0x1f,0x82,0x02,0x04,0x0f,0x7b,0x5a,0x02,0x30,0x8a,0x00,0x05,0x12,0x0e,0x36,0x0e,0x24,0x3b,0x81,0x00,0x00,0x3b,0x81,0x68,0x02,0x8a,0x2b,0x7b,0x81,0x00,
+ 0x02,0x81,0x02,0x12,0x81,0x1d,0x00,0x2d,0x83,0x00,0x03,0x21,0x02,0x1f,0x49,0x83,0x02,0x04,0x2c,0x29,0x0e,0x02,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,
+ 0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x02,0x24,0x3b,0x1b,0x81,0x08,0x01,0x95,0x60,0x81,0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x81,0x02,0x01,0x5a,
+ 0x53,0x81,0x58,0x01,0x39,0x0a,0x81,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x82,0x00,0x0b,0x3f,0x17,0xc3,0x13,0x02,0x0f,0xca,
+ 0x8d,0xdd,0xe2,0x70,0xc9,0x81,0x02,0x02,0x60,0x40,0x27,0x83,0x00,0x01,0x62,0x36,0x81,0x2a,0x04,0x00,0x7d,0x12,0x2d,0x23,0x83,0x00,0x08,0x1b,0x03,0xbb,
+ 0x0e,0x65,0x6c,0x30,0x76,0xc4,0x81,0x11,0x02,0x71,0x01,0x1e,0x83,0x1a,0x04,0x38,0x0b,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,
+ 0x2f,0x10,0xcf,0xf3,0x0b,0x42,0x9f,0x65,0x02,0x1d,0x5c,0xbb,0x32,0x57,0x4d,0x0a,0x6b,0x2d,0x1d,0x81,0x02,0x01,0x0f,0x67,0x89,0x00,0x05,0x7d,0x02,0x0f,
+ 0x7b,0x73,0x0e,0x81,0x02,0x04,0x44,0x15,0xcc,0x02,0x30,0x89,0x00,0x06,0x5b,0x0f,0x6c,0x00,0x5a,0x0a,0x28,0x81,0x00,0x00,0x39,0x81,0x12,0x02,0x2c,0x02,
+ 0x51,0x81,0x00,0x01,0x3b,0x77,0x82,0x32,0x00,0x39,0x83,0x00,0x04,0x21,0x02,0x1f,0x55,0x13,0x82,0x02,0x04,0x1f,0x28,0x0e,0x02,0x3e,0x87,0x00,0x05,0x08,
+ 0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x82,0x02,0x04,0x48,0x4b,0x24,0x1d,0x0e,0x82,0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,
+ 0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x83,0x00,0x02,0x08,0xd5,0x13,0x89,0x02,0x01,0x24,0x3a,0x84,0x00,0x08,0x3e,0x57,0x36,0x39,0x00,0x39,
+ 0x57,0x5a,0x9b,0x81,0x00,0x04,0x08,0x1b,0x03,0x09,0x70,0x81,0x02,0x00,0x76,0x81,0x02,0x00,0xc4,0x81,0x03,0x03,0x71,0x01,0x1a,0xe7,0x81,0xac,0x05,0xea,
+ 0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,0x0b,0x42,0xc0,0x0f,0x82,0x02,0x05,0x94,0x12,0x48,0x77,
+ 0x60,0x70,0x81,0x12,0x82,0x02,0x00,0x44,0x89,0x00,0x00,0x7d,0x81,0x02,0x02,0x24,0x71,0x0a,0x81,0x02,0x04,0x82,0xaa,0x0f,0x02,0x30,0x8a,0x00,0x05,0x12,
+ 0x0a,0x2a,0x13,0x24,0x3b,0x81,0x00,0x00,0x6b,0x81,0x1d,0x02,0x32,0x0f,0x51,0x81,0x00,0x01,0x49,0xaa,0x81,0x44,0x01,0x2d,0x28,0x83,0x00,0x04,0x21,0x02,
+ 0x13,0x4f,0x58,0x81,0x02,0x02,0x13,0x1c,0x58,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,
+ 0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x3a,0x84,
+ 0x00,0x00,0x67,0x81,0x2a,0x0c,0x70,0x00,0x7b,0x6b,0x21,0x49,0x00,0x08,0x41,0x03,0x09,0x00,0x5f,0x81,0x02,0x00,0x7e,0x81,0x02,0x00,0xc4,0x81,0x43,0x03,
+ 0xbb,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,0x0b,0x42,0x89,
+ 0x0e,0x82,0x02,0x07,0x94,0x12,0x13,0x77,0x4b,0x24,0xb6,0xdf,0x82,0x02,0x00,0xb3,0x89,0x00,0x00,0x7d,0x82,0x02,0x81,0x0f,0x85,0x02,0x00,0x30,0x8a,0x00,
+ 0x04,0x3e,0xef,0x13,0xcc,0x67,0x83,0x00,0x04,0x29,0x5b,0x74,0x1d,0x9b,0x81,0x00,0x01,0x3e,0x2c,0x81,0x0a,0x01,0x02,0x82,0x83,0x00,0x00,0x21,0x81,0x02,
+ 0x01,0x32,0x24,0x81,0x02,0x02,0x0f,0x24,0x13,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,
+ 0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x3a,0x84,
+ 0x00,0x0f,0x4d,0x53,0x1f,0x6c,0x00,0x2a,0x32,0x4d,0x81,0x08,0x41,0x03,0x09,0x00,0x09,0xff,0x81,0x02,0x00,0x04,0x81,0x02,0x00,0x77,0x81,0x08,0x03,0x70,
+ 0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9e,0x81,0xe7,0x05,0x8f,0xf4,0x0b,0x42,0x9f,0xb4,
+ 0x82,0x02,0x01,0xb6,0x1f,0x81,0x2d,0x03,0x0a,0x2d,0x56,0x24,0x82,0x02,0x00,0x3e,0x89,0x00,0x03,0x7d,0x02,0x0f,0x53,0x85,0x9b,0x02,0x32,0x02,0x30,0x8a,
+ 0x00,0x04,0x4f,0x2a,0x2b,0x44,0x28,0x82,0x00,0x01,0x3e,0x1d,0x81,0x12,0x01,0x5a,0x68,0x81,0x00,0x05,0x64,0x60,0x24,0xc7,0x0e,0xb3,0x83,0x00,0x03,0x21,
+ 0x02,0x0f,0xba,0x84,0x1d,0x00,0xba,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,0x90,0x00,
+ 0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x3a,0x84,0x00,0x15,
+ 0x28,0x58,0x74,0x67,0x00,0x28,0x6a,0xa3,0x26,0x17,0x03,0x09,0x00,0x09,0x03,0xff,0x0f,0x33,0xc5,0x6c,0x13,0x6d,0x81,0x22,0x03,0xb1,0x01,0x1a,0xe7,0x81,
+ 0xac,0x05,0x86,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x0b,0x84,0x07,0x01,0x0b,0x42,0x81,0x95,0x00,0x4b,0x81,0x0e,0x06,0x13,0x0e,
+ 0x48,0x13,0x0e,0x48,0x0a,0x81,0x0e,0x01,0x2b,0x53,0x8a,0x00,0x04,0x7d,0x02,0x8c,0x9b,0x4c,0x84,0x21,0x02,0x2c,0x02,0x30,0x8a,0x00,0x05,0x4b,0x0f,0x2b,
+ 0x0f,0x2a,0x3a,0x81,0x00,0x05,0x44,0x0e,0x13,0x48,0x0f,0x7b,0x81,0x00,0x01,0x3e,0x0a,0x81,0x48,0x01,0x12,0x3e,0x83,0x00,0x03,0x21,0x02,0x2b,0x28,0x84,
+ 0x3b,0x00,0x28,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x89,
+ 0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x3a,0x8a,0x00,0x0f,0x08,0x03,0x17,0xbc,
+ 0x40,0x00,0x09,0x03,0x11,0xff,0x1f,0x57,0x6b,0x30,0x6c,0xc4,0x81,0x03,0x02,0xbb,0x0b,0x1e,0x83,0x35,0x04,0x1a,0x0b,0x87,0x00,0x1c,0x86,0x02,0x03,0x0a,
+ 0x15,0x51,0x46,0x83,0x01,0x0a,0x0b,0x01,0x0b,0x42,0x95,0x03,0x22,0x08,0x62,0xa2,0xc1,0x86,0x28,0x00,0xd9,0x8b,0x00,0x04,0x7d,0x02,0x8c,0x9b,0x6f,0x86,
+ 0x02,0x00,0x30,0x89,0x00,0x06,0x5b,0x0f,0x5a,0x4d,0x24,0x2c,0x29,0x81,0x00,0x01,0x21,0x1d,0x81,0x33,0x01,0x2c,0x3e,0x81,0x00,0x01,0x3a,0x74,0x81,0x2d,
+ 0x01,0x53,0x68,0x83,0x00,0x03,0x21,0x02,0x12,0x29,0x85,0x0a,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,
+ 0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,0x02,0x01,
+ 0x24,0x3a,0x87,0x00,0x05,0x28,0x39,0x24,0x33,0x66,0x57,0x81,0x1f,0x0a,0x91,0x03,0x11,0x03,0xff,0x2c,0x65,0xc0,0xbe,0xa1,0x77,0x81,0x08,0x00,0x70,0x87,
+ 0x0b,0x02,0x87,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x1c,0xc3,0xde,0x81,0x01,0x81,0xde,0x03,0x01,0xc2,0xdd,0xd6,0x81,0x03,0x03,0x09,0x14,0x11,0x09,0x93,
+ 0x00,0x04,0x7d,0x02,0x8c,0x9b,0x6f,0x86,0x02,0x00,0x30,0x8a,0x00,0x05,0x12,0x0f,0x12,0x65,0xb6,0x3b,0x81,0x00,0x00,0x51,0x83,0x4d,0x00,0x15,0x81,0x00,
+ 0x01,0x49,0x0e,0x82,0x02,0x00,0x6b,0x83,0x00,0x03,0x21,0x02,0x12,0x29,0x87,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,
+ 0x51,0x8a,0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x01,0x55,0x13,0x89,
+ 0x02,0x01,0x24,0x3a,0x87,0x00,0x05,0x29,0x21,0xa1,0x36,0x95,0x60,0x81,0x0a,0x00,0xff,0x81,0x03,0x07,0x41,0xa3,0x02,0x12,0xef,0x0e,0x02,0x77,0x81,0x00,
+ 0x00,0x4c,0x84,0x01,0x00,0x0b,0x81,0x01,0x02,0x93,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x04,0x09,0x03,0x41,0x08,0x0c,0x84,0x03,0x03,0x09,0x14,
+ 0x11,0x09,0x93,0x00,0x04,0x7d,0x02,0x0f,0x3e,0x1d,0x86,0x02,0x00,0x30,0x8a,0x00,0x04,0x1c,0x39,0x58,0x4f,0x28,0x82,0x00,0x05,0x2a,0x0f,0x0e,0x0f,0x02,
+ 0x51,0x81,0x00,0x02,0x51,0x0f,0x60,0x81,0x0a,0x00,0x77,0x83,0x00,0x03,0x21,0x02,0x12,0x29,0x87,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,
+ 0x09,0x82,0x00,0x00,0x51,0x85,0x02,0x01,0x0e,0x8c,0x82,0x02,0x00,0x65,0x90,0x00,0x05,0x91,0x0e,0x02,0x21,0x58,0xba,0x81,0x02,0x05,0x21,0x53,0x13,0x02,
+ 0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x04,0x55,0x13,0x02,0xb8,0xb6,0x83,0x02,0x04,0x21,0x24,0x02,0x24,0x3a,0x87,0x00,0x12,
+ 0x55,0xb1,0x26,0xdd,0x8e,0xbe,0x7f,0x5e,0x95,0x03,0x41,0x08,0xa3,0x02,0x6b,0x4c,0x21,0x13,0x77,0x81,0x00,0x01,0x62,0x01,0x85,0x0b,0x03,0x01,0xc3,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x83,0x00,0x04,0x09,0x03,0x41,0x08,0x0c,0x83,0x03,0x03,0x09,0x08,0x03,0x09,0x8e,0x00,0x81,0x08,0x82,0x00,0x00,0x7d,0x81,
+ 0x02,0x01,0x1f,0x0e,0x86,0x02,0x00,0x30,0x8a,0x00,0x00,0x0e,0x82,0x02,0x01,0xdc,0x29,0x81,0x00,0x05,0x21,0x1f,0x3e,0x4c,0x0f,0x51,0x81,0x00,0x02,0x55,
+ 0x2d,0x58,0x81,0x4c,0x00,0x51,0x83,0x00,0x03,0x21,0x02,0x0a,0x74,0x87,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,
+ 0x85,0x02,0x02,0xc4,0xe5,0x0e,0x81,0x02,0x00,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0x23,0xa6,0x49,0x0a,0x02,0x24,0x55,0x77,0x02,0x1d,0x3b,0x83,0x00,0x05,
+ 0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x0d,0x55,0x13,0x02,0x23,0x44,0x02,0x4b,0xb4,0x0e,0xa7,0xb6,0x02,0x24,0x3a,0x87,0x00,0x05,0x91,0xf2,0x89,0x4c,
+ 0x7d,0x78,0x81,0xe4,0x0a,0xfa,0x27,0x08,0x0c,0xff,0x0a,0x3e,0x21,0x2b,0x32,0x77,0x81,0x00,0x03,0x0c,0x0b,0x1a,0xf5,0x82,0xf3,0x04,0x35,0x01,0x95,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x0b,0x09,0x03,0x41,0x08,0x0c,0x03,0x11,0x03,0x09,0x14,0x11,0x09,0x8d,0x00,0x00,0x09,0x81,0x17,0x0a,0x09,0x08,
+ 0x00,0x7d,0x02,0x8c,0x73,0x74,0x2a,0x12,0x0f,0x83,0x02,0x00,0x30,0x8a,0x00,0x05,0x6d,0x2b,0x0a,0x12,0x2b,0x29,0x81,0x00,0x05,0x98,0x0f,0x57,0x33,0x0e,
+ 0x49,0x81,0x00,0x01,0x3e,0x2c,0x82,0x0a,0x00,0x21,0x83,0x00,0x05,0x21,0x02,0x0e,0x24,0x2c,0x0f,0x85,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,
+ 0x03,0x09,0x82,0x00,0x00,0x51,0x85,0x02,0x02,0x0e,0xd5,0xbf,0x81,0x02,0x00,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0x23,0x21,0x3e,0x73,0x8c,0x02,0x70,0xaa,
+ 0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,0x0d,0x55,0x13,0x02,0x71,0x36,0x02,0xc4,0x26,0x53,0x25,0xb6,0x02,0x24,0x3b,0x86,
+ 0x00,0x0f,0x0c,0xbc,0xc0,0x65,0x57,0xbe,0x78,0x1e,0xe4,0x5c,0x18,0x26,0x03,0xff,0x02,0x12,0x82,0x02,0x06,0x77,0x3b,0x00,0x0c,0x0b,0x1a,0xe8,0x81,0x97,
+ 0x05,0xae,0x0d,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x85,0x00,0x04,0x09,0x03,0x41,0x00,0x0c,0x81,0x03,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x07,
+ 0x3f,0x03,0x17,0x3c,0x03,0x09,0x00,0x7d,0x81,0x02,0x09,0xc7,0x53,0x29,0x5b,0x9b,0x44,0x1d,0x8c,0x02,0x30,0x8a,0x00,0x01,0xef,0x02,0x81,0x0f,0x01,0x6f,
+ 0x3b,0x81,0x00,0x04,0x28,0x4b,0x02,0x0f,0x21,0x82,0x00,0x05,0x49,0x24,0x0a,0x12,0x13,0x77,0x83,0x00,0x07,0x21,0x02,0x0a,0x67,0x15,0x81,0x2a,0x12,0x83,
+ 0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x02,0x4c,0xbf,0x93,0x81,0xbf,0x04,0xbe,0x7a,0x2c,0x02,0x65,
+ 0x90,0x00,0x0d,0x91,0x0e,0x02,0x23,0x77,0x2b,0x49,0x70,0x1d,0x64,0xd2,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x0d,0x55,
+ 0x13,0x02,0x53,0x58,0x24,0xa7,0x89,0x64,0xa4,0xb6,0x02,0x0e,0x5a,0x85,0x00,0x07,0x0c,0x03,0x95,0x57,0x36,0x85,0x8e,0x3d,0x81,0x72,0x00,0x9f,0x81,0x03,
+ 0x0d,0x17,0x58,0x02,0x0f,0x36,0x48,0x02,0x77,0x36,0x73,0x0c,0x0b,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x95,0x00,0x1c,0x84,0x02,0x03,0x12,0x02,0x0a,
+ 0x15,0x86,0x00,0x09,0x09,0x03,0x22,0x00,0x41,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x81,0x17,0x05,0x67,0x4d,0x1b,0x17,0x08,0x7d,0x82,0x02,0x08,0x12,0x64,
+ 0xba,0x36,0x64,0x68,0x1d,0x02,0x30,0x8a,0x00,0x04,0x33,0x5f,0x2d,0x2a,0x49,0x82,0x00,0x05,0x1c,0x70,0x39,0x2d,0x23,0x28,0x81,0x00,0x02,0x67,0x2b,0x02,
+ 0x81,0x0e,0x00,0xaa,0x83,0x00,0x00,0x21,0x81,0x02,0x06,0x13,0x2d,0xec,0x7b,0xa6,0x67,0x56,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,
+ 0x09,0x82,0x00,0x00,0x51,0x81,0x02,0x02,0x73,0x74,0x25,0x81,0x74,0x04,0x25,0x70,0x0a,0x02,0x65,0x90,0x00,0x0d,0x91,0x0e,0x02,0x23,0x77,0x02,0xba,0x49,
+ 0x29,0xe2,0x32,0x02,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x0d,0x55,0x13,0x02,0x1f,0x91,0x8e,0x66,0xc5,0x12,0xbe,0x30,0x02,
+ 0x1d,0x53,0x84,0x00,0x08,0x0c,0x03,0x17,0x15,0x2a,0x30,0xe6,0x66,0x33,0x81,0x13,0x10,0x25,0x03,0x0c,0x08,0x70,0x32,0x51,0x00,0x49,0x24,0x77,0x3e,0x64,
+ 0x0c,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0xc0,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x41,0x03,0x14,0x09,0x11,0x09,0x14,0x03,0x09,
+ 0x8c,0x00,0x07,0x17,0x41,0x81,0x53,0x1b,0x43,0x08,0x7d,0x82,0x02,0x08,0x12,0xe2,0x77,0x74,0x29,0x4f,0x32,0x02,0x30,0x8a,0x00,0x00,0xdc,0x81,0x13,0x02,
+ 0x0a,0x2d,0x7a,0x81,0x00,0x00,0x2a,0x82,0x02,0x01,0x0f,0x51,0x81,0x00,0x05,0x3e,0x33,0x53,0x5a,0x33,0x15,0x83,0x00,0x00,0x21,0x82,0x02,0x05,0x30,0x4c,
+ 0x0e,0x5a,0x49,0x68,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,0x90,0x00,0x04,0x91,0x0e,
+ 0x02,0x0a,0x13,0x81,0x02,0x02,0x0e,0x0a,0x0e,0x81,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,0x00,0x01,0x55,0x13,0x81,0x02,
+ 0x02,0x0e,0xdc,0x13,0x81,0x02,0x00,0x0f,0x81,0x02,0x0f,0x24,0x3a,0x18,0x09,0x4a,0x08,0x0c,0x03,0x17,0x27,0x08,0xbe,0xdd,0x22,0xfb,0x96,0x81,0x12,0x01,
+ 0xbe,0x03,0x81,0x00,0x01,0x28,0x4f,0x82,0x00,0x01,0x3b,0x1c,0x81,0x00,0x03,0x0c,0x01,0x1a,0x9e,0x82,0xb7,0x04,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x22,0x03,0x81,0x14,0x0c,0x03,0x22,0x00,0x7d,0x02,0x0f,0x44,0x1c,
+ 0x3a,0x1c,0xaa,0x1d,0x0e,0x81,0x02,0x00,0x30,0x8a,0x00,0x05,0x82,0x2c,0xba,0x32,0x0a,0xd9,0x81,0x00,0x05,0x71,0x60,0x2c,0x33,0x0f,0x51,0x82,0x00,0x01,
+ 0x7a,0x00,0x81,0x7a,0x84,0x00,0x00,0x21,0x81,0x02,0x01,0x48,0x57,0x81,0x4f,0x02,0x28,0x8a,0x2a,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,
+ 0x03,0x09,0x82,0x00,0x00,0x51,0x8a,0x02,0x00,0x65,0x90,0x00,0x01,0x91,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x84,
+ 0x00,0x01,0x55,0x13,0x89,0x02,0x01,0x24,0x0c,0x84,0x03,0x0c,0x43,0x14,0x08,0x17,0x03,0x26,0x18,0x03,0x22,0x25,0xdd,0x03,0x17,0x8a,0x00,0x02,0x0c,0x01,
+ 0x16,0x83,0x07,0x04,0x16,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x11,0x09,0x14,0x11,0x09,0x8c,0x00,0x01,0x4a,
+ 0x03,0x81,0x14,0x08,0x03,0x09,0x00,0x7d,0x02,0x0f,0x2d,0x39,0x12,0x85,0x02,0x00,0x30,0x8a,0x00,0x00,0x2b,0x81,0x13,0x02,0x02,0x12,0x29,0x81,0x00,0x05,
+ 0xd2,0x0f,0x0e,0x02,0x0a,0x55,0x8b,0x00,0x07,0x21,0x02,0x2c,0x28,0x49,0x53,0x36,0x13,0x83,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,
+ 0x82,0x00,0x01,0x3e,0x0f,0x89,0x02,0x00,0x4c,0x90,0x00,0x01,0x15,0x0e,0x89,0x02,0x01,0x1d,0x3b,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x84,0x00,
+ 0x01,0x55,0x13,0x89,0x02,0x04,0x36,0x03,0x1b,0x4f,0x7a,0x81,0x1b,0x04,0x27,0x08,0x17,0x03,0x26,0x81,0x00,0x05,0x22,0x03,0x27,0x09,0x03,0x0c,0x8a,0x00,
+ 0x01,0x27,0x01,0x81,0x0b,0x00,0x01,0x83,0x0b,0x02,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,
+ 0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x03,0x09,0x00,0x7d,0x8a,0x02,0x00,0x30,0x8a,0x00,0x00,0x36,0x81,0x33,0x01,0x30,0x9b,0x82,0x00,0x04,0x4c,0x61,
+ 0x51,0x44,0x81,0x8c,0x00,0x04,0x21,0x02,0x13,0x1d,0x0f,0x86,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x82,0x00,0x01,0x49,0x13,0x88,
+ 0x02,0x01,0x0f,0x3e,0x91,0x00,0x00,0xdc,0x89,0x02,0x01,0x36,0x7a,0x83,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x00,0x2b,0x89,0x02,0x04,0xaa,
+ 0x03,0x0c,0x2b,0x58,0x81,0x00,0x03,0x08,0x17,0x03,0x26,0x82,0x00,0x0a,0x3f,0x03,0x0c,0x18,0x03,0x09,0x08,0x18,0x00,0x27,0x14,0x85,0x00,0x00,0x08,0x81,
+ 0xc2,0x01,0x59,0xde,0x81,0x6e,0x81,0x92,0x02,0xce,0x3a,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x11,0x09,0x14,0x11,0x09,0x8c,
+ 0x00,0x01,0x4a,0x11,0x81,0x14,0x03,0x03,0x09,0x00,0x7d,0x8a,0x02,0x00,0x30,0x8a,0x00,0x00,0x1d,0x81,0x32,0x02,0xba,0x2d,0x3a,0x81,0x00,0x00,0x2a,0x82,
+ 0x0f,0x01,0x1f,0x4f,0x8b,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x83,0x00,0x00,0x36,0x88,0x02,0x01,0x1d,0x29,
+ 0x91,0x00,0x00,0x5a,0x89,0x02,0x00,0x61,0x84,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x00,0x36,0x89,0x02,0x04,0x58,0x03,0x1b,0x55,0x0c,0x82,
+ 0x17,0x01,0x03,0x26,0x83,0x00,0x04,0x0c,0x11,0x09,0x27,0x8e,0x81,0xd5,0x04,0x1b,0x7a,0x4a,0x03,0x27,0x84,0x00,0x02,0x26,0x03,0x1b,0x81,0x08,0x06,0x66,
+ 0x95,0x29,0x28,0x29,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,
+ 0x03,0x03,0x09,0x00,0x7d,0x8a,0x02,0x00,0x30,0x8a,0x00,0x00,0x1f,0x81,0x2b,0x02,0x0e,0x2c,0xd9,0x81,0x00,0x05,0x6a,0x32,0x0a,0x4b,0x02,0x81,0x8b,0x00,
+ 0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x83,0x00,0x01,0x49,0x0a,0x86,0x02,0x01,0x0e,0x51,0x92,0x00,0x01,0x9b,0x0f,
+ 0x87,0x02,0x01,0x12,0x28,0x84,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x91,0x0e,0x87,0x02,0x06,0x6f,0x29,0x09,0x03,0x11,0x03,0x17,0x81,
+ 0x1b,0x00,0x0c,0x84,0x00,0x0b,0x41,0x95,0x6d,0x33,0x72,0x7f,0x92,0x6e,0x33,0x99,0x22,0x09,0x83,0x00,0x0c,0x26,0x03,0x1b,0x08,0x5b,0xd5,0xbe,0x91,0x7a,
+ 0x1c,0xa6,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x03,
+ 0x09,0x00,0x7d,0x8a,0x02,0x00,0x30,0x8a,0x00,0x00,0x12,0x81,0x13,0x02,0x0f,0x5a,0x3a,0x81,0x00,0x00,0xd2,0x82,0x0f,0x01,0x0e,0x67,0x8b,0x00,0x00,0x21,
+ 0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x84,0x00,0x01,0x64,0xdc,0x84,0x02,0x02,0x0a,0x58,0x7a,0x93,0x00,0x00,0x4d,0x86,0x02,
+ 0x01,0x48,0x51,0x85,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x02,0x0c,0x25,0x0f,0x85,0x02,0x01,0x32,0x49,0x81,0x00,0x03,0x18,0x4a,0x0c,0x08,
+ 0x87,0x00,0x04,0x1b,0x66,0x12,0x13,0x78,0x81,0xe4,0x04,0x42,0x13,0x1f,0x28,0x08,0x82,0x00,0x02,0x26,0x03,0x3c,0x81,0x08,0x08,0x6a,0xe5,0x5f,0x33,0x00,
+ 0x36,0x44,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x11,
+ 0x09,0x00,0x7d,0x8a,0x02,0x00,0x30,0x8a,0x00,0x00,0x60,0x81,0x1d,0x02,0x13,0x2b,0x29,0x81,0x00,0x00,0x3e,0x82,0x6b,0x00,0x9b,0x8c,0x00,0x00,0x21,0x8a,
+ 0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x85,0x00,0x06,0x28,0x6a,0x06,0x76,0x4b,0x85,0x5b,0x95,0x00,0x02,0x3a,0x73,0x2b,0x83,0x02,
+ 0x01,0x1d,0x7b,0x86,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x03,0x0c,0x03,0x64,0x4b,0x82,0x02,0x02,0x0f,0x99,0x62,0x8e,0x00,0x0b,0x1b,0xbc,
+ 0x12,0x13,0x78,0x1e,0xe4,0x42,0x13,0x76,0x29,0x14,0x81,0x00,0x0a,0x26,0x03,0x17,0x08,0x00,0x09,0x93,0xd5,0x70,0x81,0x00,0x81,0x29,0x01,0x00,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x03,0x09,0x00,0x7d,0x8a,0x02,
+ 0x00,0x30,0x8a,0x00,0x00,0x48,0x81,0x0f,0x02,0x02,0xba,0x68,0x93,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,
+ 0x00,0x05,0x0c,0x03,0x18,0x0c,0x03,0x0c,0x97,0x00,0x01,0x68,0x51,0x81,0x53,0x01,0x3e,0x3a,0x87,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,
+ 0x0c,0x03,0x81,0x0c,0x05,0xc3,0x8d,0x64,0x62,0x03,0x3f,0x8d,0x00,0x18,0x14,0x03,0x22,0x6a,0x61,0xbe,0x5c,0x90,0xdd,0x4c,0xb1,0x8e,0x09,0x00,0x0c,0x03,
+ 0x3c,0x08,0x00,0x09,0xc1,0x21,0x68,0xb3,0x3a,0x83,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x11,0x09,0x14,0x03,0x09,
+ 0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x11,0x09,0x00,0x7d,0x81,0x02,0x81,0x0f,0x82,0x02,0x00,0x0f,0x82,0x02,0x00,0x30,0x8a,0x00,0x00,0x61,0x81,0x4d,
+ 0x01,0x53,0x49,0x94,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,
+ 0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x11,0x03,0x09,0x14,0x11,0x3f,0x8c,0x00,0x15,0x14,0x17,0x03,0x27,
+ 0x58,0xa3,0xbc,0x74,0xe3,0x91,0x61,0x08,0x1b,0x14,0x0c,0x03,0x3c,0x14,0x00,0x09,0x03,0x41,0x81,0x00,0x00,0x29,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,
+ 0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x08,0x03,0x09,0x00,0x7d,0x02,0x0f,0x4d,0x51,0x12,
+ 0x81,0x02,0x81,0x4d,0x02,0x0e,0x02,0x30,0x8a,0x00,0x00,0x0e,0x81,0x02,0x02,0x8c,0x39,0x7a,0x93,0x00,0x00,0x21,0x85,0x02,0x01,0x48,0x0e,0x82,0x02,0x00,
+ 0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,
+ 0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x11,0x03,0x09,0x14,0x03,0x3f,0x8b,0x00,0x15,0x14,0x17,0x03,0x0c,0x3b,0x6d,0x9a,0x5f,0x81,0x33,0x6c,0x6d,0x29,0x00,
+ 0x0c,0x03,0x3c,0x14,0x00,0x09,0x03,0x41,0x88,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x8c,
+ 0x00,0x01,0x4a,0x11,0x81,0x14,0x0f,0x03,0x09,0x00,0x7d,0x02,0x8c,0x9b,0xe2,0x51,0x0e,0x02,0x33,0x28,0x1d,0x02,0x30,0x8a,0x00,0x05,0x30,0x48,0x32,0x0a,
+ 0x2c,0xd9,0x93,0x00,0x00,0x21,0x85,0x02,0x02,0x2d,0x73,0x0f,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,
+ 0x81,0x0c,0x01,0x03,0x0c,0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x11,0x03,0x09,0x14,0x03,0x3f,0x8a,0x00,
+ 0x15,0x14,0x17,0x03,0x0c,0x08,0x26,0x30,0xc7,0x55,0x2d,0x73,0x6a,0x98,0x74,0x0c,0x03,0x17,0x14,0x00,0x09,0x03,0x41,0x89,0x00,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x0f,0x03,0x09,0x00,0x7d,0x02,0x8c,0x9b,0xb8,
+ 0x67,0x70,0x02,0x0f,0x7b,0x5a,0x02,0x30,0x8a,0x00,0x05,0x2c,0x0f,0x0e,0x0f,0x1d,0x68,0x93,0x00,0x00,0x21,0x85,0x02,0x02,0x2b,0x4f,0x36,0x81,0x02,0x00,
+ 0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,
+ 0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x11,0x03,0x09,0x14,0x11,0x3f,0x89,0x00,0x16,0x14,0x3c,0x03,0x0c,0x08,0x41,0x03,0xb1,0x74,0x65,0x6f,0x2d,0x53,0x30,
+ 0x15,0x03,0x17,0x14,0x00,0x09,0x03,0x41,0x3b,0x83,0x28,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x11,0x09,0x14,
+ 0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x0f,0x03,0x09,0x00,0x7d,0x02,0x8c,0x9b,0x6f,0x1f,0x15,0x4d,0x33,0xa6,0x6f,0x02,0x30,0x8a,0x00,0x00,0x82,
+ 0x81,0x39,0x01,0x6b,0xa6,0x94,0x00,0x03,0x21,0x02,0x0a,0x6a,0x83,0x58,0x01,0x55,0x28,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,
+ 0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x03,0x03,0x09,
+ 0x14,0x03,0x3f,0x88,0x00,0x18,0x0c,0x17,0x03,0x0c,0x08,0x41,0x03,0x22,0x00,0x7a,0x29,0x62,0x29,0x7a,0x08,0x03,0x17,0x14,0x00,0x09,0x03,0x41,0x08,0x74,
+ 0x7f,0x82,0x78,0x00,0x46,0x82,0xde,0x02,0x66,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x8c,0x00,
+ 0x01,0x4a,0x03,0x81,0x14,0x0f,0x03,0x09,0x00,0x7d,0x02,0x8c,0x9b,0x6f,0x02,0x1f,0xa6,0x3b,0x81,0x0e,0x02,0x30,0x8a,0x00,0x00,0x32,0x82,0x2b,0x01,0x1d,
+ 0x29,0x93,0x00,0x03,0x21,0x02,0x13,0x98,0x84,0x4d,0x00,0x98,0x81,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,
+ 0x81,0x0c,0x01,0x03,0x0c,0xa5,0x00,0x05,0x27,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x11,0x03,0x09,0x14,0x11,0x3f,0x86,0x00,
+ 0x01,0x08,0x1b,0x81,0x03,0x07,0x26,0x00,0x41,0x03,0x41,0x3b,0x57,0x32,0x83,0x2b,0x82,0x12,0x81,0x2b,0x81,0x12,0x03,0x56,0x7a,0x70,0x3d,0x81,0x0b,0x00,
+ 0x01,0x82,0x0b,0x03,0x01,0xde,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,
+ 0x81,0x14,0x03,0x03,0x09,0x00,0x7d,0x81,0x02,0x01,0x13,0x0f,0x81,0x02,0x01,0x0f,0x8c,0x82,0x02,0x00,0x30,0x8a,0x00,0x01,0x2b,0x2c,0x81,0x48,0x01,0x2b,
+ 0x29,0x93,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x85,0x00,
+ 0x05,0x3b,0x2d,0x12,0x0a,0x30,0x49,0x83,0x00,0x02,0x3b,0xe2,0x3b,0x83,0x00,0x05,0x29,0x21,0x12,0x2b,0x2a,0x28,0x82,0x00,0x0b,0x7b,0x5a,0x12,0x33,0x67,
+ 0x00,0x27,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x03,0x03,0x09,0x14,0x03,0x3f,0x86,0x00,0x09,0x09,0x03,0x41,0x40,0x00,0x41,
+ 0x03,0x41,0x7a,0x2a,0x82,0x02,0x0e,0x36,0x99,0xc6,0xb4,0x12,0x30,0x6c,0xda,0xc5,0x02,0x0e,0x67,0x70,0x3d,0x0b,0x84,0x07,0x03,0x0b,0x95,0x00,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x03,0x09,0x00,0x7d,0x8a,0x02,
+ 0x00,0x30,0x8a,0x00,0x81,0x0a,0x03,0x0f,0x0e,0x1d,0x68,0x93,0x00,0x00,0x21,0x8a,0x02,0x00,0x3e,0x87,0x00,0x05,0x08,0x11,0x09,0x14,0x03,0x09,0x86,0x00,
+ 0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x01,0x3a,0x2a,0x83,0x02,0x0c,0x2c,0x49,0x00,0x3a,0x2d,0x0e,0x02,0x0f,0x44,0x28,0x00,0x68,0x24,0x83,
+ 0x02,0x04,0x1d,0x3b,0x00,0x58,0x0f,0x82,0x02,0x07,0x0e,0x7b,0x27,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x03,0x03,0x09,0x14,
+ 0x03,0x3f,0x81,0x00,0x02,0x28,0x39,0x4f,0x81,0x00,0x09,0x1b,0x11,0x4d,0xad,0x09,0x03,0x41,0x00,0x29,0x2c,0x82,0x02,0x0f,0x4c,0x48,0x4b,0x58,0x39,0xce,
+ 0x94,0x13,0x39,0x0a,0x02,0xcc,0x53,0x3d,0x1e,0x9e,0x81,0x8f,0x05,0xb7,0xa8,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,
+ 0x09,0x11,0x09,0x14,0x11,0x09,0x8c,0x00,0x01,0x4a,0x03,0x81,0x14,0x03,0x03,0x41,0x00,0x7b,0x8a,0x02,0x00,0x2a,0x87,0x00,0x07,0x49,0x98,0x3a,0x73,0x1f,
+ 0x39,0x2a,0x74,0x94,0x00,0x00,0x39,0x89,0x02,0x01,0x0f,0x9b,0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,
+ 0x0c,0x84,0x00,0x01,0x1c,0x0e,0x84,0x02,0x02,0x6c,0x00,0x53,0x84,0x02,0x02,0x44,0x7a,0x81,0x85,0x02,0x02,0x73,0x68,0xcc,0x84,0x02,0x06,0x24,0x00,0x03,
+ 0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x11,0x03,0x09,0x14,0x03,0x3f,0x81,0x00,0x02,0x1c,0x1d,0x55,0x81,0x00,0x09,0x22,0x11,0x4f,
+ 0x64,0x17,0x03,0x08,0x00,0xd9,0x48,0x82,0x02,0x0f,0xff,0x33,0x6a,0x56,0x99,0x93,0x4c,0x13,0x82,0x0a,0x02,0x12,0x53,0x2e,0x1e,0xd7,0x81,0x2f,0x05,0xb9,
+ 0xa8,0x0b,0xed,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x07,0x4a,0x03,0x14,0x08,0x17,
+ 0x03,0x4a,0x29,0x8a,0x02,0x00,0x2d,0x87,0x00,0x04,0x1c,0x21,0x3b,0x6b,0x12,0x81,0x2b,0x01,0x4b,0x29,0x93,0x00,0x01,0x3e,0x0f,0x88,0x02,0x01,0x0a,0x55,
+ 0x87,0x00,0x05,0x08,0x03,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x00,0x58,0x85,0x02,0x02,0x5a,0x3a,0x6f,0x84,
+ 0x02,0x02,0x0e,0x28,0x56,0x85,0x02,0x02,0x21,0x49,0x13,0x84,0x02,0x06,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x03,
+ 0x11,0x09,0x14,0x03,0x3f,0x86,0x00,0x01,0x18,0x03,0x81,0x11,0x01,0x03,0x09,0x81,0x00,0x01,0x3a,0x77,0x82,0x02,0x0f,0xce,0x44,0x57,0x21,0x76,0xff,0x44,
+ 0x21,0x82,0x0f,0x8c,0x81,0x3b,0x01,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0xed,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,
+ 0x03,0x09,0x14,0x03,0x09,0x8c,0x00,0x04,0x26,0x03,0x26,0x9b,0x58,0x81,0x17,0x01,0x08,0x1f,0x89,0x02,0x00,0x7b,0x8a,0x00,0x01,0x0a,0x12,0x81,0x77,0x01,
+ 0xaa,0x3b,0x93,0x00,0x01,0x29,0x1f,0x88,0x02,0x01,0x36,0x3a,0x87,0x00,0x05,0x0c,0x03,0x09,0x14,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,
+ 0x0c,0x84,0x00,0x09,0x73,0x02,0x0f,0x32,0x1d,0x0a,0x02,0x24,0x62,0x2b,0x85,0x02,0x16,0x4f,0x56,0x02,0x0f,0x12,0x76,0x0e,0x02,0x6c,0x1c,0x0e,0x02,0x13,
+ 0x12,0x48,0x02,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x11,0x03,0x09,0x14,0x03,0x3f,0x87,0x00,0x00,0x18,0x81,0x22,
+ 0x00,0x0c,0x83,0x00,0x02,0x15,0x30,0x48,0x81,0x0e,0x00,0x0a,0x81,0x13,0x03,0x0e,0x0a,0x13,0x0a,0x81,0x0e,0x05,0x2a,0x3a,0x27,0x0b,0x1e,0xd7,0x81,0xcf,
+ 0x05,0xb9,0xa8,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x81,0x00,0x01,0x1c,0x9b,0x88,
+ 0x00,0x08,0x14,0x03,0x22,0x4d,0x53,0x3f,0x03,0x17,0x51,0x88,0x02,0x01,0xc7,0x3a,0x8a,0x00,0x04,0x4c,0x5a,0x30,0x2a,0x64,0x95,0x00,0x01,0x3e,0x0e,0x86,
+ 0x02,0x01,0xdc,0x1c,0x87,0x00,0x06,0x0c,0x03,0x17,0x14,0x0c,0x03,0x09,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x26,0x73,0x02,0x33,
+ 0x6c,0x06,0x23,0x8c,0x24,0x62,0x2b,0x02,0x24,0x44,0x36,0x0e,0x02,0x4f,0x56,0x02,0x44,0x2a,0x36,0x57,0x02,0x6c,0x1c,0x0e,0x12,0x2d,0x30,0x4c,0x32,0x0a,
+ 0x29,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x11,0x03,0x09,0x14,0x11,0x3f,0x8f,0x00,0x08,0x0c,0x1b,0x40,0x15,0xa6,0xd5,0x66,
+ 0xab,0xa6,0x84,0x55,0x05,0x29,0x00,0x27,0x01,0x1e,0xf4,0x82,0xf3,0x04,0x0d,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,
+ 0x09,0x03,0x09,0x14,0x11,0x09,0x81,0x00,0x01,0x2d,0x1d,0x89,0x00,0x08,0x41,0x03,0x09,0x18,0x00,0x09,0x03,0x1b,0x6d,0x86,0x02,0x01,0x2b,0xa6,0x8b,0x00,
+ 0x01,0x32,0x0f,0x81,0x02,0x01,0x1d,0x3b,0x95,0x00,0x01,0x81,0x13,0x84,0x02,0x01,0x32,0xbd,0x87,0x00,0x07,0x0c,0x03,0x17,0x14,0x18,0x43,0x03,0x18,0x86,
+ 0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x26,0x73,0x02,0x36,0x24,0x60,0x4d,0x0e,0x24,0x62,0x2b,0x0e,0x2d,0x1d,0x33,0xc6,0x02,0x4f,0x56,
+ 0x02,0x56,0xc6,0x4b,0x2d,0x02,0x6c,0x1c,0x0e,0x60,0x4b,0x06,0x6f,0x24,0x0a,0x29,0x03,0x09,0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x05,0x03,
+ 0x11,0x09,0x14,0x11,0x3f,0x8e,0x00,0x00,0x08,0x81,0x17,0x05,0x18,0x00,0x4a,0x03,0x3c,0x08,0x87,0x00,0x01,0x15,0x80,0x86,0x0b,0x02,0xb2,0x3a,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x81,0x00,0x81,0x3a,0x89,0x00,0x01,0x08,0x1b,0x81,0x03,0x06,0x18,0x00,
+ 0x09,0x03,0x22,0x6a,0x2b,0x82,0x02,0x02,0x0e,0x33,0x4f,0x8c,0x00,0x05,0x13,0x60,0x2c,0x32,0x2b,0x29,0x96,0x00,0x06,0x28,0x98,0x60,0x1f,0x33,0x53,0x3b,
+ 0x87,0x00,0x07,0x0c,0x03,0x17,0x14,0x18,0x43,0x03,0x18,0x87,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x26,0x73,0x02,0x32,0x82,0x1f,0xa1,
+ 0x02,0x24,0x62,0x2b,0x13,0x53,0x61,0x6f,0x36,0x02,0x4f,0x56,0x02,0xdf,0x82,0x1f,0x4b,0x02,0x6c,0x1c,0x0e,0x13,0x82,0x30,0xdf,0x0e,0x0a,0x29,0x03,0x09,
+ 0x18,0x11,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x11,0x03,0x09,0x14,0x11,0x09,0x8e,0x00,0x07,0x08,0x8e,0x08,0x3b,0x18,0x8e,0x22,0x3a,0x86,0x3b,
+ 0x03,0x3a,0x00,0x73,0x3d,0x82,0x0b,0x00,0x01,0x82,0x0b,0x02,0xda,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,
+ 0x11,0x09,0x8f,0x00,0x00,0x18,0x81,0x03,0x09,0x18,0x00,0x09,0x03,0x3c,0x7a,0x7b,0x73,0x23,0x55,0x8e,0x00,0x05,0x81,0x67,0xbd,0x7b,0x3e,0x3a,0xa4,0x00,
+ 0x07,0x0c,0x03,0x17,0x14,0x27,0x43,0x03,0x0c,0x88,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x14,0x73,0x02,0x1d,0x6b,0x65,0xbf,0x0e,0x24,
+ 0x62,0x2b,0x02,0xa1,0x24,0x12,0x0e,0x02,0x4f,0x56,0x02,0x30,0x74,0x81,0x85,0x0f,0x02,0x6c,0x1c,0x0e,0x12,0x53,0x58,0x73,0xba,0x0a,0x29,0x03,0x09,0x18,
+ 0x03,0x3f,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x81,0x03,0x04,0x09,0x08,0x03,0x17,0x14,0x8b,0x00,0x05,0x3b,0x2d,0x12,0x13,0x48,0x0a,0x84,0x13,0x01,0x0a,
+ 0x48,0x83,0x13,0x03,0x6f,0x29,0x70,0x3d,0x85,0x0b,0x03,0x01,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x11,0x09,0x14,
+ 0x03,0x09,0x90,0x00,0x08,0x0c,0x03,0x43,0x18,0x00,0x09,0x03,0x1b,0x08,0xbb,0x00,0x02,0x0c,0x03,0x17,0x81,0x27,0x02,0x43,0x03,0x0c,0x89,0x00,0x01,0x0c,
+ 0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x00,0x73,0x81,0x02,0x0e,0x1f,0x5a,0x2d,0x0e,0x24,0x62,0x2b,0x8c,0x39,0x8a,0x6b,0x30,0x02,0x4f,0x56,0x81,0x02,
+ 0x06,0x36,0xdf,0x57,0x02,0x6c,0x1c,0x0e,0x81,0x02,0x09,0x2d,0x5a,0x24,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x85,0x00,0x01,0x26,0x03,0x81,0x0c,0x81,0x03,
+ 0x05,0x1b,0x08,0x0c,0x03,0x17,0x14,0x8a,0x00,0x00,0x6b,0x82,0x02,0x02,0x33,0x53,0x24,0x82,0x02,0x0b,0x12,0x2d,0xaa,0x4b,0x32,0x1d,0x1f,0x02,0x6b,0xb1,
+ 0x3d,0x07,0x82,0xf5,0x05,0xf4,0x63,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x08,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x91,0x00,
+ 0x08,0x3f,0x03,0x43,0x27,0x00,0x09,0x03,0x1b,0x08,0xb9,0x00,0x07,0x0c,0x03,0x17,0x18,0x27,0x17,0x03,0x0c,0x8a,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,
+ 0x0c,0x84,0x00,0x00,0x73,0x81,0x02,0x06,0x0f,0x6d,0x30,0x02,0x24,0x62,0x2b,0x81,0x02,0x05,0x2d,0x2a,0x5a,0x02,0x4f,0x56,0x81,0x02,0x06,0x0a,0x21,0x36,
+ 0x02,0x21,0x15,0x0e,0x81,0x02,0x09,0x21,0x2d,0x48,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x82,0x00,0x04,0x08,0x09,0x41,0x3c,0x03,0x81,0x0c,0x81,0x11,0x06,
+ 0x03,0x1b,0x08,0x26,0x03,0x17,0x14,0x89,0x00,0x00,0x1d,0x82,0x02,0x02,0x0a,0x70,0x76,0x83,0x02,0x0b,0x65,0x2a,0x2c,0xaa,0x39,0x0a,0x02,0x0e,0xe6,0x3d,
+ 0x1e,0xe7,0x81,0xae,0x05,0xfd,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x0d,0x3b,0x74,0x55,0x4d,0x29,0x09,0x03,0x14,0x09,0x03,0x09,
+ 0x14,0x03,0x09,0x8f,0x00,0x01,0x18,0x1b,0x82,0x03,0x06,0x43,0x18,0x00,0x09,0x03,0x1b,0x08,0xb7,0x00,0x07,0x0c,0x03,0x17,0x18,0x27,0x17,0x03,0x0c,0x8b,
+ 0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x09,0x73,0x02,0x76,0x0e,0x02,0x1d,0x0f,0x24,0x62,0x2b,0x81,0x02,0x11,0xef,0x5a,0x0e,0x02,0x4f,
+ 0x56,0x02,0xba,0x0f,0x02,0x76,0x02,0xca,0xc1,0x0e,0x0a,0x48,0x02,0x82,0x0a,0x05,0x29,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x01,0x08,0x3c,0x83,0x03,0x81,
+ 0x0c,0x83,0x03,0x05,0x1b,0x08,0x26,0x03,0x17,0x08,0x88,0x00,0x00,0x1d,0x82,0x02,0x04,0x8c,0x24,0x57,0x0f,0x0a,0x81,0x02,0x04,0x12,0x85,0x0f,0x65,0x39,
+ 0x81,0x02,0x04,0x0f,0x2a,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x0d,0x29,0x2a,0x39,0x36,0x4f,
+ 0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x8e,0x00,0x03,0x08,0x17,0x03,0x41,0x81,0x03,0x07,0x11,0x17,0x27,0x00,0x09,0x03,0x1b,0x08,0xb5,0x00,0x02,
+ 0x18,0x03,0x43,0x81,0x27,0x02,0x17,0x03,0x0c,0x8c,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x13,0x73,0x02,0x44,0x73,0x53,0x67,0x0e,0x24,
+ 0x62,0x2b,0x0e,0x36,0x0a,0x32,0x4b,0x02,0x4f,0x56,0x02,0x61,0x81,0x57,0x10,0x58,0x02,0x21,0x49,0x0e,0xf2,0xda,0x21,0x4c,0x5a,0x0a,0x29,0x03,0x09,0x18,
+ 0x11,0x3f,0x81,0x00,0x05,0x26,0x11,0x40,0x51,0x26,0x03,0x81,0x0c,0x81,0x03,0x81,0x11,0x06,0x03,0x1b,0x08,0x26,0x03,0x3c,0x08,0x87,0x00,0x00,0x4d,0x82,
+ 0x02,0x0b,0x77,0xb6,0x4b,0x0a,0x57,0x02,0x1f,0x6d,0x44,0x02,0x21,0xb8,0x81,0x02,0x04,0x2a,0x70,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x0d,0x29,0x2a,0x21,0x61,0x53,0x09,0x03,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8e,0x00,0x04,0x18,0x03,0x7a,0x4d,
+ 0xab,0x82,0x03,0x06,0x17,0x27,0x00,0x09,0x03,0x1b,0x08,0xb4,0x00,0x06,0x1b,0x03,0x27,0x14,0x17,0x03,0x0c,0x8d,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,
+ 0x0c,0x84,0x00,0x1d,0x73,0x02,0x32,0x0a,0x0f,0x1f,0x0f,0x24,0x62,0x2b,0x13,0x3e,0x56,0x4c,0x36,0x02,0x4f,0x56,0x02,0x24,0x0e,0x0f,0x4b,0x02,0x33,0x12,
+ 0x02,0x12,0x76,0x8c,0x81,0xef,0x06,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x05,0x09,0x03,0x1c,0x0e,0xab,0x03,0x81,0x0c,0x00,0x11,0x84,0x03,0x05,
+ 0x41,0x08,0x26,0x03,0x3c,0x08,0x86,0x00,0x03,0x3a,0xaa,0x13,0x0f,0x81,0x0e,0x81,0x0f,0x01,0x0e,0x0f,0x82,0x0e,0x00,0x0f,0x81,0x0e,0x06,0x0f,0x32,0x28,
+ 0x74,0x3d,0x1e,0x9d,0x81,0xea,0x05,0xd7,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x0d,0x39,0x8a,0x58,0x30,0x67,0x09,0x03,0x14,0x09,
+ 0x03,0x09,0x14,0x03,0x09,0x8e,0x00,0x0f,0x3c,0x03,0xab,0x4d,0x3b,0x03,0x22,0x0c,0x03,0x43,0x14,0x00,0x09,0x03,0x1b,0x08,0xb3,0x00,0x05,0x1b,0x17,0x00,
+ 0x1b,0x03,0x0c,0x8e,0x00,0x01,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x26,0x73,0x02,0x2b,0x2d,0x61,0x2a,0x02,0x24,0x62,0x2b,0x02,0x0a,0x0f,0x8c,
+ 0x0e,0x02,0x4f,0x56,0x02,0xba,0x98,0x4d,0x24,0x02,0x6c,0x58,0x0e,0x0f,0x2a,0x2d,0x77,0x0f,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x81,0x00,0x05,0x0c,0x03,
+ 0x09,0x3a,0x1b,0x03,0x81,0x0c,0x81,0x03,0x02,0x11,0x03,0x11,0x81,0x03,0x05,0x1b,0x00,0x26,0x03,0x1b,0x08,0x87,0x00,0x13,0x08,0x43,0x18,0x7a,0x1b,0x09,
+ 0x3a,0x18,0x4a,0x0c,0x7a,0x3a,0x40,0x43,0x0c,0x7a,0x22,0xa7,0x3d,0x16,0x84,0x1a,0x03,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x03,0x0a,0x15,0x00,0xde,0x85,0x59,
+ 0x08,0x01,0x79,0x14,0x09,0x03,0x09,0x14,0x11,0x09,0x8c,0x00,0x05,0x08,0x1b,0x03,0x09,0x18,0x09,0x81,0x03,0x0a,0x18,0x00,0x0c,0x03,0x43,0x14,0x00,0x09,
+ 0x03,0x1b,0x08,0xb2,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x8f,0x00,0x01,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x84,0x00,0x26,0x73,0x02,0x36,0x12,0x02,0x56,
+ 0x0e,0x24,0x62,0x2b,0x0f,0x2d,0x57,0x4c,0x32,0x02,0x4f,0x56,0x02,0x2d,0x0a,0x0e,0x4c,0x02,0x44,0x1c,0x0e,0x60,0x33,0x13,0x36,0x5a,0x0a,0x29,0x03,0x09,
+ 0x18,0x11,0x3f,0x81,0x00,0x03,0x08,0x17,0x1b,0x00,0x81,0x03,0x81,0x0c,0x00,0x03,0x82,0x11,0x81,0x03,0x81,0x11,0x04,0x41,0x00,0x09,0x03,0x18,0x87,0x00,
+ 0x03,0x18,0x03,0x0c,0x08,0x81,0x43,0x01,0x22,0x11,0x81,0x03,0x03,0x17,0x08,0x0c,0x11,0x81,0x0c,0x02,0x03,0xa7,0x3d,0x82,0x01,0x00,0x0b,0x81,0x01,0x03,
+ 0x0b,0x05,0x5b,0x1c,0x86,0x02,0x00,0x0a,0x81,0x15,0x00,0x80,0x82,0x01,0x0b,0x0b,0x01,0x0b,0x01,0xc2,0x14,0x09,0x03,0x09,0x14,0x03,0x09,0x8b,0x00,0x08,
+ 0x08,0x1b,0x03,0x09,0x18,0x17,0x03,0x17,0x0c,0x82,0x00,0x08,0x0c,0x03,0x17,0x14,0x00,0x09,0x03,0x1b,0x08,0x87,0x00,0x04,0x7a,0x49,0x53,0x81,0x28,0x9c,
+ 0x00,0x04,0x3b,0x3e,0x4c,0x67,0x3b,0x82,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x85,0x00,0x81,0x08,0x87,0x00,0x01,0x0c,0x11,0x81,0x0c,0x04,0x03,0x0c,0x28,
+ 0x4f,0x3a,0x81,0x00,0x26,0x73,0x02,0x24,0x2d,0x6c,0x53,0x0f,0x24,0x62,0x2b,0x0a,0x39,0x0f,0x32,0x36,0x02,0x4f,0x56,0x02,0x2a,0x21,0x2a,0x2d,0x02,0x44,
+ 0x1c,0x0e,0xef,0x2d,0x33,0x2d,0xba,0x0a,0x29,0x03,0x09,0x18,0x03,0x3f,0x82,0x00,0x02,0x17,0x1b,0x00,0x81,0x03,0x81,0x0c,0x81,0x03,0x00,0x11,0x81,0x03,
+ 0x0a,0x11,0x03,0x11,0x03,0x18,0x26,0x03,0x18,0x68,0x4f,0x68,0x84,0x00,0x04,0x18,0x03,0x0c,0x5b,0xbc,0x81,0x66,0x0b,0xc1,0xa6,0xd5,0x66,0x62,0x28,0x66,
+ 0x28,0x40,0x03,0xa7,0x3d,0x85,0x01,0x03,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x16,0x83,0x38,0x09,0x1e,0x0b,0xc2,0x14,0x09,0x03,0x09,
+ 0x14,0x11,0x09,0x8a,0x00,0x07,0x08,0x1b,0x03,0x09,0x27,0x17,0x03,0x0c,0x85,0x00,0x08,0x0c,0x03,0x17,0x14,0x00,0x09,0x03,0x1b,0x08,0x86,0x00,0x01,0x74,
+ 0x0a,0x81,0x02,0x01,0x32,0x1c,0x9a,0x00,0x06,0x3b,0x6d,0x0f,0x02,0x0f,0x30,0x3b,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x83,0x00,0x01,0x14,0x41,0x81,
+ 0x17,0x00,0x3f,0x86,0x00,0x01,0x0c,0x03,0x81,0x0c,0x12,0x8e,0xa5,0x32,0x2c,0x36,0x15,0x00,0x73,0x02,0x48,0x6c,0x39,0x4b,0x02,0x24,0x62,0x2b,0x0f,0x6b,
+ 0x81,0x4d,0x04,0x32,0x02,0x4f,0x56,0x02,0x81,0x1f,0x81,0x32,0x02,0x02,0x44,0x1c,0x81,0x0e,0x00,0x1f,0x81,0x32,0x07,0x13,0x0a,0x29,0x03,0x09,0x18,0x03,
+ 0x3f,0x82,0x00,0x02,0x17,0x1b,0x00,0x81,0x03,0x81,0x0c,0x00,0x11,0x81,0x03,0x00,0x11,0x81,0x03,0x82,0x11,0x07,0x18,0x26,0x03,0x71,0x1d,0x2c,0x6f,0x9b,
+ 0x83,0x00,0x05,0x18,0x95,0x6c,0x2c,0x13,0x48,0x81,0x0a,0x83,0x13,0x00,0x0a,0x81,0x13,0x04,0xb6,0x03,0xa7,0x3d,0x0b,0x84,0x07,0x03,0x0b,0x05,0x5b,0x1c,
+ 0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9d,0x81,0xea,0x0a,0xd7,0xf4,0x0b,0xc2,0x14,0x26,0x93,0x24,0x6f,0xa1,0x24,0x86,0x6f,0x0a,0x36,0x3e,0x00,0x08,
+ 0x1b,0x03,0x09,0x27,0x17,0x03,0x0c,0x87,0x00,0x08,0x0c,0x03,0x17,0x14,0x00,0x22,0x03,0x41,0x08,0x84,0x00,0x01,0x29,0x1d,0x83,0x02,0x00,0xb3,0x9a,0x00,
+ 0x01,0x9b,0x0f,0x83,0x02,0x00,0x51,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x83,0x00,0x05,0x1b,0x03,0x1b,0x17,0x03,0x0c,0x85,0x00,0x01,0x0c,0x03,0x81,
+ 0x0c,0x00,0xa7,0x83,0x02,0x0b,0x5a,0x3a,0x73,0x02,0x30,0x4c,0x44,0x4d,0x0e,0x24,0x62,0x2b,0x81,0x02,0x1b,0x0e,0x24,0x0f,0x02,0x4f,0x56,0x02,0x61,0x2d,
+ 0x13,0x2d,0x02,0x44,0x1c,0x0e,0x4b,0x1d,0x77,0x44,0x5a,0x0a,0x29,0x03,0x09,0x27,0x03,0x1b,0x08,0x81,0x00,0x02,0x17,0x1b,0x00,0x81,0x03,0x81,0x0c,0x00,
+ 0x11,0x83,0x03,0x07,0x11,0x03,0x11,0x03,0x18,0x26,0xb2,0x0a,0x82,0x02,0x01,0x12,0x4f,0x82,0x00,0x01,0x08,0xc5,0x82,0x02,0x0f,0x85,0x94,0x9c,0x4d,0x6b,
+ 0x06,0x02,0x4c,0x1f,0x02,0x0f,0xe3,0xa7,0x3d,0x1e,0xf3,0x81,0xb7,0x05,0x9d,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,
+ 0x2f,0x10,0xcf,0xf3,0x0b,0xc2,0x14,0x8d,0x13,0x02,0x33,0xb4,0x60,0xb8,0x0e,0x24,0x36,0x39,0x1f,0x81,0x02,0x0a,0x8c,0x58,0x1b,0x03,0x09,0x27,0x17,0x03,
+ 0x0c,0x28,0x55,0x87,0x00,0x08,0x0c,0x03,0x17,0x14,0x00,0x22,0x03,0x41,0x08,0x83,0x00,0x01,0x55,0x13,0x83,0x02,0x00,0xba,0x9a,0x00,0x00,0x61,0x84,0x02,
+ 0x00,0x61,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x82,0x00,0x06,0x08,0x03,0xb2,0x44,0x8a,0x03,0x1b,0x82,0x00,0x04,0x3b,0xbd,0x55,0x0c,0x03,0x81,0x0c,
+ 0x00,0xa1,0x84,0x02,0x2d,0x5b,0x73,0x02,0x5a,0x2d,0x8a,0x6a,0x0e,0x24,0x62,0x2b,0x0f,0x24,0x60,0x4d,0x5a,0x02,0x4f,0x56,0x02,0x82,0x4b,0x2d,0xa5,0x02,
+ 0x44,0x1c,0x0e,0x32,0x61,0x58,0x2d,0xc7,0x0a,0x62,0x03,0x41,0x00,0x3f,0x03,0x1b,0x08,0x00,0x17,0x1b,0x00,0x81,0x03,0x81,0x0c,0x82,0x03,0x03,0x11,0xa4,
+ 0xc1,0xd6,0x81,0x03,0x02,0x18,0x26,0x94,0x84,0x02,0x00,0x23,0x82,0x00,0x01,0x3b,0x0e,0x82,0x02,0x08,0xfa,0x6d,0x2c,0x6b,0x0a,0x85,0x0a,0xbf,0x99,0x81,
+ 0x02,0x04,0x12,0x93,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x10,0xcf,0xf3,
+ 0x0b,0xc2,0x3b,0x1d,0x02,0x0a,0x4d,0x60,0x85,0xa3,0x24,0x2d,0x65,0x12,0x61,0x82,0x02,0x0b,0xcc,0x03,0x09,0x27,0x17,0x03,0x18,0x39,0x48,0x0e,0x1d,0x49,
+ 0x86,0x00,0x07,0x0c,0x03,0x17,0x08,0x00,0x22,0x03,0x41,0x83,0x00,0x02,0xec,0x0e,0x12,0x81,0x02,0x01,0x0a,0xcc,0x92,0x00,0x04,0x68,0x4c,0x33,0x39,0x49,
+ 0x82,0x00,0x06,0x98,0x0f,0x0a,0x02,0x0f,0x0e,0x61,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x82,0x00,0x0a,0x62,0x06,0x0e,0x02,0x24,0x09,0x03,0x22,0x00,
+ 0x64,0x32,0x81,0x0e,0x01,0x6c,0xd6,0x81,0x0c,0x00,0x4b,0x84,0x02,0x0b,0x49,0x73,0x0f,0x0e,0x2b,0x12,0x0e,0x02,0x24,0x62,0x2b,0x0f,0x82,0x1d,0x1e,0x0a,
+ 0x02,0x4f,0x56,0x02,0x48,0x02,0x13,0x0e,0x02,0x44,0x1c,0x13,0x02,0x0a,0x0e,0x0f,0x02,0x0a,0x28,0x1b,0x03,0x09,0x00,0x09,0x03,0x1b,0x08,0x17,0x1b,0x00,
+ 0x81,0x03,0x81,0x0c,0x82,0x03,0x08,0xdd,0x1f,0x0e,0x0a,0x94,0x03,0x18,0x26,0xa5,0x84,0x02,0x00,0x4c,0x82,0x00,0x01,0x3b,0x0e,0x82,0x02,0x08,0x1f,0x60,
+ 0xce,0x98,0x0e,0xaf,0x2a,0x94,0x6e,0x81,0x02,0x04,0x12,0xbb,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x49,
+ 0x4e,0x07,0x8f,0x82,0xb9,0x0f,0xf3,0x0b,0xc2,0x15,0x0e,0x02,0x12,0x39,0xcc,0x85,0xc4,0x56,0x4d,0x2a,0x6f,0x6b,0x82,0x02,0x06,0x2b,0x09,0x14,0x17,0x03,
+ 0x0c,0x61,0x83,0x02,0x00,0x12,0x87,0x00,0x07,0x0c,0x03,0x17,0x08,0x00,0x22,0x03,0x41,0x82,0x00,0x06,0xec,0x0a,0x56,0x2b,0x44,0x2a,0xcc,0x92,0x00,0x00,
+ 0x36,0x82,0x02,0x01,0x0a,0x55,0x81,0x00,0x02,0x98,0xba,0xb8,0x81,0x36,0x01,0x1d,0x61,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x82,0x00,0x00,0x60,0x83,
+ 0x02,0x04,0xaa,0x1b,0x03,0x40,0x12,0x83,0x02,0x00,0xa3,0x81,0x0c,0x0b,0x4b,0x30,0x48,0x2b,0x24,0x0e,0x49,0x73,0x48,0x6b,0x2a,0x2c,0x81,0x02,0x04,0x24,
+ 0x62,0x2b,0x12,0x0f,0x83,0x02,0x05,0x4f,0x56,0x12,0x2d,0x33,0x0e,0x81,0x02,0x05,0x44,0x1c,0x13,0xc4,0x6c,0x0a,0x81,0x02,0x0e,0x0a,0x28,0x08,0x1b,0x03,
+ 0x09,0x00,0x09,0x03,0x43,0x03,0x41,0x3a,0x17,0x03,0x81,0x0c,0x81,0x03,0x01,0xa4,0x2c,0x83,0x02,0x09,0x8d,0x18,0x26,0xa5,0x1d,0x32,0x2b,0x76,0x32,0x4c,
+ 0x82,0x00,0x01,0x08,0x9c,0x82,0x02,0x0f,0x50,0x9a,0x9c,0x82,0xe6,0x06,0x44,0x0f,0x21,0x0a,0x0f,0xbe,0xa7,0x3d,0x1e,0xd7,0x81,0x97,0x05,0xb9,0xa8,0x0b,
+ 0x05,0x5b,0x1c,0x86,0x02,0x04,0x0a,0x15,0x14,0x01,0x07,0x83,0xa8,0x07,0x0d,0x0b,0xc2,0x14,0x57,0x02,0x0f,0x58,0x81,0x65,0x05,0x30,0x5a,0x4d,0x39,0x2a,
+ 0x21,0x82,0x02,0x06,0x30,0x14,0x17,0x03,0x0c,0x00,0x24,0x84,0x02,0x00,0x49,0x87,0x00,0x07,0x26,0x03,0x17,0x08,0x00,0x22,0x03,0x41,0x81,0x00,0x06,0xec,
+ 0x48,0x4d,0x2d,0x39,0x2d,0xcc,0x91,0x00,0x01,0x64,0x0e,0x83,0x02,0x00,0x44,0x81,0x00,0x01,0x98,0x2b,0x81,0x4c,0x02,0x53,0x1d,0x61,0x81,0x00,0x04,0x1b,
+ 0x17,0x00,0x3c,0x17,0x82,0x00,0x00,0x0e,0x83,0x02,0x04,0x0a,0x08,0x1b,0xab,0x0e,0x83,0x02,0x00,0xc6,0x81,0x0c,0x07,0x4b,0x39,0x4b,0x53,0x58,0x13,0x49,
+ 0x73,0x81,0x02,0x0e,0x0a,0x44,0x56,0x12,0x24,0x62,0x2b,0x6f,0x21,0x2a,0x2b,0x0f,0x02,0x4f,0x56,0x81,0x02,0x00,0x1d,0x81,0x39,0x05,0x13,0x44,0x1c,0x0e,
+ 0x02,0x2c,0x81,0x39,0x09,0x1f,0x2c,0x28,0x00,0x08,0x1b,0x03,0x09,0x00,0x09,0x81,0x03,0x08,0x15,0x1d,0x7a,0x03,0x18,0x0c,0x03,0x11,0xe3,0x84,0x02,0x09,
+ 0xc4,0x18,0x26,0xa5,0x5a,0x33,0x4c,0x5f,0x1d,0x4c,0x82,0x00,0x02,0x18,0xd6,0x2a,0x84,0x0a,0x00,0x48,0x81,0x0a,0x81,0x48,0x07,0x0a,0x48,0xb6,0xfb,0xa7,
+ 0x3d,0x1e,0xf3,0x82,0x9d,0x04,0x0d,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x04,0x0a,0x15,0x27,0x01,0x0b,0x81,0x01,0x00,0x0b,0x82,0x01,0x14,0xc2,0x14,0x40,0xc7,
+ 0x02,0x0f,0xdc,0x13,0x0e,0x0f,0x13,0x0e,0x2b,0x0f,0x02,0x0f,0x1d,0x5b,0x17,0x03,0x0c,0x81,0x00,0x06,0x1d,0x02,0x0e,0x13,0x0f,0x02,0x7d,0x88,0x00,0x0f,
+ 0x26,0x03,0x17,0x08,0x00,0x22,0x03,0x22,0x00,0xec,0x0e,0x0f,0x48,0x02,0x0f,0xcc,0x91,0x00,0x01,0x3e,0x0f,0x83,0x02,0x00,0x36,0x81,0x00,0x06,0x98,0x02,
+ 0x13,0x0e,0x02,0x0f,0x61,0x81,0x00,0x04,0x1b,0x17,0x00,0x3c,0x17,0x82,0x00,0x02,0x02,0x0f,0x02,0x81,0x0f,0x09,0x13,0x0c,0x08,0x15,0x0f,0x13,0x02,0x0e,
+ 0x02,0x33,0x81,0x0c,0x07,0x4b,0x2b,0xaa,0xba,0x24,0x0f,0x49,0x73,0x81,0x02,0x06,0x0e,0x48,0x0e,0x0a,0x24,0x62,0x2b,0x81,0x02,0x05,0x12,0xb3,0x6c,0x0f,
+ 0x4f,0x56,0x81,0x02,0x81,0x0e,0x06,0x0a,0x12,0x44,0x1c,0x0e,0x02,0x0f,0x81,0x0e,0x02,0xba,0x2c,0x28,0x81,0x00,0x1e,0x08,0x1b,0x03,0x09,0x00,0x09,0x03,
+ 0x62,0x44,0x40,0x41,0x70,0x4d,0x1b,0x03,0x89,0x02,0x0f,0x13,0x0e,0x02,0x9c,0x27,0x26,0xa5,0x0e,0x44,0xdf,0x1d,0x0a,0x4c,0x82,0x00,0x04,0x18,0x11,0x0c,
+ 0x29,0x9f,0x81,0x95,0x0c,0x9f,0x62,0x40,0x26,0x28,0x29,0x95,0xab,0x0c,0x11,0xa7,0x3d,0x0b,0x84,0x16,0x03,0x01,0x05,0x5b,0x1c,0x86,0x02,0x02,0x0a,0x15,
+ 0x14,0x82,0x01,0x01,0x0b,0x01,0x82,0x0b,0x07,0xc2,0x14,0x09,0xbc,0xbd,0x7b,0xbe,0xbd,0x83,0x3e,0x07,0x7b,0x91,0xbe,0xbd,0x29,0x17,0x03,0x26,0x82,0x00,
+ 0x01,0x1d,0x24,0x82,0x82,0x01,0x0f,0x7d,0x89,0x00,0x02,0x26,0x03,0x3c,0x81,0x08,0x06,0x22,0x03,0x22,0x55,0x13,0x21,0x0e,0x81,0x02,0x00,0xcc,0x91,0x00,
+ 0x06,0x3e,0x0f,0x24,0x30,0x2a,0x0a,0x36,0x81,0x00,0x02,0x98,0x2b,0x44,0x82,0x02,0x08,0x61,0x00,0x14,0x03,0x1b,0x00,0x1b,0x03,0x27,0x81,0x00,0x0e,0x0f,
+ 0x39,0x1f,0x2d,0x39,0x48,0x03,0x0c,0x67,0x0e,0xaf,0x32,0x94,0x2a,0x33,0x81,0x0c,0x02,0x4b,0x2b,0x0a,0x82,0x02,0x04,0x49,0x73,0x02,0x4b,0x4d,0x81,0x2d,
+ 0x16,0x02,0x24,0x62,0x2b,0x02,0x0a,0xc7,0x32,0x0e,0x02,0x4f,0x56,0x02,0x33,0x2d,0x98,0x44,0x02,0x44,0x1c,0x0e,0x48,0x61,0x81,0x98,0x02,0x2c,0x0a,0x28,
+ 0x82,0x00,0x19,0x08,0x1b,0x03,0x09,0x00,0x09,0x43,0x1b,0x03,0x17,0x49,0x1c,0x17,0x03,0x89,0x0e,0x85,0x7e,0xf9,0x4b,0x9c,0x27,0x26,0xa5,0x13,0x12,0x82,
+ 0x02,0x00,0x4c,0x82,0x00,0x0d,0x18,0x11,0x0c,0x08,0x43,0x11,0x03,0x43,0x08,0x41,0x03,0x00,0x0c,0x03,0x81,0x0c,0x02,0x11,0xa7,0x3d,0x81,0x0b,0x81,0x01,
+ 0x81,0x0b,0x03,0x01,0x05,0x5b,0x1c,0x86,0x02,0x03,0x0a,0x15,0x67,0x4e,0x85,0x0b,0x08,0x01,0x6e,0x29,0x09,0x03,0x09,0x14,0x03,0x09,0x83,0x00,0x06,0x09,
+ 0x03,0x09,0x27,0x17,0x03,0x26,0x83,0x00,0x01,0x1d,0x39,0x81,0x1f,0x02,0x21,0x0e,0x7d,0x8a,0x00,0x0a,0x26,0x03,0x3c,0x08,0x00,0x41,0x03,0xab,0x13,0x1d,
+ 0x0f,0x81,0x02,0x00,0xcc,0x91,0x00,0x02,0x3e,0x0a,0x21,0x81,0x24,0x81,0x36,0x81,0x00,0x02,0x98,0x0e,0xba,0x82,0x02,0x08,0x61,0x00,0x26,0x03,0x7a,0x5a,
+ 0x55,0x11,0x4a,0x81,0x00,0x0e,0x0e,0x99,0x6f,0xa1,0x57,0x0a,0x17,0x03,0x91,0x0a,0x21,0xb4,0xcc,0xca,0x33,0x81,0x0c,0x02,0x4b,0x77,0x24,0x82,0x02,0x1b,
+ 0x49,0x73,0x02,0x30,0x12,0x02,0x2d,0x13,0x24,0x62,0x2b,0x0e,0x4d,0xb3,0x57,0x33,0x02,0x4f,0x56,0x02,0x2d,0x0e,0x02,0xce,0x02,0x44,0x1c,0x0e,0x81,0x24,
+ 0x04,0x02,0xa1,0x5a,0x0a,0x28,0x83,0x00,0x05,0x08,0x1b,0x03,0x09,0x00,0x09,0x82,0x03,0x81,0x17,0x81,0x03,0x04,0x89,0xdc,0x6b,0x06,0xc9,0x81,0x9c,0x04,
+ 0x27,0x26,0xa5,0xba,0x44,0x82,0x02,0x00,0x4c,0x82,0x00,0x04,0x18,0x03,0xab,0x53,0xce,0x81,0xa5,0x0d,0xce,0x57,0x65,0xa5,0x57,0xb4,0xa5,0xb4,0xa3,0x17,
+ 0xa7,0x3d,0x01,0x0b,0x81,0x01,0x00,0x0b,0x81,0x01,0x02,0x05,0x5b,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x07,0x84,0x0d,0x08,0x0b,0x42,0x62,0x09,0xa4,
+ 0x8d,0x7b,0xbe,0x8d,0x83,0x7b,0x07,0xe2,0xbe,0x7b,0xe2,0xbe,0x8d,0x64,0x29,0x82,0x00,0x06,0x1d,0x33,0x4c,0x24,0x77,0x0f,0x7d,0x8b,0x00,0x02,0x4a,0x03,
+ 0x3c,0x81,0x08,0x02,0x41,0xbc,0x13,0x83,0x02,0x00,0xcc,0x91,0x00,0x01,0x3e,0x48,0x81,0x23,0x02,0x24,0x33,0x36,0x81,0x00,0x00,0x98,0x84,0x02,0x08,0x61,
+ 0x00,0x0c,0x11,0x08,0x44,0x4f,0x03,0x3f,0x81,0x00,0x0e,0x0f,0x2a,0x56,0x1f,0x5a,0x13,0x27,0x43,0xd5,0x0f,0x2a,0x4b,0x1f,0x4b,0x33,0x81,0x0c,0x00,0x4b,
+ 0x84,0x02,0x22,0x49,0x73,0x02,0xba,0x1d,0x02,0x44,0x02,0x24,0x62,0x2b,0x13,0x2d,0x02,0x4b,0x36,0x02,0x4f,0x56,0x02,0x33,0x12,0x13,0x36,0x02,0x44,0x1c,
+ 0x0e,0x0a,0x36,0x02,0x77,0x12,0x0a,0x28,0x84,0x00,0x05,0x08,0x1b,0x03,0x09,0x00,0x09,0x85,0x03,0x09,0x89,0x0e,0xaf,0x94,0x60,0x32,0x9c,0x27,0x26,0xa5,
+ 0x84,0x02,0x00,0x4c,0x82,0x00,0x02,0x18,0xa4,0x33,0x81,0x02,0x07,0x0e,0x60,0xc9,0x02,0x1d,0x60,0x0f,0x2c,0x81,0x02,0x04,0x0f,0x8d,0xa7,0x3d,0x07,0x84,
+ 0x63,0x03,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x8f,0x82,0xb9,0x07,0xf3,0x0b,0x42,0x62,0x0c,0xc6,0x0f,0x0e,0x82,0x0f,0x00,0x0e,
+ 0x84,0x0f,0x00,0x0e,0x82,0x0f,0x01,0xef,0x7b,0x81,0x00,0x01,0x1d,0x24,0x81,0x57,0x02,0x6a,0x0e,0x7d,0x8c,0x00,0x02,0x4a,0x03,0x3c,0x81,0x08,0x06,0xd5,
+ 0x0a,0xa5,0x48,0x2b,0x33,0xcc,0x91,0x00,0x01,0x3e,0x13,0x81,0x21,0x02,0x2a,0x1f,0x36,0x81,0x00,0x02,0x98,0xef,0x33,0x81,0x12,0x05,0x32,0x61,0x00,0x14,
+ 0x17,0x43,0x82,0x03,0x00,0x27,0x81,0x00,0x01,0x0f,0x5a,0x81,0x53,0x35,0x1d,0x13,0x00,0x18,0xdd,0x0a,0xce,0x60,0x85,0x99,0x5a,0xab,0x29,0x4b,0x1f,0x0e,
+ 0x02,0x12,0x0f,0x49,0x73,0x02,0x4b,0x9a,0x6a,0x99,0x0f,0x24,0x62,0x2b,0x0f,0x4b,0x0f,0x32,0x13,0x02,0x4f,0x56,0x02,0x30,0xbf,0x53,0x99,0x02,0x44,0x1c,
+ 0x0e,0x12,0x65,0x53,0xa5,0x12,0x0a,0x28,0x85,0x00,0x0c,0x08,0x3c,0x03,0x09,0x00,0x09,0x17,0x3c,0x27,0x18,0x03,0x89,0x0e,0x81,0xe6,0x05,0x87,0xa1,0x30,
+ 0x9b,0x49,0xb4,0x81,0x12,0x00,0x02,0x81,0x0a,0x00,0x4c,0x82,0x00,0x01,0x18,0xa7,0x82,0x02,0x07,0x06,0x96,0x06,0xcc,0x9a,0x2a,0x76,0xb4,0x82,0x02,0x04,
+ 0x2c,0xaf,0x3d,0x1e,0xe7,0x81,0xae,0x05,0xe1,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x14,0xcf,0xf3,0x0b,0x42,
+ 0x62,0x58,0x0f,0x02,0x13,0xe5,0x0f,0x5a,0x6b,0x2a,0x02,0x6d,0x57,0x12,0xa7,0x65,0x0e,0x81,0x02,0x09,0x12,0x28,0x00,0x1d,0x0e,0x24,0xb6,0x4b,0x02,0x7d,
+ 0x8d,0x00,0x0a,0x4a,0x03,0x3c,0x08,0xec,0x0a,0x94,0x06,0x5f,0x57,0xcc,0x91,0x00,0x06,0x3e,0x0e,0x1d,0x96,0x89,0x24,0x36,0x81,0x00,0x06,0x98,0x32,0x44,
+ 0xb4,0x58,0x4b,0x61,0x81,0x00,0x04,0x18,0x17,0x03,0x3c,0x0c,0x82,0x00,0x05,0x8c,0x99,0x0e,0x8c,0x57,0x48,0x81,0x00,0x10,0x67,0x0a,0x65,0x0f,0xdc,0x99,
+ 0x24,0x5a,0x44,0x1d,0xbf,0x0a,0x53,0x57,0x13,0x49,0x73,0x81,0x02,0x1e,0x0e,0x56,0x0f,0x02,0x24,0x62,0x2b,0x0f,0x2d,0x8a,0x4c,0x1d,0x02,0x4f,0x56,0x02,
+ 0x0f,0x76,0x33,0x0f,0x02,0x33,0x81,0x0e,0x02,0x0f,0x39,0x0f,0x02,0x0a,0x28,0x86,0x00,0x03,0x08,0x3c,0x03,0x09,0x82,0x00,0x17,0x2d,0x5a,0x26,0x89,0x02,
+ 0x32,0x99,0x9c,0x48,0xc6,0x44,0x81,0xb4,0x36,0x1d,0x56,0x21,0x1d,0x4c,0x68,0x73,0x3a,0x18,0xb4,0x82,0x02,0x07,0x13,0xa5,0xe6,0x5a,0x30,0x02,0x0f,0x65,
+ 0x83,0x02,0x03,0x4b,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,
+ 0x0b,0x42,0xe2,0x12,0x81,0x02,0x0b,0x39,0x99,0x4b,0x2a,0xb8,0x0e,0x02,0x0f,0x02,0x1d,0xca,0xdc,0x82,0x02,0x09,0x0f,0xec,0x00,0x1d,0x77,0x3e,0x98,0x39,
+ 0x0f,0x7d,0x8e,0x00,0x09,0x4a,0x03,0x1b,0xa6,0x0e,0x33,0xb6,0x2c,0x1f,0xcc,0x91,0x00,0x0a,0x3e,0x13,0x89,0xaf,0x24,0x2b,0xb3,0x08,0x00,0x6b,0x0f,0x81,
+ 0x36,0x02,0x2b,0x0a,0x61,0x89,0x00,0x05,0x0f,0x39,0x0a,0x32,0x39,0x13,0x81,0x00,0x27,0x67,0x0f,0x85,0xb1,0x93,0x76,0x5a,0x4f,0x08,0x4b,0x60,0x73,0x21,
+ 0x65,0x13,0x49,0x58,0x02,0x1d,0x99,0x4c,0x21,0x0e,0x24,0x62,0x2b,0x0f,0x12,0x39,0x1d,0x0e,0x02,0x28,0x56,0x02,0x30,0x4c,0x6a,0x7e,0x02,0x81,0x12,0x07,
+ 0x0e,0x76,0x53,0x7b,0x53,0x32,0x0a,0x28,0x87,0x00,0x1d,0x14,0x17,0x11,0x17,0x3c,0x1b,0x08,0x3b,0x03,0x89,0x0a,0xbc,0xb1,0xa3,0x4b,0x9c,0x22,0x1b,0xa5,
+ 0x12,0x70,0x65,0x39,0x1f,0x4c,0x28,0xba,0x29,0x18,0x93,0x82,0x02,0x0f,0xf2,0xc6,0x85,0xc6,0xa5,0x6c,0x32,0xaf,0xc7,0x2c,0x02,0x12,0xaf,0x3d,0x1e,0xd7,
+ 0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9d,0x82,0xd7,0x04,0xf4,0x0b,0x42,0x15,0x5a,0x81,0x02,0x05,0x93,
+ 0x12,0xb4,0x12,0x81,0xdc,0x82,0x02,0x02,0x0e,0xfa,0x33,0x82,0x02,0x09,0x13,0xa6,0x00,0x1d,0x24,0x2a,0xc5,0x2a,0x0f,0x7d,0x8f,0x00,0x02,0x3f,0x03,0xc1,
+ 0x81,0x13,0x03,0xcc,0xe6,0x2a,0x1d,0x91,0x1b,0x01,0x8d,0x13,0x81,0x65,0x0b,0x82,0x4b,0x6c,0x17,0x1b,0x94,0x0f,0x12,0x06,0x94,0x76,0x58,0x89,0x1b,0x01,
+ 0x0f,0x24,0x81,0x30,0x01,0x4b,0x13,0x81,0x1b,0x06,0xe5,0x13,0x99,0xa1,0x2c,0x0f,0x33,0x81,0x03,0x12,0x4b,0x02,0x0f,0x2b,0x24,0x0f,0xd5,0xff,0x02,0x12,
+ 0x65,0xa5,0xc6,0x02,0xa1,0x9f,0x12,0x0e,0x39,0x81,0x57,0x13,0x1f,0x02,0x66,0x4c,0x02,0xc6,0x1f,0x0e,0x33,0x02,0x21,0x91,0x0e,0x2c,0x76,0x0f,0x0a,0x2b,
+ 0x2c,0x66,0x88,0x1b,0x81,0x03,0x81,0x11,0x01,0x03,0x11,0x81,0x03,0x02,0x89,0x0e,0xca,0x81,0x96,0x04,0xc9,0x9c,0x03,0x11,0xa5,0x81,0x02,0x03,0x13,0x1d,
+ 0x48,0x4c,0x82,0x00,0x02,0x18,0x1b,0x36,0x81,0x02,0x0f,0x0e,0x6c,0x33,0x0e,0xc7,0x30,0x0f,0xb8,0x6c,0xef,0x0f,0x8d,0xb1,0x3d,0x1e,0xb7,0x81,0xac,0x05,
+ 0xfd,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x16,0x83,0x38,0x0c,0x1e,0x0b,0x42,0x62,0x55,0x0a,0x0f,0x9c,0x0f,0x33,0x1d,0x99,0x24,
+ 0x82,0x02,0x02,0x48,0x9a,0x6d,0x82,0x02,0x09,0x2a,0x3a,0x00,0x1d,0x39,0x1f,0x2b,0x39,0x0e,0x7d,0x90,0x00,0x07,0x3f,0xbc,0x48,0xbf,0x65,0x1d,0x0f,0x1d,
+ 0x91,0x17,0x06,0x91,0x2c,0xfa,0x50,0x57,0x36,0x6c,0x81,0x17,0x06,0x6a,0xef,0xbe,0xb6,0x2b,0x02,0x74,0x89,0x17,0x01,0x0e,0xa5,0x81,0xb3,0x01,0xc7,0x13,
+ 0x81,0x17,0x06,0xdd,0x0f,0xc9,0xaf,0xfa,0x6c,0x33,0x81,0x17,0x10,0x4b,0xc7,0x94,0xca,0x30,0x0f,0xb2,0xa7,0x02,0x9c,0x9a,0x9c,0x85,0x0e,0xa1,0x95,0x12,
+ 0x81,0x02,0x15,0x0f,0x21,0x0e,0x02,0x0c,0xbf,0x02,0xa3,0xaf,0x12,0xfa,0x02,0xca,0xb2,0x0e,0x04,0xc9,0x57,0x65,0xc6,0x2c,0x26,0x90,0x17,0x06,0x25,0x2c,
+ 0xbf,0x12,0x60,0xc6,0x30,0x81,0x17,0x06,0x65,0x12,0xce,0x21,0x77,0x0e,0x4c,0x82,0x00,0x03,0x18,0x11,0x08,0x53,0x82,0xe6,0x0d,0xb4,0x39,0x9a,0xe6,0xb6,
+ 0x57,0xe6,0x57,0xa3,0x17,0xb1,0x3d,0x16,0x1a,0x82,0x63,0x04,0x1a,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x84,0x01,0x05,0x0b,0x01,0x42,
+ 0x62,0x09,0xbb,0x87,0x4b,0x08,0xc7,0x24,0x4b,0x24,0xc7,0x4b,0xdf,0x2d,0x68,0x81,0x00,0x06,0x1d,0x24,0x4c,0x57,0x2d,0x0f,0x7d,0x91,0x00,0x06,0x5b,0x13,
+ 0x2c,0xb8,0x6b,0x33,0xcc,0x91,0x08,0x03,0x3e,0x13,0x65,0x2b,0x81,0x33,0x00,0x36,0x81,0x08,0x06,0x4d,0x0f,0x1d,0x44,0x98,0x0a,0x61,0x89,0x08,0x01,0x8c,
+ 0x6d,0x82,0x02,0x09,0x13,0x00,0x08,0x67,0x0e,0x21,0x65,0x30,0x2b,0x24,0x81,0x08,0x11,0x1d,0x24,0x53,0x2a,0x24,0x0f,0x91,0x58,0x02,0x60,0x57,0xa3,0x61,
+ 0x0f,0x24,0x29,0x2b,0x0f,0x81,0x2a,0x14,0x6a,0xb8,0x02,0x28,0x56,0x02,0xd2,0x12,0x82,0xb4,0x02,0x44,0x49,0x0e,0x2b,0x61,0x4d,0x2a,0xba,0x0a,0x28,0x90,
+ 0x08,0x06,0x74,0x8c,0x6a,0x57,0x4d,0x1f,0xc6,0x81,0x08,0x06,0x39,0x12,0xb1,0x99,0x36,0x0e,0x4c,0x82,0x00,0x04,0x18,0x03,0x0c,0x08,0x43,0x81,0x03,0x06,
+ 0x43,0x08,0x41,0x03,0x00,0x0c,0x03,0x81,0x0c,0x02,0x03,0xff,0x2e,0x85,0x01,0x03,0x0b,0xa0,0x28,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x0b,0x82,0x01,
+ 0x82,0x0b,0x04,0x42,0x62,0x09,0x03,0x7a,0x86,0x3b,0x06,0x95,0x22,0x7a,0xd6,0x26,0x3b,0x3a,0x83,0x00,0x01,0x1d,0x02,0x81,0x2b,0x02,0x0e,0x02,0x7d,0x91,
+ 0x00,0x01,0xec,0x13,0x82,0x02,0x01,0x0f,0x1d,0x91,0x26,0x06,0x64,0x0f,0x4b,0x6d,0x36,0x0e,0x77,0x81,0x26,0x00,0x4c,0x82,0x02,0x81,0x0f,0x00,0x70,0x89,
+ 0x26,0x01,0x0f,0x0e,0x82,0x02,0x05,0x13,0x0c,0x26,0x91,0x0f,0x48,0x82,0x02,0x00,0xa1,0x81,0x26,0x00,0x1d,0x81,0x02,0x04,0x48,0x1d,0x0f,0xe5,0x74,0x81,
+ 0x02,0x07,0x0e,0x13,0x0f,0x02,0x24,0xc1,0x12,0x02,0x82,0x0a,0x06,0x0e,0x02,0xab,0x6b,0x02,0x0f,0x02,0x81,0x0f,0x06,0x02,0x21,0x15,0x0e,0x02,0x8c,0x0f,
+ 0x81,0x02,0x01,0x2c,0xab,0x90,0x26,0x06,0x71,0x02,0x0e,0x12,0x0a,0x02,0x36,0x81,0x26,0x00,0x82,0x81,0x02,0x03,0x0e,0x1d,0x48,0x4c,0x82,0x00,0x0d,0x18,
+ 0x03,0x0c,0x08,0x43,0x11,0x03,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,0x81,0x0c,0x02,0x11,0x08,0x80,0x86,0x01,0x02,0xc3,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,
+ 0x51,0x46,0x0b,0x84,0x1e,0x05,0x0b,0x42,0x62,0x09,0x03,0x14,0x86,0x00,0x04,0x41,0x17,0x27,0x03,0x22,0x85,0x00,0x01,0x53,0x0f,0x82,0x02,0x01,0x24,0x28,
+ 0x91,0x00,0x02,0x68,0x57,0x0f,0x81,0x02,0x05,0x0e,0x93,0x03,0x11,0x03,0x11,0x84,0x03,0x82,0x11,0x81,0x03,0x01,0x11,0x03,0x81,0x11,0x01,0xdd,0x0e,0x83,
+ 0x02,0x00,0xb6,0x81,0x03,0x01,0xc1,0xc7,0x82,0x02,0x02,0x32,0xab,0x11,0x83,0x03,0x02,0x11,0x03,0x11,0x81,0x03,0x00,0xc4,0x83,0x02,0x00,0xca,0x81,0x03,
+ 0x01,0x26,0x4b,0x82,0x02,0x01,0x0e,0x94,0x81,0x11,0x00,0x06,0x83,0x02,0x03,0x13,0x9f,0xa4,0xc6,0x83,0x02,0x04,0x2c,0xe3,0x03,0x94,0x0f,0x83,0x02,0x03,
+ 0xc5,0x1b,0xc3,0x60,0x83,0x02,0x04,0x1d,0xc1,0x03,0x93,0x0e,0x82,0x02,0x01,0x0a,0xa7,0x81,0x03,0x81,0x11,0x07,0x03,0x11,0x03,0x11,0x03,0x11,0x03,0x11,
+ 0x81,0x03,0x81,0x11,0x03,0x03,0x11,0xbc,0x1f,0x82,0x02,0x05,0x13,0x8d,0x03,0x11,0xfa,0x0f,0x82,0x02,0x01,0x8c,0x74,0x82,0x00,0x04,0x18,0x03,0x0c,0x08,
+ 0x43,0x81,0x03,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x03,0x81,0x0c,0x01,0x03,0x0c,0x81,0x08,0x05,0xab,0x64,0x8a,0x70,0x5b,0x08,0x81,0x00,0x00,0x1c,0x86,
+ 0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x9e,0x82,0xe7,0x05,0xf4,0x0b,0x42,0x62,0x09,0x94,0x87,0x60,0x81,0x33,0x02,0x60,0x6d,0xbd,0x86,0x00,0x04,0xe2,0x1d,
+ 0x13,0x61,0x3a,0x93,0x00,0x05,0x3c,0xbe,0x12,0xc7,0xc1,0x4a,0x91,0x0c,0x06,0x18,0x3e,0x12,0x02,0x0e,0x82,0x7a,0x81,0x0c,0x05,0x26,0x1b,0x4c,0x13,0xca,
+ 0x17,0x85,0x03,0x02,0x11,0x03,0x11,0x82,0x03,0x04,0x89,0x12,0x76,0xbe,0x03,0x81,0x11,0x05,0x03,0x1b,0x85,0x0e,0x1f,0xbe,0x83,0x03,0x0c,0xe6,0x0e,0x0f,
+ 0x33,0xc3,0x03,0x11,0x43,0x58,0x48,0x0f,0x30,0xab,0x82,0x09,0x04,0xbd,0x32,0x02,0x0a,0x8a,0x82,0x09,0x01,0xa2,0xa3,0x81,0x0e,0x01,0x39,0x18,0x81,0x0c,
+ 0x05,0x18,0x15,0x1d,0x0f,0x5a,0x28,0x93,0x0c,0x04,0x08,0x21,0x0e,0x24,0x91,0x81,0x0c,0x06,0x26,0x03,0xc0,0xdc,0x02,0x1f,0x8d,0x82,0x00,0x05,0x67,0x7b,
+ 0x17,0x0c,0x08,0x43,0x81,0x11,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x81,0x00,0x04,0x62,0x39,0x33,0x6d,0x29,0x82,0x00,0x00,
+ 0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x10,0xcf,0xf3,0x0b,0x42,0x62,0x64,0x13,0x0e,0x1f,0x8c,0x1d,0x32,0xb3,0x5a,0x1d,0x6d,0x60,
+ 0x82,0x02,0x00,0x73,0x82,0x00,0x01,0xa6,0x58,0x81,0x5f,0x01,0x6a,0x65,0x94,0x5f,0x00,0x74,0x81,0xc0,0x03,0xbf,0xff,0x7d,0xb1,0x93,0x5f,0x02,0x85,0xc9,
+ 0x21,0x83,0x5f,0x04,0x74,0x89,0xff,0x85,0xc0,0x8d,0x89,0x01,0xfa,0xb1,0x86,0x89,0x01,0x7e,0x93,0x84,0x89,0x03,0x7d,0xb6,0x33,0xff,0x82,0x89,0x03,0x71,
+ 0x5f,0x6b,0x9c,0x82,0x5f,0x00,0x74,0x81,0x5f,0x02,0x53,0x24,0x4c,0x82,0x5f,0x81,0x74,0x02,0xc0,0xe6,0x9a,0x86,0x5f,0x00,0x9c,0x97,0x5f,0x01,0x9a,0x6a,
+ 0x81,0x5f,0x10,0x74,0x28,0x22,0x03,0xab,0x36,0x93,0xc0,0x5f,0x74,0x68,0x28,0x2a,0x99,0x6b,0x08,0x43,0x81,0x03,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,
+ 0x81,0x0c,0x01,0x03,0x0c,0x82,0x4f,0x03,0x39,0x74,0x39,0x51,0x82,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x10,0xcf,0xf3,
+ 0x0b,0x42,0x91,0x6f,0x02,0x0f,0x74,0x53,0x44,0x4c,0x32,0x4d,0x4c,0x32,0x30,0x82,0x02,0x00,0x12,0x82,0x00,0x01,0x3e,0xaf,0x86,0x31,0x81,0x78,0x85,0x31,
+ 0x81,0x78,0x86,0x31,0x00,0x64,0x86,0x31,0x81,0x78,0x85,0x31,0x01,0x78,0x64,0x86,0x31,0x81,0x78,0x85,0x31,0x81,0x78,0x86,0x31,0x00,0x72,0x86,0x31,0x81,
+ 0x72,0x86,0x31,0x00,0x72,0x86,0x31,0x00,0x72,0x87,0x31,0x00,0xe3,0x86,0x31,0x00,0x72,0x86,0x31,0x81,0x72,0x85,0x31,0x81,0x78,0x86,0x31,0x81,0x78,0x85,
+ 0x31,0x81,0x78,0x86,0x31,0x81,0x78,0x85,0x31,0x81,0x6e,0x81,0x01,0x01,0x59,0x3d,0x82,0x31,0x07,0x75,0x4f,0x55,0xbd,0xb2,0xe2,0x08,0x43,0x81,0x03,0x06,
+ 0x43,0x08,0x41,0x03,0x00,0x0c,0x03,0x81,0x0c,0x08,0x03,0x0c,0x4d,0x1d,0x56,0x73,0x53,0x44,0x49,0x82,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,
+ 0x07,0x8f,0x82,0xb9,0x04,0xf3,0x0b,0x42,0x7d,0x0e,0x81,0x02,0x08,0x4d,0x6d,0x1d,0x39,0x0e,0x98,0x1d,0x65,0xc4,0x82,0x02,0x00,0x48,0x82,0x00,0x01,0xc3,
+ 0x7c,0xff,0x01,0xa6,0x01,0x07,0x54,0x7a,0x3e,0x33,0x57,0x6c,0x29,0x43,0x81,0x03,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,0x81,0x0c,0x04,0x03,0x0c,0x28,
+ 0x49,0x29,0x81,0x00,0x00,0x3b,0x83,0x00,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xf5,0x82,0x9e,0x04,0x35,0x0b,0x42,0x5b,0xaa,0x81,0x02,0x08,
+ 0xb8,0xa3,0x0f,0x39,0x21,0x61,0x6d,0xb6,0x93,0x82,0x02,0x00,0x5a,0x82,0x00,0x02,0xed,0x01,0x0b,0x84,0x1e,0x82,0x01,0x00,0x07,0x83,0x1e,0x00,0x16,0x81,
+ 0x01,0x00,0x16,0x83,0x1e,0x00,0x07,0x81,0x01,0x01,0x0b,0x07,0x83,0x1e,0x00,0x0b,0x81,0x01,0x00,0x16,0x83,0x1e,0x00,0x07,0x81,0x01,0x00,0x0b,0x84,0x1e,
+ 0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x1e,0x00,0x16,0x81,0x01,0x00,0x0b,0x84,0x1e,0x81,0x01,0x01,0x0b,0x07,0x83,0x1e,0x00,0x0b,0x81,0x01,0x00,0x16,0x83,
+ 0x1e,0x00,0x07,0x81,0x01,0x01,0x0b,0x07,0x83,0x1e,0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x1e,0x00,0x16,0x81,0x01,0x00,0x0b,0x84,0x1e,0x00,0x0b,0x81,0x01,
+ 0x00,0x07,0x83,0x1e,0x00,0x16,0x81,0x01,0x00,0x16,0x83,0x1e,0x00,0x07,0x81,0x01,0x00,0x0b,0x84,0x1e,0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x1e,0x00,0x07,
+ 0x81,0x01,0x00,0x0b,0x84,0x1e,0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x1e,0x00,0x16,0x81,0x01,0x00,0x0b,0x83,0x1e,0x00,0x07,0x81,0x01,0x06,0x66,0x15,0x49,
+ 0x11,0x0c,0x08,0x43,0x81,0x03,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,0x81,0x0c,0x01,0x03,0x0c,0x89,0x00,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,
+ 0x86,0x0b,0x0d,0x42,0x62,0xc1,0x1f,0x02,0x0f,0x48,0x02,0x0f,0x2b,0x48,0x0e,0x12,0x13,0x81,0x02,0x01,0x12,0x49,0x82,0x00,0x03,0xed,0x01,0x16,0xf3,0x82,
+ 0x8f,0x01,0xd0,0x0b,0x81,0x01,0x01,0x35,0xb7,0x81,0x8f,0x01,0x9d,0x38,0x81,0x01,0x01,0x1e,0x9e,0x81,0x8f,0x01,0xb7,0xf4,0x81,0x01,0x01,0x0b,0xf5,0x82,
+ 0x8f,0x01,0xf3,0x1e,0x81,0x01,0x01,0x1a,0x9d,0x81,0x8f,0x01,0x9d,0x63,0x81,0x01,0x01,0x16,0xf4,0x82,0x8f,0x01,0xf3,0x16,0x81,0x01,0x01,0x63,0xb7,0x81,
+ 0x8f,0x01,0x9d,0x38,0x81,0x01,0x01,0x07,0x9e,0x82,0x8f,0x00,0xd0,0x81,0x01,0x01,0x0b,0xf4,0x82,0x8f,0x01,0x9e,0x1e,0x81,0x01,0x01,0x1a,0x9e,0x81,0x8f,
+ 0x01,0xb7,0xf4,0x81,0x01,0x01,0x0b,0xf5,0x82,0x8f,0x01,0xf3,0x07,0x81,0x01,0x01,0x1a,0xd1,0x81,0x8f,0x01,0x9d,0x63,0x81,0x01,0x01,0x07,0xf5,0x82,0x8f,
+ 0x01,0xf5,0x0b,0x81,0x01,0x01,0x35,0xb7,0x81,0x8f,0x01,0x9d,0x1e,0x81,0x01,0x01,0x1e,0x9e,0x82,0x8f,0x00,0x0d,0x81,0x01,0x01,0x0b,0xf5,0x82,0x8f,0x01,
+ 0xf3,0x07,0x81,0x01,0x01,0x1a,0x9d,0x81,0x8f,0x01,0xd1,0x1a,0x81,0x01,0x01,0x16,0xf3,0x82,0x8f,0x01,0xf5,0x16,0x81,0x01,0x01,0x63,0xb7,0x81,0x8f,0x01,
+ 0x9d,0x1a,0x81,0x01,0x01,0x07,0x9e,0x82,0x8f,0x09,0xf4,0x0b,0x01,0x66,0x00,0x18,0x03,0x0c,0x08,0x43,0x81,0x03,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,
+ 0x81,0x0c,0x01,0x03,0x62,0x83,0x67,0x00,0x5b,0x82,0x08,0x81,0x00,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x84,0x01,0x06,0x0b,0x01,0x42,0x62,0x09,
+ 0xc3,0x70,0x86,0x53,0x04,0xb1,0xbb,0x70,0x89,0x40,0x83,0x00,0x04,0xed,0x01,0x16,0x8f,0x34,0x81,0x2f,0x01,0xf4,0x0b,0x81,0x01,0x01,0x35,0xae,0x81,0x34,
+ 0x01,0x86,0x38,0x81,0x01,0x05,0x1e,0xd7,0x2f,0x34,0xb9,0xf3,0x81,0x01,0x02,0x0b,0x9e,0xb0,0x81,0x2f,0x01,0x8f,0x1e,0x81,0x01,0x05,0x1a,0xfd,0x2f,0x34,
+ 0xac,0x63,0x81,0x01,0x06,0x16,0x9e,0x2f,0x34,0x2f,0x9d,0x16,0x81,0x01,0x01,0x63,0xc8,0x81,0x34,0x01,0xfd,0x38,0x81,0x01,0x05,0x07,0xd7,0x2f,0x34,0x97,
+ 0xd0,0x81,0x01,0x02,0x0b,0xf6,0xb0,0x81,0x34,0x01,0xd7,0x1e,0x81,0x01,0x01,0x1a,0xea,0x81,0x34,0x01,0xc8,0xf5,0x81,0x01,0x06,0x0b,0x9d,0xcf,0x34,0x2f,
+ 0xd1,0x07,0x81,0x01,0x05,0x1a,0xae,0x2f,0x34,0x86,0x63,0x81,0x01,0x06,0x07,0x9d,0x2f,0x34,0x97,0x9d,0x0b,0x81,0x01,0x05,0x35,0xb9,0x2f,0x34,0xe8,0x1e,
+ 0x81,0x01,0x01,0x1e,0xea,0x81,0x34,0x01,0xa9,0x0d,0x81,0x01,0x06,0x0b,0x9e,0xcf,0x2f,0x34,0xd1,0x07,0x81,0x01,0x05,0x1a,0x86,0x2f,0x34,0xae,0x1a,0x81,
+ 0x01,0x06,0x16,0x9d,0x97,0x34,0xcf,0x9d,0x16,0x81,0x01,0x01,0x1a,0xc8,0x81,0x34,0x01,0xe8,0x1a,0x81,0x01,0x0e,0x07,0xe7,0x34,0x2f,0xcf,0xf6,0x0b,0x01,
+ 0x66,0x00,0x18,0x11,0x0c,0x08,0x43,0x81,0x11,0x06,0x43,0x08,0x41,0x03,0x00,0x0c,0x11,0x81,0x0c,0x02,0x11,0xff,0x72,0x82,0x80,0x00,0x45,0x82,0x01,0x02,
+ 0x9f,0x00,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x46,0x86,0x0b,0x04,0x42,0x62,0x09,0x03,0x14,0x86,0x00,0x04,0x41,0x17,0x27,0x03,0x22,0x83,0x00,0x03,0xed,
+ 0x01,0x16,0x8f,0x81,0x34,0x02,0x2f,0xf4,0x0b,0x81,0x01,0x05,0x35,0xae,0x2f,0x34,0x86,0x38,0x81,0x01,0x05,0x1e,0xd7,0x34,0x2f,0xb9,0xf3,0x81,0x01,0x06,
+ 0x0b,0x9e,0xb0,0x34,0x2f,0x8f,0x1e,0x81,0x01,0x05,0x1a,0xfd,0x34,0x2f,0xac,0x63,0x81,0x01,0x01,0x16,0x9e,0x82,0x2f,0x01,0x9d,0x16,0x81,0x01,0x05,0x63,
+ 0xc8,0x34,0x2f,0xfd,0x38,0x81,0x01,0x05,0x07,0xd7,0x2f,0x34,0x97,0xd0,0x81,0x01,0x06,0x0b,0xf6,0xb0,0x34,0x2f,0xd7,0x1e,0x81,0x01,0x05,0x1a,0xea,0x2f,
+ 0x34,0xc8,0xf5,0x81,0x01,0x06,0x0b,0x9d,0xcf,0x34,0x2f,0xd1,0x07,0x81,0x01,0x01,0x1a,0xae,0x81,0x34,0x01,0x86,0x63,0x81,0x01,0x06,0x07,0x9d,0x34,0x2f,
+ 0x97,0x9d,0x0b,0x81,0x01,0x05,0x35,0xb9,0x34,0x2f,0xe8,0x1e,0x81,0x01,0x05,0x1e,0xea,0x2f,0x34,0xa9,0x0d,0x81,0x01,0x02,0x0b,0x9e,0xcf,0x81,0x34,0x01,
+ 0xd1,0x07,0x81,0x01,0x01,0x1a,0x86,0x81,0x2f,0x01,0xae,0x1a,0x81,0x01,0x06,0x16,0x9d,0x97,0x2f,0xcf,0x9d,0x16,0x81,0x01,0x05,0x1a,0xc8,0x2f,0x34,0xe8,
+ 0x1a,0x81,0x01,0x01,0x07,0xe7,0x81,0x34,0x09,0xcf,0xf6,0x0b,0x01,0x66,0x00,0x18,0x03,0xe5,0x61,0x83,0xa3,0x0a,0x4d,0x6a,0xa3,0x4d,0x4c,0xa3,0x61,0xe5,
+ 0x03,0xa7,0x3d,0x81,0x01,0x00,0x0b,0x81,0x01,0x04,0x0b,0x01,0x95,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x16,0xf4,0x81,0xf3,0x07,0xf5,0xf4,0x0b,
+ 0x42,0x62,0x09,0xd6,0x4f,0x86,0xa6,0x04,0xc1,0x40,0x5b,0x0c,0x26,0x83,0x00,0x03,0xed,0x01,0x16,0xb7,0x82,0xa9,0x01,0xf4,0x0b,0x81,0x01,0x01,0x35,0xae,
+ 0x81,0xa9,0x01,0xe8,0x38,0x81,0x01,0x01,0x1e,0xe7,0x81,0xa9,0x01,0xc8,0xf5,0x81,0x01,0x06,0x0b,0x9e,0xc8,0xa9,0xb0,0xb7,0x1e,0x81,0x01,0x01,0x1a,0x86,
+ 0x81,0xa9,0x01,0xfd,0x63,0x81,0x01,0x02,0x16,0x9e,0xb0,0x81,0xa9,0x01,0x9d,0x16,0x81,0x01,0x01,0x63,0xae,0x81,0xa9,0x01,0x86,0x38,0x81,0x01,0x01,0x07,
+ 0xe7,0x81,0xa9,0x01,0xb9,0xd0,0x81,0x01,0x02,0x0b,0xf6,0xc8,0x81,0xa9,0x01,0xe7,0x1e,0x81,0x01,0x01,0x1a,0xd7,0x81,0xa9,0x01,0xae,0xf5,0x81,0x01,0x06,
+ 0x0b,0x9d,0xb9,0xa9,0xb9,0xd1,0x07,0x81,0x01,0x01,0x1a,0xac,0x81,0xa9,0x01,0x86,0x63,0x81,0x01,0x01,0x07,0x9d,0x81,0xa9,0x02,0xb9,0x9e,0x0b,0x81,0x01,
+ 0x01,0x35,0xc8,0x81,0xa9,0x01,0xea,0x1e,0x81,0x01,0x01,0x1e,0xd7,0x81,0xa9,0x01,0xb9,0x0d,0x81,0x01,0x02,0x0b,0x9e,0xb9,0x81,0xa9,0x01,0x9d,0x07,0x81,
+ 0x01,0x01,0x1a,0xe8,0x81,0xa9,0x01,0xac,0x1a,0x81,0x01,0x06,0x16,0x9d,0xb9,0xa9,0xb9,0x9d,0x16,0x81,0x01,0x01,0x1a,0xae,0x81,0xa9,0x01,0xea,0x1a,0x81,
+ 0x01,0x01,0x07,0xe7,0x81,0xa9,0x08,0xb9,0xf6,0x0b,0x01,0x66,0x00,0x0c,0xbe,0x0a,0x81,0x02,0x0e,0x0a,0x1d,0x0a,0x12,0x0f,0x2c,0x2b,0xba,0x13,0x02,0xc7,
+ 0xa4,0xa7,0x3d,0x16,0x83,0x63,0x04,0x1a,0x0b,0x95,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0x8f,0x81,0xb9,0x07,0xc8,0xf3,0x0b,0x42,0x28,0x40,
+ 0x06,0x02,0x81,0x0e,0x0a,0x0f,0x0e,0x13,0x02,0x8c,0x0a,0x0f,0x02,0x0e,0x06,0xd9,0x82,0x00,0x03,0xed,0x01,0x16,0x35,0x82,0x9e,0x01,0x0d,0x0b,0x81,0x01,
+ 0x00,0x63,0x82,0x9e,0x01,0xf6,0x1e,0x81,0x01,0x01,0x1e,0xf5,0x82,0x9e,0x00,0x63,0x81,0x01,0x02,0x0b,0x35,0xf6,0x81,0x9e,0x01,0xf5,0x07,0x81,0x01,0x01,
+ 0x38,0xf5,0x81,0x9e,0x01,0xf6,0x1a,0x81,0x01,0x01,0x16,0xf4,0x82,0x9e,0x01,0xf4,0x16,0x81,0x01,0x01,0x1a,0xf6,0x81,0x9e,0x01,0xf6,0x38,0x81,0x01,0x01,
+ 0x07,0xf4,0x82,0x9e,0x00,0x0d,0x81,0x01,0x01,0x0b,0x35,0x82,0x9e,0x01,0xf4,0x07,0x81,0x01,0x01,0x38,0xf5,0x82,0x9e,0x00,0x1a,0x81,0x01,0x01,0x0b,0xf4,
+ 0x82,0x9e,0x01,0xf5,0x16,0x81,0x01,0x01,0x1a,0xf5,0x81,0x9e,0x01,0xf6,0x1a,0x81,0x01,0x01,0x16,0xf4,0x82,0x9e,0x01,0xf4,0x0b,0x81,0x01,0x01,0x63,0xf6,
+ 0x81,0x9e,0x01,0xf3,0x1e,0x81,0x01,0x01,0x1e,0xf5,0x82,0x9e,0x00,0x35,0x81,0x01,0x01,0x0b,0x35,0x82,0x9e,0x01,0xf4,0x16,0x81,0x01,0x01,0x38,0xf6,0x82,
+ 0x9e,0x00,0x1a,0x81,0x01,0x01,0x16,0xf4,0x82,0x9e,0x01,0xf4,0x16,0x81,0x01,0x01,0x1a,0xf3,0x81,0x9e,0x01,0xf6,0x38,0x81,0x01,0x01,0x07,0xf4,0x82,0x9e,
+ 0x06,0x35,0x0b,0x01,0x66,0x18,0x22,0x1d,0x82,0x02,0x0f,0xbb,0xc5,0x50,0x51,0x30,0x5c,0x98,0x44,0x93,0x8c,0x02,0x94,0xa7,0x3d,0x1e,0xb7,0x81,0xe8,0x05,
+ 0xea,0xa8,0x0b,0xde,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x0a,0xcf,0xf3,0x0b,0x42,0x62,0xa3,0x0f,0x0e,0x30,0x65,0x24,0x81,
+ 0x21,0x03,0x6f,0x39,0x96,0x9a,0x82,0x02,0x00,0x44,0x82,0x00,0x00,0xed,0x81,0x01,0x84,0x0b,0x82,0x01,0x85,0x0b,0x81,0x01,0x85,0x0b,0x82,0x01,0x85,0x0b,
+ 0x81,0x01,0x85,0x0b,0x82,0x01,0x84,0x0b,0x82,0x01,0x85,0x0b,0x81,0x01,0x85,0x0b,0x82,0x01,0x85,0x0b,0x81,0x01,0x85,0x0b,0x82,0x01,0x84,0x0b,0x82,0x01,
+ 0x85,0x0b,0x82,0x01,0x84,0x0b,0x82,0x01,0x85,0x0b,0x81,0x01,0x85,0x0b,0x82,0x01,0x84,0x0b,0x82,0x01,0x85,0x0b,0x82,0x01,0x84,0x0b,0x82,0x01,0x85,0x0b,
+ 0x81,0x01,0x85,0x0b,0x81,0x01,0x03,0x95,0x43,0xa2,0x13,0x82,0x02,0x0f,0xa7,0x60,0xc4,0x98,0xce,0xda,0x2d,0x13,0x50,0x2c,0x02,0x13,0x89,0x4e,0x1e,0xd7,
+ 0x81,0x2f,0x05,0xb9,0xa8,0x0b,0xed,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,0x07,0xe7,0x81,0x2f,0x05,0xcf,0xf3,0x0b,0x42,0xdd,0x2c,0x82,0x02,0x07,
+ 0x60,0x24,0x0e,0x2b,0x82,0x2d,0x2a,0x12,0x82,0x02,0x00,0x2b,0x82,0x00,0x00,0xed,0xff,0x01,0xa8,0x01,0x03,0x79,0x03,0x08,0x1f,0x82,0x02,0x0f,0xbb,0xa1,
+ 0x87,0x56,0x60,0xff,0x2d,0x60,0x93,0x13,0x02,0x96,0x03,0x01,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0xde,0x00,0x1c,0x86,0x02,0x05,0x0a,0x15,0x51,0x46,
+ 0x07,0x9d,0x82,0xea,0x04,0xf4,0x0b,0x42,0xb2,0x1f,0x82,0x02,0x07,0x60,0xa1,0x32,0x1f,0x6c,0x1f,0x24,0x5c,0x82,0x02,0x00,0x12,0x82,0x00,0x00,0xed,0xff,
+ 0x01,0xa8,0x01,0x04,0x79,0x0c,0x00,0x71,0x0e,0x81,0x02,0x0f,0x12,0x06,0xcc,0x12,0x0f,0xf2,0xef,0x60,0x1f,0x02,0x12,0x62,0x03,0x0b,0x1e,0xe7,0x81,0xc8,
+ 0x05,0xae,0xa8,0x0b,0x95,0x00,0x1c,0x86,0x02,0x04,0x0a,0x15,0x51,0x46,0x16,0x84,0x38,0x04,0x0b,0x42,0x29,0x9b,0x8c,0x81,0x02,0x81,0x32,0x05,0x44,0x2d,
+ 0x12,0x36,0x6a,0x30,0x82,0x02,0x00,0x61,0x82,0x00,0x02,0xed,0x01,0x16,0x84,0x0d,0x00,0x0b,0x81,0x01,0x00,0x63,0x83,0x0d,0x00,0x1e,0x81,0x01,0x00,0x1e,
+ 0x83,0x0d,0x00,0x63,0x81,0x01,0x01,0x0b,0x63,0x83,0x0d,0x00,0x07,0x81,0x01,0x00,0x38,0x83,0x0d,0x00,0x1a,0x81,0x01,0x00,0x16,0x83,0x0d,0x01,0x35,0x16,
+ 0x81,0x01,0x00,0x1a,0x83,0x0d,0x00,0x38,0x81,0x01,0x00,0x07,0x84,0x0d,0x81,0x01,0x01,0x0b,0x35,0x83,0x0d,0x00,0x07,0x81,0x01,0x00,0x38,0x83,0x0d,0x00,
+ 0x63,0x81,0x01,0x01,0x0b,0x35,0x83,0x0d,0x00,0x16,0x81,0x01,0x00,0x1a,0x83,0x0d,0x00,0x1a,0x81,0x01,0x00,0x16,0x83,0x0d,0x01,0x35,0x0b,0x81,0x01,0x00,
+ 0x63,0x83,0x0d,0x00,0x1e,0x81,0x01,0x00,0x07,0x83,0x0d,0x00,0x63,0x81,0x01,0x01,0x0b,0x35,0x83,0x0d,0x00,0x16,0x81,0x01,0x00,0x38,0x83,0x0d,0x00,0x1a,
+ 0x81,0x01,0x01,0x16,0x35,0x82,0x0d,0x01,0x35,0x16,0x81,0x01,0x00,0x1a,0x83,0x0d,0x00,0x38,0x81,0x01,0x00,0x07,0x83,0x0d,0x08,0x35,0x0b,0x01,0xed,0x00,
+ 0x0c,0x03,0xe5,0xbf,0x82,0x6b,0x03,0x65,0x39,0xb4,0x6b,0x81,0xaa,0x07,0x39,0x6b,0x8d,0x08,0x18,0x01,0x07,0xf4,0x82,0xf5,0x04,0x63,0x0b,0x95,0x00,0x1c,
+ 0x86,0x02,0x06,0x0a,0x15,0x51,0x46,0x0b,0x01,0x0b,0x83,0x01,0x03,0x42,0x5b,0x00,0x2d,0x87,0x2b,0x81,0x12,0x02,0x2b,0x4b,0x8a,0x83,0x00,0x03,0xed,0x01,
+ 0x16,0x8f,0x82,0xb0,0x01,0xf4,0x0b,0x81,0x01,0x01,0x35,0xae,0x81,0xb0,0x01,0xea,0x38,0x81,0x01,0x01,0x1e,0xe7,0x81,0xb0,0x01,0xc8,0xf5,0x81,0x01,0x06,
+ 0x0b,0x9e,0xb9,0xb0,0xb9,0xb7,0x1e,0x81,0x01,0x01,0x1a,0x86,0x81,0xb0,0x01,0xfd,0x63,0x81,0x01,0x02,0x16,0x9e,0xb9,0x81,0xb0,0x01,0x9d,0x16,0x81,0x01,
+ 0x01,0x63,0xae,0x81,0xb0,0x01,0xe8,0x38,0x81,0x01,0x01,0x07,0xe7,0x81,0xb0,0x01,0xb9,0xd0,0x81,0x01,0x02,0x0b,0xf6,0xc8,0x81,0xb0,0x01,0xd7,0x1e,0x81,
+ 0x01,0x01,0x1a,0xd7,0x81,0xb0,0x01,0xae,0xf5,0x81,0x01,0x06,0x0b,0x9d,0xb9,0xb0,0xb9,0x9d,0x07,0x81,0x01,0x01,0x1a,0xe1,0x81,0xb0,0x01,0xe8,0x63,0x81,
+ 0x01,0x01,0x07,0x9d,0x81,0xb0,0x02,0xb9,0x9e,0x0b,0x81,0x01,0x01,0x35,0xc8,0x81,0xb0,0x01,0xea,0x1e,0x81,0x01,0x01,0x1e,0xd7,0x81,0xb0,0x01,0xc8,0x0d,
+ 0x81,0x01,0x02,0x0b,0x9e,0xb9,0x81,0xb0,0x01,0x9d,0x07,0x81,0x01,0x01,0x1a,0xe8,0x81,0xb0,0x01,0xac,0x1a,0x81,0x01,0x06,0x16,0x9d,0xb9,0xb0,0xb9,0x9d,
+ 0x16,0x81,0x01,0x01,0x1a,0xae,0x81,0xb0,0x01,0xd7,0x1a,0x81,0x01,0x01,0x07,0xe7,0x81,0xb0,0x05,0xb9,0xf6,0x0b,0x01,0x66,0x0c,0x86,0x03,0x03,0x43,0x08,
+ 0x41,0x03,0x82,0x00,0x04,0x09,0x03,0x17,0xe2,0x4e,0x86,0x0b,0x02,0x72,0x3a,0x1c,0x86,0x02,0x03,0x0a,0x15,0x51,0x72,0x86,0x4e,0x01,0x47,0x5b,0x89,0x00,
+ 0x04,0x1b,0x17,0x27,0x03,0x22,0x83,0x00,0x03,0xed,0x01,0x16,0x8f,0x81,0x2f,0x02,0x34,0xf4,0x0b,0x81,0x01,0x05,0x35,0xae,0x2f,0x34,0x86,0x38,0x81,0x01,
+ 0x01,0x1e,0xd7,0x81,0x34,0x01,0xb9,0xf3,0x81,0x01,0x06,0x0b,0x9e,0xb0,0x34,0x2f,0x8f,0x1e,0x81,0x01,0x05,0x1a,0xfd,0x2f,0x34,0xac,0x63,0x81,0x01,0x06,
+ 0x16,0x9e,0x2f,0x34,0x2f,0x9d,0x16,0x81,0x01,0x01,0x63,0xc8,0x81,0x2f,0x01,0xfd,0x38,0x81,0x01,0x05,0x07,0xd7,0x34,0x2f,0x97,0xd0,0x81,0x01,0x06,0x0b,
+ 0xf6,0xb0,0x2f,0x34,0xd7,0x1e,0x81,0x01,0x05,0x1a,0xea,0x2f,0x34,0xc8,0xf5,0x81,0x01,0x02,0x0b,0x9d,0xcf,0x81,0x2f,0x01,0xd1,0x07,0x81,0x01,0x05,0x1a,
+ 0xae,0x2f,0x34,0x86,0x63,0x81,0x01,0x01,0x07,0x9d,0x81,0x34,0x02,0x97,0x9d,0x0b,0x81,0x01,0x05,0x35,0xb9,0x2f,0x34,0xe8,0x1e,0x81,0x01,0x05,0x1e,0xea,
+ 0x34,0x2f,0xa9,0x0d,0x81,0x01,0x02,0x0b,0x9e,0xcf,0x81,0x34,0x01,0xd1,0x07,0x81,0x01,0x05,0x1a,0x86,0x34,0x2f,0xae,0x1a,0x81,0x01,0x06,0x16,0x9d,0x97,
+ 0x2f,0xcf,0x9d,0x16,0x81,0x01,0x05,0x1a,0xc8,0x34,0x2f,0xe8,0x1a,0x81,0x01,0x0a,0x07,0xe7,0x2f,0x34,0xcf,0xf6,0x0b,0x01,0x95,0x03,0x1b,0x85,0xa2,0x03,
+ 0x26,0x62,0x40,0x95,0x83,0x28,0x04,0x0c,0x03,0xa7,0x3d,0x01,0x83,0x0b,0x81,0x01,0x02,0x05,0x5b,0x1c,0x86,0x02,0x02,0x0a,0x15,0x49,0x82,0x2d,0x82,0x65,
+ 0x81,0x2d,0x01,0x4c,0x3b,0x88,0x00,0x05,0x09,0x03,0x41,0x27,0x03,0x22,0x83,0x00,0x03,0xed,0x01,0x16,0x8f,0x81,0x2f,0x02,0x34,0xf4,0x0b,0x81,0x01,0x05,
+ 0x35,0xae,0x34,0x2f,0x86,0x38,0x81,0x01,0x01,0x1e,0xd7,0x81,0x34,0x01,0xb9,0xf3,0x81,0x01,0x02,0x0b,0x9e,0xb0,0x81,0x2f,0x01,0x8f,0x1e,0x81,0x01,0x05,
+ 0x1a,0xfd,0x34,0x2f,0xac,0x63,0x81,0x01,0x01,0x16,0x9e,0x82,0x2f,0x01,0x9d,0x16,0x81,0x01,0x05,0x63,0xc8,0x34,0x2f,0xfd,0x38,0x81,0x01,0x05,0x07,0xd7,
+ 0x34,0x2f,0x97,0xd0,0x81,0x01,0x02,0x0b,0xf6,0xb0,0x81,0x34,0x01,0xd7,0x1e,0x81,0x01,0x01,0x1a,0xea,0x81,0x34,0x01,0xc8,0xf5,0x81,0x01,0x02,0x0b,0x9d,
+ 0xcf,0x81,0x2f,0x01,0xd1,0x07,0x81,0x01,0x05,0x1a,0xae,0x2f,0x34,0x86,0x63,0x81,0x01,0x06,0x07,0x9d,0x34,0x2f,0x97,0x9d,0x0b,0x81,0x01,0x05,0x35,0xb9,
+ 0x2f,0x34,0xe8,0x1e,0x81,0x01,0x05,0x1e,0xea,0x34,0x2f,0xa9,0x0d,0x81,0x01,0x06,0x0b,0x9e,0xcf,0x2f,0x34,0xd1,0x07,0x81,0x01,0x01,0x1a,0x86,0x81,0x34,
+ 0x01,0xae,0x1a,0x81,0x01,0x06,0x16,0x9d,0x97,0x2f,0xcf,0x9d,0x16,0x81,0x01,0x01,0x1a,0xc8,0x81,0x34,0x01,0xe8,0x1a,0x81,0x01,0x0b,0x07,0xe7,0x2f,0x34,
+ 0xcf,0xf6,0x0b,0x01,0xd6,0xb1,0x4b,0x2c,0x81,0x12,0x00,0xdc,0x82,0x2c,0x00,0x2b,0x81,0x12,0x07,0x2b,0x2c,0x2b,0x2c,0xa1,0x40,0xa7,0x3d,0x86,0x0b,0x02,
+ 0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x92,0x00,0x06,0x3f,0x03,0x1b,0x14,0x41,0x03,0x0c,0x83,0x00,0x03,0xed,0x01,0x16,0x9d,0x82,0x86,0x01,0xd0,0x0b,
+ 0x81,0x01,0x01,0x35,0xd7,0x81,0x86,0x01,0x8f,0x38,0x81,0x01,0x01,0x1e,0x9d,0x81,0x86,0x01,0xea,0xf5,0x81,0x01,0x02,0x0b,0xf5,0xea,0x81,0x86,0x01,0x9e,
+ 0x1e,0x81,0x01,0x01,0x1a,0x8f,0x81,0x86,0x01,0xe7,0x63,0x81,0x01,0x01,0x16,0xf3,0x82,0x86,0x01,0x9e,0x16,0x81,0x01,0x01,0x63,0xd7,0x81,0x86,0x01,0xe7,
+ 0x38,0x81,0x01,0x01,0x07,0x9d,0x82,0x86,0x00,0xd0,0x81,0x01,0x02,0x0b,0xf4,0xea,0x81,0x86,0x01,0x9d,0x1e,0x81,0x01,0x01,0x1a,0xb7,0x81,0x86,0x01,0xea,
+ 0xf4,0x81,0x01,0x02,0x0b,0xf6,0xe8,0x81,0x86,0x01,0x9e,0x07,0x81,0x01,0x01,0x1a,0xd7,0x81,0x86,0x01,0xe7,0x63,0x81,0x01,0x01,0x07,0xf3,0x81,0x86,0x02,
+ 0xe8,0xf3,0x0b,0x81,0x01,0x01,0x35,0xea,0x81,0x86,0x01,0xb7,0x1e,0x81,0x01,0x01,0x1e,0xb7,0x81,0x86,0x01,0xe8,0x0d,0x81,0x01,0x02,0x0b,0xf6,0xe8,0x81,
+ 0x86,0x01,0x9e,0x07,0x81,0x01,0x01,0x1a,0x8f,0x81,0x86,0x01,0xd7,0x1a,0x81,0x01,0x06,0x16,0xf3,0xe8,0x86,0xe8,0xf3,0x16,0x81,0x01,0x01,0x1a,0xd7,0x81,
+ 0x86,0x01,0xb7,0x1a,0x81,0x01,0x01,0x07,0x9d,0x81,0x86,0x05,0xe8,0xf4,0x0b,0x01,0x42,0x0f,0x81,0x02,0x02,0x6c,0xff,0x60,0x82,0x02,0x0c,0x1f,0x6a,0xb4,
+ 0x4b,0x12,0x4b,0x1d,0x02,0x56,0x5f,0x3d,0x07,0xf5,0x82,0x9e,0x04,0x35,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x8a,0x00,0x0d,0x0c,0x18,0x00,0x3f,
+ 0x18,0x0c,0x09,0x1b,0x03,0x1b,0x14,0x22,0x03,0x09,0x84,0x00,0x02,0xed,0x01,0x0b,0x84,0x38,0x82,0x01,0x00,0x1e,0x83,0x38,0x00,0x16,0x81,0x01,0x00,0x16,
+ 0x83,0x38,0x00,0x1e,0x81,0x01,0x01,0x0b,0x1e,0x83,0x38,0x00,0x16,0x81,0x01,0x00,0x07,0x83,0x38,0x00,0x07,0x81,0x01,0x00,0x0b,0x84,0x38,0x00,0x0b,0x81,
+ 0x01,0x00,0x1e,0x83,0x38,0x00,0x07,0x81,0x01,0x00,0x16,0x84,0x38,0x82,0x01,0x00,0x1e,0x83,0x38,0x00,0x16,0x81,0x01,0x00,0x07,0x83,0x38,0x00,0x1e,0x81,
+ 0x01,0x01,0x0b,0x1e,0x83,0x38,0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x38,0x00,0x07,0x81,0x01,0x00,0x0b,0x83,0x38,0x01,0x1e,0x0b,0x81,0x01,0x00,0x1e,0x83,
+ 0x38,0x00,0x16,0x81,0x01,0x00,0x16,0x83,0x38,0x00,0x1e,0x81,0x01,0x01,0x0b,0x1e,0x83,0x38,0x00,0x0b,0x81,0x01,0x00,0x07,0x83,0x38,0x00,0x07,0x81,0x01,
+ 0x00,0x0b,0x84,0x38,0x00,0x0b,0x81,0x01,0x00,0x1e,0x83,0x38,0x00,0x07,0x81,0x01,0x00,0x16,0x83,0x38,0x00,0x1e,0x81,0x01,0x00,0x04,0x82,0x02,0x02,0x2c,
+ 0x8d,0x1f,0x82,0x02,0x0c,0x0f,0xb1,0x21,0x2c,0x39,0x2a,0x0a,0x02,0x0e,0x21,0x3d,0x1e,0xd7,0x81,0xa9,0x05,0xc8,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x89,0x00,0x0d,0x3f,0x03,0xc1,0x5b,0x17,0xe5,0x26,0xa4,0x95,0x1b,0x08,0x22,0x03,0x09,0x85,0x00,0x00,0xed,0x82,0x59,0x01,0x4e,0x80,0x95,0x59,
+ 0x81,0x01,0x02,0x46,0x59,0x01,0x95,0x59,0x00,0x4e,0x84,0x59,0x81,0x01,0x01,0x80,0x4e,0x81,0x01,0x95,0x59,0x00,0x4e,0x86,0x59,0x81,0x80,0x81,0x01,0x00,
+ 0x59,0x81,0x01,0x81,0x59,0x00,0x4e,0x86,0x59,0x01,0x4e,0x7c,0x81,0x01,0x00,0x59,0x81,0x01,0x81,0x59,0x00,0x4e,0x86,0x59,0x00,0x80,0x97,0x59,0x81,0x80,
+ 0x83,0x59,0x82,0x01,0x00,0x46,0x83,0x01,0x00,0x60,0x82,0x02,0x04,0x0f,0x60,0xa5,0x02,0x13,0x81,0x02,0x04,0x12,0xfa,0x0e,0x53,0x6d,0x82,0x02,0x03,0x6d,
+ 0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x10,0x09,0x66,0x60,0x2c,0x5c,0x90,0x5e,0x9c,0x12,0x60,
+ 0x09,0x03,0xe3,0x53,0x67,0x98,0x53,0x85,0x00,0x03,0x74,0x2b,0x33,0x55,0x93,0x00,0x06,0x08,0xa4,0xff,0x2b,0xcc,0xdd,0x26,0x93,0x27,0x03,0x6a,0x0a,0xc6,
+ 0x62,0x82,0x27,0x05,0x0c,0xdd,0xc9,0x2c,0xc0,0x1b,0x93,0x00,0x03,0x62,0x30,0x0a,0x4c,0x84,0x00,0x0c,0x55,0x60,0x12,0x89,0x26,0x08,0x09,0x03,0x40,0x4d,
+ 0x48,0x44,0x62,0x83,0x00,0x0b,0x64,0x4b,0x32,0xbd,0x03,0x0c,0x26,0x03,0x7a,0x6c,0x0a,0x57,0x84,0x00,0x03,0x71,0x12,0x24,0x49,0x89,0x00,0x00,0x08,0x89,
+ 0x27,0x03,0xe2,0x4b,0x76,0x7d,0x81,0x27,0x06,0x0c,0xfb,0xa4,0x21,0x0e,0xca,0x95,0x81,0x03,0x00,0xdb,0x81,0x02,0x0c,0x0f,0xcb,0xce,0x06,0x2c,0xaf,0x02,
+ 0x1d,0x96,0x9a,0x02,0x44,0xb8,0x81,0x02,0x04,0x44,0x70,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x8a,0x00,
+ 0x03,0x67,0x12,0x0f,0x20,0x81,0xf8,0x09,0xf2,0x13,0x1f,0x17,0x0c,0xc5,0x67,0x4f,0x8a,0x39,0x83,0x00,0x01,0x62,0x36,0x82,0x02,0x01,0x13,0x58,0x92,0x00,
+ 0x01,0x29,0xc5,0x82,0x02,0x01,0x0f,0x94,0x91,0x03,0x01,0x95,0x06,0x82,0x02,0x01,0x2c,0xe3,0x81,0x03,0x01,0xdb,0x0f,0x82,0x02,0x01,0x2a,0x29,0x91,0x00,
+ 0x01,0x51,0x2c,0x82,0x02,0x01,0x6f,0x4f,0x81,0x00,0x01,0x70,0x13,0x82,0x02,0x04,0x36,0x26,0x03,0xb2,0x6f,0x82,0x02,0x01,0x12,0x3e,0x81,0x00,0x01,0x6b,
+ 0x0e,0x81,0x02,0x05,0x0f,0xe6,0x08,0x26,0xdd,0x76,0x82,0x02,0x04,0xba,0x55,0x00,0x68,0x2a,0x82,0x02,0x02,0x0e,0x4c,0x3a,0x86,0x00,0x00,0x0c,0x89,0x03,
+ 0x01,0x94,0x0e,0x82,0x02,0x00,0x99,0x81,0x03,0x01,0xdd,0x76,0x82,0x02,0x01,0x12,0xdd,0x81,0x03,0x00,0x6b,0x8e,0x0e,0x05,0x1f,0x29,0x70,0x3d,0x1e,0x9e,
+ 0x81,0x8f,0x05,0xb7,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x10,0x26,0xbe,0x76,0x0e,0x20,0x05,0xa0,0x60,0x0a,0xc9,0x17,0x40,0x21,
+ 0x28,0x3a,0x2d,0x55,0x83,0x00,0x02,0x7b,0x02,0x0f,0x81,0x13,0x01,0x02,0x1d,0x92,0x00,0x06,0x15,0x13,0x48,0x0f,0x0e,0x0f,0x1d,0x91,0x09,0x0b,0xbd,0x0f,
+ 0x8c,0x48,0x0e,0x02,0x2a,0x09,0x26,0x12,0x0e,0x02,0x81,0x0e,0x01,0x0f,0x4f,0x91,0x00,0x06,0x77,0x02,0x0e,0x0a,0x0f,0x02,0x51,0x81,0x00,0x01,0x1d,0x02,
+ 0x81,0x13,0x0a,0x0f,0x02,0xb2,0x22,0x70,0x02,0x0e,0x48,0x0e,0x02,0x36,0x81,0x00,0x01,0x0a,0x02,0x81,0x13,0x0e,0x0f,0x0e,0x29,0x26,0x6b,0x02,0x0e,0x0a,
+ 0x0e,0x02,0x53,0x00,0x67,0x0e,0x0f,0x81,0x13,0x02,0x02,0x1f,0x29,0x85,0x00,0x02,0x0c,0x03,0x17,0x88,0x09,0x09,0x12,0x02,0x13,0x48,0x0f,0x02,0x4a,0x09,
+ 0xa5,0x0f,0x82,0x0e,0x05,0x02,0xdb,0x03,0x11,0x03,0xa4,0x86,0x9f,0x04,0xd5,0x62,0x66,0x9f,0xd5,0x81,0x5b,0x04,0x29,0x00,0x70,0x3d,0x16,0x83,0x1e,0x04,
+ 0x07,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x0f,0x09,0x8e,0xe5,0xbe,0xc1,0xf9,0xe3,0xe5,0x64,0xb2,0x03,0x0c,0x53,0x57,0x29,0x4c,0x84,
+ 0x00,0x06,0x7b,0x0f,0x39,0x21,0xb4,0xa1,0x1d,0x91,0x00,0x07,0x0c,0xc3,0x0a,0x2d,0x0a,0x85,0x21,0xcc,0x91,0x00,0x0f,0x3e,0x0e,0x4d,0x99,0x6b,0x1d,0x36,
+ 0x00,0x7a,0x12,0x21,0x48,0x4c,0xce,0x0e,0x4f,0x91,0x00,0x17,0x77,0xcc,0x2d,0xb6,0x6b,0x0e,0x51,0x08,0x14,0x1d,0x33,0x9a,0x21,0x57,0x0f,0xdd,0x08,0x6a,
+ 0x13,0x82,0x21,0x2d,0x32,0x36,0x81,0x00,0x12,0x0a,0x2a,0x57,0x39,0x56,0x13,0x29,0x26,0x6b,0x12,0x2d,0xb6,0x70,0x0e,0x53,0x00,0x67,0x0e,0x39,0x81,0x21,
+ 0x02,0x5a,0x1f,0x29,0x84,0x00,0x03,0x0c,0x03,0x17,0x14,0x88,0x00,0x01,0x12,0x36,0x82,0x39,0x00,0x02,0x81,0x00,0x06,0x2d,0x24,0x60,0xca,0x5c,0x4b,0xdb,
+ 0x82,0x03,0x82,0x11,0x00,0x03,0x81,0x11,0x81,0x03,0x02,0x17,0x14,0x18,0x81,0x03,0x00,0x18,0x82,0x00,0x03,0x70,0x3d,0x01,0x0b,0x82,0x01,0x04,0x0b,0x01,
+ 0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0xa6,0x81,0x67,0x03,0x55,0x00,0x14,0x43,0x81,0x03,0x00,0x11,0x81,0x03,0x03,0x17,0x18,0x03,0x41,
+ 0x89,0x00,0x06,0x7b,0x0e,0x21,0x60,0x12,0x39,0x1d,0x90,0x00,0x08,0x18,0x03,0xc3,0x13,0x4d,0x6d,0x30,0x6d,0x1d,0x91,0x3c,0x01,0x91,0x2c,0x81,0xb6,0x05,
+ 0x32,0xc5,0x6c,0x3c,0x1b,0x76,0x81,0x21,0x03,0x6c,0x96,0x0e,0x4f,0x91,0x00,0x12,0x77,0x2a,0x1d,0xc4,0x6d,0x76,0x8d,0x43,0x03,0x4b,0x2d,0x1d,0x24,0x96,
+ 0x13,0x49,0x00,0x6a,0x32,0x81,0x33,0x02,0x32,0x77,0x36,0x81,0x00,0x01,0x0a,0x57,0x81,0x1f,0x04,0x6b,0x0a,0x29,0x26,0x6b,0x81,0x24,0x0c,0xb3,0x36,0x1f,
+ 0x53,0x00,0x67,0x13,0x4c,0x33,0x12,0x6c,0x1f,0x29,0x83,0x00,0x05,0x0c,0x03,0x17,0x14,0x08,0x09,0x87,0x3c,0x0f,0x12,0x94,0xc7,0x24,0xca,0x0e,0x1b,0x3c,
+ 0x85,0xc9,0xa5,0xbb,0x1f,0x33,0xdb,0x11,0x81,0x03,0x04,0x11,0x03,0xa4,0xbe,0xaf,0x83,0xfa,0x0a,0x85,0x6b,0x85,0xfa,0x94,0x6b,0x73,0x3a,0x70,0x3d,0x0b,
+ 0x81,0x01,0x81,0x0b,0x81,0x01,0x02,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x05,0x81,0x24,0x6d,0x6c,0x18,0xe3,0x85,0xaf,0x03,0xfa,0x8d,0x03,
+ 0x1b,0x89,0x00,0x03,0x7b,0x0f,0xaa,0x82,0x82,0x1d,0x8f,0x00,0x09,0x18,0x03,0x43,0x15,0x0e,0x2b,0x24,0x0e,0x12,0x1d,0x91,0x3c,0x0f,0x91,0x0e,0x93,0xa3,
+ 0xf2,0x32,0x6c,0x3c,0x1b,0x76,0x13,0x24,0x0a,0x12,0x0f,0x4f,0x91,0x00,0x02,0x77,0x1f,0x94,0x81,0xc4,0x01,0x0e,0xbd,0x81,0x41,0x0e,0x4b,0x5a,0x61,0x33,
+ 0x06,0x0f,0x49,0x00,0x6a,0x48,0x57,0xaa,0x24,0x2b,0x36,0x81,0x00,0x17,0x0a,0x36,0x2d,0x4b,0x60,0x13,0x29,0x26,0x6b,0x2b,0x2d,0xd2,0xb3,0x0e,0x53,0x00,
+ 0x67,0x0e,0x56,0x4d,0x1f,0x1d,0x1f,0x29,0x82,0x00,0x05,0x0c,0x03,0x17,0x14,0x00,0x22,0x81,0x03,0x82,0x11,0x13,0x03,0x11,0x03,0x11,0x12,0xc5,0xa3,0xa1,
+ 0x30,0x02,0x03,0x11,0x94,0x02,0xc7,0x1d,0x13,0x0a,0xdb,0x11,0x81,0x03,0x13,0x11,0x26,0x33,0x0f,0x02,0x0e,0x4b,0x32,0x13,0x1f,0x13,0x02,0x13,0x0a,0x02,
+ 0x0f,0x8a,0x70,0x3d,0x16,0x84,0x38,0x03,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x06,0x58,0x2a,0x36,0x4c,0x17,0xc3,0x7d,0x81,0x89,0x00,
+ 0xfc,0x82,0x72,0x03,0xc1,0x41,0x03,0x0c,0x88,0x00,0x06,0x7b,0x0f,0x2d,0x4c,0x8a,0x44,0x1d,0x8e,0x00,0x00,0x18,0x81,0x03,0x07,0x18,0xec,0x13,0x76,0x99,
+ 0x2d,0x36,0xcc,0x91,0x00,0x0f,0x3e,0x13,0x2d,0x4d,0x3e,0x77,0x36,0x00,0x7a,0x12,0x2c,0x2a,0x2d,0x9a,0x0e,0x4f,0x91,0x00,0x06,0x77,0xc7,0x93,0x53,0x3e,
+ 0x0a,0x51,0x81,0x00,0x0e,0x1d,0x36,0x93,0xb1,0x8a,0x0e,0x49,0x00,0x6a,0x48,0x56,0x61,0x7b,0x33,0x36,0x81,0x00,0x17,0x0a,0x2a,0x4d,0x73,0x23,0x48,0x29,
+ 0x26,0x6b,0x32,0x4d,0x4c,0x67,0x12,0x53,0x00,0x67,0x0e,0x2d,0x4d,0x23,0x57,0x1f,0x29,0x81,0x00,0x05,0x0c,0x03,0x17,0x14,0x00,0x09,0x86,0x03,0x00,0x11,
+ 0x81,0x03,0x02,0x76,0xc4,0x93,0x81,0xa7,0x09,0x0f,0x03,0x11,0x94,0x0f,0x33,0x9a,0x93,0x76,0xdb,0x83,0x03,0x00,0xa3,0x82,0x02,0x08,0xb4,0xd8,0x9a,0x6d,
+ 0x9a,0x25,0x2b,0x6d,0x6b,0x81,0x02,0x04,0x2b,0x4c,0x3d,0x1e,0xb7,0x81,0x86,0x05,0xea,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x05,
+ 0x6b,0x1c,0x4f,0x64,0x03,0xc0,0x81,0x12,0x00,0x24,0x83,0x19,0x03,0xde,0x18,0x03,0x4a,0x81,0x00,0x02,0x64,0x58,0xa6,0x83,0x00,0x06,0x7b,0x02,0x32,0x39,
+ 0x36,0x0e,0x1d,0x8d,0x00,0x00,0x18,0x81,0x03,0x08,0x18,0x00,0xe5,0x13,0xbb,0x6a,0x1f,0x02,0xcc,0x91,0x00,0x0c,0x3e,0x0f,0x32,0x99,0xb3,0x0e,0x36,0x00,
+ 0x3a,0x12,0x85,0x8d,0x24,0x81,0x0f,0x00,0x4f,0x90,0x00,0x07,0x27,0x6c,0x0f,0x5a,0x2d,0x1d,0x02,0xe3,0x81,0x03,0x0e,0x4b,0x0e,0x6c,0x39,0x32,0x02,0x49,
+ 0x00,0x6a,0x02,0x4b,0x21,0x5a,0x0f,0x36,0x81,0x00,0x81,0x0a,0x1f,0x2a,0x6d,0x12,0x0e,0x29,0x26,0x6b,0x0f,0x24,0x39,0x6f,0x02,0x53,0x00,0x67,0x0e,0x2b,
+ 0x39,0x6c,0x13,0x1f,0x29,0x00,0x0c,0x03,0x17,0x14,0x00,0x09,0x03,0x11,0x03,0x84,0x11,0x82,0x03,0x05,0x12,0x0a,0x96,0x65,0x12,0x02,0x81,0x03,0x06,0x94,
+ 0x1f,0xbe,0xca,0x13,0x02,0xdb,0x81,0x03,0x02,0x11,0x03,0x21,0x82,0x02,0x09,0x1f,0x93,0xb4,0x6d,0x33,0x30,0xf2,0x9a,0x39,0x13,0x81,0x02,0x03,0x32,0x3d,
+ 0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x05,0x44,0x33,0x64,0x2a,0x03,0x89,0x81,0x24,0x00,0x06,0x83,
+ 0x19,0x01,0xde,0x18,0x82,0x03,0x04,0xc1,0x12,0x4c,0x36,0x15,0x82,0x00,0x06,0x7b,0x0e,0x71,0x6b,0xb4,0xa1,0x1d,0x8c,0x00,0x0c,0x18,0x03,0x43,0x18,0x00,
+ 0x4a,0xbc,0x13,0x02,0x48,0x36,0x30,0xcc,0x91,0x00,0x0f,0x3e,0x0a,0x71,0x65,0xb4,0xc7,0x36,0x00,0x3a,0x12,0x02,0x0e,0xa1,0x65,0x0e,0x4f,0x8f,0x00,0x08,
+ 0x14,0x43,0x21,0x5a,0x8a,0xdb,0xce,0x0a,0x25,0x81,0x22,0x0e,0x4b,0x57,0xa3,0xb4,0xb6,0x0e,0x49,0x00,0x6a,0x2b,0x8a,0x2d,0xb4,0x1d,0x36,0x81,0x00,0x1f,
+ 0x0a,0x2d,0x4c,0xb4,0x2a,0x13,0x29,0x26,0x6b,0x1d,0xff,0x65,0xb4,0x0a,0x53,0x00,0x67,0x0e,0x7b,0x4c,0xb4,0x33,0x1f,0x29,0x0c,0x03,0x17,0x14,0x00,0x09,
+ 0x03,0x11,0x81,0x03,0x81,0x11,0x81,0x03,0x81,0x11,0x0a,0x03,0x11,0x76,0x85,0x90,0x5c,0x99,0x0f,0x03,0x11,0x94,0x81,0x02,0x04,0x76,0x94,0xc9,0xdb,0x03,
+ 0x82,0x11,0x00,0xdb,0x82,0x02,0x01,0xc6,0xcc,0x81,0x9a,0x0b,0x6d,0xa3,0x33,0xbe,0x8a,0x5a,0x02,0x0e,0xe6,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,
+ 0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x04,0x58,0x49,0x44,0x67,0x22,0x81,0x03,0x02,0x09,0x26,0x46,0x82,0x19,0x09,0xc3,0x29,0x95,0xa4,0x43,
+ 0x8d,0xef,0x57,0x36,0x28,0x82,0x00,0x02,0x7b,0x0f,0x57,0x81,0x56,0x01,0x36,0x1d,0x8b,0x00,0x08,0x18,0x03,0x43,0x18,0x00,0x4a,0x03,0xc1,0x13,0x83,0x02,
+ 0x00,0xba,0x91,0x00,0x01,0x3e,0x13,0x82,0x56,0x04,0x6f,0x36,0x00,0x3a,0x12,0x83,0x02,0x01,0x0f,0x4f,0x8e,0x00,0x09,0x14,0x43,0x03,0x6c,0x1d,0xbf,0x94,
+ 0x6b,0x13,0x51,0x81,0x00,0x01,0x1d,0x36,0x81,0x56,0x06,0x39,0x0e,0x49,0x00,0x6a,0x2c,0x82,0x81,0x56,0x01,0x6f,0x36,0x81,0x00,0x01,0x0a,0x2a,0x81,0x56,
+ 0x05,0x44,0x13,0x29,0x26,0x6b,0x32,0x81,0x56,0x05,0x98,0x0a,0x53,0x00,0x67,0x0e,0x82,0x56,0x0c,0x33,0x1f,0x08,0x03,0x17,0x27,0x00,0x09,0x03,0x11,0x03,
+ 0x11,0x03,0x83,0x11,0x82,0x03,0x02,0x11,0x12,0x21,0x81,0x94,0x04,0xb4,0x0f,0x03,0x11,0x94,0x84,0x02,0x02,0xdb,0x11,0x03,0x81,0x11,0x01,0x95,0x1f,0x81,
+ 0x02,0x0f,0x0a,0x82,0xc6,0xef,0xb4,0x60,0x0a,0x12,0x0e,0x76,0x02,0xa5,0xa7,0x3d,0x1e,0xe7,0x81,0xc8,0x05,0xae,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x84,0x00,0x09,0x4d,0x51,0x44,0x67,0x08,0x3f,0x03,0x09,0x26,0x46,0x82,0x19,0x09,0x20,0xad,0x76,0x33,0x2a,0x3e,0x87,0x9a,0x2d,0x68,0x82,0x00,
+ 0x06,0x7b,0x0e,0x39,0x2c,0x1f,0x6c,0x1d,0x8a,0x00,0x09,0x18,0x03,0x43,0x18,0x00,0x4a,0x03,0x17,0x5b,0x0a,0x83,0x02,0x00,0x6f,0x91,0x00,0x09,0x3e,0x0a,
+ 0x21,0x2c,0x1d,0x33,0x36,0x00,0x7a,0x6f,0x83,0x02,0x01,0x13,0x3b,0x8c,0x00,0x0b,0x14,0x09,0x43,0x03,0x0c,0x77,0x21,0x60,0x2c,0x6c,0x2c,0x51,0x81,0x00,
+ 0x0c,0x1d,0x56,0x76,0x2c,0x21,0x0e,0x49,0x00,0x6a,0x1f,0x36,0x2c,0x4b,0x81,0x36,0x81,0x00,0x08,0x0a,0x57,0x2c,0x12,0x4c,0x48,0x29,0x26,0x6b,0x81,0x5a,
+ 0x11,0x2c,0x2a,0x12,0x53,0x00,0x67,0x0e,0x4d,0x2c,0x1f,0x6d,0x1f,0xa4,0x17,0x27,0x00,0x09,0x03,0x82,0x11,0x83,0x03,0x85,0x11,0x08,0x76,0xa3,0x12,0xdc,
+ 0xdb,0x0e,0x03,0x11,0xbb,0x84,0x02,0x01,0xc0,0x03,0x83,0x11,0x01,0xbc,0xaf,0x8a,0x6d,0x04,0x57,0x3b,0x58,0x3d,0x07,0x83,0x0d,0x04,0x35,0x0b,0x05,0x5b,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x09,0xaa,0x4d,0x70,0x3e,0x08,0x4a,0x03,0x09,0x26,0x46,0x82,0x19,0x09,0x50,0x4b,0x76,0x33,0x36,0x81,0x65,0xe6,
+ 0x30,0xe2,0x82,0x0c,0x06,0x64,0x0f,0x2d,0xc4,0x9a,0x4b,0x1d,0x8a,0x0c,0x09,0x43,0x03,0x18,0x00,0x4a,0x03,0x17,0x14,0x7a,0xaa,0x82,0x02,0x01,0x0f,0x73,
+ 0x91,0x00,0x06,0x3e,0x8c,0x61,0x2a,0x2d,0x1f,0x36,0x81,0x00,0x00,0x73,0x83,0x02,0x00,0x21,0x8d,0x00,0x0b,0x1b,0x03,0x1b,0x0c,0x08,0x2a,0x4b,0x94,0x2a,
+ 0x4d,0x0f,0x51,0x81,0x00,0x0e,0x1d,0x5a,0x82,0xb6,0x21,0x02,0x49,0x00,0x6a,0x0a,0x2d,0x6d,0x2d,0x12,0x36,0x81,0x00,0x1c,0x0a,0x57,0x9a,0xe6,0x30,0x0e,
+ 0x29,0x26,0x6b,0x12,0x4d,0x2a,0xbf,0x0f,0x53,0x00,0x67,0x0e,0x21,0x6d,0x57,0x24,0xc9,0x95,0x27,0x00,0x09,0x03,0x11,0x82,0x03,0x00,0x11,0x81,0x03,0x86,
+ 0x43,0x09,0x12,0xc4,0xdb,0xe6,0x57,0x02,0x17,0x43,0x0c,0x32,0x82,0x02,0x01,0x12,0xc3,0x92,0x43,0x02,0x22,0x58,0x3d,0x86,0x0b,0x02,0x05,0x5b,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x83,0x00,0x05,0x09,0x26,0x1b,0x17,0x3c,0x17,0x81,0x03,0x02,0x09,0x26,0x46,0x82,0x19,0x00,0x80,0x81,0x66,0x10,0x26,0x17,0x1b,0xa3,
+ 0xaf,0x66,0x95,0x03,0x11,0x03,0xbe,0x02,0x0f,0x2c,0x0a,0x02,0x4b,0x8b,0x03,0x05,0x18,0x00,0x26,0x03,0x17,0x14,0x81,0x00,0x05,0x68,0x82,0x32,0x1f,0x53,
+ 0x3b,0x91,0x00,0x06,0x3e,0x0f,0x0e,0x2c,0x13,0x02,0x36,0x81,0x00,0x06,0x08,0xbb,0x24,0x32,0x57,0xa2,0x26,0x8b,0x00,0x0c,0x18,0x03,0x09,0x81,0xec,0x41,
+ 0x21,0x02,0x48,0x2c,0x8c,0x02,0x51,0x81,0x00,0x0e,0x1d,0x02,0x13,0x2c,0x8c,0x02,0x49,0x00,0x6a,0x02,0x0e,0x2c,0x48,0x02,0x36,0x81,0x00,0x12,0x0a,0x0f,
+ 0x2c,0x2b,0x0f,0x0e,0x29,0x26,0x6b,0x02,0x13,0x2c,0x0e,0x02,0x53,0x00,0x67,0x0e,0x0f,0x81,0x0a,0x04,0x02,0x1f,0x3b,0x00,0x09,0x86,0x03,0x01,0x22,0x14,
+ 0x86,0x08,0x05,0x12,0x02,0x0a,0x2c,0x0f,0x02,0x82,0x08,0x04,0x1c,0x36,0x12,0x5a,0x67,0x94,0x08,0x01,0x73,0x3d,0x81,0x01,0x00,0x0b,0x82,0x01,0x03,0x0b,
+ 0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x07,0x26,0x03,0xbe,0xe3,0x8d,0x03,0x17,0xe3,0x81,0x60,0x00,0x2a,0x83,0x19,0x00,0xed,0x8b,0x0c,0x00,
+ 0x91,0x84,0x02,0x00,0x4b,0x8a,0x0c,0x05,0x18,0x00,0x26,0x03,0x17,0x14,0x84,0x00,0x81,0x29,0x93,0x00,0x01,0x3e,0x0f,0x83,0x02,0x00,0x36,0x81,0x00,0x07,
+ 0x08,0x03,0xa2,0x29,0x08,0x17,0x03,0x26,0x8a,0x00,0x06,0x0c,0x11,0x0c,0x36,0x3e,0x11,0xca,0x84,0x02,0x00,0x51,0x81,0x00,0x00,0x1d,0x84,0x02,0x02,0x15,
+ 0x00,0x8a,0x84,0x02,0x03,0x2a,0x00,0x08,0xdc,0x81,0x02,0x81,0x0f,0x03,0x13,0x29,0x26,0xbf,0x84,0x02,0x03,0x70,0x00,0x1c,0x0e,0x83,0x02,0x02,0xcc,0x68,
+ 0x09,0x81,0x03,0x83,0x11,0x03,0x03,0x22,0x08,0x26,0x86,0x22,0x00,0x76,0x84,0x02,0x00,0x09,0x82,0x22,0x02,0x09,0x0c,0xa2,0x86,0x22,0x01,0x26,0x71,0x8a,
+ 0x70,0x03,0x71,0xa2,0xb1,0x3d,0x86,0x0b,0x02,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x02,0x22,0xa4,0x04,0x81,0x12,0x02,0xbe,0x14,0x5f,0x81,
+ 0x2c,0x00,0x4b,0x83,0x19,0x00,0x66,0x8b,0x00,0x01,0x7a,0x0a,0x83,0x02,0x00,0x98,0x8b,0x00,0x03,0x0c,0x03,0x17,0x14,0x9b,0x00,0x01,0x15,0x0a,0x83,0x02,
+ 0x00,0x70,0x82,0x00,0x07,0x09,0x03,0x41,0x00,0x08,0x17,0x03,0x18,0x87,0x00,0x02,0x18,0x41,0x17,0x81,0x03,0x03,0x26,0x1b,0x03,0xc0,0x83,0x02,0x01,0x0a,
+ 0xc1,0x81,0x3c,0x00,0x93,0x83,0x02,0x04,0x12,0x22,0x3c,0xc1,0x0a,0x82,0x02,0x04,0x0f,0x8d,0x3c,0x17,0xc5,0x83,0x02,0x03,0x06,0x08,0x26,0xbe,0x83,0x02,
+ 0x04,0x0e,0x1c,0x00,0x7a,0x1d,0x83,0x02,0x03,0x2a,0x09,0x03,0x11,0x84,0x03,0x02,0x22,0x00,0x4a,0x82,0x03,0x81,0x11,0x82,0x03,0x00,0xb4,0x83,0x02,0x00,
+ 0x4b,0x85,0x03,0x81,0x11,0x82,0x03,0x81,0x11,0x01,0xa4,0x33,0x81,0x02,0x07,0x0f,0xc9,0x12,0x02,0x12,0x1f,0x02,0x2b,0x81,0x02,0x04,0x0f,0xe5,0xa7,0x3d,
+ 0x1e,0x83,0xa8,0x04,0x0d,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x02,0x22,0xa4,0xf2,0x81,0x0a,0x06,0x8d,0x22,0xfb,0xb2,0xbe,0xe2,0x46,
+ 0x82,0x19,0x00,0x95,0x8c,0x03,0x05,0xd5,0x12,0x0f,0x0e,0x6d,0x8e,0x8c,0x03,0x01,0x17,0x14,0x9d,0x00,0x05,0x58,0x0a,0x0f,0x0e,0x2a,0x29,0x83,0x00,0x06,
+ 0x09,0x03,0x41,0x00,0x3f,0x11,0x0c,0x86,0x00,0x00,0x18,0x81,0x03,0x85,0x17,0x05,0xd6,0x9a,0x0e,0x0f,0x0a,0xbb,0x83,0x17,0x00,0x2a,0x81,0x0f,0x01,0x12,
+ 0xbe,0x82,0x17,0x04,0x71,0x48,0x0f,0x13,0xb4,0x82,0x17,0x01,0x08,0x1d,0x81,0x0f,0x09,0x1d,0xc3,0x18,0x26,0x17,0xa5,0x0e,0x0f,0x0e,0x4c,0x82,0x00,0x05,
+ 0x15,0xef,0x0f,0x0e,0x5a,0x40,0x86,0x03,0x01,0x22,0x00,0x81,0x26,0x03,0x18,0x17,0x03,0x27,0x83,0x00,0x01,0x7a,0x33,0x81,0x0f,0x01,0x1f,0xbd,0x8c,0x00,
+ 0x00,0x6a,0x82,0x02,0x07,0x33,0x2a,0x6c,0x1f,0x2d,0x6d,0x1f,0x65,0x82,0x02,0x04,0x2b,0xbf,0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,
+ 0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x02,0x26,0xd6,0x72,0x81,0x3d,0x01,0x9f,0x03,0x81,0x11,0x03,0x3c,0x7a,0xaf,0xda,0x81,0x4c,0x00,0xbe,0x8d,0x41,0x02,
+ 0xa2,0x8d,0xd5,0x8d,0x41,0x01,0x09,0x08,0x9f,0x00,0x02,0x29,0x7b,0xe2,0x86,0x00,0x05,0x1b,0x03,0x00,0x0c,0x11,0x0c,0x85,0x00,0x00,0x18,0x81,0x43,0x00,
+ 0x0c,0x87,0x00,0x02,0x15,0x7d,0x62,0x85,0x00,0x02,0xe2,0x9b,0x3b,0x84,0x00,0x02,0x28,0x7b,0x28,0x84,0x00,0x0b,0x4a,0xdd,0x91,0x95,0x03,0x18,0x26,0x03,
+ 0x0c,0x15,0x3e,0x4f,0x82,0x00,0x05,0x18,0x03,0xa4,0x7b,0x49,0x09,0x83,0x03,0x00,0x11,0x81,0x03,0x08,0x41,0x00,0x4a,0x17,0x81,0x32,0x08,0x03,0x4a,0x84,
+ 0x00,0x03,0x7a,0x1c,0x9b,0x3b,0x87,0x00,0x01,0x3a,0x7a,0x83,0x00,0x00,0x44,0x82,0x02,0x07,0x2c,0x57,0x21,0xdf,0x36,0x02,0x0f,0x65,0x83,0x02,0x03,0x4b,
+ 0x3d,0x1e,0xd7,0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x05,0x08,0x89,0x3d,0xe4,0x1e,0x5c,0x82,0x03,0x03,0x3c,
+ 0x18,0x03,0x09,0xcd,0x00,0x05,0x22,0x03,0x00,0x0c,0x03,0x0c,0x84,0x00,0x05,0x18,0x43,0x03,0x0c,0x08,0x22,0x9f,0x1b,0x08,0x03,0x3c,0x08,0x0c,0x11,0x18,
+ 0x26,0x03,0x0c,0x84,0x00,0x00,0x18,0x81,0x43,0x02,0x18,0x00,0x3f,0x83,0x03,0x00,0x11,0x81,0x03,0x02,0x41,0x08,0x26,0x81,0x03,0x04,0x29,0x64,0x00,0x17,
+ 0x43,0x8f,0x00,0x02,0x29,0x5a,0x9b,0x83,0x00,0x00,0x4d,0x82,0x02,0x0f,0xdf,0x5a,0x57,0xc6,0x82,0x33,0x1f,0xa3,0x1d,0x0a,0x02,0x2c,0x82,0x3d,0x1e,0xd7,
+ 0x81,0x2f,0x05,0xb9,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x05,0x14,0xbe,0x46,0xe4,0x1e,0x90,0x82,0x03,0x07,0x3c,0x18,0x03,0x09,
+ 0x00,0x08,0x00,0x08,0x93,0x00,0x01,0x7a,0x29,0x81,0x28,0x01,0xd9,0x29,0x84,0xd9,0x88,0x29,0x82,0xd9,0x98,0x28,0x84,0xd9,0x06,0x28,0x66,0xa4,0x29,0x00,
+ 0x22,0xab,0x83,0x28,0x06,0x3b,0xa2,0xa4,0x08,0x29,0x0c,0xa4,0x8f,0xa2,0x81,0x95,0x82,0xa2,0x00,0xa4,0x89,0xa2,0x08,0x0c,0x29,0x28,0xab,0x22,0xab,0x08,
+ 0x22,0xab,0x82,0x28,0x06,0xd9,0x29,0x0c,0x22,0xab,0x29,0x08,0x81,0xa4,0x00,0x22,0x83,0xd6,0x04,0x26,0x29,0x08,0xa4,0xd6,0x81,0x1b,0x03,0xa2,0x68,0x0c,
+ 0xa2,0x85,0x29,0x02,0xd9,0x28,0xd9,0x86,0x29,0x02,0x28,0x44,0x1c,0x83,0x29,0x01,0xa6,0xba,0x81,0x02,0x0f,0x13,0x33,0x5a,0x0f,0x6f,0x36,0x13,0x5a,0x36,
+ 0x12,0x0f,0x53,0x70,0x3d,0x1e,0x9e,0x82,0xd7,0x04,0xa8,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x02,0x0c,0x95,0x47,0x81,0x5c,0x00,0xc3,
+ 0x81,0x03,0x0a,0x11,0x3c,0x18,0x03,0x17,0x1b,0x22,0x00,0x22,0x1b,0x08,0x90,0x00,0x02,0x55,0x58,0x4e,0x81,0x01,0x94,0x83,0x88,0xc2,0x81,0x01,0x8a,0xc2,
+ 0x86,0x83,0x0a,0x16,0xf0,0x83,0x16,0x1e,0x83,0xc2,0x01,0xc2,0x83,0xf0,0x81,0x1e,0x03,0x83,0x16,0xe4,0xf0,0x81,0x83,0x82,0x16,0x85,0x83,0x82,0x16,0x84,
+ 0x83,0x04,0x16,0xf0,0x1e,0xf0,0x16,0x83,0x83,0x81,0x16,0x81,0x83,0x82,0xc2,0x01,0x83,0x1e,0x81,0xf0,0x00,0x1e,0x81,0x83,0x81,0xc2,0x81,0x83,0x81,0x1e,
+ 0x81,0x83,0x00,0xf0,0x81,0xe4,0x84,0x1e,0x81,0x83,0x00,0xf0,0x84,0x1e,0x00,0x83,0x81,0xf0,0x81,0x83,0x01,0x16,0xf0,0x85,0x83,0x00,0x16,0x83,0xf0,0x81,
+ 0x16,0x86,0xf0,0x00,0x59,0x87,0x46,0x00,0x9a,0x82,0x21,0x04,0x6b,0x3b,0x70,0x3d,0x16,0x83,0x1e,0x04,0x07,0x0b,0x05,0x5b,0x1c,0x86,0x02,0x01,0x0a,0x15,
+ 0x83,0x00,0x01,0x28,0x1f,0x81,0x13,0x01,0xbe,0x11,0x81,0x03,0x0d,0xbb,0x57,0x5b,0x7f,0x55,0x7d,0x39,0xa7,0x03,0xe2,0x4d,0x15,0x73,0x9b,0x8b,0x00,0x03,
+ 0x3b,0x87,0x01,0x35,0xa4,0x1a,0x02,0x9e,0xd1,0xf6,0x84,0x1a,0x00,0x1e,0x81,0x9d,0x00,0x38,0x84,0x1a,0x02,0xf6,0xd1,0x9e,0x84,0x1a,0x03,0x38,0x9d,0xd1,
+ 0x1e,0x84,0x1a,0x02,0x1e,0xd1,0x9d,0x85,0x1a,0x02,0x9e,0xd1,0xf6,0x84,0x1a,0x00,0x38,0x81,0x9d,0x00,0x38,0x84,0x1a,0x02,0x9e,0xd1,0x9e,0x84,0x1a,0x03,
+ 0x38,0x9d,0xd1,0xf6,0x84,0x1a,0x03,0xf6,0xd1,0x9d,0x38,0x84,0x1a,0x02,0x9e,0xd1,0xf6,0x84,0x1a,0x00,0x1e,0x81,0x9d,0x00,0x1e,0x84,0x1a,0x02,0x9e,0xd1,
+ 0x9e,0x84,0x1a,0x03,0x38,0x9d,0xd1,0xf6,0x84,0x1a,0x02,0xf6,0xd1,0x9d,0x85,0x1a,0x06,0x9e,0xd1,0xf6,0x1a,0x0d,0xa8,0x26,0x83,0x00,0x03,0x8a,0x2e,0x01,
+ 0x0b,0x81,0x01,0x00,0x0b,0x81,0x01,0x02,0xf9,0x29,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x02,0x0c,0x26,0xc5,0x81,0x76,0x00,0xc3,0x81,0x03,0x03,0xb2,
+ 0x76,0x0f,0xcb,0x81,0x05,0x08,0x04,0x13,0x12,0xab,0x06,0x7b,0x51,0x1d,0x7b,0x8a,0x00,0x03,0x3a,0x8a,0x3d,0x35,0x83,0x01,0x82,0xd3,0x00,0x84,0x88,0x01,
+ 0x00,0x84,0x83,0xd3,0x00,0x84,0x8d,0x01,0x00,0xd7,0x81,0x5d,0x01,0xe0,0xd1,0x82,0x01,0x01,0xd3,0xeb,0x81,0x5d,0x00,0xeb,0x83,0x01,0x04,0xd1,0xe0,0x5d,
+ 0xe0,0xe7,0x82,0x01,0x01,0x84,0xfe,0x81,0x5d,0x01,0xe0,0xd3,0x82,0x01,0x01,0xd3,0xe0,0x81,0x5d,0x01,0xfe,0x84,0x82,0x01,0x00,0xd7,0x81,0x5d,0x01,0xe0,
+ 0xd1,0x82,0x01,0x01,0x84,0xeb,0x81,0x5d,0x01,0xeb,0x84,0x82,0x01,0x04,0xd1,0xe0,0x5d,0xe0,0xe7,0x83,0x01,0x00,0xfe,0x81,0x5d,0x01,0xe0,0xd3,0x82,0x01,
+ 0x01,0xd3,0xe0,0x81,0x5d,0x01,0xfe,0x84,0x82,0x01,0x04,0xd7,0xe0,0x5d,0xe0,0xd1,0x82,0x01,0x01,0x84,0xeb,0x81,0x5d,0x01,0xeb,0x84,0x82,0x01,0x01,0xd1,
+ 0xe0,0x81,0x5d,0x00,0xe7,0x83,0x01,0x00,0xfe,0x81,0x5d,0x06,0xe1,0xd3,0x31,0x90,0x6e,0xd3,0xe0,0x81,0x5d,0x05,0xfe,0x2e,0x54,0x4e,0x54,0xd7,0x81,0x5d,
+ 0x09,0xe0,0xd1,0x01,0x63,0x1a,0x18,0x22,0x3c,0x09,0x00,0x87,0xde,0x02,0x66,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x82,0x00,0x0b,0x27,0x03,0x3c,0x00,0x09,
+ 0x03,0x1b,0x43,0xb2,0x76,0x0f,0xcb,0x81,0x05,0x09,0x04,0x13,0x12,0x68,0x30,0x68,0x51,0x2d,0x5a,0x3a,0x89,0x00,0x03,0x15,0x90,0x52,0x0b,0x82,0x01,0x00,
+ 0xfe,0x82,0x5d,0x01,0xe0,0xd1,0x86,0x01,0x01,0xe7,0xe0,0x83,0x5d,0x01,0xe0,0xd1,0x88,0x01,0x04,0x54,0x6e,0x90,0xfc,0xe0,0x82,0x10,0x00,0xfd,0x82,0x01,
+ 0x01,0xd1,0x5d,0x81,0x10,0x05,0xf7,0xd4,0x46,0x31,0x3d,0xeb,0x82,0x10,0x01,0xe1,0x84,0x81,0x01,0x01,0xd3,0xe0,0x82,0x10,0x00,0xd7,0x82,0x01,0x00,0xd7,
+ 0x82,0x10,0x05,0xe0,0xd4,0x7c,0x4e,0x2e,0xe1,0x82,0x10,0x05,0xfe,0x2e,0x80,0x3d,0xd4,0x5d,0x81,0x10,0x01,0x5d,0xd1,0x82,0x01,0x00,0xeb,0x82,0x10,0x01,
+ 0xe1,0x84,0x81,0x01,0x01,0xd3,0xe0,0x82,0x10,0x00,0xd7,0x82,0x01,0x00,0xea,0x82,0x10,0x01,0xe0,0xd3,0x81,0x01,0x01,0xd3,0xe0,0x82,0x10,0x00,0xfd,0x82,
+ 0x01,0x00,0xd4,0x83,0x10,0x00,0x8f,0x81,0x01,0x01,0x84,0xfd,0x82,0x10,0x01,0xe0,0x84,0x81,0x01,0x01,0xd3,0x5d,0x82,0x10,0x04,0xea,0x31,0x5c,0x5e,0xd7,
+ 0x82,0x10,0x01,0x5d,0x78,0x81,0x42,0x01,0xfc,0xe0,0x82,0x10,0x00,0xfd,0x81,0x01,0x01,0xa8,0x11,0x82,0x03,0x00,0x17,0x82,0x00,0x02,0x4c,0x28,0x6d,0x83,
+ 0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x83,0x00,0x15,0x18,0x4a,0x00,0x0c,0x26,0x00,0x41,0xa2,0x6c,0x33,0x05,0xa0,0x42,0x65,0xc6,0x50,0x17,0x94,0x36,
+ 0x81,0x36,0x2d,0x89,0x00,0x03,0x28,0x21,0x5c,0x54,0x82,0x78,0x00,0xb5,0x84,0xe0,0x00,0xfd,0x85,0x78,0x01,0xb5,0xe1,0x83,0xe0,0x02,0x5d,0x10,0xfe,0x88,
+ 0x01,0x04,0x54,0x37,0xb5,0x46,0xe0,0x82,0x10,0x04,0xe1,0x3d,0x90,0x31,0xe7,0x83,0x10,0x04,0xd7,0x90,0x5e,0x78,0xe1,0x82,0x10,0x01,0xe0,0xfc,0x81,0x80,
+ 0x01,0x46,0x5d,0x82,0x10,0x04,0xea,0x88,0x45,0x54,0xea,0x82,0x10,0x05,0xe0,0xd4,0x42,0x37,0x6e,0xe0,0x82,0x10,0x01,0xeb,0x5e,0x81,0x37,0x00,0xd7,0x82,
+ 0x10,0x05,0x5d,0xd4,0xb5,0x31,0x3d,0xe1,0x82,0x10,0x05,0xe0,0x46,0x80,0x2e,0xd4,0x5d,0x82,0x10,0x04,0xfe,0x78,0x90,0x3d,0x86,0x82,0x10,0x05,0x5d,0xd4,
+ 0x80,0x7c,0xd4,0xe0,0x82,0x10,0x04,0xe1,0x3d,0x7f,0x2e,0xe7,0x83,0x10,0x04,0xd7,0x4e,0x72,0x3d,0xe1,0x82,0x10,0x05,0xe0,0x4e,0x6e,0x4e,0xd3,0x5d,0x82,
+ 0x10,0x04,0xfe,0x6e,0x88,0x78,0xfe,0x82,0x10,0x05,0x5d,0xd4,0x2e,0x7f,0x3d,0xe0,0x82,0x10,0x09,0xe1,0x84,0x01,0x1a,0x17,0x29,0x4c,0x26,0x03,0x18,0x81,
+ 0x00,0x03,0x44,0x74,0x2a,0x7b,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x04,0x0c,0x03,0x41,0x00,0x03,0x81,0x95,0x82,0x03,0x01,0x43,0x14,
+ 0x8c,0x00,0x03,0x3a,0x8a,0x05,0x5c,0x84,0x05,0x84,0x85,0x88,0x05,0x83,0x85,0x02,0xf8,0x10,0xfe,0x88,0x01,0x04,0x4e,0x37,0x42,0x3d,0xe0,0x82,0x10,0x04,
+ 0xe1,0x42,0x92,0x6e,0xe7,0x83,0x10,0x04,0xd4,0x3d,0x78,0x72,0xe1,0x82,0x10,0x00,0xe0,0x81,0x7f,0x02,0x5e,0xd4,0x5d,0x82,0x10,0x04,0xfe,0x5e,0x92,0x5e,
+ 0xfe,0x82,0x10,0x05,0xe0,0xd4,0x7c,0x80,0x54,0xe0,0x82,0x10,0x04,0xeb,0x3d,0x92,0x72,0xe7,0x82,0x10,0x05,0x5d,0xd4,0x90,0x5c,0x37,0xe1,0x82,0x10,0x05,
+ 0xe0,0x6e,0x7f,0x90,0xd4,0x5d,0x82,0x10,0x04,0xfe,0x90,0x42,0xa0,0x86,0x82,0x10,0x05,0x5d,0xd4,0x6e,0x92,0x7f,0xe0,0x82,0x10,0x04,0xe1,0x90,0x42,0x37,
+ 0xd7,0x83,0x10,0x04,0xfe,0x7f,0xa0,0x5e,0xe1,0x82,0x10,0x05,0xe0,0xd4,0x42,0x05,0xd4,0x5d,0x82,0x10,0x00,0xfe,0x81,0x37,0x01,0x5e,0xfe,0x82,0x10,0x05,
+ 0x5d,0x6e,0x05,0x78,0x7c,0xe0,0x82,0x10,0x0f,0xe1,0x84,0x01,0x1a,0x09,0x1c,0x1d,0x08,0x03,0x0c,0x00,0x4f,0x6c,0x81,0xc6,0x44,0x82,0x00,0x00,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x89,0x00,0x0a,0x08,0x43,0x41,0x00,0x03,0x11,0x17,0xe2,0x15,0x03,0x1b,0x8d,0x00,0x02,0x68,0x58,0x47,0x82,0x05,0x01,0x47,0x05,0x83,
+ 0x47,0x87,0x05,0x00,0x47,0x85,0x05,0x02,0x4c,0xfe,0xd3,0x88,0x01,0x04,0x88,0x92,0x31,0xb5,0xe0,0x82,0x10,0x05,0xeb,0x72,0x78,0x54,0xe7,0xf7,0x82,0x10,
+ 0x04,0xd4,0xa0,0x5e,0x4e,0xeb,0x82,0x10,0x05,0xe0,0x4e,0x88,0x2e,0xd3,0xe0,0x82,0x10,0x00,0xd7,0x81,0x4e,0x01,0x54,0xd7,0x82,0x10,0x05,0xe0,0xd4,0x6e,
+ 0xb5,0x78,0xe0,0x82,0x10,0x01,0xeb,0x92,0x81,0x37,0x01,0xd4,0xf7,0x81,0x10,0x05,0x5d,0xe7,0x31,0x72,0x2e,0xeb,0x82,0x10,0x05,0xe0,0x54,0x45,0x01,0xd1,
+ 0xe0,0x82,0x10,0x04,0xd7,0x3d,0xb5,0x46,0xfe,0x82,0x10,0x05,0x5d,0xd3,0x01,0x2e,0x19,0xe0,0x82,0x10,0x04,0xeb,0x46,0x72,0x4e,0xe7,0x83,0x10,0x01,0xe7,
+ 0x72,0x81,0x4e,0x00,0xeb,0x82,0x10,0x02,0xe0,0x54,0x88,0x81,0x46,0x00,0x5d,0x82,0x10,0x04,0xfe,0x3d,0x54,0x3d,0xd7,0x82,0x10,0x05,0x5d,0xd4,0x4e,0x78,
+ 0x2e,0xe0,0x82,0x10,0x00,0xeb,0x81,0x01,0x0c,0x1a,0x11,0x17,0x09,0x43,0x03,0x14,0x00,0x51,0x7b,0x00,0x29,0x4f,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,
+ 0x15,0x89,0x00,0x03,0x08,0x43,0x41,0x00,0x81,0x03,0x06,0x17,0x30,0x56,0x43,0x0c,0x00,0x27,0x81,0x0c,0x00,0x18,0x88,0x00,0x02,0x68,0x5f,0x47,0x84,0x05,
+ 0x01,0x47,0x05,0x81,0x47,0x8e,0x05,0x01,0x5c,0x37,0x81,0x90,0x00,0x78,0x86,0x01,0x04,0x4e,0x54,0x80,0x46,0xfe,0x81,0x10,0x01,0x5d,0xe7,0x82,0x01,0x01,
+ 0xd3,0xe0,0x81,0x10,0x09,0xe0,0xd3,0x7c,0x31,0x88,0xd7,0x5d,0x10,0xf7,0xfe,0x82,0x01,0x01,0x84,0xe1,0x81,0x10,0x01,0xe0,0xd3,0x82,0x01,0x01,0xd1,0xe0,
+ 0x81,0x10,0x05,0xeb,0x54,0x7c,0x45,0x84,0xfe,0x81,0x10,0x06,0x5d,0xe7,0x46,0x92,0xb5,0x4e,0xe0,0x81,0x10,0x01,0xe0,0xd3,0x82,0x01,0x01,0xe7,0x5d,0x81,
+ 0x10,0x00,0xfe,0x82,0x01,0x01,0x84,0xe1,0x81,0x10,0x01,0xe0,0xd1,0x82,0x01,0x01,0xd1,0xe0,0x81,0x10,0x01,0xe1,0x84,0x82,0x01,0x04,0xfe,0xf7,0x10,0x5d,
+ 0xd7,0x82,0x01,0x01,0xd3,0xe0,0x81,0x10,0x01,0xe0,0xd3,0x82,0x01,0x01,0xd7,0x5d,0x81,0x10,0x00,0xfe,0x82,0x01,0x01,0x84,0xe1,0x81,0x10,0x06,0xe0,0xd1,
+ 0x88,0x72,0x5e,0xd1,0xe0,0x81,0x10,0x01,0xe1,0x31,0x81,0x6e,0x01,0x88,0xfe,0x81,0x10,0x01,0x5d,0xd7,0x81,0x01,0x01,0x1a,0x17,0x81,0x03,0x01,0x43,0x26,
+ 0x89,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x03,0x08,0x43,0x41,0x00,0x82,0x03,0x05,0x7a,0x27,0x03,0x18,0x08,0x43,0x82,0x03,0x00,0x0c,0x87,
+ 0x00,0x02,0x68,0x5f,0x47,0x90,0x05,0x00,0x47,0x85,0x05,0x00,0x8b,0x82,0x20,0x00,0x42,0x8a,0x01,0x04,0x84,0xd7,0x86,0xe7,0x84,0x83,0x01,0x00,0xd3,0x81,
+ 0xfe,0x00,0xd3,0x83,0x01,0x04,0x84,0xe7,0x86,0xd7,0x84,0x83,0x01,0x03,0xd3,0xea,0xfe,0xd1,0x84,0x01,0x03,0xd1,0xfe,0xea,0xd3,0x83,0x01,0x04,0x84,0xd7,
+ 0x86,0xe7,0x84,0x83,0x01,0x00,0xd3,0x81,0xfe,0x00,0xd3,0x83,0x01,0x04,0x84,0xe7,0x86,0xd7,0x84,0x83,0x01,0x00,0xd3,0x81,0xfe,0x00,0xd1,0x84,0x01,0x03,
+ 0xd4,0xfe,0xea,0xd3,0x83,0x01,0x04,0x84,0xd7,0x86,0xe7,0x84,0x83,0x01,0x00,0xd3,0x81,0xfe,0x00,0xd3,0x83,0x01,0x04,0x84,0xe7,0x86,0xd7,0x84,0x83,0x01,
+ 0x09,0xd3,0xea,0xfe,0xd4,0x01,0x45,0x80,0x72,0x01,0xd1,0x81,0xfe,0x09,0xd3,0x7c,0x6e,0x78,0x7c,0x84,0xd7,0x86,0xe7,0x84,0x81,0x01,0x04,0x1e,0x0c,0x08,
+ 0x18,0x08,0x8a,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x03,0x08,0x43,0x41,0x00,0x81,0x03,0x0f,0x95,0x57,0x85,0x8e,0xb4,0x4c,0x1b,0xbb,0xce,
+ 0x1b,0x93,0x08,0x18,0x00,0x14,0x27,0x82,0x00,0x02,0x68,0x5f,0x47,0x97,0x05,0x00,0x5c,0x82,0xa0,0x00,0xb5,0xff,0x01,0x92,0x01,0x01,0x1e,0x0c,0x8d,0x00,
+ 0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x03,0x08,0x43,0x41,0x00,0x81,0x03,0x10,0x66,0x76,0x1f,0xa4,0x1f,0x12,0xd5,0xc5,0x0a,0x89,0xb1,0x03,0x17,
+ 0x00,0x26,0x11,0x26,0x81,0x00,0x02,0x68,0x5f,0x47,0x97,0x05,0x01,0x5c,0x7e,0x81,0x8b,0x00,0x5e,0xff,0x01,0x92,0x01,0x01,0x1e,0x0c,0x88,0x00,0x01,0x4d,
+ 0x32,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,0x03,0x08,0x43,0x41,0x00,0x81,0x03,0x10,0x66,0x4b,0x24,0xa4,0x24,0x4b,0xb2,0x21,0x1f,0xe3,
+ 0xb1,0x17,0x93,0x2a,0x99,0xc1,0x1b,0x81,0x00,0x02,0x3b,0x5f,0x47,0x97,0x05,0x00,0x8b,0x82,0x20,0x00,0x42,0xbf,0x01,0x00,0x7c,0x89,0x54,0x00,0x45,0x89,
+ 0x01,0x00,0x2e,0x81,0x72,0x01,0x46,0x4e,0x82,0x72,0x00,0x45,0x82,0x72,0x01,0x80,0x3d,0x81,0x72,0x81,0x54,0x81,0x72,0x01,0x3d,0x7c,0x82,0x72,0x01,0x45,
+ 0x88,0x81,0x72,0x01,0x4e,0x46,0x81,0x72,0x01,0x2e,0x4e,0x81,0x72,0x02,0x88,0x80,0x88,0x81,0x72,0x01,0x7c,0x2e,0x81,0x72,0x01,0x46,0x4e,0x81,0x72,0x01,
+ 0x88,0x80,0x82,0x72,0x01,0x7c,0x3d,0x81,0x72,0x03,0x54,0x01,0x1e,0x18,0x88,0x00,0x01,0xec,0x81,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x89,0x00,
+ 0x12,0x08,0x8e,0x66,0x28,0x03,0xbc,0xbe,0x04,0x06,0xde,0x06,0x60,0xb2,0x50,0x4b,0x72,0xb1,0xa4,0x60,0x81,0x12,0x00,0x74,0x82,0x00,0x02,0x3b,0xb1,0x47,
+ 0x97,0x05,0x01,0x5c,0x90,0x81,0x5e,0x00,0x31,0xbf,0x01,0x00,0x5e,0x88,0x92,0x01,0x47,0x3d,0x89,0x01,0x00,0x42,0x81,0x20,0x01,0x5e,0x78,0x81,0x20,0x01,
+ 0x50,0x7c,0x81,0x20,0x02,0x50,0x2e,0x05,0x81,0x20,0x81,0x92,0x81,0x20,0x02,0x05,0x2e,0x50,0x81,0x20,0x01,0x4e,0x7e,0x81,0x20,0x01,0x78,0x7f,0x81,0x20,
+ 0x01,0xa0,0x72,0x81,0x20,0x02,0x75,0x46,0x7e,0x81,0x20,0x01,0x88,0xa0,0x81,0x20,0x01,0x90,0x31,0x81,0x20,0x02,0x8b,0x46,0x75,0x81,0x20,0x01,0x3d,0x47,
+ 0x81,0x20,0x02,0x6e,0x01,0xc2,0x81,0x08,0x01,0x3b,0x29,0x81,0x62,0x88,0x29,0x01,0x64,0x13,0x82,0x0e,0x82,0x02,0x01,0x0a,0x15,0x8a,0x00,0x05,0xbf,0xb4,
+ 0x82,0xd5,0xe3,0xb5,0x81,0x19,0x00,0x46,0x81,0xfc,0x06,0x46,0x19,0x88,0x80,0xb1,0x17,0xce,0x81,0x04,0x01,0xd5,0x4a,0x81,0x00,0x02,0x3b,0x8a,0x47,0x97,
+ 0x05,0x00,0x5c,0x82,0x7e,0x00,0x5e,0xbf,0x01,0x00,0x6e,0x83,0x01,0x81,0x84,0x82,0x01,0x01,0x31,0x3d,0x85,0x01,0x04,0x88,0x31,0x72,0x45,0xfe,0x81,0xf1,
+ 0x01,0xfe,0xd4,0x82,0xf1,0x00,0xd3,0x82,0xf1,0x01,0xd3,0xfe,0x81,0xf1,0x01,0xd7,0xd4,0x82,0xf1,0x00,0xd3,0x82,0xf1,0x00,0xd3,0x82,0xf1,0x81,0xd4,0x81,
+ 0xf1,0x01,0xfe,0xd4,0x82,0xf1,0x00,0xd3,0x82,0xf1,0x01,0xd4,0xfe,0x81,0xf1,0x01,0xfe,0xd4,0x82,0xf1,0x00,0xd3,0x82,0xf1,0x01,0xd1,0xfe,0x81,0xf1,0x02,
+ 0xd4,0x2e,0x3d,0x81,0x72,0x00,0x78,0x8b,0x6e,0x01,0x92,0x90,0x82,0x37,0x04,0x75,0x0f,0x02,0x0a,0x15,0x89,0x00,0x06,0x08,0xca,0x74,0x23,0xc1,0xe3,0xb5,
+ 0x87,0x19,0x03,0x7c,0xb1,0xc3,0x9f,0x81,0x07,0x01,0x7f,0x22,0x81,0x00,0x02,0x3a,0x71,0x47,0x97,0x05,0x01,0x5c,0x5e,0x81,0x7f,0x00,0x31,0xbf,0x01,0x00,
+ 0x6e,0x81,0x01,0x01,0xd3,0xfe,0x81,0xe1,0x04,0xd7,0x84,0x01,0x31,0x3d,0x85,0x01,0x01,0x72,0x01,0x81,0x07,0x00,0xeb,0x81,0x5d,0x01,0xe9,0xe7,0x82,0x5d,
+ 0x00,0x9d,0x82,0x5d,0x01,0xd1,0xe1,0x81,0x5d,0x01,0xe9,0xd7,0x81,0x5d,0x01,0xe1,0xd1,0x82,0x5d,0x01,0xd3,0xe0,0x81,0x5d,0x01,0xd7,0xea,0x81,0x5d,0x01,
+ 0xe1,0x8f,0x81,0x5d,0x02,0xe0,0xd1,0xe0,0x81,0x5d,0x01,0x8f,0xeb,0x81,0x5d,0x01,0xeb,0xe7,0x81,0x5d,0x02,0xe0,0xd1,0xe0,0x81,0x5d,0x01,0x8f,0xeb,0x81,
+ 0x5d,0x00,0xd7,0x95,0x07,0x04,0x2e,0x13,0x02,0x0a,0x15,0x89,0x00,0x06,0x08,0xe2,0x89,0x71,0xd5,0xe3,0xb5,0x87,0x19,0x03,0x7c,0x85,0xdd,0x31,0x81,0x1e,
+ 0x01,0x7e,0x27,0x81,0x00,0x02,0x3a,0x7d,0x47,0x97,0x05,0x00,0x5c,0x82,0x20,0x00,0x37,0xbf,0x01,0x03,0x6e,0x01,0x84,0xeb,0x82,0x10,0x04,0x5d,0xd7,0x01,
+ 0x31,0x3d,0x85,0x01,0x01,0x72,0x01,0x81,0x07,0x00,0xd3,0x81,0xd1,0x01,0xd3,0x84,0x82,0xd1,0x00,0x16,0x82,0xd1,0x01,0x01,0xd3,0x81,0xd1,0x01,0xd3,0x9d,
+ 0x82,0xd1,0x00,0x0b,0x82,0xd1,0x00,0x0b,0x82,0xd1,0x81,0x9d,0x81,0xd1,0x01,0xd3,0x9e,0x82,0xd1,0x00,0x0b,0x82,0xd1,0x01,0x84,0xd3,0x81,0xd1,0x01,0xd3,
+ 0x84,0x82,0xd1,0x00,0x0b,0x82,0xd1,0x01,0x9e,0xd3,0x81,0xd1,0x00,0x9d,0x95,0x07,0x04,0x2e,0x13,0x02,0x0a,0x15,0x89,0x00,0x06,0x08,0x57,0xbe,0x57,0x93,
+ 0xe3,0xb5,0x87,0x19,0x03,0x7c,0xb1,0xa4,0x4e,0x81,0xe4,0x01,0xdd,0x41,0x81,0x00,0x02,0x3a,0x3e,0x47,0x97,0x05,0x01,0x5c,0x90,0x81,0x5e,0x00,0x31,0x99,
+ 0x01,0x00,0x45,0x8b,0x46,0x00,0x80,0x97,0x01,0x03,0x6e,0x01,0xd1,0x5d,0x83,0x10,0x03,0xe0,0xd3,0x31,0x3d,0x85,0x01,0x01,0x72,0x01,0x81,0x07,0x00,0x42,
+ 0xb9,0x20,0x00,0x31,0x95,0x07,0x04,0x2e,0x13,0x02,0x0a,0x15,0x89,0x00,0x06,0x08,0x85,0xc6,0x2a,0x74,0xbe,0x78,0x81,0x2e,0x83,0x54,0x05,0x2e,0x19,0x80,
+ 0xb1,0x26,0x24,0x81,0x2b,0x01,0xdd,0x03,0x81,0x00,0x02,0x3a,0x3e,0x47,0x97,0x05,0x00,0x5c,0x82,0x05,0x00,0x92,0x8a,0x01,0x81,0x45,0x84,0x01,0x82,0x45,
+ 0x83,0x01,0x02,0x45,0x54,0xf2,0x81,0x12,0x82,0x2c,0x83,0x0a,0x03,0x13,0x2c,0x78,0x45,0x96,0x01,0x02,0x6e,0x01,0xd1,0x84,0x10,0x03,0xe0,0xd3,0x31,0x3d,
+ 0x85,0x01,0x01,0x2e,0x0b,0x81,0x07,0x00,0x50,0x86,0x04,0x00,0x06,0x88,0x04,0x82,0x06,0x82,0x04,0x00,0x06,0x85,0x04,0x00,0x06,0x87,0x04,0x04,0x06,0x04,
+ 0x06,0x04,0x06,0x87,0x04,0x00,0x06,0x83,0x04,0x01,0x06,0x5e,0x82,0x07,0x01,0x16,0x7c,0x8e,0x54,0x06,0x4e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x89,0x00,0x00,
+ 0x08,0x81,0x17,0x05,0x14,0x18,0x40,0xbe,0x4b,0x24,0x81,0x95,0x07,0x22,0xfb,0x21,0x32,0x64,0x15,0xab,0x60,0x81,0x2c,0x01,0x8d,0x03,0x81,0x00,0x02,0x3a,
+ 0x7d,0x47,0x97,0x05,0x01,0x5c,0x8b,0x81,0x5c,0x00,0x7f,0x89,0x01,0x03,0x2e,0x5c,0x05,0x46,0x83,0x01,0x81,0x5c,0x00,0x31,0x82,0x01,0x03,0x54,0x05,0x7e,
+ 0x12,0x82,0x0e,0x04,0x0a,0x2c,0x2b,0x0a,0x13,0x81,0x0e,0x03,0x12,0x7e,0x5c,0x88,0x95,0x01,0x03,0x6e,0x01,0xd1,0xe0,0x83,0x10,0x03,0xe0,0x84,0x31,0x3d,
+ 0x85,0x01,0x04,0x3d,0xd1,0xd3,0x07,0x50,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x86,0x04,0x01,0x06,0x04,0x81,0x06,0x01,0x04,0x06,0x82,0x04,0x82,0x06,
+ 0x81,0x04,0x02,0x06,0x04,0x06,0x89,0x04,0x00,0x06,0x81,0x04,0x82,0x06,0x84,0x04,0x03,0x06,0x04,0x06,0x04,0x81,0x06,0x01,0x04,0x5e,0x82,0x07,0x00,0x0b,
+ 0x90,0x2e,0x05,0x45,0x2e,0x13,0x02,0x0a,0x15,0x89,0x00,0x14,0x08,0x17,0x03,0x0c,0x00,0x14,0x15,0x1f,0x1d,0xa4,0x4a,0x22,0x11,0x6d,0x12,0x71,0x0c,0x03,
+ 0xe5,0x9a,0xa3,0x81,0x17,0x81,0x00,0x02,0x3a,0x3e,0x47,0x97,0x05,0x01,0x5c,0x90,0x81,0x5e,0x00,0x31,0x88,0x01,0x01,0x45,0x78,0x81,0x50,0x00,0x31,0x83,
+ 0x2e,0x03,0x50,0x20,0x5e,0x80,0x81,0x01,0x07,0x46,0x50,0x96,0x12,0x0e,0x13,0x76,0xc9,0x82,0xad,0x06,0x32,0x13,0x0e,0x12,0x96,0x20,0x72,0x95,0x01,0x04,
+ 0x6e,0x01,0x84,0xfe,0x5d,0x81,0x10,0x04,0xe0,0xe7,0x01,0x31,0x3d,0x85,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x81,0x04,0x81,0x06,0x86,0x04,0x00,0x06,
+ 0x84,0x04,0x83,0x06,0x82,0x04,0x81,0x06,0x89,0x04,0x81,0x06,0x81,0x04,0x04,0x06,0x04,0x06,0x04,0x06,0x83,0x04,0x82,0x06,0x84,0x04,0x00,0x5e,0x82,0x07,
+ 0x01,0x16,0x01,0x8d,0x45,0x07,0x46,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x88,0x00,0x11,0x08,0x1b,0x03,0x4a,0x00,0x22,0x03,0xbc,0x76,0x1f,0xa4,0x4a,0x22,
+ 0x03,0xc5,0x2c,0xe3,0x11,0x82,0x03,0x02,0x11,0x03,0x0c,0x81,0x00,0x02,0x3a,0x3e,0x47,0x97,0x05,0x01,0x5c,0x50,0x81,0x75,0x00,0x90,0x88,0x01,0x00,0x46,
+ 0x83,0x5c,0x83,0x8b,0x81,0x5c,0x01,0x8b,0x88,0x81,0x01,0x05,0x46,0x50,0x96,0x12,0x0e,0x12,0x85,0xad,0x05,0x32,0x13,0x12,0x96,0x20,0x72,0x95,0x01,0x00,
+ 0x6e,0x81,0x01,0x01,0x84,0xe7,0x81,0xfe,0x00,0xd1,0x81,0x01,0x01,0x31,0x3d,0x85,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x81,0x04,0x00,0x06,0x81,0x04,
+ 0x00,0x06,0x85,0x04,0x00,0x06,0x89,0x04,0x81,0x06,0x81,0x04,0x81,0x06,0x85,0x04,0x00,0x06,0x83,0x04,0x00,0xcb,0x81,0x96,0x01,0xcb,0x06,0x84,0x04,0x00,
+ 0x06,0x85,0x04,0x00,0x5e,0x92,0x07,0x07,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x87,0x00,0x05,0x08,0x1b,0x03,0x4a,0x08,0x22,0x81,0x03,0x00,0xd6,0x81,
+ 0x93,0x09,0x8e,0x4a,0x22,0x03,0x89,0xdb,0x95,0x17,0x18,0xe2,0x81,0x71,0x83,0x00,0x02,0x3a,0x71,0x47,0x97,0x05,0x01,0x5c,0x42,0x81,0x37,0x00,0x78,0x88,
+ 0x01,0x00,0x46,0x83,0x05,0x02,0xa0,0x90,0xa0,0x82,0x47,0x01,0x5c,0x88,0x81,0x01,0x04,0x54,0x47,0x5c,0x1f,0x0a,0x87,0xad,0x04,0x0a,0x76,0x5c,0x05,0x3d,
+ 0x95,0x01,0x00,0x6e,0x88,0x01,0x01,0x31,0x3d,0x85,0x01,0x05,0xd4,0x5d,0xee,0x07,0x50,0x06,0x82,0x04,0x00,0x06,0x8d,0x04,0x00,0x06,0x82,0x04,0x82,0x06,
+ 0x83,0x04,0x00,0x06,0x85,0x04,0x00,0x06,0x82,0x04,0x04,0x8b,0x50,0x5c,0x7e,0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x85,0x04,0x00,0x5e,0x92,0x07,0x07,0x54,
+ 0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x86,0x00,0x09,0x08,0x1b,0x03,0x4a,0x00,0x22,0x03,0x22,0x18,0x03,0x81,0x11,0x02,0x03,0x0c,0x22,0x81,0x11,0x07,0x03,
+ 0x43,0x0c,0x00,0x74,0x1d,0x6c,0x8a,0x82,0x00,0x02,0x3a,0x71,0x47,0x97,0x05,0x83,0x5c,0x00,0x7f,0x88,0x01,0x00,0x46,0x81,0x05,0x02,0x47,0x2e,0x0d,0x81,
+ 0x52,0x04,0x4e,0xa0,0x05,0x5c,0x88,0x82,0x01,0x03,0x80,0x54,0xc9,0x2c,0x85,0xad,0x81,0xf1,0x03,0x12,0x0a,0x31,0x45,0x96,0x01,0x00,0x6e,0x82,0x01,0x00,
+ 0x84,0x81,0xd3,0x82,0x01,0x01,0x31,0x3d,0x85,0x01,0x05,0x2e,0xd3,0x84,0x07,0x50,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x82,
+ 0x04,0x00,0x06,0x8e,0x04,0x00,0x06,0x85,0x04,0x00,0x06,0x82,0x04,0x01,0x7e,0x06,0x81,0x50,0x00,0x06,0x81,0x04,0x81,0x06,0x01,0x04,0x06,0x85,0x04,0x00,
+ 0x5e,0x92,0x07,0x07,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x85,0x00,0x0a,0x08,0x1b,0x03,0x3f,0x00,0x22,0x03,0x22,0x00,0x08,0x43,0x81,0x03,0x05,0x26,
+ 0x18,0x03,0x17,0x14,0x08,0x82,0x00,0x03,0x58,0x82,0x33,0x49,0x82,0x00,0x02,0x3a,0x71,0x47,0x97,0x05,0x01,0x5c,0x05,0x81,0x47,0x00,0x92,0x88,0x01,0x00,
+ 0x46,0x81,0x05,0x00,0x4e,0x84,0x69,0x03,0x01,0x47,0x5c,0x6e,0x81,0xa0,0x81,0x01,0x02,0x4e,0xc9,0x2c,0x85,0xad,0x81,0xf1,0x02,0x12,0x0a,0x72,0x97,0x01,
+ 0x00,0x6e,0x81,0x01,0x01,0xd1,0xe0,0x81,0x5d,0x04,0xeb,0xd3,0x01,0x31,0x3d,0x85,0x01,0x06,0xd4,0xe0,0xea,0x07,0x50,0x06,0x04,0x81,0x06,0x81,0x04,0x82,
+ 0x06,0x82,0x04,0x81,0x06,0x83,0x04,0x82,0x06,0x81,0x04,0x02,0x06,0x04,0x06,0x84,0x04,0x00,0x06,0x85,0x04,0x00,0x06,0x81,0x04,0x05,0x9c,0x06,0x9c,0xd8,
+ 0x06,0x04,0x83,0x06,0x81,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x00,0x5e,0x92,0x07,0x07,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x84,0x00,0x07,0x08,0x1b,
+ 0x03,0x3f,0x00,0x09,0x03,0x22,0x81,0x00,0x07,0x09,0x11,0xc1,0x4c,0x00,0x03,0x43,0x18,0x83,0x00,0x04,0x28,0x30,0x4f,0x6a,0x55,0x82,0x00,0x02,0x3a,0x71,
+ 0x47,0x97,0x05,0x01,0x5c,0x37,0x81,0x90,0x00,0x78,0x88,0x01,0x03,0x46,0x47,0xa0,0x52,0x85,0x69,0x09,0x92,0x5c,0x92,0x90,0x42,0x4e,0x42,0x47,0x1f,0x0a,
+ 0x87,0xad,0x04,0x2c,0x12,0x05,0x42,0x2e,0x95,0x01,0x03,0x6e,0x01,0xd3,0xe0,0x83,0x10,0x03,0xeb,0x01,0x31,0x3d,0x85,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,
+ 0x06,0x83,0x04,0x83,0x06,0x00,0x04,0x85,0x06,0x8a,0x04,0x05,0x06,0x04,0x06,0x04,0x06,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x04,0x8b,0xd8,0x8b,
+ 0x75,0x06,0x83,0x04,0x01,0x06,0x04,0x81,0x06,0x00,0x04,0x82,0x06,0x00,0x5e,0x91,0x07,0x08,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x83,0x00,0x07,
+ 0x08,0x1b,0x03,0x3f,0x00,0x09,0x03,0x22,0x82,0x00,0x06,0x09,0x03,0x49,0x32,0x08,0x03,0x26,0x84,0x00,0x04,0x28,0x33,0x6d,0x21,0x3e,0x82,0x00,0x02,0x3a,
+ 0x71,0x47,0x97,0x05,0x00,0x5c,0x82,0x7e,0x00,0x5e,0x88,0x01,0x02,0x54,0x47,0xb5,0x86,0x69,0x02,0x2e,0x5c,0x7f,0x81,0x90,0x05,0x46,0x50,0x96,0x76,0x0e,
+ 0x76,0x85,0xad,0x05,0x1f,0x13,0x2c,0xcb,0x20,0x72,0x95,0x01,0x03,0x6e,0x01,0xd1,0x5d,0x83,0x10,0x03,0xe0,0xd3,0x31,0x3d,0x85,0x01,0x04,0xd4,0x5d,0xe9,
+ 0x07,0x50,0x82,0x06,0x81,0x04,0x84,0x06,0x82,0x04,0x81,0x06,0x84,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x82,0x04,0x81,0x06,0x00,0x04,0x81,0x06,0x81,0x04,
+ 0x00,0x06,0x82,0x04,0x02,0x06,0x04,0x7e,0x81,0x20,0x01,0x50,0x06,0x83,0x04,0x84,0x06,0x82,0x04,0x00,0x5e,0x88,0x07,0x00,0x01,0x88,0x7c,0x07,0x46,0x2e,
+ 0x45,0x2e,0x13,0x02,0x0a,0x15,0x82,0x00,0x07,0x08,0x1b,0x03,0x3f,0x00,0x09,0x03,0x22,0x83,0x00,0x06,0x0c,0x03,0x17,0x3f,0x43,0x03,0x08,0x81,0x00,0x07,
+ 0x8a,0x39,0x00,0x3a,0x64,0x74,0x81,0x3a,0x82,0x00,0x02,0x3a,0x7d,0x47,0x97,0x05,0x01,0x5c,0x5e,0x81,0x7f,0x00,0x72,0x88,0x01,0x02,0x54,0x47,0x31,0x86,
+ 0x69,0x0b,0x46,0x5c,0x5e,0x72,0x6e,0x46,0x50,0x96,0x76,0x0e,0x13,0x32,0x83,0xad,0x06,0x32,0x13,0x0e,0x2c,0xcb,0x20,0x72,0x95,0x01,0x03,0x6e,0x01,0xd1,
+ 0xf7,0x83,0x10,0x03,0xe0,0xd3,0x31,0x3d,0x85,0x01,0x05,0x19,0xd7,0xd1,0x07,0x50,0x06,0x81,0x04,0x83,0x06,0x00,0x04,0x82,0x06,0x81,0x04,0x81,0x06,0x82,
+ 0x04,0x00,0x06,0x83,0x04,0x00,0x06,0x83,0x04,0x00,0x06,0x84,0x04,0x00,0x06,0x81,0x04,0x01,0x06,0x04,0x81,0x06,0x04,0x9c,0x75,0xd8,0x9c,0x06,0x81,0x04,
+ 0x81,0x06,0x00,0xcb,0x81,0x20,0x01,0xcb,0x06,0x82,0x04,0x00,0x5e,0x88,0x07,0x00,0x45,0x81,0x3d,0x00,0x2e,0x85,0x3d,0x81,0x2e,0x05,0x45,0x2e,0x13,0x02,
+ 0x0a,0x15,0x81,0x00,0x07,0x08,0x1b,0x03,0x09,0x00,0x09,0x03,0x22,0x85,0x00,0x04,0x09,0x03,0x11,0x03,0x0c,0x82,0x00,0x01,0x64,0x56,0x81,0x00,0x03,0xbd,
+ 0xa1,0x21,0xe2,0x82,0x00,0x02,0x3a,0x7d,0x47,0x97,0x05,0x00,0x5c,0x82,0x50,0x00,0x37,0x88,0x01,0x02,0x54,0x47,0x31,0x86,0x69,0x08,0x46,0x5c,0x90,0x5e,
+ 0x42,0x54,0x8b,0x75,0x1f,0x81,0x0e,0x01,0x13,0x0a,0x81,0x12,0x01,0x2c,0x13,0x81,0x0e,0x03,0x2c,0x50,0x7e,0x88,0x95,0x01,0x03,0x6e,0x01,0xd3,0xe0,0x83,
+ 0x10,0x03,0xe1,0x84,0x31,0x3d,0x85,0x01,0x05,0xfc,0xe8,0x8f,0x07,0x50,0x06,0x85,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x02,0x06,0x04,
+ 0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x01,0x06,0x04,0x82,0x06,0x8c,0x04,0x01,0x20,0x5c,0x81,0x7e,0x00,0x06,0x81,0x04,0x06,0x06,0x75,0x50,0xa0,0x42,0x50,
+ 0x9c,0x82,0x04,0x00,0x5e,0x88,0x07,0x02,0x45,0x3d,0x46,0x88,0x7c,0x0e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x00,0x08,0x41,0x03,0x09,0x00,0x09,0x03,0x1b,0x87,
+ 0x00,0x02,0x27,0x18,0x14,0x87,0x00,0x03,0x53,0xb3,0x55,0x29,0x82,0x00,0x02,0x3a,0x3e,0x47,0x97,0x05,0x00,0x5c,0x82,0x20,0x00,0x37,0x88,0x01,0x02,0x54,
+ 0x47,0x31,0x86,0x69,0x08,0x46,0x5c,0x6e,0x7f,0xb5,0x45,0x4e,0x2e,0xc9,0x86,0x13,0x81,0x0a,0x04,0x2c,0x8b,0x4e,0x7c,0x45,0x95,0x01,0x00,0x6e,0x81,0x01,
+ 0x08,0xd7,0xe0,0x10,0x5d,0xe0,0xd3,0x01,0x31,0x3d,0x85,0x01,0x04,0xd4,0x5d,0xe9,0x07,0x50,0x82,0x06,0x81,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x83,0x04,
+ 0x82,0x06,0x00,0x04,0x82,0x06,0x01,0x04,0x06,0x82,0x04,0x01,0x06,0x04,0x82,0x06,0x00,0x04,0x87,0x06,0x04,0x04,0x06,0x50,0x20,0x50,0x82,0x06,0x06,0x96,
+ 0x75,0x05,0xa0,0x37,0x47,0x50,0x81,0x04,0x01,0x06,0x5e,0x88,0x07,0x02,0x45,0x2e,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,0x15,0x00,0x41,0x03,0x09,0x00,
+ 0x09,0x81,0x03,0x01,0x1b,0x41,0x8a,0x1b,0x01,0x41,0x0c,0x85,0x00,0x00,0x3a,0x84,0x00,0x02,0x3a,0x7d,0x47,0x97,0x05,0x01,0x5c,0x37,0x81,0x90,0x00,0x78,
+ 0x88,0x01,0x02,0x54,0x47,0x5e,0x86,0x69,0x04,0x72,0x5c,0x90,0x7f,0x5e,0x81,0x01,0x01,0x45,0x72,0x87,0x78,0x81,0x31,0x00,0x4e,0x98,0x01,0x00,0x6e,0x82,
+ 0x01,0x00,0xd3,0x81,0xd1,0x00,0xd3,0x81,0x01,0x01,0x31,0x3d,0x85,0x01,0x04,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,0x81,0x04,0x81,0x06,0x81,0x04,0x00,0x06,
+ 0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x00,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,
+ 0x00,0x06,0x82,0x04,0x00,0x06,0x82,0x04,0x81,0x06,0x05,0x50,0x96,0x06,0x04,0x06,0x20,0x83,0x47,0x05,0x37,0x50,0x04,0x06,0x04,0x5e,0x88,0x07,0x02,0x45,
+ 0x2e,0x4e,0x89,0x07,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x08,0x03,0x41,0x00,0x09,0x03,0x41,0x0c,0x03,0xa4,0x8a,0xb2,0x81,0x03,0x00,0x18,0x8a,0x00,0x02,0x3a,
+ 0x71,0x47,0x97,0x05,0x00,0x8b,0x82,0x20,0x00,0x42,0x88,0x01,0x00,0x54,0x81,0x47,0x00,0x63,0x84,0x69,0x05,0x0d,0x42,0x5c,0x78,0x88,0x92,0xa7,0x01,0x00,
+ 0x6e,0x88,0x01,0x01,0x31,0x3d,0x85,0x01,0x05,0xd4,0xe1,0xd7,0x07,0x50,0x06,0x8b,0x04,0x04,0x06,0x04,0x06,0x04,0x06,0x8b,0x04,0x00,0x06,0x89,0x04,0x00,
+ 0x75,0x81,0x06,0x06,0x20,0x06,0x04,0x06,0x20,0x47,0x37,0x82,0x47,0x00,0x8b,0x82,0x04,0x00,0x5e,0x88,0x07,0x02,0x45,0x3d,0x4e,0x89,0x07,0x0e,0x2e,0x13,
+ 0x02,0x0a,0x15,0x14,0x03,0x09,0x00,0xa4,0x26,0x29,0x08,0x1b,0x50,0x8a,0x12,0x02,0x33,0x8e,0x08,0x84,0x28,0x00,0x29,0x84,0x00,0x02,0x3a,0x3e,0x47,0x97,
+ 0x05,0x00,0x5c,0x82,0x7e,0x00,0x5e,0x88,0x01,0x00,0x46,0x81,0x05,0x01,0x92,0x35,0x82,0x69,0x06,0x52,0xb5,0x47,0x5c,0x78,0x72,0x7f,0xa7,0x01,0x00,0x31,
+ 0x88,0x7f,0x01,0x90,0x54,0x85,0x01,0x04,0x3d,0xd1,0xd3,0x07,0x50,0x81,0x06,0x01,0x04,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x82,0x06,0x81,0x04,
+ 0x83,0x06,0x83,0x04,0x82,0x06,0x81,0x04,0x81,0x06,0x81,0x04,0x82,0x06,0x06,0x04,0x06,0x04,0x8b,0xcb,0x7e,0x75,0x81,0x06,0x04,0x04,0xcb,0x50,0x05,0x42,
+ 0x81,0xa0,0x04,0x20,0x06,0x04,0x06,0x5e,0x88,0x07,0x02,0x45,0x2e,0x4e,0x89,0x07,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0xbd,0xe6,0x51,0x73,0x8a,
+ 0xb2,0x33,0x8a,0x12,0x02,0xa1,0xb2,0x8a,0x84,0x73,0x01,0x99,0x29,0x84,0x00,0x01,0x7b,0x47,0x97,0x05,0x02,0x5c,0xd4,0x80,0x81,0x45,0x88,0x01,0x00,0x46,
+ 0x82,0x05,0x08,0x42,0x2e,0x80,0x46,0x90,0x47,0x05,0x5c,0x88,0xbb,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x85,0x04,0x00,0x06,0x84,0x04,0x00,0x06,0x97,
+ 0x04,0x00,0x06,0x81,0x04,0x01,0x9c,0x50,0x81,0xcb,0x00,0x06,0x81,0x04,0x01,0x06,0x9c,0x81,0x50,0x02,0x5c,0x20,0x06,0x82,0x04,0x00,0x5e,0x88,0x07,0x02,
+ 0x45,0x2e,0x4e,0x89,0x07,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x06,0x8a,0x12,0x02,0xa1,0x03,0x3f,0x84,0x00,0x01,
+ 0x4c,0x62,0x84,0x00,0x01,0x25,0x47,0x97,0x05,0x02,0xf8,0x5d,0xd7,0x8a,0x01,0x00,0x46,0x89,0x05,0x01,0x5c,0x88,0xbb,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,
+ 0x06,0x82,0x04,0x00,0x06,0x82,0x04,0x03,0x06,0x04,0x06,0x04,0x83,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x81,0x06,0x83,0x04,0x01,0x06,0x04,0x83,0x06,0x81,
+ 0x04,0x09,0x06,0x04,0x06,0x04,0x06,0x8b,0x9c,0x06,0x20,0x06,0x81,0x04,0x84,0x06,0x81,0x04,0x03,0x06,0x04,0x06,0x5e,0x88,0x07,0x02,0x45,0x3d,0x4e,0x89,
+ 0x07,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x06,0x8a,0x12,0x02,0xa1,0x11,0x3f,0x84,0x00,0x01,0x4c,0x62,0x84,0x00,
+ 0x03,0x15,0x99,0x7e,0x5e,0x82,0xa0,0x00,0x87,0x85,0xf1,0x85,0xa0,0x00,0x47,0x84,0xf1,0x02,0xc8,0x10,0x86,0x8a,0x01,0x01,0x4e,0x37,0x81,0x7e,0x00,0x37,
+ 0x83,0x5e,0x81,0x7e,0x01,0x47,0x46,0xbb,0x01,0x07,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x04,0x06,0x81,0x04,0x81,0x06,0x83,0x04,0x00,0x06,0x82,0x04,0x06,0x06,
+ 0x04,0x06,0x04,0x06,0x04,0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x88,0x04,0x07,0x06,0x04,0x06,0x04,0x7e,0x75,0x96,0x75,0x82,0x06,0x00,0x04,0x84,0x06,0x81,
+ 0x04,0x02,0x06,0x04,0x5e,0x88,0x07,0x02,0x45,0x3d,0x54,0x88,0x01,0x0f,0x16,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x06,
+ 0x8a,0x12,0x02,0x60,0x03,0x3f,0x84,0x00,0x03,0x4c,0x62,0x27,0x14,0x82,0x00,0x03,0x3a,0x33,0x54,0xa8,0x82,0x01,0x01,0x84,0xe1,0x82,0x10,0x01,0xf7,0xe7,
+ 0x85,0x01,0x02,0x84,0xea,0xf7,0x83,0x10,0x01,0x5d,0xe7,0x8b,0x01,0x03,0x3d,0x20,0x50,0x2e,0x82,0x01,0x00,0x45,0x81,0x20,0x00,0xb5,0xbc,0x01,0x05,0x3d,
+ 0xd1,0x9d,0x07,0x50,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x82,0x06,0x81,0x04,0x81,0x06,0x02,0x04,0x06,0x04,0x81,0x06,0x02,0x04,0x06,0x04,0x81,0x06,0x83,
+ 0x04,0x00,0x06,0x83,0x04,0x00,0x06,0x82,0x04,0x82,0x06,0x05,0x04,0x96,0x06,0x20,0xcb,0x06,0x81,0x04,0x06,0x06,0x75,0x5c,0x47,0x5c,0x8b,0x06,0x82,0x04,
+ 0x00,0x5e,0x88,0x07,0x00,0x45,0x85,0x3d,0x15,0x2e,0x3d,0x2e,0x3d,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x26,0x03,0x94,
+ 0x32,0x88,0x1f,0x03,0x76,0xc4,0x11,0x26,0x84,0x00,0x01,0x85,0x26,0x81,0x03,0x00,0x09,0x81,0x00,0x03,0x3a,0x77,0x7c,0x52,0x83,0x01,0x00,0xd3,0x82,0xd7,
+ 0x01,0xd4,0x84,0x86,0x01,0x01,0x84,0xd4,0x83,0xd7,0x01,0xd4,0x84,0x8b,0x01,0x00,0x80,0x81,0x3d,0x00,0x80,0x83,0x01,0x81,0x3d,0x00,0x4e,0xbc,0x01,0x05,
+ 0xd4,0xe0,0xd7,0x07,0x50,0x06,0x81,0x04,0x81,0x06,0x83,0x04,0x00,0x06,0x84,0x04,0x00,0x06,0x89,0x04,0x81,0x06,0x85,0x04,0x00,0x06,0x81,0x04,0x82,0x06,
+ 0x03,0x04,0x06,0x96,0xd8,0x83,0x04,0x06,0x06,0x8b,0xd8,0x5c,0x9c,0x5c,0x06,0x82,0x04,0x00,0x5e,0x88,0x07,0x00,0x01,0x88,0x54,0x81,0x2e,0x0f,0x01,0x2e,
+ 0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x08,0x43,0x03,0x8a,0x8e,0x81,0x17,0x00,0x14,0x84,0x00,0x0a,0x6a,0xa4,0x09,0x41,0x03,0x3f,0x00,
+ 0x3a,0x39,0x80,0x52,0x8b,0x01,0x0a,0x46,0x88,0x78,0x45,0x92,0x46,0x92,0x42,0x31,0x47,0x5e,0xd5,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x8d,0x04,0x01,
+ 0x06,0x04,0x82,0x06,0x87,0x04,0x00,0x06,0x89,0x04,0x00,0x06,0x81,0x04,0x03,0x20,0x9c,0x04,0x06,0x81,0x04,0x05,0x06,0x75,0x06,0x20,0xd8,0x7e,0x83,0x04,
+ 0x00,0x5e,0x91,0x07,0x0e,0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x81,0x00,0x01,0x08,0x09,0x8a,0x22,0x01,0x09,0x27,
+ 0x84,0x00,0x06,0x14,0xaf,0x40,0x06,0x23,0x17,0x3c,0x81,0x00,0x02,0x4d,0x80,0x52,0x8b,0x01,0x0a,0x2e,0x31,0x92,0x4e,0xa0,0xb5,0x90,0x05,0x46,0x92,0x7c,
+ 0xd5,0x01,0x0a,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x04,0x06,0x04,0x06,0x04,0x83,0x06,0x00,0x04,0x82,0x06,0x02,0x04,0x06,0x04,0x82,0x06,0x00,0x04,0x81,0x06,
+ 0x00,0x04,0x82,0x06,0x00,0x04,0x82,0x06,0x81,0x04,0x01,0x06,0x04,0x82,0x06,0x00,0x04,0x81,0x06,0x00,0xd8,0x81,0x7e,0x00,0x9c,0x83,0x06,0x09,0x50,0x06,
+ 0x50,0x05,0x75,0x06,0x04,0x06,0x04,0x5e,0x91,0x07,0x0e,0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x92,0x00,0x00,0x08,
+ 0x81,0x0c,0x0b,0x09,0x87,0xab,0x53,0x8a,0xa4,0x95,0x7a,0x00,0x73,0x80,0x52,0x8b,0x01,0x0a,0x46,0x6e,0x5e,0x31,0x6e,0x42,0x90,0x5e,0x2e,0x6e,0x7c,0xd5,
+ 0x01,0x06,0x19,0xd7,0xd1,0x07,0x50,0x06,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x00,
+ 0x06,0x85,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x00,0x04,0x81,0x06,0x81,0x04,0x05,0x7e,0x9c,0xd8,0x75,0x06,0x04,0x81,0x06,0x04,0x8b,
+ 0x06,0x47,0x96,0x05,0x81,0x06,0x81,0x04,0x00,0x5e,0x91,0x07,0x0e,0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x92,0x00,
+ 0x00,0x1b,0x82,0x03,0x03,0xa7,0xdb,0x65,0xa5,0x81,0x85,0x04,0x94,0x26,0x74,0x80,0x52,0x8c,0x01,0x06,0x88,0x3d,0x54,0x45,0x54,0x2e,0x4e,0x81,0x54,0x00,
+ 0x45,0xd5,0x01,0x05,0xfc,0xd7,0x8f,0x07,0x50,0x06,0x81,0x04,0x82,0x06,0x83,0x04,0x83,0x06,0x01,0x04,0x06,0x81,0x04,0x82,0x06,0x04,0x04,0x06,0x04,0x06,
+ 0x04,0x81,0x06,0x00,0x04,0x81,0x06,0x81,0x04,0x82,0x06,0x83,0x04,0x01,0x06,0x7e,0x81,0x06,0x00,0x50,0x83,0x06,0x05,0x7e,0x8b,0x47,0xd8,0x7e,0x04,0x82,
+ 0x06,0x00,0x5e,0x91,0x07,0x0e,0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x91,0x00,0x03,0x0c,0x03,0x93,0x6d,0x82,0xc4,
+ 0x08,0x2a,0x6d,0xc4,0x6c,0xa5,0x8e,0x71,0x80,0x52,0xd4,0x01,0x81,0xb5,0x83,0x6e,0x82,0xb5,0x84,0x6e,0x82,0xb5,0x84,0x6e,0x07,0x92,0x3d,0xd4,0x5d,0xe9,
+ 0x07,0x50,0x06,0x92,0x04,0x00,0x06,0x84,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x01,0x06,0x04,0x81,0x06,0x81,0x04,0x02,0x06,0xcb,0x96,0x81,0xcb,
+ 0x00,0x06,0x81,0x04,0x05,0x06,0x96,0x8b,0x75,0x50,0x20,0x83,0x04,0x00,0x5e,0x91,0x07,0x0e,0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,
+ 0x1c,0x8d,0x09,0x91,0x00,0x02,0x0c,0x03,0xc6,0x87,0x12,0x04,0xf2,0x95,0x71,0x80,0x52,0xb6,0x01,0x00,0x3d,0x81,0x78,0x09,0x3d,0x6e,0x88,0x78,0x31,0x3d,
+ 0x6e,0x88,0xb5,0x45,0x90,0x01,0x01,0x6e,0x5e,0x83,0x7e,0x03,0x90,0x80,0x4e,0x47,0x83,0x7e,0x03,0x78,0x80,0x46,0x8b,0x83,0x7e,0x07,0x6e,0x31,0xd4,0x5d,
+ 0xe9,0x07,0x50,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x81,0x06,0x84,0x04,0x81,0x06,0x84,0x04,0x02,0x06,0x04,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x82,0x04,
+ 0x00,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x04,0x75,0x50,0x5c,0x50,0x06,0x81,0x04,0x05,0x06,0x96,0x75,0xa0,0x75,0x05,0x83,0x04,0x00,0x5e,0x91,0x07,0x0e,
+ 0x16,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x91,0x00,0x02,0x0c,0x03,0xa5,0x87,0x76,0x04,0x30,0xd6,0xa7,0x80,0x52,0xb3,
+ 0x01,0x00,0x46,0x81,0x2e,0x0b,0x31,0x6e,0x92,0x3d,0x5e,0x72,0x92,0xb5,0x88,0x5e,0x72,0x92,0x81,0x2e,0x00,0x3d,0x8e,0x01,0x01,0x6e,0x37,0x83,0x20,0x03,
+ 0x37,0x01,0x80,0x5c,0x83,0x20,0x03,0x78,0x01,0x54,0x50,0x83,0x20,0x06,0x6e,0x31,0xd4,0xe0,0xd7,0x07,0x50,0x81,0x06,0x81,0x04,0x00,0x06,0x86,0x04,0x00,
+ 0x06,0x85,0x04,0x04,0x06,0x04,0x06,0x04,0x06,0x89,0x04,0x81,0x06,0x81,0x04,0x06,0x06,0x04,0x06,0x7e,0xcb,0x50,0x20,0x82,0x06,0x05,0x04,0x06,0xd8,0x05,
+ 0xcb,0x05,0x81,0x04,0x81,0x06,0x00,0x5e,0x88,0x07,0x00,0x16,0x88,0x01,0x0d,0x46,0x2e,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x82,
+ 0x00,0x02,0x55,0xad,0x4f,0x8b,0x00,0x02,0x08,0x43,0x03,0x88,0x8e,0x03,0x03,0x8a,0x80,0x52,0xb3,0x01,0x01,0x3d,0x1a,0x83,0x35,0x00,0x0d,0x89,0x35,0x00,
+ 0x45,0x8e,0x01,0x01,0x6e,0x37,0x83,0x20,0x03,0x37,0x01,0x80,0x5c,0x83,0x20,0x03,0x78,0x01,0x54,0x50,0x83,0x20,0x07,0x6e,0x31,0x2e,0xd1,0x84,0x07,0x50,
+ 0x06,0x8a,0x04,0x83,0x06,0x88,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x86,0x04,0x00,0x06,0x81,0x04,0x03,0x06,0xd8,0x20,0xd8,0x81,0x06,0x00,0x04,0x83,0x06,
+ 0x02,0x50,0x7e,0x20,0x83,0x04,0x00,0x5e,0x88,0x07,0x00,0x45,0x8a,0x2e,0x0b,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x82,0x00,0x01,
+ 0x55,0x73,0x8d,0x00,0x01,0x17,0x03,0x87,0xfb,0x04,0x03,0x43,0x81,0x80,0x52,0xb3,0x01,0x01,0x3d,0x35,0x8e,0x0d,0x8f,0x01,0x01,0x6e,0x37,0x83,0x20,0x03,
+ 0x37,0x01,0x80,0x5c,0x83,0x20,0x03,0x78,0x01,0x54,0x50,0x83,0x20,0x06,0x6e,0x31,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,0x81,0x04,0x02,0x06,0x04,0x06,0x81,
+ 0x04,0x03,0x06,0x04,0x06,0x04,0x83,0x06,0x00,0x04,0x81,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x82,0x06,0x81,0x04,0x02,0x06,0x04,0x06,0x81,0x04,
+ 0x05,0x06,0x04,0x06,0x50,0x9c,0x04,0x81,0x06,0x04,0x04,0x06,0x75,0x05,0xa0,0x81,0x05,0x04,0x06,0x04,0x06,0x04,0x5e,0x88,0x07,0x00,0x45,0x81,0x2e,0x88,
+ 0x54,0x0b,0x0b,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x91,0x00,0x02,0x18,0x17,0xc0,0x87,0x96,0x04,0x94,0x22,0x7b,0x80,0x52,0xb2,0x01,
+ 0x02,0x46,0x72,0x35,0x8e,0x0d,0x02,0x0b,0x88,0x45,0x8c,0x01,0x01,0x6e,0x37,0x83,0x20,0x03,0x37,0x01,0x80,0x5c,0x83,0x20,0x03,0x78,0x01,0x54,0x50,0x83,
+ 0x20,0x06,0x6e,0x31,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,0x82,0x04,0x81,0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x84,0x04,0x00,0x06,0x83,0x04,0x81,0x06,0x81,
+ 0x04,0x81,0x06,0x81,0x04,0x02,0x06,0x04,0x06,0x82,0x04,0x00,0x06,0x83,0x04,0x00,0xcb,0x81,0xd8,0x81,0x06,0x81,0x04,0x06,0x06,0x9c,0x05,0xd8,0x05,0x04,
+ 0x06,0x81,0x04,0x00,0x5e,0x88,0x07,0x02,0x45,0x2e,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x93,0x00,0x00,0x36,0x87,
+ 0x12,0x04,0x4b,0x28,0x81,0x80,0x52,0xb2,0x01,0x02,0x78,0x7f,0x35,0x8e,0x0d,0x02,0x01,0x37,0x80,0x8c,0x01,0x02,0x6e,0x37,0x20,0x81,0x96,0x06,0x20,0x37,
+ 0x01,0x80,0x5c,0x20,0x96,0x81,0x20,0x03,0x78,0x01,0x54,0x50,0x83,0x20,0x07,0x6e,0x31,0xd4,0x5d,0xee,0x07,0x50,0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x82,
+ 0x04,0x02,0x06,0x04,0x06,0x84,0x04,0x82,0x06,0x84,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x07,0x04,0x06,0x04,0xcb,
+ 0x50,0x7e,0x50,0x06,0x81,0x04,0x05,0x06,0x50,0x05,0x47,0x05,0x8b,0x83,0x04,0x00,0x5e,0x88,0x07,0x02,0x45,0x2e,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,
+ 0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x91,0x00,0x03,0x27,0x09,0xa5,0x1f,0x81,0xc9,0x81,0x1f,0x81,0xc9,0x05,0x1f,0x30,0x0c,0x51,0x80,0x52,0x8b,0x01,0x07,
+ 0x80,0x7c,0x4e,0x7c,0x2e,0x4e,0x2e,0x54,0x9e,0x01,0x02,0x31,0x92,0x35,0x8e,0x0d,0x02,0x01,0x37,0x80,0x8c,0x01,0x01,0x31,0xb5,0x83,0x47,0x03,0xb5,0x16,
+ 0x01,0x5e,0x83,0x47,0x03,0x3d,0x16,0x80,0x42,0x83,0x47,0x07,0x72,0x31,0x3d,0xd1,0xd3,0x07,0x50,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,
+ 0x81,0x06,0x00,0x04,0x81,0x06,0x00,0x04,0x84,0x06,0x81,0x04,0x82,0x06,0x84,0x04,0x81,0x06,0x81,0x04,0x82,0x06,0x81,0x04,0x81,0x06,0x04,0x20,0x5c,0x50,
+ 0xcb,0x06,0x81,0x04,0x05,0x06,0x20,0x5c,0x8b,0x5c,0x20,0x81,0x06,0x81,0x04,0x00,0x5e,0x88,0x07,0x02,0x45,0x3d,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,
+ 0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x91,0x00,0x07,0x14,0x43,0xa4,0x66,0x26,0xdd,0x5b,0x15,0x81,0x26,0x05,0x9f,0x95,0x03,0x74,0x80,0x52,0x8b,0x01,0x07,
+ 0x2e,0x31,0x92,0x31,0x5e,0x2e,0x42,0x5e,0x9e,0x01,0x02,0x2e,0x3d,0x35,0x8e,0x0d,0x02,0x07,0x31,0x45,0x8d,0x01,0x00,0x35,0x84,0x63,0x01,0x0d,0x35,0x84,
+ 0x63,0x02,0x35,0x0d,0x35,0x85,0x63,0x06,0x88,0xfc,0xe1,0xd7,0x07,0x50,0x06,0x84,0x04,0x01,0x06,0x04,0x81,0x06,0x83,0x04,0x81,0x06,0x03,0x04,0x06,0x04,
+ 0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x85,0x04,0x00,0x06,0x83,0x04,0x00,0x06,0x82,0x04,0x03,0xcb,0x75,0x7e,0x20,0x81,0x06,0x07,0x04,0x06,0x8b,0x20,0x47,
+ 0x20,0x05,0x06,0x81,0x04,0x01,0x06,0x5e,0x88,0x07,0x02,0x45,0x2e,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x92,0x00,
+ 0x01,0x27,0x22,0x81,0x41,0x02,0xa3,0x29,0x00,0x82,0x41,0x04,0x22,0x18,0x4d,0x80,0x52,0x8b,0x01,0x05,0x2e,0x78,0x7f,0x7c,0x6e,0x92,0x81,0x90,0x00,0x45,
+ 0x9d,0x01,0x02,0x6e,0x37,0x35,0x8e,0x0d,0x02,0x45,0x05,0x7c,0x8d,0x01,0x94,0x0d,0x09,0x35,0x88,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x04,0x06,0x82,0x04,0x00,
+ 0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x82,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x05,0x06,0x04,0x06,0x04,0x06,0x04,0x81,0x06,0x83,0x04,0x00,0x06,0x82,0x04,
+ 0x00,0x06,0x83,0x04,0x04,0x20,0x7e,0x75,0x96,0x06,0x81,0x04,0x07,0x06,0x8b,0xd8,0x7e,0xd8,0x5c,0x06,0x04,0x81,0x06,0x00,0x5e,0x88,0x07,0x02,0x45,0x3d,
+ 0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x82,0x00,0x00,0x27,0x8a,0x0c,0x00,0x18,0x86,0x00,0x01,0x4c,0x62,0x84,0x00,
+ 0x03,0x3a,0xaa,0x7c,0x52,0x8b,0x01,0x08,0x45,0x7f,0x92,0x88,0x90,0x88,0x37,0xb5,0x45,0x9d,0x01,0x02,0x46,0x3d,0x35,0x8e,0x0d,0x02,0x07,0x72,0x45,0x8d,
+ 0x01,0x94,0x0d,0x06,0x35,0x88,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,0x83,0x04,0x01,0x06,0x04,0x81,0x06,0x00,0x04,0x82,0x06,0x83,0x04,0x02,0x06,0x04,0x06,
+ 0x83,0x04,0x01,0x06,0x04,0x83,0x06,0x85,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x02,0xd8,0x9c,0xcb,0x81,0x06,0x0b,0x04,0x06,0xcb,0x06,0x9c,0x20,0xcb,0x06,
+ 0x04,0x06,0x04,0x5e,0x88,0x07,0x02,0x45,0x3d,0x4e,0x89,0x07,0x0a,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x81,0x00,0x00,0x41,0x81,0x03,
+ 0x03,0x11,0x03,0x11,0x03,0x82,0x11,0x82,0x03,0x02,0x11,0x1b,0x08,0x84,0x00,0x01,0x4c,0x62,0x84,0x00,0x03,0x3a,0x36,0x7c,0x52,0x83,0x01,0x01,0xd1,0x86,
+ 0x81,0xfd,0x01,0xea,0xd3,0x86,0x01,0x01,0xd3,0xfe,0x83,0xfd,0x01,0xd7,0xd3,0x8b,0x01,0x03,0x54,0x7f,0x92,0x4e,0x83,0x01,0x02,0x92,0x7f,0x2e,0x82,0x01,
+ 0x02,0xb5,0x90,0x35,0x8e,0x0d,0x02,0x01,0xa0,0x80,0x8d,0x01,0x94,0x0d,0x07,0x35,0x88,0xfc,0x86,0xe7,0x07,0x50,0x06,0x85,0x04,0x00,0x06,0x82,0x04,0x04,
+ 0x06,0x04,0x06,0x04,0x06,0x82,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x83,0x04,0x00,0x06,0x8a,0x04,0x02,0x06,0x20,0x5c,0x81,0x8b,0x00,0x06,0x81,0x04,0x05,
+ 0x06,0x8b,0x06,0x47,0x8b,0x05,0x81,0x04,0x02,0x06,0x04,0x5e,0x88,0x07,0x02,0x45,0x3d,0x54,0x89,0x16,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,
+ 0x8d,0x09,0x00,0x0c,0x03,0xbb,0x8a,0x65,0x02,0xbb,0x03,0x26,0x84,0x00,0x01,0x4c,0x62,0x84,0x00,0x03,0x68,0x33,0x3d,0x63,0x82,0x7c,0x01,0x4e,0xe0,0x83,
+ 0xf7,0x00,0xfe,0x85,0x7c,0x01,0x4e,0xfd,0x84,0xf7,0x01,0x10,0xea,0x8a,0x01,0x04,0x45,0x72,0x20,0x50,0x3d,0x83,0x80,0x81,0x20,0x01,0x6e,0x45,0x81,0x01,
+ 0x02,0x72,0xb5,0x35,0x8e,0x0d,0x02,0x0b,0x7f,0x80,0x8d,0x01,0x94,0x0d,0x06,0x35,0x88,0x19,0xd7,0xd1,0x07,0x50,0x81,0x06,0x81,0x04,0x02,0x06,0x04,0x06,
+ 0x83,0x04,0x01,0x06,0x04,0x81,0x06,0x81,0x04,0x01,0x06,0x04,0x81,0x06,0x00,0x04,0x83,0x06,0x81,0x04,0x01,0x06,0x04,0x82,0x06,0x82,0x04,0x02,0x06,0x04,
+ 0x06,0x81,0x04,0x01,0xd8,0x5c,0x81,0x50,0x81,0x06,0x06,0x04,0x06,0x8b,0xcb,0x47,0x9c,0x5c,0x82,0x04,0x01,0x06,0x5e,0x88,0x07,0x00,0x45,0x81,0x2e,0x88,
+ 0x46,0x0f,0x01,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x9c,0x8a,0x12,0x02,0x60,0x03,0x3f,0x84,0x00,0x01,0x4c,0x62,0x84,
+ 0x00,0x03,0x64,0x9a,0x7e,0x42,0x83,0x47,0x84,0xf8,0x00,0x4c,0x86,0x47,0x00,0x4c,0x83,0xf8,0x02,0xf1,0x10,0x86,0x8a,0x01,0x01,0x54,0x47,0x81,0x8b,0x00,
+ 0x47,0x83,0xa0,0x03,0x5c,0x8b,0x05,0x2e,0x81,0x01,0x02,0x88,0x78,0x35,0x8e,0x0d,0x02,0x16,0x92,0x80,0x8d,0x01,0x94,0x0d,0x07,0x35,0x88,0xd4,0x5d,0xe9,
+ 0x07,0x50,0x06,0x88,0x04,0x81,0x06,0x03,0x04,0x06,0x04,0x06,0x82,0x04,0x04,0x06,0x04,0x06,0x04,0x06,0x81,0x04,0x00,0x06,0x89,0x04,0x00,0x06,0x82,0x04,
+ 0x04,0x50,0x9c,0x96,0x9c,0x06,0x81,0x04,0x06,0x06,0x96,0x7e,0x50,0xd8,0x96,0x04,0x82,0x06,0x00,0x5e,0x88,0x07,0x00,0x45,0x8a,0x2e,0x0f,0x45,0x2e,0x13,
+ 0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x06,0x8a,0x12,0x02,0xa1,0x11,0x3f,0x84,0x00,0x01,0x4c,0x62,0x83,0x00,0x02,0x7a,0x3e,0x47,
+ 0x97,0x05,0x02,0x85,0xe0,0xd1,0x8a,0x01,0x00,0x46,0x8a,0x05,0x00,0x3d,0x81,0x01,0x02,0x78,0x7f,0x35,0x8e,0x0d,0x02,0x01,0x37,0x80,0x8d,0x01,0x94,0x0d,
+ 0x06,0x35,0x88,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,0x81,0x04,0x00,0x06,0x87,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x8c,0x04,0x00,0x06,0x81,0x04,0x00,0x06,
+ 0x85,0x04,0x00,0xcb,0x81,0x75,0x00,0x96,0x81,0x06,0x06,0x04,0x06,0x75,0x06,0x8b,0x5c,0x8b,0x83,0x04,0x00,0x5e,0x88,0x07,0x00,0x16,0x87,0x0b,0x12,0x01,
+ 0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x1c,0x8d,0x09,0x00,0x4a,0x03,0x06,0x8a,0x12,0x02,0xa1,0x11,0x3f,0x84,0x00,0x01,0x4c,0x62,0x83,
+ 0x00,0x01,0x3a,0x8a,0x98,0x05,0x01,0x47,0x78,0x81,0x88,0x00,0x46,0x88,0x01,0x00,0x46,0x81,0x05,0x06,0x47,0x92,0x01,0x63,0x07,0x72,0x47,0x81,0x05,0x00,
+ 0x3d,0x81,0x01,0x02,0x3d,0x72,0x35,0x8e,0x0d,0x02,0x16,0xb5,0x45,0x8d,0x01,0x94,0x0d,0x09,0x35,0x88,0xd4,0xe0,0xd7,0x07,0x50,0x06,0x04,0x06,0x84,0x04,
+ 0x81,0x06,0x83,0x04,0x81,0x06,0x84,0x04,0x01,0x06,0x04,0x81,0x06,0x84,0x04,0x00,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x82,0x06,0x01,0x04,0x7e,0x81,0x06,
+ 0x02,0x50,0x06,0x04,0x81,0x06,0x04,0x8b,0xd8,0x47,0x9c,0x5c,0x83,0x04,0x00,0x5e,0x91,0x07,0x12,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,
+ 0x09,0xbd,0x94,0xe2,0x9b,0x8d,0xbc,0x06,0x8a,0x12,0x02,0xa1,0x95,0x8d,0x84,0x9b,0x01,0x57,0x62,0x83,0x00,0x02,0x3a,0x8a,0xda,0x98,0x05,0x82,0x50,0x00,
+ 0x37,0x88,0x01,0x04,0x46,0x05,0x47,0x78,0x52,0x83,0x69,0x03,0x4e,0x47,0x05,0x78,0x81,0x31,0x02,0x6e,0x37,0x35,0x8e,0x0d,0x02,0x45,0x47,0x80,0x8d,0x01,
+ 0x94,0x0d,0x09,0x35,0x88,0x3d,0xd1,0x84,0x07,0x50,0x06,0x04,0x06,0x83,0x04,0x00,0x06,0x98,0x04,0x00,0x06,0x82,0x04,0x82,0x06,0x01,0x04,0x7e,0x81,0x9c,
+ 0x01,0x75,0x06,0x81,0x04,0x05,0x06,0x75,0xa0,0x05,0xd8,0x75,0x82,0x04,0x01,0x06,0x5e,0x91,0x07,0x12,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,
+ 0x03,0x09,0x3b,0x89,0xa7,0x74,0x71,0xdd,0x99,0x8a,0x12,0x02,0x60,0xb2,0x71,0x84,0x74,0x01,0x3e,0x3a,0x83,0x00,0x02,0x3a,0x8a,0x47,0x98,0x05,0x82,0x50,
+ 0x00,0x37,0x88,0x01,0x03,0x46,0x05,0x47,0x0d,0x84,0x69,0x03,0x52,0x92,0x05,0x90,0x81,0x8b,0x02,0x80,0x2e,0x35,0x8e,0x0d,0x01,0x01,0x7c,0x8e,0x01,0x94,
+ 0x0d,0x06,0x35,0x88,0xd4,0x5d,0xee,0x07,0x50,0x81,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x00,0x06,0x82,0x04,0x00,
+ 0x06,0x81,0x04,0x01,0x06,0x04,0x81,0x06,0x03,0x04,0x06,0x04,0x06,0x82,0x04,0x00,0x06,0x82,0x04,0x01,0x06,0x04,0x81,0x06,0x01,0x04,0xd8,0x81,0x50,0x02,
+ 0xd8,0x06,0x04,0x81,0x06,0x00,0x50,0x82,0x5c,0x00,0x7e,0x81,0x04,0x81,0x06,0x00,0x5e,0x91,0x07,0x13,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,
+ 0x03,0x09,0x08,0x11,0x09,0x00,0x18,0x03,0xb2,0xc0,0x88,0x25,0x03,0xa7,0xbe,0x03,0x0c,0x8a,0x00,0x02,0x3a,0x71,0xda,0x98,0x05,0x82,0x42,0x00,0xb5,0x88,
+ 0x01,0x02,0x46,0x05,0x90,0x86,0x69,0x07,0x54,0x05,0x78,0x42,0x92,0x01,0x3d,0x63,0x8e,0x0d,0x90,0x01,0x94,0x0d,0x07,0x35,0x88,0xd4,0x5d,0xe9,0x07,0x50,
+ 0x06,0x82,0x04,0x81,0x06,0x84,0x04,0x04,0x06,0x04,0x06,0x04,0x06,0x81,0x04,0x00,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x03,0x06,0x04,0x06,0x04,
+ 0x81,0x06,0x01,0x04,0x06,0x82,0x04,0x81,0x06,0x04,0x20,0x7e,0x75,0x50,0x06,0x81,0x04,0x01,0x06,0x20,0x82,0x8b,0x01,0x20,0x04,0x81,0x06,0x01,0x04,0x5e,
+ 0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x11,0x09,0x81,0x00,0x01,0x09,0x43,0x8a,0x03,0x01,0x43,0x09,0x8b,0x00,
+ 0x02,0x3a,0x71,0xda,0x98,0x05,0x82,0x20,0x00,0x42,0x88,0x01,0x02,0x46,0x05,0x6e,0x86,0x69,0x07,0x7c,0x05,0x90,0x88,0x92,0x01,0x88,0x07,0x81,0x38,0x81,
+ 0x1e,0x03,0x1a,0x1e,0x38,0x1e,0x81,0x38,0x06,0x1e,0x38,0x1e,0x38,0x1e,0x7c,0x3d,0x8e,0x01,0x94,0x0d,0x06,0x35,0x88,0xd4,0x5d,0xe9,0x07,0x50,0x81,0x06,
+ 0x85,0x04,0x81,0x06,0x83,0x04,0x01,0x06,0x04,0x81,0x06,0x84,0x04,0x81,0x06,0x81,0x04,0x00,0x06,0x81,0x04,0x81,0x06,0x85,0x04,0x81,0x06,0x01,0x04,0x8b,
+ 0x81,0x06,0x00,0x50,0x81,0x06,0x07,0x04,0x06,0x96,0x75,0xa0,0x7e,0x05,0x06,0x81,0x04,0x01,0x06,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,
+ 0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,0x00,0x08,0x8a,0x14,0x00,0x08,0x82,0x00,0x00,0x4f,0x88,0x00,0x02,0x3b,0x74,0xda,0x99,0x05,0x81,0x47,
+ 0x00,0x92,0x88,0x01,0x02,0x46,0x05,0x92,0x86,0x69,0x06,0x7c,0x05,0x31,0xa0,0x90,0x01,0x7c,0x81,0x54,0x0d,0xb5,0x37,0x42,0x78,0x05,0x92,0x42,0x90,0xb5,
+ 0x05,0x92,0xa0,0x54,0x2e,0x81,0x5e,0x00,0x45,0x8d,0x01,0x94,0x0d,0x06,0x35,0x88,0x3d,0x8f,0xd3,0x07,0x50,0x82,0x06,0x82,0x04,0x00,0x06,0x81,0x04,0x81,
+ 0x06,0x01,0x04,0x06,0x84,0x04,0x82,0x06,0x82,0x04,0x00,0x06,0x85,0x04,0x01,0x06,0x04,0x83,0x06,0x81,0x04,0x05,0x06,0x04,0x75,0x20,0x96,0x50,0x81,0x06,
+ 0x83,0x04,0x03,0x8b,0x9c,0x5c,0x04,0x82,0x06,0x02,0x5e,0x07,0x16,0x81,0xd3,0x8e,0x45,0x0d,0x46,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,
+ 0x03,0x09,0x92,0x00,0x00,0x77,0x81,0x9b,0x00,0x28,0x85,0x00,0x02,0x68,0x6a,0xda,0x98,0x05,0x00,0x42,0x81,0x37,0x00,0xb5,0x88,0x01,0x02,0x46,0x05,0x92,
+ 0x86,0x69,0x04,0x7c,0x05,0x7f,0x31,0x6e,0x83,0x01,0x00,0x7c,0x81,0x4e,0x02,0x7c,0x54,0x7c,0x81,0x4e,0x03,0x7c,0x54,0x7c,0x54,0x81,0x01,0x81,0x72,0x8e,
+ 0x01,0x94,0x0d,0x06,0x35,0x88,0xd4,0xe1,0xd7,0x07,0x50,0x82,0x06,0x83,0x04,0x81,0x06,0x83,0x04,0x81,0x06,0x83,0x04,0x00,0x06,0x82,0x04,0x82,0x06,0x84,
+ 0x04,0x00,0x06,0x84,0x04,0x00,0x06,0x81,0x04,0x07,0x06,0xd8,0x96,0x20,0x9c,0x06,0x04,0x06,0x82,0x04,0x02,0xd8,0x06,0xcb,0x83,0x04,0x05,0x5e,0x07,0x9e,
+ 0xee,0xd7,0x19,0x8d,0x3d,0x81,0x2e,0x0b,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,0x00,0x64,0x81,0x44,0x01,0x4c,0x3a,0x81,
+ 0x00,0x03,0x8a,0x6d,0x44,0x81,0x84,0x00,0x00,0x7b,0x81,0xbf,0x00,0x28,0x85,0x00,0x01,0xd9,0x6b,0x99,0x05,0x82,0xa0,0x00,0x6e,0x88,0x01,0x02,0x46,0x05,
+ 0x90,0x86,0x69,0x02,0x46,0x05,0xb5,0x81,0x5e,0xa1,0x01,0x00,0x88,0x82,0x72,0x00,0x6e,0x8c,0x54,0x00,0x4e,0x82,0x78,0x06,0x6e,0x78,0xd4,0x5d,0xe9,0x07,
+ 0x50,0x82,0x06,0x04,0x04,0x06,0x04,0x06,0x04,0x81,0x06,0x82,0x04,0x01,0x06,0x04,0x81,0x06,0x82,0x04,0x02,0x06,0x04,0x06,0x83,0x04,0x84,0x06,0x00,0x04,
+ 0x86,0x06,0x02,0x04,0x96,0x50,0x81,0x8b,0x82,0x06,0x06,0x04,0x06,0x04,0x06,0x04,0x06,0x04,0x81,0x06,0x03,0x04,0x5e,0x07,0x16,0x81,0xd1,0x8e,0x4e,0x81,
+ 0x2e,0x0b,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,0x04,0x15,0xb3,0xb6,0x44,0x3b,0x81,0x00,0x03,0xbd,0x1d,0x2d,0x98,0x84,
+ 0x00,0x03,0x2a,0x55,0x6a,0x51,0x85,0x00,0x02,0xd9,0x4c,0xda,0x98,0x05,0x00,0x8b,0x81,0x5c,0x00,0x7f,0x88,0x01,0x03,0x46,0x05,0x47,0x35,0x84,0x69,0x05,
+ 0x52,0x7f,0x05,0x78,0x6e,0x37,0xa5,0x01,0x01,0x7f,0x05,0x8b,0x50,0x01,0x37,0x88,0x82,0x4e,0x06,0x80,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x84,0x04,0x00,0x06,
+ 0x82,0x04,0x02,0x06,0x04,0x06,0x84,0x04,0x82,0x06,0x83,0x04,0x81,0x06,0x83,0x04,0x05,0x06,0x04,0x06,0x04,0x06,0x04,0x81,0x06,0x82,0x04,0x81,0x75,0x01,
+ 0xd8,0x06,0x8b,0x04,0x00,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,0x81,0x3e,0x01,0x4d,
+ 0x23,0x81,0x00,0x04,0x7a,0x6a,0x9b,0x39,0x1c,0x84,0x00,0x03,0x36,0x2a,0x4b,0x70,0x85,0x00,0x02,0x29,0x4c,0xda,0x98,0x05,0x82,0x37,0x00,0x78,0x88,0x01,
+ 0x04,0x46,0x05,0x47,0x78,0x52,0x83,0x69,0x05,0x54,0x47,0x05,0x88,0x4e,0x31,0xa5,0x01,0x01,0x7f,0x5c,0x8b,0x20,0x01,0x37,0x54,0x83,0x01,0x05,0xfc,0x86,
+ 0xe7,0x07,0x50,0x06,0x82,0x04,0x00,0x06,0x85,0x04,0x00,0x06,0x85,0x04,0x82,0x06,0x8c,0x04,0x00,0x06,0x85,0x04,0x04,0xcb,0x20,0x5c,0x7e,0x06,0x81,0x04,
+ 0x81,0x06,0x85,0x04,0x02,0x06,0x04,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x11,0x09,0x82,0x00,0x04,0x4d,
+ 0xaa,0x5b,0x57,0x0c,0x81,0x17,0x03,0x21,0x74,0x3e,0x4d,0x84,0x00,0x03,0x68,0x4f,0x3a,0x29,0x85,0x00,0x02,0x28,0x65,0xdb,0x98,0x05,0x00,0x50,0x81,0x75,
+ 0x00,0x90,0x88,0x01,0x01,0x46,0x05,0x81,0x47,0x04,0x7f,0x0b,0x1a,0x07,0x31,0x81,0x47,0x01,0x05,0x3d,0xa7,0x01,0x01,0x7f,0x5c,0x81,0x20,0x00,0x96,0x81,
+ 0x20,0x01,0x96,0x20,0x82,0x96,0x81,0x20,0x01,0x37,0x54,0x83,0x01,0x04,0x3d,0xe7,0xd1,0x07,0x50,0x81,0x06,0x81,0x04,0x00,0x06,0x86,0x04,0x01,0x06,0x04,
+ 0x81,0x06,0x00,0x04,0x81,0x06,0x83,0x04,0x83,0x06,0x81,0x04,0x00,0x06,0x84,0x04,0x83,0x06,0x05,0x04,0x06,0xcb,0x20,0x96,0xcb,0x84,0x06,0x81,0x04,0x00,
+ 0x06,0x83,0x04,0x01,0x06,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,0x04,0x70,0x6b,0x6c,
+ 0xe6,0x03,0x81,0x17,0x03,0xa3,0x85,0x2a,0x53,0x8e,0x00,0x01,0xa6,0x6d,0x98,0x05,0x01,0x47,0x90,0x81,0x5e,0x00,0x31,0x88,0x01,0x00,0x46,0x83,0x05,0x82,
+ 0x47,0x01,0x05,0x47,0x81,0x05,0x00,0x3d,0xa7,0x01,0x01,0x7f,0x5c,0x8b,0x20,0x01,0x37,0x54,0x83,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x83,0x04,0x02,
+ 0x06,0x04,0x06,0x85,0x04,0x00,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x83,0x04,0x02,0x06,0x04,0x06,0x88,0x04,0x07,0x06,0x04,0x06,0x04,0x20,0x9c,0x04,0x06,
+ 0x83,0x04,0x02,0x06,0x04,0x06,0x84,0x04,0x00,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x82,0x00,
+ 0x04,0x7d,0x67,0x91,0xbb,0x1b,0x81,0x58,0x03,0x5f,0x95,0x51,0x1c,0x8e,0x00,0x01,0xa6,0x30,0x99,0x05,0x82,0x8b,0x00,0x7f,0x88,0x01,0x04,0x54,0x47,0x8b,
+ 0x5c,0x47,0x83,0xa0,0x81,0x8b,0x01,0x05,0x3d,0xa7,0x01,0x01,0x7f,0x5c,0x8b,0x20,0x01,0x37,0x54,0x83,0x01,0x05,0xd4,0x5d,0xe9,0x07,0x50,0x06,0x81,0x04,
+ 0x82,0x06,0x88,0x04,0x01,0x06,0x04,0x82,0x06,0x00,0x04,0x82,0x06,0x00,0x04,0x82,0x06,0x84,0x04,0x81,0x06,0x82,0x04,0x00,0x06,0x82,0x04,0x02,0xcb,0xd8,
+ 0x04,0x81,0x06,0x00,0x04,0x82,0x06,0x81,0x04,0x00,0x06,0x83,0x04,0x00,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,
+ 0x08,0x11,0x09,0x82,0x00,0x0a,0x61,0x8a,0x21,0x96,0x26,0x53,0x73,0xaa,0x65,0x3e,0x4d,0x8e,0x00,0x01,0x4f,0x21,0x99,0x05,0x82,0x47,0x00,0x6e,0x88,0x01,
+ 0x04,0x45,0x72,0x20,0x50,0x88,0x83,0x7c,0x81,0x20,0x01,0x92,0x45,0xa7,0x01,0x01,0x7f,0x5c,0x8b,0x20,0x01,0x37,0x54,0x83,0x01,0x05,0xd4,0xe0,0xea,0x07,
+ 0x50,0x06,0x83,0x04,0x83,0x06,0x00,0x04,0x86,0x06,0x84,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x07,0x06,0x04,0x06,0x04,0x06,0x04,0x06,0x04,0x82,0x06,0x81,
+ 0x04,0x01,0x06,0xcb,0x81,0x06,0x00,0x9c,0x84,0x04,0x02,0x06,0x04,0x06,0x81,0x04,0x81,0x06,0x01,0x04,0x5e,0x91,0x07,0x0e,0x16,0x54,0x2e,0x45,0x2e,0x13,
+ 0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x11,0x09,0x82,0x00,0x01,0x49,0x57,0x81,0x94,0x06,0x00,0x0c,0x41,0x8d,0xe5,0x21,0x64,0x8e,0x00,0x01,0x28,0x2d,0x99,
+ 0x05,0x00,0xa0,0x81,0x42,0x00,0xb5,0x89,0x01,0x00,0x4e,0x81,0x7f,0x00,0x4e,0x83,0x01,0x81,0x7f,0x00,0x2e,0xa8,0x01,0x01,0x7f,0x42,0x8b,0x5c,0x01,0x5e,
+ 0x54,0x83,0x01,0x04,0x2e,0xd3,0x01,0x07,0x50,0xa8,0x06,0x00,0x8b,0x82,0x75,0x8c,0x06,0x02,0x5e,0x07,0x16,0x81,0x8f,0x00,0x54,0x8d,0x4e,0x81,0x2e,0x0b,
+ 0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x81,0x00,0x05,0x14,0x09,0x03,0x17,0x08,0x09,0x81,0x03,0x01,0x1b,0x08,0x81,0x0c,0x8e,0x00,
+ 0x02,0x68,0x6a,0xda,0x98,0x05,0x82,0x75,0x00,0x90,0xbd,0x01,0x8d,0x7f,0x01,0x90,0x4e,0x83,0x01,0x01,0x2e,0x0b,0x81,0x07,0x00,0x50,0xa8,0x06,0x00,0x96,
+ 0x8f,0x06,0x06,0x5e,0x07,0x83,0xd7,0xee,0x19,0x2e,0x82,0x3d,0x00,0x2e,0x84,0x3d,0x00,0x2e,0x82,0x3d,0x81,0x2e,0x12,0x45,0x2e,0x13,0x02,0x0a,0x15,0x14,
+ 0x03,0x09,0x08,0x03,0x09,0x00,0x08,0x43,0x03,0x1b,0x08,0x09,0x82,0x03,0x04,0x09,0x3a,0xa2,0x03,0x0c,0x8d,0x00,0x01,0x68,0x70,0x98,0x05,0x01,0x47,0x5e,
+ 0x81,0x7f,0x00,0x72,0xbe,0x01,0x8d,0x45,0x84,0x01,0x01,0xb5,0x01,0x81,0x07,0x00,0x78,0x96,0x42,0x02,0x87,0x42,0x87,0x9f,0x42,0x00,0x46,0x81,0x07,0x02,
+ 0x9e,0xd3,0x84,0x8f,0x45,0x0f,0x0b,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x0c,0x03,0x50,0x81,0x1f,0x00,0xb2,0x81,0x03,0x05,0xa4,
+ 0xc7,0x1f,0xc9,0x40,0x26,0x8d,0x00,0x02,0x3b,0x58,0xda,0x98,0x05,0x00,0x50,0x81,0x75,0x00,0x90,0xd1,0x01,0x01,0xb5,0x01,0x81,0x07,0x00,0xe7,0x81,0xee,
+ 0x01,0xe7,0xd1,0x82,0xee,0x00,0x01,0x82,0xee,0x01,0xd3,0xd7,0x81,0xee,0x01,0x8f,0xd1,0x81,0xee,0x02,0xd7,0x9d,0xea,0x81,0xee,0x01,0x84,0xd7,0x81,0xee,
+ 0x01,0xd1,0x8f,0x81,0xee,0x01,0xd7,0xd3,0x81,0xee,0x02,0xea,0x9d,0xd7,0x81,0xee,0x01,0xd1,0xe7,0x81,0xee,0x01,0xe7,0xd1,0x81,0xee,0x02,0xd7,0x9d,0xd7,
+ 0x81,0xee,0x01,0xd3,0xe7,0x81,0xee,0x00,0xd1,0x95,0x07,0x0e,0x2e,0x13,0x02,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x4a,0x03,0x04,0x81,0x0a,0x07,
+ 0x6a,0x17,0x03,0x95,0x2b,0x0a,0x2c,0x4f,0x8e,0x00,0x02,0x3a,0xff,0x47,0x98,0x05,0x00,0xa0,0x81,0x42,0x00,0xb5,0xd1,0x01,0x04,0xb5,0x01,0x16,0x07,0xeb,
+ 0x81,0x10,0x0a,0x86,0xe7,0xf7,0x10,0x5d,0x9d,0x5d,0x10,0x5d,0xd1,0xe1,0x81,0x10,0x01,0xe9,0xd7,0x81,0x10,0x02,0xe0,0xd1,0x5d,0x81,0x10,0x01,0xd1,0xe0,
+ 0x81,0x10,0x01,0xd7,0xea,0x81,0x10,0x01,0xe1,0x8f,0x81,0x10,0x02,0x5d,0xd1,0xe0,0x81,0x10,0x01,0xe7,0xeb,0x81,0x10,0x06,0xeb,0xe7,0x5d,0x10,0xe0,0xd1,
+ 0x5d,0x81,0x10,0x01,0x8f,0xeb,0x81,0x10,0x00,0xd7,0x85,0x16,0x03,0x83,0x16,0x83,0x16,0x86,0x83,0x00,0x01,0x83,0x54,0x0e,0x31,0x0a,0x02,0x0a,0x15,0x14,
+ 0x03,0x09,0x08,0x03,0x09,0x00,0x0c,0x03,0xfa,0x81,0x75,0x08,0x8d,0x14,0x17,0x95,0x9a,0x75,0x9a,0x26,0x09,0x8e,0x00,0x01,0x7d,0x47,0x98,0x05,0x00,0x42,
+ 0x81,0x37,0x00,0xb5,0xd1,0x01,0x04,0x3d,0x31,0x88,0x45,0x5f,0x81,0xf8,0x01,0x7d,0xd4,0x82,0xf8,0x00,0x7c,0x82,0xf8,0x01,0x46,0x53,0x81,0xf8,0x01,0x64,
+ 0x6e,0x82,0xf8,0x00,0x46,0x82,0xf8,0x00,0x4e,0x82,0xf8,0x01,0xd4,0x7d,0x81,0xf8,0x01,0x6a,0xd4,0x82,0xf8,0x00,0x4e,0x82,0xf8,0x01,0xd4,0x58,0x81,0xf8,
+ 0x01,0x8a,0xd4,0x82,0xf8,0x00,0x46,0x82,0xf8,0x01,0xd4,0x6a,0x81,0xf8,0x03,0x64,0x46,0x9f,0x1b,0x81,0x09,0x05,0x22,0x26,0x1b,0x18,0x11,0x26,0x81,0x08,
+ 0x04,0x29,0x3e,0x1c,0x7a,0xe2,0x83,0x0e,0x00,0x0f,0x81,0x02,0x0e,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x08,0xc3,0x88,0xe4,0x1e,0x6e,0x81,0x0c,
+ 0x05,0xe3,0x45,0xe4,0x01,0x89,0x0c,0x8e,0x00,0x01,0x7d,0x47,0x98,0x05,0x00,0x47,0x81,0xa0,0x00,0x6e,0xd5,0x01,0x00,0x37,0x81,0x75,0x01,0x7f,0x31,0x81,
+ 0x75,0x01,0x7e,0x7c,0x81,0x75,0x02,0x7e,0x46,0xa0,0x81,0x75,0x81,0x6e,0x81,0x75,0x02,0xa0,0x46,0x7e,0x81,0x75,0x01,0x4e,0x5c,0x81,0x75,0x01,0x31,0x92,
+ 0x81,0x75,0x01,0x37,0x88,0x81,0x75,0x02,0x8b,0x54,0x5c,0x81,0x75,0x01,0x3d,0x37,0x81,0x75,0x01,0x5e,0x72,0x81,0x75,0x02,0x05,0x54,0x8b,0x81,0x75,0x01,
+ 0x2e,0x42,0x81,0x75,0x12,0xb5,0x01,0x1e,0x17,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x00,0x7a,0x21,0x58,0x57,0x81,0x1c,0x86,0x02,0x07,0x0a,0x15,0x14,
+ 0x03,0x09,0x08,0x03,0x09,0x81,0x00,0x0c,0xbe,0x6e,0xe4,0x1e,0x42,0x95,0x0c,0xbb,0x4e,0x1e,0x45,0xf9,0x08,0x8d,0x00,0x02,0x3a,0x8a,0xda,0x97,0x05,0x00,
+ 0x5c,0x82,0x20,0x00,0x42,0xd5,0x01,0x00,0x7c,0x81,0x4e,0x81,0x80,0x82,0x4e,0x00,0x01,0x82,0x4e,0x01,0x45,0x7c,0x81,0x4e,0x81,0x80,0x81,0x4e,0x01,0x7c,
+ 0x45,0x82,0x4e,0x00,0x45,0x82,0x4e,0x81,0x80,0x81,0x4e,0x01,0x7c,0x45,0x82,0x4e,0x00,0x45,0x82,0x4e,0x01,0x45,0x7c,0x81,0x4e,0x01,0x7c,0x80,0x82,0x4e,
+ 0x00,0x45,0x82,0x4e,0x01,0x45,0x7c,0x81,0x4e,0x12,0x80,0x01,0x1e,0xfb,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x00,0x7a,0x6b,0x3b,0x51,0x74,0x1c,0x86,
+ 0x02,0x0b,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x18,0x8e,0x78,0x81,0x4e,0x04,0xdd,0x41,0x0c,0xc3,0x46,0x81,0x4e,0x01,0xd6,0x09,0x8d,0x00,0x02,
+ 0x3a,0x8a,0xda,0x97,0x05,0x01,0x47,0x5e,0x81,0x7f,0x00,0x31,0xff,0x01,0x92,0x01,0x09,0x1a,0x11,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x81,0x00,0x04,
+ 0x6a,0xa3,0x30,0x7b,0x1c,0x86,0x02,0x0b,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x4a,0x03,0x06,0x81,0x13,0x04,0xc0,0x41,0x0c,0x95,0x0a,0x81,0x13,
+ 0x01,0x95,0x1b,0x8d,0x00,0x02,0x3a,0x8a,0x47,0x98,0x05,0x82,0x75,0x00,0x90,0x8c,0x01,0x00,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x86,0x01,0x81,
+ 0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x86,
+ 0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x81,0x84,0x86,0x01,0x00,0x84,0x83,0x01,0x10,0x1e,0x11,0x3f,0x09,0x22,0x0c,0x1b,0x18,
+ 0x03,0x26,0x00,0x3a,0x2a,0x58,0x30,0x61,0x1c,0x86,0x02,0x0b,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x26,0x03,0x6d,0x81,0x12,0x04,0xc0,0x41,0x0c,
+ 0x95,0x76,0x81,0x12,0x01,0x95,0x1b,0x8d,0x00,0x02,0x3a,0x71,0x47,0x88,0x05,0x00,0x47,0x86,0x05,0x01,0x47,0x05,0x81,0x47,0x82,0x05,0x00,0x5c,0x82,0x20,
+ 0x00,0x42,0x8a,0x01,0x04,0xd3,0xeb,0xae,0xfe,0xd3,0x82,0x01,0x01,0x84,0xe7,0x81,0xe1,0x00,0xe7,0x83,0x01,0x04,0xd3,0xfe,0xae,0xfd,0xd3,0x83,0x01,0x04,
+ 0xd1,0xe1,0xae,0xd7,0x84,0x82,0x01,0x04,0x84,0xd7,0xae,0xe1,0xd1,0x83,0x01,0x04,0xd3,0xeb,0xae,0xfe,0xd3,0x83,0x01,0x00,0xe7,0x81,0xe1,0x01,0xe7,0x84,
+ 0x82,0x01,0x04,0xd3,0xfe,0xae,0xfd,0xd3,0x83,0x01,0x04,0xd1,0xe1,0xae,0xd7,0x84,0x82,0x01,0x04,0x84,0xea,0xae,0xe1,0xd1,0x83,0x01,0x04,0xd3,0xfd,0xe0,
+ 0xfe,0xd3,0x83,0x01,0x00,0xe7,0x81,0xe1,0x01,0xe7,0x84,0x82,0x01,0x04,0xd3,0xfe,0xae,0xfd,0xd3,0x83,0x01,0x04,0xd1,0xe1,0xae,0xd7,0x84,0x82,0x01,0x04,
+ 0x84,0xd7,0xae,0xe1,0xd1,0x83,0x01,0x04,0xd3,0xeb,0xae,0xfe,0xd3,0x81,0x01,0x09,0x16,0x11,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x81,0x00,0x04,0x67,
+ 0x61,0x49,0xec,0x1c,0x86,0x02,0x16,0x0a,0x15,0x14,0x03,0x09,0x08,0x11,0x09,0x00,0x18,0x03,0xdd,0x7d,0x25,0x95,0x41,0x0c,0xfb,0xbe,0x3e,0x91,0x17,0x22,
+ 0x8e,0x00,0x01,0x7d,0x47,0x97,0x05,0x01,0x47,0x6e,0x81,0x31,0x00,0x2e,0x86,0x01,0x04,0x54,0x6e,0x5e,0x46,0xe1,0x82,0x10,0x00,0xfe,0x82,0x01,0x01,0xd1,
+ 0xe0,0x81,0x10,0x00,0x5d,0x81,0x46,0x02,0x4e,0x54,0xfe,0x82,0x10,0x05,0xfd,0x2e,0x7c,0x3d,0xd3,0xe0,0x81,0x10,0x01,0xf7,0x8f,0x82,0x01,0x01,0xe7,0x5d,
+ 0x81,0x10,0x01,0xe0,0xd3,0x81,0x01,0x01,0x84,0xeb,0x82,0x10,0x05,0xea,0x46,0x7c,0x88,0xd3,0xe0,0x81,0x10,0x05,0xe0,0xd4,0x46,0x54,0x46,0xfe,0x82,0x10,
+ 0x05,0xeb,0x3d,0x46,0x54,0x46,0xe0,0x81,0x10,0x05,0x5d,0xd7,0x31,0x45,0x88,0xe7,0x82,0x10,0x05,0xe0,0xfc,0x2e,0x4e,0x46,0xe1,0x82,0x10,0x05,0xfe,0x72,
+ 0x4e,0x3d,0xd4,0x5d,0x81,0x10,0x05,0x5d,0xd3,0x88,0x4e,0x2e,0xfe,0x82,0x10,0x05,0xe1,0x2e,0x6e,0x92,0x4e,0xe0,0x81,0x10,0x01,0xf7,0xe7,0x81,0x7c,0x02,
+ 0x72,0xe7,0x5d,0x81,0x10,0x01,0xe0,0x84,0x81,0x01,0x01,0x84,0xe1,0x82,0x10,0x00,0xfe,0x81,0x01,0x09,0x1e,0xfb,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,
+ 0x85,0x00,0x00,0x1c,0x86,0x02,0x07,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x81,0x00,0x03,0xc1,0xbc,0x62,0xab,0x81,0x66,0x06,0x0c,0x26,0x9f,0x62,0x66,
+ 0x26,0x08,0x8d,0x00,0x02,0x3a,0x3e,0xda,0x83,0x05,0x82,0x47,0x00,0x05,0x81,0x47,0x84,0x05,0x81,0x47,0x00,0x05,0x81,0x47,0x01,0x05,0x47,0x81,0x05,0x02,
+ 0x85,0xe0,0xd1,0x88,0x01,0x04,0x46,0x05,0x7f,0x46,0xe0,0x82,0x10,0x04,0xe1,0xfc,0x5e,0x88,0xe7,0x83,0x10,0x04,0xd4,0x42,0x5e,0x78,0xeb,0x82,0x10,0x05,
+ 0xe0,0x90,0x5e,0x90,0xd4,0x5d,0x82,0x10,0x04,0xd7,0x31,0x7f,0x2e,0xd7,0x82,0x10,0x05,0xe0,0xd4,0x4e,0x6e,0x4e,0xe0,0x82,0x10,0x00,0xeb,0x82,0x5e,0x00,
+ 0xd7,0x82,0x10,0x05,0x5d,0xd4,0x42,0x5e,0xb5,0xe1,0x82,0x10,0x01,0xe0,0xb5,0x81,0x90,0x01,0x7d,0x5d,0x82,0x10,0x04,0xfe,0x37,0x7f,0xa0,0xfe,0x82,0x10,
+ 0x05,0x5d,0xff,0x37,0x90,0x6e,0xe0,0x82,0x10,0x04,0xeb,0x7f,0x90,0xa0,0xfe,0x83,0x10,0x01,0xe7,0x5c,0x81,0x5e,0x00,0xe1,0x82,0x10,0x05,0xe0,0xfc,0x05,
+ 0x47,0xd4,0x5d,0x82,0x10,0x04,0xfe,0xb5,0x92,0x42,0xfe,0x82,0x10,0x01,0x5d,0xd4,0x81,0x92,0x01,0x4e,0xe0,0x82,0x10,0x0c,0xe1,0x84,0x01,0x1a,0xfb,0x3f,
+ 0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x0c,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x08,0x96,0xbb,0x85,0x81,0x93,0x07,
+ 0x6a,0x5b,0x99,0xaf,0x6b,0x94,0x9a,0xbd,0x8e,0x00,0x04,0x4f,0xaf,0x50,0x75,0x50,0x82,0x75,0x85,0xf8,0x86,0x75,0x84,0xf8,0x02,0xf1,0x10,0xfe,0x88,0x01,
+ 0x04,0x54,0x42,0x37,0x46,0xe0,0x82,0x10,0x04,0xe1,0x90,0x92,0x7f,0xe7,0x83,0x10,0x04,0xd4,0x3d,0x45,0x7c,0xe1,0x82,0x10,0x05,0xe0,0xfc,0x45,0x80,0xd3,
+ 0x5d,0x82,0x10,0x04,0xfe,0x90,0x78,0x92,0xfe,0x82,0x10,0x05,0xe0,0x64,0x37,0x5e,0x78,0xe0,0x82,0x10,0x01,0xeb,0x72,0x81,0x3d,0x00,0xe7,0x82,0x10,0x05,
+ 0x5d,0xd4,0x54,0x31,0x54,0xe1,0x82,0x10,0x01,0xe0,0x2e,0x81,0x7f,0x01,0xd4,0x5d,0x82,0x10,0x04,0xfe,0x2e,0x54,0x2e,0x86,0x82,0x10,0x05,0x5d,0xd4,0x54,
+ 0x3d,0x46,0xe0,0x82,0x10,0x04,0xe1,0xfc,0x7c,0x3d,0xd7,0x83,0x10,0x04,0xe7,0x88,0x54,0x2e,0xe1,0x82,0x10,0x05,0xe0,0x7f,0x3d,0x78,0xd4,0x5d,0x82,0x10,
+ 0x04,0xfe,0x72,0x80,0xb5,0xfe,0x82,0x10,0x05,0x5d,0xff,0x37,0x78,0x31,0xe0,0x82,0x10,0x0c,0xe1,0x84,0x01,0x1e,0xfb,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,
+ 0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x09,0x0a,0x15,0x14,0x03,0x09,0x08,0x03,0x09,0x00,0x26,0x81,0xce,0x0a,0x4b,0x60,0xc0,0x6a,0x55,0xb1,0x9c,0x24,0x06,
+ 0xc0,0x89,0x8f,0x00,0x03,0xec,0x47,0x1e,0x46,0x82,0x2e,0x00,0xe0,0x83,0x10,0x00,0xfe,0x86,0x2e,0x00,0xeb,0x85,0x10,0x00,0xfe,0x88,0x01,0x04,0x31,0xb5,
+ 0x78,0xd4,0xe0,0x82,0x10,0x04,0xe1,0x88,0x72,0x54,0xe7,0x83,0x10,0x04,0x9b,0x42,0xb5,0x92,0xeb,0x82,0x10,0x05,0xe0,0x6e,0x92,0x6e,0xd4,0x5d,0x82,0x10,
+ 0x04,0xea,0x72,0x46,0x54,0xd7,0x82,0x10,0x05,0xe0,0xd1,0x72,0x31,0x4e,0xe0,0x82,0x10,0x04,0xeb,0x7f,0x5c,0x37,0xd7,0x82,0x10,0x05,0x5d,0xd4,0x7f,0x5e,
+ 0x90,0xe1,0x82,0x10,0x05,0xe0,0xb5,0x90,0x42,0x7d,0x5d,0x82,0x10,0x04,0xfe,0x37,0x6e,0x90,0x86,0x82,0x10,0x05,0x5d,0xff,0x42,0x92,0x6e,0xe0,0x82,0x10,
+ 0x04,0xeb,0x92,0x7f,0xa0,0xfe,0x83,0x10,0x00,0xe7,0x81,0x90,0x01,0x42,0xe1,0x82,0x10,0x05,0xe0,0xfc,0x05,0x42,0x46,0x5d,0x82,0x10,0x04,0xfe,0x92,0x8b,
+ 0x78,0xea,0x82,0x10,0x05,0x5d,0xd4,0x31,0x4e,0x54,0xe0,0x82,0x10,0x0c,0xe1,0x84,0x01,0x1a,0xfb,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x85,0x00,0x00,
+ 0x1c,0x86,0x02,0x0b,0x0a,0x15,0x14,0x03,0x09,0x00,0x1b,0x09,0x00,0x4a,0xce,0x04,0x81,0x2b,0x03,0xda,0x6a,0x55,0xa3,0x81,0x2b,0x02,0x0a,0xa7,0x64,0x8f,
+ 0x00,0x03,0x68,0xff,0x69,0x1e,0x82,0x01,0x01,0xe7,0xeb,0x81,0xe1,0x01,0x86,0xd3,0x86,0x01,0x01,0xd3,0xeb,0x83,0xe1,0x01,0xfe,0xd3,0x88,0x01,0x04,0x46,
+ 0x4e,0x7c,0x54,0xe1,0x82,0x10,0x00,0xfe,0x82,0x01,0x01,0xd1,0x5d,0x81,0x10,0x05,0x5d,0xd4,0x46,0x88,0x54,0xfe,0x82,0x10,0x05,0xeb,0x54,0x31,0x72,0xd3,
+ 0xe0,0x82,0x10,0x00,0xe7,0x82,0x01,0x01,0xe7,0x5d,0x81,0x10,0x01,0xe0,0xd3,0x81,0x01,0x01,0x84,0xe1,0x82,0x10,0x05,0xfe,0x72,0xb5,0x78,0xd1,0xe0,0x81,
+ 0x10,0x05,0xe0,0xd1,0x72,0x92,0x54,0xfe,0x82,0x10,0x05,0xe1,0x4e,0x5e,0x7f,0x46,0xe0,0x81,0x10,0x02,0x5d,0xd7,0x2e,0x81,0x80,0x00,0xd7,0x82,0x10,0x05,
+ 0xe0,0xfc,0x54,0x31,0x4e,0xe1,0x82,0x10,0x05,0xfe,0x4e,0x78,0x72,0xd1,0xf7,0x81,0x10,0x05,0x5d,0xd1,0x72,0x3d,0x46,0xfe,0x82,0x10,0x05,0xe1,0x72,0x46,
+ 0x88,0x4e,0xe0,0x82,0x10,0x05,0xd7,0xb5,0x7c,0x72,0xd7,0xf7,0x81,0x10,0x01,0xe0,0xd3,0x81,0x01,0x01,0x84,0xe1,0x82,0x10,0x0c,0xfe,0x01,0x16,0x1a,0x41,
+ 0x3f,0x09,0x22,0x0c,0x1b,0x18,0x11,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x0b,0x0a,0x15,0x14,0x03,0x09,0x29,0x33,0x9a,0xc6,0x8d,0xce,0x6d,0x81,0xad,0x0c,
+ 0x42,0x6a,0x55,0xa3,0x32,0xad,0x32,0x93,0x7d,0x4b,0x21,0x5a,0xec,0x8c,0x00,0x03,0x55,0x80,0x52,0x07,0xa3,0x01,0x04,0xd3,0xe1,0xe0,0xeb,0xd3,0x83,0x01,
+ 0x00,0xd7,0x81,0xe0,0x00,0xd7,0x83,0x01,0x04,0xd3,0xe1,0xe0,0xe1,0xd1,0x83,0x01,0x00,0xe7,0x81,0xe0,0x01,0x86,0x84,0x82,0x01,0x01,0x84,0x86,0x81,0xe0,
+ 0x00,0xe7,0x83,0x01,0x04,0xd1,0xe1,0xe0,0xeb,0xd3,0x83,0x01,0x00,0xd7,0x81,0xe0,0x00,0xd7,0x83,0x01,0x04,0xd3,0xeb,0xe0,0xe1,0xd3,0x83,0x01,0x00,0xe7,
+ 0x81,0xe0,0x01,0xfe,0x84,0x82,0x01,0x01,0x84,0xfe,0x81,0xe0,0x00,0xe7,0x83,0x01,0x04,0xd3,0xe1,0xe0,0xeb,0xd3,0x83,0x01,0x00,0xd7,0x81,0xe0,0x00,0xd7,
+ 0x83,0x01,0x04,0xd3,0xeb,0xe0,0xe1,0xd3,0x83,0x01,0x00,0xe7,0x81,0xe0,0x01,0xfe,0x84,0x82,0x01,0x01,0x84,0xfe,0x81,0xe0,0x00,0x8f,0x83,0x01,0x10,0xd3,
+ 0xe1,0xe0,0xeb,0xd3,0x16,0xa8,0x22,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x11,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x1a,0x0a,0x15,0x14,0x03,0x22,0x3a,0x21,
+ 0x93,0x6d,0x91,0xce,0xa5,0x02,0x0f,0xbe,0x6a,0x55,0xb1,0x1d,0x02,0x2b,0xc0,0x71,0x2a,0x82,0x30,0x5b,0x8d,0x00,0x01,0x6a,0x01,0xa5,0x52,0x01,0xa8,0xd0,
+ 0x86,0x52,0x81,0xd0,0x86,0x52,0x01,0xd0,0xa8,0x85,0x52,0x01,0xa8,0xd0,0x86,0x52,0x01,0xd0,0xa8,0x85,0x52,0x01,0xa8,0xd0,0x86,0x52,0x81,0xd0,0x86,0x52,
+ 0x01,0xd0,0xa8,0x85,0x52,0x01,0xa8,0xd0,0x86,0x52,0x01,0xd0,0xa8,0x85,0x52,0x01,0xa8,0xd0,0x86,0x52,0x81,0xd0,0x86,0x52,0x01,0xd0,0xa8,0x85,0x52,0x01,
+ 0xa8,0xd0,0x86,0x52,0x01,0xd0,0xa8,0x85,0x52,0x02,0xa8,0xd0,0x52,0x81,0xa8,0x0a,0x11,0x0c,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x11,0x26,0x85,0x00,0x00,
+ 0x1c,0x86,0x02,0x1a,0x0a,0x15,0x00,0x1b,0x03,0x0c,0x7d,0xc5,0xbb,0x09,0xce,0xa5,0x02,0x0f,0xbe,0x6a,0x55,0xb1,0x1d,0x02,0x2b,0xc0,0x71,0x1c,0x99,0x53,
+ 0x3b,0x8d,0x00,0x04,0x3b,0x55,0x66,0x22,0x95,0x97,0x66,0x00,0x95,0xb2,0x79,0x81,0xed,0x08,0xd6,0x79,0xed,0x66,0xd6,0x79,0x95,0x66,0x95,0x84,0x79,0x02,
+ 0x95,0x66,0x95,0x85,0x79,0x02,0x95,0x66,0xc2,0x84,0x79,0x02,0xd6,0x66,0x95,0x84,0x79,0x02,0xd6,0x66,0x95,0x85,0x79,0x0c,0xed,0x66,0xd6,0x79,0x95,0x66,
+ 0xc2,0x79,0xc2,0x66,0x95,0x79,0xd6,0x81,0x66,0x0c,0xd6,0x79,0x95,0x66,0xd6,0x79,0x95,0x66,0x95,0x79,0xd6,0x66,0xed,0x81,0x79,0x00,0xd6,0x81,0x66,0x14,
+ 0x95,0x79,0xed,0x66,0xed,0x27,0x66,0x40,0x7a,0x26,0x03,0x0c,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x0b,0x0a,0x15,
+ 0x00,0x27,0x17,0x22,0xc6,0x44,0x6f,0xdd,0xce,0x57,0x81,0x0a,0x0c,0xbe,0xb1,0xb2,0x53,0x4b,0x13,0x32,0xc0,0xff,0x6c,0x21,0x4b,0x49,0xa9,0x00,0x00,0x0c,
+ 0x81,0x03,0xb0,0x3c,0x0a,0x0c,0x08,0x1b,0x03,0x09,0x00,0x09,0x03,0x1b,0x08,0x26,0x81,0x03,0x00,0x11,0x81,0x03,0x02,0x22,0x08,0x26,0x82,0x03,0x81,0x11,
+ 0x03,0x03,0x09,0x08,0x3f,0x81,0x03,0x05,0x11,0x03,0x11,0x3c,0x14,0x18,0x83,0x03,0x05,0x11,0x17,0x14,0x18,0x43,0x11,0x83,0x03,0x1c,0x26,0x08,0x09,0x03,
+ 0x22,0x08,0x3f,0x03,0x1b,0x08,0x0c,0x03,0x17,0x27,0x00,0x41,0x03,0x22,0x08,0x09,0x03,0x17,0x08,0x0c,0x03,0x43,0x18,0x27,0x17,0x81,0x03,0x00,0x43,0x81,
+ 0x00,0x02,0x0c,0x11,0x18,0x85,0x00,0x0b,0x0c,0x03,0x0c,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x11,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x81,
+ 0x00,0x07,0x27,0x1b,0xb1,0xb4,0x64,0x62,0x4c,0x33,0x81,0x2b,0x03,0xf9,0xb1,0x9f,0xbf,0x82,0x2b,0x05,0xa7,0x7d,0x44,0x82,0x74,0x4f,0x86,0x00,0x04,0x29,
+ 0x70,0xb8,0x77,0x67,0x83,0x00,0x04,0x67,0x2a,0x33,0x53,0x68,0x93,0x00,0x03,0x0c,0x03,0x43,0x18,0x8c,0x00,0x04,0x1c,0x44,0xb8,0x70,0x3b,0x82,0x00,0x04,
+ 0x29,0x4d,0xb8,0x2a,0x49,0x93,0x00,0x0e,0x7a,0x58,0x30,0x77,0x91,0x11,0x03,0x3f,0x22,0xc3,0xe6,0xb8,0x6b,0x22,0x11,0x82,0x03,0x02,0x22,0x08,0x26,0x84,
+ 0x03,0x0c,0xdd,0x21,0x36,0x8a,0x8e,0x03,0x11,0x03,0xa4,0xa3,0x36,0x2d,0x66,0x83,0x03,0x03,0x17,0x27,0x18,0x43,0x82,0x03,0x22,0x11,0x9f,0xb4,0x5a,0xa5,
+ 0x95,0x22,0x08,0x3f,0x8e,0xff,0x36,0x2a,0xb2,0x17,0x18,0x00,0x22,0xb2,0xca,0x36,0xa3,0x8e,0x17,0x08,0x0c,0x03,0x43,0x18,0x14,0x17,0x03,0x0c,0x1b,0x43,
+ 0x81,0x00,0x04,0x0c,0x03,0x18,0x55,0x3e,0x83,0x00,0x0b,0x0c,0x03,0x0c,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x82,0x00,0x06,0x27,0x17,0x03,0x09,0x3f,0x40,0x21,0x81,0x12,0x03,0x8d,0x22,0x03,0xbc,0x82,0x12,0x02,0xbc,0xa2,0x3a,0x89,0x00,0x00,0x6d,0x82,
+ 0x02,0x01,0x0a,0x49,0x81,0x00,0x01,0x67,0x0a,0x81,0x02,0x01,0x0f,0x21,0x92,0x00,0x05,0x0c,0x03,0x43,0x18,0x27,0x3c,0x8a,0x17,0x01,0xdd,0x12,0x82,0x02,
+ 0x01,0x21,0x1b,0x81,0x17,0x00,0x9c,0x82,0x02,0x01,0x2c,0xc1,0x92,0x17,0x01,0x5f,0x8c,0x81,0x02,0x01,0x0e,0xe3,0x81,0x11,0x01,0xc3,0x76,0x82,0x02,0x01,
+ 0x6c,0x8e,0x81,0x03,0x02,0x41,0x08,0x26,0x82,0x03,0x81,0x11,0x01,0xbe,0x0a,0x81,0x02,0x01,0x0f,0xa5,0x81,0x03,0x01,0x8e,0x06,0x82,0x02,0x07,0xef,0xa4,
+ 0x11,0x03,0x17,0x27,0x18,0x43,0x81,0x11,0x81,0x03,0x01,0xd6,0x1f,0x82,0x02,0x05,0x60,0x7a,0x4a,0x17,0x94,0x0f,0x81,0x02,0x05,0x0a,0x7b,0x00,0x22,0xc1,
+ 0x0a,0x82,0x02,0x0c,0x21,0x00,0x0c,0x03,0x43,0x18,0x27,0x17,0x03,0x0c,0x00,0x1b,0x43,0x81,0x00,0x04,0x0c,0x03,0x18,0x81,0x2b,0x83,0x00,0x0b,0x0c,0x03,
+ 0x0c,0x41,0x3f,0x09,0x22,0x0c,0x1b,0x18,0x03,0x26,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x83,0x00,0x01,0x27,0x17,0x82,0x03,0x07,0xa4,0xc0,0xbe,
+ 0x03,0x17,0x1b,0x8e,0xa7,0x81,0xbb,0x01,0x8e,0x09,0x89,0x00,0x01,0x5b,0x0f,0x83,0x02,0x00,0xc6,0x81,0x00,0x00,0x77,0x83,0x02,0x01,0x0a,0x55,0x90,0x00,
+ 0x00,0x0c,0x81,0x03,0x02,0x18,0x14,0x17,0x84,0x03,0x00,0x22,0x85,0x0c,0x00,0x6c,0x83,0x02,0x03,0x0e,0x15,0x0c,0x91,0x84,0x02,0x00,0x57,0x91,0x0c,0x01,
+ 0xab,0x76,0x83,0x02,0x00,0x24,0x81,0x0c,0x00,0x57,0x84,0x02,0x04,0xc1,0x03,0x1b,0x08,0x26,0x85,0x03,0x00,0x30,0x83,0x02,0x03,0x0a,0x66,0x03,0xdd,0x84,
+ 0x02,0x02,0xaf,0x03,0x17,0x81,0x27,0x01,0x43,0x11,0x81,0x03,0x02,0x11,0x03,0x74,0x84,0x02,0x03,0xbd,0x03,0x66,0x2c,0x83,0x02,0x03,0x33,0x22,0x03,0x99,
+ 0x83,0x02,0x01,0x0f,0x5b,0x81,0x03,0x04,0x18,0x14,0x17,0x03,0x0c,0x81,0x00,0x01,0x1b,0x43,0x81,0x00,0x04,0x0c,0x03,0x18,0x3a,0xd9,0x83,0x00,0x09,0x0c,
+ 0x03,0x0c,0x41,0x3f,0x09,0x22,0x58,0x87,0x94,0x82,0x87,0x00,0xaf,0x81,0xda,0x02,0x56,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x85,0x00,0x02,0x14,0x27,0x3f,
+ 0x82,0x03,0x03,0x1b,0xe5,0x08,0x1b,0x82,0x03,0x01,0x22,0x29,0x89,0x00,0x00,0x64,0x84,0x02,0x00,0x1d,0x81,0x00,0x00,0x5a,0x83,0x02,0x01,0x0e,0x64,0x8f,
+ 0x00,0x00,0x18,0x81,0x03,0x05,0x18,0x14,0x17,0x11,0x03,0x11,0x81,0x03,0x02,0x09,0x00,0x18,0x84,0x0c,0x00,0x5a,0x84,0x02,0x02,0x49,0x0c,0x71,0x84,0x02,
+ 0x00,0x33,0x91,0x0c,0x01,0x62,0x13,0x83,0x02,0x03,0x2b,0xab,0x0c,0x30,0x84,0x02,0x03,0xa7,0x1b,0x08,0x26,0x82,0x03,0x00,0x11,0x81,0x03,0x01,0x22,0x1d,
+ 0x83,0x02,0x03,0x0f,0xbc,0x17,0x53,0x84,0x02,0x04,0xca,0x17,0x27,0x18,0x43,0x81,0x03,0x00,0x11,0x81,0x03,0x01,0x26,0x56,0x84,0x02,0x03,0x93,0x3c,0x55,
+ 0x0e,0x83,0x02,0x03,0x1d,0x03,0x22,0x24,0x84,0x02,0x0b,0xe3,0x03,0x18,0x14,0x17,0x03,0x0c,0x00,0x70,0x2a,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x85,
+ 0x00,0x07,0x0c,0x03,0x0c,0x41,0x3f,0x09,0x22,0x6a,0x87,0x01,0x02,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x05,0x7a,0x4f,0x74,0x36,0x2c,0x1f,
+ 0x81,0x3a,0x04,0x28,0x8a,0xb6,0x12,0x56,0x89,0x00,0x06,0x7b,0x02,0x1d,0x39,0x2a,0x48,0x1d,0x81,0x00,0x06,0x5a,0x48,0x77,0x21,0x1d,0x0e,0x64,0x8e,0x00,
+ 0x06,0x18,0x03,0x43,0x18,0x14,0x17,0x11,0x83,0x03,0x04,0x22,0x00,0x09,0x03,0x11,0x83,0x03,0x0e,0xc6,0x13,0x30,0x39,0x24,0x02,0x91,0x4a,0x71,0x02,0x24,
+ 0x39,0x2a,0x13,0x33,0x91,0x4a,0x04,0x3b,0x13,0x32,0x44,0x21,0x81,0x2b,0x0c,0xc1,0x4a,0x30,0x0e,0x30,0x39,0x24,0x02,0x58,0x08,0x0c,0x03,0x11,0x81,0x03,
+ 0x15,0x11,0x03,0x22,0x08,0x1d,0x2c,0xca,0x9a,0x4b,0x0f,0xab,0x14,0x61,0x0f,0x33,0xa5,0xc4,0x0e,0x99,0x27,0x18,0x17,0x84,0x03,0x1e,0x26,0x08,0x6b,0x0f,
+ 0x06,0x39,0x5a,0x0f,0x93,0x18,0x55,0x0e,0x1d,0x44,0x21,0x0a,0x1d,0x3c,0x00,0x24,0x13,0x6d,0x39,0x6f,0x02,0xe3,0x18,0x14,0x17,0x03,0x0c,0x81,0x00,0x03,
+ 0x9b,0x81,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x85,0x00,0x08,0x0c,0x03,0x0c,0x41,0x3f,0x09,0x22,0x6a,0x01,0x85,0x0b,0x03,0x01,0x87,0x00,0x1c,0x86,
+ 0x02,0x01,0x0a,0x15,0x86,0x00,0x02,0x55,0x36,0x13,0x82,0x02,0x03,0x1f,0x9b,0xb8,0x0a,0x82,0x02,0x00,0x56,0x89,0x00,0x06,0x7b,0x0e,0x57,0x1d,0x24,0x21,
+ 0x1d,0x81,0x00,0x06,0x5a,0xb3,0x24,0x1f,0x4d,0x48,0x64,0x8d,0x00,0x05,0x18,0x03,0x43,0x18,0x14,0x17,0x81,0x03,0x81,0x11,0x04,0x03,0x22,0x00,0x09,0x03,
+ 0x82,0x11,0x81,0x03,0x0f,0x1b,0x5a,0x39,0x24,0x4b,0x57,0x0a,0x1c,0x18,0x8a,0x0a,0x2d,0x4b,0x5a,0x30,0x33,0x91,0x18,0x12,0x28,0x0a,0x53,0x4b,0x32,0x2d,
+ 0x2b,0x3b,0x18,0x36,0x6c,0x5a,0xcc,0x82,0x12,0xa3,0x26,0x03,0x11,0x81,0x03,0x06,0x11,0x03,0x22,0x08,0x4a,0xc7,0x9a,0x81,0x4b,0x0c,0xa5,0x0a,0xec,0x27,
+ 0x5f,0x32,0xce,0xf2,0x30,0xa1,0x6c,0x18,0x17,0x81,0x11,0x82,0x03,0x1e,0x4a,0x08,0x09,0x94,0x4b,0xb3,0x1f,0x39,0x32,0x93,0x14,0xe5,0x0a,0x65,0xc7,0x1f,
+ 0x82,0x1d,0x09,0x14,0x60,0x57,0x4b,0x1f,0x21,0x0a,0x64,0x00,0x1b,0x03,0x0c,0x84,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x11,0x18,0x85,0x00,0x0a,0x0c,
+ 0x03,0x0c,0x41,0x3f,0x09,0x22,0x6a,0x01,0x1e,0xf5,0x81,0xf3,0x05,0xf5,0x63,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x08,0x64,0x0f,0x2b,
+ 0x5a,0x6f,0x0e,0x1f,0x4d,0x0e,0x82,0x1d,0x01,0x0e,0x56,0x89,0x00,0x06,0x7b,0x0e,0x65,0xb4,0x24,0x2a,0x1d,0x81,0x00,0x06,0x5a,0x36,0x39,0x33,0x53,0x48,
+ 0x64,0x8c,0x00,0x05,0x18,0x03,0x43,0x18,0x14,0x17,0x81,0x03,0x00,0x11,0x81,0x03,0x02,0x22,0x00,0x09,0x81,0x03,0x12,0x11,0x03,0x11,0x03,0x1b,0x08,0xa1,
+ 0x57,0xc4,0xa5,0xe6,0x0a,0xd5,0x43,0x25,0x48,0xda,0xaf,0x33,0x81,0x06,0x91,0x17,0x0f,0x66,0x0a,0x94,0x93,0x1d,0xdb,0x2b,0x95,0x17,0xc5,0x9c,0xca,0x99,
+ 0x50,0x12,0xbb,0x85,0x17,0x13,0x22,0x08,0x26,0x03,0xc7,0x9a,0xca,0x57,0xce,0x13,0xa6,0x17,0xb1,0xef,0xaf,0x93,0x06,0x4b,0x21,0x17,0x84,0x03,0x1e,0x4a,
+ 0x08,0x09,0x03,0xbf,0x1f,0x57,0x6d,0x82,0x12,0x93,0x14,0xe5,0x48,0x2d,0x53,0x1f,0x21,0x1d,0x09,0x14,0x60,0x44,0xb6,0x6c,0x6d,0x13,0x64,0x00,0x3c,0x17,
+ 0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,0x00,0x0c,0x3a,0x29,0x0c,0x03,0x0c,0x41,0x40,0x26,0x22,0x6a,0x0b,0x1a,0xd7,0x81,0xc8,0x05,
+ 0xac,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x8c,0x6b,0x5a,0x30,0x77,0x1f,0x4d,0x13,0x77,0x81,0x2d,0x4b,0x56,0x89,0x00,
+ 0x06,0x7b,0x0f,0x44,0x39,0x2a,0x1f,0x1d,0x81,0x00,0x06,0x5a,0xc7,0x56,0xd2,0x44,0x0e,0x64,0x8b,0x00,0x0d,0x18,0x43,0x03,0x18,0x14,0x17,0x03,0x11,0x03,
+ 0x11,0x03,0x22,0x08,0x09,0x82,0x03,0x00,0x11,0x81,0x03,0x11,0x1b,0x08,0x0c,0x33,0xc7,0x85,0xb4,0x99,0x0f,0x49,0x08,0x74,0x8c,0x39,0x57,0x6c,0x12,0x33,
+ 0x91,0x08,0x0f,0x4f,0x0a,0x2a,0x2d,0x2a,0xa1,0xdc,0x29,0x08,0x36,0x12,0x2d,0x21,0x2a,0x0e,0x70,0x85,0x08,0x01,0x00,0x26,0x81,0x03,0x0e,0xc7,0x60,0xbf,
+ 0xb6,0x30,0x0e,0xc1,0x03,0xb1,0x0a,0x85,0x65,0x44,0x0a,0xca,0x84,0x03,0x07,0x3f,0x08,0x09,0x03,0x1b,0x2d,0x12,0x56,0x81,0x21,0x15,0x13,0x93,0x14,0xe5,
+ 0x13,0x2a,0x56,0x2a,0xc7,0x1d,0x09,0x14,0x60,0x1d,0x56,0x44,0x30,0x0f,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,
+ 0x00,0x0c,0x4f,0x24,0x64,0x03,0x18,0x8d,0x33,0xab,0x22,0x6a,0x0b,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,
+ 0x00,0x07,0x64,0x0e,0x58,0x0f,0x32,0x44,0x1f,0x4d,0x81,0x02,0x03,0xaa,0x4b,0x1d,0x56,0x89,0x00,0x06,0x7b,0x02,0x1d,0x2a,0xbf,0x5a,0x1d,0x81,0x00,0x06,
+ 0x5a,0xdc,0x24,0x85,0x82,0x13,0x64,0x8a,0x00,0x05,0x18,0x43,0x03,0x18,0x14,0x17,0x81,0x03,0x81,0x11,0x03,0x03,0x22,0x08,0x3f,0x84,0x03,0x13,0x11,0x3c,
+ 0x08,0x0c,0x03,0xc6,0x2c,0xa1,0xaf,0xa7,0x0e,0xbd,0x09,0xa7,0x0f,0x1d,0x21,0x7d,0x24,0x06,0x91,0x22,0x0f,0xc1,0x13,0x32,0x36,0xaf,0x21,0x2b,0x66,0x22,
+ 0x9c,0x0a,0x6f,0x94,0x5f,0x0a,0xb1,0x85,0x22,0x13,0x1b,0x03,0x11,0x03,0xc7,0x2b,0x06,0x4c,0x82,0x0e,0xbc,0x11,0xb1,0x0e,0x24,0xb6,0x81,0xef,0xca,0x11,
+ 0x82,0x03,0x20,0x3f,0x00,0x09,0x03,0x1b,0x08,0x56,0x13,0x6f,0x2d,0x4c,0x0a,0x93,0x14,0xe5,0x0e,0x1f,0x36,0x81,0x33,0x1d,0x09,0x14,0x60,0x2c,0x24,0x53,
+ 0x61,0x0e,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,0x00,0x02,0x4f,0x2c,0x0e,0x81,0xb4,0x07,0x0e,0x0a,0xab,0x22,
+ 0x6a,0x0b,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x07,0x64,0x0f,0x24,0x0f,0x13,0x0e,0x1f,0x4d,0x81,
+ 0x02,0x81,0x0f,0x01,0x8c,0x56,0x89,0x00,0x06,0x7b,0x0f,0x4c,0x6b,0x24,0x0a,0x1d,0x81,0x00,0x81,0x5a,0x04,0x58,0x36,0x1f,0x0e,0x64,0x89,0x00,0x05,0x18,
+ 0x43,0x03,0x0c,0x08,0x17,0x84,0x03,0x02,0x22,0x08,0x3f,0x83,0x03,0x04,0x11,0x03,0x3c,0x08,0x0c,0x81,0x03,0x0e,0xc6,0x33,0x87,0x6d,0xc9,0x0f,0xdd,0x03,
+ 0x89,0x0e,0xc0,0xce,0x60,0x0a,0x06,0x91,0x09,0x0f,0xab,0x0a,0x82,0x85,0x60,0x12,0x2b,0x40,0x09,0x30,0x1f,0xff,0x96,0x1d,0x0f,0x74,0x89,0x09,0x0e,0x4b,
+ 0x5a,0x85,0x33,0xc9,0x0e,0xbc,0x03,0xb1,0x0a,0x6a,0x99,0x24,0x13,0xca,0x81,0x11,0x22,0x03,0x3f,0x00,0x09,0x03,0x1b,0x08,0x00,0x56,0x32,0x58,0x6d,0x1d,
+ 0x8c,0x93,0x14,0xe5,0x13,0x57,0x9a,0x24,0x12,0x1d,0x09,0x14,0x60,0x24,0xa3,0x30,0x1f,0x0f,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,
+ 0x0c,0x11,0x18,0x83,0x00,0x02,0x4f,0x2c,0x0f,0x82,0x02,0x06,0x0a,0xab,0x22,0x6a,0x0b,0x1a,0xb7,0x81,0xd7,0x05,0xe7,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,
+ 0x01,0x0a,0x15,0x86,0x00,0x04,0x64,0x0f,0xd2,0x7b,0x53,0x81,0x1f,0x06,0x4d,0x32,0x2a,0x12,0x33,0x1f,0x56,0x89,0x00,0x02,0x7b,0x0f,0x36,0x81,0x30,0x01,
+ 0x1f,0x1d,0x81,0x00,0x01,0x5a,0x1f,0x81,0x30,0x02,0x06,0x13,0x64,0x88,0x00,0x0d,0x18,0x43,0x03,0x0c,0x08,0x17,0x03,0x11,0x03,0x11,0x03,0x22,0x00,0x4a,
+ 0x83,0x03,0x11,0x11,0x03,0x3c,0x08,0x0c,0x03,0x11,0x03,0xc6,0xc9,0x6d,0x9c,0x33,0x8c,0xd5,0x09,0x74,0x0e,0x81,0x6d,0x02,0x9c,0x76,0x33,0x91,0x08,0x02,
+ 0x4f,0x48,0x33,0x81,0x30,0x06,0xc7,0xdc,0x29,0x08,0x36,0x12,0xc5,0x81,0x30,0x01,0x0e,0x70,0x89,0x08,0x81,0x1d,0x0c,0x30,0xc5,0xd8,0x0e,0xbc,0x03,0xb1,
+ 0x13,0x30,0xc5,0x6d,0xdc,0xca,0x81,0x03,0x05,0x09,0x00,0x3f,0x03,0x1b,0x08,0x81,0x00,0x01,0x56,0x2c,0x82,0x30,0x05,0x48,0x93,0x14,0xe5,0x13,0x33,0x81,
+ 0x30,0x81,0x1d,0x03,0x09,0x14,0x60,0x1f,0x81,0x30,0x05,0x33,0x0e,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,0x00,
+ 0x0b,0x4f,0x2c,0xca,0x0e,0xbb,0x85,0x0a,0xab,0x22,0x6a,0x01,0x07,0x83,0x1a,0x04,0x1e,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,
+ 0x0f,0x1d,0x53,0x2d,0x36,0x1f,0x4d,0x32,0x53,0x44,0x2d,0x1d,0x56,0x89,0x00,0x06,0x7b,0x0e,0x58,0x82,0x2d,0x98,0x1d,0x81,0x00,0x06,0x5a,0x44,0x2d,0x82,
+ 0x81,0x0a,0x64,0x87,0x00,0x00,0x18,0x81,0x03,0x05,0x0c,0x08,0x3c,0x11,0x03,0x11,0x81,0x03,0x02,0x41,0x00,0x4a,0x81,0x03,0x08,0x11,0x03,0x11,0x03,0x3c,
+ 0x08,0x0c,0x03,0x11,0x81,0x03,0x10,0xc6,0xa5,0xbf,0x82,0xa3,0x2c,0x91,0x00,0x74,0xdc,0xe3,0xa5,0x4d,0x44,0x06,0x03,0x11,0x81,0x03,0x00,0x11,0x8c,0x03,
+ 0x02,0x66,0x2c,0x25,0x81,0x85,0x0a,0xaf,0x12,0x95,0x03,0xc5,0x6b,0x94,0x85,0xa7,0xef,0xff,0x89,0x03,0x15,0xc7,0xce,0xbf,0x85,0xa7,0x0a,0xc1,0x43,0x70,
+ 0x1f,0x25,0x85,0x93,0x30,0xca,0x03,0x09,0x08,0x3f,0x03,0x1b,0x08,0x82,0x00,0x1a,0x56,0x24,0x4d,0x82,0x23,0x1f,0x93,0x14,0xe5,0x2c,0x70,0x82,0x56,0x82,
+ 0x1d,0x09,0x14,0x60,0x2d,0x56,0x82,0x53,0x0a,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x11,0x18,0x83,0x00,0x0a,0x4f,0x2c,0x9a,
+ 0x60,0x57,0xa5,0x0a,0xab,0x03,0x5f,0x0b,0x82,0x01,0x81,0x0b,0x04,0x01,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x21,0x1d,
+ 0x0e,0x0f,0x1f,0x4d,0x0e,0x12,0x0a,0x2c,0x0e,0x56,0x89,0x00,0x06,0x7b,0x0e,0x2d,0x12,0x6f,0x06,0x1d,0x81,0x00,0x06,0x5a,0x2a,0x6f,0x2b,0x2d,0x0e,0x64,
+ 0x86,0x00,0x05,0x18,0x43,0x03,0x0c,0x08,0x3c,0x81,0x03,0x00,0x11,0x81,0x03,0x02,0x41,0x08,0x4a,0x81,0x03,0x00,0x11,0x82,0x03,0x02,0x3c,0x14,0x0c,0x81,
+ 0x03,0x00,0x11,0x81,0x03,0x14,0xc6,0x6c,0x4b,0x12,0xa5,0x13,0x67,0x08,0x71,0x0a,0xa5,0x12,0xc5,0x04,0x06,0x09,0x41,0x03,0x11,0x3c,0x0c,0x8b,0x14,0x02,
+ 0x5b,0x0a,0x4c,0x81,0x32,0x0a,0x57,0x2b,0x29,0x14,0x36,0x30,0x33,0x12,0x21,0x0a,0x70,0x89,0x14,0x33,0x1d,0x39,0xcc,0x12,0x61,0x0e,0x55,0x08,0x61,0xef,
+ 0x85,0x12,0xb6,0xcc,0x50,0x09,0x08,0x3f,0x03,0x1b,0x08,0x00,0x81,0x3e,0x00,0x56,0x1d,0xd2,0x2b,0x21,0xdc,0x93,0x14,0xe5,0x0a,0x4d,0x12,0x1f,0x2a,0x1d,
+ 0x09,0x14,0x60,0xb3,0x4b,0x12,0x99,0x0e,0x64,0x00,0x3c,0x17,0x85,0x00,0x01,0x1b,0x43,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,0x00,0x0c,0x4f,0x2c,0x12,0x21,
+ 0x48,0x32,0x0a,0xab,0x03,0x71,0x01,0x0b,0x01,0x81,0x0b,0x82,0x01,0x02,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x39,0x53,0x4c,
+ 0x77,0x1f,0x4d,0x13,0x2a,0xb6,0x58,0x32,0x56,0x89,0x00,0x06,0x7b,0x02,0x6f,0x21,0x2a,0x13,0x1d,0x81,0x00,0x06,0x5a,0x0a,0x6c,0x2a,0xcc,0x0e,0x64,0x85,
+ 0x00,0x05,0x08,0x17,0x03,0x0c,0x08,0x1b,0x84,0x03,0x02,0x41,0x08,0x26,0x83,0x03,0x81,0x11,0x02,0x17,0x14,0x0c,0x81,0x03,0x18,0x11,0x03,0x11,0x03,0x33,
+ 0x13,0x6d,0x50,0xa1,0x02,0x67,0x09,0x89,0x02,0x5a,0x99,0xc4,0x0e,0x33,0x00,0x3f,0x03,0x1b,0x08,0x18,0x8b,0x09,0x02,0xab,0x13,0x1f,0x81,0x21,0x0a,0x0a,
+ 0x2b,0x40,0x09,0x30,0x8c,0x44,0x21,0x24,0x02,0x5f,0x89,0x09,0x13,0x1d,0x0a,0x6d,0x21,0x1d,0x0f,0x62,0x09,0x93,0x0f,0x30,0x50,0x6d,0x0f,0x21,0x08,0x3f,
+ 0x03,0x1b,0x08,0x81,0x00,0x81,0x39,0x1b,0x00,0x56,0x8c,0x2a,0x6d,0x24,0x02,0x93,0x14,0xe5,0x0e,0x1d,0x6c,0x44,0x48,0x1d,0x09,0x14,0x60,0x0e,0x2a,0x21,
+ 0x1d,0x02,0x64,0x00,0x3c,0x17,0x84,0x00,0x02,0x4a,0x03,0x1b,0x81,0x00,0x02,0x0c,0x03,0x18,0x83,0x00,0x0b,0x4f,0x2c,0x0a,0xc6,0x57,0x99,0x0a,0xab,0x03,
+ 0x71,0x01,0x16,0x83,0x1e,0x04,0x07,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x0a,0x39,0x33,0x2a,0x1f,0x4d,0x0e,0x2a,0x21,
+ 0x1f,0x0f,0x56,0x89,0x00,0x01,0x49,0x8c,0x83,0x02,0x00,0x60,0x81,0x00,0x00,0x36,0x83,0x02,0x01,0x13,0x1c,0x85,0x00,0x06,0x0c,0x03,0x09,0x08,0x1b,0x03,
+ 0x11,0x82,0x03,0x02,0x3c,0x08,0x26,0x82,0x03,0x81,0x11,0x03,0x03,0x17,0x08,0x0c,0x83,0x03,0x03,0x11,0x03,0x4a,0xb3,0x83,0x02,0x04,0x0e,0x62,0x03,0xbe,
+ 0x0f,0x83,0x02,0x05,0x2a,0x26,0x03,0x3c,0x14,0x0c,0x85,0x03,0x01,0x11,0x03,0x82,0x11,0x81,0x03,0x01,0x95,0x12,0x83,0x02,0x03,0x1f,0x26,0x1b,0x57,0x83,
+ 0x02,0x01,0x0f,0x25,0x89,0x1b,0x00,0x33,0x83,0x02,0x04,0x13,0xab,0x1b,0xa7,0x0f,0x83,0x02,0x04,0x82,0x3f,0x03,0x1b,0x08,0x82,0x00,0x81,0x3a,0x01,0x00,
+ 0x61,0x84,0x02,0x03,0xa7,0x14,0x62,0x0a,0x83,0x02,0x03,0x33,0x09,0x14,0x30,0x83,0x02,0x04,0x0e,0xbe,0x00,0x3c,0x17,0x83,0x00,0x03,0x4a,0x03,0x1b,0x08,
+ 0x81,0x00,0x02,0x22,0x03,0x18,0x83,0x00,0x0c,0x4f,0x2c,0xb4,0xbb,0x24,0x8c,0x0a,0xab,0x11,0x71,0x01,0x1a,0x9e,0x81,0xd1,0x05,0x9d,0x0d,0x0b,0x87,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x6d,0x6f,0xb3,0x2b,0x1f,0x4d,0x2c,0x53,0x2d,0x56,0x2b,0x56,0x8a,0x00,0x05,0x3e,0xcc,0x02,0x0f,
+ 0x2a,0x4f,0x81,0x00,0x06,0x4f,0x44,0x0f,0x02,0x32,0x7b,0x3a,0x85,0x00,0x01,0x0c,0x03,0x81,0x0c,0x83,0x03,0x04,0x11,0x03,0x1b,0x08,0x17,0x82,0x03,0x81,
+ 0x11,0x02,0x03,0x14,0x18,0x81,0x03,0x00,0x11,0x82,0x03,0x14,0x09,0x08,0x0c,0xe6,0x0e,0x02,0x32,0x25,0x03,0x22,0x00,0x25,0x1f,0x02,0x0f,0x39,0x08,0x03,
+ 0x3c,0x14,0x0c,0x84,0x03,0x00,0x11,0x81,0x03,0x00,0x11,0x82,0x03,0x00,0x11,0x81,0x03,0x01,0xb2,0xc7,0x81,0x02,0x01,0xb8,0x55,0x81,0x00,0x05,0x3b,0x4d,
+ 0x0e,0x02,0x12,0x81,0x8a,0x00,0x05,0x28,0x6c,0x0f,0x02,0x1d,0x67,0x81,0x00,0x09,0x3a,0x23,0x2c,0x02,0x0e,0x56,0x40,0x03,0x1b,0x08,0x86,0x00,0x1a,0x68,
+ 0x6b,0x0e,0x02,0x0a,0x71,0x1b,0x14,0x26,0xd5,0x1d,0x02,0x0f,0x2a,0x66,0x09,0x14,0xa2,0xb4,0x0f,0x02,0x32,0x8d,0x1b,0x00,0x3c,0x17,0x82,0x00,0x03,0x4a,
+ 0x03,0x1b,0x08,0x81,0x00,0x03,0x26,0x03,0x17,0x08,0x83,0x00,0x0c,0x4f,0x2c,0x0e,0x1d,0x21,0x57,0x0a,0xab,0x11,0x71,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,
+ 0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x02,0x64,0x0f,0x36,0x81,0x65,0x02,0x1d,0x1f,0x4d,0x84,0x02,0x00,0x56,0x88,0x00,0x00,0x5b,
+ 0x81,0x15,0x03,0x1c,0x44,0x4c,0x55,0x84,0x15,0x02,0xbf,0x30,0x49,0x87,0x15,0x01,0xd5,0x9f,0x81,0xd5,0x85,0x9f,0x02,0xc3,0x5b,0xc3,0x84,0x9f,0x02,0x66,
+ 0x5b,0xc1,0x85,0x9f,0x11,0xd5,0x62,0x9f,0xc1,0x5f,0x30,0xbd,0xc1,0xbc,0x5b,0xd5,0x66,0xdd,0x6c,0xa3,0x15,0x66,0xbc,0x81,0x5b,0x00,0xbc,0x8e,0x9f,0x04,
+ 0x29,0x55,0x57,0xda,0xc3,0x84,0xbc,0x02,0x6e,0x99,0xdd,0x8c,0xbc,0x03,0xc3,0xbb,0x50,0xc1,0x84,0xbc,0x06,0xbe,0x6d,0xc0,0xc3,0x66,0xbc,0x5b,0x89,0x15,
+ 0x13,0x8a,0x36,0x7b,0xb2,0x9f,0x5b,0x29,0x66,0x55,0x21,0x4c,0x15,0x9f,0x29,0x5b,0x66,0xb2,0x58,0x2a,0x64,0x81,0xc3,0x0e,0x3b,0x3c,0x17,0x00,0x3b,0x62,
+ 0x66,0xbc,0x5b,0x3a,0x00,0x0c,0x03,0x43,0x27,0x84,0x00,0x01,0x4f,0x2c,0x83,0x02,0x06,0x0a,0xab,0x03,0x71,0x0b,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,
+ 0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x07,0x64,0x0e,0x4d,0x1f,0x12,0x56,0x1f,0x4d,0x84,0x02,0x00,0x56,0x88,0x00,0x01,0x2a,0x87,0x85,0x37,
+ 0x81,0xaf,0x85,0x37,0x02,0x42,0x6a,0x42,0x85,0x37,0x81,0xaf,0x85,0x37,0x02,0x42,0x6a,0x42,0x85,0x37,0x01,0x6a,0x87,0x85,0x37,0x01,0x87,0xaf,0x85,0x37,
+ 0x02,0x42,0x6a,0x42,0x85,0x37,0x81,0xaf,0x86,0x37,0x00,0xbb,0x86,0x37,0x01,0x90,0x93,0x86,0x37,0x00,0x90,0x86,0x37,0x00,0xbb,0x86,0x37,0x81,0x90,0x86,
+ 0x37,0x00,0xbb,0x86,0x37,0x01,0xaf,0x87,0x85,0x37,0x02,0x87,0x6a,0x42,0x85,0x37,0x01,0x6a,0x42,0x85,0x37,0x01,0x87,0xaf,0x86,0x37,0x04,0x9c,0x59,0xc2,
+ 0x01,0x72,0x82,0x37,0x05,0xce,0x4c,0x0c,0x03,0x43,0x27,0x85,0x00,0x01,0x4f,0x2c,0x83,0x02,0x06,0x0a,0x15,0x1b,0x71,0x0b,0x1a,0xe8,0x81,0xcf,0x05,0xae,
+ 0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x07,0x64,0x0f,0x4c,0x6a,0x60,0xc6,0x1f,0x4d,0x84,0x02,0x00,0x56,0x87,0x00,0x01,0x08,0x72,
+ 0xb9,0x01,0x00,0x59,0xca,0x01,0x00,0x59,0x97,0x01,0x00,0x4e,0x86,0x01,0x01,0x7c,0x3d,0x81,0x03,0x00,0x27,0x86,0x00,0x01,0x4f,0x2c,0x83,0x02,0x05,0x0a,
+ 0xab,0x08,0x74,0x0b,0x38,0x83,0xf3,0x04,0x35,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x44,0x5a,0x0a,0x02,0x1f,0x4d,0x0f,
+ 0x36,0x21,0x33,0x0f,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,
+ 0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x00,
+ 0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,
+ 0x0b,0x84,0x16,0x82,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x83,0x16,0x00,
+ 0x0b,0x82,0x01,0x84,0x16,0x82,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x00,0x0b,0x83,0x16,0x00,0x0b,0x81,0x01,0x01,
+ 0x17,0x18,0x87,0x00,0x02,0x4f,0x2c,0x32,0x81,0x6d,0x04,0x1f,0x0a,0x66,0x22,0x6a,0x87,0x0b,0x02,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,
+ 0x64,0x0f,0x32,0x73,0x4c,0x2a,0x1f,0x4d,0x1f,0x44,0x2b,0x30,0x1d,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x01,0x1a,0x9e,0x81,0x9d,0x01,0xf3,0x1a,0x81,0x01,
+ 0x01,0x07,0xf3,0x81,0x9d,0x02,0x9e,0xf4,0x0b,0x81,0x01,0x01,0x0d,0x9e,0x81,0x9d,0x01,0xf5,0x07,0x81,0x01,0x01,0x38,0xf3,0x81,0x9d,0x01,0x9e,0x63,0x81,
+ 0x01,0x01,0x16,0xf4,0x82,0x9d,0x01,0xf4,0x16,0x81,0x01,0x01,0x1a,0xf6,0x81,0x9d,0x01,0xf6,0x1a,0x81,0x01,0x01,0x07,0xf5,0x81,0x9d,0x02,0x9e,0xf4,0x0b,
+ 0x81,0x01,0x01,0xf4,0x9e,0x81,0x9d,0x01,0xf3,0x1e,0x81,0x01,0x01,0x1e,0xf3,0x81,0x9d,0x01,0x9e,0x35,0x81,0x01,0x01,0x0b,0xd0,0x82,0x9d,0x01,0xf4,0x16,
+ 0x81,0x01,0x01,0x1a,0xf6,0x81,0x9d,0x01,0x9e,0x1a,0x81,0x01,0x01,0x16,0xf5,0x81,0x9d,0x02,0x9e,0xf4,0x0b,0x81,0x01,0x01,0x1a,0x9e,0x81,0x9d,0x01,0xf3,
+ 0x38,0x81,0x01,0x01,0x1e,0xf5,0x81,0x9d,0x06,0x9e,0xf4,0x0b,0x01,0x0b,0xf4,0x9e,0x81,0x9d,0x01,0xf5,0x07,0x81,0x01,0x01,0x38,0xf6,0x81,0x9d,0x01,0x9e,
+ 0x35,0x81,0x01,0x01,0x0b,0xf4,0x82,0x9d,0x01,0xf4,0x16,0x81,0x01,0x01,0x63,0x9e,0x81,0x9d,0x01,0xf6,0x38,0x81,0x01,0x01,0x07,0xf5,0x81,0x9d,0x06,0x9e,
+ 0xf4,0x0b,0x01,0x0b,0xf4,0x9e,0x81,0x9d,0x01,0xf5,0x1e,0x81,0x01,0x00,0x27,0x88,0x00,0x0c,0x4f,0x2c,0x65,0x4b,0x1d,0xa3,0x2c,0x66,0x11,0xb1,0x0b,0x01,
+ 0x0b,0x83,0x01,0x03,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x6d,0x70,0x33,0x2b,0x1f,0x4d,0x12,0x39,0x02,0x6d,0x32,0x56,
+ 0x87,0x00,0x00,0x40,0x81,0x01,0x01,0x38,0xae,0x81,0x97,0x01,0xe8,0x1a,0x81,0x01,0x01,0x07,0xd7,0x81,0x97,0x02,0xb9,0xf6,0x0b,0x81,0x01,0x01,0xd0,0xa9,
+ 0x81,0x97,0x01,0xd7,0x07,0x81,0x01,0x01,0x38,0xe8,0x81,0x97,0x01,0xae,0x35,0x81,0x01,0x06,0x16,0x9d,0xcf,0x97,0xcf,0x9e,0x16,0x81,0x01,0x01,0x63,0xfd,
+ 0x81,0x97,0x01,0xfd,0x1a,0x81,0x01,0x06,0x07,0xb7,0xcf,0x97,0xb9,0x9e,0x0b,0x81,0x01,0x01,0xf5,0xb9,0x81,0x97,0x01,0xd7,0x1e,0x81,0x01,0x01,0x1e,0xe8,
+ 0x81,0x97,0x01,0xc8,0x0d,0x81,0x01,0x01,0x0b,0xf4,0x82,0x97,0x01,0x8f,0x16,0x81,0x01,0x01,0x1a,0xfd,0x81,0x97,0x01,0xac,0x63,0x81,0x01,0x01,0x16,0xd1,
+ 0x81,0x97,0x02,0xa9,0x9e,0x0b,0x81,0x01,0x01,0x1e,0xae,0x81,0x97,0x01,0xd7,0x38,0x81,0x01,0x01,0x1e,0xe7,0x81,0x97,0x06,0xb9,0x9e,0x0b,0x01,0x0b,0xf6,
+ 0xb9,0x81,0x97,0x01,0xe7,0x07,0x81,0x01,0x01,0x38,0xfd,0x81,0x97,0x01,0xae,0x35,0x81,0x01,0x01,0x0b,0x9d,0x82,0x97,0x01,0x9d,0x16,0x81,0x01,0x01,0x35,
+ 0xac,0x81,0x97,0x01,0xfd,0x1a,0x81,0x01,0x01,0x07,0x8f,0x81,0x97,0x06,0xb9,0xf6,0x0b,0x01,0x0b,0xf6,0xc8,0x81,0x97,0x03,0xe7,0x38,0x01,0xde,0x89,0x00,
+ 0x0a,0x4f,0x2c,0x65,0xaf,0x60,0xe6,0x0a,0x66,0x03,0x71,0x0b,0x81,0x01,0x81,0x0b,0x82,0x01,0x02,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,
+ 0x64,0x0f,0xaa,0x44,0xd2,0xba,0x1f,0x4d,0x0a,0x21,0x0a,0x0e,0x02,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x01,0x38,0xc8,0x81,0x34,0x01,0xe8,0x1a,0x81,0x01,
+ 0x06,0x07,0xd7,0x2f,0x34,0xa9,0xf6,0x0b,0x81,0x01,0x05,0xd0,0x97,0x34,0x2f,0xd7,0x07,0x81,0x01,0x01,0x38,0x86,0x81,0x34,0x01,0xc8,0x35,0x81,0x01,0x01,
+ 0x16,0x9d,0x82,0x2f,0x01,0x9d,0x16,0x81,0x01,0x05,0x63,0xfd,0x34,0x2f,0xfd,0x1a,0x81,0x01,0x01,0x07,0xb7,0x81,0x2f,0x02,0xcf,0x9d,0x0b,0x81,0x01,0x01,
+ 0xf5,0xb9,0x81,0x34,0x01,0xd7,0x1e,0x81,0x01,0x01,0x1e,0xe8,0x81,0x34,0x01,0xb9,0x0d,0x81,0x01,0x01,0x0b,0xf4,0x82,0x34,0x01,0x8f,0x16,0x81,0x01,0x05,
+ 0x1a,0xfd,0x34,0x2f,0xae,0x63,0x81,0x01,0x06,0x16,0xd1,0x34,0x2f,0xcf,0x9e,0x0b,0x81,0x01,0x01,0x1e,0xae,0x81,0x2f,0x01,0xd7,0x38,0x81,0x01,0x0a,0x1e,
+ 0xe7,0x2f,0x34,0xb9,0x9e,0x0b,0x01,0x0b,0xf6,0xb0,0x81,0x34,0x01,0xe7,0x07,0x81,0x01,0x05,0x38,0xfd,0x34,0x2f,0xae,0x35,0x81,0x01,0x01,0x0b,0x9d,0x82,
+ 0x34,0x01,0x9d,0x16,0x81,0x01,0x05,0x35,0xac,0x34,0x2f,0xac,0x1a,0x81,0x01,0x01,0x07,0x8f,0x81,0x34,0x06,0xa9,0xf6,0x0b,0x01,0x0b,0xf6,0xb9,0x81,0x34,
+ 0x03,0xe7,0x38,0x01,0xde,0x89,0x00,0x0b,0x4f,0x2c,0x4b,0x30,0x1d,0xcc,0x0a,0x66,0x03,0x71,0x0b,0x1e,0x83,0x35,0x04,0x1a,0x0b,0x87,0x00,0x1c,0x86,0x02,
+ 0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x12,0x36,0x58,0x33,0x1f,0x4d,0x0f,0x36,0x4d,0xbf,0xef,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x01,0x38,0xc8,0x81,
+ 0x34,0x01,0xe8,0x1a,0x81,0x01,0x01,0x07,0xd7,0x81,0x34,0x02,0xa9,0xf6,0x0b,0x81,0x01,0x01,0xd0,0x97,0x81,0x34,0x01,0xd7,0x07,0x81,0x01,0x05,0x38,0x86,
+ 0x2f,0x34,0xc8,0x35,0x81,0x01,0x01,0x16,0x9d,0x82,0x2f,0x01,0x9d,0x16,0x81,0x01,0x01,0x63,0xfd,0x81,0x34,0x01,0xfd,0x1a,0x81,0x01,0x06,0x07,0xb7,0x2f,
+ 0x34,0xcf,0x9d,0x0b,0x81,0x01,0x05,0xf5,0xb9,0x2f,0x34,0xd7,0x1e,0x81,0x01,0x05,0x1e,0xe8,0x34,0x2f,0xb9,0x0d,0x81,0x01,0x02,0x0b,0xf4,0x2f,0x81,0x34,
+ 0x01,0x8f,0x16,0x81,0x01,0x01,0x1a,0xfd,0x81,0x34,0x01,0xae,0x63,0x81,0x01,0x01,0x16,0xd1,0x81,0x34,0x02,0xcf,0x9e,0x0b,0x81,0x01,0x01,0x1e,0xae,0x81,
+ 0x34,0x01,0xd7,0x38,0x81,0x01,0x0a,0x1e,0xe7,0x2f,0x34,0xb9,0x9e,0x0b,0x01,0x0b,0xf6,0xb0,0x81,0x34,0x01,0xe7,0x07,0x81,0x01,0x01,0x38,0xfd,0x81,0x34,
+ 0x01,0xae,0x35,0x81,0x01,0x01,0x0b,0x9d,0x82,0x34,0x01,0x9d,0x16,0x81,0x01,0x05,0x35,0xac,0x34,0x2f,0xac,0x1a,0x81,0x01,0x01,0x07,0x8f,0x81,0x34,0x06,
+ 0xa9,0xf6,0x0b,0x01,0x0b,0xf6,0xb9,0x81,0x34,0x05,0xe7,0x38,0x01,0xde,0x00,0x7b,0x87,0x00,0x0c,0x4f,0x2c,0x60,0xbb,0xca,0x74,0x0a,0x66,0x03,0x71,0x0b,
+ 0x1a,0xd7,0x81,0xc8,0x05,0xac,0x0d,0x01,0x87,0x00,0x4d,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x6a,0x65,0x06,0x32,0x1f,0x4d,0x0e,0x6b,0x4c,
+ 0xaa,0x0a,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x01,0x63,0x9d,0x81,0xb7,0x01,0x9e,0x1a,0x81,0x01,0x01,0x07,0xf3,0x82,0xb7,0x01,0x0d,0x0b,0x81,0x01,0x00,
+ 0xd0,0x82,0xb7,0x01,0x9e,0x07,0x81,0x01,0x01,0x38,0x9e,0x81,0xb7,0x01,0xd1,0x63,0x81,0x01,0x01,0x16,0xf5,0x82,0xb7,0x01,0xf5,0x16,0x81,0x01,0x01,0x63,
+ 0x9d,0x81,0xb7,0x01,0x9e,0x1a,0x81,0x01,0x01,0x07,0xf3,0x82,0xb7,0x01,0xf5,0x0b,0x81,0x01,0x00,0xf4,0x82,0xb7,0x01,0x9e,0x1e,0x81,0x01,0x01,0x1e,0x9e,
+ 0x81,0xb7,0x01,0xd1,0x0d,0x81,0x01,0x01,0x0b,0xd0,0x82,0xb7,0x01,0xf3,0x16,0x81,0x01,0x01,0x1a,0x9d,0x81,0xb7,0x01,0x9d,0x1a,0x81,0x01,0x01,0x16,0xf5,
+ 0x82,0xb7,0x01,0xf4,0x0b,0x81,0x01,0x01,0x63,0x9d,0x81,0xb7,0x01,0x9e,0x38,0x81,0x01,0x01,0x1e,0xf3,0x82,0xb7,0x04,0xf5,0x0b,0x01,0x0b,0xf4,0x82,0xb7,
+ 0x01,0x9e,0x07,0x81,0x01,0x01,0x38,0x9e,0x81,0xb7,0x01,0xd1,0x35,0x81,0x01,0x01,0x0b,0xd0,0x82,0xb7,0x01,0xd0,0x16,0x81,0x01,0x01,0x35,0x9d,0x81,0xb7,
+ 0x01,0x9d,0x1a,0x81,0x01,0x01,0x07,0xf3,0x82,0xb7,0x05,0xf4,0x0b,0x01,0x0b,0xf4,0xd1,0x81,0xb7,0x08,0xf3,0x38,0x01,0xde,0x00,0x2a,0x70,0x23,0x55,0x84,
+ 0x00,0x0c,0x4f,0x2c,0x02,0x30,0x9a,0x65,0x0a,0x66,0x03,0x71,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x4d,0x86,0x02,0x01,0x0a,0x15,0x86,
+ 0x00,0x02,0x64,0x0f,0x6d,0x81,0x44,0x08,0x6f,0x1f,0x4d,0x0e,0x24,0x2b,0x0a,0x0f,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,
+ 0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x81,0x01,0x00,0x0b,0x84,0x16,0x00,0x0b,0x81,0x01,0x85,0x16,0x81,0x01,0x00,
+ 0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x85,0x16,0x81,0x01,0x00,0x0b,0x84,
+ 0x16,0x00,0x0b,0x81,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,
+ 0x16,0x82,0x01,0x84,0x16,0x00,0x0b,0x81,0x01,0x00,0x0b,0x84,0x16,0x82,0x01,0x84,0x16,0x07,0x0b,0x01,0xde,0x00,0x71,0x23,0x73,0xe2,0x84,0x00,0x0c,0x4f,
+ 0x2c,0x02,0x8c,0x60,0x2c,0x0a,0xd5,0x03,0x71,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x4d,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,
+ 0x0e,0x51,0x44,0x39,0xb6,0x1f,0x4d,0x0a,0x39,0x3e,0x53,0x4b,0x56,0x87,0x00,0x00,0x40,0xff,0x01,0xa8,0x01,0x05,0xde,0x00,0x4b,0xbf,0x51,0x53,0x84,0x00,
+ 0x02,0x4f,0x2c,0x36,0x81,0x12,0x07,0xb6,0x0a,0x5b,0x26,0xbb,0x0b,0x1a,0xe7,0x81,0x86,0x05,0xea,0x0d,0x0b,0x87,0x00,0x53,0x86,0x02,0x01,0x0a,0x15,0x86,
+ 0x00,0x0d,0x64,0x8c,0xbf,0xba,0x36,0x33,0x1f,0x4d,0x0e,0x36,0x70,0x2d,0x1f,0x56,0x87,0x00,0x00,0x40,0xff,0x01,0xa8,0x01,0x05,0xde,0x00,0x57,0x4c,0x30,
+ 0x3e,0x84,0x00,0x02,0x4f,0x2c,0x9a,0x81,0xc5,0x06,0x53,0x0a,0xbc,0x0c,0x6a,0x0b,0x07,0x83,0x1a,0x04,0x38,0x0b,0xaf,0x7a,0x1c,0x86,0x02,0x01,0x0a,0x15,
+ 0x86,0x00,0x0d,0x64,0x0f,0x1d,0x57,0x6d,0x0e,0x1f,0x4d,0x13,0x36,0x1d,0xa1,0x02,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x00,0x1e,0x83,0x1a,0x00,0x07,0x81,
+ 0x01,0x00,0x16,0x83,0x1a,0x01,0x38,0x0b,0x81,0x01,0x84,0x1a,0x00,0x16,0x81,0x01,0x00,0x07,0x83,0x1a,0x00,0x1e,0x81,0x01,0x01,0x0b,0x38,0x83,0x1a,0x00,
+ 0x0b,0x81,0x01,0x00,0x1e,0x83,0x1a,0x00,0x1e,0x81,0x01,0x00,0x16,0x83,0x1a,0x01,0x38,0x0b,0x81,0x01,0x00,0x38,0x83,0x1a,0x00,0x07,0x81,0x01,0x00,0x07,
+ 0x83,0x1a,0x00,0x38,0x81,0x01,0x00,0x0b,0x84,0x1a,0x00,0x16,0x81,0x01,0x00,0x1e,0x83,0x1a,0x00,0x1e,0x81,0x01,0x00,0x0b,0x83,0x1a,0x01,0x38,0x0b,0x81,
+ 0x01,0x00,0x1e,0x83,0x1a,0x00,0x07,0x81,0x01,0x00,0x16,0x83,0x1a,0x01,0x38,0x0b,0x81,0x01,0x00,0x38,0x83,0x1a,0x00,0x16,0x81,0x01,0x00,0x07,0x83,0x1a,
+ 0x00,0x38,0x81,0x01,0x00,0x0b,0x84,0x1a,0x00,0x0b,0x81,0x01,0x00,0x1e,0x83,0x1a,0x00,0x07,0x81,0x01,0x00,0x16,0x83,0x1a,0x01,0x38,0x0b,0x81,0x01,0x00,
+ 0x38,0x83,0x1a,0x07,0x07,0x01,0xde,0x00,0x29,0x00,0x28,0x3a,0x84,0x00,0x03,0x4f,0x2c,0x0a,0x0e,0x81,0x13,0x03,0x0a,0x66,0x03,0x5b,0x86,0x01,0x03,0x0b,
+ 0xdd,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x8c,0x4c,0x21,0x56,0x77,0x1f,0x4d,0x2c,0x53,0x56,0x70,0x12,0x56,0x87,0x00,0x00,0x40,0x81,
+ 0x01,0x01,0x1a,0x86,0x81,0xac,0x01,0xe7,0x1a,0x81,0x01,0x01,0x07,0x8f,0x81,0xac,0x02,0xfd,0xf6,0x0b,0x81,0x01,0x01,0xd0,0xfd,0x81,0xac,0x01,0xb7,0x07,
+ 0x81,0x01,0x01,0x38,0xe7,0x81,0xac,0x01,0x86,0x35,0x81,0x01,0x01,0x16,0xf3,0x82,0xac,0x01,0xf3,0x16,0x81,0x01,0x01,0x63,0xd7,0x81,0xac,0x01,0xd7,0x1a,
+ 0x81,0x01,0x01,0x07,0x9d,0x81,0xac,0x02,0xfd,0x9e,0x0b,0x81,0x01,0x01,0xf5,0x86,0x81,0xac,0x01,0x8f,0x1e,0x81,0x01,0x01,0x1e,0xe7,0x81,0xac,0x01,0x86,
+ 0x0d,0x81,0x01,0x01,0x0b,0xd0,0x82,0xac,0x01,0x9d,0x16,0x81,0x01,0x01,0x1a,0xd7,0x81,0xac,0x01,0xea,0x63,0x81,0x01,0x01,0x16,0x9d,0x81,0xac,0x02,0xfd,
+ 0xf3,0x0b,0x81,0x01,0x01,0x38,0x86,0x81,0xac,0x01,0xb7,0x38,0x81,0x01,0x01,0x1e,0x9d,0x81,0xac,0x06,0xfd,0xf6,0x0b,0x01,0x0b,0xf5,0xfd,0x81,0xac,0x01,
+ 0xb7,0x07,0x81,0x01,0x01,0x38,0xd7,0x81,0xac,0x01,0xe8,0x35,0x81,0x01,0x01,0x0b,0x9e,0x82,0xac,0x01,0x9d,0x16,0x81,0x01,0x01,0x35,0xea,0x81,0xac,0x01,
+ 0xd7,0x1a,0x81,0x01,0x01,0x07,0x9d,0x81,0xac,0x06,0xfd,0xf5,0x0b,0x01,0x0b,0xf5,0x86,0x81,0xac,0x03,0xb7,0x38,0x01,0xde,0x89,0x00,0x09,0x4f,0x2c,0x44,
+ 0x4d,0x98,0x21,0x0a,0x62,0x03,0xfb,0x81,0x0b,0x84,0x01,0x03,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0e,0x2d,0x02,0x48,0xaa,
+ 0x1f,0x4d,0xcc,0x33,0x36,0x4b,0x24,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x05,0x38,0xc8,0x34,0x2f,0xe8,0x1a,0x81,0x01,0x06,0x07,0xd7,0x2f,0x34,0xa9,0xf6,
+ 0x0b,0x81,0x01,0x01,0xd0,0x97,0x81,0x2f,0x01,0xd7,0x07,0x81,0x01,0x01,0x38,0x86,0x81,0x34,0x01,0xc8,0x35,0x81,0x01,0x06,0x16,0x9d,0x2f,0x34,0x2f,0x9d,
+ 0x16,0x81,0x01,0x01,0x63,0xfd,0x81,0x34,0x01,0xfd,0x1a,0x81,0x01,0x01,0x07,0xb7,0x81,0x2f,0x02,0xcf,0x9d,0x0b,0x81,0x01,0x05,0xf5,0xb9,0x2f,0x34,0xd7,
+ 0x1e,0x81,0x01,0x05,0x1e,0xe8,0x2f,0x34,0xb9,0x0d,0x81,0x01,0x01,0x0b,0xf4,0x82,0x34,0x01,0x8f,0x16,0x81,0x01,0x01,0x1a,0xfd,0x81,0x34,0x01,0xae,0x63,
+ 0x81,0x01,0x01,0x16,0xd1,0x81,0x34,0x02,0xcf,0x9e,0x0b,0x81,0x01,0x01,0x1e,0xae,0x81,0x34,0x01,0xd7,0x38,0x81,0x01,0x0e,0x1e,0xe7,0x2f,0x34,0xb9,0x9e,
+ 0x0b,0x01,0x0b,0xf6,0xb0,0x2f,0x34,0xe7,0x07,0x81,0x01,0x01,0x38,0xfd,0x81,0x34,0x01,0xae,0x35,0x81,0x01,0x01,0x0b,0x9d,0x82,0x34,0x01,0x9d,0x16,0x81,
+ 0x01,0x01,0x35,0xac,0x81,0x34,0x01,0xac,0x1a,0x81,0x01,0x01,0x07,0x8f,0x81,0x34,0x06,0xa9,0xf6,0x0b,0x01,0x0b,0xf6,0xb9,0x81,0x34,0x03,0xe7,0x38,0x01,
+ 0xde,0x89,0x00,0x02,0x4f,0x2c,0x57,0x81,0x0f,0x06,0x98,0x0a,0xa6,0x18,0xfb,0x01,0x16,0x83,0x07,0x04,0x16,0x0b,0x95,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,
+ 0x86,0x00,0x0d,0x64,0x0f,0x36,0x53,0x61,0x32,0x1f,0x4d,0x13,0x53,0x44,0x24,0x48,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x05,0x38,0xc8,0x2f,0x34,0xe8,0x1a,
+ 0x81,0x01,0x06,0x07,0xd7,0x34,0x2f,0xa9,0xf6,0x0b,0x81,0x01,0x05,0xd0,0x97,0x2f,0x34,0xd7,0x07,0x81,0x01,0x01,0x38,0x86,0x81,0x34,0x01,0xc8,0x35,0x81,
+ 0x01,0x06,0x16,0x9d,0x2f,0x34,0x2f,0x9d,0x16,0x81,0x01,0x05,0x63,0xfd,0x2f,0x34,0xfd,0x1a,0x81,0x01,0x06,0x07,0xb7,0x2f,0x34,0xcf,0x9d,0x0b,0x81,0x01,
+ 0x01,0xf5,0xb9,0x81,0x34,0x01,0xd7,0x1e,0x81,0x01,0x01,0x1e,0xe8,0x81,0x34,0x01,0xb9,0x0d,0x81,0x01,0x01,0x0b,0xf4,0x82,0x34,0x01,0x8f,0x16,0x81,0x01,
+ 0x05,0x1a,0xfd,0x2f,0x34,0xae,0x63,0x81,0x01,0x01,0x16,0xd1,0x81,0x34,0x02,0xcf,0x9e,0x0b,0x81,0x01,0x01,0x1e,0xae,0x81,0x34,0x01,0xd7,0x38,0x81,0x01,
+ 0x01,0x1e,0xe7,0x81,0x2f,0x0a,0xb9,0x9e,0x0b,0x01,0x0b,0xf6,0xb0,0x2f,0x34,0xe7,0x07,0x81,0x01,0x01,0x38,0xfd,0x81,0x34,0x01,0xae,0x35,0x81,0x01,0x01,
+ 0x0b,0x9d,0x82,0x34,0x01,0x9d,0x16,0x81,0x01,0x05,0x35,0xac,0x2f,0x34,0xac,0x1a,0x81,0x01,0x0a,0x07,0x8f,0x34,0x2f,0xa9,0xf6,0x0b,0x01,0x0b,0xf6,0xb9,
+ 0x81,0x34,0x03,0xe7,0x38,0x01,0xde,0x89,0x00,0x0c,0x4f,0x2c,0x5a,0x2d,0x65,0x30,0x0a,0xa6,0x00,0x26,0x0b,0x1a,0x9d,0x81,0x8f,0x05,0xb7,0x35,0x0b,0xed,
+ 0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x01,0x64,0x0f,0x82,0x02,0x08,0x0f,0x6f,0x4d,0x0a,0x2d,0x44,0x1f,0x0f,0x56,0x87,0x00,0x00,0x40,0x81,0x01,
+ 0x01,0x1a,0xfd,0x81,0xae,0x01,0xd7,0x1a,0x81,0x01,0x01,0x07,0xb7,0x82,0xae,0x01,0xf6,0x0b,0x81,0x01,0x00,0xd0,0x82,0xae,0x01,0xe7,0x07,0x81,0x01,0x01,
+ 0x38,0xd7,0x81,0xae,0x01,0xac,0x35,0x81,0x01,0x01,0x16,0x9e,0x82,0xae,0x01,0x9e,0x16,0x81,0x01,0x01,0x63,0xe8,0x81,0xae,0x01,0xe8,0x1a,0x81,0x01,0x01,
+ 0x07,0x9d,0x82,0xae,0x01,0x9e,0x0b,0x81,0x01,0x01,0xf5,0xe1,0x81,0xae,0x01,0xe7,0x1e,0x81,0x01,0x01,0x1e,0xe7,0x81,0xae,0x01,0xac,0x0d,0x81,0x01,0x01,
+ 0x0b,0xd0,0x82,0xae,0x01,0xb7,0x16,0x81,0x01,0x01,0x1a,0xea,0x81,0xae,0x01,0x86,0x63,0x81,0x01,0x01,0x16,0x9d,0x82,0xae,0x01,0xf6,0x0b,0x81,0x01,0x01,
+ 0x1a,0x86,0x81,0xae,0x01,0xe7,0x38,0x81,0x01,0x01,0x1e,0xb7,0x81,0xae,0x06,0xac,0x9e,0x0b,0x01,0x0b,0xf5,0xac,0x81,0xae,0x01,0x8f,0x07,0x81,0x01,0x01,
+ 0x38,0xea,0x81,0xae,0x01,0xfd,0x35,0x81,0x01,0x01,0x0b,0xf3,0x82,0xae,0x01,0x9d,0x16,0x81,0x01,0x01,0x35,0x86,0x81,0xae,0x01,0xe8,0x1a,0x81,0x01,0x01,
+ 0x07,0xd1,0x82,0xae,0x05,0xf6,0x0b,0x01,0x0b,0xf3,0xac,0x81,0xae,0x03,0x8f,0x38,0x01,0xde,0x89,0x00,0x02,0x4f,0x2c,0x02,0x81,0x0f,0x07,0x02,0x0a,0xa6,
+ 0x00,0x0c,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0xf9,0x3a,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x0d,0x64,0x0f,0x0e,0x32,0xaa,0x3e,0x5b,0x4c,
+ 0x02,0x24,0x2d,0x8a,0x1f,0x56,0x87,0x00,0x00,0x40,0x81,0x01,0x00,0x38,0x83,0x35,0x00,0x1e,0x81,0x01,0x00,0x16,0x83,0x35,0x01,0x63,0x0b,0x81,0x01,0x00,
+ 0x63,0x83,0x35,0x00,0x07,0x81,0x01,0x00,0x1e,0x83,0x35,0x00,0x1a,0x81,0x01,0x01,0x0b,0x63,0x83,0x35,0x00,0x16,0x81,0x01,0x00,0x38,0x83,0x35,0x00,0x38,
+ 0x81,0x01,0x01,0x16,0x63,0x82,0x35,0x01,0x63,0x0b,0x81,0x01,0x00,0x1a,0x83,0x35,0x00,0x1e,0x81,0x01,0x00,0x07,0x83,0x35,0x00,0x1a,0x82,0x01,0x84,0x35,
+ 0x00,0x16,0x81,0x01,0x00,0x38,0x83,0x35,0x00,0x38,0x81,0x01,0x01,0x16,0x63,0x82,0x35,0x01,0x63,0x0b,0x81,0x01,0x00,0x38,0x83,0x35,0x00,0x1e,0x81,0x01,
+ 0x00,0x07,0x83,0x35,0x04,0x63,0x0b,0x01,0x0b,0x63,0x83,0x35,0x00,0x07,0x81,0x01,0x00,0x1e,0x83,0x35,0x00,0x1a,0x81,0x01,0x00,0x0b,0x84,0x35,0x00,0x0b,
+ 0x81,0x01,0x00,0x1a,0x83,0x35,0x00,0x1e,0x81,0x01,0x00,0x16,0x83,0x35,0x04,0x63,0x0b,0x01,0x0b,0x1a,0x83,0x35,0x02,0x07,0x01,0xde,0x89,0x00,0x00,0x4f,
+ 0x81,0xdc,0x09,0x53,0x51,0x12,0x0a,0xa6,0x00,0x0c,0x01,0x1a,0x86,0x81,0x2f,0x05,0xc8,0x0d,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x03,
+ 0x55,0x39,0x67,0x68,0x82,0x00,0x06,0x4c,0x0a,0x82,0xd2,0x32,0x0f,0x56,0x87,0x00,0x00,0x40,0xff,0x01,0xa8,0x01,0x00,0xde,0x89,0x00,0x02,0x28,0x21,0x55,
+ 0x81,0x00,0x07,0x4f,0x82,0x4f,0x00,0x0c,0x0b,0x1a,0xe8,0x81,0xa9,0x05,0xae,0x0d,0x0b,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x8d,0x00,0x00,0x4c,0x84,
+ 0x02,0x00,0x56,0x88,0x00,0x93,0x40,0x03,0x64,0x06,0xb1,0x7a,0x83,0x40,0x00,0xab,0x81,0x65,0x00,0x29,0x84,0x40,0x02,0x89,0x96,0x55,0x84,0x40,0x03,0x5b,
+ 0x99,0x85,0x7a,0x83,0x40,0x03,0x7a,0x6a,0x33,0xbe,0x84,0x40,0x03,0x55,0x96,0xa7,0x7a,0x8c,0x40,0x02,0xbe,0x50,0xe2,0xa6,0x40,0x02,0xe2,0x96,0x89,0x84,
+ 0x40,0x03,0x7a,0xaf,0x94,0x7a,0x83,0x40,0x00,0x29,0x81,0x85,0x00,0xab,0x84,0x40,0x02,0x29,0x7e,0x5f,0x85,0x40,0x02,0xf9,0x99,0xe5,0x84,0x40,0x02,0x55,
+ 0x6d,0xf9,0x82,0x40,0x00,0x08,0x92,0x00,0x03,0x27,0x01,0x38,0xf3,0x81,0x9e,0x05,0xf3,0x35,0x01,0x87,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x8d,0x00,0x00,
+ 0x4c,0x81,0x02,0x03,0x0e,0x24,0x98,0x28,0x9a,0x00,0x06,0x3b,0x2d,0x0e,0x02,0x0f,0x77,0x15,0x81,0x00,0x01,0xbd,0xc7,0x81,0x02,0x01,0xba,0x67,0x81,0x00,
+ 0x06,0x3b,0x82,0x13,0x02,0x48,0x53,0x3b,0x81,0x00,0x01,0x51,0x32,0x81,0x02,0x01,0x24,0x55,0x81,0x00,0x01,0xec,0x5a,0x81,0x02,0x02,0x48,0x4d,0x3b,0x81,
+ 0x00,0x05,0x70,0x2b,0x02,0x8c,0x44,0x28,0x89,0x00,0x06,0x3b,0x6a,0x0a,0x02,0x0a,0x4d,0x3a,0xa2,0x00,0x06,0x7a,0x4c,0x0a,0x02,0x0e,0x39,0x68,0x81,0x00,
+ 0x01,0x55,0x5a,0x81,0x0f,0x01,0xa1,0x55,0x81,0x00,0x05,0xe2,0x6f,0x0f,0x02,0x24,0x1c,0x82,0x00,0x05,0x9b,0x1d,0x02,0x0f,0xb3,0x28,0x81,0x00,0x0e,0x5b,
+ 0x77,0x0f,0x02,0x2b,0x23,0x3a,0x00,0x7a,0x53,0x2b,0x02,0x0f,0x77,0x28,0x94,0x00,0x00,0x08,0x81,0x0b,0x84,0x16,0x03,0x01,0x5f,0x00,0x1c,0x86,0x02,0x01,
+ 0x0a,0x15,0x8d,0x00,0x04,0x70,0x2a,0x53,0xa6,0x3a,0x9c,0x00,0x00,0x23,0x84,0x02,0x03,0x44,0x00,0x29,0x32,0x83,0x02,0x03,0x0a,0x4f,0x00,0x2d,0x84,0x02,
+ 0x03,0x4d,0x00,0xd9,0x0f,0x83,0x02,0x00,0xba,0x81,0x00,0x00,0x5a,0x84,0x02,0x03,0x67,0x00,0x51,0x0f,0x83,0x02,0x00,0xb3,0x89,0x00,0x01,0x73,0x0f,0x83,
+ 0x02,0x00,0x4d,0xa2,0x00,0x00,0x73,0x84,0x02,0x03,0x21,0x00,0x62,0x1f,0x83,0x02,0x03,0xef,0x5b,0x00,0x0a,0x83,0x02,0x04,0x2c,0x3b,0x00,0x55,0x48,0x83,
+ 0x02,0x00,0x24,0x81,0x00,0x00,0x33,0x83,0x02,0x04,0x0f,0x64,0x00,0x7b,0x0f,0x83,0x02,0x00,0x2a,0x94,0x00,0x00,0x08,0x85,0x01,0x04,0x0b,0x01,0x40,0x00,
+ 0x1c,0x86,0x02,0x01,0x0a,0x15,0xaf,0x00,0x1b,0x58,0x0f,0x39,0x70,0x6b,0x0a,0xd2,0x00,0x28,0x2c,0x4b,0x98,0x4d,0x4b,0x13,0x55,0x00,0x21,0x0f,0x2a,0x98,
+ 0x44,0x8c,0x2d,0x00,0x28,0x02,0x24,0x81,0x98,0x01,0x32,0x12,0x81,0x00,0x0e,0xdf,0x76,0x2d,0x4c,0xaa,0x02,0x67,0x00,0x74,0x02,0x33,0x98,0x39,0x0a,0x33,
+ 0x89,0x00,0x06,0x61,0x0f,0x77,0x82,0x2a,0x0f,0x39,0xa2,0x00,0x12,0x61,0x0f,0xd2,0x98,0xaa,0x0e,0x6c,0x00,0x5b,0x2b,0x12,0x82,0x39,0x1f,0x0a,0x15,0x00,
+ 0x0e,0xef,0x81,0x56,0x0a,0x1f,0x0e,0x68,0x00,0x49,0x0e,0xc7,0x56,0x39,0x2c,0x1f,0x81,0x00,0x01,0x6f,0x0a,0x81,0x98,0x0a,0xb8,0x02,0x71,0x00,0x3e,0x0e,
+ 0x1d,0x12,0x39,0x32,0x30,0x95,0x00,0x81,0xed,0x08,0xc3,0x78,0x90,0x42,0xb2,0xed,0x40,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0xaf,0x00,0x11,0x58,0x2b,0x44,
+ 0x32,0x1f,0x24,0xd2,0x00,0x28,0x2b,0x98,0x76,0x2c,0x4c,0x13,0x55,0x00,0x21,0x81,0x24,0x0b,0x76,0x2a,0x6f,0x2d,0x00,0x28,0x0e,0x2a,0x12,0x0a,0x57,0x12,
+ 0x81,0x00,0x0e,0xdf,0x39,0x12,0x1f,0x30,0x2c,0x67,0x00,0x74,0x0a,0x2d,0x12,0x4b,0x30,0x33,0x89,0x00,0x06,0x61,0x1f,0x21,0x1f,0x30,0x4b,0x39,0xa2,0x00,
+ 0x12,0x61,0x32,0x44,0x32,0x6f,0x24,0x6c,0x00,0x5b,0x2b,0x57,0x1f,0x76,0x4d,0x0a,0x15,0x00,0x0e,0x57,0x81,0x32,0x06,0x2d,0x48,0x68,0x00,0x49,0x48,0x82,
+ 0x81,0x1f,0x01,0x39,0x1f,0x81,0x00,0x0e,0x6f,0x39,0x32,0x12,0x21,0x0a,0x71,0x00,0x3e,0xdc,0x36,0xc6,0xa1,0xaa,0x30,0x97,0x00,0x04,0x49,0x4d,0x2a,0xb6,
+ 0x7b,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x97,0x00,0x01,0x68,0x2d,0x81,0x77,0x01,0x74,0x7a,0x83,0x00,0x03,0x68,0xbd,0x82,0x81,0x89,0x00,0x1f,
+ 0x58,0x48,0x23,0x53,0x5a,0x1d,0xd2,0x00,0x28,0x2c,0x21,0x6b,0x4b,0x82,0x13,0x55,0x00,0x21,0x1d,0x2d,0x21,0x44,0x32,0x2d,0x00,0x28,0x0e,0x2d,0x65,0x24,
+ 0x6c,0x12,0x81,0x00,0x0e,0xdf,0x36,0x4d,0x44,0x6d,0x13,0x67,0x00,0x74,0x13,0x6b,0x65,0x33,0xa1,0x33,0x89,0x00,0x06,0x61,0x32,0x2d,0x6b,0xb3,0x1f,0x39,
+ 0xa2,0x00,0x09,0x61,0x2b,0x4d,0x6b,0x36,0x1d,0x6c,0x00,0x5b,0x2b,0x81,0x57,0x13,0x1d,0x4d,0x0a,0x15,0x00,0x0e,0x82,0x99,0x24,0x82,0x48,0x68,0x00,0x49,
+ 0x48,0x4d,0x53,0x32,0x6c,0x1f,0x81,0x00,0x0e,0x6f,0x36,0x39,0x2a,0x21,0x13,0x71,0x00,0x3e,0x0f,0x21,0x2d,0x13,0x1d,0x30,0x96,0x00,0x05,0x3a,0x51,0x61,
+ 0x51,0x1d,0x15,0x82,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x97,0x00,0x05,0x61,0x5a,0x58,0x61,0x6f,0x49,0x81,0x00,0x05,0x3a,0x56,0x6f,0x1d,0x21,0xec,
+ 0x89,0x00,0x1f,0x58,0x0e,0x2a,0x77,0x36,0x2b,0xd2,0x00,0x28,0x2c,0x6f,0x77,0xb8,0x4b,0x13,0x55,0x00,0x21,0x48,0xb3,0x36,0x5a,0x0e,0x2d,0x00,0x28,0x0f,
+ 0x5a,0x77,0x36,0x1f,0x12,0x81,0x00,0x0e,0xdf,0x32,0x2a,0x77,0x36,0x0e,0x67,0x00,0x74,0x0f,0xb8,0x36,0x5a,0x0a,0x33,0x89,0x00,0x06,0x61,0x0e,0x33,0x60,
+ 0x24,0x13,0x39,0xa2,0x00,0x01,0x61,0x0e,0x81,0xb8,0x07,0x5a,0x13,0x6c,0x00,0x5b,0x2b,0x1d,0x33,0x81,0x1d,0x11,0x0a,0x15,0x00,0x0e,0x6f,0x77,0x33,0x1d,
+ 0x13,0x68,0x00,0x49,0x0e,0x24,0x33,0x1d,0x12,0x1f,0x81,0x00,0x0e,0x6f,0x32,0x77,0x36,0x24,0x0f,0x71,0x00,0x3e,0x02,0x0f,0x32,0x36,0x32,0x30,0x96,0x00,
+ 0x04,0x28,0x4c,0x4f,0xbd,0x81,0x83,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x97,0x00,0x05,0x81,0x24,0x23,0x53,0x1d,0x67,0x81,0x00,0x04,0x29,0x2b,0x1d,
+ 0x81,0x3b,0x8a,0x00,0x1f,0x58,0x0f,0x5a,0x4c,0x2a,0xa1,0xd2,0x00,0x28,0x2c,0x1d,0x53,0x44,0x2d,0x13,0x55,0x00,0x21,0x48,0x36,0x53,0x56,0xc7,0x2d,0x00,
+ 0x28,0x0f,0x24,0x4c,0xb3,0x4d,0x12,0x81,0x00,0x0b,0xdf,0x0a,0x36,0x2d,0x99,0x0a,0x67,0x00,0x74,0x0f,0xb8,0x23,0x81,0x2a,0x00,0x33,0x89,0x00,0x06,0x61,
+ 0x0e,0x30,0x65,0x21,0x1d,0x39,0xa2,0x00,0x1f,0x61,0x0e,0x36,0x58,0x21,0x60,0x6c,0x00,0x5b,0x2b,0xc7,0x53,0x30,0x4c,0x0a,0x15,0x00,0x0e,0x24,0x4c,0x21,
+ 0x53,0x48,0x68,0x00,0x49,0x0e,0x24,0x6a,0x36,0x21,0x1f,0x81,0x00,0x0e,0x6f,0x32,0x21,0x4c,0x57,0x0a,0x71,0x00,0x3e,0x48,0x70,0x21,0x1d,0x0e,0x30,0x9f,
+ 0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x88,0x00,0x05,0x29,0x51,0x53,0x2d,0x23,0x15,0x88,0x00,0x05,0x3b,0x53,0xd2,0x44,0x58,0x3a,0x82,0x00,0x04,0x15,
+ 0x53,0xb8,0x1f,0x8a,0x89,0x00,0x00,0x58,0x81,0x02,0x16,0x6b,0x4c,0x1d,0xd2,0x00,0x28,0x2c,0x02,0x5a,0x4d,0x57,0x13,0x55,0x00,0x21,0x02,0x0f,0xbf,0x2d,
+ 0x12,0x2d,0x00,0x28,0x81,0x02,0x03,0x2a,0x61,0x82,0x12,0x81,0x00,0x08,0xdf,0x02,0x0e,0x74,0x6a,0x0e,0x67,0x00,0x74,0x81,0x02,0x03,0x6b,0x4d,0x5a,0x33,
+ 0x89,0x00,0x06,0x61,0x02,0x0f,0x2d,0x6b,0x32,0x39,0xa2,0x00,0x1f,0x61,0x02,0x0f,0x61,0x6b,0x1d,0x6c,0x00,0x5b,0x2b,0x02,0x33,0x39,0x57,0x0a,0x15,0x00,
+ 0x0e,0x02,0x24,0x56,0x2d,0x13,0x68,0x00,0x49,0x0e,0x02,0x82,0xaa,0x21,0x1f,0x81,0x00,0x0e,0x6f,0x02,0x0a,0x70,0x57,0x13,0x71,0x00,0x3e,0x0f,0x1d,0x39,
+ 0x4c,0x1d,0x30,0x8f,0x00,0x05,0x7a,0xbd,0x53,0x57,0x53,0x7b,0x89,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x02,0x58,0x2b,0x0f,0x82,0x02,0x02,
+ 0x0e,0x44,0x29,0x86,0x00,0x04,0x3e,0x81,0x00,0x4f,0x2d,0x82,0x00,0x05,0x7a,0x15,0x00,0x3a,0xbd,0x49,0x89,0x00,0x00,0x58,0x81,0x02,0x06,0x0e,0x0a,0x02,
+ 0xd2,0x00,0x28,0x2c,0x81,0x02,0x00,0x2b,0x81,0x13,0x02,0x55,0x00,0x21,0x81,0x02,0x05,0x0a,0x2b,0x02,0x2d,0x00,0x28,0x81,0x02,0x03,0x8c,0x12,0x0f,0x12,
+ 0x81,0x00,0x08,0xdf,0x0f,0x02,0x13,0x0e,0x02,0x67,0x00,0x74,0x81,0x02,0x03,0x13,0x32,0x0f,0x33,0x89,0x00,0x00,0x61,0x81,0x02,0x03,0xdc,0x1f,0x02,0x39,
+ 0xa2,0x00,0x00,0x61,0x81,0x02,0x06,0x48,0x32,0x02,0x6c,0x00,0x5b,0x2b,0x81,0x02,0x08,0xcc,0x13,0x0a,0x15,0x00,0x0e,0x02,0x0f,0x32,0x81,0x0e,0x08,0x68,
+ 0x00,0x49,0x0e,0x02,0x0e,0x1d,0x0e,0x1f,0x81,0x00,0x00,0x6f,0x81,0x02,0x05,0x12,0x0a,0x02,0x71,0x00,0x3e,0x82,0x02,0x81,0x0e,0x00,0x30,0x8e,0x00,0x02,
+ 0x55,0x24,0x8c,0x82,0x02,0x02,0x0f,0xcc,0x7b,0x87,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x00,0x57,0x87,0x02,0x01,0x32,0xa6,0x85,0x00,0x05,
+ 0x73,0x0a,0x1f,0x32,0x2c,0x49,0x81,0x00,0x01,0x29,0x1f,0x81,0x7d,0x01,0x4b,0x67,0x89,0x00,0x1b,0x58,0x0a,0x4c,0x6f,0x36,0x24,0xd2,0x00,0x28,0x2c,0x39,
+ 0x1f,0x32,0x6c,0x13,0x55,0x00,0x21,0x1d,0x24,0x32,0x30,0x1f,0x2d,0x00,0x28,0x0e,0x6c,0x81,0x1d,0x01,0x44,0x12,0x81,0x00,0x0b,0xdf,0x39,0x60,0x4b,0x99,
+ 0x0a,0x67,0x00,0x74,0x48,0x44,0x32,0x81,0x24,0x00,0x33,0x89,0x00,0x06,0x61,0x2b,0x36,0x2b,0x6f,0x32,0x39,0xa2,0x00,0x0a,0x61,0x12,0x77,0x32,0x60,0x1f,
+ 0x6c,0x00,0x5b,0x2b,0x2a,0x81,0x12,0x05,0x30,0x0a,0x15,0x00,0x0e,0x6d,0x81,0x2b,0x0a,0x2a,0x13,0x68,0x00,0x49,0x13,0x2a,0x2b,0x12,0xc6,0x1f,0x81,0x00,
+ 0x08,0x6f,0x77,0x1f,0x32,0xc5,0x13,0x71,0x00,0xbd,0x84,0x02,0x00,0x30,0x8d,0x00,0x01,0x49,0x0a,0x86,0x02,0x01,0x0e,0x58,0x86,0x00,0x00,0x1c,0x86,0x02,
+ 0x01,0x0a,0x15,0x85,0x00,0x01,0x58,0x0f,0x88,0x02,0x01,0x24,0x68,0x84,0x00,0x01,0x23,0x21,0x82,0x3e,0x00,0x29,0x81,0x00,0x01,0x29,0x48,0x82,0x1f,0x00,
+ 0x53,0x89,0x00,0x1b,0x58,0x0a,0x4d,0x5a,0x2a,0x24,0xd2,0x00,0x28,0x2c,0x4d,0x44,0x2a,0x2d,0x13,0x55,0x00,0x21,0x4b,0x2d,0x44,0x61,0xba,0x2d,0x00,0x28,
+ 0x0e,0x2d,0x81,0x2a,0x01,0x56,0x12,0x81,0x00,0x0c,0xdf,0xd2,0x24,0x4b,0x21,0x48,0x67,0x00,0x74,0x0a,0x58,0x44,0x39,0x81,0x33,0x89,0x00,0x06,0x61,0x12,
+ 0x53,0x39,0x4c,0x4b,0x39,0xa2,0x00,0x0a,0x61,0x12,0x53,0x44,0x56,0x4b,0x6c,0x00,0x5b,0x2b,0x4d,0x81,0x39,0x05,0x4d,0x0a,0x15,0x00,0x0e,0x2d,0x81,0x44,
+ 0x0a,0x4d,0x48,0x68,0x00,0x49,0x48,0x53,0x44,0xaa,0x21,0x1f,0x81,0x00,0x00,0x6f,0x81,0x44,0x06,0x2a,0x2d,0x0a,0x71,0x00,0x4f,0x0a,0x83,0x02,0x00,0x61,
+ 0x8c,0x00,0x01,0x28,0x12,0x88,0x02,0x01,0x13,0x9b,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x01,0x29,0x1d,0x8a,0x02,0x00,0x51,0x83,0x00,
+ 0x02,0x9b,0x44,0x7b,0x85,0x00,0x01,0x68,0x39,0x8d,0x00,0x12,0x58,0x02,0x2c,0x32,0x12,0x0f,0xd2,0x00,0x28,0x2c,0x48,0x2c,0x2b,0x48,0x13,0x55,0x00,0x21,
+ 0x0e,0x82,0x0a,0x09,0x0f,0x2d,0x00,0x28,0x02,0x48,0x2b,0xdc,0x13,0x12,0x81,0x00,0x09,0xdf,0x8c,0x32,0xcc,0x0a,0x02,0x67,0x00,0x74,0x02,0x82,0x0a,0x01,
+ 0x0f,0x33,0x89,0x00,0x02,0x61,0x0f,0x0a,0x81,0x48,0x01,0x0e,0x39,0xa2,0x00,0x01,0x61,0x0f,0x82,0x0a,0x0d,0x0f,0x6c,0x00,0x5b,0x2b,0x0a,0x13,0x48,0x13,
+ 0x0a,0x15,0x00,0x0e,0x48,0x81,0x0a,0x06,0x48,0x13,0x68,0x00,0x49,0x0e,0x0a,0x81,0x48,0x01,0x13,0x1f,0x81,0x00,0x01,0x6f,0x13,0x81,0x0a,0x02,0x48,0x02,
+ 0x71,0x81,0x00,0x05,0x81,0x0a,0x02,0x0f,0xb3,0x3b,0x8c,0x00,0x00,0x61,0x8a,0x02,0x01,0x33,0x3a,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,
+ 0x01,0x9b,0x0f,0x8a,0x02,0x00,0x30,0x83,0x00,0x05,0x28,0x39,0x24,0x36,0x73,0xa6,0x82,0x00,0x02,0x3b,0x2a,0x55,0x8c,0x00,0x1f,0x58,0x13,0x4c,0x2a,0x82,
+ 0x24,0xd2,0x00,0x28,0x2c,0x2a,0x21,0x2a,0x21,0x13,0x55,0x00,0x21,0x12,0x2d,0x2a,0x6b,0x2b,0x2d,0x00,0x28,0x0f,0x82,0x6d,0x39,0x2a,0x12,0x81,0x00,0x0e,
+ 0xdf,0xb8,0x21,0x77,0x2d,0x13,0x67,0x00,0x74,0x0e,0x2d,0x2a,0x39,0x4b,0x33,0x89,0x00,0x06,0x61,0x48,0x65,0x2a,0x4d,0x12,0x39,0x92,0x00,0x01,0x9b,0x56,
+ 0x8d,0x00,0x12,0x61,0x0a,0x2d,0x2a,0x2d,0x1f,0x6c,0x00,0x5b,0x2b,0x77,0x21,0x82,0x21,0x0a,0x15,0x00,0x0e,0x6c,0x81,0x21,0x05,0x39,0x13,0x68,0x00,0x49,
+ 0x13,0x81,0x21,0x02,0x57,0x36,0x1f,0x81,0x00,0x06,0x6f,0xa1,0x99,0x30,0x39,0x0e,0x71,0x82,0x00,0x03,0xa6,0x3e,0x9b,0x3b,0x8c,0x00,0x01,0x3a,0x1d,0x8a,
+ 0x02,0x01,0x0e,0x15,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0x4c,0x8b,0x02,0x01,0x1f,0x68,0x84,0x00,0x04,0x68,0x7b,0x44,0x1d,0x39,
+ 0x81,0x00,0x02,0x3b,0x53,0x28,0x8c,0x00,0x03,0x58,0x2c,0x56,0x0a,0x81,0x33,0x19,0xd2,0x00,0x28,0x2b,0x82,0x0a,0x13,0x57,0x13,0x55,0x00,0x21,0x60,0x24,
+ 0x0e,0x36,0xc7,0x2d,0x00,0x28,0x0e,0xb4,0x0a,0x2c,0x6b,0x12,0x81,0x00,0x0e,0xdf,0x44,0x6f,0x2c,0x44,0x0a,0x67,0x00,0x74,0x0a,0x57,0x0e,0x32,0x30,0x33,
+ 0x89,0x00,0x06,0x61,0x1f,0x36,0x0f,0x5a,0x4b,0x39,0x92,0x00,0x01,0x53,0x56,0x8d,0x00,0x12,0x61,0x32,0x21,0x0e,0x1d,0x60,0x6c,0x00,0x5b,0x2b,0x39,0x13,
+ 0x0e,0x2d,0x0a,0x15,0x00,0x0e,0xb4,0x81,0x0e,0x0a,0x39,0x0a,0x68,0x00,0x49,0x0a,0x56,0x0f,0x0e,0x21,0x1f,0x81,0x00,0x06,0x6f,0xaa,0x12,0x0e,0x6d,0x0a,
+ 0x71,0x93,0x00,0x01,0xa6,0x0a,0x8b,0x02,0x00,0x7b,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0x4c,0x8b,0x02,0x01,0x12,0x29,0x83,0x00,
+ 0x05,0xa6,0x9b,0x00,0x3b,0x8a,0x1c,0x81,0x00,0x01,0x68,0x39,0x81,0x00,0x01,0x57,0x68,0x89,0x00,0x1f,0x58,0x0f,0x5a,0x56,0x6c,0x13,0xd2,0x00,0x28,0x2c,
+ 0x1d,0x2d,0x56,0x24,0x13,0x55,0x00,0x21,0x13,0x39,0x4d,0x44,0x0e,0x2d,0x00,0x28,0x02,0x5a,0x2d,0x39,0x32,0x12,0x81,0x00,0x0e,0xdf,0x48,0x36,0x2a,0x24,
+ 0x02,0x67,0x00,0x74,0x0f,0xd2,0x98,0x82,0x0a,0x33,0x89,0x00,0x06,0x61,0x0e,0x39,0x4d,0x56,0x48,0x39,0xa2,0x00,0x12,0x61,0x0f,0x21,0x98,0x82,0x48,0x6c,
+ 0x00,0x5b,0x2b,0x5a,0x4d,0x6b,0x24,0x0a,0x15,0x00,0x0e,0x6f,0x81,0x98,0x0a,0x24,0x13,0x68,0x00,0x49,0x0e,0xb3,0x4d,0x98,0x1d,0x1f,0x81,0x00,0x01,0x6f,
+ 0x0a,0x81,0x98,0x02,0xb3,0x0f,0x71,0x93,0x00,0x01,0x55,0x0a,0x8b,0x02,0x00,0x74,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x00,0x7b,0x8b,
+ 0x02,0x01,0x24,0x3a,0x83,0x00,0x05,0x73,0x0e,0x61,0x00,0x2a,0x1c,0x81,0x00,0x01,0x29,0x48,0x81,0x1d,0x01,0x2c,0x53,0x89,0x00,0x00,0x58,0x81,0x0e,0x06,
+ 0xb6,0x2d,0x1d,0xd2,0x00,0x28,0x2c,0x81,0x02,0x05,0x1d,0x12,0x13,0x55,0x00,0x21,0x81,0x02,0x0b,0x0e,0x5a,0x02,0x2d,0x00,0x28,0x0f,0x99,0x32,0x1d,0x36,
+ 0x12,0x81,0x00,0x0e,0xdf,0x77,0x39,0x0f,0x99,0x0e,0x67,0x00,0x74,0x13,0x53,0x0a,0x33,0x1f,0x33,0x89,0x00,0x06,0x61,0x2b,0x56,0x8c,0x2a,0x0a,0x39,0xa2,
+ 0x00,0x00,0x61,0x81,0x02,0x06,0x0f,0x24,0x02,0x6c,0x00,0x5b,0x2b,0x81,0x02,0x00,0x4b,0x81,0x0a,0x02,0x15,0x00,0x0e,0x81,0x02,0x06,0xc7,0x2b,0x0e,0x68,
+ 0x00,0x49,0x0e,0x81,0x02,0x02,0x5a,0x0f,0x1f,0x81,0x00,0x00,0x6f,0x81,0x02,0x03,0xdc,0x6f,0x02,0x71,0x93,0x00,0x01,0x29,0x12,0x8b,0x02,0x00,0x67,0x84,
+ 0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x84,0x00,0x01,0xec,0x48,0x8a,0x02,0x00,0x39,0x84,0x00,0x05,0x73,0xb6,0x1f,0x1d,0x2b,0x67,0x81,0x00,0x01,0x29,
+ 0x1d,0x82,0x3e,0x00,0x15,0x89,0x00,0x1f,0x58,0x13,0x61,0xc5,0x12,0x24,0xd2,0x00,0x28,0x2c,0x36,0x39,0x56,0x73,0x13,0x55,0x00,0x21,0x0a,0x30,0xb3,0x51,
+ 0x12,0x2d,0x00,0x28,0x0e,0xc4,0x2d,0x2b,0x2d,0x12,0x81,0x00,0x0e,0xdf,0x39,0xb3,0x2a,0x06,0x2b,0x67,0x00,0x74,0x0a,0x4c,0x82,0x32,0xb3,0x33,0x89,0x00,
+ 0x03,0x61,0x12,0x65,0x21,0x81,0x1d,0x00,0x39,0xa2,0x00,0x01,0x61,0x13,0x81,0x30,0x1b,0x74,0x1d,0x6c,0x00,0x5b,0x2b,0x1d,0x5a,0x2a,0x4c,0x0a,0x15,0x00,
+ 0x0e,0x24,0x30,0xb6,0x2d,0x13,0x68,0x00,0x49,0x0e,0x33,0xb3,0x57,0x82,0x1f,0x81,0x00,0x81,0x6f,0x81,0x39,0x02,0x58,0x0e,0x71,0x94,0x00,0x00,0x33,0x8a,
+ 0x02,0x01,0x12,0x29,0x84,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x85,0x00,0x00,0x2a,0x89,0x02,0x01,0x48,0xa6,0x84,0x00,0x05,0x7b,0x73,0x49,0x4d,0x73,
+ 0x3a,0x82,0x00,0x00,0x15,0x8d,0x00,0x0a,0x58,0x02,0x13,0x39,0xb6,0x2b,0xd2,0x00,0x28,0x2c,0x13,0x81,0x0a,0x81,0x13,0x03,0x55,0x00,0x21,0x0e,0x82,0x12,
+ 0x09,0x0f,0x2d,0x00,0x28,0x0f,0x24,0x0a,0x2d,0xdf,0x12,0x81,0x00,0x0e,0xdf,0x24,0x0f,0x5a,0x44,0x0f,0x67,0x00,0x74,0x13,0x5a,0x32,0x2d,0x1f,0x33,0x89,
+ 0x00,0x06,0x61,0x2c,0x24,0x5a,0x2d,0xdc,0x39,0xa2,0x00,0x01,0x61,0x0f,0x82,0x12,0x05,0x0e,0x6c,0x00,0x5b,0x2b,0x12,0x81,0x32,0x05,0x12,0x0a,0x15,0x00,
+ 0x0e,0x0a,0x81,0x12,0x06,0x0a,0x13,0x68,0x00,0x49,0x0e,0x12,0x81,0x32,0x01,0x0a,0x1f,0x81,0x00,0x01,0x6f,0x13,0x81,0x12,0x02,0x2b,0x02,0x71,0x94,0x00,
+ 0x01,0x9b,0x0e,0x89,0x02,0x00,0x56,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x85,0x00,0x01,0x4f,0xba,0x87,0x02,0x01,0x0e,0x61,0x86,0x00,0x03,0x58,
+ 0x1d,0x23,0x68,0x92,0x00,0x00,0x58,0x84,0x02,0x05,0x44,0x00,0x28,0x2c,0x24,0x2a,0x81,0x24,0x11,0x13,0x55,0x00,0x21,0x8c,0x0f,0x36,0x2a,0x0e,0x2d,0x00,
+ 0x28,0x02,0x24,0x6b,0x57,0x32,0x12,0x81,0x00,0x00,0xdf,0x81,0x02,0x0b,0x0a,0xc7,0x02,0x67,0x00,0x74,0x0e,0x2a,0x8c,0x1f,0x2b,0x33,0x89,0x00,0x03,0x61,
+ 0x0e,0x32,0x0f,0x81,0x0a,0x00,0x39,0xa2,0x00,0x1b,0x61,0x48,0x2a,0x0f,0x1d,0x48,0x6c,0x00,0x5b,0x2b,0x4b,0x0f,0x0e,0xef,0x0a,0x15,0x00,0x0e,0x1d,0x0e,
+ 0x24,0x1f,0x13,0x68,0x00,0x49,0x0e,0xdc,0x81,0x02,0x01,0x24,0x1f,0x81,0x00,0x06,0x6f,0x32,0x30,0x33,0x0e,0x02,0x71,0x95,0x00,0x00,0x21,0x88,0x02,0x01,
+ 0xdf,0x68,0x85,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x86,0x00,0x01,0x4f,0x1d,0x85,0x02,0x02,0x13,0x4c,0x3a,0x85,0x00,0x05,0x29,0x39,0x44,0x60,0x5a,
+ 0x4f,0x91,0x00,0x01,0x7b,0x0f,0x83,0x02,0x19,0x82,0x00,0x28,0x2b,0x2d,0x5a,0x82,0x4c,0x13,0x55,0x00,0x21,0x1d,0x30,0x39,0x33,0x6f,0x2d,0x00,0x28,0x0e,
+ 0x99,0x57,0x4b,0x56,0x12,0x81,0x00,0x0e,0xdf,0x32,0xb3,0x2a,0x8a,0x13,0x67,0x00,0x74,0x0a,0x53,0x44,0x1f,0xb3,0x33,0x89,0x00,0x06,0x61,0x1f,0x5a,0xaa,
+ 0x4d,0x4b,0x39,0xa2,0x00,0x1f,0x61,0x32,0x58,0x77,0x1d,0x24,0x6c,0x00,0x5b,0x2b,0x21,0x0a,0x4c,0xb6,0x0a,0x15,0x00,0x0e,0x6d,0x48,0x57,0x98,0x48,0x68,
+ 0x00,0x49,0x0e,0x44,0x21,0xef,0x39,0x1f,0x81,0x00,0x06,0x6f,0x82,0x12,0x53,0x44,0x0e,0x71,0x95,0x00,0x02,0x68,0x21,0x8c,0x84,0x02,0x02,0x0f,0x5a,0xa6,
+ 0x86,0x00,0x00,0x1c,0x86,0x02,0x01,0x0a,0x15,0x87,0x00,0x07,0xd9,0x70,0x6f,0x2c,0x0a,0x12,0x2a,0xbd,0x87,0x00,0x00,0x3e,0x81,0x12,0x02,0x1d,0x1f,0x49,
+ 0x91,0x00,0x01,0x3a,0x6f,0x82,0x02,0x1a,0x0a,0xec,0x00,0x28,0x2c,0x6c,0x57,0x56,0xaa,0x13,0x55,0x00,0x21,0x02,0xa1,0x4c,0x57,0x12,0x2d,0x00,0x28,0x0f,
+ 0x21,0x9a,0x58,0x30,0x12,0x81,0x00,0x01,0xdf,0x0a,0x81,0xcc,0x0a,0x32,0x0f,0x67,0x00,0x74,0x48,0x36,0x5a,0x53,0x4b,0x33,0x89,0x00,0x06,0x61,0x0a,0x53,
+ 0x4d,0x21,0x32,0x39,0xa2,0x00,0x1f,0x61,0x2b,0x5a,0xb8,0x65,0x32,0x6c,0x00,0x5b,0x2b,0x2a,0x61,0xc6,0x21,0x0a,0x15,0x00,0x0e,0x2a,0x2d,0x6f,0x5a,0x48,
+ 0x68,0x00,0x49,0x0e,0x02,0x12,0x39,0x21,0x1f,0x81,0x00,0x06,0x6f,0x5a,0x99,0x2a,0x0a,0x0e,0x71,0x97,0x00,0x07,0x3e,0x36,0xef,0x48,0x12,0x24,0x81,0x68,
+ 0x87,0x00,0x00,0x1c,0x86,0x02,0x01,0x13,0xe2,0x89,0x00,0x03,0x3b,0x28,0x4f,0x28,0x89,0x00,0x02,0x3b,0x67,0x64,0x81,0x28,0x00,0x3a,0x92,0x00,0x04,0x29,
+ 0x39,0x6f,0x2a,0x49,0x81,0x00,0x03,0x28,0x2c,0x0f,0x0e,0x81,0x02,0x03,0x13,0x55,0x00,0x21,0x81,0x02,0x07,0x8c,0x0e,0x02,0x2d,0x00,0x28,0x02,0x0f,0x81,
+ 0x0e,0x01,0x02,0x12,0x81,0x00,0x00,0x33,0x84,0x02,0x08,0x67,0x00,0x74,0x02,0x0f,0x02,0x0e,0x02,0x33,0x89,0x00,0x01,0x61,0x02,0x81,0x0f,0x81,0x02,0x00,
+ 0x39,0xa2,0x00,0x0b,0x61,0x02,0x0f,0x02,0x0f,0x02,0x6c,0x00,0x5b,0x2b,0x02,0x8c,0x81,0x02,0x05,0x0a,0x15,0x00,0x0e,0x02,0x0e,0x81,0x02,0x04,0x0e,0x68,
+ 0x00,0x49,0x0e,0x82,0x02,0x01,0x0f,0x1f,0x81,0x00,0x03,0x6f,0x02,0x0e,0x0f,0x81,0x02,0x00,0x71,0x99,0x00,0x03,0x29,0x4f,0x28,0x3b,0x89,0x00,0x00,0x7b,
+ 0x86,0x02,0x01,0x0f,0x9b,0xb2,0x00,0x00,0x3a,0x83,0x00,0x01,0x28,0x2b,0x83,0x02,0x03,0x0a,0x28,0x00,0x2d,0x84,0x02,0x02,0x53,0x00,0xd9,0x84,0x02,0x00,
+ 0x32,0x81,0x00,0x00,0x2d,0x83,0x02,0x03,0x0a,0xa6,0x00,0x71,0x84,0x02,0x00,0x2a,0x89,0x00,0x00,0x53,0x84,0x02,0x00,0x98,0xa2,0x00,0x00,0x70,0x84,0x02,
+ 0x03,0x39,0x00,0x29,0x32,0x83,0x02,0x03,0x2b,0x4f,0x00,0x48,0x83,0x02,0x04,0x48,0x3b,0x00,0x55,0x13,0x83,0x02,0x00,0xc7,0x81,0x00,0x00,0x33,0x84,0x02,
+ 0x00,0x1c,0xa7,0x00,0x00,0x73,0x87,0x02,0x00,0x39,0xb8,0x00,0x00,0x39,0x83,0x02,0x00,0x36,0x81,0x00,0x01,0x9b,0x0e,0x82,0x02,0x04,0x48,0xa6,0x00,0x3a,
+ 0x5a,0x83,0x02,0x00,0x39,0x81,0x00,0x05,0x29,0xa1,0x0f,0x02,0x13,0x70,0x81,0x00,0x01,0x3a,0x12,0x82,0x02,0x01,0x0f,0x74,0x89,0x00,0x01,0x15,0x48,0x82,
+ 0x02,0x01,0x48,0x49,0xa2,0x00,0x01,0x68,0x0a,0x82,0x02,0x01,0x0f,0x64,0x81,0x00,0x00,0x21,0x83,0x02,0x00,0x2a,0x81,0x00,0x00,0xd2,0x83,0x02,0x00,0x2a,
+ 0x81,0x00,0x01,0x3a,0x33,0x83,0x02,0x00,0x98,0x81,0x00,0x00,0x74,0x83,0x02,0x01,0xcc,0x68,0xa7,0x00,0x00,0x33,0x87,0x02,0x01,0x0a,0x49,0xb7,0x00,0x05,
+ 0xd9,0x30,0x48,0x13,0x33,0x4f,0x82,0x00,0x04,0x58,0x12,0x13,0x32,0x51,0x82,0x00,0x05,0x49,0x4b,0x13,0x0a,0xd2,0x68,0x83,0x00,0x02,0x7b,0x23,0xe2,0x83,
+ 0x00,0x05,0x67,0x1d,0x13,0x0a,0x2d,0x7a,0x8a,0x00,0x04,0x67,0x32,0x48,0x1f,0x3e,0xa4,0x00,0x04,0x7b,0x32,0x13,0x2b,0x4d,0x82,0x00,0x01,0x29,0x2a,0x81,
+ 0x2b,0x01,0x2a,0x28,0x81,0x00,0x01,0x29,0x2a,0x81,0x0a,0x01,0xb3,0x68,0x82,0x00,0x05,0x28,0xb8,0x0a,0x2b,0x82,0x3b,0x82,0x00,0x04,0x39,0x0a,0x13,0x1d,
+ 0x64,0xa7,0x00,0x01,0x7b,0x8c,0x88,0x02,0x01,0x6f,0x4f,0xb8,0x00,0x01,0x4f,0x49,0x85,0x00,0x02,0x29,0x49,0x68,0x84,0x00,0x02,0x3a,0x49,0x5b,0x8d,0x00,
+ 0x02,0x3a,0x55,0x5b,0x8d,0x00,0x02,0x7a,0x15,0x3a,0xa6,0x00,0x02,0x3a,0x55,0x29,0x85,0x00,0x01,0x3b,0x29,0x85,0x00,0x01,0x29,0x4f,0x86,0x00,0x01,0x5b,
+ 0x28,0x85,0x00,0x02,0x29,0x49,0x3b,0xa7,0x00,0x01,0x1c,0x12,0x8a,0x02,0x01,0x4b,0x64,0xff,0x08,0xde,0x08,0x02,0x3b,0x58,0x12,0x8c,0x02,0x02,0x0e,0x24,
+ 0xa5,0xff,0x25,0xda,0x25,0x03,0xb1,0x65,0x1d,0x0f,0xff,0x02,0xff,0x02,0xff,0x02,0xe8,0x02,
+};
+
+const ili9341_rle_image_t esp_edu_pic = {
+	240,
+	320,
+	esp_edu_pic_palette,
+	sizeof(esp_edu_pic_data),
+	esp_edu_pic_data
+};
@@ -23653,37 +23653,43 @@ char_info_t font89_info[] = {
 Font_t font_11 = {
 	11,
     font11_info,
-	font11_data
+	font11_data,
+	FONT_BITMAP
 };
 
 Font_t font_19 = {
 	19,
     font19_info,
-	font19_data
+	font19_data,
+	FONT_BITMAP
 };
 
 Font_t font_22 = {
 	22,
     font22_info,
-	font22_data
+	font22_data,
+	FONT_BITMAP
 };
 
 Font_t font_30 = {
 	30,
     font30_info,
-	font30_data
+	font30_data,
+	FONT_BITMAP
 };
 
 Font_t font_59 = {
 	59,
     font59_info,
-	font59_data
+	font59_data,
+	FONT_BITMAP
 };
 
 Font_t font_89 = {
 	89,
     font89_info,
-	font89_data
+	font89_data,
+	FONT_BITMAP
 };
 
 /*==================[internal functions definition]==========================*/
@@ -0,0 +1,3843 @@
+/**
+ * @file fonts_aa.c
+ * @brief Anti-aliased fonts (4 bits per pixel). Created with tools/font_aa.py
+ */
+
+/*==================[inclusions]=============================================*/
+#include "fonts.h"
+/*==================[internal data definition]===============================*/
+/**
+ * @brief 30 pixels height anti-aliased data array (from 59 pixels font).
+ */
+const uint8_t font30_aa_data[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x48, 0x80, 0x00, 0x00, 0x48, 0x80, 0xBF, 0xF8, 0xFF, 0xF8, 0x8F, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x80, 0x00, 0x88, 0x40, 0xFF, 0xF0, 0x04, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0xFF, 0x80, 0x8F, 0x80,
+	0x00, 0xFF, 0x80, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x8F, 0x80, 0x00,
+	0xFF, 0x00, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x48, 0x40, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x08, 0x80, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x8F, 0x80, 0x00,
+	0x00, 0x08, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x08, 0xFF, 0x00, 0x00,
+	0x00, 0x0F, 0xF0, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x08, 0xFB, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x8F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+	0x00, 0xFF, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x88, 0xBF, 0xFB, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x8B,
+	0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0x00,
+	0x4B, 0xFF, 0x40, 0xFF, 0xFB, 0x88, 0x8B, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40,
+	0x00, 0x00, 0x08, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+	0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x4F, 0xF0, 0x00, 0x4F, 0xF8, 0x8B, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xBF, 0x80,
+	0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x8F, 0x80, 0x04, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF,
+	0x80, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x00, 0x00,
+	0x8F, 0xF8, 0x8B, 0xFB, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0xBF, 0xB0, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xB8,
+	0x8F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x04, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x08, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xBF, 0xB0, 0x00, 0x08, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x08, 0xFB, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xB8, 0x8F, 0xF4, 0x00, 0xBF,
+	0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x40, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xF0, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x8F,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xF4, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x4F, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0x88, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xF0, 0x00,
+	0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x04, 0xFF, 0xB0, 0xBF, 0xFB, 0x00,
+	0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xFB, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x8F, 0xF0, 0x00, 0x8F, 0xF4,
+	0x00, 0x00, 0xBF, 0xFB, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xB4, 0xFF,
+	0x40, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
+	0x0B, 0xFF, 0xB4, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB,
+	0x40, 0x4F, 0xFF, 0xF0, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0xF0,
+	0xBF, 0xF0, 0x8F, 0xB0, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x48, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x0F, 0xF8, 0x00,
+	0x4F, 0xF0, 0x00, 0xBF, 0x80, 0x04, 0xFF, 0x40, 0x08, 0xFF, 0x00, 0x0F, 0xFB, 0x00, 0x0F, 0xF8,
+	0x00, 0x8F, 0xF4, 0x00, 0x8F, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
+	0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xB0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x8F,
+	0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0xFF,
+	0x40, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B,
+	0xFB, 0x00, 0x08, 0xFF, 0x00, 0x04, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x8F,
+	0xF0, 0x00, 0x8F, 0xF4, 0x00, 0x8F, 0xF8, 0x00, 0x4F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8,
+	0x00, 0x0F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00,
+	0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x8F, 0xF0,
+	0x00, 0xBF, 0xB0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x8F, 0x80,
+	0x04, 0x00, 0xBF, 0x80, 0x8F, 0x80, 0xBF, 0x80, 0xBF, 0xFB, 0xBF, 0x4F, 0xFF, 0xB0, 0x04, 0x8F,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xBF, 0xF8, 0x40,
+	0xFF, 0xF4, 0x8F, 0x48, 0xFF, 0xB0, 0x4B, 0x00, 0x8F, 0x80, 0x4B, 0x40, 0x00, 0x00, 0x8F, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x84,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x84, 0x00, 0x00,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00,
+	0x8F, 0xF8, 0x00, 0x8F, 0xF0, 0x00, 0xBF, 0xB0, 0x04, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x4F, 0xF0,
+	0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xF8, 0xFF, 0xF4,
+	0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x4F,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xB4, 0x00, 0x4B, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00,
+	0x00, 0xBF, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
+	0xF8, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x0F, 0xFB,
+	0x00, 0x00, 0x00, 0xBF, 0xB0, 0x04, 0xFF, 0xB4, 0x00, 0x4B, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xF8,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x4B, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF8,
+	0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x88, 0x88, 0x8F, 0xFB, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xFF, 0x88, 0x8F, 0xFF,
+	0xB0, 0x00, 0x8B, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xF8, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x88,
+	0x88, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x88, 0x88, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x84, 0x00,
+	0x04, 0xBF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0x84,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x88, 0x88, 0x40, 0x00, 0x00,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0x88, 0x88, 0x8B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0xFF,
+	0x84, 0x00, 0x04, 0xBF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0x8F, 0xFF,
+	0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x8F, 0xFB, 0x40, 0x00, 0x48, 0x40, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x84, 0x8F, 0xFF, 0xFB,
+	0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFB, 0x80, 0x00, 0x0B, 0xFF, 0xB0,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x8F, 0xF0, 0x00, 0x00,
+	0x00, 0x0F, 0xF8, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0xFF,
+	0xB0, 0x08, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+	0x08, 0xBF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x4B, 0xFF, 0x80, 0x4F, 0xF4, 0x00, 0x00,
+	0x00, 0xBF, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+	0xF0, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x04,
+	0xFF, 0xFB, 0x44, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x04, 0xBF,
+	0xFF, 0xFB, 0x40, 0x00, 0x00, 0x8F, 0xFB, 0x8B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x4F,
+	0xFF, 0x40, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xF0,
+	0x00, 0x00, 0x00, 0x8F, 0xF4, 0x4F, 0xFB, 0x80, 0x00, 0x48, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFB, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0x00, 0x4F, 0xF8,
+	0x00, 0x00, 0x04, 0xFF, 0x80, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+	0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x4F,
+	0xFF, 0x80, 0x00, 0x48, 0xFF, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x48, 0xFF,
+	0xFF, 0xB8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x48, 0x80, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x8F, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0xF8, 0xFF, 0xF8, 0xBF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
+	0xFF, 0xF8, 0xFF, 0xF8, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0,
+	0x08, 0xFF, 0xF0, 0x08, 0xFF, 0xF0, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xB0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x08, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
+	0x8F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF,
+	0xFF, 0xB0, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xB4, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xB4, 0x00, 0x00,
+	0x04, 0xBF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF,
+	0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0x00,
+	0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00,
+	0x00, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF,
+	0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB8, 0x40, 0x00, 0x04, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x04,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x04, 0x88, 0x40, 0x04, 0x80, 0x00,
+	0xFF, 0x80, 0x04, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFB, 0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x08, 0xFB,
+	0x00, 0x0B, 0xFF, 0xB8, 0xBF, 0xBF, 0xF0, 0x00, 0x8F, 0xF0, 0x0F, 0xF8, 0x00, 0x4F, 0xF8, 0x00,
+	0x0B, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x4F, 0xF0, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0xFF, 0x80, 0x00,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x8F, 0xF0, 0xBF, 0x80,
+	0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x80, 0x08, 0xFF, 0x00, 0x00,
+	0x08, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x08, 0xFF, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+	0xFF, 0x40, 0xFF, 0x80, 0x08, 0xFF, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x80,
+	0x04, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x00, 0x8F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
+	0xB0, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xBF, 0xB0, 0x00, 0x4B, 0xFF, 0xB4, 0x00, 0x4B, 0xFF, 0xB4,
+	0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x88, 0x88, 0x8B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0xFF, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0xBF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
+	0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+	0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x8F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+	0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x8F, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x88, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF,
+	0xB8, 0x88, 0x8B, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0xFF, 0x80, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x08,
+	0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+	0xFF, 0xB8, 0x88, 0x8B, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xB8,
+	0x88, 0x88, 0xBF, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x4F, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+	0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0xFF,
+	0xB8, 0x88, 0x88, 0xBF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x48, 0x88, 0x88,
+	0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x04,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x88, 0xBF, 0xFF, 0x80, 0x00, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x40, 0x0F, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x88, 0xBF, 0xFF, 0x80, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xB8, 0x88, 0x88, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x8B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x88, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xB8, 0x88, 0x88,
+	0x88, 0x84, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB8, 0x88, 0x88,
+	0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFB, 0x40,
+	0x00, 0x00, 0x04, 0xBF, 0x80, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x0F, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x48, 0x88, 0x88, 0xFF, 0x80, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x8F,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x80, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFB, 0x40, 0x00, 0x00,
+	0x04, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x04, 0x8B, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xB8, 0x88, 0x88,
+	0x88, 0x88, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
+	0x80, 0x00, 0x4F, 0xF8, 0xFF, 0x88, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x4B, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00,
+	0x00, 0x00, 0x88, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0xBF,
+	0xFB, 0x00, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x00, 0x4F, 0xFB, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80,
+	0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x84, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF,
+	0x80, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0xFF, 0x80, 0x00,
+	0x0B, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x4F,
+	0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x88, 0x40, 0x00, 0x00, 0x00, 0x88, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x48, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+	0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xFF, 0x8B, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xB8, 0xFF, 0xFF, 0x84, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x48,
+	0xFF, 0xFF, 0x80, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x08, 0xFF, 0xFF, 0x80, 0x8F, 0xF4,
+	0x00, 0x00, 0x00, 0x0F, 0xF8, 0x08, 0xFF, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0x08, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x08, 0xFF, 0xFF, 0x80, 0x04,
+	0xFF, 0x80, 0x00, 0x04, 0xFF, 0x40, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFB,
+	0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xF4, 0x00, 0x4F, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0x80,
+	0x00, 0x0F, 0xFB, 0x00, 0x8F, 0xF0, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF,
+	0x80, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x88, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+	0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x88, 0x40, 0x00, 0x00, 0x04,
+	0x88, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x88, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8,
+	0xFF, 0x80, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x4F, 0xFB, 0x00, 0x00, 0x0F, 0xF8,
+	0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x04, 0xFF, 0xF0, 0x00, 0x0F, 0xF8,
+	0xFF, 0x80, 0x00, 0x8F, 0xF8, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF8,
+	0xFF, 0x80, 0x00, 0x04, 0xFF, 0xB0, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x0F, 0xF8,
+	0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFB, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x4F, 0xF8,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8,
+	0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x88, 0x8F, 0xFF, 0xFB, 0x00, 0x04, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0,
+	0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xF8, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFB, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xF4, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x08, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xF8, 0x88, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x48, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xB8, 0x88, 0x8B, 0xFF, 0xF4, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x40, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFB,
+	0x00, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFB, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xF8, 0x88, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x00,
+	0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFB, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x8F, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04,
+	0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0xF8, 0x88, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x48, 0xBF, 0xFF, 0xF8, 0x40, 0xBF, 0xFF, 0xB4, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xB8, 0x88, 0x8B, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x4B, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+	0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF,
+	0x80, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0xFF, 0xB8, 0x88, 0x8B, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xB4, 0x00, 0x00, 0xFF, 0xB8, 0x88, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
+	0x40, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xF8, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x80,
+	0x00, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x8F, 0xF8, 0x88, 0x40, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x80, 0x00,
+	0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x4B, 0xF8, 0x00, 0x4F, 0xF8,
+	0x00, 0x00, 0x00, 0x44, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+	0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80,
+	0xF8, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x00, 0xFF, 0xFF, 0x88, 0x8B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x8F, 0xF4,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x08, 0xFF,
+	0xFB, 0x88, 0x8B, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04,
+	0x8F, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xB0, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x4F, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x08, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
+	0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x08, 0xFF,
+	0x40, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
+	0x0F, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xB0, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xF8, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x0B, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x8F,
+	0xF4, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x88, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+	0x04, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+	0xF0, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+	0x08, 0xFF, 0x00, 0x8F, 0xF0, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x0B, 0xF8,
+	0x00, 0x8F, 0xF4, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
+	0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x4F, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
+	0x4F, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x08, 0xFF, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x80, 0xBF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB,
+	0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x80, 0x00, 0x00, 0x00, 0x04, 0x88,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40,
+	0x4F, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+	0x00, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0x40, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00,
+	0x04, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+	0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80,
+	0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x80, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
+	0x4F, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+	0x04, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00,
+	0x00, 0x4F, 0xFB, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x8F, 0xF4, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0x80, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84,
+	0xFF, 0xFF, 0xF8, 0xFF, 0xB8, 0x84, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+	0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+	0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00,
+	0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+	0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xB8, 0x84, 0xFF, 0xFF, 0xF8, 0x48, 0x88,
+	0x84, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xF8, 0x88,
+	0x8F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
+	0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8,
+	0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
+	0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
+	0xF8, 0x00, 0x0F, 0xF8, 0x88, 0x8F, 0xF8, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x8F, 0xF0, 0x00,
+	0x00, 0x00, 0x0B, 0xFB, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x08, 0xFF, 0x00, 0x00, 0x00,
+	0xBF, 0xF0, 0x04, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x08, 0xFF, 0x00,
+	0x00, 0x4F, 0xF8, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x08,
+	0xFF, 0x40, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x04, 0xFF,
+	0x40, 0x00, 0x8F, 0xB0, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8B, 0xFF, 0xFF,
+	0x84, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xB8, 0x00, 0x04, 0xFF, 0xF0, 0x44, 0x00,
+	0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x48, 0x88, 0x8F, 0xF8, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xB8, 0x88,
+	0x8F, 0xF8, 0x8F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
+	0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xF8, 0x8F, 0xF8, 0x00, 0x4B, 0xFB, 0xF8,
+	0x0B, 0xFF, 0xFF, 0xFF, 0x48, 0xF8, 0x00, 0x8F, 0xFF, 0xB4, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x4B, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+	0x88, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xB4, 0x00, 0x8F, 0xFB, 0x00, 0xFF, 0xFB, 0x00,
+	0x00, 0x08, 0xFF, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0xBF, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0xBF, 0xB0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFB, 0x00, 0x00,
+	0x0B, 0xFF, 0x40, 0xFF, 0xBF, 0xB4, 0x00, 0x8F, 0xFB, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0,
+	0x00, 0x88, 0x00, 0x8F, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x08, 0xFF,
+	0x80, 0x00, 0x8F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x04, 0xF0,
+	0x0B, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0xBF, 0xFF,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x08,
+	0xBF, 0xFB, 0x80, 0x8F, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x8F, 0xF0, 0x0B, 0xFF, 0x80, 0x04,
+	0xBF, 0xFF, 0xF0, 0x4F, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
+	0xF0, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x8F, 0xF0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0xFF, 0xF0, 0x4F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x04, 0xBF, 0xBF, 0xF0,
+	0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x0F, 0xF0, 0x00, 0x08, 0xFF, 0xFB, 0x40, 0x08, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x04, 0xFF,
+	0x80, 0x00, 0x8F, 0xFB, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x8F, 0xF0, 0x00, 0x00,
+	0x00, 0xBF, 0xB0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0xBF,
+	0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x40, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB4, 0x00, 0x04,
+	0x8F, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x8F, 0xFF, 0xFB, 0x84, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x88, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x88, 0xB8, 0x00, 0x4F,
+	0xF8, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0x88, 0xBF, 0xF8, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0xBF, 0xF8, 0x88,
+	0x40, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x48, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x88, 0x88, 0x84, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x04, 0xFF, 0xB0, 0x00, 0xBF, 0xF8, 0x84, 0x0B, 0xFF, 0x00,
+	0x00, 0x0B, 0xFB, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x08,
+	0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x4F, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x88, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x4F, 0xF0,
+	0x08, 0x88, 0x40, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x88, 0x88,
+	0x84, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0x88, 0x88, 0x8F, 0xFF,
+	0xB0, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x8F, 0xFF, 0xB8,
+	0x88, 0xBF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x04, 0x88, 0x88, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x4B, 0xFF, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF,
+	0xB4, 0x04, 0xBF, 0xF4, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x88, 0x40, 0x00, 0x00,
+	0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0xFF, 0xF0,
+	0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x0F,
+	0xFF, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x08, 0xFF,
+	0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00,
+	0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08,
+	0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF,
+	0x00, 0x0F, 0xFB, 0x88, 0xBF, 0xF4, 0xFF, 0xFF, 0xB0, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0x88, 0x80, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xB0, 0xFF, 0x80, 0x00, 0x4F, 0xFB, 0x00, 0xFF, 0x80,
+	0x04, 0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x4F, 0xFB, 0x00, 0x00, 0xFF, 0x84, 0xFF, 0x80, 0x00, 0x00,
+	0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x88, 0xFF, 0x40,
+	0x00, 0x00, 0xFF, 0x80, 0xBF, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x80,
+	0x04, 0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xFB, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80,
+	0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x88, 0x40, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x4B, 0xFF, 0xB8, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0xFF,
+	0x84, 0xFF, 0xFF, 0xFF, 0xB0, 0x4B, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xBF, 0xB4, 0x00, 0xBF, 0xF4,
+	0xFF, 0x40, 0x0B, 0xFF, 0x80, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xB0,
+	0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08,
+	0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F,
+	0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00,
+	0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00,
+	0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x88, 0x40, 0x00, 0x00, 0x04, 0x88, 0x00,
+	0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x4B, 0xFF, 0xF8, 0x00, 0xFF, 0x88, 0xFF, 0xFF,
+	0xFF, 0xB0, 0xFF, 0xBF, 0xB4, 0x04, 0xBF, 0xF4, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xB0,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0x88, 0x40, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+	0x04, 0xFF, 0xB4, 0x00, 0x4B, 0xFF, 0xB0, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x8F, 0xF4,
+	0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x8F,
+	0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0xB4,
+	0x00, 0x4B, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x4B, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x08, 0xFF, 0xFF, 0xFF,
+	0xF4, 0x00, 0xFF, 0xBF, 0xB4, 0x00, 0x8F, 0xFB, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0x40,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
+	0xB0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xFF,
+	0xFF, 0xB4, 0x00, 0xBF, 0xFB, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x8F,
+	0xFF, 0xB8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFB, 0x80, 0x08, 0x80, 0x00, 0xBF, 0xFF,
+	0xFF, 0xFB, 0x0F, 0xF0, 0x0B, 0xFF, 0x80, 0x04, 0xBF, 0xBF, 0xF0, 0x4F, 0xFB, 0x00, 0x00, 0x0B,
+	0xFF, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x4F, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
+	0xF0, 0x0B, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0xF0, 0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xF0, 0x00,
+	0x08, 0xFF, 0xFB, 0x40, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x8F, 0xFB, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0x8F, 0xFF, 0xFF, 0x40, 0x00,
+	0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4B, 0xFF, 0xFB, 0x80, 0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFB, 0x00, 0x04, 0xB8, 0x8F,
+	0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xB4, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x04,
+	0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x08, 0xBF, 0xFF, 0xB8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+	0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x88, 0xBF, 0xF8, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+	0x88, 0xBF, 0xF8, 0x88, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+	0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
+	0xF0, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x04, 0x88, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF0, 0x00, 0x00,
+	0xBF, 0xFF, 0x4F, 0xFB, 0x40, 0x4B, 0xFB, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0x00, 0x8F,
+	0xFF, 0xB4, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x80, 0x00, 0x00, 0x00, 0x08, 0x84, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x4F, 0xF8,
+	0x00, 0x00, 0x00, 0x8F, 0xF0, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x08, 0xFF, 0x40, 0x00,
+	0x04, 0xFF, 0x80, 0x04, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFB,
+	0x00, 0x00, 0x8F, 0xF4, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x44, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
+	0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0xF0, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
+	0x00, 0xFF, 0xB0, 0x4F, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFB,
+	0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x8F, 0xF4,
+	0x00, 0x0B, 0xFF, 0x00, 0x08, 0xFF, 0x80, 0x04, 0xFF, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+	0xFF, 0x80, 0x08, 0xFB, 0x0B, 0xFB, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xF8, 0x08,
+	0xFF, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00,
+	0x00, 0x0F, 0xF8, 0x8F, 0xF0, 0x00, 0xBF, 0x84, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x8F, 0x80,
+	0x00, 0x8F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x4F, 0xFB, 0xFB, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x04, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00,
+	0x04, 0x88, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xF4,
+	0x00, 0x04, 0xFF, 0x80, 0x04, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x00,
+	0x4F, 0xFB, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x4F, 0xF4, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x0B, 0xFF, 0x40, 0x00,
+	0x0B, 0xFF, 0x40, 0x04, 0xFF, 0xB0, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0xBF, 0xF0,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x88, 0x40, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x08, 0x84, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x8F, 0xF4, 0x00, 0x00,
+	0x00, 0xBF, 0xF0, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x08, 0xFF,
+	0x40, 0x08, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+	0x8F, 0xF0, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x0F, 0xFB,
+	0x00, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88, 0xBF, 0xF8, 0x00,
+	0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00,
+	0xBF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+	0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x0F, 0xFB, 0x84, 0x00, 0x4F,
+	0xF4, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0xFF,
+	0x80, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0xFF,
+	0x80, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x0F, 0xFB, 0x84, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00,
+	0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+	0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x88, 0xFF,
+	0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x84, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x04,
+	0xFF, 0xB4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x8F,
+	0xF0, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x88, 0xFF, 0x80, 0x00, 0xFF, 0xFB,
+	0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x88, 0x4F, 0xFF, 0xFF, 0xF4, 0x00,
+	0x00, 0xFF, 0xBF, 0xB0, 0x0B, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x8F, 0xF8,
+	0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+char_info_t font30_aa_info[] = {
+	{1, 0}, 		/*   */ 
+	{4, 30}, 		/* ! */ 
+	{9, 90}, 		/* " */ 
+	{15, 240}, 		/* # */ 
+	{13, 480}, 		/* $ */ 
+	{20, 690}, 		/* % */ 
+	{19, 990}, 		/* & */ 
+	{3, 1290}, 		/* ' */ 
+	{6, 1350}, 		/* ( */ 
+	{6, 1440}, 		/* ) */ 
+	{11, 1530}, 		/* * */ 
+	{14, 1710}, 		/* + */ 
+	{6, 1920}, 		/* , */ 
+	{8, 2010}, 		/* - */ 
+	{4, 2130}, 		/* . */ 
+	{12, 2190}, 		/* / */ 
+	{14, 2370}, 		/* 0 */ 
+	{12, 2580}, 		/* 1 */ 
+	{13, 2760}, 		/* 2 */ 
+	{13, 2970}, 		/* 3 */ 
+	{15, 3180}, 		/* 4 */ 
+	{13, 3420}, 		/* 5 */ 
+	{14, 3630}, 		/* 6 */ 
+	{13, 3840}, 		/* 7 */ 
+	{14, 4050}, 		/* 8 */ 
+	{14, 4260}, 		/* 9 */ 
+	{4, 4470}, 		/* : */ 
+	{5, 4530}, 		/* ; */ 
+	{14, 4620}, 		/* < */ 
+	{13, 4830}, 		/* = */ 
+	{14, 5040}, 		/* > */ 
+	{11, 5250}, 		/* ? */ 
+	{23, 5430}, 		/* @ */ 
+	{18, 5790}, 		/* A */ 
+	{14, 6060}, 		/* B */ 
+	{15, 6270}, 		/* C */ 
+	{16, 6510}, 		/* D */ 
+	{12, 6750}, 		/* E */ 
+	{11, 6930}, 		/* F */ 
+	{17, 7110}, 		/* G */ 
+	{15, 7380}, 		/* H */ 
+	{3, 7620}, 		/* I */ 
+	{8, 7680}, 		/* J */ 
+	{13, 7800}, 		/* K */ 
+	{11, 8010}, 		/* L */ 
+	{22, 8190}, 		/* M */ 
+	{16, 8520}, 		/* N */ 
+	{18, 8760}, 		/* O */ 
+	{13, 9030}, 		/* P */ 
+	{21, 9240}, 		/* Q */ 
+	{14, 9570}, 		/* R */ 
+	{13, 9780}, 		/* S */ 
+	{15, 9990}, 		/* T */ 
+	{15, 10230}, 		/* U */ 
+	{17, 10470}, 		/* V */ 
+	{27, 10740}, 		/* W */ 
+	{15, 11160}, 		/* X */ 
+	{15, 11400}, 		/* Y */ 
+	{14, 11640}, 		/* Z */ 
+	{6, 11850}, 		/* [ */ 
+	{13, 11940}, 		/* \ */ 
+	{6, 12150}, 		/* ] */ 
+	{13, 12240}, 		/* ^ */ 
+	{16, 12450}, 		/* _ */ 
+	{5, 12690}, 		/* ` */ 
+	{12, 12780}, 		/* a */ 
+	{13, 12960}, 		/* b */ 
+	{11, 13170}, 		/* c */ 
+	{13, 13350}, 		/* d */ 
+	{13, 13560}, 		/* e */ 
+	{10, 13770}, 		/* f */ 
+	{14, 13920}, 		/* g */ 
+	{12, 14130}, 		/* h */ 
+	{3, 14310}, 		/* i */ 
+	{6, 14370}, 		/* j */ 
+	{12, 14460}, 		/* k */ 
+	{3, 14640}, 		/* l */ 
+	{21, 14700}, 		/* m */ 
+	{12, 15030}, 		/* n */ 
+	{14, 15210}, 		/* o */ 
+	{13, 15420}, 		/* p */ 
+	{13, 15630}, 		/* q */ 
+	{8, 15840}, 		/* r */ 
+	{10, 15960}, 		/* s */ 
+	{9, 16110}, 		/* t */ 
+	{12, 16260}, 		/* u */ 
+	{14, 16440}, 		/* v */ 
+	{21, 16650}, 		/* w */ 
+	{13, 16980}, 		/* x */ 
+	{14, 17190}, 		/* y */ 
+	{10, 17400}, 		/* z */ 
+	{8, 17550}, 		/* { */ 
+	{3, 17670}, 		/* | */ 
+	{8, 17730}, 		/* } */ 
+	{14, 17850}, 		/* ~ */ 
+};
+
+/**
+ * @brief 45 pixels height anti-aliased data array (from 89 pixels font).
+ */
+const uint8_t font45_aa_data[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F,
+	0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF,
+	0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x4F, 0xFF, 0x80, 0x0F, 0xFF, 0x80,
+	0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F,
+	0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x8F, 0xFF, 0xF0,
+	0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF,
+	0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0xF8, 0x00, 0x00,
+	0x8F, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF8, 0x48, 0x80,
+	0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00,
+	0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00,
+	0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0,
+	0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+	0x00, 0x04, 0x88, 0x8F, 0xFF, 0xB8, 0x88, 0x88, 0x8F, 0xFF, 0xB8, 0x84, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x04, 0x88, 0xBF, 0xFF, 0x88, 0x88, 0x88, 0xBF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFB, 0x88, 0x88,
+	0x88, 0xFF, 0xFB, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x8B, 0xFF, 0xF8, 0x88,
+	0x88, 0x8B, 0xFF, 0xF8, 0x88, 0x40, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+	0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8B, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0xB8, 0x00,
+	0x00, 0x08, 0xBF, 0xFF, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBB, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x8F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0x80, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x8B, 0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x08, 0x8B, 0xFF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xF8, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0x40, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0xBF, 0xFB, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x40, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x48, 0x88,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x4B, 0xFF, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xB0, 0x00,
+	0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x0F, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00,
+	0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+	0xFB, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x88, 0x8B, 0xFF, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x04, 0xBF, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0xBF, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x0B, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x08,
+	0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF0,
+	0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x48, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+	0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x4F, 0xFF, 0xFF, 0xFF, 0x00,
+	0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x4B,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x88,
+	0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+	0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x8F, 0xF8, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x88, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+	0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00,
+	0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF,
+	0xB0, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+	0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00,
+	0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00,
+	0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0F, 0xFF,
+	0x00, 0x00, 0xB4, 0x00, 0x4F, 0xFB, 0x40, 0x0F, 0xF8, 0x00, 0x4F, 0xFF, 0x00, 0xBF, 0xFF, 0xF4,
+	0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x4B, 0xFF, 0xFF, 0xBF, 0xFB, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFB, 0x4F, 0xF8, 0x4F, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xB0, 0x0F,
+	0xF8, 0x04, 0xBF, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x0F, 0xFB, 0x00, 0x0B, 0xFB, 0x00, 0x04, 0x40,
+	0x00, 0x0F, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0xBF, 0xFF, 0x88, 0x88, 0x88, 0x88,
+	0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF,
+	0x00, 0x04, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+	0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0xBF, 0xFF, 0xB0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+	0xF0, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0xBF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+	0x0B, 0xFF, 0xFF, 0xF8, 0x88, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+	0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x4B, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x40, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFB,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF,
+	0x40, 0x00, 0x8F, 0xFB, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x8F, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xBF,
+	0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xB8, 0x88, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x48,
+	0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xB0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+	0xFF, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF, 0xFB, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+	0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x40, 0x00, 0x04, 0xBB, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0x40, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0xFF, 0xFB, 0x80, 0x00, 0x00,
+	0x8B, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0xFF,
+	0xFF, 0xFB, 0x40, 0x00, 0x08, 0x8F, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x08, 0x88, 0x88, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x88, 0xBF, 0xFF, 0xFF, 0x80, 0xFF,
+	0xFF, 0xFB, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x4F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xF4, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF,
+	0xF8, 0x40, 0x04, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFB, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x4B,
+	0xFF, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x0B,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0,
+	0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+	0xB4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB4, 0x4B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04,
+	0xFF, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0x8F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0x88, 0x88, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x8B, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+	0x0B, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x4F, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x8B, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFB, 0x80, 0x08, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00,
+	0x0F, 0xF8, 0x40, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0xBF, 0xFF, 0xB0, 0xFF,
+	0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0xBF,
+	0xFF, 0xB0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x8F, 0xFF,
+	0xF8, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0xFF, 0xFB,
+	0x00, 0x08, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0xFF, 0xF4, 0x00,
+	0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF,
+	0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFB,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF,
+	0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B,
+	0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+	0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x8F, 0xFF, 0xFF,
+	0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB8, 0x88,
+	0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+	0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x48, 0x88, 0x00,
+	0x00, 0x4F, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF,
+	0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFB, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+	0x00, 0x4F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
+	0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x0F, 0xFF, 0xB0, 0x00,
+	0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x0F, 0xFF,
+	0x80, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xF0,
+	0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x0B,
+	0xFF, 0xF0, 0x8F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x40, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFB, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+	0x8F, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0xFF, 0xF8,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00,
+	0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0xFF, 0xFF,
+	0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x80, 0x00,
+	0x00, 0x4B, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0xBF, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xF8, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xF8, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+	0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xB0, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88,
+	0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFF,
+	0x40, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xB8, 0x88, 0x88,
+	0x88, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xBF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x88, 0x8B, 0xFF, 0xFF, 0xF8,
+	0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xB8, 0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x0B, 0xFF,
+	0xFF, 0xFB, 0x80, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x8F, 0xFF,
+	0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xB8, 0x88,
+	0x88, 0x8B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xB8,
+	0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x88,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0xB8, 0x88, 0x8B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xBF, 0x80, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x08, 0x8F, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+	0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xBF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0xFF,
+	0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF,
+	0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+	0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0xFB, 0x40, 0x00, 0xBF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x48, 0x88, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
+	0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x04, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xBF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4F,
+	0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xFB, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+	0x88, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFB, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x88, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xF0, 0xFF,
+	0xFF, 0x80, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xF0,
+	0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00,
+	0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0x80,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x08,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+	0x40, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8B,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x08, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFB,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+	0xFB, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFB, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xBF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0xFF, 0xFF, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x40,
+	0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x4F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88,
+	0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x88,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xBF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xFF, 0xF8, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0xFB, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xB8, 0x88, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0xB0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x8B, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+	0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0x88, 0x88, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xBF, 0xF0, 0x00,
+	0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xB8, 0x00,
+	0x00, 0x4B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+	0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x88, 0x40, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x08, 0xFF,
+	0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x84, 0x00,
+	0x04, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88,
+	0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x84, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x4F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x4F,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x44, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0x88, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xBF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xF4, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
+	0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x0F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
+	0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xF0,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+	0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF4, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x88, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x88, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB8, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0x88, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+	0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB,
+	0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+	0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x0B,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB8, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFB, 0x88,
+	0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00,
+	0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00,
+	0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x48, 0x88,
+	0xBF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x48, 0x88, 0x88,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB4,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xB0, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x4F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0x80, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00,
+	0x00, 0xFF, 0xFF, 0x40, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF,
+	0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0xBF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00,
+	0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x40, 0x00, 0x48, 0xFF,
+	0xFF, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x04, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x08, 0x88, 0x88, 0x8B, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF8, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0xFB, 0x88, 0x88,
+	0x8B, 0xFF, 0xF8, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x4B, 0xFF,
+	0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFB, 0xFF, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xB0, 0xFF, 0xF8, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x08,
+	0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
+	0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF,
+	0xBF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x4F, 0xFF,
+	0xFF, 0x40, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
+	0xFF, 0xFB, 0x40, 0x04, 0xBF, 0xFF, 0xFB, 0x00, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF0, 0x00, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x4F,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+	0x00, 0xBF, 0xFF, 0xFF, 0xB8, 0x88, 0xFF, 0xFF, 0x80, 0x04, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x08,
+	0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x4F, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80,
+	0x04, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF,
+	0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x08, 0xFF,
+	0xF8, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xB8, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x08,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04,
+	0xFF, 0xFF, 0xF8, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xBF, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xF8, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
+	0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+	0x40, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x48, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xB8,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x8F, 0xFF, 0xFB,
+	0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF8, 0xFF, 0xFF, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x8F,
+	0x80, 0x00, 0x4F, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x88, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x88, 0x8B, 0xFF, 0xFB, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x88, 0x8B, 0xFF, 0xFB, 0x88, 0x88, 0x40,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x84,
+	0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x84, 0x00, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF4, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x0F,
+	0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+	0x00, 0x00, 0x04, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x04,
+	0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+	0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x4F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x8F, 0xFF,
+	0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFB, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF8, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x4F, 0xFF,
+	0xFF, 0xF8, 0x88, 0x88, 0xBF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+	0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x4B, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFF, 0xF4, 0x00,
+	0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x80, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+	0xBF, 0xFF, 0xB0, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x88, 0x00, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF,
+	0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80,
+	0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F,
+	0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF, 0x80, 0x8F, 0xFF,
+	0x80, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x8F,
+	0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x88,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+	0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+	0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+	0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
+	0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x40, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFB,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF4,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+	0x84, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xB8, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF,
+	0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF,
+	0xF8, 0xBF, 0xFF, 0xB8, 0x8F, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xFF, 0x80, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xB4, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xBF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x84, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF,
+	0xF8, 0xBF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x4F,
+	0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0xBF, 0xFB, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x40, 0x00, 0x4B, 0xFF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBF, 0xFF, 0xB0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+	0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
+	0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x4B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x84, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xF8, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+	0xFF, 0xFB, 0xFF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+	0x4F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xF0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xFF,
+	0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x88, 0x84, 0x00, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+	0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xFB, 0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0xB0,
+	0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF8,
+	0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF8, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x4F, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
+	0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40,
+	0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+	0x84, 0x00, 0x08, 0xFF, 0xFB, 0x40, 0xFF, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0x4F,
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xBF, 0xFF, 0x88, 0xBF, 0x80, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00,
+	0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
+	0xFF, 0xFB, 0x40, 0x00, 0x48, 0xFF, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x8F,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x84, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0xFF,
+	0x80, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xB8, 0x88, 0xBF, 0xFF, 0xFB, 0x00, 0xBF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x48, 0x8B, 0xFF, 0xFB, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x8B, 0xFF, 0xFB, 0x88, 0x88, 0x80, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x84, 0x00, 0x00,
+	0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+	0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF,
+	0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF4, 0x8F, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0x00, 0x08, 0xFF,
+	0xFF, 0xFF, 0xB4, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x84, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+	0xF4, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+	0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+	0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x4F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x4F, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
+	0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F,
+	0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+	0xF0, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x08, 0xFF,
+	0xB0, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
+	0x80, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x0F, 0xFF,
+	0x00, 0x0F, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x8F, 0xFF,
+	0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x8F, 0xF8,
+	0x00, 0x08, 0xFF, 0xF0, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0xFF, 0xF8,
+	0x00, 0x04, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF0,
+	0x00, 0x00, 0xFF, 0xF8, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x48, 0xFF, 0xF0,
+	0x00, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x88, 0xFF, 0x80,
+	0x00, 0x00, 0x8F, 0xFF, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFB, 0x00,
+	0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
+	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x88, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x4F,
+	0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F,
+	0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF,
+	0xF4, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x4F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xBB, 0xFF, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
+	0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x8F, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0B,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+	0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+	0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0xBF, 0xFF, 0x40, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x08, 0xFF,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0xFF, 0xF8, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x8F, 0xFF, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x8F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB8,
+	0x88, 0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xF4, 0x00, 0x00, 0x04,
+	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+	0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x84, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x88, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+	0xFF, 0xB4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF,
+	0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x04,
+	0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00,
+	0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x48, 0x8F, 0xFF,
+	0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x48,
+	0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+	0x00, 0x08, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x4F,
+	0xFF, 0xF8, 0x8B, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x4F, 0xFF,
+	0x00, 0x00, 0x0F, 0xFF, 0xB0, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xB4, 0x00, 0xBF, 0xFF, 0x80,
+	0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+	0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+char_info_t font45_aa_info[] = {
+	{1, 0}, 		/*   */ 
+	{5, 45}, 		/* ! */ 
+	{12, 180}, 		/* " */ 
+	{22, 450}, 		/* # */ 
+	{20, 945}, 		/* $ */ 
+	{31, 1395}, 		/* % */ 
+	{28, 2115}, 		/* & */ 
+	{4, 2745}, 		/* ' */ 
+	{9, 2835}, 		/* ( */ 
+	{9, 3060}, 		/* ) */ 
+	{17, 3285}, 		/* * */ 
+	{21, 3690}, 		/* + */ 
+	{8, 4185}, 		/* , */ 
+	{12, 4365}, 		/* - */ 
+	{5, 4635}, 		/* . */ 
+	{18, 4770}, 		/* / */ 
+	{22, 5175}, 		/* 0 */ 
+	{19, 5670}, 		/* 1 */ 
+	{19, 6120}, 		/* 2 */ 
+	{19, 6570}, 		/* 3 */ 
+	{22, 7020}, 		/* 4 */ 
+	{19, 7515}, 		/* 5 */ 
+	{20, 7965}, 		/* 6 */ 
+	{20, 8415}, 		/* 7 */ 
+	{21, 8865}, 		/* 8 */ 
+	{20, 9360}, 		/* 9 */ 
+	{5, 9810}, 		/* : */ 
+	{8, 9945}, 		/* ; */ 
+	{20, 10125}, 		/* < */ 
+	{20, 10575}, 		/* = */ 
+	{20, 11025}, 		/* > */ 
+	{17, 11475}, 		/* ? */ 
+	{35, 11880}, 		/* @ */ 
+	{26, 12690}, 		/* A */ 
+	{20, 13275}, 		/* B */ 
+	{22, 13725}, 		/* C */ 
+	{24, 14220}, 		/* D */ 
+	{17, 14760}, 		/* E */ 
+	{16, 15165}, 		/* F */ 
+	{25, 15525}, 		/* G */ 
+	{22, 16110}, 		/* H */ 
+	{5, 16605}, 		/* I */ 
+	{12, 16740}, 		/* J */ 
+	{20, 17010}, 		/* K */ 
+	{16, 17460}, 		/* L */ 
+	{33, 17820}, 		/* M */ 
+	{23, 18585}, 		/* N */ 
+	{27, 19125}, 		/* O */ 
+	{19, 19755}, 		/* P */ 
+	{31, 20205}, 		/* Q */ 
+	{21, 20925}, 		/* R */ 
+	{19, 21420}, 		/* S */ 
+	{24, 21870}, 		/* T */ 
+	{23, 22410}, 		/* U */ 
+	{26, 22950}, 		/* V */ 
+	{40, 23535}, 		/* W */ 
+	{23, 24435}, 		/* X */ 
+	{23, 24975}, 		/* Y */ 
+	{20, 25515}, 		/* Z */ 
+	{8, 25965}, 		/* [ */ 
+	{18, 26145}, 		/* \ */ 
+	{9, 26550}, 		/* ] */ 
+	{19, 26775}, 		/* ^ */ 
+	{24, 27225}, 		/* _ */ 
+	{8, 27765}, 		/* ` */ 
+	{18, 27945}, 		/* a */ 
+	{20, 28350}, 		/* b */ 
+	{17, 28800}, 		/* c */ 
+	{20, 29205}, 		/* d */ 
+	{20, 29655}, 		/* e */ 
+	{14, 30105}, 		/* f */ 
+	{20, 30420}, 		/* g */ 
+	{19, 30870}, 		/* h */ 
+	{5, 31320}, 		/* i */ 
+	{10, 31455}, 		/* j */ 
+	{18, 31680}, 		/* k */ 
+	{4, 32085}, 		/* l */ 
+	{32, 32175}, 		/* m */ 
+	{19, 32895}, 		/* n */ 
+	{21, 33345}, 		/* o */ 
+	{20, 33840}, 		/* p */ 
+	{20, 34290}, 		/* q */ 
+	{13, 34740}, 		/* r */ 
+	{15, 35055}, 		/* s */ 
+	{14, 35415}, 		/* t */ 
+	{18, 35730}, 		/* u */ 
+	{20, 36135}, 		/* v */ 
+	{32, 36585}, 		/* w */ 
+	{19, 37305}, 		/* x */ 
+	{20, 37755}, 		/* y */ 
+	{15, 38205}, 		/* z */ 
+	{12, 38565}, 		/* { */ 
+	{4, 38835}, 		/* | */ 
+	{12, 38925}, 		/* } */ 
+	{21, 39195}, 		/* ~ */ 
+};
+
+/*==================[external data definition]===============================*/
+
+Font_t font_30_aa = {
+	30,
+	font30_aa_info,
+	font30_aa_data,
+	FONT_AA4
+};
+
+Font_t font_45_aa = {
+	45,
+	font45_aa_info,
+	font45_aa_data,
+	FONT_AA4
+};
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,2286 @@
+/**
+ * @file fonts_rle.c
+ * @brief Run-length compressed version of fonts.c. Created with tools/font_rle.py
+ */
+
+/*==================[inclusions]=============================================*/
+#include "fonts.h"
+/*==================[internal data definition]===============================*/
+/**
+ * @brief 22 pixels height run-length compressed data array.
+ */
+const uint8_t font22_rle_data[] = {
+	0x81, 0x15, 0x20, 0x81, 0x01, 0x30, 0x83, 0x0B, 0x02, 0x10, 0x01, 0x30, 0x03, 0x02, 0x10, 0x02,
+	0x03, 0x03, 0x02, 0x10, 0x81, 0x03, 0x30, 0x81, 0x01, 0x60, 0x84, 0x02, 0x02, 0x22, 0x84, 0x02,
+	0x01, 0x32, 0x81, 0x0D, 0x60, 0x81, 0x02, 0xB0, 0x85, 0x02, 0x32, 0x32, 0x10, 0x82, 0x01, 0x1A,
+	0x05, 0x32, 0x32, 0x10, 0x85, 0x01, 0x31, 0x41, 0x20, 0x05, 0x22, 0x32, 0x20, 0x82, 0x01, 0x0B,
+	0x85, 0x02, 0x22, 0x32, 0x20, 0x05, 0x21, 0x41, 0x30, 0x81, 0x03, 0xB0, 0x03, 0x52, 0x30, 0x83,
+	0x01, 0x51, 0x40, 0x03, 0x35, 0x20, 0x03, 0x18, 0x10, 0x05, 0x12, 0x51, 0x10, 0x03, 0x02, 0x80,
+	0x03, 0x03, 0x70, 0x03, 0x12, 0x70, 0x03, 0x15, 0x40, 0x03, 0x35, 0x20, 0x03, 0x63, 0x10, 0x02,
+	0x73, 0x82, 0x01, 0x82, 0x05, 0x02, 0x52, 0x10, 0x03, 0x09, 0x10, 0x03, 0x16, 0x30, 0x83, 0x01,
+	0x32, 0x50, 0x03, 0x31, 0x60, 0x01, 0xA0, 0x83, 0x01, 0xF0, 0x10, 0x05, 0x24, 0x52, 0x30, 0x07,
+	0x11, 0x31, 0x51, 0x40, 0x07, 0x02, 0x32, 0x32, 0x40, 0x07, 0x02, 0x32, 0x22, 0x50, 0x07, 0x02,
+	0x32, 0x21, 0x60, 0x07, 0x02, 0x32, 0x12, 0x60, 0x07, 0x11, 0x31, 0x12, 0x70, 0x05, 0x14, 0x12,
+	0x80, 0x05, 0x62, 0x34, 0x10, 0x07, 0x52, 0x31, 0x31, 0x10, 0x06, 0x42, 0x32, 0x32, 0x06, 0x41,
+	0x42, 0x32, 0x06, 0x32, 0x42, 0x32, 0x06, 0x22, 0x52, 0x32, 0x07, 0x21, 0x71, 0x31, 0x10, 0x05,
+	0x12, 0x74, 0x20, 0x83, 0x03, 0xF0, 0x10, 0x81, 0x01, 0xE0, 0x03, 0x45, 0x50, 0x03, 0x28, 0x40,
+	0x85, 0x02, 0x22, 0x42, 0x40, 0x05, 0x22, 0x32, 0x50, 0x03, 0x35, 0x60, 0x05, 0x33, 0x52, 0x10,
+	0x05, 0x25, 0x42, 0x10, 0x07, 0x12, 0x23, 0x32, 0x10, 0x07, 0x03, 0x33, 0x22, 0x10, 0x05, 0x02,
+	0x55, 0x20, 0x05, 0x03, 0x54, 0x20, 0x05, 0x12, 0x55, 0x10, 0x04, 0x19, 0x13, 0x04, 0x35, 0x42,
+	0x81, 0x03, 0xE0, 0x81, 0x01, 0x20, 0x82, 0x03, 0x02, 0x83, 0x01, 0x01, 0x10, 0x81, 0x0D, 0x20,
+	0x01, 0x40, 0x82, 0x01, 0x22, 0x03, 0x21, 0x10, 0x83, 0x02, 0x12, 0x10, 0x83, 0x08, 0x02, 0x20,
+	0x83, 0x02, 0x12, 0x10, 0x03, 0x21, 0x10, 0x82, 0x01, 0x22, 0x01, 0x40, 0x83, 0x01, 0x02, 0x20,
+	0x03, 0x11, 0x20, 0x83, 0x02, 0x12, 0x10, 0x82, 0x08, 0x22, 0x83, 0x02, 0x12, 0x10, 0x03, 0x11,
+	0x20, 0x83, 0x01, 0x02, 0x20, 0x01, 0x80, 0x83, 0x01, 0x32, 0x30, 0x06, 0x02, 0x12, 0x12, 0x05,
+	0x13, 0x12, 0x10, 0x03, 0x32, 0x30, 0x05, 0x13, 0x12, 0x10, 0x06, 0x02, 0x12, 0x12, 0x83, 0x01,
+	0x32, 0x30, 0x81, 0x0B, 0x80, 0x81, 0x04, 0xA0, 0x83, 0x04, 0x42, 0x40, 0x82, 0x01, 0x0A, 0x83,
+	0x04, 0x42, 0x40, 0x81, 0x04, 0xA0, 0x81, 0x0E, 0x30, 0x82, 0x02, 0x12, 0x03, 0x11, 0x10, 0x03,
+	0x02, 0x10, 0x03, 0x01, 0x20, 0x01, 0x30, 0x81, 0x0A, 0x60, 0x82, 0x01, 0x06, 0x81, 0x08, 0x60,
+	0x81, 0x0E, 0x30, 0x03, 0x02, 0x10, 0x02, 0x03, 0x03, 0x02, 0x10, 0x81, 0x03, 0x30, 0x01, 0x90,
+	0x82, 0x01, 0x72, 0x83, 0x02, 0x62, 0x10, 0x83, 0x01, 0x52, 0x20, 0x03, 0x51, 0x30, 0x83, 0x01,
+	0x42, 0x30, 0x83, 0x02, 0x32, 0x40, 0x83, 0x01, 0x22, 0x50, 0x03, 0x21, 0x60, 0x83, 0x01, 0x12,
+	0x60, 0x83, 0x01, 0x02, 0x70, 0x01, 0x90, 0x81, 0x02, 0xA0, 0x03, 0x34, 0x30, 0x03, 0x27, 0x10,
+	0x05, 0x12, 0x42, 0x10, 0x04, 0x12, 0x43, 0x84, 0x06, 0x02, 0x62, 0x05, 0x03, 0x42, 0x10, 0x05,
+	0x12, 0x42, 0x10, 0x03, 0x17, 0x20, 0x03, 0x34, 0x30, 0x81, 0x03, 0xA0, 0x81, 0x02, 0x90, 0x03,
+	0x42, 0x30, 0x03, 0x24, 0x30, 0x05, 0x03, 0x12, 0x30, 0x05, 0x02, 0x22, 0x30, 0x83, 0x08, 0x42,
+	0x30, 0x82, 0x01, 0x09, 0x81, 0x03, 0x90, 0x81, 0x02, 0xA0, 0x03, 0x25, 0x30, 0x03, 0x08, 0x20,
+	0x05, 0x02, 0x43, 0x10, 0x83, 0x02, 0x72, 0x10, 0x83, 0x01, 0x62, 0x20, 0x03, 0x52, 0x30, 0x03,
+	0x42, 0x40, 0x03, 0x32, 0x50, 0x03, 0x22, 0x60, 0x03, 0x12, 0x70, 0x82, 0x01, 0x0A, 0x81, 0x03,
+	0xA0, 0x81, 0x02, 0xA0, 0x03, 0x25, 0x30, 0x03, 0x08, 0x20, 0x05, 0x02, 0x43, 0x10, 0x83, 0x01,
+	0x72, 0x10, 0x03, 0x62, 0x20, 0x03, 0x25, 0x30, 0x03, 0x26, 0x20, 0x03, 0x72, 0x10, 0x82, 0x02,
+	0x82, 0x04, 0x02, 0x53, 0x03, 0x09, 0x10, 0x03, 0x25, 0x30, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xB0,
+	0x03, 0x63, 0x20, 0x83, 0x01, 0x54, 0x20, 0x05, 0x42, 0x12, 0x20, 0x85, 0x01, 0x32, 0x22, 0x20,
+	0x05, 0x22, 0x32, 0x20, 0x05, 0x21, 0x42, 0x20, 0x05, 0x12, 0x42, 0x20, 0x05, 0x02, 0x52, 0x20,
+	0x82, 0x01, 0x0B, 0x83, 0x02, 0x72, 0x20, 0x81, 0x03, 0xB0, 0x81, 0x02, 0xA0, 0x83, 0x01, 0x18,
+	0x10, 0x83, 0x02, 0x12, 0x70, 0x03, 0x17, 0x20, 0x03, 0x18, 0x10, 0x02, 0x73, 0x82, 0x03, 0x82,
+	0x05, 0x02, 0x52, 0x10, 0x03, 0x08, 0x20, 0x03, 0x16, 0x30, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xA0,
+	0x03, 0x44, 0x20, 0x03, 0x27, 0x10, 0x03, 0x13, 0x60, 0x03, 0x12, 0x70, 0x83, 0x01, 0x02, 0x80,
+	0x05, 0x02, 0x15, 0x20, 0x03, 0x09, 0x10, 0x04, 0x03, 0x43, 0x84, 0x02, 0x02, 0x62, 0x05, 0x12,
+	0x42, 0x10, 0x03, 0x18, 0x10, 0x03, 0x25, 0x30, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xA0, 0x82, 0x01,
+	0x0A, 0x02, 0x82, 0x83, 0x01, 0x72, 0x10, 0x83, 0x01, 0x62, 0x20, 0x83, 0x01, 0x52, 0x30, 0x03,
+	0x43, 0x30, 0x03, 0x42, 0x40, 0x03, 0x33, 0x40, 0x03, 0x32, 0x50, 0x03, 0x23, 0x50, 0x03, 0x22,
+	0x60, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xA0, 0x03, 0x34, 0x30, 0x03, 0x27, 0x10, 0x05, 0x13, 0x23,
+	0x10, 0x85, 0x01, 0x12, 0x42, 0x10, 0x05, 0x13, 0x22, 0x20, 0x03, 0x25, 0x30, 0x03, 0x34, 0x30,
+	0x05, 0x22, 0x23, 0x10, 0x04, 0x12, 0x43, 0x84, 0x01, 0x02, 0x62, 0x04, 0x03, 0x43, 0x03, 0x18,
+	0x10, 0x03, 0x26, 0x20, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xA0, 0x03, 0x34, 0x30, 0x03, 0x18, 0x10,
+	0x05, 0x03, 0x42, 0x10, 0x84, 0x02, 0x02, 0x62, 0x04, 0x03, 0x43, 0x02, 0x19, 0x04, 0x25, 0x12,
+	0x82, 0x01, 0x82, 0x03, 0x72, 0x10, 0x05, 0x01, 0x53, 0x10, 0x03, 0x08, 0x20, 0x03, 0x15, 0x40,
+	0x81, 0x03, 0xA0, 0x81, 0x06, 0x30, 0x82, 0x02, 0x03, 0x81, 0x04, 0x30, 0x82, 0x02, 0x03, 0x81,
+	0x03, 0x30, 0x81, 0x06, 0x50, 0x82, 0x02, 0x23, 0x81, 0x04, 0x50, 0x83, 0x02, 0x22, 0x10, 0x03,
+	0x12, 0x20, 0x03, 0x11, 0x30, 0x03, 0x02, 0x30, 0x01, 0x50, 0x81, 0x05, 0xA0, 0x02, 0x82, 0x02,
+	0x64, 0x03, 0x44, 0x20, 0x03, 0x24, 0x40, 0x03, 0x04, 0x60, 0x03, 0x02, 0x80, 0x03, 0x04, 0x60,
+	0x03, 0x24, 0x40, 0x03, 0x44, 0x20, 0x02, 0x64, 0x02, 0x82, 0x81, 0x04, 0xA0, 0x81, 0x07, 0xA0,
+	0x82, 0x01, 0x0A, 0x81, 0x02, 0xA0, 0x82, 0x01, 0x0A, 0x81, 0x06, 0xA0, 0x81, 0x05, 0xA0, 0x03,
+	0x02, 0x80, 0x03, 0x04, 0x60, 0x03, 0x24, 0x40, 0x03, 0x44, 0x20, 0x02, 0x64, 0x02, 0x82, 0x02,
+	0x64, 0x03, 0x44, 0x20, 0x03, 0x24, 0x40, 0x03, 0x04, 0x60, 0x03, 0x02, 0x80, 0x81, 0x04, 0xA0,
+	0x81, 0x01, 0x90, 0x03, 0x16, 0x20, 0x03, 0x08, 0x10, 0x04, 0x01, 0x53, 0x82, 0x03, 0x72, 0x03,
+	0x62, 0x10, 0x03, 0x34, 0x20, 0x83, 0x02, 0x32, 0x40, 0x01, 0x90, 0x83, 0x02, 0x32, 0x40, 0x81,
+	0x03, 0x90, 0x83, 0x02, 0xF0, 0x20, 0x03, 0x67, 0x40, 0x03, 0x4B, 0x20, 0x05, 0x33, 0x73, 0x10,
+	0x04, 0x23, 0x93, 0x08, 0x13, 0x23, 0x12, 0x32, 0x06, 0x12, 0x27, 0x32, 0x08, 0x12, 0x22, 0x23,
+	0x32, 0x08, 0x02, 0x22, 0x33, 0x32, 0x88, 0x01, 0x02, 0x22, 0x32, 0x42, 0x09, 0x02, 0x22, 0x23,
+	0x32, 0x10, 0x05, 0x02, 0x2B, 0x20, 0x07, 0x02, 0x33, 0x24, 0x30, 0x03, 0x02, 0xF0, 0x03, 0x12,
+	0xE0, 0x05, 0x14, 0x61, 0x50, 0x03, 0x2A, 0x50, 0x03, 0x47, 0x60, 0x03, 0xF0, 0x20, 0x81, 0x02,
+	0xD0, 0x03, 0x62, 0x50, 0x83, 0x01, 0x54, 0x40, 0x05, 0x42, 0x12, 0x40, 0x85, 0x01, 0x42, 0x22,
+	0x30, 0x85, 0x01, 0x32, 0x42, 0x20, 0x05, 0x31, 0x52, 0x20, 0x83, 0x01, 0x2A, 0x10, 0x05, 0x22,
+	0x62, 0x10, 0x84, 0x01, 0x12, 0x82, 0x04, 0x03, 0x82, 0x81, 0x03, 0xD0, 0x81, 0x02, 0xA0, 0x03,
+	0x07, 0x30, 0x03, 0x08, 0x20, 0x05, 0x02, 0x43, 0x10, 0x85, 0x01, 0x02, 0x52, 0x10, 0x05, 0x02,
+	0x42, 0x20, 0x03, 0x07, 0x30, 0x03, 0x09, 0x10, 0x04, 0x02, 0x53, 0x84, 0x02, 0x02, 0x62, 0x04,
+	0x02, 0x53, 0x03, 0x09, 0x10, 0x03, 0x07, 0x30, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xB0, 0x03, 0x46,
+	0x10, 0x02, 0x29, 0x04, 0x13, 0x52, 0x03, 0x12, 0x80, 0x03, 0x03, 0x80, 0x83, 0x04, 0x02, 0x90,
+	0x03, 0x03, 0x80, 0x03, 0x12, 0x80, 0x04, 0x13, 0x52, 0x02, 0x29, 0x03, 0x46, 0x10, 0x81, 0x03,
+	0xB0, 0x81, 0x02, 0xC0, 0x03, 0x08, 0x40, 0x03, 0x0A, 0x20, 0x05, 0x02, 0x54, 0x10, 0x05, 0x02,
+	0x72, 0x10, 0x04, 0x02, 0x73, 0x84, 0x04, 0x02, 0x82, 0x04, 0x02, 0x73, 0x05, 0x02, 0x72, 0x10,
+	0x05, 0x02, 0x54, 0x10, 0x03, 0x09, 0x30, 0x03, 0x08, 0x40, 0x81, 0x03, 0xC0, 0x81, 0x02, 0x80,
+	0x82, 0x01, 0x08, 0x83, 0x03, 0x02, 0x60, 0x83, 0x01, 0x07, 0x10, 0x83, 0x04, 0x02, 0x60, 0x82,
+	0x01, 0x08, 0x81, 0x03, 0x80, 0x81, 0x02, 0x80, 0x82, 0x01, 0x08, 0x83, 0x03, 0x02, 0x60, 0x82,
+	0x01, 0x08, 0x83, 0x06, 0x02, 0x60, 0x81, 0x03, 0x80, 0x81, 0x02, 0xC0, 0x03, 0x47, 0x10, 0x02,
+	0x39, 0x04, 0x23, 0x52, 0x83, 0x01, 0x12, 0x90, 0x83, 0x01, 0x02, 0xA0, 0x84, 0x01, 0x02, 0x46,
+	0x04, 0x02, 0x82, 0x04, 0x03, 0x72, 0x04, 0x12, 0x72, 0x04, 0x23, 0x52, 0x02, 0x2A, 0x03, 0x46,
+	0x20, 0x81, 0x03, 0xC0, 0x81, 0x02, 0xB0, 0x84, 0x05, 0x02, 0x72, 0x82, 0x01, 0x0B, 0x84, 0x06,
+	0x02, 0x72, 0x81, 0x03, 0xB0, 0x81, 0x02, 0x20, 0x82, 0x0E, 0x02, 0x81, 0x03, 0x20, 0x81, 0x02,
+	0x60, 0x82, 0x0B, 0x42, 0x04, 0x01, 0x32, 0x02, 0x06, 0x03, 0x14, 0x10, 0x81, 0x03, 0x60, 0x81,
+	0x02, 0xA0, 0x04, 0x02, 0x53, 0x05, 0x02, 0x43, 0x10, 0x05, 0x02, 0x42, 0x20, 0x05, 0x02, 0x32,
+	0x30, 0x05, 0x02, 0x22, 0x40, 0x05, 0x02, 0x12, 0x50, 0x83, 0x01, 0x05, 0x50, 0x05, 0x02, 0x12,
+	0x50, 0x05, 0x02, 0x22, 0x40, 0x05, 0x02, 0x23, 0x30, 0x05, 0x02, 0x33, 0x20, 0x05, 0x02, 0x42,
+	0x20, 0x05, 0x02, 0x52, 0x10, 0x04, 0x02, 0x53, 0x81, 0x03, 0xA0, 0x81, 0x02, 0x80, 0x83, 0x0C,
+	0x02, 0x60, 0x82, 0x01, 0x08, 0x81, 0x03, 0x80, 0x83, 0x02, 0xF0, 0x10, 0x04, 0x03, 0xA3, 0x84,
+	0x01, 0x04, 0x84, 0x88, 0x01, 0x02, 0x12, 0x62, 0x12, 0x08, 0x02, 0x12, 0x61, 0x22, 0x88, 0x01,
+	0x02, 0x22, 0x42, 0x22, 0x88, 0x02, 0x02, 0x32, 0x22, 0x32, 0x86, 0x01, 0x02, 0x44, 0x42, 0x86,
+	0x01, 0x02, 0x52, 0x52, 0x83, 0x03, 0xF0, 0x10, 0x81, 0x02, 0xB0, 0x04, 0x03, 0x62, 0x84, 0x01,
+	0x04, 0x52, 0x86, 0x01, 0x02, 0x12, 0x42, 0x86, 0x01, 0x02, 0x22, 0x32, 0x86, 0x01, 0x02, 0x32,
+	0x22, 0x86, 0x01, 0x02, 0x42, 0x12, 0x84, 0x01, 0x02, 0x54, 0x84, 0x01, 0x02, 0x63, 0x81, 0x03,
+	0xB0, 0x81, 0x02, 0xE0, 0x03, 0x46, 0x40, 0x03, 0x2A, 0x20, 0x05, 0x14, 0x53, 0x10, 0x05, 0x12,
+	0x82, 0x10, 0x04, 0x03, 0x83, 0x84, 0x04, 0x02, 0xA2, 0x04, 0x03, 0x83, 0x05, 0x12, 0x82, 0x10,
+	0x05, 0x13, 0x54, 0x10, 0x03, 0x2A, 0x20, 0x03, 0x46, 0x40, 0x81, 0x03, 0xE0, 0x81, 0x02, 0x90,
+	0x03, 0x07, 0x20, 0x03, 0x08, 0x10, 0x04, 0x02, 0x43, 0x84, 0x02, 0x02, 0x52, 0x04, 0x02, 0x43,
+	0x03, 0x08, 0x10, 0x03, 0x06, 0x30, 0x83, 0x05, 0x02, 0x70, 0x81, 0x03, 0x90, 0x83, 0x02, 0xF0,
+	0x10, 0x03, 0x46, 0x60, 0x03, 0x2A, 0x40, 0x05, 0x14, 0x53, 0x30, 0x05, 0x12, 0x82, 0x30, 0x05,
+	0x03, 0x83, 0x20, 0x85, 0x04, 0x02, 0xA2, 0x20, 0x05, 0x03, 0x83, 0x20, 0x05, 0x12, 0x82, 0x30,
+	0x05, 0x13, 0x54, 0x30, 0x03, 0x2B, 0x30, 0x05, 0x46, 0x13, 0x20, 0x02, 0xC4, 0x02, 0xE2, 0x83,
+	0x01, 0xF0, 0x10, 0x81, 0x02, 0xA0, 0x03, 0x07, 0x30, 0x03, 0x08, 0x20, 0x05, 0x02, 0x43, 0x10,
+	0x85, 0x02, 0x02, 0x52, 0x10, 0x05, 0x02, 0x42, 0x20, 0x03, 0x08, 0x20, 0x03, 0x07, 0x30, 0x05,
+	0x02, 0x33, 0x20, 0x05, 0x02, 0x42, 0x20, 0x05, 0x02, 0x43, 0x10, 0x05, 0x02, 0x52, 0x10, 0x04,
+	0x02, 0x53, 0x04, 0x02, 0x62, 0x81, 0x03, 0xA0, 0x81, 0x02, 0x90, 0x03, 0x25, 0x20, 0x03, 0x17,
+	0x10, 0x05, 0x03, 0x41, 0x10, 0x83, 0x01, 0x02, 0x70, 0x03, 0x03, 0x60, 0x03, 0x14, 0x40, 0x03,
+	0x34, 0x20, 0x03, 0x53, 0x10, 0x02, 0x63, 0x82, 0x01, 0x72, 0x04, 0x02, 0x43, 0x03, 0x08, 0x10,
+	0x03, 0x16, 0x20, 0x81, 0x03, 0x90, 0x81, 0x02, 0xC0, 0x82, 0x01, 0x0C, 0x83, 0x0C, 0x52, 0x50,
+	0x81, 0x03, 0xC0, 0x81, 0x02, 0xB0, 0x84, 0x0A, 0x02, 0x72, 0x04, 0x03, 0x53, 0x05, 0x13, 0x33,
+	0x10, 0x03, 0x19, 0x10, 0x03, 0x35, 0x30, 0x81, 0x03, 0xB0, 0x81, 0x02, 0xC0, 0x84, 0x02, 0x02,
+	0x82, 0x85, 0x01, 0x12, 0x62, 0x10, 0x05, 0x12, 0x52, 0x20, 0x85, 0x01, 0x22, 0x42, 0x20, 0x05,
+	0x22, 0x32, 0x30, 0x85, 0x01, 0x32, 0x22, 0x30, 0x03, 0x35, 0x40, 0x83, 0x01, 0x44, 0x40, 0x03,
+	0x52, 0x50, 0x81, 0x03, 0xC0, 0x83, 0x02, 0xF0, 0x50, 0x06, 0x02, 0x63, 0x72, 0x87, 0x01, 0x02,
+	0x63, 0x62, 0x10, 0x09, 0x12, 0x51, 0x12, 0x52, 0x10, 0x09, 0x12, 0x42, 0x12, 0x51, 0x20, 0x09,
+	0x12, 0x42, 0x12, 0x42, 0x20, 0x09, 0x13, 0x32, 0x12, 0x42, 0x20, 0x09, 0x22, 0x31, 0x32, 0x32,
+	0x20, 0x89, 0x01, 0x22, 0x22, 0x32, 0x22, 0x30, 0x09, 0x32, 0x12, 0x42, 0x12, 0x30, 0x09, 0x32,
+	0x11, 0x52, 0x11, 0x40, 0x05, 0x34, 0x54, 0x40, 0x05, 0x43, 0x54, 0x40, 0x05, 0x43, 0x63, 0x40,
+	0x83, 0x03, 0xF0, 0x50, 0x81, 0x02, 0xB0, 0x04, 0x02, 0x63, 0x05, 0x03, 0x52, 0x10, 0x05, 0x12,
+	0x42, 0x20, 0x05, 0x22, 0x32, 0x20, 0x05, 0x22, 0x22, 0x30, 0x05, 0x32, 0x12, 0x30, 0x03, 0x34,
+	0x40, 0x03, 0x43, 0x40, 0x03, 0x34, 0x40, 0x05, 0x32, 0x12, 0x30, 0x05, 0x22, 0x22, 0x30, 0x05,
+	0x13, 0x32, 0x20, 0x05, 0x12, 0x43, 0x10, 0x05, 0x02, 0x62, 0x10, 0x04, 0x02, 0x63, 0x81, 0x03,
+	0xB0, 0x81, 0x02, 0xA0, 0x84, 0x01, 0x02, 0x62, 0x85, 0x01, 0x12, 0x42, 0x10, 0x85, 0x01, 0x22,
+	0x22, 0x20, 0x83, 0x01, 0x34, 0x30, 0x83, 0x06, 0x42, 0x40, 0x81, 0x03, 0xA0, 0x81, 0x02, 0xA0,
+	0x83, 0x01, 0x09, 0x10, 0x03, 0x72, 0x10, 0x03, 0x62, 0x20, 0x03, 0x53, 0x20, 0x03, 0x52, 0x30,
+	0x03, 0x42, 0x40, 0x03, 0x33, 0x40, 0x03, 0x32, 0x50, 0x03, 0x22, 0x60, 0x03, 0x13, 0x60, 0x03,
+	0x12, 0x70, 0x03, 0x02, 0x80, 0x82, 0x01, 0x0A, 0x81, 0x03, 0xA0, 0x81, 0x01, 0x40, 0x82, 0x01,
+	0x04, 0x83, 0x0F, 0x02, 0x20, 0x82, 0x01, 0x04, 0x01, 0x90, 0x03, 0x02, 0x70, 0x83, 0x02, 0x12,
+	0x60, 0x83, 0x02, 0x22, 0x50, 0x83, 0x01, 0x32, 0x40, 0x03, 0x41, 0x40, 0x83, 0x01, 0x42, 0x30,
+	0x83, 0x02, 0x52, 0x20, 0x83, 0x02, 0x62, 0x10, 0x82, 0x01, 0x72, 0x01, 0x90, 0x81, 0x01, 0x40,
+	0x82, 0x01, 0x04, 0x82, 0x0F, 0x22, 0x82, 0x01, 0x04, 0x81, 0x02, 0xA0, 0x03, 0x42, 0x40, 0x83,
+	0x01, 0x34, 0x30, 0x05, 0x22, 0x21, 0x30, 0x05, 0x22, 0x22, 0x20, 0x05, 0x21, 0x32, 0x20, 0x85,
+	0x01, 0x12, 0x42, 0x10, 0x04, 0x02, 0x62, 0x81, 0x09, 0xA0, 0x81, 0x13, 0xC0, 0x82, 0x01, 0x0C,
+	0x01, 0x40, 0x03, 0x02, 0x20, 0x83, 0x01, 0x12, 0x10, 0x02, 0x22, 0x81, 0x10, 0x40, 0x81, 0x06,
+	0x90, 0x03, 0x25, 0x20, 0x03, 0x17, 0x10, 0x04, 0x11, 0x52, 0x02, 0x72, 0x02, 0x27, 0x02, 0x18,
+	0x04, 0x03, 0x42, 0x04, 0x02, 0x52, 0x04, 0x02, 0x43, 0x02, 0x18, 0x04, 0x24, 0x12, 0x81, 0x03,
+	0x90, 0x81, 0x01, 0xA0, 0x83, 0x04, 0x02, 0x80, 0x05, 0x02, 0x24, 0x20, 0x03, 0x09, 0x10, 0x05,
+	0x03, 0x42, 0x10, 0x84, 0x04, 0x02, 0x62, 0x05, 0x03, 0x42, 0x10, 0x03, 0x09, 0x10, 0x05, 0x02,
+	0x15, 0x20, 0x81, 0x03, 0xA0, 0x81, 0x06, 0x80, 0x03, 0x25, 0x10, 0x02, 0x17, 0x04, 0x12, 0x41,
+	0x83, 0x04, 0x02, 0x60, 0x04, 0x12, 0x41, 0x02, 0x17, 0x03, 0x25, 0x10, 0x81, 0x03, 0x80, 0x81,
+	0x01, 0xA0, 0x82, 0x04, 0x82, 0x04, 0x25, 0x12, 0x02, 0x19, 0x04, 0x12, 0x43, 0x84, 0x04, 0x02,
+	0x62, 0x04, 0x12, 0x43, 0x02, 0x19, 0x04, 0x24, 0x22, 0x81, 0x03, 0xA0, 0x81, 0x06, 0xA0, 0x03,
+	0x35, 0x20, 0x03, 0x18, 0x10, 0x04, 0x12, 0x43, 0x04, 0x02, 0x62, 0x82, 0x01, 0x0A, 0x83, 0x01,
+	0x02, 0x80, 0x04, 0x12, 0x52, 0x02, 0x19, 0x03, 0x36, 0x10, 0x81, 0x03, 0xA0, 0x81, 0x01, 0x70,
+	0x02, 0x34, 0x02, 0x25, 0x83, 0x02, 0x22, 0x30, 0x82, 0x01, 0x07, 0x83, 0x08, 0x22, 0x30, 0x81,
+	0x03, 0x70, 0x81, 0x06, 0xA0, 0x02, 0x37, 0x02, 0x28, 0x05, 0x13, 0x23, 0x10, 0x85, 0x01, 0x12,
+	0x42, 0x10, 0x05, 0x13, 0x23, 0x10, 0x03, 0x26, 0x20, 0x03, 0x07, 0x30, 0x03, 0x02, 0x80, 0x03,
+	0x17, 0x20, 0x02, 0x19, 0x84, 0x01, 0x02, 0x62, 0x03, 0x09, 0x10, 0x03, 0x26, 0x20, 0x81, 0x01,
+	0x90, 0x83, 0x04, 0x02, 0x70, 0x05, 0x02, 0x14, 0x20, 0x03, 0x08, 0x10, 0x04, 0x03, 0x33, 0x84,
+	0x07, 0x02, 0x52, 0x81, 0x03, 0x90, 0x81, 0x02, 0x20, 0x82, 0x01, 0x02, 0x81, 0x01, 0x20, 0x82,
+	0x0A, 0x02, 0x81, 0x03, 0x20, 0x81, 0x02, 0x50, 0x82, 0x01, 0x32, 0x81, 0x01, 0x50, 0x82, 0x0C,
+	0x32, 0x02, 0x05, 0x03, 0x04, 0x10, 0x81, 0x01, 0x90, 0x83, 0x04, 0x02, 0x70, 0x04, 0x02, 0x43,
+	0x05, 0x02, 0x33, 0x10, 0x05, 0x02, 0x23, 0x20, 0x05, 0x02, 0x12, 0x40, 0x03, 0x04, 0x50, 0x03,
+	0x05, 0x40, 0x05, 0x02, 0x13, 0x30, 0x05, 0x02, 0x22, 0x30, 0x05, 0x02, 0x32, 0x20, 0x05, 0x02,
+	0x42, 0x10, 0x04, 0x02, 0x52, 0x81, 0x03, 0x90, 0x81, 0x01, 0x20, 0x82, 0x0F, 0x02, 0x81, 0x03,
+	0x20, 0x83, 0x06, 0xF0, 0x10, 0x07, 0x02, 0x14, 0x34, 0x20, 0x05, 0x08, 0x16, 0x10, 0x06, 0x03,
+	0x34, 0x33, 0x86, 0x07, 0x02, 0x52, 0x52, 0x83, 0x03, 0xF0, 0x10, 0x81, 0x06, 0x90, 0x05, 0x02,
+	0x14, 0x20, 0x03, 0x08, 0x10, 0x04, 0x03, 0x33, 0x84, 0x07, 0x02, 0x52, 0x81, 0x03, 0x90, 0x81,
+	0x06, 0xB0, 0x03, 0x35, 0x30, 0x03, 0x19, 0x10, 0x05, 0x12, 0x52, 0x10, 0x84, 0x04, 0x02, 0x72,
+	0x05, 0x12, 0x52, 0x10, 0x03, 0x19, 0x10, 0x03, 0x35, 0x30, 0x81, 0x03, 0xB0, 0x81, 0x06, 0xA0,
+	0x05, 0x02, 0x24, 0x20, 0x03, 0x09, 0x10, 0x04, 0x03, 0x43, 0x84, 0x04, 0x02, 0x62, 0x05, 0x03,
+	0x42, 0x10, 0x03, 0x09, 0x10, 0x05, 0x02, 0x15, 0x20, 0x83, 0x03, 0x02, 0x80, 0x81, 0x06, 0xA0,
+	0x04, 0x25, 0x12, 0x02, 0x19, 0x04, 0x12, 0x43, 0x84, 0x04, 0x02, 0x62, 0x04, 0x12, 0x43, 0x02,
+	0x19, 0x04, 0x24, 0x22, 0x82, 0x03, 0x82, 0x81, 0x06, 0x60, 0x04, 0x02, 0x13, 0x02, 0x06, 0x03,
+	0x03, 0x30, 0x83, 0x07, 0x02, 0x40, 0x81, 0x03, 0x60, 0x81, 0x06, 0x70, 0x03, 0x24, 0x10, 0x02,
+	0x07, 0x04, 0x02, 0x41, 0x03, 0x02, 0x50, 0x03, 0x04, 0x30, 0x03, 0x24, 0x10, 0x02, 0x43, 0x02,
+	0x52, 0x04, 0x01, 0x42, 0x02, 0x07, 0x03, 0x14, 0x20, 0x81, 0x03, 0x70, 0x81, 0x03, 0x70, 0x83,
+	0x02, 0x22, 0x30, 0x82, 0x01, 0x07, 0x83, 0x06, 0x22, 0x30, 0x02, 0x25, 0x02, 0x34, 0x81, 0x03,
+	0x70, 0x81, 0x06, 0x90, 0x84, 0x07, 0x02, 0x52, 0x04, 0x03, 0x33, 0x02, 0x18, 0x04, 0x24, 0x12,
+	0x81, 0x03, 0x90, 0x81, 0x06, 0xA0, 0x84, 0x01, 0x02, 0x62, 0x85, 0x01, 0x12, 0x42, 0x10, 0x05,
+	0x12, 0x41, 0x20, 0x85, 0x01, 0x22, 0x22, 0x20, 0x05, 0x22, 0x12, 0x30, 0x83, 0x01, 0x34, 0x30,
+	0x03, 0x42, 0x40, 0x81, 0x03, 0xA0, 0x83, 0x06, 0xF0, 0x10, 0x86, 0x01, 0x02, 0x52, 0x52, 0x87,
+	0x02, 0x12, 0x34, 0x32, 0x10, 0x09, 0x22, 0x21, 0x22, 0x21, 0x20, 0x89, 0x01, 0x22, 0x12, 0x22,
+	0x12, 0x20, 0x07, 0x33, 0x41, 0x11, 0x30, 0x85, 0x01, 0x33, 0x43, 0x30, 0x83, 0x03, 0xF0, 0x10,
+	0x81, 0x06, 0xA0, 0x04, 0x12, 0x43, 0x05, 0x13, 0x32, 0x10, 0x05, 0x22, 0x22, 0x20, 0x05, 0x32,
+	0x12, 0x20, 0x03, 0x34, 0x30, 0x03, 0x43, 0x30, 0x03, 0x34, 0x30, 0x85, 0x01, 0x22, 0x22, 0x20,
+	0x05, 0x12, 0x42, 0x10, 0x04, 0x03, 0x43, 0x81, 0x03, 0xA0, 0x81, 0x06, 0xA0, 0x04, 0x03, 0x52,
+	0x84, 0x01, 0x12, 0x52, 0x85, 0x02, 0x22, 0x32, 0x10, 0x85, 0x02, 0x32, 0x12, 0x20, 0x83, 0x01,
+	0x43, 0x30, 0x83, 0x02, 0x42, 0x40, 0x03, 0x32, 0x50, 0x81, 0x06, 0x70, 0x82, 0x01, 0x07, 0x83,
+	0x01, 0x42, 0x10, 0x03, 0x32, 0x20, 0x83, 0x01, 0x22, 0x30, 0x03, 0x12, 0x40, 0x03, 0x02, 0x50,
+	0x82, 0x01, 0x07, 0x81, 0x03, 0x70, 0x01, 0x60, 0x02, 0x33, 0x02, 0x24, 0x83, 0x05, 0x22, 0x20,
+	0x03, 0x13, 0x20, 0x83, 0x01, 0x03, 0x30, 0x03, 0x13, 0x20, 0x83, 0x06, 0x22, 0x20, 0x02, 0x24,
+	0x02, 0x33, 0x01, 0x10, 0x82, 0x14, 0x01, 0x01, 0x60, 0x03, 0x03, 0x30, 0x03, 0x04, 0x20, 0x83,
+	0x05, 0x22, 0x20, 0x03, 0x32, 0x10, 0x82, 0x01, 0x33, 0x03, 0x32, 0x10, 0x83, 0x06, 0x22, 0x20,
+	0x03, 0x04, 0x20, 0x03, 0x03, 0x30, 0x81, 0x03, 0xB0, 0x04, 0x14, 0x42, 0x04, 0x15, 0x32, 0x06,
+	0x02, 0x31, 0x32, 0x05, 0x02, 0x35, 0x10, 0x05, 0x02, 0x43, 0x20, 0x81, 0x0C, 0xB0,
+};
+
+char_info_t font22_rle_info[] = {
+	{2, 0}, 		/*   */ 
+	{3, 3}, 		/* ! */ 
+	{6, 23}, 		/* " */ 
+	{11, 37}, 		/* # */ 
+	{10, 76}, 		/* $ */ 
+	{16, 135}, 		/* % */ 
+	{14, 215}, 		/* & */ 
+	{2, 275}, 		/* ' */ 
+	{4, 288}, 		/* ( */ 
+	{4, 314}, 		/* ) */ 
+	{8, 341}, 		/* * */ 
+	{10, 373}, 		/* + */ 
+	{3, 390}, 		/* , */ 
+	{6, 407}, 		/* - */ 
+	{3, 416}, 		/* . */ 
+	{9, 430}, 		/* / */ 
+	{10, 471}, 		/* 0 */ 
+	{9, 508}, 		/* 1 */ 
+	{10, 535}, 		/* 2 */ 
+	{10, 577}, 		/* 3 */ 
+	{11, 621}, 		/* 4 */ 
+	{10, 666}, 		/* 5 */ 
+	{10, 701}, 		/* 6 */ 
+	{10, 747}, 		/* 7 */ 
+	{10, 788}, 		/* 8 */ 
+	{10, 839}, 		/* 9 */ 
+	{3, 883}, 		/* : */ 
+	{5, 898}, 		/* ; */ 
+	{10, 922}, 		/* < */ 
+	{10, 957}, 		/* = */ 
+	{10, 972}, 		/* > */ 
+	{9, 1008}, 		/* ? */ 
+	{17, 1042}, 		/* @ */ 
+	{13, 1118}, 		/* A */ 
+	{10, 1164}, 		/* B */ 
+	{11, 1211}, 		/* C */ 
+	{12, 1249}, 		/* D */ 
+	{8, 1293}, 		/* E */ 
+	{8, 1317}, 		/* F */ 
+	{12, 1337}, 		/* G */ 
+	{11, 1380}, 		/* H */ 
+	{2, 1397}, 		/* I */ 
+	{6, 1406}, 		/* J */ 
+	{10, 1423}, 		/* K */ 
+	{8, 1483}, 		/* L */ 
+	{16, 1496}, 		/* M */ 
+	{11, 1544}, 		/* N */ 
+	{14, 1585}, 		/* O */ 
+	{9, 1629}, 		/* P */ 
+	{16, 1661}, 		/* Q */ 
+	{10, 1715}, 		/* R */ 
+	{9, 1768}, 		/* S */ 
+	{12, 1814}, 		/* T */ 
+	{11, 1827}, 		/* U */ 
+	{12, 1850}, 		/* V */ 
+	{20, 1893}, 		/* W */ 
+	{11, 1972}, 		/* X */ 
+	{10, 2033}, 		/* Y */ 
+	{10, 2061}, 		/* Z */ 
+	{4, 2107}, 		/* [ */ 
+	{9, 2120}, 		/* \ */ 
+	{4, 2157}, 		/* ] */ 
+	{10, 2169}, 		/* ^ */ 
+	{12, 2202}, 		/* _ */ 
+	{4, 2208}, 		/* ` */ 
+	{9, 2222}, 		/* a */ 
+	{10, 2257}, 		/* b */ 
+	{8, 2293}, 		/* c */ 
+	{10, 2319}, 		/* d */ 
+	{10, 2348}, 		/* e */ 
+	{7, 2381}, 		/* f */ 
+	{10, 2402}, 		/* g */ 
+	{9, 2446}, 		/* h */ 
+	{2, 2470}, 		/* i */ 
+	{5, 2485}, 		/* j */ 
+	{9, 2502}, 		/* k */ 
+	{2, 2552}, 		/* l */ 
+	{16, 2561}, 		/* m */ 
+	{9, 2587}, 		/* n */ 
+	{11, 2607}, 		/* o */ 
+	{10, 2637}, 		/* p */ 
+	{10, 2669}, 		/* q */ 
+	{6, 2695}, 		/* r */ 
+	{7, 2713}, 		/* s */ 
+	{7, 2748}, 		/* t */ 
+	{9, 2769}, 		/* u */ 
+	{10, 2787}, 		/* v */ 
+	{16, 2822}, 		/* w */ 
+	{10, 2864}, 		/* x */ 
+	{10, 2906}, 		/* y */ 
+	{7, 2937}, 		/* z */ 
+	{6, 2966}, 		/* { */ 
+	{1, 2994}, 		/* | */ 
+	{6, 2999}, 		/* } */ 
+	{11, 3030}, 		/* ~ */ 
+};
+
+/**
+ * @brief 30 pixels height run-length compressed data array.
+ */
+const uint8_t font30_rle_data[] = {
+	0x81, 0x1D, 0x20, 0x81, 0x01, 0x30, 0x82, 0x07, 0x03, 0x82, 0x07, 0x12, 0x81, 0x01, 0x30, 0x82,
+	0x03, 0x03, 0x81, 0x05, 0x30, 0x81, 0x01, 0x80, 0x84, 0x06, 0x03, 0x32, 0x04, 0x12, 0x32, 0x81,
+	0x13, 0x80, 0x81, 0x03, 0xE0, 0x85, 0x01, 0x42, 0x43, 0x10, 0x85, 0x01, 0x33, 0x42, 0x20, 0x05,
+	0x32, 0x52, 0x20, 0x82, 0x01, 0x0E, 0x85, 0x01, 0x32, 0x43, 0x20, 0x05, 0x32, 0x42, 0x30, 0x85,
+	0x01, 0x23, 0x42, 0x30, 0x83, 0x01, 0x0D, 0x10, 0x05, 0x22, 0x52, 0x30, 0x85, 0x01, 0x22, 0x43,
+	0x30, 0x05, 0x22, 0x42, 0x40, 0x85, 0x01, 0x13, 0x42, 0x40, 0x81, 0x05, 0xE0, 0x83, 0x03, 0x72,
+	0x40, 0x03, 0x47, 0x20, 0x03, 0x2A, 0x10, 0x05, 0x23, 0x52, 0x10, 0x83, 0x03, 0x13, 0x90, 0x03,
+	0x14, 0x80, 0x03, 0x25, 0x60, 0x03, 0x37, 0x30, 0x03, 0x57, 0x10, 0x02, 0x85, 0x82, 0x01, 0xA3,
+	0x82, 0x01, 0xB2, 0x02, 0xA3, 0x05, 0x02, 0x73, 0x10, 0x03, 0x0B, 0x20, 0x03, 0x27, 0x40, 0x03,
+	0x43, 0x60, 0x83, 0x02, 0x42, 0x70, 0x81, 0x01, 0xD0, 0x83, 0x02, 0xF0, 0x60, 0x05, 0xF0, 0x22,
+	0x20, 0x05, 0x25, 0x92, 0x30, 0x05, 0x17, 0x73, 0x30, 0x07, 0x03, 0x33, 0x53, 0x40, 0x07, 0x02,
+	0x52, 0x52, 0x50, 0x07, 0x02, 0x52, 0x43, 0x50, 0x07, 0x02, 0x52, 0x33, 0x60, 0x07, 0x02, 0x52,
+	0x32, 0x70, 0x07, 0x03, 0x33, 0x22, 0x80, 0x05, 0x17, 0x23, 0x80, 0x05, 0x25, 0x32, 0x90, 0x05,
+	0x92, 0x35, 0x20, 0x05, 0x83, 0x27, 0x10, 0x06, 0x82, 0x23, 0x33, 0x06, 0x72, 0x32, 0x52, 0x06,
+	0x63, 0x32, 0x52, 0x06, 0x53, 0x42, 0x52, 0x06, 0x52, 0x52, 0x52, 0x06, 0x42, 0x63, 0x33, 0x05,
+	0x33, 0x77, 0x10, 0x05, 0x32, 0x95, 0x20, 0x05, 0x22, 0xF0, 0x20, 0x83, 0x04, 0xF0, 0x60, 0x83,
+	0x01, 0xF0, 0x30, 0x03, 0x56, 0x70, 0x03, 0x39, 0x60, 0x05, 0x23, 0x44, 0x50, 0x05, 0x23, 0x53,
+	0x50, 0x85, 0x01, 0x22, 0x63, 0x50, 0x05, 0x23, 0x43, 0x60, 0x05, 0x23, 0x34, 0x60, 0x05, 0x33,
+	0x14, 0x70, 0x03, 0x36, 0x90, 0x05, 0x35, 0x63, 0x10, 0x05, 0x26, 0x63, 0x10, 0x07, 0x13, 0x23,
+	0x53, 0x10, 0x07, 0x03, 0x43, 0x42, 0x20, 0x07, 0x03, 0x53, 0x32, 0x20, 0x07, 0x03, 0x63, 0x13,
+	0x20, 0x05, 0x03, 0x75, 0x30, 0x05, 0x03, 0x84, 0x30, 0x05, 0x03, 0x85, 0x20, 0x05, 0x13, 0x58,
+	0x10, 0x04, 0x2A, 0x24, 0x04, 0x37, 0x62, 0x83, 0x05, 0xF0, 0x30, 0x81, 0x01, 0x30, 0x82, 0x06,
+	0x03, 0x02, 0x12, 0x81, 0x13, 0x30, 0x81, 0x01, 0x60, 0x02, 0x33, 0x03, 0x32, 0x10, 0x03, 0x23,
+	0x10, 0x83, 0x01, 0x22, 0x20, 0x83, 0x01, 0x13, 0x20, 0x83, 0x01, 0x12, 0x30, 0x83, 0x09, 0x03,
+	0x30, 0x83, 0x01, 0x12, 0x30, 0x83, 0x01, 0x13, 0x20, 0x03, 0x22, 0x20, 0x83, 0x01, 0x23, 0x10,
+	0x03, 0x32, 0x10, 0x02, 0x33, 0x81, 0x01, 0x60, 0x03, 0x03, 0x30, 0x03, 0x12, 0x30, 0x03, 0x13,
+	0x20, 0x83, 0x01, 0x22, 0x20, 0x83, 0x01, 0x23, 0x10, 0x83, 0x01, 0x32, 0x10, 0x82, 0x09, 0x33,
+	0x83, 0x01, 0x32, 0x10, 0x83, 0x01, 0x23, 0x10, 0x03, 0x22, 0x20, 0x83, 0x01, 0x13, 0x20, 0x03,
+	0x12, 0x30, 0x03, 0x03, 0x30, 0x81, 0x01, 0xA0, 0x83, 0x01, 0x42, 0x40, 0x06, 0x01, 0x32, 0x31,
+	0x06, 0x03, 0x12, 0x13, 0x02, 0x0A, 0x83, 0x01, 0x25, 0x30, 0x02, 0x0A, 0x06, 0x03, 0x12, 0x13,
+	0x06, 0x01, 0x32, 0x31, 0x83, 0x01, 0x42, 0x40, 0x81, 0x0F, 0xA0, 0x81, 0x07, 0xE0, 0x83, 0x05,
+	0x62, 0x60, 0x82, 0x01, 0x0E, 0x83, 0x05, 0x62, 0x60, 0x81, 0x07, 0xE0, 0x81, 0x13, 0x50, 0x82,
+	0x02, 0x23, 0x03, 0x22, 0x10, 0x03, 0x13, 0x10, 0x03, 0x12, 0x20, 0x83, 0x01, 0x02, 0x30, 0x81,
+	0x01, 0x50, 0x81, 0x0E, 0x80, 0x82, 0x01, 0x08, 0x81, 0x0C, 0x80, 0x81, 0x13, 0x30, 0x82, 0x03,
+	0x03, 0x81, 0x05, 0x30, 0x01, 0xC0, 0x02, 0xA2, 0x02, 0x93, 0x03, 0x92, 0x10, 0x83, 0x01, 0x83,
+	0x10, 0x03, 0x82, 0x20, 0x83, 0x01, 0x73, 0x20, 0x03, 0x72, 0x30, 0x03, 0x63, 0x30, 0x83, 0x01,
+	0x62, 0x40, 0x03, 0x53, 0x40, 0x03, 0x52, 0x50, 0x83, 0x01, 0x43, 0x50, 0x03, 0x42, 0x60, 0x83,
+	0x01, 0x33, 0x60, 0x03, 0x32, 0x70, 0x03, 0x23, 0x70, 0x03, 0x22, 0x80, 0x83, 0x01, 0x13, 0x80,
+	0x03, 0x12, 0x90, 0x83, 0x01, 0x03, 0x90, 0x81, 0x01, 0xC0, 0x81, 0x03, 0xE0, 0x03, 0x46, 0x40,
+	0x03, 0x39, 0x20, 0x05, 0x23, 0x43, 0x20, 0x85, 0x01, 0x13, 0x63, 0x10, 0x84, 0x09, 0x03, 0x83,
+	0x85, 0x01, 0x13, 0x63, 0x10, 0x05, 0x23, 0x43, 0x20, 0x03, 0x29, 0x30, 0x03, 0x46, 0x40, 0x81,
+	0x05, 0xE0, 0x81, 0x03, 0xC0, 0x03, 0x53, 0x40, 0x03, 0x35, 0x40, 0x03, 0x17, 0x40, 0x05, 0x04,
+	0x13, 0x40, 0x05, 0x02, 0x33, 0x40, 0x83, 0x0C, 0x53, 0x40, 0x82, 0x01, 0x0C, 0x81, 0x05, 0xC0,
+	0x81, 0x03, 0xD0, 0x03, 0x36, 0x40, 0x03, 0x19, 0x30, 0x05, 0x03, 0x44, 0x20, 0x05, 0x01, 0x74,
+	0x10, 0x83, 0x03, 0x93, 0x10, 0x83, 0x01, 0x83, 0x20, 0x03, 0x73, 0x30, 0x03, 0x63, 0x40, 0x03,
+	0x54, 0x40, 0x03, 0x53, 0x50, 0x03, 0x43, 0x60, 0x03, 0x33, 0x70, 0x03, 0x23, 0x80, 0x03, 0x13,
+	0x90, 0x82, 0x01, 0x0D, 0x81, 0x05, 0xD0, 0x81, 0x03, 0xD0, 0x03, 0x36, 0x40, 0x03, 0x29, 0x20,
+	0x05, 0x13, 0x43, 0x20, 0x05, 0x11, 0x73, 0x10, 0x83, 0x02, 0x93, 0x10, 0x03, 0x83, 0x20, 0x03,
+	0x74, 0x20, 0x03, 0x27, 0x40, 0x03, 0x29, 0x20, 0x03, 0x84, 0x10, 0x02, 0x94, 0x82, 0x02, 0xA3,
+	0x04, 0x01, 0x84, 0x05, 0x03, 0x54, 0x10, 0x03, 0x0B, 0x20, 0x03, 0x27, 0x40, 0x81, 0x05, 0xD0,
+	0x81, 0x03, 0xF0, 0x03, 0x84, 0x30, 0x03, 0x75, 0x30, 0x03, 0x66, 0x30, 0x05, 0x62, 0x13, 0x30,
+	0x05, 0x53, 0x13, 0x30, 0x05, 0x52, 0x23, 0x30, 0x05, 0x42, 0x33, 0x30, 0x05, 0x33, 0x33, 0x30,
+	0x05, 0x32, 0x43, 0x30, 0x05, 0x23, 0x43, 0x30, 0x05, 0x13, 0x53, 0x30, 0x05, 0x12, 0x63, 0x30,
+	0x05, 0x03, 0x63, 0x30, 0x82, 0x01, 0x0F, 0x83, 0x04, 0x93, 0x30, 0x81, 0x05, 0xF0, 0x81, 0x03,
+	0xD0, 0x83, 0x01, 0x1B, 0x10, 0x83, 0x05, 0x13, 0x90, 0x03, 0x19, 0x30, 0x03, 0x1A, 0x20, 0x03,
+	0x84, 0x10, 0x02, 0x94, 0x82, 0x03, 0xA3, 0x03, 0x93, 0x10, 0x05, 0x02, 0x64, 0x10, 0x03, 0x0B,
+	0x20, 0x03, 0x27, 0x40, 0x81, 0x05, 0xD0, 0x81, 0x03, 0xD0, 0x03, 0x56, 0x20, 0x03, 0x39, 0x10,
+	0x05, 0x24, 0x51, 0x10, 0x03, 0x23, 0x80, 0x83, 0x01, 0x13, 0x90, 0x83, 0x01, 0x03, 0xA0, 0x05,
+	0x03, 0x25, 0x30, 0x03, 0x0C, 0x10, 0x05, 0x04, 0x53, 0x10, 0x84, 0x04, 0x03, 0x73, 0x05, 0x13,
+	0x53, 0x10, 0x05, 0x14, 0x34, 0x10, 0x03, 0x29, 0x20, 0x03, 0x45, 0x40, 0x81, 0x05, 0xD0, 0x81,
+	0x03, 0xD0, 0x82, 0x01, 0x0D, 0x02, 0xA3, 0x83, 0x01, 0x93, 0x10, 0x03, 0x92, 0x20, 0x83, 0x01,
+	0x83, 0x20, 0x83, 0x01, 0x73, 0x30, 0x83, 0x01, 0x63, 0x40, 0x03, 0x62, 0x50, 0x83, 0x01, 0x53,
+	0x50, 0x83, 0x01, 0x43, 0x60, 0x83, 0x01, 0x33, 0x70, 0x03, 0x32, 0x80, 0x81, 0x05, 0xD0, 0x81,
+	0x03, 0xE0, 0x03, 0x46, 0x40, 0x03, 0x2A, 0x20, 0x05, 0x23, 0x44, 0x10, 0x85, 0x02, 0x13, 0x63,
+	0x10, 0x05, 0x14, 0x53, 0x10, 0x05, 0x24, 0x33, 0x20, 0x03, 0x38, 0x30, 0x03, 0x45, 0x50, 0x03,
+	0x38, 0x30, 0x05, 0x24, 0x24, 0x20, 0x05, 0x13, 0x63, 0x10, 0x84, 0x03, 0x03, 0x83, 0x05, 0x13,
+	0x63, 0x10, 0x03, 0x1B, 0x20, 0x03, 0x37, 0x40, 0x81, 0x05, 0xE0, 0x81, 0x03, 0xD0, 0x03, 0x45,
+	0x40, 0x03, 0x29, 0x20, 0x05, 0x14, 0x34, 0x10, 0x05, 0x13, 0x53, 0x10, 0x05, 0x03, 0x63, 0x10,
+	0x84, 0x03, 0x03, 0x73, 0x04, 0x13, 0x54, 0x02, 0x1C, 0x04, 0x36, 0x13, 0x82, 0x01, 0xA3, 0x83,
+	0x01, 0x93, 0x10, 0x03, 0x83, 0x20, 0x05, 0x11, 0x54, 0x20, 0x03, 0x19, 0x30, 0x03, 0x26, 0x50,
+	0x81, 0x05, 0xD0, 0x81, 0x08, 0x30, 0x82, 0x03, 0x03, 0x81, 0x06, 0x30, 0x82, 0x03, 0x03, 0x81,
+	0x05, 0x30, 0x81, 0x09, 0x50, 0x82, 0x03, 0x23, 0x81, 0x05, 0x50, 0x82, 0x03, 0x23, 0x03, 0x13,
+	0x10, 0x03, 0x12, 0x20, 0x03, 0x03, 0x20, 0x03, 0x02, 0x30, 0x81, 0x01, 0x50, 0x81, 0x06, 0xD0,
+	0x02, 0xC1, 0x02, 0xA3, 0x02, 0x85, 0x03, 0x66, 0x10, 0x03, 0x45, 0x40, 0x03, 0x25, 0x60, 0x03,
+	0x05, 0x80, 0x03, 0x03, 0xA0, 0x03, 0x05, 0x80, 0x03, 0x25, 0x60, 0x03, 0x45, 0x40, 0x03, 0x66,
+	0x10, 0x02, 0x85, 0x02, 0xA3, 0x02, 0xC1, 0x81, 0x07, 0xD0, 0x81, 0x0A, 0xD0, 0x82, 0x01, 0x0D,
+	0x81, 0x03, 0xD0, 0x82, 0x01, 0x0D, 0x81, 0x0A, 0xD0, 0x81, 0x06, 0xD0, 0x03, 0x01, 0xC0, 0x03,
+	0x03, 0xA0, 0x03, 0x05, 0x80, 0x03, 0x16, 0x60, 0x03, 0x45, 0x40, 0x03, 0x65, 0x20, 0x02, 0x85,
+	0x02, 0xA3, 0x02, 0x85, 0x03, 0x65, 0x20, 0x03, 0x36, 0x40, 0x03, 0x16, 0x60, 0x03, 0x05, 0x80,
+	0x03, 0x03, 0xA0, 0x03, 0x01, 0xC0, 0x81, 0x07, 0xD0, 0x81, 0x01, 0xB0, 0x03, 0x26, 0x30, 0x03,
+	0x09, 0x20, 0x05, 0x02, 0x44, 0x10, 0x02, 0x74, 0x82, 0x03, 0x83, 0x02, 0x74, 0x03, 0x64, 0x10,
+	0x03, 0x36, 0x20, 0x03, 0x35, 0x30, 0x83, 0x03, 0x33, 0x50, 0x81, 0x01, 0xB0, 0x83, 0x03, 0x33,
+	0x50, 0x81, 0x05, 0xB0, 0x83, 0x02, 0xF0, 0x80, 0x03, 0x98, 0x60, 0x03, 0x7D, 0x30, 0x05, 0x54,
+	0x75, 0x20, 0x05, 0x43, 0xB4, 0x10, 0x05, 0x33, 0xD3, 0x10, 0x04, 0x23, 0xF3, 0x08, 0x22, 0x54,
+	0x22, 0x33, 0x06, 0x13, 0x48, 0x43, 0x08, 0x12, 0x43, 0x33, 0x52, 0x08, 0x12, 0x42, 0x43, 0x52,
+	0x08, 0x03, 0x33, 0x52, 0x43, 0x08, 0x03, 0x33, 0x43, 0x43, 0x08, 0x03, 0x33, 0x42, 0x53, 0x09,
+	0x02, 0x42, 0x52, 0x52, 0x10, 0x09, 0x02, 0x42, 0x43, 0x43, 0x10, 0x09, 0x02, 0x43, 0x25, 0x23,
+	0x20, 0x07, 0x02, 0x56, 0x16, 0x30, 0x07, 0x03, 0x44, 0x44, 0x40, 0x05, 0x03, 0xF0, 0x50, 0x05,
+	0x12, 0xF0, 0x50, 0x05, 0x13, 0xF0, 0x40, 0x05, 0x23, 0xF0, 0x30, 0x05, 0x34, 0x82, 0x60, 0x03,
+	0x4D, 0x60, 0x03, 0x69, 0x80, 0x83, 0x01, 0xF0, 0x80, 0x83, 0x03, 0xF0, 0x20, 0x03, 0x73, 0x70,
+	0x03, 0x64, 0x70, 0x03, 0x65, 0x60, 0x03, 0x56, 0x60, 0x05, 0x53, 0x12, 0x60, 0x05, 0x52, 0x23,
+	0x50, 0x05, 0x43, 0x23, 0x50, 0x05, 0x43, 0x33, 0x40, 0x05, 0x42, 0x43, 0x40, 0x05, 0x33, 0x43,
+	0x40, 0x05, 0x32, 0x63, 0x30, 0x85, 0x01, 0x23, 0x63, 0x30, 0x03, 0x2D, 0x20, 0x03, 0x1E, 0x20,
+	0x05, 0x13, 0x93, 0x10, 0x05, 0x12, 0xA3, 0x10, 0x05, 0x03, 0xA3, 0x10, 0x04, 0x03, 0xB3, 0x04,
+	0x02, 0xC3, 0x83, 0x05, 0xF0, 0x20, 0x81, 0x03, 0xD0, 0x03, 0x09, 0x40, 0x03, 0x0B, 0x20, 0x05,
+	0x03, 0x53, 0x20, 0x85, 0x04, 0x03, 0x63, 0x10, 0x05, 0x03, 0x53, 0x20, 0x03, 0x0A, 0x30, 0x03,
+	0x0B, 0x20, 0x05, 0x03, 0x54, 0x10, 0x04, 0x03, 0x64, 0x84, 0x03, 0x03, 0x73, 0x05, 0x03, 0x63,
+	0x10, 0x03, 0x0B, 0x20, 0x03, 0x09, 0x40, 0x81, 0x05, 0xD0, 0x81, 0x03, 0xE0, 0x03, 0x65, 0x30,
+	0x03, 0x49, 0x10, 0x04, 0x33, 0x53, 0x04, 0x23, 0x81, 0x83, 0x01, 0x13, 0xA0, 0x83, 0x07, 0x03,
+	0xB0, 0x83, 0x01, 0x13, 0xA0, 0x04, 0x14, 0x81, 0x04, 0x24, 0x53, 0x03, 0x3A, 0x10, 0x03, 0x56,
+	0x30, 0x81, 0x05, 0xE0, 0x83, 0x03, 0xF0, 0x10, 0x03, 0x0A, 0x60, 0x03, 0x0C, 0x40, 0x05, 0x03,
+	0x64, 0x30, 0x05, 0x03, 0x83, 0x20, 0x85, 0x01, 0x03, 0x93, 0x10, 0x84, 0x07, 0x03, 0xA3, 0x85,
+	0x01, 0x03, 0x93, 0x10, 0x05, 0x03, 0x83, 0x20, 0x05, 0x03, 0x64, 0x30, 0x03, 0x0C, 0x40, 0x03,
+	0x0A, 0x60, 0x83, 0x05, 0xF0, 0x10, 0x81, 0x03, 0xB0, 0x82, 0x01, 0x0B, 0x83, 0x06, 0x03, 0x80,
+	0x83, 0x01, 0x0A, 0x10, 0x83, 0x06, 0x03, 0x80, 0x82, 0x01, 0x0B, 0x81, 0x05, 0xB0, 0x81, 0x03,
+	0xB0, 0x82, 0x01, 0x0B, 0x83, 0x06, 0x03, 0x80, 0x82, 0x01, 0x0B, 0x83, 0x08, 0x03, 0x80, 0x81,
+	0x05, 0xB0, 0x83, 0x03, 0xF0, 0x10, 0x03, 0x67, 0x30, 0x03, 0x4B, 0x10, 0x04, 0x34, 0x63, 0x04,
+	0x24, 0x91, 0x03, 0x14, 0xB0, 0x83, 0x01, 0x13, 0xC0, 0x83, 0x01, 0x03, 0xD0, 0x84, 0x01, 0x03,
+	0x58, 0x84, 0x01, 0x03, 0xA3, 0x04, 0x04, 0x93, 0x04, 0x13, 0x93, 0x04, 0x14, 0x83, 0x04, 0x23,
+	0x83, 0x04, 0x34, 0x54, 0x02, 0x4C, 0x03, 0x67, 0x30, 0x83, 0x05, 0xF0, 0x10, 0x81, 0x03, 0xF0,
+	0x84, 0x08, 0x03, 0x93, 0x82, 0x01, 0x0F, 0x84, 0x08, 0x03, 0x93, 0x81, 0x05, 0xF0, 0x81, 0x03,
+	0x30, 0x82, 0x13, 0x03, 0x81, 0x05, 0x30, 0x81, 0x03, 0x80, 0x82, 0x10, 0x53, 0x04, 0x01, 0x34,
+	0x03, 0x07, 0x10, 0x03, 0x15, 0x20, 0x81, 0x05, 0x80, 0x81, 0x03, 0xD0, 0x04, 0x03, 0x73, 0x04,
+	0x03, 0x64, 0x05, 0x03, 0x63, 0x10, 0x05, 0x03, 0x53, 0x20, 0x05, 0x03, 0x43, 0x30, 0x05, 0x03,
+	0x33, 0x40, 0x05, 0x03, 0x23, 0x50, 0x85, 0x01, 0x03, 0x13, 0x60, 0x03, 0x06, 0x70, 0x05, 0x03,
+	0x13, 0x60, 0x05, 0x03, 0x14, 0x50, 0x05, 0x03, 0x23, 0x50, 0x05, 0x03, 0x33, 0x40, 0x05, 0x03,
+	0x43, 0x30, 0x05, 0x03, 0x44, 0x20, 0x05, 0x03, 0x53, 0x20, 0x05, 0x03, 0x63, 0x10, 0x84, 0x01,
+	0x03, 0x73, 0x81, 0x05, 0xD0, 0x81, 0x03, 0xA0, 0x83, 0x11, 0x03, 0x70, 0x82, 0x01, 0x0A, 0x81,
+	0x05, 0xA0, 0x83, 0x03, 0xF0, 0x70, 0x84, 0x01, 0x05, 0xC5, 0x04, 0x06, 0xA6, 0x08, 0x03, 0x12,
+	0xA2, 0x13, 0x08, 0x03, 0x13, 0x92, 0x13, 0x08, 0x03, 0x13, 0x83, 0x13, 0x08, 0x03, 0x22, 0x82,
+	0x23, 0x88, 0x01, 0x03, 0x23, 0x63, 0x23, 0x08, 0x03, 0x32, 0x62, 0x33, 0x08, 0x03, 0x33, 0x43,
+	0x33, 0x08, 0x03, 0x42, 0x42, 0x43, 0x88, 0x01, 0x03, 0x43, 0x23, 0x43, 0x08, 0x03, 0x52, 0x22,
+	0x53, 0x06, 0x03, 0x56, 0x53, 0x06, 0x03, 0x55, 0x63, 0x86, 0x01, 0x03, 0x64, 0x63, 0x06, 0x03,
+	0x72, 0x73, 0x83, 0x05, 0xF0, 0x70, 0x81, 0x03, 0xF0, 0x04, 0x04, 0x83, 0x04, 0x05, 0x73, 0x84,
+	0x01, 0x06, 0x63, 0x06, 0x03, 0x12, 0x63, 0x06, 0x03, 0x13, 0x53, 0x06, 0x03, 0x22, 0x53, 0x06,
+	0x03, 0x23, 0x43, 0x06, 0x03, 0x32, 0x43, 0x06, 0x03, 0x33, 0x33, 0x06, 0x03, 0x42, 0x33, 0x06,
+	0x03, 0x43, 0x23, 0x06, 0x03, 0x52, 0x23, 0x86, 0x01, 0x03, 0x53, 0x13, 0x84, 0x01, 0x03, 0x66,
+	0x84, 0x01, 0x03, 0x75, 0x04, 0x03, 0x84, 0x81, 0x05, 0xF0, 0x83, 0x03, 0xF0, 0x30, 0x03, 0x67,
+	0x50, 0x03, 0x4B, 0x30, 0x05, 0x33, 0x64, 0x20, 0x05, 0x23, 0x84, 0x10, 0x85, 0x01, 0x13, 0xA3,
+	0x10, 0x84, 0x07, 0x03, 0xC3, 0x85, 0x01, 0x13, 0xA3, 0x10, 0x05, 0x14, 0x83, 0x20, 0x05, 0x24,
+	0x63, 0x30, 0x03, 0x3B, 0x40, 0x03, 0x57, 0x60, 0x83, 0x05, 0xF0, 0x30, 0x81, 0x03, 0xC0, 0x03,
+	0x09, 0x30, 0x03, 0x0A, 0x20, 0x05, 0x03, 0x44, 0x10, 0x04, 0x03, 0x54, 0x84, 0x03, 0x03, 0x63,
+	0x05, 0x03, 0x53, 0x10, 0x05, 0x03, 0x44, 0x10, 0x03, 0x0A, 0x20, 0x03, 0x08, 0x40, 0x83, 0x07,
+	0x03, 0x90, 0x81, 0x05, 0xC0, 0x83, 0x03, 0xF0, 0x50, 0x03, 0x67, 0x70, 0x03, 0x4B, 0x50, 0x05,
+	0x33, 0x64, 0x40, 0x05, 0x23, 0x83, 0x40, 0x85, 0x01, 0x13, 0xA3, 0x30, 0x85, 0x07, 0x03, 0xC3,
+	0x20, 0x85, 0x01, 0x13, 0xA3, 0x30, 0x05, 0x14, 0x83, 0x40, 0x05, 0x24, 0x63, 0x50, 0x03, 0x3E,
+	0x30, 0x05, 0x57, 0x24, 0x20, 0x02, 0xF5, 0x04, 0xF0, 0x14, 0x04, 0xF0, 0x32, 0x83, 0x02, 0xF0,
+	0x50, 0x81, 0x03, 0xD0, 0x03, 0x09, 0x40, 0x03, 0x0A, 0x30, 0x05, 0x03, 0x53, 0x20, 0x85, 0x03,
+	0x03, 0x63, 0x10, 0x05, 0x03, 0x54, 0x10, 0x05, 0x03, 0x44, 0x20, 0x03, 0x0A, 0x30, 0x03, 0x09,
+	0x40, 0x05, 0x03, 0x43, 0x30, 0x85, 0x01, 0x03, 0x53, 0x20, 0x05, 0x03, 0x62, 0x20, 0x85, 0x01,
+	0x03, 0x63, 0x10, 0x84, 0x01, 0x03, 0x73, 0x04, 0x03, 0x82, 0x81, 0x05, 0xD0, 0x81, 0x03, 0xC0,
+	0x03, 0x37, 0x20, 0x03, 0x29, 0x10, 0x05, 0x13, 0x52, 0x10, 0x83, 0x02, 0x03, 0x90, 0x03, 0x04,
+	0x80, 0x03, 0x14, 0x70, 0x03, 0x16, 0x50, 0x03, 0x36, 0x30, 0x03, 0x46, 0x20, 0x03, 0x74, 0x10,
+	0x02, 0x84, 0x82, 0x02, 0x93, 0x04, 0x01, 0x74, 0x05, 0x03, 0x44, 0x10, 0x03, 0x19, 0x20, 0x03,
+	0x35, 0x40, 0x81, 0x05, 0xC0, 0x81, 0x03, 0xF0, 0x82, 0x01, 0x0F, 0x83, 0x11, 0x63, 0x60, 0x81,
+	0x05, 0xF0, 0x81, 0x03, 0xF0, 0x84, 0x0E, 0x03, 0x93, 0x04, 0x04, 0x83, 0x05, 0x13, 0x73, 0x10,
+	0x05, 0x14, 0x53, 0x20, 0x03, 0x2A, 0x30, 0x03, 0x47, 0x40, 0x81, 0x05, 0xF0, 0x83, 0x03, 0xF0,
+	0x20, 0x04, 0x03, 0xC2, 0x84, 0x01, 0x13, 0xA3, 0x05, 0x13, 0xA2, 0x10, 0x85, 0x01, 0x23, 0x83,
+	0x10, 0x05, 0x23, 0x82, 0x20, 0x85, 0x01, 0x33, 0x63, 0x20, 0x05, 0x42, 0x62, 0x30, 0x05, 0x43,
+	0x43, 0x30, 0x05, 0x43, 0x42, 0x40, 0x05, 0x52, 0x42, 0x40, 0x05, 0x53, 0x23, 0x40, 0x05, 0x53,
+	0x22, 0x50, 0x05, 0x62, 0x22, 0x50, 0x03, 0x66, 0x50, 0x03, 0x65, 0x60, 0x83, 0x01, 0x74, 0x60,
+	0x83, 0x05, 0xF0, 0x20, 0x83, 0x03, 0xF0, 0xB0, 0x06, 0x03, 0x93, 0x92, 0x06, 0x03, 0x84, 0x92,
+	0x06, 0x03, 0x84, 0x83, 0x06, 0x13, 0x74, 0x83, 0x07, 0x13, 0x75, 0x72, 0x10, 0x07, 0x13, 0x66,
+	0x63, 0x10, 0x09, 0x22, 0x62, 0x22, 0x63, 0x10, 0x09, 0x23, 0x52, 0x23, 0x53, 0x10, 0x09, 0x23,
+	0x52, 0x23, 0x52, 0x20, 0x09, 0x32, 0x43, 0x32, 0x43, 0x20, 0x09, 0x33, 0x32, 0x42, 0x43, 0x20,
+	0x89, 0x01, 0x33, 0x32, 0x43, 0x32, 0x30, 0x09, 0x42, 0x23, 0x52, 0x23, 0x30, 0x89, 0x01, 0x43,
+	0x12, 0x63, 0x12, 0x40, 0x09, 0x52, 0x12, 0x72, 0x12, 0x40, 0x05, 0x55, 0x75, 0x40, 0x85, 0x01,
+	0x54, 0x84, 0x50, 0x83, 0x05, 0xF0, 0xB0, 0x81, 0x03, 0xF0, 0x04, 0x03, 0x93, 0x05, 0x13, 0x73,
+	0x10, 0x05, 0x13, 0x72, 0x20, 0x05, 0x23, 0x53, 0x20, 0x05, 0x23, 0x43, 0x30, 0x05, 0x33, 0x33,
+	0x30, 0x05, 0x43, 0x13, 0x40, 0x05, 0x43, 0x12, 0x50, 0x03, 0x55, 0x50, 0x03, 0x54, 0x60, 0x83,
+	0x01, 0x55, 0x50, 0x05, 0x43, 0x13, 0x40, 0x05, 0x33, 0x23, 0x40, 0x05, 0x33, 0x33, 0x30, 0x05,
+	0x23, 0x44, 0x20, 0x05, 0x22, 0x63, 0x20, 0x05, 0x13, 0x73, 0x10, 0x05, 0x03, 0x83, 0x10, 0x04,
+	0x03, 0x93, 0x81, 0x05, 0xF0, 0x81, 0x03, 0xF0, 0x04, 0x03, 0x93, 0x05, 0x13, 0x82, 0x10, 0x05,
+	0x13, 0x73, 0x10, 0x05, 0x22, 0x72, 0x20, 0x05, 0x23, 0x53, 0x20, 0x05, 0x32, 0x52, 0x30, 0x05,
+	0x33, 0x33, 0x30, 0x05, 0x42, 0x32, 0x40, 0x05, 0x43, 0x13, 0x40, 0x05, 0x52, 0x12, 0x50, 0x03,
+	0x55, 0x50, 0x83, 0x08, 0x63, 0x60, 0x81, 0x05, 0xF0, 0x81, 0x03, 0xD0, 0x82, 0x01, 0x0D, 0x02,
+	0xA3, 0x03, 0x93, 0x10, 0x83, 0x01, 0x83, 0x20, 0x03, 0x73, 0x30, 0x83, 0x01, 0x63, 0x40, 0x83,
+	0x01, 0x53, 0x50, 0x03, 0x43, 0x60, 0x83, 0x01, 0x33, 0x70, 0x03, 0x23, 0x80, 0x83, 0x01, 0x13,
+	0x90, 0x03, 0x03, 0xA0, 0x82, 0x01, 0x0D, 0x81, 0x05, 0xD0, 0x81, 0x01, 0x50, 0x82, 0x01, 0x05,
+	0x83, 0x16, 0x02, 0x30, 0x82, 0x01, 0x05, 0x01, 0x50, 0x01, 0xC0, 0x03, 0x03, 0x90, 0x03, 0x12,
+	0x90, 0x83, 0x01, 0x13, 0x80, 0x03, 0x22, 0x80, 0x83, 0x01, 0x23, 0x70, 0x03, 0x32, 0x70, 0x83,
+	0x01, 0x33, 0x60, 0x03, 0x42, 0x60, 0x03, 0x43, 0x50, 0x03, 0x52, 0x50, 0x83, 0x01, 0x53, 0x40,
+	0x03, 0x62, 0x40, 0x83, 0x01, 0x63, 0x30, 0x03, 0x72, 0x30, 0x03, 0x73, 0x20, 0x03, 0x82, 0x20,
+	0x83, 0x01, 0x83, 0x10, 0x03, 0x92, 0x10, 0x82, 0x01, 0x93, 0x02, 0xA2, 0x81, 0x01, 0xC0, 0x81,
+	0x01, 0x60, 0x82, 0x01, 0x06, 0x82, 0x16, 0x33, 0x82, 0x01, 0x06, 0x01, 0x60, 0x81, 0x03, 0xC0,
+	0x03, 0x43, 0x50, 0x03, 0x44, 0x40, 0x03, 0x35, 0x40, 0x05, 0x32, 0x13, 0x30, 0x05, 0x32, 0x22,
+	0x30, 0x05, 0x23, 0x23, 0x20, 0x05, 0x22, 0x33, 0x20, 0x05, 0x13, 0x43, 0x10, 0x05, 0x12, 0x53,
+	0x10, 0x05, 0x03, 0x62, 0x10, 0x04, 0x03, 0x63, 0x04, 0x02, 0x73, 0x81, 0x0D, 0xC0, 0x83, 0x1B,
+	0xF0, 0x10, 0x84, 0x01, 0x0F, 0x01, 0x81, 0x01, 0x50, 0x03, 0x03, 0x20, 0x03, 0x12, 0x20, 0x03,
+	0x13, 0x10, 0x03, 0x22, 0x10, 0x02, 0x32, 0x81, 0x16, 0x50, 0x81, 0x08, 0xC0, 0x03, 0x36, 0x30,
+	0x03, 0x1A, 0x10, 0x04, 0x12, 0x54, 0x82, 0x02, 0x93, 0x02, 0x39, 0x02, 0x1B, 0x04, 0x13, 0x53,
+	0x84, 0x01, 0x03, 0x63, 0x04, 0x03, 0x54, 0x04, 0x04, 0x35, 0x02, 0x1B, 0x04, 0x25, 0x23, 0x81,
+	0x05, 0xC0, 0x81, 0x01, 0xD0, 0x83, 0x06, 0x03, 0xA0, 0x05, 0x03, 0x25, 0x30, 0x05, 0x03, 0x17,
+	0x20, 0x05, 0x05, 0x34, 0x10, 0x05, 0x04, 0x53, 0x10, 0x84, 0x06, 0x03, 0x73, 0x05, 0x04, 0x53,
+	0x10, 0x05, 0x05, 0x34, 0x10, 0x05, 0x03, 0x17, 0x20, 0x05, 0x03, 0x25, 0x30, 0x81, 0x05, 0xD0,
+	0x81, 0x08, 0xB0, 0x03, 0x45, 0x20, 0x03, 0x28, 0x10, 0x04, 0x14, 0x42, 0x04, 0x13, 0x61, 0x83,
+	0x06, 0x03, 0x80, 0x04, 0x13, 0x61, 0x04, 0x14, 0x42, 0x02, 0x29, 0x03, 0x45, 0x20, 0x81, 0x05,
+	0xB0, 0x81, 0x01, 0xD0, 0x82, 0x06, 0xA3, 0x04, 0x35, 0x23, 0x04, 0x27, 0x13, 0x04, 0x14, 0x35,
+	0x04, 0x13, 0x54, 0x84, 0x06, 0x03, 0x73, 0x04, 0x13, 0x54, 0x04, 0x14, 0x35, 0x04, 0x27, 0x13,
+	0x04, 0x35, 0x23, 0x81, 0x05, 0xD0, 0x81, 0x08, 0xD0, 0x03, 0x46, 0x30, 0x03, 0x29, 0x20, 0x05,
+	0x14, 0x43, 0x10, 0x04, 0x13, 0x54, 0x84, 0x01, 0x03, 0x73, 0x82, 0x01, 0x0D, 0x83, 0x02, 0x03,
+	0xA0, 0x03, 0x13, 0x90, 0x05, 0x14, 0x52, 0x10, 0x03, 0x2A, 0x10, 0x03, 0x46, 0x30, 0x81, 0x05,
+	0xD0, 0x81, 0x01, 0x90, 0x02, 0x45, 0x02, 0x36, 0x03, 0x24, 0x30, 0x83, 0x03, 0x23, 0x40, 0x82,
+	0x01, 0x09, 0x83, 0x0C, 0x23, 0x40, 0x81, 0x05, 0x90, 0x81, 0x08, 0xD0, 0x02, 0x49, 0x02, 0x2B,
+	0x05, 0x22, 0x42, 0x30, 0x85, 0x03, 0x12, 0x62, 0x20, 0x05, 0x22, 0x42, 0x30, 0x03, 0x28, 0x30,
+	0x05, 0x12, 0x14, 0x50, 0x83, 0x01, 0x12, 0xA0, 0x03, 0x19, 0x30, 0x03, 0x2A, 0x10, 0x04, 0x13,
+	0x54, 0x84, 0x02, 0x03, 0x73, 0x05, 0x04, 0x53, 0x10, 0x03, 0x1A, 0x20, 0x03, 0x37, 0x30, 0x81,
+	0x01, 0xD0, 0x83, 0x06, 0x03, 0xA0, 0x05, 0x03, 0x25, 0x30, 0x05, 0x03, 0x18, 0x10, 0x05, 0x05,
+	0x43, 0x10, 0x04, 0x04, 0x63, 0x84, 0x0A, 0x03, 0x73, 0x81, 0x05, 0xD0, 0x81, 0x02, 0x30, 0x82,
+	0x02, 0x03, 0x81, 0x02, 0x30, 0x82, 0x0E, 0x03, 0x81, 0x05, 0x30, 0x81, 0x02, 0x60, 0x82, 0x02,
+	0x33, 0x81, 0x02, 0x60, 0x82, 0x11, 0x33, 0x02, 0x24, 0x03, 0x05, 0x10, 0x03, 0x04, 0x20, 0x81,
+	0x01, 0xC0, 0x83, 0x06, 0x03, 0x90, 0x05, 0x03, 0x53, 0x10, 0x05, 0x03, 0x43, 0x20, 0x05, 0x03,
+	0x34, 0x20, 0x05, 0x03, 0x24, 0x30, 0x05, 0x03, 0x23, 0x40, 0x05, 0x03, 0x13, 0x50, 0x03, 0x06,
+	0x60, 0x05, 0x03, 0x13, 0x50, 0x05, 0x03, 0x14, 0x40, 0x05, 0x03, 0x23, 0x40, 0x05, 0x03, 0x33,
+	0x30, 0x05, 0x03, 0x43, 0x20, 0x05, 0x03, 0x44, 0x10, 0x05, 0x03, 0x53, 0x10, 0x04, 0x03, 0x63,
+	0x81, 0x05, 0xC0, 0x81, 0x01, 0x30, 0x82, 0x15, 0x03, 0x81, 0x05, 0x30, 0x83, 0x08, 0xF0, 0x60,
+	0x07, 0x03, 0x25, 0x45, 0x20, 0x07, 0x03, 0x17, 0x27, 0x10, 0x07, 0x05, 0x36, 0x33, 0x10, 0x06,
+	0x04, 0x54, 0x53, 0x86, 0x0A, 0x03, 0x63, 0x63, 0x83, 0x05, 0xF0, 0x60, 0x81, 0x08, 0xD0, 0x05,
+	0x03, 0x25, 0x30, 0x05, 0x03, 0x18, 0x10, 0x05, 0x05, 0x43, 0x10, 0x04, 0x04, 0x63, 0x84, 0x0A,
+	0x03, 0x73, 0x81, 0x05, 0xD0, 0x81, 0x08, 0xE0, 0x03, 0x46, 0x40, 0x03, 0x2A, 0x20, 0x05, 0x14,
+	0x44, 0x10, 0x05, 0x13, 0x63, 0x10, 0x84, 0x06, 0x03, 0x83, 0x05, 0x13, 0x63, 0x10, 0x05, 0x14,
+	0x43, 0x20, 0x03, 0x2A, 0x20, 0x03, 0x46, 0x40, 0x81, 0x05, 0xE0, 0x81, 0x08, 0xD0, 0x05, 0x03,
+	0x25, 0x30, 0x05, 0x03, 0x17, 0x20, 0x05, 0x05, 0x34, 0x10, 0x05, 0x04, 0x53, 0x10, 0x84, 0x06,
+	0x03, 0x73, 0x05, 0x04, 0x53, 0x10, 0x05, 0x05, 0x34, 0x10, 0x05, 0x03, 0x17, 0x20, 0x05, 0x03,
+	0x25, 0x30, 0x83, 0x05, 0x03, 0xA0, 0x81, 0x08, 0xD0, 0x04, 0x35, 0x23, 0x04, 0x27, 0x13, 0x04,
+	0x14, 0x35, 0x04, 0x13, 0x54, 0x84, 0x06, 0x03, 0x73, 0x04, 0x13, 0x54, 0x04, 0x14, 0x35, 0x04,
+	0x27, 0x13, 0x04, 0x35, 0x23, 0x82, 0x05, 0xA3, 0x81, 0x08, 0x80, 0x04, 0x03, 0x23, 0x02, 0x08,
+	0x03, 0x05, 0x30, 0x03, 0x04, 0x40, 0x83, 0x0A, 0x03, 0x50, 0x81, 0x05, 0x80, 0x81, 0x08, 0xA0,
+	0x03, 0x26, 0x20, 0x03, 0x18, 0x10, 0x05, 0x04, 0x41, 0x10, 0x83, 0x01, 0x03, 0x70, 0x03, 0x04,
+	0x60, 0x03, 0x15, 0x40, 0x03, 0x26, 0x20, 0x03, 0x54, 0x10, 0x02, 0x64, 0x82, 0x01, 0x73, 0x04,
+	0x02, 0x44, 0x03, 0x09, 0x10, 0x03, 0x16, 0x30, 0x81, 0x05, 0xA0, 0x81, 0x04, 0x90, 0x83, 0x03,
+	0x23, 0x40, 0x82, 0x01, 0x09, 0x83, 0x09, 0x23, 0x40, 0x03, 0x24, 0x30, 0x02, 0x36, 0x02, 0x45,
+	0x81, 0x05, 0x90, 0x81, 0x08, 0xC0, 0x84, 0x0A, 0x03, 0x63, 0x04, 0x03, 0x54, 0x04, 0x13, 0x35,
+	0x04, 0x17, 0x13, 0x04, 0x25, 0x23, 0x81, 0x05, 0xC0, 0x81, 0x08, 0xE0, 0x04, 0x03, 0x83, 0x05,
+	0x03, 0x82, 0x10, 0x85, 0x01, 0x13, 0x63, 0x10, 0x05, 0x22, 0x62, 0x20, 0x85, 0x01, 0x23, 0x43,
+	0x20, 0x05, 0x32, 0x42, 0x30, 0x05, 0x33, 0x23, 0x30, 0x05, 0x33, 0x22, 0x40, 0x05, 0x42, 0x22,
+	0x40, 0x03, 0x46, 0x40, 0x03, 0x45, 0x50, 0x83, 0x01, 0x54, 0x50, 0x81, 0x05, 0xE0, 0x83, 0x08,
+	0xF0, 0x60, 0x06, 0x02, 0x72, 0x73, 0x87, 0x01, 0x03, 0x54, 0x62, 0x10, 0x07, 0x03, 0x54, 0x53,
+	0x10, 0x07, 0x12, 0x55, 0x43, 0x10, 0x07, 0x13, 0x36, 0x42, 0x20, 0x09, 0x13, 0x32, 0x22, 0x33,
+	0x20, 0x09, 0x22, 0x32, 0x22, 0x33, 0x20, 0x09, 0x23, 0x22, 0x23, 0x22, 0x30, 0x09, 0x23, 0x13,
+	0x32, 0x13, 0x30, 0x09, 0x32, 0x12, 0x42, 0x13, 0x30, 0x07, 0x32, 0x12, 0x45, 0x40, 0x05, 0x35,
+	0x45, 0x40, 0x05, 0x34, 0x64, 0x40, 0x05, 0x43, 0x63, 0x50, 0x83, 0x05, 0xF0, 0x60, 0x81, 0x08,
+	0xC0, 0x04, 0x03, 0x63, 0x04, 0x13, 0x53, 0x05, 0x13, 0x43, 0x10, 0x05, 0x23, 0x32, 0x20, 0x05,
+	0x33, 0x13, 0x20, 0x03, 0x36, 0x30, 0x83, 0x01, 0x44, 0x40, 0x03, 0x45, 0x30, 0x03, 0x36, 0x30,
+	0x05, 0x23, 0x23, 0x20, 0x05, 0x22, 0x43, 0x10, 0x05, 0x13, 0x43, 0x10, 0x84, 0x01, 0x03, 0x63,
+	0x81, 0x05, 0xC0, 0x81, 0x08, 0xD0, 0x04, 0x02, 0x83, 0x04, 0x03, 0x73, 0x05, 0x03, 0x72, 0x10,
+	0x05, 0x12, 0x63, 0x10, 0x05, 0x13, 0x53, 0x10, 0x05, 0x13, 0x52, 0x20, 0x05, 0x22, 0x43, 0x20,
+	0x85, 0x01, 0x23, 0x32, 0x30, 0x05, 0x32, 0x23, 0x30, 0x05, 0x33, 0x12, 0x40, 0x05, 0x42, 0x12,
+	0x40, 0x03, 0x45, 0x40, 0x03, 0x44, 0x50, 0x83, 0x01, 0x53, 0x50, 0x03, 0x52, 0x60, 0x83, 0x01,
+	0x43, 0x60, 0x83, 0x01, 0x33, 0x70, 0x81, 0x08, 0xA0, 0x82, 0x01, 0x0A, 0x83, 0x01, 0x63, 0x10,
+	0x03, 0x53, 0x20, 0x03, 0x52, 0x30, 0x03, 0x43, 0x30, 0x83, 0x01, 0x33, 0x40, 0x03, 0x23, 0x50,
+	0x03, 0x22, 0x60, 0x03, 0x13, 0x60, 0x03, 0x03, 0x70, 0x82, 0x01, 0x0A, 0x81, 0x05, 0xA0, 0x81,
+	0x01, 0x80, 0x02, 0x53, 0x02, 0x44, 0x83, 0x02, 0x33, 0x20, 0x83, 0x05, 0x32, 0x30, 0x03, 0x23,
+	0x30, 0x83, 0x01, 0x04, 0x40, 0x03, 0x23, 0x30, 0x83, 0x06, 0x32, 0x30, 0x83, 0x02, 0x33, 0x20,
+	0x02, 0x44, 0x02, 0x53, 0x01, 0x80, 0x81, 0x01, 0x30, 0x82, 0x1B, 0x03, 0x81, 0x01, 0x80, 0x03,
+	0x03, 0x50, 0x03, 0x04, 0x40, 0x83, 0x07, 0x23, 0x30, 0x03, 0x32, 0x30, 0x03, 0x33, 0x20, 0x82,
+	0x01, 0x44, 0x03, 0x33, 0x20, 0x83, 0x01, 0x32, 0x30, 0x83, 0x07, 0x23, 0x30, 0x03, 0x04, 0x40,
+	0x03, 0x03, 0x50, 0x01, 0x80, 0x81, 0x05, 0xE0, 0x04, 0x24, 0x62, 0x04, 0x16, 0x52, 0x06, 0x03,
+	0x23, 0x42, 0x06, 0x02, 0x43, 0x23, 0x05, 0x02, 0x56, 0x10, 0x03, 0x84, 0x20, 0x81, 0x11, 0xE0,
+};
+
+char_info_t font30_rle_info[] = {
+	{2, 0}, 		/*   */ 
+	{3, 3}, 		/* ! */ 
+	{8, 21}, 		/* " */ 
+	{14, 34}, 		/* # */ 
+	{13, 93}, 		/* $ */ 
+	{21, 153}, 		/* % */ 
+	{18, 255}, 		/* & */ 
+	{3, 347}, 		/* ' */ 
+	{6, 358}, 		/* ( */ 
+	{6, 405}, 		/* ) */ 
+	{10, 453}, 		/* * */ 
+	{14, 491}, 		/* + */ 
+	{5, 508}, 		/* , */ 
+	{8, 530}, 		/* - */ 
+	{3, 539}, 		/* . */ 
+	{12, 548}, 		/* / */ 
+	{14, 618}, 		/* 0 */ 
+	{12, 658}, 		/* 1 */ 
+	{13, 688}, 		/* 2 */ 
+	{13, 743}, 		/* 3 */ 
+	{15, 800}, 		/* 4 */ 
+	{13, 862}, 		/* 5 */ 
+	{13, 903}, 		/* 6 */ 
+	{13, 959}, 		/* 7 */ 
+	{14, 1007}, 		/* 8 */ 
+	{13, 1067}, 		/* 9 */ 
+	{3, 1123}, 		/* : */ 
+	{5, 1138}, 		/* ; */ 
+	{13, 1165}, 		/* < */ 
+	{13, 1210}, 		/* = */ 
+	{13, 1225}, 		/* > */ 
+	{11, 1273}, 		/* ? */ 
+	{23, 1316}, 		/* @ */ 
+	{17, 1433}, 		/* A */ 
+	{13, 1510}, 		/* B */ 
+	{14, 1562}, 		/* C */ 
+	{16, 1604}, 		/* D */ 
+	{11, 1654}, 		/* E */ 
+	{11, 1678}, 		/* F */ 
+	{16, 1698}, 		/* G */ 
+	{15, 1757}, 		/* H */ 
+	{3, 1774}, 		/* I */ 
+	{8, 1783}, 		/* J */ 
+	{13, 1801}, 		/* K */ 
+	{10, 1877}, 		/* L */ 
+	{22, 1890}, 		/* M */ 
+	{15, 1974}, 		/* N */ 
+	{18, 2042}, 		/* O */ 
+	{12, 2092}, 		/* P */ 
+	{20, 2133}, 		/* Q */ 
+	{13, 2193}, 		/* R */ 
+	{12, 2253}, 		/* S */ 
+	{15, 2309}, 		/* T */ 
+	{15, 2322}, 		/* U */ 
+	{17, 2349}, 		/* V */ 
+	{26, 2420}, 		/* W */ 
+	{15, 2519}, 		/* X */ 
+	{15, 2597}, 		/* Y */ 
+	{13, 2649}, 		/* Z */ 
+	{5, 2698}, 		/* [ */ 
+	{12, 2713}, 		/* \ */ 
+	{6, 2783}, 		/* ] */ 
+	{12, 2797}, 		/* ^ */ 
+	{16, 2846}, 		/* _ */ 
+	{5, 2854}, 		/* ` */ 
+	{12, 2874}, 		/* a */ 
+	{13, 2914}, 		/* b */ 
+	{11, 2960}, 		/* c */ 
+	{13, 2993}, 		/* d */ 
+	{13, 3030}, 		/* e */ 
+	{9, 3073}, 		/* f */ 
+	{13, 3097}, 		/* g */ 
+	{13, 3151}, 		/* h */ 
+	{3, 3180}, 		/* i */ 
+	{6, 3195}, 		/* j */ 
+	{12, 3215}, 		/* k */ 
+	{3, 3283}, 		/* l */ 
+	{21, 3292}, 		/* m */ 
+	{13, 3324}, 		/* n */ 
+	{14, 3349}, 		/* o */ 
+	{13, 3387}, 		/* p */ 
+	{13, 3430}, 		/* q */ 
+	{8, 3464}, 		/* r */ 
+	{10, 3485}, 		/* s */ 
+	{9, 3531}, 		/* t */ 
+	{12, 3555}, 		/* u */ 
+	{14, 3577}, 		/* v */ 
+	{21, 3630}, 		/* w */ 
+	{12, 3710}, 		/* x */ 
+	{13, 3763}, 		/* y */ 
+	{10, 3830}, 		/* z */ 
+	{8, 3871}, 		/* { */ 
+	{3, 3910}, 		/* | */ 
+	{8, 3916}, 		/* } */ 
+	{14, 3957}, 		/* ~ */ 
+};
+
+/**
+ * @brief 59 pixels height run-length compressed data array.
+ */
+const uint8_t font59_rle_data[] = {
+	0x81, 0x3A, 0x20, 0x81, 0x03, 0x70, 0x83, 0x20, 0x15, 0x10, 0x81, 0x03, 0x70, 0x03, 0x15, 0x10,
+	0x02, 0x16, 0x82, 0x02, 0x07, 0x02, 0x16, 0x03, 0x15, 0x10, 0x81, 0x0A, 0x70, 0x83, 0x02, 0xF0,
+	0x20, 0x04, 0x15, 0x65, 0x04, 0x06, 0x56, 0x84, 0x01, 0x06, 0x65, 0x04, 0x15, 0x65, 0x84, 0x01,
+	0x14, 0x75, 0x85, 0x08, 0x14, 0x74, 0x10, 0x83, 0x27, 0xF0, 0x20, 0x83, 0x06, 0xF0, 0xF0, 0x05,
+	0x94, 0x94, 0x40, 0x05, 0x85, 0x94, 0x40, 0x85, 0x02, 0x85, 0x85, 0x40, 0x85, 0x01, 0x84, 0x95,
+	0x40, 0x05, 0x84, 0x94, 0x50, 0x85, 0x01, 0x75, 0x94, 0x50, 0x05, 0x75, 0x85, 0x50, 0x05, 0x2F,
+	0x0C, 0x10, 0x84, 0x01, 0x2F, 0x0D, 0x05, 0x2F, 0x0C, 0x10, 0x05, 0x74, 0x95, 0x50, 0x85, 0x02,
+	0x65, 0x94, 0x60, 0x85, 0x01, 0x65, 0x85, 0x60, 0x85, 0x02, 0x64, 0x95, 0x60, 0x05, 0x55, 0x94,
+	0x70, 0x85, 0x03, 0x0F, 0x0D, 0x20, 0x85, 0x01, 0x54, 0x95, 0x70, 0x85, 0x02, 0x45, 0x94, 0x80,
+	0x85, 0x02, 0x45, 0x85, 0x80, 0x85, 0x01, 0x44, 0x95, 0x80, 0x05, 0x44, 0x94, 0x90, 0x83, 0x0B,
+	0xF0, 0xF0, 0x83, 0x03, 0xD4, 0x90, 0x83, 0x01, 0xC5, 0x90, 0x03, 0xC4, 0xA0, 0x03, 0x9A, 0x70,
+	0x05, 0x6F, 0x01, 0x40, 0x05, 0x4F, 0x04, 0x30, 0x05, 0x3F, 0x05, 0x30, 0x05, 0x28, 0x77, 0x20,
+	0x05, 0x26, 0xC4, 0x20, 0x05, 0x16, 0xF1, 0x30, 0x85, 0x04, 0x15, 0xF0, 0x50, 0x85, 0x01, 0x16,
+	0xF0, 0x40, 0x05, 0x17, 0xF0, 0x30, 0x05, 0x28, 0xF0, 0x10, 0x03, 0x39, 0xE0, 0x03, 0x4B, 0xB0,
+	0x03, 0x5D, 0x80, 0x03, 0x6E, 0x60, 0x03, 0x9D, 0x40, 0x03, 0xBC, 0x30, 0x03, 0xEA, 0x20, 0x05,
+	0xF0, 0x19, 0x10, 0x05, 0xF0, 0x37, 0x10, 0x05, 0xF0, 0x46, 0x10, 0x84, 0x04, 0xF0, 0x56, 0x05,
+	0xF0, 0x55, 0x10, 0x05, 0xF0, 0x46, 0x10, 0x07, 0x02, 0xF0, 0x26, 0x10, 0x05, 0x04, 0xD7, 0x20,
+	0x05, 0x07, 0x88, 0x30, 0x05, 0x0F, 0x07, 0x40, 0x05, 0x0F, 0x06, 0x50, 0x05, 0x2F, 0x02, 0x70,
+	0x03, 0x6A, 0xA0, 0x83, 0x05, 0x84, 0xE0, 0x03, 0x75, 0xE0, 0x03, 0x74, 0xF0, 0x83, 0x03, 0xF0,
+	0xB0, 0x85, 0x04, 0xF0, 0xF0, 0xA0, 0x07, 0xF0, 0xF0, 0x24, 0x40, 0x07, 0xF0, 0xF0, 0x15, 0x40,
+	0x07, 0x57, 0xF0, 0x35, 0x50, 0x07, 0x3B, 0xF0, 0x14, 0x60, 0x05, 0x2D, 0xE5, 0x60, 0x05, 0x2E,
+	0xC5, 0x70, 0x07, 0x15, 0x55, 0xB5, 0x80, 0x07, 0x14, 0x74, 0xB5, 0x80, 0x07, 0x05, 0x75, 0x95,
+	0x90, 0x07, 0x05, 0x75, 0x85, 0xA0, 0x07, 0x04, 0x94, 0x85, 0xA0, 0x07, 0x04, 0x94, 0x75, 0xB0,
+	0x07, 0x04, 0x94, 0x65, 0xC0, 0x07, 0x04, 0x94, 0x64, 0xD0, 0x07, 0x05, 0x75, 0x55, 0xD0, 0x07,
+	0x05, 0x75, 0x45, 0xE0, 0x07, 0x14, 0x74, 0x54, 0xF0, 0x07, 0x15, 0x55, 0x45, 0xF0, 0x07, 0x1E,
+	0x45, 0xF0, 0x10, 0x07, 0x2D, 0x35, 0xF0, 0x20, 0x07, 0x3B, 0x45, 0xF0, 0x20, 0x07, 0x57, 0x55,
+	0xF0, 0x30, 0x07, 0xF0, 0x15, 0x77, 0x50, 0x07, 0xF0, 0x14, 0x6B, 0x30, 0x05, 0xF5, 0x5D, 0x20,
+	0x05, 0xE5, 0x6E, 0x10, 0x07, 0xE4, 0x65, 0x55, 0x10, 0x07, 0xD5, 0x64, 0x74, 0x10, 0x06, 0xC5,
+	0x65, 0x75, 0x06, 0xC4, 0x75, 0x75, 0x06, 0xB5, 0x74, 0x94, 0x06, 0xA5, 0x84, 0x94, 0x86, 0x01,
+	0x95, 0x94, 0x94, 0x06, 0x85, 0xA5, 0x75, 0x06, 0x75, 0xB5, 0x75, 0x07, 0x74, 0xD4, 0x74, 0x10,
+	0x07, 0x65, 0xD5, 0x55, 0x10, 0x05, 0x55, 0xEE, 0x20, 0x07, 0x54, 0xF0, 0x1D, 0x20, 0x07, 0x45,
+	0xF0, 0x2B, 0x30, 0x07, 0x35, 0xF0, 0x57, 0x50, 0x07, 0x34, 0xF0, 0xF0, 0x30, 0x85, 0x0A, 0xF0,
+	0xF0, 0xA0, 0x85, 0x03, 0xF0, 0xF0, 0x80, 0x05, 0xC9, 0xF0, 0x20, 0x03, 0x9E, 0xF0, 0x05, 0x8F,
+	0x01, 0xE0, 0x05, 0x6F, 0x04, 0xD0, 0x05, 0x67, 0x67, 0xC0, 0x05, 0x56, 0x96, 0xC0, 0x05, 0x55,
+	0xB6, 0xB0, 0x85, 0x04, 0x46, 0xB6, 0xB0, 0x05, 0x46, 0xA6, 0xC0, 0x05, 0x56, 0x87, 0xC0, 0x05,
+	0x56, 0x77, 0xD0, 0x05, 0x66, 0x57, 0xE0, 0x05, 0x67, 0x37, 0xF0, 0x07, 0x76, 0x18, 0xF0, 0x10,
+	0x05, 0x8C, 0xF0, 0x30, 0x05, 0x8B, 0xF0, 0x40, 0x05, 0x98, 0xD4, 0x40, 0x05, 0x79, 0xD5, 0x40,
+	0x05, 0x6B, 0xC5, 0x40, 0x05, 0x5D, 0xB5, 0x40, 0x07, 0x46, 0x27, 0xA5, 0x40, 0x07, 0x36, 0x47,
+	0x95, 0x40, 0x07, 0x26, 0x67, 0x85, 0x40, 0x07, 0x16, 0x87, 0x75, 0x40, 0x07, 0x16, 0x97, 0x55,
+	0x50, 0x07, 0x15, 0xB7, 0x45, 0x50, 0x07, 0x15, 0xC7, 0x35, 0x50, 0x07, 0x06, 0xD7, 0x15, 0x60,
+	0x05, 0x06, 0xEC, 0x60, 0x05, 0x06, 0xFA, 0x70, 0x07, 0x15, 0xF0, 0x19, 0x70, 0x07, 0x16, 0xF0,
+	0x17, 0x80, 0x07, 0x16, 0xF0, 0x19, 0x60, 0x05, 0x17, 0xEB, 0x50, 0x05, 0x27, 0xBE, 0x40, 0x07,
+	0x38, 0x78, 0x27, 0x30, 0x06, 0x4F, 0x06, 0x49, 0x06, 0x5F, 0x03, 0x78, 0x04, 0x7E, 0xB6, 0x04,
+	0x99, 0xF5, 0x85, 0x0A, 0xF0, 0xF0, 0x80, 0x81, 0x02, 0x60, 0x02, 0x15, 0x82, 0x02, 0x06, 0x82,
+	0x01, 0x15, 0x83, 0x09, 0x14, 0x10, 0x81, 0x27, 0x60, 0x81, 0x02, 0xB0, 0x02, 0x74, 0x82, 0x01,
+	0x65, 0x03, 0x64, 0x10, 0x03, 0x55, 0x10, 0x03, 0x54, 0x20, 0x83, 0x01, 0x45, 0x20, 0x83, 0x02,
+	0x35, 0x30, 0x03, 0x26, 0x30, 0x83, 0x02, 0x25, 0x40, 0x03, 0x16, 0x40, 0x83, 0x03, 0x15, 0x50,
+	0x83, 0x04, 0x06, 0x50, 0x83, 0x04, 0x05, 0x60, 0x83, 0x04, 0x06, 0x50, 0x83, 0x03, 0x15, 0x50,
+	0x03, 0x16, 0x40, 0x83, 0x02, 0x25, 0x40, 0x03, 0x26, 0x30, 0x83, 0x01, 0x35, 0x30, 0x03, 0x36,
+	0x20, 0x83, 0x01, 0x45, 0x20, 0x83, 0x02, 0x55, 0x10, 0x82, 0x01, 0x65, 0x02, 0x74, 0x01, 0xB0,
+	0x81, 0x02, 0xB0, 0x03, 0x04, 0x70, 0x83, 0x01, 0x05, 0x60, 0x83, 0x01, 0x15, 0x50, 0x03, 0x24,
+	0x50, 0x83, 0x01, 0x25, 0x40, 0x83, 0x02, 0x35, 0x30, 0x03, 0x36, 0x20, 0x83, 0x02, 0x45, 0x20,
+	0x03, 0x46, 0x10, 0x83, 0x03, 0x55, 0x10, 0x82, 0x03, 0x56, 0x82, 0x06, 0x65, 0x82, 0x03, 0x56,
+	0x83, 0x03, 0x55, 0x10, 0x03, 0x46, 0x10, 0x83, 0x02, 0x45, 0x20, 0x03, 0x36, 0x20, 0x83, 0x02,
+	0x35, 0x30, 0x83, 0x01, 0x25, 0x40, 0x83, 0x02, 0x15, 0x50, 0x83, 0x01, 0x05, 0x60, 0x03, 0x04,
+	0x70, 0x01, 0xB0, 0x83, 0x02, 0xF0, 0x70, 0x83, 0x03, 0x94, 0x90, 0x07, 0x21, 0x64, 0x61, 0x20,
+	0x07, 0x13, 0x54, 0x44, 0x10, 0x07, 0x06, 0x34, 0x35, 0x10, 0x06, 0x07, 0x23, 0x28, 0x05, 0x1B,
+	0x18, 0x10, 0x03, 0x3F, 0x40, 0x03, 0x6A, 0x60, 0x03, 0x86, 0x80, 0x03, 0x6A, 0x60, 0x03, 0x3F,
+	0x40, 0x05, 0x1B, 0x18, 0x10, 0x06, 0x07, 0x23, 0x28, 0x07, 0x06, 0x34, 0x35, 0x10, 0x07, 0x13,
+	0x54, 0x44, 0x10, 0x07, 0x21, 0x64, 0x61, 0x20, 0x83, 0x03, 0x94, 0x90, 0x83, 0x20, 0xF0, 0x70,
+	0x83, 0x0E, 0xF0, 0xD0, 0x83, 0x0B, 0xC4, 0xC0, 0x05, 0x1F, 0x0B, 0x10, 0x84, 0x01, 0x0F, 0x0D,
+	0x05, 0x1F, 0x0B, 0x10, 0x83, 0x0B, 0xC4, 0xC0, 0x83, 0x0F, 0xF0, 0xD0, 0x81, 0x27, 0xB0, 0x03,
+	0x55, 0x10, 0x82, 0x02, 0x56, 0x83, 0x02, 0x55, 0x10, 0x83, 0x01, 0x45, 0x20, 0x83, 0x01, 0x35,
+	0x30, 0x03, 0x25, 0x40, 0x03, 0x24, 0x50, 0x03, 0x15, 0x50, 0x03, 0x14, 0x60, 0x03, 0x04, 0x70,
+	0x81, 0x02, 0xB0, 0x81, 0x1C, 0xF0, 0x82, 0x03, 0x0F, 0x81, 0x19, 0xF0, 0x81, 0x27, 0x70, 0x03,
+	0x15, 0x10, 0x03, 0x06, 0x10, 0x82, 0x02, 0x07, 0x03, 0x06, 0x10, 0x03, 0x15, 0x10, 0x81, 0x0B,
+	0x70, 0x03, 0xF0, 0x90, 0x04, 0xF0, 0x54, 0x84, 0x01, 0xF0, 0x45, 0x85, 0x02, 0xF0, 0x35, 0x10,
+	0x85, 0x01, 0xF0, 0x25, 0x20, 0x05, 0xF0, 0x16, 0x20, 0x85, 0x01, 0xF0, 0x15, 0x30, 0x03, 0xF6,
+	0x30, 0x83, 0x01, 0xF5, 0x40, 0x83, 0x02, 0xE5, 0x50, 0x83, 0x02, 0xD5, 0x60, 0x83, 0x01, 0xC5,
+	0x70, 0x03, 0xB6, 0x70, 0x83, 0x01, 0xB5, 0x80, 0x83, 0x02, 0xA5, 0x90, 0x83, 0x02, 0x95, 0xA0,
+	0x83, 0x01, 0x85, 0xB0, 0x03, 0x76, 0xB0, 0x83, 0x01, 0x75, 0xC0, 0x03, 0x66, 0xC0, 0x83, 0x01,
+	0x65, 0xD0, 0x83, 0x02, 0x55, 0xE0, 0x83, 0x01, 0x45, 0xF0, 0x03, 0x36, 0xF0, 0x85, 0x01, 0x35,
+	0xF0, 0x10, 0x05, 0x26, 0xF0, 0x10, 0x85, 0x01, 0x25, 0xF0, 0x20, 0x85, 0x02, 0x15, 0xF0, 0x30,
+	0x85, 0x01, 0x05, 0xF0, 0x40, 0x83, 0x02, 0xF0, 0x90, 0x83, 0x05, 0xF0, 0xD0, 0x03, 0xA9, 0x90,
+	0x03, 0x8D, 0x70, 0x05, 0x6F, 0x02, 0x50, 0x05, 0x5F, 0x04, 0x40, 0x05, 0x47, 0x67, 0x40, 0x05,
+	0x36, 0xA6, 0x30, 0x05, 0x35, 0xC6, 0x20, 0x85, 0x01, 0x25, 0xE5, 0x20, 0x07, 0x24, 0xF0, 0x15,
+	0x10, 0x87, 0x02, 0x15, 0xF0, 0x15, 0x10, 0x06, 0x14, 0xF0, 0x35, 0x86, 0x0D, 0x05, 0xF0, 0x35,
+	0x07, 0x05, 0xF0, 0x34, 0x10, 0x87, 0x02, 0x15, 0xF0, 0x15, 0x10, 0x07, 0x15, 0xF0, 0x14, 0x20,
+	0x85, 0x01, 0x25, 0xE5, 0x20, 0x05, 0x26, 0xC5, 0x30, 0x05, 0x36, 0xA6, 0x30, 0x05, 0x47, 0x67,
+	0x40, 0x05, 0x4F, 0x04, 0x50, 0x05, 0x5F, 0x02, 0x60, 0x03, 0x7D, 0x80, 0x03, 0x99, 0xA0, 0x83,
+	0x0A, 0xF0, 0xD0, 0x83, 0x06, 0xF0, 0x80, 0x03, 0xA5, 0x80, 0x03, 0x96, 0x80, 0x03, 0x78, 0x80,
+	0x03, 0x69, 0x80, 0x03, 0x4B, 0x80, 0x03, 0x3C, 0x80, 0x05, 0x18, 0x15, 0x80, 0x05, 0x08, 0x25,
+	0x80, 0x05, 0x06, 0x45, 0x80, 0x05, 0x04, 0x65, 0x80, 0x05, 0x03, 0x75, 0x80, 0x83, 0x18, 0xA5,
+	0x80, 0x84, 0x03, 0x0F, 0x08, 0x83, 0x0B, 0xF0, 0x80, 0x83, 0x05, 0xF0, 0xA0, 0x03, 0x88, 0x90,
+	0x03, 0x5D, 0x70, 0x05, 0x3F, 0x02, 0x50, 0x05, 0x2F, 0x04, 0x40, 0x05, 0x1F, 0x05, 0x40, 0x05,
+	0x17, 0x68, 0x30, 0x05, 0x14, 0xB6, 0x30, 0x05, 0x12, 0xE6, 0x20, 0x05, 0xF0, 0x26, 0x20, 0x85,
+	0x05, 0xF0, 0x35, 0x20, 0x85, 0x01, 0xF0, 0x25, 0x30, 0x05, 0xF0, 0x16, 0x30, 0x05, 0xF0, 0x15,
+	0x40, 0x03, 0xF6, 0x40, 0x03, 0xF5, 0x50, 0x03, 0xE5, 0x60, 0x03, 0xD6, 0x60, 0x03, 0xC6, 0x70,
+	0x03, 0xB6, 0x80, 0x03, 0xA6, 0x90, 0x03, 0x97, 0x90, 0x03, 0x96, 0xA0, 0x03, 0x86, 0xB0, 0x03,
+	0x76, 0xC0, 0x03, 0x66, 0xD0, 0x03, 0x56, 0xE0, 0x03, 0x46, 0xF0, 0x05, 0x36, 0xF0, 0x10, 0x05,
+	0x26, 0xF0, 0x20, 0x05, 0x16, 0xF0, 0x30, 0x84, 0x04, 0x0F, 0x0A, 0x83, 0x0B, 0xF0, 0xA0, 0x83,
+	0x05, 0xF0, 0xA0, 0x03, 0x88, 0x90, 0x03, 0x5D, 0x70, 0x05, 0x3F, 0x02, 0x50, 0x05, 0x2F, 0x04,
+	0x40, 0x05, 0x17, 0x68, 0x30, 0x05, 0x15, 0xA6, 0x30, 0x05, 0x13, 0xD5, 0x30, 0x05, 0x12, 0xE6,
+	0x20, 0x85, 0x05, 0xF0, 0x35, 0x20, 0x85, 0x01, 0xF0, 0x25, 0x30, 0x05, 0xF0, 0x15, 0x40, 0x03,
+	0xF6, 0x40, 0x03, 0xC8, 0x50, 0x03, 0x4E, 0x70, 0x03, 0x4C, 0x90, 0x03, 0x4F, 0x60, 0x05, 0x4F,
+	0x02, 0x40, 0x03, 0xE8, 0x30, 0x05, 0xF0, 0x17, 0x20, 0x05, 0xF0, 0x36, 0x10, 0x05, 0xF0, 0x45,
+	0x10, 0x04, 0xF0, 0x46, 0x84, 0x04, 0xF0, 0x55, 0x04, 0xF0, 0x46, 0x05, 0xF0, 0x45, 0x10, 0x07,
+	0x02, 0xF0, 0x16, 0x10, 0x05, 0x04, 0xD6, 0x20, 0x05, 0x07, 0x88, 0x20, 0x05, 0x0F, 0x07, 0x30,
+	0x05, 0x1F, 0x04, 0x50, 0x05, 0x3F, 0x01, 0x60, 0x03, 0x6A, 0x90, 0x83, 0x0A, 0xF0, 0xA0, 0x83,
+	0x06, 0xF0, 0xE0, 0x05, 0xF0, 0x17, 0x60, 0x03, 0xF8, 0x60, 0x83, 0x01, 0xE9, 0x60, 0x03, 0xDA,
+	0x60, 0x05, 0xD4, 0x15, 0x60, 0x05, 0xC5, 0x15, 0x60, 0x85, 0x01, 0xB5, 0x25, 0x60, 0x85, 0x01,
+	0xA5, 0x35, 0x60, 0x05, 0x95, 0x45, 0x60, 0x85, 0x01, 0x85, 0x55, 0x60, 0x85, 0x01, 0x75, 0x65,
+	0x60, 0x05, 0x65, 0x75, 0x60, 0x05, 0x64, 0x85, 0x60, 0x05, 0x55, 0x85, 0x60, 0x85, 0x01, 0x45,
+	0x95, 0x60, 0x85, 0x01, 0x35, 0xA5, 0x60, 0x05, 0x25, 0xB5, 0x60, 0x85, 0x01, 0x15, 0xC5, 0x60,
+	0x05, 0x05, 0xD5, 0x60, 0x05, 0x0F, 0x0D, 0x10, 0x84, 0x01, 0x0F, 0x0E, 0x05, 0x0F, 0x0D, 0x10,
+	0x85, 0x08, 0xF0, 0x35, 0x60, 0x83, 0x0B, 0xF0, 0xE0, 0x83, 0x06, 0xF0, 0xB0, 0x85, 0x04, 0x2F,
+	0x06, 0x30, 0x85, 0x0A, 0x25, 0xF0, 0x40, 0x03, 0x2F, 0x90, 0x05, 0x2F, 0x03, 0x60, 0x05, 0x2F,
+	0x05, 0x40, 0x05, 0x2F, 0x06, 0x30, 0x03, 0xF9, 0x20, 0x05, 0xF0, 0x36, 0x20, 0x05, 0xF0, 0x46,
+	0x10, 0x05, 0xF0, 0x55, 0x10, 0x04, 0xF0, 0x56, 0x84, 0x05, 0xF0, 0x65, 0x04, 0xF0, 0x56, 0x05,
+	0xF0, 0x55, 0x10, 0x05, 0xF0, 0x46, 0x10, 0x07, 0x02, 0xF0, 0x25, 0x20, 0x05, 0x04, 0xD7, 0x20,
+	0x05, 0x07, 0x88, 0x30, 0x05, 0x0F, 0x07, 0x40, 0x05, 0x0F, 0x05, 0x60, 0x05, 0x2F, 0x01, 0x80,
+	0x03, 0x69, 0xB0, 0x83, 0x0A, 0xF0, 0xB0, 0x83, 0x05, 0xF0, 0xC0, 0x03, 0xCA, 0x50, 0x03, 0xAF,
+	0x20, 0x05, 0x8F, 0x02, 0x20, 0x05, 0x6F, 0x04, 0x20, 0x05, 0x58, 0x84, 0x20, 0x05, 0x56, 0xF0,
+	0x10, 0x05, 0x45, 0xF0, 0x30, 0x85, 0x01, 0x35, 0xF0, 0x40, 0x85, 0x01, 0x25, 0xF0, 0x50, 0x85,
+	0x02, 0x15, 0xF0, 0x60, 0x85, 0x01, 0x14, 0xF0, 0x70, 0x05, 0x05, 0x59, 0x80, 0x05, 0x05, 0x2F,
+	0x50, 0x05, 0x0F, 0x08, 0x40, 0x05, 0x0F, 0x09, 0x30, 0x05, 0x0A, 0x87, 0x20, 0x05, 0x07, 0xC7,
+	0x10, 0x05, 0x06, 0xE6, 0x10, 0x07, 0x05, 0xF0, 0x15, 0x10, 0x06, 0x05, 0xF0, 0x16, 0x86, 0x04,
+	0x05, 0xF0, 0x25, 0x86, 0x01, 0x15, 0xF0, 0x15, 0x05, 0x15, 0xF5, 0x10, 0x05, 0x16, 0xE5, 0x10,
+	0x05, 0x25, 0xD6, 0x10, 0x05, 0x26, 0xC5, 0x20, 0x05, 0x36, 0x97, 0x20, 0x05, 0x37, 0x77, 0x30,
+	0x05, 0x4F, 0x04, 0x40, 0x05, 0x5F, 0x02, 0x50, 0x03, 0x6E, 0x70, 0x03, 0x98, 0xA0, 0x83, 0x0A,
+	0xF0, 0xC0, 0x83, 0x06, 0xF0, 0xB0, 0x84, 0x04, 0x0F, 0x0B, 0x04, 0xF0, 0x56, 0x05, 0xF0, 0x55,
+	0x10, 0x05, 0xF0, 0x46, 0x10, 0x05, 0xF0, 0x45, 0x20, 0x05, 0xF0, 0x36, 0x20, 0x05, 0xF0, 0x35,
+	0x30, 0x05, 0xF0, 0x26, 0x30, 0x05, 0xF0, 0x25, 0x40, 0x85, 0x01, 0xF0, 0x16, 0x40, 0x05, 0xF0,
+	0x15, 0x50, 0x03, 0xF6, 0x50, 0x03, 0xF5, 0x60, 0x03, 0xE6, 0x60, 0x03, 0xE5, 0x70, 0x83, 0x01,
+	0xD6, 0x70, 0x83, 0x01, 0xC6, 0x80, 0x83, 0x01, 0xB6, 0x90, 0x03, 0xB5, 0xA0, 0x03, 0xA6, 0xA0,
+	0x03, 0xA5, 0xB0, 0x83, 0x01, 0x96, 0xB0, 0x83, 0x01, 0x86, 0xC0, 0x83, 0x01, 0x76, 0xD0, 0x03,
+	0x75, 0xE0, 0x83, 0x01, 0x66, 0xE0, 0x03, 0x56, 0xF0, 0x05, 0x55, 0xF0, 0x10, 0x83, 0x0B, 0xF0,
+	0xB0, 0x83, 0x05, 0xF0, 0xC0, 0x03, 0x99, 0x90, 0x03, 0x6F, 0x60, 0x05, 0x5F, 0x03, 0x40, 0x05,
+	0x4F, 0x05, 0x30, 0x05, 0x37, 0x78, 0x20, 0x05, 0x26, 0xB6, 0x20, 0x05, 0x25, 0xD6, 0x10, 0x85,
+	0x04, 0x15, 0xF5, 0x10, 0x05, 0x16, 0xD5, 0x20, 0x05, 0x25, 0xD5, 0x20, 0x05, 0x26, 0xB6, 0x20,
+	0x05, 0x36, 0x96, 0x30, 0x05, 0x38, 0x66, 0x40, 0x05, 0x49, 0x27, 0x50, 0x03, 0x6F, 0x60, 0x03,
+	0x7C, 0x80, 0x03, 0x9A, 0x80, 0x03, 0x7E, 0x60, 0x05, 0x6F, 0x01, 0x50, 0x05, 0x47, 0x48, 0x40,
+	0x05, 0x37, 0x77, 0x30, 0x05, 0x26, 0xA7, 0x20, 0x05, 0x25, 0xD6, 0x10, 0x05, 0x15, 0xF5, 0x10,
+	0x04, 0x15, 0xF6, 0x86, 0x04, 0x05, 0xF0, 0x25, 0x04, 0x06, 0xF6, 0x05, 0x15, 0xF5, 0x10, 0x05,
+	0x16, 0xD6, 0x10, 0x05, 0x28, 0x78, 0x20, 0x05, 0x3F, 0x06, 0x30, 0x05, 0x4F, 0x04, 0x40, 0x05,
+	0x5F, 0x01, 0x60, 0x03, 0x8A, 0x90, 0x83, 0x0A, 0xF0, 0xC0, 0x83, 0x05, 0xF0, 0xC0, 0x03, 0x99,
+	0x90, 0x03, 0x7D, 0x70, 0x05, 0x5F, 0x02, 0x50, 0x05, 0x4F, 0x04, 0x40, 0x05, 0x37, 0x68, 0x30,
+	0x05, 0x26, 0xA6, 0x30, 0x05, 0x25, 0xC6, 0x20, 0x05, 0x16, 0xD5, 0x20, 0x05, 0x15, 0xE6, 0x10,
+	0x05, 0x15, 0xF5, 0x10, 0x87, 0x01, 0x05, 0xF0, 0x15, 0x10, 0x06, 0x05, 0xF0, 0x16, 0x86, 0x03,
+	0x05, 0xF0, 0x25, 0x06, 0x06, 0xF0, 0x15, 0x06, 0x15, 0xF0, 0x15, 0x04, 0x16, 0xF5, 0x04, 0x17,
+	0xC7, 0x04, 0x28, 0x7A, 0x04, 0x3F, 0x09, 0x04, 0x4F, 0x08, 0x04, 0x5F, 0x25, 0x04, 0x89, 0x55,
+	0x85, 0x01, 0xF0, 0x74, 0x10, 0x85, 0x01, 0xF0, 0x65, 0x10, 0x05, 0xF0, 0x64, 0x20, 0x85, 0x01,
+	0xF0, 0x55, 0x20, 0x05, 0xF0, 0x45, 0x30, 0x05, 0xF0, 0x36, 0x30, 0x05, 0xF0, 0x26, 0x40, 0x05,
+	0xF0, 0x16, 0x50, 0x05, 0x15, 0x87, 0x60, 0x05, 0x1F, 0x04, 0x70, 0x05, 0x1F, 0x03, 0x80, 0x03,
+	0x2F, 0xA0, 0x03, 0x59, 0xD0, 0x83, 0x0A, 0xF0, 0xC0, 0x81, 0x10, 0x70, 0x03, 0x15, 0x10, 0x82,
+	0x04, 0x07, 0x03, 0x15, 0x10, 0x81, 0x0F, 0x70, 0x03, 0x15, 0x10, 0x82, 0x04, 0x07, 0x03, 0x15,
+	0x10, 0x81, 0x0B, 0x70, 0x81, 0x11, 0xA0, 0x03, 0x45, 0x10, 0x82, 0x04, 0x37, 0x03, 0x45, 0x10,
+	0x81, 0x0E, 0xA0, 0x03, 0x54, 0x10, 0x82, 0x04, 0x46, 0x83, 0x01, 0x45, 0x10, 0x83, 0x01, 0x35,
+	0x20, 0x03, 0x25, 0x30, 0x03, 0x24, 0x40, 0x03, 0x15, 0x40, 0x03, 0x14, 0x50, 0x83, 0x01, 0x04,
+	0x60, 0x81, 0x02, 0xA0, 0x83, 0x0D, 0xF0, 0xC0, 0x04, 0xF0, 0x93, 0x04, 0xF0, 0x84, 0x04, 0xF0,
+	0x66, 0x04, 0xF0, 0x48, 0x05, 0xF0, 0x29, 0x10, 0x03, 0xFA, 0x20, 0x03, 0xDA, 0x40, 0x03, 0xBA,
+	0x60, 0x03, 0x9A, 0x80, 0x03, 0x7A, 0xA0, 0x03, 0x5A, 0xC0, 0x03, 0x3A, 0xE0, 0x05, 0x1A, 0xF0,
+	0x10, 0x05, 0x09, 0xF0, 0x30, 0x05, 0x07, 0xF0, 0x50, 0x05, 0x06, 0xF0, 0x60, 0x05, 0x08, 0xF0,
+	0x40, 0x05, 0x19, 0xF0, 0x20, 0x03, 0x39, 0xF0, 0x03, 0x59, 0xD0, 0x03, 0x79, 0xB0, 0x03, 0x99,
+	0x90, 0x03, 0xB9, 0x70, 0x03, 0xD9, 0x50, 0x03, 0xF9, 0x30, 0x05, 0xF0, 0x29, 0x10, 0x04, 0xF0,
+	0x48, 0x04, 0xF0, 0x66, 0x04, 0xF0, 0x84, 0x04, 0xF0, 0x93, 0x83, 0x0E, 0xF0, 0xC0, 0x83, 0x14,
+	0xF0, 0xB0, 0x84, 0x03, 0x0F, 0x0B, 0x83, 0x07, 0xF0, 0xB0, 0x84, 0x03, 0x0F, 0x0B, 0x83, 0x15,
+	0xF0, 0xB0, 0x83, 0x0D, 0xF0, 0xC0, 0x05, 0x02, 0xF0, 0xA0, 0x05, 0x04, 0xF0, 0x80, 0x05, 0x06,
+	0xF0, 0x60, 0x05, 0x08, 0xF0, 0x40, 0x05, 0x19, 0xF0, 0x20, 0x03, 0x2A, 0xF0, 0x03, 0x4A, 0xD0,
+	0x03, 0x6A, 0xB0, 0x03, 0x8A, 0x90, 0x03, 0xAA, 0x70, 0x03, 0xD9, 0x50, 0x03, 0xF9, 0x30, 0x05,
+	0xF0, 0x29, 0x10, 0x04, 0xF0, 0x48, 0x04, 0xF0, 0x66, 0x04, 0xF0, 0x57, 0x04, 0xF0, 0x39, 0x05,
+	0xF0, 0x1A, 0x10, 0x03, 0xEA, 0x30, 0x03, 0xCA, 0x50, 0x03, 0xAA, 0x70, 0x03, 0x8A, 0x90, 0x03,
+	0x6A, 0xB0, 0x03, 0x4A, 0xD0, 0x03, 0x2A, 0xF0, 0x05, 0x19, 0xF0, 0x20, 0x05, 0x08, 0xF0, 0x40,
+	0x05, 0x06, 0xF0, 0x60, 0x05, 0x04, 0xF0, 0x80, 0x05, 0x02, 0xF0, 0xA0, 0x83, 0x0E, 0xF0, 0xC0,
+	0x83, 0x03, 0xF0, 0x70, 0x03, 0x59, 0x80, 0x03, 0x2E, 0x60, 0x05, 0x1F, 0x02, 0x40, 0x05, 0x0F,
+	0x04, 0x30, 0x05, 0x06, 0x68, 0x20, 0x05, 0x04, 0xA6, 0x20, 0x05, 0x02, 0xD6, 0x10, 0x05, 0xF0,
+	0x15, 0x10, 0x04, 0xF0, 0x16, 0x84, 0x05, 0xF0, 0x25, 0x04, 0xF0, 0x16, 0x05, 0xF0, 0x15, 0x10,
+	0x83, 0x01, 0xF6, 0x10, 0x03, 0xD7, 0x20, 0x03, 0x8B, 0x30, 0x03, 0x7B, 0x40, 0x03, 0x7A, 0x50,
+	0x03, 0x78, 0x70, 0x83, 0x08, 0x75, 0xA0, 0x83, 0x03, 0xF0, 0x70, 0x03, 0x74, 0xB0, 0x83, 0x04,
+	0x66, 0xA0, 0x03, 0x74, 0xB0, 0x83, 0x0A, 0xF0, 0x70, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0x10, 0x05,
+	0xF0, 0x5C, 0xE0, 0x07, 0xF0, 0x2F, 0x04, 0xA0, 0x05, 0xEF, 0x09, 0x80, 0x05, 0xCF, 0x0D, 0x60,
+	0x05, 0xBA, 0xAA, 0x50, 0x07, 0x98, 0xF0, 0x28, 0x40, 0x07, 0x87, 0xF0, 0x67, 0x30, 0x07, 0x77,
+	0xF0, 0x87, 0x20, 0x07, 0x75, 0xF0, 0xB6, 0x20, 0x07, 0x65, 0xF0, 0xD6, 0x10, 0x07, 0x55, 0xF0,
+	0xF5, 0x10, 0x09, 0x46, 0x96, 0x63, 0x65, 0x10, 0x08, 0x45, 0x8A, 0x34, 0x66, 0x08, 0x35, 0x8C,
+	0x24, 0x75, 0x08, 0x35, 0x7E, 0x14, 0x75, 0x08, 0x34, 0x77, 0x49, 0x75, 0x08, 0x25, 0x75, 0x77,
+	0x85, 0x08, 0x25, 0x66, 0x86, 0x85, 0x08, 0x24, 0x75, 0xA5, 0x85, 0x88, 0x01, 0x15, 0x65, 0xB5,
+	0x85, 0x08, 0x15, 0x65, 0xB4, 0x95, 0x08, 0x14, 0x74, 0xC4, 0x95, 0x09, 0x05, 0x65, 0xB5, 0x94,
+	0x10, 0x89, 0x01, 0x05, 0x65, 0xB5, 0x85, 0x10, 0x09, 0x05, 0x65, 0xB4, 0x95, 0x10, 0x09, 0x05,
+	0x65, 0xB4, 0x94, 0x20, 0x09, 0x05, 0x65, 0xA5, 0x85, 0x20, 0x09, 0x05, 0x65, 0x87, 0x76, 0x20,
+	0x09, 0x05, 0x66, 0x69, 0x65, 0x30, 0x09, 0x05, 0x75, 0x5A, 0x46, 0x40, 0x07, 0x05, 0x7E, 0x2E,
+	0x40, 0x07, 0x05, 0x7D, 0x3D, 0x50, 0x07, 0x05, 0x8A, 0x6A, 0x70, 0x07, 0x15, 0x96, 0xA6, 0x90,
+	0x87, 0x01, 0x15, 0xF0, 0xF0, 0xA0, 0x07, 0x16, 0xF0, 0xF0, 0x90, 0x07, 0x25, 0xF0, 0xF0, 0x90,
+	0x07, 0x26, 0xF0, 0xF0, 0x80, 0x07, 0x36, 0xF0, 0xF0, 0x70, 0x07, 0x47, 0xF0, 0xF0, 0x50, 0x07,
+	0x58, 0xF0, 0x32, 0xD0, 0x05, 0x6A, 0xB6, 0xD0, 0x05, 0x7F, 0x0B, 0xD0, 0x05, 0x9F, 0x09, 0xD0,
+	0x05, 0xBF, 0x05, 0xF0, 0x05, 0xFC, 0xF0, 0x40, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0x10, 0x85, 0x06,
+	0xF0, 0xF0, 0x50, 0x83, 0x01, 0xE7, 0xE0, 0x83, 0x02, 0xD9, 0xD0, 0x03, 0xCB, 0xC0, 0x05, 0xC5,
+	0x15, 0xC0, 0x05, 0xC4, 0x25, 0xC0, 0x05, 0xB5, 0x26, 0xB0, 0x05, 0xB5, 0x35, 0xB0, 0x05, 0xA5,
+	0x46, 0xA0, 0x85, 0x01, 0xA5, 0x55, 0xA0, 0x05, 0x95, 0x66, 0x90, 0x85, 0x01, 0x95, 0x75, 0x90,
+	0x05, 0x85, 0x86, 0x80, 0x05, 0x85, 0x95, 0x80, 0x05, 0x85, 0x96, 0x70, 0x05, 0x75, 0xA6, 0x70,
+	0x05, 0x75, 0xB5, 0x70, 0x85, 0x01, 0x65, 0xC6, 0x60, 0x05, 0x65, 0xD5, 0x60, 0x05, 0x55, 0xE6,
+	0x50, 0x85, 0x01, 0x5F, 0x0A, 0x50, 0x85, 0x01, 0x4F, 0x0C, 0x40, 0x07, 0x36, 0xF0, 0x26, 0x30,
+	0x07, 0x35, 0xF0, 0x36, 0x30, 0x07, 0x35, 0xF0, 0x45, 0x30, 0x07, 0x26, 0xF0, 0x46, 0x20, 0x07,
+	0x25, 0xF0, 0x56, 0x20, 0x07, 0x25, 0xF0, 0x65, 0x20, 0x07, 0x16, 0xF0, 0x66, 0x10, 0x07, 0x15,
+	0xF0, 0x76, 0x10, 0x06, 0x15, 0xF0, 0x86, 0x06, 0x06, 0xF0, 0x86, 0x06, 0x05, 0xF0, 0x96, 0x85,
+	0x0B, 0xF0, 0xF0, 0x50, 0x83, 0x06, 0xF0, 0xC0, 0x03, 0x1F, 0xB0, 0x05, 0x0F, 0x04, 0x80, 0x05,
+	0x0F, 0x06, 0x60, 0x05, 0x0F, 0x07, 0x50, 0x05, 0x05, 0xA7, 0x50, 0x05, 0x05, 0xC6, 0x40, 0x05,
+	0x05, 0xD5, 0x40, 0x05, 0x05, 0xD6, 0x30, 0x85, 0x05, 0x05, 0xE5, 0x30, 0x85, 0x01, 0x05, 0xD5,
+	0x40, 0x05, 0x05, 0xC5, 0x50, 0x05, 0x05, 0xA6, 0x60, 0x85, 0x01, 0x0F, 0x05, 0x70, 0x05, 0x0F,
+	0x07, 0x50, 0x05, 0x0F, 0x09, 0x30, 0x05, 0x05, 0xC8, 0x20, 0x05, 0x05, 0xE6, 0x20, 0x05, 0x05,
+	0xF6, 0x10, 0x07, 0x05, 0xF0, 0x15, 0x10, 0x86, 0x05, 0x05, 0xF0, 0x25, 0x07, 0x05, 0xF0, 0x15,
+	0x10, 0x05, 0x05, 0xF6, 0x10, 0x05, 0x05, 0xE6, 0x20, 0x05, 0x05, 0xC8, 0x20, 0x05, 0x0F, 0x09,
+	0x30, 0x05, 0x0F, 0x08, 0x40, 0x05, 0x0F, 0x06, 0x60, 0x05, 0x1F, 0x02, 0x90, 0x83, 0x0B, 0xF0,
+	0xC0, 0x83, 0x05, 0xF0, 0xE0, 0x03, 0xD9, 0x70, 0x03, 0xAF, 0x40, 0x05, 0x9F, 0x03, 0x20, 0x05,
+	0x7F, 0x06, 0x10, 0x04, 0x6F, 0x08, 0x04, 0x59, 0x78, 0x04, 0x47, 0xD5, 0x06, 0x46, 0xF0, 0x13,
+	0x06, 0x36, 0xF0, 0x32, 0x85, 0x01, 0x26, 0xF0, 0x60, 0x05, 0x25, 0xF0, 0x70, 0x05, 0x16, 0xF0,
+	0x70, 0x85, 0x02, 0x15, 0xF0, 0x80, 0x85, 0x0A, 0x05, 0xF0, 0x90, 0x05, 0x06, 0xF0, 0x80, 0x85,
+	0x01, 0x15, 0xF0, 0x80, 0x05, 0x16, 0xF0, 0x70, 0x05, 0x25, 0xF0, 0x70, 0x05, 0x26, 0xF0, 0x60,
+	0x06, 0x27, 0xF0, 0x32, 0x06, 0x37, 0xF0, 0x13, 0x04, 0x47, 0xD5, 0x04, 0x4A, 0x78, 0x04, 0x5F,
+	0x09, 0x05, 0x6F, 0x07, 0x10, 0x05, 0x8F, 0x04, 0x20, 0x03, 0xAF, 0x40, 0x03, 0xC9, 0x80, 0x83,
+	0x0A, 0xF0, 0xE0, 0x85, 0x06, 0xF0, 0xF0, 0x10, 0x05, 0x1F, 0x01, 0xE0, 0x05, 0x0F, 0x05, 0xB0,
+	0x05, 0x0F, 0x07, 0x90, 0x05, 0x0F, 0x09, 0x70, 0x05, 0x05, 0xB9, 0x60, 0x05, 0x05, 0xE7, 0x50,
+	0x05, 0x05, 0xF7, 0x40, 0x07, 0x05, 0xF0, 0x26, 0x30, 0x07, 0x05, 0xF0, 0x35, 0x30, 0x07, 0x05,
+	0xF0, 0x36, 0x20, 0x07, 0x05, 0xF0, 0x45, 0x20, 0x87, 0x02, 0x05, 0xF0, 0x55, 0x10, 0x86, 0x0A,
+	0x05, 0xF0, 0x65, 0x87, 0x02, 0x05, 0xF0, 0x55, 0x10, 0x07, 0x05, 0xF0, 0x46, 0x10, 0x07, 0x05,
+	0xF0, 0x45, 0x20, 0x07, 0x05, 0xF0, 0x36, 0x20, 0x07, 0x05, 0xF0, 0x26, 0x30, 0x07, 0x05, 0xF0,
+	0x17, 0x30, 0x05, 0x05, 0xE8, 0x40, 0x05, 0x05, 0xBA, 0x50, 0x05, 0x0F, 0x0A, 0x60, 0x05, 0x0F,
+	0x09, 0x70, 0x05, 0x0F, 0x07, 0x90, 0x05, 0x0F, 0x05, 0xB0, 0x03, 0x1F, 0xF0, 0x85, 0x0B, 0xF0,
+	0xF0, 0x10, 0x83, 0x06, 0xF0, 0x80, 0x04, 0x1F, 0x07, 0x84, 0x02, 0x0F, 0x08, 0x85, 0x0C, 0x05,
+	0xF0, 0x30, 0x85, 0x03, 0x0F, 0x05, 0x30, 0x85, 0x0E, 0x05, 0xF0, 0x30, 0x84, 0x02, 0x0F, 0x08,
+	0x04, 0x1F, 0x07, 0x83, 0x0B, 0xF0, 0x80, 0x83, 0x06, 0xF0, 0x60, 0x04, 0x1F, 0x05, 0x84, 0x03,
+	0x0F, 0x06, 0x85, 0x0C, 0x05, 0xF0, 0x10, 0x85, 0x03, 0x0F, 0x05, 0x10, 0x85, 0x11, 0x05, 0xF0,
+	0x10, 0x83, 0x0B, 0xF0, 0x60, 0x85, 0x05, 0xF0, 0xF0, 0x30, 0x03, 0xFA, 0x80, 0x05, 0xCF, 0x01,
+	0x50, 0x05, 0xAF, 0x05, 0x30, 0x05, 0x8F, 0x08, 0x20, 0x05, 0x7F, 0x0A, 0x10, 0x04, 0x6A, 0x89,
+	0x04, 0x58, 0xE6, 0x06, 0x47, 0xF0, 0x34, 0x06, 0x37, 0xF0, 0x62, 0x05, 0x36, 0xF0, 0x90, 0x05,
+	0x26, 0xF0, 0xA0, 0x05, 0x25, 0xF0, 0xB0, 0x05, 0x16, 0xF0, 0xB0, 0x85, 0x02, 0x15, 0xF0, 0xC0,
+	0x85, 0x02, 0x05, 0xF0, 0xD0, 0x05, 0x05, 0xCF, 0x10, 0x86, 0x02, 0x05, 0xCF, 0x01, 0x86, 0x02,
+	0x05, 0xF0, 0x85, 0x06, 0x06, 0xF0, 0x75, 0x86, 0x01, 0x15, 0xF0, 0x75, 0x06, 0x16, 0xF0, 0x65,
+	0x06, 0x25, 0xF0, 0x65, 0x06, 0x26, 0xF0, 0x55, 0x06, 0x36, 0xF0, 0x45, 0x06, 0x37, 0xF0, 0x35,
+	0x06, 0x47, 0xF0, 0x25, 0x04, 0x58, 0xE6, 0x04, 0x5B, 0x89, 0x04, 0x6F, 0x0C, 0x04, 0x8F, 0x0A,
+	0x05, 0x9F, 0x07, 0x20, 0x05, 0xBF, 0x03, 0x40, 0x03, 0xFA, 0x80, 0x85, 0x0A, 0xF0, 0xF0, 0x30,
+	0x83, 0x06, 0xF0, 0xE0, 0x86, 0x0F, 0x05, 0xF0, 0x45, 0x84, 0x04, 0x0F, 0x0E, 0x86, 0x12, 0x05,
+	0xF0, 0x45, 0x83, 0x0B, 0xF0, 0xE0, 0x81, 0x06, 0x50, 0x82, 0x27, 0x05, 0x81, 0x0B, 0x50, 0x81,
+	0x06, 0xF0, 0x82, 0x21, 0xA5, 0x04, 0x02, 0x76, 0x05, 0x04, 0x46, 0x10, 0x03, 0x0E, 0x10, 0x83,
+	0x01, 0x0D, 0x20, 0x03, 0x1B, 0x30, 0x03, 0x37, 0x50, 0x81, 0x0A, 0xF0, 0x83, 0x06, 0xF0, 0xB0,
+	0x05, 0x05, 0xF5, 0x10, 0x05, 0x05, 0xE6, 0x10, 0x05, 0x05, 0xD7, 0x10, 0x05, 0x05, 0xC7, 0x20,
+	0x05, 0x05, 0xB7, 0x30, 0x05, 0x05, 0xB6, 0x40, 0x05, 0x05, 0xA6, 0x50, 0x05, 0x05, 0x96, 0x60,
+	0x05, 0x05, 0x86, 0x70, 0x05, 0x05, 0x77, 0x70, 0x05, 0x05, 0x76, 0x80, 0x05, 0x05, 0x66, 0x90,
+	0x05, 0x05, 0x56, 0xA0, 0x05, 0x05, 0x46, 0xB0, 0x05, 0x05, 0x36, 0xC0, 0x05, 0x05, 0x35, 0xD0,
+	0x05, 0x05, 0x26, 0xD0, 0x05, 0x05, 0x16, 0xE0, 0x03, 0x0B, 0xF0, 0x03, 0x0C, 0xE0, 0x05, 0x05,
+	0x16, 0xE0, 0x05, 0x05, 0x26, 0xD0, 0x05, 0x05, 0x27, 0xC0, 0x05, 0x05, 0x37, 0xB0, 0x05, 0x05,
+	0x46, 0xB0, 0x05, 0x05, 0x56, 0xA0, 0x05, 0x05, 0x57, 0x90, 0x05, 0x05, 0x67, 0x80, 0x05, 0x05,
+	0x76, 0x80, 0x05, 0x05, 0x86, 0x70, 0x05, 0x05, 0x87, 0x60, 0x05, 0x05, 0x97, 0x50, 0x05, 0x05,
+	0xA6, 0x50, 0x05, 0x05, 0xB6, 0x40, 0x05, 0x05, 0xB7, 0x30, 0x05, 0x05, 0xC7, 0x20, 0x05, 0x05,
+	0xD7, 0x10, 0x05, 0x05, 0xE6, 0x10, 0x04, 0x05, 0xE7, 0x04, 0x05, 0xF6, 0x83, 0x0B, 0xF0, 0xB0,
+	0x83, 0x06, 0xF0, 0x60, 0x85, 0x22, 0x05, 0xF0, 0x10, 0x84, 0x03, 0x0F, 0x06, 0x04, 0x1F, 0x05,
+	0x83, 0x0B, 0xF0, 0x60, 0x85, 0x06, 0xF0, 0xF0, 0xE0, 0x07, 0x17, 0xF0, 0xD7, 0x10, 0x06, 0x09,
+	0xF0, 0xB9, 0x06, 0x0A, 0xF0, 0xA9, 0x86, 0x01, 0x0A, 0xF0, 0x9A, 0x0A, 0x05, 0x15, 0xF0, 0x84,
+	0x15, 0x0A, 0x05, 0x15, 0xF0, 0x75, 0x15, 0x0A, 0x05, 0x16, 0xF0, 0x65, 0x15, 0x0A, 0x05, 0x25,
+	0xF0, 0x55, 0x25, 0x0A, 0x05, 0x26, 0xF0, 0x45, 0x25, 0x8A, 0x01, 0x05, 0x35, 0xF0, 0x35, 0x35,
+	0x0A, 0x05, 0x36, 0xF0, 0x25, 0x35, 0x0A, 0x05, 0x45, 0xF0, 0x15, 0x45, 0x08, 0x05, 0x46, 0xF5,
+	0x45, 0x88, 0x01, 0x05, 0x55, 0xE5, 0x55, 0x08, 0x05, 0x56, 0xC5, 0x65, 0x08, 0x05, 0x65, 0xC5,
+	0x65, 0x08, 0x05, 0x66, 0xB5, 0x65, 0x08, 0x05, 0x75, 0xA5, 0x75, 0x08, 0x05, 0x76, 0x95, 0x75,
+	0x08, 0x05, 0x76, 0x85, 0x85, 0x08, 0x05, 0x85, 0x85, 0x85, 0x08, 0x05, 0x86, 0x66, 0x85, 0x08,
+	0x05, 0x95, 0x65, 0x95, 0x08, 0x05, 0x96, 0x55, 0x95, 0x08, 0x05, 0x96, 0x45, 0xA5, 0x08, 0x05,
+	0xA6, 0x35, 0xA5, 0x08, 0x05, 0xA6, 0x25, 0xB5, 0x08, 0x05, 0xB5, 0x25, 0xB5, 0x06, 0x05, 0xBC,
+	0xB5, 0x06, 0x05, 0xBB, 0xC5, 0x06, 0x05, 0xCA, 0xC5, 0x06, 0x05, 0xC9, 0xD5, 0x86, 0x01, 0x05,
+	0xD8, 0xD5, 0x86, 0x01, 0x05, 0xE6, 0xE5, 0x06, 0x05, 0xE5, 0xF5, 0x85, 0x0B, 0xF0, 0xF0, 0xE0,
+	0x85, 0x06, 0xF0, 0xF0, 0x10, 0x06, 0x16, 0xF0, 0x45, 0x06, 0x08, 0xF0, 0x35, 0x86, 0x01, 0x09,
+	0xF0, 0x25, 0x06, 0x0A, 0xF0, 0x15, 0x84, 0x01, 0x0B, 0xF5, 0x86, 0x01, 0x05, 0x16, 0xE5, 0x86,
+	0x01, 0x05, 0x26, 0xD5, 0x06, 0x05, 0x36, 0xC5, 0x86, 0x01, 0x05, 0x46, 0xB5, 0x86, 0x01, 0x05,
+	0x56, 0xA5, 0x06, 0x05, 0x66, 0x95, 0x06, 0x05, 0x67, 0x85, 0x06, 0x05, 0x76, 0x85, 0x86, 0x01,
+	0x05, 0x86, 0x75, 0x86, 0x01, 0x05, 0x96, 0x65, 0x06, 0x05, 0xA6, 0x55, 0x86, 0x01, 0x05, 0xB6,
+	0x45, 0x86, 0x01, 0x05, 0xC6, 0x35, 0x86, 0x01, 0x05, 0xD6, 0x25, 0x06, 0x05, 0xE6, 0x15, 0x06,
+	0x05, 0xF5, 0x15, 0x04, 0x05, 0xFB, 0x86, 0x01, 0x05, 0xF0, 0x1A, 0x06, 0x05, 0xF0, 0x29, 0x86,
+	0x01, 0x05, 0xF0, 0x38, 0x06, 0x05, 0xF0, 0x47, 0x07, 0x05, 0xF0, 0x55, 0x10, 0x85, 0x0B, 0xF0,
+	0xF0, 0x10, 0x85, 0x05, 0xF0, 0xF0, 0x60, 0x03, 0xDA, 0xD0, 0x05, 0xAF, 0x02, 0x90, 0x05, 0x8F,
+	0x05, 0x80, 0x05, 0x7F, 0x08, 0x60, 0x05, 0x6F, 0x0A, 0x50, 0x05, 0x59, 0x8A, 0x40, 0x05, 0x48,
+	0xD8, 0x30, 0x07, 0x37, 0xF0, 0x17, 0x30, 0x07, 0x36, 0xF0, 0x37, 0x20, 0x07, 0x26, 0xF0, 0x56,
+	0x20, 0x07, 0x25, 0xF0, 0x76, 0x10, 0x07, 0x16, 0xF0, 0x76, 0x10, 0x87, 0x01, 0x15, 0xF0, 0x95,
+	0x10, 0x06, 0x15, 0xF0, 0x96, 0x06, 0x06, 0xF0, 0xA5, 0x86, 0x09, 0x05, 0xF0, 0xB5, 0x06, 0x05,
+	0xF0, 0xA6, 0x07, 0x06, 0xF0, 0x95, 0x10, 0x87, 0x01, 0x15, 0xF0, 0x95, 0x10, 0x07, 0x16, 0xF0,
+	0x76, 0x10, 0x07, 0x16, 0xF0, 0x75, 0x20, 0x07, 0x26, 0xF0, 0x56, 0x20, 0x07, 0x27, 0xF0, 0x36,
+	0x30, 0x07, 0x37, 0xF0, 0x17, 0x30, 0x05, 0x38, 0xD8, 0x40, 0x05, 0x4A, 0x89, 0x50, 0x05, 0x5F,
+	0x0A, 0x60, 0x05, 0x6F, 0x08, 0x70, 0x05, 0x8F, 0x05, 0x80, 0x05, 0x9F, 0x02, 0xA0, 0x03, 0xDA,
+	0xD0, 0x85, 0x0A, 0xF0, 0xF0, 0x60, 0x83, 0x06, 0xF0, 0xA0, 0x03, 0x1F, 0x90, 0x05, 0x0F, 0x04,
+	0x60, 0x05, 0x0F, 0x06, 0x40, 0x05, 0x0F, 0x07, 0x30, 0x05, 0x05, 0xA8, 0x20, 0x05, 0x05, 0xC6,
+	0x20, 0x05, 0x05, 0xD6, 0x10, 0x05, 0x05, 0xE5, 0x10, 0x04, 0x05, 0xE6, 0x84, 0x05, 0x05, 0xF5,
+	0x04, 0x05, 0xE6, 0x05, 0x05, 0xE5, 0x10, 0x05, 0x05, 0xD6, 0x10, 0x05, 0x05, 0xD5, 0x20, 0x05,
+	0x05, 0xB7, 0x20, 0x05, 0x05, 0x98, 0x30, 0x05, 0x0F, 0x06, 0x40, 0x05, 0x0F, 0x05, 0x50, 0x05,
+	0x0F, 0x03, 0x70, 0x03, 0x0F, 0xA0, 0x85, 0x0E, 0x05, 0xF0, 0x50, 0x83, 0x0B, 0xF0, 0xA0, 0x85,
+	0x05, 0xF0, 0xF0, 0xB0, 0x05, 0xDA, 0xF0, 0x30, 0x05, 0xAF, 0x01, 0xF0, 0x05, 0x8F, 0x05, 0xD0,
+	0x05, 0x7F, 0x08, 0xB0, 0x05, 0x6F, 0x0A, 0xA0, 0x05, 0x59, 0x8A, 0x90, 0x05, 0x48, 0xD7, 0x90,
+	0x07, 0x37, 0xF0, 0x17, 0x80, 0x07, 0x36, 0xF0, 0x37, 0x70, 0x07, 0x26, 0xF0, 0x56, 0x70, 0x07,
+	0x25, 0xF0, 0x75, 0x70, 0x07, 0x16, 0xF0, 0x76, 0x60, 0x87, 0x01, 0x15, 0xF0, 0x95, 0x60, 0x07,
+	0x15, 0xF0, 0x96, 0x50, 0x07, 0x06, 0xF0, 0xA5, 0x50, 0x87, 0x09, 0x05, 0xF0, 0xB5, 0x50, 0x07,
+	0x05, 0xF0, 0xA6, 0x50, 0x07, 0x06, 0xF0, 0x95, 0x60, 0x87, 0x01, 0x15, 0xF0, 0x95, 0x60, 0x07,
+	0x16, 0xF0, 0x76, 0x60, 0x07, 0x16, 0xF0, 0x75, 0x70, 0x07, 0x26, 0xF0, 0x56, 0x70, 0x07, 0x27,
+	0xF0, 0x36, 0x80, 0x07, 0x37, 0xF0, 0x17, 0x80, 0x05, 0x38, 0xD8, 0x90, 0x05, 0x4A, 0x89, 0xA0,
+	0x05, 0x5F, 0x0C, 0x90, 0x05, 0x6F, 0x0C, 0x80, 0x05, 0x8F, 0x0C, 0x60, 0x07, 0x9F, 0x01, 0x39,
+	0x40, 0x05, 0xD9, 0x7A, 0x20, 0x04, 0xF0, 0xFB, 0x06, 0xF0, 0xF0, 0x29, 0x06, 0xF0, 0xF0, 0x47,
+	0x06, 0xF0, 0xF0, 0x65, 0x06, 0xF0, 0xF0, 0x83, 0x85, 0x05, 0xF0, 0xF0, 0xB0, 0x83, 0x06, 0xF0,
+	0xC0, 0x05, 0x1F, 0x01, 0xA0, 0x05, 0x0F, 0x04, 0x80, 0x05, 0x0F, 0x06, 0x60, 0x05, 0x0F, 0x07,
+	0x50, 0x05, 0x05, 0xA8, 0x40, 0x05, 0x05, 0xC7, 0x30, 0x05, 0x05, 0xE5, 0x30, 0x05, 0x05, 0xE6,
+	0x20, 0x85, 0x05, 0x05, 0xF5, 0x20, 0x05, 0x05, 0xE5, 0x30, 0x05, 0x05, 0xD6, 0x30, 0x05, 0x05,
+	0xC6, 0x40, 0x05, 0x05, 0xA7, 0x50, 0x05, 0x0F, 0x06, 0x60, 0x05, 0x0F, 0x04, 0x80, 0x05, 0x0F,
+	0x02, 0xA0, 0x05, 0x0F, 0x04, 0x80, 0x05, 0x05, 0x78, 0x70, 0x05, 0x05, 0x96, 0x70, 0x05, 0x05,
+	0xA6, 0x60, 0x85, 0x01, 0x05, 0xB6, 0x50, 0x85, 0x01, 0x05, 0xC6, 0x40, 0x05, 0x05, 0xD5, 0x40,
+	0x85, 0x01, 0x05, 0xD6, 0x30, 0x85, 0x01, 0x05, 0xE6, 0x20, 0x05, 0x05, 0xF5, 0x20, 0x85, 0x01,
+	0x05, 0xF6, 0x10, 0x86, 0x01, 0x05, 0xF0, 0x16, 0x06, 0x05, 0xF0, 0x25, 0x83, 0x0B, 0xF0, 0xC0,
+	0x83, 0x05, 0xF0, 0xA0, 0x03, 0x99, 0x70, 0x03, 0x7F, 0x30, 0x05, 0x5F, 0x03, 0x20, 0x05, 0x4F,
+	0x04, 0x20, 0x05, 0x37, 0x76, 0x20, 0x05, 0x26, 0xB4, 0x20, 0x05, 0x25, 0xE2, 0x20, 0x05, 0x16,
+	0xF0, 0x30, 0x85, 0x04, 0x15, 0xF0, 0x40, 0x05, 0x16, 0xF0, 0x30, 0x05, 0x26, 0xF0, 0x20, 0x05,
+	0x27, 0xF0, 0x10, 0x03, 0x38, 0xE0, 0x03, 0x3A, 0xC0, 0x03, 0x4B, 0xA0, 0x03, 0x6B, 0x80, 0x03,
+	0x7C, 0x60, 0x03, 0x9C, 0x40, 0x03, 0xBB, 0x30, 0x03, 0xE9, 0x20, 0x05, 0xF0, 0x18, 0x10, 0x05,
+	0xF0, 0x27, 0x10, 0x05, 0xF0, 0x36, 0x10, 0x04, 0xF0, 0x46, 0x84, 0x04, 0xF0, 0x55, 0x04, 0xF0,
+	0x46, 0x07, 0x02, 0xF0, 0x25, 0x10, 0x05, 0x04, 0xD7, 0x10, 0x05, 0x08, 0x78, 0x20, 0x05, 0x0F,
+	0x07, 0x30, 0x05, 0x0F, 0x06, 0x40, 0x05, 0x1F, 0x04, 0x50, 0x03, 0x3F, 0x70, 0x03, 0x6A, 0x90,
+	0x83, 0x0A, 0xF0, 0xA0, 0x83, 0x06, 0xF0, 0xE0, 0x84, 0x04, 0x0F, 0x0E, 0x83, 0x22, 0xC5, 0xC0,
+	0x83, 0x0B, 0xF0, 0xE0, 0x83, 0x06, 0xF0, 0xF0, 0x86, 0x1C, 0x05, 0xF0, 0x55, 0x06, 0x06, 0xF0,
+	0x36, 0x07, 0x06, 0xF0, 0x35, 0x10, 0x07, 0x15, 0xF0, 0x35, 0x10, 0x07, 0x16, 0xF0, 0x16, 0x10,
+	0x05, 0x17, 0xE6, 0x20, 0x05, 0x27, 0xC7, 0x20, 0x05, 0x38, 0x88, 0x30, 0x05, 0x3F, 0x08, 0x40,
+	0x05, 0x4F, 0x06, 0x50, 0x05, 0x6F, 0x03, 0x60, 0x03, 0x7F, 0x80, 0x03, 0xA9, 0xB0, 0x83, 0x0A,
+	0xF0, 0xF0, 0x85, 0x06, 0xF0, 0xF0, 0x40, 0x06, 0x05, 0xF0, 0x95, 0x06, 0x06, 0xF0, 0x76, 0x07,
+	0x06, 0xF0, 0x75, 0x10, 0x07, 0x06, 0xF0, 0x66, 0x10, 0x07, 0x16, 0xF0, 0x56, 0x10, 0x07, 0x16,
+	0xF0, 0x55, 0x20, 0x07, 0x25, 0xF0, 0x46, 0x20, 0x07, 0x26, 0xF0, 0x36, 0x20, 0x07, 0x26, 0xF0,
+	0x35, 0x30, 0x07, 0x35, 0xF0, 0x26, 0x30, 0x87, 0x01, 0x36, 0xF0, 0x15, 0x40, 0x05, 0x45, 0xF6,
+	0x40, 0x85, 0x01, 0x46, 0xE5, 0x50, 0x05, 0x55, 0xD6, 0x50, 0x85, 0x01, 0x56, 0xC5, 0x60, 0x05,
+	0x65, 0xB6, 0x60, 0x05, 0x66, 0xA5, 0x70, 0x05, 0x75, 0xA5, 0x70, 0x05, 0x76, 0x86, 0x70, 0x05,
+	0x76, 0x85, 0x80, 0x05, 0x85, 0x85, 0x80, 0x85, 0x01, 0x86, 0x65, 0x90, 0x05, 0x95, 0x65, 0x90,
+	0x85, 0x01, 0x96, 0x45, 0xA0, 0x05, 0xA5, 0x45, 0xA0, 0x05, 0xA6, 0x25, 0xB0, 0x85, 0x01, 0xB5,
+	0x25, 0xB0, 0x03, 0xBB, 0xC0, 0x03, 0xCA, 0xC0, 0x83, 0x01, 0xC9, 0xD0, 0x03, 0xD8, 0xD0, 0x03,
+	0xD7, 0xE0, 0x03, 0xE6, 0xE0, 0x85, 0x0B, 0xF0, 0xF0, 0x40, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0x80,
+	0x0A, 0x05, 0xF0, 0x45, 0xF0, 0x45, 0x0A, 0x06, 0xF0, 0x26, 0xF0, 0x36, 0x0A, 0x06, 0xF0, 0x27,
+	0xF0, 0x26, 0x0B, 0x15, 0xF0, 0x27, 0xF0, 0x25, 0x10, 0x09, 0x16, 0xF8, 0xF0, 0x25, 0x10, 0x87,
+	0x01, 0x16, 0xF9, 0xF6, 0x10, 0x07, 0x25, 0xF9, 0xF5, 0x20, 0x07, 0x26, 0xDA, 0xF5, 0x20, 0x07,
+	0x26, 0xDB, 0xD6, 0x20, 0x09, 0x35, 0xD5, 0x15, 0xD5, 0x30, 0x09, 0x35, 0xD4, 0x25, 0xD5, 0x30,
+	0x09, 0x36, 0xB5, 0x26, 0xC5, 0x30, 0x09, 0x36, 0xB5, 0x35, 0xB5, 0x40, 0x09, 0x45, 0xB5, 0x35,
+	0xB5, 0x40, 0x09, 0x46, 0xA4, 0x45, 0xB5, 0x40, 0x09, 0x46, 0x95, 0x46, 0x96, 0x40, 0x89, 0x01,
+	0x55, 0x95, 0x55, 0x95, 0x50, 0x09, 0x56, 0x84, 0x65, 0x95, 0x50, 0x09, 0x65, 0x75, 0x66, 0x75,
+	0x60, 0x09, 0x65, 0x75, 0x75, 0x75, 0x60, 0x09, 0x65, 0x74, 0x85, 0x75, 0x60, 0x09, 0x66, 0x64,
+	0x86, 0x65, 0x60, 0x89, 0x01, 0x75, 0x55, 0x95, 0x55, 0x70, 0x09, 0x76, 0x44, 0xA5, 0x55, 0x70,
+	0x09, 0x85, 0x35, 0xA6, 0x44, 0x80, 0x89, 0x01, 0x85, 0x35, 0xB5, 0x35, 0x80, 0x09, 0x86, 0x24,
+	0xC6, 0x24, 0x90, 0x89, 0x02, 0x95, 0x15, 0xD5, 0x15, 0x90, 0x05, 0xA9, 0xEA, 0xA0, 0x85, 0x01,
+	0xA9, 0xF9, 0xA0, 0x05, 0xA9, 0xF8, 0xB0, 0x87, 0x01, 0xB7, 0xF0, 0x27, 0xB0, 0x87, 0x0B, 0xF0,
+	0xF0, 0xF0, 0x80, 0x83, 0x06, 0xF0, 0xF0, 0x07, 0x06, 0xF0, 0x35, 0x10, 0x07, 0x06, 0xF0, 0x26,
+	0x10, 0x07, 0x16, 0xF0, 0x15, 0x20, 0x05, 0x17, 0xE6, 0x20, 0x05, 0x26, 0xD6, 0x30, 0x05, 0x36,
+	0xC6, 0x30, 0x05, 0x36, 0xB6, 0x40, 0x05, 0x46, 0xA5, 0x50, 0x05, 0x47, 0x86, 0x50, 0x05, 0x56,
+	0x76, 0x60, 0x05, 0x66, 0x66, 0x60, 0x05, 0x66, 0x56, 0x70, 0x05, 0x76, 0x45, 0x80, 0x05, 0x76,
+	0x36, 0x80, 0x05, 0x86, 0x25, 0x90, 0x03, 0x9C, 0x90, 0x03, 0x9B, 0xA0, 0x83, 0x01, 0xA9, 0xB0,
+	0x03, 0xB7, 0xC0, 0x03, 0xB8, 0xB0, 0x03, 0xA9, 0xB0, 0x03, 0x9B, 0xA0, 0x05, 0x95, 0x16, 0x90,
+	0x05, 0x86, 0x16, 0x90, 0x05, 0x85, 0x36, 0x80, 0x05, 0x76, 0x36, 0x80, 0x05, 0x66, 0x56, 0x70,
+	0x05, 0x66, 0x66, 0x60, 0x05, 0x56, 0x76, 0x60, 0x05, 0x55, 0x96, 0x50, 0x05, 0x46, 0x96, 0x50,
+	0x85, 0x01, 0x36, 0xB6, 0x40, 0x05, 0x26, 0xD6, 0x30, 0x05, 0x25, 0xF6, 0x20, 0x05, 0x16, 0xF6,
+	0x20, 0x87, 0x01, 0x06, 0xF0, 0x26, 0x10, 0x06, 0x05, 0xF0, 0x46, 0x83, 0x0B, 0xF0, 0xF0, 0x83,
+	0x06, 0xF0, 0xE0, 0x86, 0x01, 0x06, 0xF0, 0x26, 0x85, 0x01, 0x16, 0xF6, 0x10, 0x85, 0x01, 0x26,
+	0xD6, 0x20, 0x85, 0x01, 0x36, 0xB6, 0x30, 0x85, 0x01, 0x46, 0x96, 0x40, 0x85, 0x01, 0x56, 0x76,
+	0x50, 0x05, 0x66, 0x65, 0x60, 0x05, 0x66, 0x56, 0x60, 0x05, 0x76, 0x45, 0x70, 0x05, 0x76, 0x36,
+	0x70, 0x05, 0x85, 0x35, 0x80, 0x05, 0x86, 0x16, 0x80, 0x05, 0x95, 0x15, 0x90, 0x03, 0x9B, 0x90,
+	0x03, 0xA9, 0xA0, 0x83, 0x01, 0xB7, 0xB0, 0x83, 0x10, 0xC5, 0xC0, 0x83, 0x0B, 0xF0, 0xE0, 0x83,
+	0x06, 0xF0, 0xC0, 0x05, 0x1F, 0x09, 0x20, 0x85, 0x02, 0x0F, 0x0B, 0x10, 0x05, 0x1F, 0x0A, 0x10,
+	0x05, 0xF0, 0x55, 0x20, 0x05, 0xF0, 0x46, 0x20, 0x05, 0xF0, 0x36, 0x30, 0x05, 0xF0, 0x35, 0x40,
+	0x05, 0xF0, 0x26, 0x40, 0x05, 0xF0, 0x16, 0x50, 0x05, 0xF0, 0x15, 0x60, 0x03, 0xF6, 0x60, 0x03,
+	0xE6, 0x70, 0x03, 0xE5, 0x80, 0x03, 0xD6, 0x80, 0x03, 0xC6, 0x90, 0x03, 0xC5, 0xA0, 0x03, 0xB6,
+	0xA0, 0x03, 0xA6, 0xB0, 0x03, 0xA5, 0xC0, 0x03, 0x96, 0xC0, 0x03, 0x86, 0xD0, 0x03, 0x85, 0xE0,
+	0x03, 0x76, 0xE0, 0x03, 0x66, 0xF0, 0x85, 0x01, 0x56, 0xF0, 0x10, 0x05, 0x46, 0xF0, 0x20, 0x85,
+	0x01, 0x36, 0xF0, 0x30, 0x05, 0x26, 0xF0, 0x40, 0x85, 0x01, 0x16, 0xF0, 0x50, 0x05, 0x06, 0xF0,
+	0x60, 0x05, 0x0F, 0x0B, 0x10, 0x84, 0x02, 0x0F, 0x0C, 0x05, 0x0F, 0x0B, 0x10, 0x83, 0x0B, 0xF0,
+	0xC0, 0x81, 0x02, 0xB0, 0x02, 0x1A, 0x82, 0x02, 0x0B, 0x83, 0x2D, 0x05, 0x60, 0x82, 0x02, 0x0B,
+	0x02, 0x1A, 0x81, 0x01, 0xB0, 0x03, 0xF0, 0xA0, 0x05, 0x05, 0xF0, 0x50, 0x85, 0x02, 0x15, 0xF0,
+	0x40, 0x85, 0x01, 0x25, 0xF0, 0x30, 0x05, 0x26, 0xF0, 0x20, 0x85, 0x01, 0x35, 0xF0, 0x20, 0x05,
+	0x36, 0xF0, 0x10, 0x85, 0x01, 0x45, 0xF0, 0x10, 0x03, 0x46, 0xF0, 0x83, 0x01, 0x55, 0xF0, 0x83,
+	0x01, 0x65, 0xE0, 0x03, 0x66, 0xD0, 0x83, 0x01, 0x75, 0xD0, 0x03, 0x76, 0xC0, 0x83, 0x01, 0x85,
+	0xC0, 0x03, 0x86, 0xB0, 0x83, 0x01, 0x95, 0xB0, 0x83, 0x02, 0xA5, 0xA0, 0x83, 0x01, 0xB5, 0x90,
+	0x03, 0xB6, 0x80, 0x83, 0x01, 0xC5, 0x80, 0x03, 0xC6, 0x70, 0x83, 0x01, 0xD5, 0x70, 0x03, 0xD6,
+	0x60, 0x83, 0x01, 0xE5, 0x60, 0x83, 0x01, 0xF5, 0x50, 0x03, 0xF6, 0x40, 0x85, 0x01, 0xF0, 0x15,
+	0x40, 0x05, 0xF0, 0x16, 0x30, 0x85, 0x01, 0xF0, 0x25, 0x30, 0x05, 0xF0, 0x26, 0x20, 0x85, 0x01,
+	0xF0, 0x35, 0x20, 0x85, 0x01, 0xF0, 0x45, 0x10, 0x04, 0xF0, 0x46, 0x04, 0xF0, 0x55, 0x83, 0x02,
+	0xF0, 0xA0, 0x81, 0x02, 0xB0, 0x03, 0x0A, 0x10, 0x82, 0x02, 0x0B, 0x82, 0x2D, 0x65, 0x82, 0x02,
+	0x0B, 0x03, 0x0A, 0x10, 0x81, 0x01, 0xB0, 0x83, 0x06, 0xF0, 0xA0, 0x03, 0xA6, 0x90, 0x03, 0x97,
+	0x90, 0x03, 0x98, 0x80, 0x03, 0x89, 0x80, 0x03, 0x8A, 0x70, 0x05, 0x84, 0x15, 0x70, 0x05, 0x75,
+	0x15, 0x70, 0x05, 0x75, 0x25, 0x60, 0x05, 0x65, 0x35, 0x60, 0x05, 0x65, 0x45, 0x50, 0x05, 0x55,
+	0x55, 0x50, 0x05, 0x55, 0x56, 0x40, 0x05, 0x46, 0x65, 0x40, 0x05, 0x45, 0x76, 0x30, 0x05, 0x45,
+	0x85, 0x30, 0x05, 0x35, 0x96, 0x20, 0x05, 0x35, 0xA5, 0x20, 0x05, 0x26, 0xA5, 0x20, 0x05, 0x25,
+	0xB6, 0x10, 0x05, 0x16, 0xC5, 0x10, 0x04, 0x15, 0xD6, 0x04, 0x06, 0xE5, 0x04, 0x05, 0xF5, 0x83,
+	0x1C, 0xF0, 0xA0, 0x85, 0x36, 0xF0, 0xF0, 0x20, 0x86, 0x03, 0x0F, 0x0F, 0x02, 0x81, 0x02, 0xA0,
+	0x03, 0x05, 0x50, 0x03, 0x06, 0x40, 0x03, 0x15, 0x40, 0x83, 0x01, 0x25, 0x30, 0x03, 0x35, 0x20,
+	0x03, 0x45, 0x10, 0x03, 0x54, 0x10, 0x02, 0x55, 0x02, 0x64, 0x81, 0x2D, 0xA0, 0x83, 0x0F, 0xF0,
+	0x80, 0x03, 0x79, 0x70, 0x05, 0x3F, 0x01, 0x40, 0x05, 0x2F, 0x03, 0x30, 0x05, 0x1F, 0x05, 0x20,
+	0x05, 0x17, 0x77, 0x10, 0x05, 0x14, 0xB6, 0x10, 0x04, 0x12, 0xE6, 0x84, 0x05, 0xF0, 0x35, 0x02,
+	0x9E, 0x04, 0x6F, 0x02, 0x04, 0x4F, 0x04, 0x04, 0x2F, 0x06, 0x04, 0x27, 0x95, 0x04, 0x16, 0xB5,
+	0x04, 0x15, 0xC5, 0x84, 0x03, 0x05, 0xD5, 0x04, 0x05, 0xC6, 0x04, 0x06, 0xA7, 0x04, 0x15, 0x98,
+	0x06, 0x17, 0x55, 0x14, 0x04, 0x2F, 0x24, 0x04, 0x3D, 0x34, 0x04, 0x4B, 0x44, 0x03, 0x67, 0xA0,
+	0x83, 0x0A, 0xF0, 0x80, 0x83, 0x03, 0xF0, 0xB0, 0x85, 0x0B, 0x05, 0xF0, 0x60, 0x05, 0x05, 0x67,
+	0x80, 0x05, 0x05, 0x4B, 0x60, 0x05, 0x05, 0x3E, 0x40, 0x07, 0x05, 0x1F, 0x02, 0x30, 0x05, 0x0B,
+	0x57, 0x30, 0x05, 0x09, 0x96, 0x20, 0x05, 0x08, 0xB5, 0x20, 0x05, 0x07, 0xC6, 0x10, 0x85, 0x01,
+	0x06, 0xE5, 0x10, 0x04, 0x05, 0xF6, 0x86, 0x09, 0x05, 0xF0, 0x15, 0x85, 0x01, 0x05, 0xF5, 0x10,
+	0x05, 0x06, 0xE5, 0x10, 0x05, 0x07, 0xC6, 0x10, 0x05, 0x08, 0xA6, 0x20, 0x05, 0x09, 0x96, 0x20,
+	0x07, 0x04, 0x16, 0x57, 0x30, 0x07, 0x04, 0x2F, 0x01, 0x40, 0x05, 0x04, 0x3E, 0x50, 0x05, 0x04,
+	0x4C, 0x60, 0x03, 0xA7, 0x90, 0x83, 0x0A, 0xF0, 0xB0, 0x83, 0x0F, 0xF0, 0x70, 0x03, 0x98, 0x50,
+	0x03, 0x7D, 0x20, 0x05, 0x5F, 0x01, 0x10, 0x04, 0x4F, 0x03, 0x04, 0x37, 0x66, 0x04, 0x35, 0xA4,
+	0x04, 0x25, 0xD2, 0x03, 0x25, 0xF0, 0x85, 0x02, 0x15, 0xF0, 0x10, 0x85, 0x09, 0x05, 0xF0, 0x20,
+	0x05, 0x06, 0xF0, 0x10, 0x85, 0x01, 0x15, 0xF0, 0x10, 0x04, 0x16, 0xD2, 0x04, 0x25, 0xC3, 0x04,
+	0x26, 0xA4, 0x04, 0x37, 0x66, 0x05, 0x4F, 0x02, 0x10, 0x03, 0x5F, 0x20, 0x03, 0x6D, 0x30, 0x03,
+	0x97, 0x60, 0x83, 0x0A, 0xF0, 0x70, 0x83, 0x03, 0xF0, 0xB0, 0x84, 0x0B, 0xF0, 0x65, 0x04, 0x96,
+	0x65, 0x04, 0x6C, 0x35, 0x04, 0x5E, 0x25, 0x06, 0x4F, 0x01, 0x15, 0x04, 0x37, 0x5B, 0x04, 0x26,
+	0x99, 0x04, 0x26, 0xA8, 0x04, 0x16, 0xC7, 0x04, 0x15, 0xE6, 0x84, 0x01, 0x15, 0xF5, 0x86, 0x09,
+	0x05, 0xF0, 0x15, 0x04, 0x06, 0xF5, 0x84, 0x01, 0x15, 0xE6, 0x04, 0x16, 0xC7, 0x04, 0x25, 0xB8,
+	0x04, 0x26, 0x99, 0x06, 0x37, 0x56, 0x14, 0x06, 0x3F, 0x02, 0x24, 0x04, 0x4F, 0x34, 0x04, 0x6B,
+	0x54, 0x03, 0x87, 0xB0, 0x83, 0x0A, 0xF0, 0xB0, 0x83, 0x0F, 0xF0, 0xB0, 0x03, 0xA8, 0x80, 0x03,
+	0x7D, 0x60, 0x05, 0x6F, 0x01, 0x40, 0x05, 0x4F, 0x04, 0x30, 0x05, 0x46, 0x67, 0x30, 0x05, 0x35,
+	0xA6, 0x20, 0x05, 0x25, 0xC6, 0x10, 0x05, 0x25, 0xD5, 0x10, 0x05, 0x15, 0xE5, 0x10, 0x04, 0x15,
+	0xF5, 0x06, 0x14, 0xF0, 0x15, 0x86, 0x01, 0x05, 0xF0, 0x15, 0x84, 0x02, 0x0F, 0x0B, 0x05, 0x0F,
+	0x0A, 0x10, 0x85, 0x03, 0x05, 0xF0, 0x60, 0x05, 0x14, 0xF0, 0x60, 0x85, 0x01, 0x15, 0xF0, 0x50,
+	0x05, 0x16, 0xF0, 0x40, 0x05, 0x26, 0xF0, 0x30, 0x05, 0x27, 0xD3, 0x10, 0x05, 0x38, 0x86, 0x10,
+	0x05, 0x4F, 0x06, 0x10, 0x05, 0x5F, 0x05, 0x10, 0x05, 0x7F, 0x01, 0x30, 0x03, 0xA9, 0x70, 0x83,
+	0x0A, 0xF0, 0xB0, 0x83, 0x02, 0xF0, 0x40, 0x03, 0xA7, 0x20, 0x02, 0x8B, 0x82, 0x01, 0x7C, 0x04,
+	0x66, 0x52, 0x03, 0x65, 0x80, 0x03, 0x56, 0x80, 0x83, 0x06, 0x55, 0x90, 0x85, 0x03, 0x0F, 0x02,
+	0x20, 0x83, 0x19, 0x55, 0x90, 0x83, 0x0B, 0xF0, 0x40, 0x83, 0x0F, 0xF0, 0xC0, 0x03, 0x97, 0xB0,
+	0x04, 0x7F, 0x05, 0x04, 0x5F, 0x07, 0x04, 0x4F, 0x08, 0x04, 0x46, 0x6B, 0x05, 0x36, 0x85, 0x50,
+	0x05, 0x35, 0xA5, 0x40, 0x05, 0x26, 0xB5, 0x30, 0x85, 0x04, 0x25, 0xC5, 0x30, 0x05, 0x25, 0xB6,
+	0x30, 0x05, 0x35, 0xA5, 0x40, 0x05, 0x36, 0x86, 0x40, 0x05, 0x46, 0x66, 0x50, 0x05, 0x4F, 0x03,
+	0x50, 0x05, 0x3F, 0x03, 0x60, 0x05, 0x2F, 0x02, 0x80, 0x05, 0x24, 0x47, 0xA0, 0x85, 0x02, 0x15,
+	0xF0, 0x60, 0x05, 0x17, 0xF0, 0x40, 0x05, 0x2F, 0x02, 0x80, 0x05, 0x2F, 0x06, 0x40, 0x05, 0x3F,
+	0x06, 0x30, 0x05, 0x3F, 0x07, 0x20, 0x05, 0x26, 0xA8, 0x10, 0x04, 0x16, 0xE6, 0x06, 0x15, 0xF0,
+	0x15, 0x86, 0x03, 0x05, 0xF0, 0x25, 0x05, 0x06, 0xF5, 0x10, 0x05, 0x07, 0xD6, 0x10, 0x05, 0x18,
+	0x88, 0x20, 0x05, 0x1F, 0x08, 0x30, 0x05, 0x3F, 0x05, 0x40, 0x05, 0x4F, 0x02, 0x60, 0x03, 0x7B,
+	0x90, 0x83, 0x03, 0xF0, 0x90, 0x85, 0x0B, 0x05, 0xF0, 0x40, 0x05, 0x05, 0x67, 0x60, 0x05, 0x05,
+	0x4B, 0x40, 0x05, 0x05, 0x2E, 0x30, 0x07, 0x05, 0x1F, 0x01, 0x20, 0x05, 0x0B, 0x47, 0x20, 0x05,
+	0x09, 0x86, 0x10, 0x05, 0x08, 0xA5, 0x10, 0x04, 0x07, 0xB6, 0x04, 0x06, 0xD5, 0x84, 0x15, 0x05,
+	0xE5, 0x83, 0x0B, 0xF0, 0x90, 0x81, 0x05, 0x60, 0x03, 0x14, 0x10, 0x82, 0x03, 0x06, 0x03, 0x14,
+	0x10, 0x81, 0x04, 0x60, 0x82, 0x1D, 0x15, 0x81, 0x0B, 0x60, 0x81, 0x05, 0xC0, 0x03, 0x74, 0x10,
+	0x82, 0x03, 0x66, 0x03, 0x74, 0x10, 0x81, 0x04, 0xC0, 0x82, 0x22, 0x75, 0x02, 0x66, 0x03, 0x65,
+	0x10, 0x03, 0x56, 0x10, 0x83, 0x01, 0x0A, 0x20, 0x03, 0x09, 0x30, 0x03, 0x16, 0x50, 0x83, 0x03,
+	0xF0, 0x80, 0x85, 0x0C, 0x05, 0xF0, 0x30, 0x05, 0x05, 0xB6, 0x10, 0x05, 0x05, 0xA7, 0x10, 0x05,
+	0x05, 0x97, 0x20, 0x05, 0x05, 0x96, 0x30, 0x05, 0x05, 0x86, 0x40, 0x05, 0x05, 0x76, 0x50, 0x05,
+	0x05, 0x66, 0x60, 0x05, 0x05, 0x56, 0x70, 0x05, 0x05, 0x46, 0x80, 0x05, 0x05, 0x36, 0x90, 0x05,
+	0x05, 0x25, 0xB0, 0x05, 0x05, 0x15, 0xC0, 0x03, 0x0A, 0xD0, 0x03, 0x0B, 0xC0, 0x05, 0x05, 0x15,
+	0xC0, 0x05, 0x05, 0x25, 0xB0, 0x05, 0x05, 0x26, 0xA0, 0x05, 0x05, 0x36, 0x90, 0x05, 0x05, 0x46,
+	0x80, 0x85, 0x01, 0x05, 0x56, 0x70, 0x05, 0x05, 0x66, 0x60, 0x05, 0x05, 0x76, 0x50, 0x05, 0x05,
+	0x86, 0x40, 0x05, 0x05, 0x87, 0x30, 0x05, 0x05, 0x97, 0x20, 0x05, 0x05, 0xA6, 0x20, 0x05, 0x05,
+	0xB6, 0x10, 0x84, 0x01, 0x05, 0xC6, 0x83, 0x0B, 0xF0, 0x80, 0x81, 0x03, 0x50, 0x82, 0x2A, 0x05,
+	0x81, 0x0B, 0x50, 0x85, 0x0F, 0xF0, 0xF0, 0xC0, 0x05, 0xB6, 0xD6, 0x60, 0x07, 0x04, 0x5B, 0x8A,
+	0x40, 0x07, 0x05, 0x3D, 0x6C, 0x30, 0x07, 0x05, 0x2F, 0x3F, 0x20, 0x0B, 0x05, 0x15, 0x56, 0x25,
+	0x57, 0x10, 0x09, 0x09, 0x86, 0x14, 0x76, 0x10, 0x07, 0x08, 0xA9, 0x95, 0x10, 0x06, 0x07, 0xB8,
+	0xA6, 0x06, 0x06, 0xD6, 0xC5, 0x86, 0x15, 0x05, 0xE5, 0xD5, 0x85, 0x0B, 0xF0, 0xF0, 0xC0, 0x83,
+	0x0F, 0xF0, 0x90, 0x03, 0xB7, 0x60, 0x05, 0x04, 0x5B, 0x40, 0x05, 0x05, 0x3D, 0x30, 0x07, 0x05,
+	0x1F, 0x01, 0x20, 0x07, 0x05, 0x15, 0x47, 0x20, 0x05, 0x09, 0x86, 0x10, 0x05, 0x08, 0xA5, 0x10,
+	0x04, 0x07, 0xB6, 0x04, 0x06, 0xD5, 0x84, 0x15, 0x05, 0xE5, 0x83, 0x0B, 0xF0, 0x90, 0x83, 0x0F,
+	0xF0, 0xD0, 0x03, 0xA9, 0x90, 0x03, 0x7E, 0x70, 0x05, 0x6F, 0x02, 0x50, 0x05, 0x5F, 0x04, 0x40,
+	0x05, 0x47, 0x68, 0x30, 0x05, 0x36, 0xA7, 0x20, 0x05, 0x26, 0xC6, 0x20, 0x05, 0x25, 0xE6, 0x10,
+	0x05, 0x16, 0xF5, 0x10, 0x87, 0x01, 0x15, 0xF0, 0x15, 0x10, 0x86, 0x09, 0x05, 0xF0, 0x35, 0x87,
+	0x02, 0x15, 0xF0, 0x15, 0x10, 0x05, 0x16, 0xE5, 0x20, 0x05, 0x26, 0xC6, 0x20, 0x05, 0x27, 0xA6,
+	0x30, 0x05, 0x38, 0x67, 0x40, 0x05, 0x4F, 0x04, 0x50, 0x05, 0x5F, 0x02, 0x60, 0x03, 0x7E, 0x70,
+	0x03, 0x99, 0xA0, 0x83, 0x0A, 0xF0, 0xD0, 0x83, 0x0F, 0xF0, 0xB0, 0x03, 0xB7, 0x80, 0x05, 0x04,
+	0x5B, 0x60, 0x05, 0x04, 0x4E, 0x40, 0x07, 0x04, 0x2F, 0x02, 0x30, 0x07, 0x04, 0x16, 0x57, 0x30,
+	0x05, 0x09, 0x96, 0x20, 0x05, 0x08, 0xB5, 0x20, 0x05, 0x07, 0xC6, 0x10, 0x85, 0x01, 0x06, 0xE5,
+	0x10, 0x04, 0x05, 0xF6, 0x86, 0x09, 0x05, 0xF0, 0x15, 0x85, 0x01, 0x05, 0xF5, 0x10, 0x05, 0x06,
+	0xE5, 0x10, 0x05, 0x07, 0xC6, 0x10, 0x05, 0x08, 0xA6, 0x20, 0x05, 0x09, 0x87, 0x20, 0x05, 0x0B,
+	0x57, 0x30, 0x07, 0x05, 0x1F, 0x01, 0x40, 0x05, 0x05, 0x2E, 0x50, 0x05, 0x05, 0x3C, 0x60, 0x05,
+	0x05, 0x57, 0x90, 0x85, 0x0A, 0x05, 0xF0, 0x60, 0x83, 0x0F, 0xF0, 0xB0, 0x03, 0x96, 0xB0, 0x04,
+	0x6C, 0x44, 0x04, 0x5E, 0x34, 0x06, 0x4F, 0x01, 0x24, 0x06, 0x37, 0x56, 0x14, 0x04, 0x26, 0x99,
+	0x04, 0x26, 0xA8, 0x04, 0x16, 0xC7, 0x04, 0x15, 0xE6, 0x84, 0x01, 0x15, 0xF5, 0x86, 0x09, 0x05,
+	0xF0, 0x15, 0x04, 0x06, 0xF5, 0x84, 0x01, 0x15, 0xE6, 0x04, 0x16, 0xC7, 0x04, 0x25, 0xB8, 0x04,
+	0x26, 0x99, 0x04, 0x37, 0x5B, 0x06, 0x3F, 0x02, 0x15, 0x04, 0x4E, 0x35, 0x04, 0x6B, 0x45, 0x04,
+	0x87, 0x65, 0x84, 0x0A, 0xF0, 0x65, 0x83, 0x0F, 0xF0, 0x10, 0x03, 0xA5, 0x10, 0x04, 0x04, 0x48,
+	0x04, 0x05, 0x29, 0x84, 0x01, 0x05, 0x1A, 0x04, 0x0A, 0x42, 0x03, 0x09, 0x70, 0x03, 0x08, 0x80,
+	0x03, 0x07, 0x90, 0x83, 0x01, 0x06, 0xA0, 0x83, 0x13, 0x05, 0xB0, 0x83, 0x0B, 0xF0, 0x10, 0x83,
+	0x0F, 0xF0, 0x50, 0x03, 0x78, 0x50, 0x03, 0x5D, 0x20, 0x03, 0x4F, 0x10, 0x05, 0x3F, 0x01, 0x10,
+	0x05, 0x26, 0x74, 0x10, 0x05, 0x25, 0xA2, 0x10, 0x83, 0x03, 0x15, 0xE0, 0x03, 0x16, 0xD0, 0x03,
+	0x17, 0xC0, 0x03, 0x27, 0xB0, 0x03, 0x29, 0x90, 0x03, 0x3B, 0x60, 0x03, 0x5B, 0x40, 0x03, 0x6B,
+	0x30, 0x03, 0x8A, 0x20, 0x03, 0xB8, 0x10, 0x03, 0xD6, 0x10, 0x02, 0xE6, 0x82, 0x03, 0xF5, 0x04,
+	0x02, 0xC6, 0x05, 0x04, 0xA5, 0x10, 0x05, 0x06, 0x67, 0x10, 0x05, 0x0F, 0x03, 0x20, 0x05, 0x1F,
+	0x01, 0x30, 0x03, 0x2E, 0x40, 0x03, 0x58, 0x70, 0x83, 0x0A, 0xF0, 0x50, 0x83, 0x08, 0xF0, 0x30,
+	0x83, 0x07, 0x55, 0x80, 0x84, 0x03, 0x0F, 0x03, 0x83, 0x14, 0x55, 0x80, 0x03, 0x56, 0x70, 0x04,
+	0x66, 0x42, 0x02, 0x6C, 0x02, 0x7B, 0x02, 0x8A, 0x03, 0xA6, 0x20, 0x83, 0x0A, 0xF0, 0x30, 0x83,
+	0x10, 0xF0, 0x90, 0x84, 0x14, 0x05, 0xE5, 0x84, 0x01, 0x05, 0xD6, 0x04, 0x06, 0xB7, 0x04, 0x15,
+	0xA8, 0x04, 0x16, 0x89, 0x06, 0x27, 0x45, 0x15, 0x06, 0x2F, 0x01, 0x15, 0x04, 0x3D, 0x35, 0x04,
+	0x4B, 0x54, 0x03, 0x67, 0xB0, 0x83, 0x0A, 0xF0, 0x90, 0x83, 0x10, 0xF0, 0xC0, 0x06, 0x15, 0xF0,
+	0x15, 0x06, 0x06, 0xF0, 0x15, 0x04, 0x15, 0xF6, 0x05, 0x16, 0xE5, 0x10, 0x05, 0x25, 0xE5, 0x10,
+	0x05, 0x25, 0xD6, 0x10, 0x05, 0x26, 0xC5, 0x20, 0x05, 0x35, 0xC5, 0x20, 0x05, 0x36, 0xA6, 0x20,
+	0x05, 0x36, 0xA5, 0x30, 0x05, 0x45, 0xA5, 0x30, 0x05, 0x46, 0x86, 0x30, 0x05, 0x46, 0x85, 0x40,
+	0x05, 0x55, 0x85, 0x40, 0x05, 0x56, 0x66, 0x40, 0x05, 0x56, 0x65, 0x50, 0x05, 0x65, 0x65, 0x50,
+	0x05, 0x66, 0x45, 0x60, 0x85, 0x01, 0x75, 0x45, 0x60, 0x05, 0x76, 0x25, 0x70, 0x85, 0x01, 0x85,
+	0x25, 0x70, 0x03, 0x8B, 0x80, 0x83, 0x01, 0x9A, 0x80, 0x03, 0x99, 0x90, 0x03, 0xA8, 0x90, 0x03,
+	0xA7, 0xA0, 0x03, 0xB6, 0xA0, 0x83, 0x0B, 0xF0, 0xC0, 0x85, 0x10, 0xF0, 0xF0, 0xC0, 0x06, 0x05,
+	0xE5, 0xD5, 0x86, 0x01, 0x06, 0xC6, 0xD5, 0x06, 0x15, 0xC6, 0xC6, 0x07, 0x15, 0xC7, 0xB5, 0x10,
+	0x07, 0x16, 0xA8, 0xB5, 0x10, 0x07, 0x25, 0xA8, 0xB5, 0x10, 0x07, 0x25, 0xA9, 0x95, 0x20, 0x07,
+	0x26, 0x8A, 0x95, 0x20, 0x07, 0x35, 0x8A, 0x95, 0x20, 0x09, 0x35, 0x84, 0x25, 0x76, 0x20, 0x09,
+	0x36, 0x74, 0x25, 0x75, 0x30, 0x09, 0x36, 0x65, 0x25, 0x75, 0x30, 0x09, 0x45, 0x65, 0x25, 0x75,
+	0x30, 0x09, 0x45, 0x64, 0x45, 0x55, 0x40, 0x09, 0x46, 0x54, 0x45, 0x55, 0x40, 0x09, 0x55, 0x45,
+	0x45, 0x55, 0x40, 0x09, 0x55, 0x44, 0x65, 0x35, 0x50, 0x09, 0x56, 0x34, 0x65, 0x35, 0x50, 0x09,
+	0x65, 0x25, 0x65, 0x35, 0x50, 0x09, 0x65, 0x25, 0x74, 0x25, 0x60, 0x09, 0x66, 0x14, 0x85, 0x15,
+	0x60, 0x09, 0x75, 0x14, 0x85, 0x15, 0x60, 0x07, 0x7A, 0x85, 0x15, 0x60, 0x05, 0x7A, 0x99, 0x70,
+	0x05, 0x79, 0xA9, 0x70, 0x05, 0x88, 0xA9, 0x70, 0x85, 0x01, 0x88, 0xB7, 0x80, 0x05, 0x96, 0xC6,
+	0x90, 0x85, 0x0B, 0xF0, 0xF0, 0xC0, 0x83, 0x10, 0xF0, 0xA0, 0x05, 0x06, 0xD5, 0x10, 0x05, 0x06,
+	0xC6, 0x10, 0x05, 0x16, 0xB5, 0x20, 0x05, 0x26, 0x96, 0x20, 0x05, 0x26, 0x95, 0x30, 0x05, 0x36,
+	0x75, 0x40, 0x05, 0x45, 0x66, 0x40, 0x05, 0x46, 0x55, 0x50, 0x05, 0x56, 0x36, 0x50, 0x05, 0x56,
+	0x26, 0x60, 0x05, 0x66, 0x15, 0x70, 0x03, 0x7B, 0x70, 0x03, 0x7A, 0x80, 0x03, 0x88, 0x90, 0x03,
+	0x97, 0x90, 0x03, 0x88, 0x90, 0x03, 0x89, 0x80, 0x03, 0x7B, 0x70, 0x03, 0x6C, 0x70, 0x05, 0x65,
+	0x26, 0x60, 0x05, 0x55, 0x45, 0x60, 0x05, 0x46, 0x46, 0x50, 0x05, 0x45, 0x66, 0x40, 0x05, 0x36,
+	0x66, 0x40, 0x05, 0x26, 0x86, 0x30, 0x05, 0x25, 0xA6, 0x20, 0x05, 0x16, 0xA6, 0x20, 0x05, 0x15,
+	0xC6, 0x10, 0x05, 0x06, 0xC6, 0x10, 0x04, 0x05, 0xE6, 0x83, 0x0B, 0xF0, 0xA0, 0x83, 0x10, 0xF0,
+	0xC0, 0x06, 0x05, 0xF0, 0x25, 0x04, 0x06, 0xF6, 0x05, 0x06, 0xF5, 0x10, 0x05, 0x15, 0xF5, 0x10,
+	0x05, 0x16, 0xD6, 0x10, 0x05, 0x25, 0xD5, 0x20, 0x05, 0x26, 0xC5, 0x20, 0x05, 0x26, 0xB6, 0x20,
+	0x05, 0x35, 0xB5, 0x30, 0x05, 0x36, 0xA5, 0x30, 0x05, 0x36, 0x96, 0x30, 0x05, 0x45, 0x95, 0x40,
+	0x05, 0x46, 0x85, 0x40, 0x05, 0x55, 0x76, 0x40, 0x05, 0x55, 0x75, 0x50, 0x05, 0x56, 0x65, 0x50,
+	0x85, 0x01, 0x65, 0x55, 0x60, 0x05, 0x66, 0x45, 0x60, 0x05, 0x75, 0x35, 0x70, 0x05, 0x76, 0x25,
+	0x70, 0x05, 0x85, 0x25, 0x70, 0x05, 0x85, 0x15, 0x80, 0x03, 0x8B, 0x80, 0x03, 0x9A, 0x80, 0x83,
+	0x01, 0x99, 0x90, 0x83, 0x01, 0xA7, 0xA0, 0x03, 0xB6, 0xA0, 0x83, 0x01, 0xB5, 0xB0, 0x03, 0xA6,
+	0xB0, 0x83, 0x01, 0xA5, 0xC0, 0x03, 0x96, 0xC0, 0x03, 0x95, 0xD0, 0x83, 0x01, 0x86, 0xD0, 0x03,
+	0x85, 0xE0, 0x03, 0x76, 0xE0, 0x03, 0x75, 0xF0, 0x83, 0x10, 0xF0, 0x50, 0x05, 0x1F, 0x03, 0x10,
+	0x85, 0x01, 0x0F, 0x04, 0x10, 0x05, 0x1F, 0x03, 0x10, 0x03, 0xD6, 0x10, 0x03, 0xD5, 0x20, 0x03,
+	0xC6, 0x20, 0x03, 0xB6, 0x30, 0x03, 0xB5, 0x40, 0x03, 0xA6, 0x40, 0x03, 0xA5, 0x50, 0x03, 0x95,
+	0x60, 0x03, 0x86, 0x60, 0x03, 0x85, 0x70, 0x03, 0x76, 0x70, 0x03, 0x75, 0x80, 0x03, 0x65, 0x90,
+	0x03, 0x56, 0x90, 0x03, 0x55, 0xA0, 0x03, 0x46, 0xA0, 0x03, 0x36, 0xB0, 0x03, 0x35, 0xC0, 0x03,
+	0x26, 0xC0, 0x03, 0x25, 0xD0, 0x03, 0x16, 0xD0, 0x03, 0x06, 0xE0, 0x84, 0x03, 0x0F, 0x05, 0x83,
+	0x0B, 0xF0, 0x50, 0x81, 0x02, 0xF0, 0x02, 0x96, 0x02, 0x87, 0x02, 0x78, 0x02, 0x69, 0x83, 0x01,
+	0x65, 0x40, 0x83, 0x0E, 0x55, 0x50, 0x83, 0x01, 0x45, 0x60, 0x03, 0x26, 0x70, 0x03, 0x07, 0x80,
+	0x83, 0x01, 0x06, 0x90, 0x03, 0x07, 0x80, 0x03, 0x26, 0x70, 0x83, 0x01, 0x45, 0x60, 0x83, 0x10,
+	0x55, 0x50, 0x83, 0x01, 0x65, 0x40, 0x02, 0x69, 0x02, 0x78, 0x02, 0x87, 0x02, 0x96, 0x81, 0x01,
+	0xF0, 0x81, 0x01, 0x50, 0x82, 0x38, 0x05, 0x81, 0x02, 0xF0, 0x03, 0x06, 0x90, 0x03, 0x07, 0x80,
+	0x03, 0x08, 0x70, 0x03, 0x09, 0x60, 0x83, 0x01, 0x45, 0x60, 0x03, 0x54, 0x60, 0x83, 0x0E, 0x55,
+	0x50, 0x03, 0x65, 0x40, 0x03, 0x66, 0x30, 0x02, 0x78, 0x82, 0x01, 0x96, 0x02, 0x87, 0x03, 0x76,
+	0x20, 0x83, 0x01, 0x65, 0x40, 0x03, 0x64, 0x50, 0x83, 0x0D, 0x55, 0x50, 0x83, 0x01, 0x54, 0x60,
+	0x83, 0x01, 0x45, 0x60, 0x03, 0x09, 0x60, 0x03, 0x08, 0x70, 0x03, 0x07, 0x80, 0x03, 0x06, 0x90,
+	0x81, 0x01, 0xF0, 0x83, 0x0B, 0xF0, 0xD0, 0x05, 0x56, 0xF0, 0x20, 0x04, 0x3A, 0xB4, 0x04, 0x2C,
+	0xA4, 0x04, 0x1E, 0x94, 0x06, 0x15, 0x46, 0x84, 0x06, 0x05, 0x66, 0x65, 0x07, 0x04, 0x86, 0x45,
+	0x10, 0x05, 0x04, 0x9E, 0x10, 0x05, 0x04, 0xAC, 0x20, 0x05, 0x04, 0xBA, 0x30, 0x05, 0xF0, 0x26,
+	0x50, 0x83, 0x23, 0xF0, 0xD0,
+};
+
+char_info_t font59_rle_info[] = {
+	{2, 0}, 		/*   */ 
+	{7, 3}, 		/* ! */ 
+	{17, 29}, 		/* " */ 
+	{30, 59}, 		/* # */ 
+	{26, 162}, 		/* $ */ 
+	{40, 305}, 		/* % */ 
+	{38, 514}, 		/* & */ 
+	{6, 695}, 		/* ' */ 
+	{11, 713}, 		/* ( */ 
+	{11, 800}, 		/* ) */ 
+	{22, 883}, 		/* * */ 
+	{28, 960}, 		/* + */ 
+	{11, 988}, 		/* , */ 
+	{15, 1027}, 		/* - */ 
+	{7, 1036}, 		/* . */ 
+	{24, 1057}, 		/* / */ 
+	{28, 1177}, 		/* 0 */ 
+	{23, 1283}, 		/* 1 */ 
+	{25, 1337}, 		/* 2 */ 
+	{25, 1455}, 		/* 3 */ 
+	{29, 1583}, 		/* 4 */ 
+	{26, 1689}, 		/* 5 */ 
+	{27, 1783}, 		/* 6 */ 
+	{26, 1922}, 		/* 7 */ 
+	{27, 2033}, 		/* 8 */ 
+	{27, 2170}, 		/* 9 */ 
+	{7, 2313}, 		/* : */ 
+	{10, 2340}, 		/* ; */ 
+	{27, 2388}, 		/* < */ 
+	{26, 2494}, 		/* = */ 
+	{27, 2514}, 		/* > */ 
+	{22, 2624}, 		/* ? */ 
+	{46, 2713}, 		/* @ */ 
+	{35, 2958}, 		/* A */ 
+	{27, 3108}, 		/* B */ 
+	{29, 3233}, 		/* C */ 
+	{31, 3347}, 		/* D */ 
+	{23, 3474}, 		/* E */ 
+	{21, 3511}, 		/* F */ 
+	{33, 3541}, 		/* G */ 
+	{29, 3680}, 		/* H */ 
+	{5, 3702}, 		/* I */ 
+	{15, 3711}, 		/* J */ 
+	{26, 3740}, 		/* K */ 
+	{21, 3904}, 		/* L */ 
+	{44, 3924}, 		/* M */ 
+	{31, 4112}, 		/* N */ 
+	{36, 4242}, 		/* O */ 
+	{25, 4390}, 		/* P */ 
+	{41, 4479}, 		/* Q */ 
+	{27, 4653}, 		/* R */ 
+	{25, 4784}, 		/* S */ 
+	{29, 4916}, 		/* T */ 
+	{30, 4932}, 		/* U */ 
+	{34, 4994}, 		/* V */ 
+	{53, 5146}, 		/* W */ 
+	{30, 5347}, 		/* X */ 
+	{29, 5503}, 		/* Y */ 
+	{27, 5583}, 		/* Z */ 
+	{11, 5713}, 		/* [ */ 
+	{25, 5733}, 		/* \ */ 
+	{11, 5874}, 		/* ] */ 
+	{25, 5895}, 		/* ^ */ 
+	{32, 5987}, 		/* _ */ 
+	{10, 5997}, 		/* ` */ 
+	{23, 6029}, 		/* a */ 
+	{26, 6116}, 		/* b */ 
+	{22, 6217}, 		/* c */ 
+	{26, 6294}, 		/* d */ 
+	{26, 6376}, 		/* e */ 
+	{19, 6483}, 		/* f */ 
+	{27, 6521}, 		/* g */ 
+	{24, 6657}, 		/* h */ 
+	{6, 6709}, 		/* i */ 
+	{12, 6730}, 		/* j */ 
+	{23, 6766}, 		/* k */ 
+	{5, 6890}, 		/* l */ 
+	{42, 6899}, 		/* m */ 
+	{24, 6959}, 		/* n */ 
+	{28, 7006}, 		/* o */ 
+	{26, 7095}, 		/* p */ 
+	{26, 7192}, 		/* q */ 
+	{16, 7270}, 		/* r */ 
+	{20, 7311}, 		/* s */ 
+	{18, 7404}, 		/* t */ 
+	{24, 7439}, 		/* u */ 
+	{27, 7481}, 		/* v */ 
+	{42, 7593}, 		/* w */ 
+	{25, 7750}, 		/* x */ 
+	{27, 7869}, 		/* y */ 
+	{20, 8008}, 		/* z */ 
+	{15, 8099}, 		/* { */ 
+	{5, 8161}, 		/* | */ 
+	{15, 8167}, 		/* } */ 
+	{28, 8243}, 		/* ~ */ 
+};
+
+/**
+ * @brief 89 pixels height run-length compressed data array.
+ */
+const uint8_t font89_rle_data[] = {
+	0x81, 0x58, 0x20, 0x81, 0x06, 0xA0, 0x03, 0x27, 0x10, 0x82, 0x09, 0x19, 0x83, 0x0C, 0x18, 0x10,
+	0x83, 0x17, 0x27, 0x10, 0x03, 0x26, 0x20, 0x81, 0x05, 0xA0, 0x03, 0x26, 0x20, 0x82, 0x02, 0x19,
+	0x82, 0x02, 0x0A, 0x82, 0x02, 0x19, 0x03, 0x26, 0x20, 0x81, 0x0F, 0xA0, 0x83, 0x05, 0xF0, 0x90,
+	0x04, 0x07, 0xA7, 0x84, 0x01, 0x08, 0x88, 0x84, 0x05, 0x07, 0x98, 0x84, 0x06, 0x07, 0xA7, 0x85,
+	0x05, 0x07, 0xA6, 0x10, 0x05, 0x16, 0xA6, 0x10, 0x05, 0x15, 0xB6, 0x10, 0x05, 0x15, 0xC5, 0x10,
+	0x83, 0x39, 0xF0, 0x90, 0x85, 0x0A, 0xF0, 0xF0, 0xE0, 0x05, 0xD6, 0xD7, 0x50, 0x85, 0x03, 0xC7,
+	0xD7, 0x50, 0x05, 0xC7, 0xC7, 0x60, 0x85, 0x06, 0xB7, 0xD7, 0x60, 0x05, 0xB6, 0xD7, 0x70, 0x85,
+	0x01, 0xA7, 0xD7, 0x70, 0x07, 0x3F, 0x0F, 0x0A, 0x10, 0x86, 0x03, 0x2F, 0x0F, 0x0C, 0x06, 0x3F,
+	0x0F, 0x0B, 0x85, 0x06, 0x97, 0xD7, 0x80, 0x05, 0x96, 0xE6, 0x90, 0x85, 0x07, 0x87, 0xD7, 0x90,
+	0x87, 0x05, 0x0F, 0x0F, 0x0B, 0x30, 0x05, 0x77, 0xD7, 0xA0, 0x05, 0x77, 0xD6, 0xB0, 0x85, 0x06,
+	0x67, 0xD7, 0xB0, 0x05, 0x67, 0xD6, 0xC0, 0x85, 0x05, 0x57, 0xD7, 0xC0, 0x05, 0x56, 0xE6, 0xD0,
+	0x85, 0x10, 0xF0, 0xF0, 0xE0, 0x85, 0x03, 0xF0, 0x56, 0xD0, 0x85, 0x02, 0xF0, 0x47, 0xD0, 0x85,
+	0x03, 0xF0, 0x46, 0xE0, 0x03, 0xFC, 0xC0, 0x05, 0xBF, 0x05, 0x80, 0x05, 0x9F, 0x09, 0x60, 0x05,
+	0x8F, 0x0C, 0x40, 0x05, 0x6F, 0x0E, 0x40, 0x07, 0x5F, 0x0F, 0x01, 0x30, 0x07, 0x4F, 0x0F, 0x02,
+	0x30, 0x05, 0x4C, 0xAA, 0x30, 0x07, 0x3A, 0xF0, 0x17, 0x30, 0x07, 0x39, 0xF0, 0x45, 0x30, 0x07,
+	0x29, 0xF0, 0x72, 0x40, 0x85, 0x02, 0x28, 0xF0, 0xE0, 0x85, 0x02, 0x19, 0xF0, 0xE0, 0x85, 0x01,
+	0x28, 0xF0, 0xE0, 0x85, 0x01, 0x29, 0xF0, 0xD0, 0x05, 0x2A, 0xF0, 0xC0, 0x05, 0x3B, 0xF0, 0xA0,
+	0x05, 0x3C, 0xF0, 0x90, 0x05, 0x4D, 0xF0, 0x70, 0x05, 0x5F, 0xF0, 0x40, 0x07, 0x6F, 0x02, 0xF0,
+	0x10, 0x05, 0x7F, 0x03, 0xE0, 0x05, 0x8F, 0x05, 0xB0, 0x05, 0xAF, 0x05, 0x90, 0x05, 0xCF, 0x05,
+	0x70, 0x05, 0xEF, 0x04, 0x60, 0x07, 0xF0, 0x2F, 0x03, 0x40, 0x07, 0xF0, 0x4F, 0x02, 0x30, 0x05,
+	0xF0, 0x7E, 0x30, 0x05, 0xF0, 0x9D, 0x20, 0x05, 0xF0, 0xBC, 0x10, 0x05, 0xF0, 0xDA, 0x10, 0x84,
+	0x01, 0xF0, 0xEA, 0x84, 0x01, 0xF0, 0xF9, 0x86, 0x04, 0xF0, 0xF0, 0x18, 0x84, 0x01, 0xF0, 0xF9,
+	0x05, 0xF0, 0xE9, 0x10, 0x07, 0x12, 0xF0, 0xAA, 0x10, 0x07, 0x05, 0xF0, 0x7A, 0x20, 0x07, 0x08,
+	0xF0, 0x3B, 0x20, 0x05, 0x0C, 0xBD, 0x30, 0x07, 0x0F, 0x0F, 0x05, 0x40, 0x07, 0x0F, 0x0F, 0x04,
+	0x50, 0x07, 0x1F, 0x0F, 0x02, 0x60, 0x05, 0x2F, 0x0F, 0x70, 0x05, 0x3F, 0x0C, 0x90, 0x05, 0x6F,
+	0x06, 0xC0, 0x05, 0xBC, 0xF0, 0x10, 0x05, 0xD6, 0xF0, 0x50, 0x85, 0x02, 0xC7, 0xF0, 0x50, 0x85,
+	0x05, 0xC6, 0xF0, 0x60, 0x05, 0xC5, 0xF0, 0x70, 0x85, 0x05, 0xF0, 0xF0, 0x90, 0x89, 0x09, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0xF0, 0xF0, 0x46, 0x70, 0x09, 0x98, 0xF0, 0xF0, 0x17, 0x70,
+	0x07, 0x7D, 0xF0, 0xC7, 0x80, 0x09, 0x5F, 0x01, 0xF0, 0xB7, 0x80, 0x09, 0x4F, 0x03, 0xF0, 0x97,
+	0x90, 0x09, 0x3F, 0x05, 0xF0, 0x77, 0xA0, 0x09, 0x37, 0x68, 0xF0, 0x67, 0xA0, 0x09, 0x27, 0x87,
+	0xF0, 0x57, 0xB0, 0x09, 0x17, 0xA7, 0xF0, 0x37, 0xC0, 0x09, 0x17, 0xA7, 0xF0, 0x28, 0xC0, 0x09,
+	0x16, 0xC6, 0xF0, 0x27, 0xD0, 0x07, 0x16, 0xC7, 0xF7, 0xE0, 0x07, 0x07, 0xC7, 0xE8, 0xE0, 0x07,
+	0x07, 0xC7, 0xE7, 0xF0, 0x09, 0x07, 0xC7, 0xD7, 0xF0, 0x10, 0x89, 0x01, 0x07, 0xC7, 0xC7, 0xF0,
+	0x20, 0x09, 0x07, 0xC7, 0xB7, 0xF0, 0x30, 0x89, 0x01, 0x07, 0xC7, 0xA7, 0xF0, 0x40, 0x09, 0x07,
+	0xC7, 0x97, 0xF0, 0x50, 0x09, 0x07, 0xC7, 0x87, 0xF0, 0x60, 0x09, 0x07, 0xC6, 0x97, 0xF0, 0x60,
+	0x09, 0x16, 0xC6, 0x87, 0xF0, 0x70, 0x09, 0x17, 0xA7, 0x77, 0xF0, 0x80, 0x09, 0x17, 0xA7, 0x68,
+	0xF0, 0x80, 0x09, 0x27, 0x87, 0x77, 0xF0, 0x90, 0x09, 0x28, 0x67, 0x77, 0xF0, 0xA0, 0x09, 0x3F,
+	0x05, 0x67, 0xF0, 0xB0, 0x09, 0x4F, 0x03, 0x77, 0xF0, 0xB0, 0x09, 0x5F, 0x01, 0x77, 0xF0, 0xC0,
+	0x07, 0x6D, 0x87, 0xB8, 0x90, 0x07, 0x98, 0xA7, 0x9D, 0x60, 0x09, 0xF0, 0xB7, 0x8F, 0x01, 0x50,
+	0x09, 0xF0, 0xA7, 0x8F, 0x03, 0x40, 0x09, 0xF0, 0xA7, 0x7F, 0x05, 0x30, 0x09, 0xF0, 0x97, 0x87,
+	0x68, 0x20, 0x09, 0xF0, 0x87, 0x87, 0x87, 0x20, 0x09, 0xF0, 0x78, 0x77, 0xA7, 0x10, 0x09, 0xF0,
+	0x77, 0x87, 0xA7, 0x10, 0x09, 0xF0, 0x67, 0x96, 0xC6, 0x10, 0x08, 0xF0, 0x57, 0xA6, 0xC7, 0x08,
+	0xF0, 0x57, 0x97, 0xC7, 0x08, 0xF0, 0x47, 0xA7, 0xC7, 0x88, 0x01, 0xF0, 0x37, 0xB7, 0xC7, 0x08,
+	0xF0, 0x27, 0xC7, 0xC7, 0x88, 0x01, 0xF0, 0x17, 0xD7, 0xC7, 0x06, 0xF7, 0xE7, 0xC7, 0x06, 0xE7,
+	0xF7, 0xC7, 0x06, 0xD8, 0xF7, 0xC7, 0x09, 0xD7, 0xF0, 0x17, 0xC6, 0x10, 0x09, 0xC7, 0xF0, 0x36,
+	0xC6, 0x10, 0x89, 0x01, 0xB7, 0xF0, 0x47, 0xA7, 0x10, 0x09, 0xA7, 0xF0, 0x67, 0x87, 0x20, 0x09,
+	0x97, 0xF0, 0x78, 0x67, 0x30, 0x09, 0x97, 0xF0, 0x8F, 0x05, 0x30, 0x09, 0x87, 0xF0, 0xAF, 0x03,
+	0x40, 0x09, 0x77, 0xF0, 0xCF, 0x01, 0x50, 0x07, 0x77, 0xF0, 0xDD, 0x70, 0x09, 0x67, 0xF0, 0xF0,
+	0x28, 0x90, 0x09, 0x66, 0xF0, 0xF0, 0xF0, 0x50, 0x89, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x87,
+	0x06, 0xF0, 0xF0, 0xF0, 0xB0, 0x07, 0xF0, 0x3B, 0xF0, 0xC0, 0x07, 0xFF, 0x03, 0xF0, 0x80, 0x07,
+	0xDF, 0x06, 0xF0, 0x70, 0x07, 0xBF, 0x0A, 0xF0, 0x50, 0x07, 0xAF, 0x0C, 0xF0, 0x40, 0x07, 0x9F,
+	0x0E, 0xF0, 0x30, 0x07, 0x8B, 0x8B, 0xF0, 0x30, 0x07, 0x89, 0xCA, 0xF0, 0x20, 0x07, 0x79, 0xE9,
+	0xF0, 0x20, 0x09, 0x78, 0xF0, 0x19, 0xF0, 0x10, 0x09, 0x69, 0xF0, 0x19, 0xF0, 0x10, 0x89, 0x03,
+	0x68, 0xF0, 0x38, 0xF0, 0x10, 0x89, 0x01, 0x68, 0xF0, 0x29, 0xF0, 0x10, 0x09, 0x68, 0xF0, 0x28,
+	0xF0, 0x20, 0x07, 0x69, 0xF9, 0xF0, 0x20, 0x07, 0x69, 0xE9, 0xF0, 0x30, 0x07, 0x79, 0xCA, 0xF0,
+	0x30, 0x07, 0x79, 0xBA, 0xF0, 0x40, 0x07, 0x89, 0x9A, 0xF0, 0x50, 0x07, 0x89, 0x8A, 0xF0, 0x60,
+	0x07, 0x99, 0x5B, 0xF0, 0x70, 0x07, 0x9A, 0x3B, 0xF0, 0x80, 0x07, 0xA9, 0x1C, 0xF0, 0x90, 0x07,
+	0xBF, 0x04, 0xF0, 0xB0, 0x07, 0xBF, 0x03, 0xF0, 0xC0, 0x05, 0xCF, 0xF0, 0xE0, 0x05, 0xDD, 0xF0,
+	0xF0, 0x07, 0xBD, 0xF0, 0x57, 0x50, 0x07, 0xAE, 0xF0, 0x57, 0x50, 0x09, 0x8F, 0x02, 0xF0, 0x47,
+	0x50, 0x09, 0x7F, 0x04, 0xF0, 0x37, 0x50, 0x09, 0x6F, 0x06, 0xF0, 0x27, 0x50, 0x07, 0x5A, 0x2B,
+	0xF8, 0x50, 0x07, 0x4A, 0x4B, 0xE8, 0x50, 0x07, 0x3A, 0x6B, 0xD8, 0x50, 0x07, 0x39, 0x8B, 0xC8,
+	0x50, 0x07, 0x29, 0xAA, 0xC7, 0x60, 0x07, 0x28, 0xCA, 0xB7, 0x60, 0x07, 0x19, 0xDA, 0x98, 0x60,
+	0x07, 0x18, 0xFA, 0x88, 0x60, 0x09, 0x18, 0xF0, 0x1A, 0x77, 0x70, 0x09, 0x09, 0xF0, 0x2A, 0x58,
+	0x70, 0x09, 0x09, 0xF0, 0x3A, 0x48, 0x70, 0x09, 0x08, 0xF0, 0x5B, 0x18, 0x80, 0x09, 0x08, 0xF0,
+	0x6F, 0x04, 0x80, 0x09, 0x09, 0xF0, 0x6F, 0x02, 0x90, 0x09, 0x09, 0xF0, 0x7F, 0x01, 0x90, 0x07,
+	0x09, 0xF0, 0x8E, 0xA0, 0x07, 0x09, 0xF0, 0x9C, 0xB0, 0x07, 0x19, 0xF0, 0x9C, 0xA0, 0x07, 0x19,
+	0xF0, 0x9D, 0x90, 0x09, 0x1A, 0xF0, 0x6F, 0x01, 0x80, 0x09, 0x2A, 0xF0, 0x4F, 0x04, 0x60, 0x07,
+	0x2C, 0xFF, 0x07, 0x50, 0x07, 0x3E, 0x8F, 0x0D, 0x30, 0x08, 0x4F, 0x0F, 0x05, 0x2F, 0x08, 0x5F,
+	0x0F, 0x02, 0x5E, 0x06, 0x6F, 0x0F, 0x8C, 0x06, 0x7F, 0x0C, 0xBB, 0x06, 0x9F, 0x08, 0xF9, 0x08,
+	0xBF, 0x04, 0xF0, 0x38, 0x06, 0xFB, 0xF0, 0x96, 0x87, 0x0F, 0xF0, 0xF0, 0xF0, 0xB0, 0x81, 0x05,
+	0x80, 0x03, 0x07, 0x10, 0x82, 0x02, 0x08, 0x83, 0x11, 0x07, 0x10, 0x83, 0x01, 0x16, 0x10, 0x03,
+	0x15, 0x20, 0x81, 0x39, 0x80, 0x83, 0x04, 0xF0, 0x20, 0x02, 0xB6, 0x82, 0x01, 0xA7, 0x83, 0x01,
+	0x97, 0x10, 0x83, 0x01, 0x87, 0x20, 0x03, 0x78, 0x20, 0x83, 0x01, 0x77, 0x30, 0x83, 0x01, 0x67,
+	0x40, 0x03, 0x58, 0x40, 0x83, 0x01, 0x57, 0x50, 0x83, 0x01, 0x48, 0x50, 0x03, 0x47, 0x60, 0x83,
+	0x02, 0x38, 0x60, 0x03, 0x37, 0x70, 0x83, 0x03, 0x28, 0x70, 0x83, 0x06, 0x18, 0x80, 0x83, 0x0F,
+	0x08, 0x90, 0x83, 0x01, 0x09, 0x80, 0x83, 0x05, 0x18, 0x80, 0x83, 0x04, 0x28, 0x70, 0x83, 0x02,
+	0x38, 0x60, 0x03, 0x47, 0x60, 0x83, 0x02, 0x48, 0x50, 0x83, 0x01, 0x58, 0x40, 0x03, 0x67, 0x40,
+	0x83, 0x01, 0x68, 0x30, 0x03, 0x77, 0x30, 0x03, 0x78, 0x20, 0x83, 0x01, 0x87, 0x20, 0x83, 0x01,
+	0x97, 0x10, 0x82, 0x01, 0xA7, 0x02, 0xB6, 0x03, 0xF0, 0x20, 0x83, 0x04, 0xF0, 0x20, 0x03, 0x06,
+	0xB0, 0x83, 0x01, 0x07, 0xA0, 0x83, 0x01, 0x17, 0x90, 0x83, 0x01, 0x27, 0x80, 0x03, 0x28, 0x70,
+	0x03, 0x37, 0x70, 0x03, 0x38, 0x60, 0x83, 0x01, 0x47, 0x60, 0x03, 0x48, 0x50, 0x83, 0x01, 0x57,
+	0x50, 0x83, 0x01, 0x58, 0x40, 0x03, 0x67, 0x40, 0x83, 0x02, 0x68, 0x30, 0x03, 0x77, 0x30, 0x83,
+	0x02, 0x78, 0x20, 0x03, 0x87, 0x20, 0x83, 0x06, 0x88, 0x10, 0x82, 0x10, 0x98, 0x02, 0x89, 0x83,
+	0x05, 0x88, 0x10, 0x83, 0x04, 0x78, 0x20, 0x83, 0x02, 0x68, 0x30, 0x03, 0x67, 0x40, 0x83, 0x02,
+	0x58, 0x40, 0x03, 0x57, 0x50, 0x03, 0x48, 0x50, 0x83, 0x01, 0x47, 0x60, 0x03, 0x38, 0x60, 0x03,
+	0x37, 0x70, 0x03, 0x28, 0x70, 0x83, 0x01, 0x27, 0x80, 0x83, 0x01, 0x17, 0x90, 0x03, 0x08, 0x90,
+	0x03, 0x07, 0xA0, 0x03, 0x06, 0xB0, 0x03, 0xF0, 0x20, 0x85, 0x05, 0xF0, 0xF0, 0x30, 0x03, 0xE6,
+	0xD0, 0x83, 0x02, 0xD7, 0xD0, 0x83, 0x01, 0xE6, 0xD0, 0x07, 0x32, 0x96, 0x91, 0x30, 0x07, 0x24,
+	0x86, 0x83, 0x20, 0x07, 0x25, 0x75, 0x76, 0x10, 0x07, 0x18, 0x55, 0x67, 0x10, 0x06, 0x19, 0x45,
+	0x4A, 0x06, 0x0B, 0x35, 0x3B, 0x07, 0x1C, 0x15, 0x2B, 0x10, 0x05, 0x3F, 0x0C, 0x30, 0x05, 0x6F,
+	0x07, 0x50, 0x05, 0x8F, 0x03, 0x70, 0x03, 0xAD, 0xA0, 0x03, 0xC9, 0xC0, 0x03, 0xAD, 0xA0, 0x05,
+	0x8F, 0x03, 0x70, 0x05, 0x6F, 0x07, 0x50, 0x05, 0x3F, 0x0C, 0x30, 0x07, 0x1C, 0x15, 0x2B, 0x10,
+	0x06, 0x0B, 0x35, 0x3B, 0x06, 0x19, 0x45, 0x4A, 0x07, 0x18, 0x55, 0x67, 0x10, 0x07, 0x25, 0x75,
+	0x76, 0x10, 0x07, 0x24, 0x86, 0x74, 0x20, 0x07, 0x32, 0x96, 0x91, 0x30, 0x83, 0x01, 0xE6, 0xD0,
+	0x83, 0x02, 0xD7, 0xD0, 0x03, 0xE6, 0xD0, 0x85, 0x2F, 0xF0, 0xF0, 0x30, 0x85, 0x15, 0xF0, 0xF0,
+	0xC0, 0x07, 0xF0, 0x36, 0xF0, 0x30, 0x87, 0x11, 0xF0, 0x27, 0xF0, 0x30, 0x87, 0x01, 0x1F, 0x0F,
+	0x0A, 0x10, 0x07, 0x0F, 0x0F, 0x0B, 0x10, 0x06, 0x0F, 0x0F, 0x0C, 0x07, 0x0F, 0x0F, 0x0B, 0x10,
+	0x87, 0x01, 0x1F, 0x0F, 0x0A, 0x10, 0x87, 0x11, 0xF0, 0x27, 0xF0, 0x30, 0x07, 0xF0, 0x36, 0xF0,
+	0x30, 0x85, 0x15, 0xF0, 0xF0, 0xC0, 0x81, 0x3C, 0xF0, 0x03, 0x86, 0x10, 0x02, 0x78, 0x82, 0x07,
+	0x69, 0x83, 0x01, 0x68, 0x10, 0x03, 0x58, 0x20, 0x03, 0x57, 0x30, 0x03, 0x48, 0x30, 0x03, 0x47,
+	0x40, 0x83, 0x01, 0x37, 0x50, 0x03, 0x27, 0x60, 0x03, 0x26, 0x70, 0x03, 0x17, 0x70, 0x03, 0x16,
+	0x80, 0x03, 0x06, 0x90, 0x03, 0x05, 0xA0, 0x81, 0x03, 0xF0, 0x83, 0x2D, 0xF0, 0x80, 0x05, 0x1F,
+	0x06, 0x10, 0x84, 0x03, 0x0F, 0x08, 0x05, 0x1F, 0x06, 0x10, 0x83, 0x24, 0xF0, 0x80, 0x81, 0x3C,
+	0xA0, 0x03, 0x26, 0x20, 0x03, 0x18, 0x10, 0x82, 0x06, 0x0A, 0x03, 0x18, 0x10, 0x03, 0x26, 0x20,
+	0x81, 0x10, 0xA0, 0x85, 0x02, 0xF0, 0xF0, 0x60, 0x04, 0xF0, 0xF6, 0x04, 0xF0, 0xE7, 0x84, 0x01,
+	0xF0, 0xD8, 0x05, 0xF0, 0xD7, 0x10, 0x85, 0x01, 0xF0, 0xC8, 0x10, 0x05, 0xF0, 0xC7, 0x20, 0x85,
+	0x01, 0xF0, 0xB8, 0x20, 0x05, 0xF0, 0xB7, 0x30, 0x85, 0x01, 0xF0, 0xA8, 0x30, 0x85, 0x01, 0xF0,
+	0x98, 0x40, 0x05, 0xF0, 0x97, 0x50, 0x85, 0x01, 0xF0, 0x88, 0x50, 0x05, 0xF0, 0x87, 0x60, 0x85,
+	0x01, 0xF0, 0x78, 0x60, 0x05, 0xF0, 0x77, 0x70, 0x85, 0x01, 0xF0, 0x68, 0x70, 0x85, 0x01, 0xF0,
+	0x58, 0x80, 0x05, 0xF0, 0x57, 0x90, 0x85, 0x01, 0xF0, 0x48, 0x90, 0x05, 0xF0, 0x47, 0xA0, 0x85,
+	0x01, 0xF0, 0x38, 0xA0, 0x05, 0xF0, 0x37, 0xB0, 0x85, 0x01, 0xF0, 0x28, 0xB0, 0x85, 0x01, 0xF0,
+	0x18, 0xC0, 0x05, 0xF0, 0x17, 0xD0, 0x83, 0x01, 0xF8, 0xD0, 0x03, 0xF7, 0xE0, 0x83, 0x01, 0xE8,
+	0xE0, 0x83, 0x02, 0xD8, 0xF0, 0x85, 0x01, 0xC8, 0xF0, 0x10, 0x05, 0xC7, 0xF0, 0x20, 0x85, 0x01,
+	0xB8, 0xF0, 0x20, 0x05, 0xB7, 0xF0, 0x30, 0x85, 0x01, 0xA8, 0xF0, 0x30, 0x85, 0x01, 0x98, 0xF0,
+	0x40, 0x05, 0x97, 0xF0, 0x50, 0x85, 0x01, 0x88, 0xF0, 0x50, 0x05, 0x87, 0xF0, 0x60, 0x85, 0x01,
+	0x78, 0xF0, 0x60, 0x05, 0x77, 0xF0, 0x70, 0x85, 0x01, 0x68, 0xF0, 0x70, 0x85, 0x01, 0x58, 0xF0,
+	0x80, 0x05, 0x57, 0xF0, 0x90, 0x85, 0x01, 0x48, 0xF0, 0x90, 0x05, 0x47, 0xF0, 0xA0, 0x85, 0x01,
+	0x38, 0xF0, 0xA0, 0x05, 0x37, 0xF0, 0xB0, 0x85, 0x01, 0x28, 0xF0, 0xB0, 0x85, 0x01, 0x18, 0xF0,
+	0xC0, 0x05, 0x17, 0xF0, 0xD0, 0x85, 0x01, 0x08, 0xF0, 0xD0, 0x05, 0x16, 0xF0, 0xE0, 0x85, 0x03,
+	0xF0, 0xF0, 0x60, 0x85, 0x09, 0xF0, 0xF0, 0xD0, 0x07, 0xF0, 0x2A, 0xF0, 0x10, 0x05, 0xDF, 0x03,
+	0xC0, 0x05, 0xBF, 0x07, 0xA0, 0x05, 0xAF, 0x09, 0x90, 0x05, 0x9F, 0x0C, 0x70, 0x85, 0x01, 0x7F,
+	0x0F, 0x60, 0x05, 0x6C, 0x7D, 0x50, 0x05, 0x5B, 0xCB, 0x40, 0x05, 0x4B, 0xEA, 0x40, 0x07, 0x4A,
+	0xF0, 0x1A, 0x30, 0x07, 0x3A, 0xF0, 0x2A, 0x30, 0x87, 0x01, 0x39, 0xF0, 0x4A, 0x20, 0x87, 0x01,
+	0x29, 0xF0, 0x69, 0x20, 0x07, 0x29, 0xF0, 0x79, 0x10, 0x87, 0x04, 0x19, 0xF0, 0x89, 0x10, 0x06,
+	0x18, 0xF0, 0xA9, 0x86, 0x10, 0x09, 0xF0, 0xA9, 0x07, 0x09, 0xF0, 0xA8, 0x10, 0x87, 0x04, 0x19,
+	0xF0, 0x89, 0x10, 0x07, 0x19, 0xF0, 0x79, 0x20, 0x87, 0x01, 0x29, 0xF0, 0x69, 0x20, 0x87, 0x01,
+	0x2A, 0xF0, 0x49, 0x30, 0x07, 0x3A, 0xF0, 0x2A, 0x30, 0x07, 0x3A, 0xF0, 0x1A, 0x40, 0x05, 0x4A,
+	0xEB, 0x40, 0x05, 0x4B, 0xCB, 0x50, 0x05, 0x5D, 0x7C, 0x60, 0x85, 0x01, 0x6F, 0x0F, 0x70, 0x05,
+	0x7F, 0x0C, 0x90, 0x05, 0x9F, 0x09, 0xA0, 0x05, 0xAF, 0x07, 0xB0, 0x05, 0xCF, 0x03, 0xD0, 0x07,
+	0xF0, 0x1A, 0xF0, 0x20, 0x85, 0x0F, 0xF0, 0xF0, 0xD0, 0x85, 0x0A, 0xF0, 0xF0, 0x70, 0x05, 0xF0,
+	0x18, 0xD0, 0x03, 0xEA, 0xD0, 0x03, 0xDB, 0xD0, 0x03, 0xBD, 0xD0, 0x03, 0x9F, 0xD0, 0x05, 0x8F,
+	0x01, 0xD0, 0x05, 0x6F, 0x03, 0xD0, 0x05, 0x4F, 0x05, 0xD0, 0x05, 0x3B, 0x19, 0xD0, 0x05, 0x1B,
+	0x39, 0xD0, 0x05, 0x0B, 0x49, 0xD0, 0x05, 0x09, 0x69, 0xD0, 0x05, 0x07, 0x89, 0xD0, 0x05, 0x06,
+	0x99, 0xD0, 0x05, 0x04, 0xB9, 0xD0, 0x05, 0x11, 0xD9, 0xD0, 0x83, 0x26, 0xF9, 0xD0, 0x07, 0x2F,
+	0x0F, 0x04, 0x10, 0x86, 0x03, 0x1F, 0x0F, 0x06, 0x07, 0x2F, 0x0F, 0x04, 0x10, 0x85, 0x10, 0xF0,
+	0xF0, 0x70, 0x85, 0x09, 0xF0, 0xF0, 0x80, 0x03, 0xCB, 0xF0, 0x05, 0x9F, 0x02, 0xC0, 0x05, 0x6F,
+	0x07, 0xA0, 0x05, 0x4F, 0x0A, 0x90, 0x05, 0x3F, 0x0C, 0x80, 0x05, 0x2F, 0x0E, 0x70, 0x07, 0x1F,
+	0x0F, 0x01, 0x60, 0x05, 0x1B, 0x8D, 0x50, 0x05, 0x18, 0xDB, 0x50, 0x07, 0x16, 0xF0, 0x1B, 0x40,
+	0x07, 0x14, 0xF0, 0x4A, 0x40, 0x07, 0x13, 0xF0, 0x69, 0x40, 0x85, 0x01, 0xF0, 0xAA, 0x30, 0x85,
+	0x07, 0xF0, 0xB9, 0x30, 0x85, 0x02, 0xF0, 0xA9, 0x40, 0x85, 0x01, 0xF0, 0x99, 0x50, 0x05, 0xF0,
+	0x8A, 0x50, 0x05, 0xF0, 0x89, 0x60, 0x05, 0xF0, 0x7A, 0x60, 0x05, 0xF0, 0x79, 0x70, 0x05, 0xF0,
+	0x69, 0x80, 0x05, 0xF0, 0x5A, 0x80, 0x05, 0xF0, 0x59, 0x90, 0x05, 0xF0, 0x49, 0xA0, 0x05, 0xF0,
+	0x3A, 0xA0, 0x05, 0xF0, 0x2A, 0xB0, 0x05, 0xF0, 0x1A, 0xC0, 0x03, 0xFA, 0xD0, 0x03, 0xF9, 0xE0,
+	0x03, 0xE9, 0xF0, 0x03, 0xDA, 0xF0, 0x05, 0xCA, 0xF0, 0x10, 0x05, 0xBA, 0xF0, 0x20, 0x05, 0xAA,
+	0xF0, 0x30, 0x05, 0x9A, 0xF0, 0x40, 0x05, 0x8A, 0xF0, 0x50, 0x05, 0x7A, 0xF0, 0x60, 0x05, 0x6A,
+	0xF0, 0x70, 0x05, 0x5A, 0xF0, 0x80, 0x05, 0x4A, 0xF0, 0x90, 0x05, 0x3A, 0xF0, 0xA0, 0x05, 0x39,
+	0xF0, 0xB0, 0x05, 0x29, 0xF0, 0xC0, 0x05, 0x19, 0xF0, 0xD0, 0x07, 0x0F, 0x0F, 0x07, 0x10, 0x86,
+	0x04, 0x0F, 0x0F, 0x08, 0x07, 0x1F, 0x0F, 0x06, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0x80, 0x85, 0x09,
+	0xF0, 0xF0, 0x80, 0x03, 0xDA, 0xF0, 0x05, 0x9F, 0x03, 0xB0, 0x05, 0x7F, 0x07, 0x90, 0x05, 0x5F,
+	0x0A, 0x80, 0x05, 0x4F, 0x0C, 0x70, 0x05, 0x3F, 0x0E, 0x60, 0x07, 0x2F, 0x0F, 0x01, 0x50, 0x05,
+	0x2B, 0x7D, 0x50, 0x05, 0x28, 0xCC, 0x40, 0x05, 0x26, 0xFB, 0x40, 0x07, 0x24, 0xF0, 0x3A, 0x40,
+	0x07, 0x22, 0xF0, 0x6A, 0x30, 0x05, 0xF0, 0xAA, 0x30, 0x85, 0x06, 0xF0, 0xB9, 0x30, 0x85, 0x01,
+	0xF0, 0xA9, 0x40, 0x05, 0xF0, 0x9A, 0x40, 0x05, 0xF0, 0x99, 0x50, 0x05, 0xF0, 0x89, 0x60, 0x05,
+	0xF0, 0x7A, 0x60, 0x05, 0xF0, 0x5B, 0x70, 0x05, 0xF0, 0x2D, 0x80, 0x05, 0x7F, 0x06, 0xA0, 0x05,
+	0x6F, 0x05, 0xC0, 0x05, 0x6F, 0x04, 0xD0, 0x05, 0x6F, 0x08, 0x90, 0x05, 0x6F, 0x0A, 0x70, 0x05,
+	0x7F, 0x0A, 0x60, 0x05, 0xF0, 0x4E, 0x50, 0x05, 0xF0, 0x7C, 0x40, 0x05, 0xF0, 0x9B, 0x30, 0x05,
+	0xF0, 0xBA, 0x20, 0x85, 0x01, 0xF0, 0xCA, 0x10, 0x05, 0xF0, 0xD9, 0x10, 0x04, 0xF0, 0xDA, 0x84,
+	0x06, 0xF0, 0xE9, 0x85, 0x01, 0xF0, 0xD9, 0x10, 0x07, 0x02, 0xF0, 0xAA, 0x10, 0x07, 0x04, 0xF0,
+	0x7A, 0x20, 0x07, 0x06, 0xF0, 0x4B, 0x20, 0x05, 0x09, 0xFB, 0x30, 0x05, 0x0C, 0x9E, 0x30, 0x07,
+	0x0F, 0x0F, 0x04, 0x40, 0x07, 0x0F, 0x0F, 0x03, 0x50, 0x07, 0x1F, 0x0F, 0x01, 0x60, 0x05, 0x2F,
+	0x0D, 0x80, 0x05, 0x4F, 0x0A, 0x90, 0x05, 0x7F, 0x04, 0xC0, 0x03, 0xBC, 0xF0, 0x85, 0x0F, 0xF0,
+	0xF0, 0x80, 0x85, 0x0A, 0xF0, 0xF0, 0xE0, 0x05, 0xF0, 0x8B, 0xA0, 0x05, 0xF0, 0x7D, 0x90, 0x85,
+	0x01, 0xF0, 0x6E, 0x90, 0x85, 0x01, 0xF0, 0x5F, 0x90, 0x07, 0xF0, 0x4F, 0x01, 0x90, 0x07, 0xF0,
+	0x3F, 0x02, 0x90, 0x07, 0xF0, 0x37, 0x19, 0x90, 0x07, 0xF0, 0x28, 0x19, 0x90, 0x07, 0xF0, 0x27,
+	0x29, 0x90, 0x87, 0x01, 0xF0, 0x17, 0x39, 0x90, 0x05, 0xF7, 0x49, 0x90, 0x05, 0xE8, 0x49, 0x90,
+	0x05, 0xE7, 0x59, 0x90, 0x05, 0xD8, 0x59, 0x90, 0x05, 0xD7, 0x69, 0x90, 0x85, 0x01, 0xC7, 0x79,
+	0x90, 0x05, 0xB7, 0x89, 0x90, 0x05, 0xA8, 0x89, 0x90, 0x05, 0xA7, 0x99, 0x90, 0x05, 0x98, 0x99,
+	0x90, 0x05, 0x97, 0xA9, 0x90, 0x05, 0x88, 0xA9, 0x90, 0x05, 0x87, 0xB9, 0x90, 0x05, 0x77, 0xC9,
+	0x90, 0x05, 0x68, 0xC9, 0x90, 0x05, 0x67, 0xD9, 0x90, 0x05, 0x58, 0xD9, 0x90, 0x05, 0x57, 0xE9,
+	0x90, 0x05, 0x48, 0xE9, 0x90, 0x05, 0x47, 0xF9, 0x90, 0x07, 0x37, 0xF0, 0x19, 0x90, 0x07, 0x28,
+	0xF0, 0x19, 0x90, 0x07, 0x27, 0xF0, 0x29, 0x90, 0x07, 0x18, 0xF0, 0x29, 0x90, 0x07, 0x17, 0xF0,
+	0x39, 0x90, 0x07, 0x08, 0xF0, 0x39, 0x90, 0x87, 0x01, 0x0F, 0x0F, 0x0D, 0x10, 0x86, 0x02, 0x0F,
+	0x0F, 0x0E, 0x07, 0x0F, 0x0F, 0x0D, 0x10, 0x07, 0x1F, 0x0F, 0x0C, 0x10, 0x85, 0x0C, 0xF0, 0xB9,
+	0x90, 0x05, 0xF0, 0xC7, 0xA0, 0x85, 0x10, 0xF0, 0xF0, 0xE0, 0x85, 0x0A, 0xF0, 0xF0, 0x80, 0x05,
+	0x4F, 0x0E, 0x50, 0x87, 0x04, 0x3F, 0x0F, 0x01, 0x40, 0x05, 0x3F, 0x0F, 0x50, 0x85, 0x10, 0x39,
+	0xF0, 0xB0, 0x05, 0x3F, 0x06, 0xE0, 0x05, 0x3F, 0x0A, 0xA0, 0x05, 0x3F, 0x0C, 0x80, 0x05, 0x3F,
+	0x0E, 0x60, 0x05, 0x3F, 0x0F, 0x50, 0x07, 0x3F, 0x0F, 0x01, 0x40, 0x05, 0x52, 0xDF, 0x30, 0x05,
+	0xF0, 0x8C, 0x30, 0x05, 0xF0, 0xAB, 0x20, 0x05, 0xF0, 0xBA, 0x20, 0x05, 0xF0, 0xCA, 0x10, 0x85,
+	0x01, 0xF0, 0xD9, 0x10, 0x04, 0xF0, 0xDA, 0x84, 0x07, 0xF0, 0xE9, 0x04, 0xF0, 0xDA, 0x85, 0x01,
+	0xF0, 0xD9, 0x10, 0x05, 0xF0, 0xCA, 0x10, 0x05, 0xF0, 0xBA, 0x20, 0x07, 0x03, 0xF0, 0x7B, 0x20,
+	0x07, 0x04, 0xF0, 0x5B, 0x30, 0x07, 0x07, 0xF0, 0x1C, 0x30, 0x05, 0x0A, 0xAE, 0x40, 0x07, 0x0F,
+	0x0F, 0x03, 0x50, 0x07, 0x0F, 0x0F, 0x02, 0x60, 0x07, 0x0F, 0x0F, 0x01, 0x70, 0x05, 0x1F, 0x0D,
+	0x90, 0x05, 0x3F, 0x09, 0xB0, 0x05, 0x6F, 0x04, 0xD0, 0x05, 0xAB, 0xF0, 0x20, 0x85, 0x0F, 0xF0,
+	0xF0, 0x80, 0x85, 0x09, 0xF0, 0xF0, 0xA0, 0x05, 0xF0, 0x5B, 0x90, 0x07, 0xF0, 0x1F, 0x04, 0x50,
+	0x05, 0xEF, 0x07, 0x40, 0x05, 0xCF, 0x0A, 0x30, 0x05, 0xAF, 0x0C, 0x30, 0x05, 0x9F, 0x0D, 0x30,
+	0x05, 0x8D, 0x97, 0x30, 0x05, 0x7C, 0xF3, 0x30, 0x05, 0x7A, 0xF0, 0x80, 0x05, 0x6A, 0xF0, 0x90,
+	0x05, 0x5A, 0xF0, 0xA0, 0x05, 0x59, 0xF0, 0xB0, 0x85, 0x01, 0x49, 0xF0, 0xC0, 0x85, 0x01, 0x39,
+	0xF0, 0xD0, 0x85, 0x01, 0x29, 0xF0, 0xE0, 0x85, 0x01, 0x28, 0xF0, 0xF0, 0x85, 0x02, 0x19, 0xF0,
+	0xF0, 0x87, 0x01, 0x18, 0xF0, 0xF0, 0x10, 0x05, 0x09, 0x9A, 0xC0, 0x07, 0x09, 0x5F, 0x02, 0x90,
+	0x07, 0x09, 0x3F, 0x06, 0x70, 0x07, 0x09, 0x1F, 0x0A, 0x50, 0x07, 0x0F, 0x0F, 0x06, 0x40, 0x07,
+	0x0F, 0x0F, 0x07, 0x30, 0x07, 0x0F, 0x02, 0x8C, 0x30, 0x05, 0x0D, 0xEB, 0x20, 0x07, 0x0B, 0xF0,
+	0x2A, 0x20, 0x07, 0x0A, 0xF0, 0x4A, 0x10, 0x87, 0x01, 0x09, 0xF0, 0x69, 0x10, 0x06, 0x09, 0xF0,
+	0x6A, 0x86, 0x04, 0x09, 0xF0, 0x79, 0x06, 0x18, 0xF0, 0x79, 0x86, 0x02, 0x19, 0xF0, 0x69, 0x06,
+	0x19, 0xF0, 0x5A, 0x07, 0x1A, 0xF0, 0x49, 0x10, 0x07, 0x29, 0xF0, 0x49, 0x10, 0x07, 0x29, 0xF0,
+	0x3A, 0x10, 0x07, 0x2A, 0xF0, 0x29, 0x20, 0x07, 0x39, 0xF0, 0x1A, 0x20, 0x05, 0x3A, 0xEA, 0x30,
+	0x05, 0x4A, 0xCB, 0x30, 0x05, 0x4D, 0x6D, 0x40, 0x05, 0x5F, 0x0F, 0x50, 0x05, 0x6F, 0x0D, 0x60,
+	0x05, 0x7F, 0x0B, 0x70, 0x05, 0x8F, 0x09, 0x80, 0x05, 0x9F, 0x06, 0xA0, 0x05, 0xBF, 0x02, 0xC0,
+	0x03, 0xEB, 0xF0, 0x85, 0x0F, 0xF0, 0xF0, 0xA0, 0x85, 0x0A, 0xF0, 0xF0, 0xA0, 0x07, 0x1F, 0x0F,
+	0x08, 0x10, 0x86, 0x04, 0x0F, 0x0F, 0x0A, 0x06, 0x1F, 0x0F, 0x09, 0x87, 0x01, 0xF0, 0xF0, 0x18,
+	0x10, 0x05, 0xF0, 0xF9, 0x10, 0x05, 0xF0, 0xF8, 0x20, 0x05, 0xF0, 0xE9, 0x20, 0x05, 0xF0, 0xE8,
+	0x30, 0x05, 0xF0, 0xD9, 0x30, 0x05, 0xF0, 0xD8, 0x40, 0x05, 0xF0, 0xC9, 0x40, 0x85, 0x01, 0xF0,
+	0xC8, 0x50, 0x05, 0xF0, 0xB9, 0x50, 0x05, 0xF0, 0xB8, 0x60, 0x05, 0xF0, 0xA9, 0x60, 0x05, 0xF0,
+	0xA8, 0x70, 0x05, 0xF0, 0x99, 0x70, 0x05, 0xF0, 0x98, 0x80, 0x85, 0x01, 0xF0, 0x89, 0x80, 0x85,
+	0x01, 0xF0, 0x79, 0x90, 0x05, 0xF0, 0x78, 0xA0, 0x05, 0xF0, 0x69, 0xA0, 0x05, 0xF0, 0x68, 0xB0,
+	0x05, 0xF0, 0x59, 0xB0, 0x05, 0xF0, 0x58, 0xC0, 0x85, 0x01, 0xF0, 0x49, 0xC0, 0x85, 0x01, 0xF0,
+	0x39, 0xD0, 0x05, 0xF0, 0x38, 0xE0, 0x05, 0xF0, 0x29, 0xE0, 0x05, 0xF0, 0x28, 0xF0, 0x85, 0x01,
+	0xF0, 0x19, 0xF0, 0x85, 0x01, 0xF9, 0xF0, 0x10, 0x85, 0x01, 0xE9, 0xF0, 0x20, 0x85, 0x01, 0xD9,
+	0xF0, 0x30, 0x05, 0xD8, 0xF0, 0x40, 0x85, 0x01, 0xC9, 0xF0, 0x40, 0x85, 0x01, 0xB9, 0xF0, 0x50,
+	0x85, 0x01, 0xA9, 0xF0, 0x60, 0x85, 0x02, 0x99, 0xF0, 0x70, 0x85, 0x01, 0x89, 0xF0, 0x80, 0x05,
+	0x88, 0xF0, 0x90, 0x85, 0x10, 0xF0, 0xF0, 0xA0, 0x85, 0x09, 0xF0, 0xF0, 0xB0, 0x03, 0xFC, 0xE0,
+	0x05, 0xCF, 0x03, 0xB0, 0x05, 0xAF, 0x07, 0x90, 0x05, 0x8F, 0x0B, 0x70, 0x05, 0x7F, 0x0D, 0x60,
+	0x05, 0x6F, 0x0F, 0x50, 0x05, 0x5C, 0x8C, 0x40, 0x05, 0x4B, 0xCA, 0x40, 0x07, 0x49, 0xF0, 0x19,
+	0x30, 0x07, 0x3A, 0xF0, 0x19, 0x30, 0x07, 0x39, 0xF0, 0x39, 0x20, 0x07, 0x2A, 0xF0, 0x39, 0x20,
+	0x87, 0x05, 0x29, 0xF0, 0x58, 0x20, 0x07, 0x2A, 0xF0, 0x38, 0x30, 0x07, 0x39, 0xF0, 0x38, 0x30,
+	0x07, 0x3A, 0xF0, 0x19, 0x30, 0x05, 0x3B, 0xF8, 0x40, 0x05, 0x4B, 0xD8, 0x50, 0x05, 0x5B, 0xB9,
+	0x50, 0x05, 0x5C, 0x8A, 0x60, 0x05, 0x6D, 0x5A, 0x70, 0x05, 0x7E, 0x1B, 0x80, 0x05, 0x8F, 0x08,
+	0xA0, 0x05, 0xAF, 0x05, 0xB0, 0x05, 0xBF, 0x02, 0xD0, 0x03, 0xDF, 0xD0, 0x05, 0xDF, 0x02, 0xB0,
+	0x05, 0xBF, 0x06, 0x90, 0x05, 0x9F, 0x09, 0x80, 0x05, 0x8B, 0x2E, 0x60, 0x05, 0x6B, 0x6D, 0x50,
+	0x05, 0x5B, 0x8D, 0x40, 0x05, 0x4A, 0xCC, 0x30, 0x05, 0x3A, 0xEB, 0x30, 0x07, 0x39, 0xF0, 0x1B,
+	0x20, 0x07, 0x29, 0xF0, 0x3B, 0x10, 0x07, 0x1A, 0xF0, 0x4A, 0x10, 0x07, 0x19, 0xF0, 0x69, 0x10,
+	0x06, 0x19, 0xF0, 0x6A, 0x86, 0x06, 0x09, 0xF0, 0x89, 0x07, 0x0A, 0xF0, 0x69, 0x10, 0x07, 0x19,
+	0xF0, 0x69, 0x10, 0x07, 0x1A, 0xF0, 0x4A, 0x10, 0x07, 0x1B, 0xF0, 0x2A, 0x20, 0x05, 0x2B, 0xFA,
+	0x30, 0x05, 0x3D, 0x9D, 0x30, 0x07, 0x4F, 0x0F, 0x03, 0x40, 0x07, 0x5F, 0x0F, 0x01, 0x50, 0x05,
+	0x6F, 0x0D, 0x70, 0x05, 0x8F, 0x0A, 0x80, 0x05, 0xAF, 0x05, 0xB0, 0x03, 0xEC, 0xF0, 0x85, 0x0F,
+	0xF0, 0xF0, 0xB0, 0x85, 0x09, 0xF0, 0xF0, 0xA0, 0x03, 0xFA, 0xF0, 0x05, 0xBF, 0x03, 0xB0, 0x05,
+	0x9F, 0x06, 0xA0, 0x05, 0x8F, 0x09, 0x80, 0x05, 0x6F, 0x0C, 0x70, 0x05, 0x5F, 0x0E, 0x60, 0x05,
+	0x4C, 0x7C, 0x50, 0x05, 0x4A, 0xBA, 0x50, 0x05, 0x3A, 0xDA, 0x40, 0x05, 0x2A, 0xFA, 0x30, 0x07,
+	0x29, 0xF0, 0x29, 0x30, 0x07, 0x1A, 0xF0, 0x29, 0x30, 0x87, 0x01, 0x19, 0xF0, 0x49, 0x20, 0x07,
+	0x19, 0xF0, 0x58, 0x20, 0x87, 0x03, 0x09, 0xF0, 0x69, 0x10, 0x07, 0x09, 0xF0, 0x78, 0x10, 0x86,
+	0x03, 0x09, 0xF0, 0x79, 0x86, 0x01, 0x0A, 0xF0, 0x69, 0x06, 0x19, 0xF0, 0x69, 0x06, 0x1A, 0xF0,
+	0x59, 0x06, 0x1A, 0xF0, 0x4A, 0x06, 0x2A, 0xF0, 0x2B, 0x04, 0x2B, 0xED, 0x06, 0x3D, 0x8F, 0x01,
+	0x86, 0x01, 0x4F, 0x0F, 0x06, 0x06, 0x6F, 0x0F, 0x04, 0x06, 0x7F, 0x07, 0x29, 0x06, 0x9F, 0x02,
+	0x59, 0x05, 0xCB, 0x88, 0x10, 0x87, 0x02, 0xF0, 0xF0, 0x18, 0x10, 0x85, 0x01, 0xF0, 0xF9, 0x10,
+	0x05, 0xF0, 0xF8, 0x20, 0x85, 0x01, 0xF0, 0xE9, 0x20, 0x05, 0xF0, 0xE8, 0x30, 0x85, 0x01, 0xF0,
+	0xD9, 0x30, 0x05, 0xF0, 0xC9, 0x40, 0x05, 0xF0, 0xBA, 0x40, 0x05, 0xF0, 0xAA, 0x50, 0x05, 0xF0,
+	0x9B, 0x50, 0x05, 0xF0, 0x8B, 0x60, 0x05, 0x24, 0xFC, 0x70, 0x05, 0x27, 0xAD, 0x80, 0x05, 0x2F,
+	0x0F, 0x80, 0x05, 0x2F, 0x0D, 0xA0, 0x05, 0x2F, 0x0C, 0xB0, 0x05, 0x2F, 0x0B, 0xC0, 0x05, 0x3F,
+	0x08, 0xE0, 0x07, 0x5F, 0x04, 0xF0, 0x10, 0x05, 0x9B, 0xF0, 0x50, 0x85, 0x0F, 0xF0, 0xF0, 0xA0,
+	0x81, 0x1A, 0xA0, 0x03, 0x26, 0x20, 0x03, 0x18, 0x10, 0x82, 0x06, 0x0A, 0x03, 0x18, 0x10, 0x03,
+	0x26, 0x20, 0x81, 0x16, 0xA0, 0x03, 0x26, 0x20, 0x03, 0x18, 0x10, 0x82, 0x06, 0x0A, 0x03, 0x18,
+	0x10, 0x03, 0x26, 0x20, 0x81, 0x10, 0xA0, 0x81, 0x1C, 0xF0, 0x03, 0x76, 0x20, 0x03, 0x68, 0x10,
+	0x82, 0x06, 0x5A, 0x03, 0x68, 0x10, 0x03, 0x76, 0x20, 0x81, 0x14, 0xF0, 0x03, 0x77, 0x10, 0x82,
+	0x06, 0x69, 0x83, 0x02, 0x68, 0x10, 0x83, 0x01, 0x58, 0x20, 0x03, 0x48, 0x30, 0x03, 0x47, 0x40,
+	0x03, 0x38, 0x40, 0x03, 0x37, 0x50, 0x83, 0x01, 0x27, 0x60, 0x03, 0x17, 0x70, 0x03, 0x16, 0x80,
+	0x03, 0x07, 0x80, 0x03, 0x06, 0x90, 0x03, 0x05, 0xA0, 0x81, 0x03, 0xF0, 0x85, 0x15, 0xF0, 0xF0,
+	0xA0, 0x06, 0xF0, 0xF0, 0x73, 0x06, 0xF0, 0xF0, 0x55, 0x06, 0xF0, 0xF0, 0x37, 0x06, 0xF0, 0xF0,
+	0x19, 0x04, 0xF0, 0xEB, 0x04, 0xF0, 0xCD, 0x04, 0xF0, 0xAF, 0x07, 0xF0, 0x8F, 0x01, 0x10, 0x05,
+	0xF0, 0x7F, 0x30, 0x05, 0xF0, 0x5F, 0x50, 0x05, 0xF0, 0x3F, 0x70, 0x05, 0xF0, 0x1F, 0x90, 0x03,
+	0xEF, 0xB0, 0x03, 0xCF, 0xD0, 0x03, 0xAF, 0xF0, 0x05, 0x8F, 0xF0, 0x20, 0x05, 0x6F, 0xF0, 0x40,
+	0x05, 0x4F, 0xF0, 0x60, 0x05, 0x2F, 0xF0, 0x80, 0x05, 0x1E, 0xF0, 0xA0, 0x05, 0x0D, 0xF0, 0xC0,
+	0x05, 0x0B, 0xF0, 0xE0, 0x07, 0x08, 0xF0, 0xF0, 0x20, 0x05, 0x0A, 0xF0, 0xF0, 0x05, 0x0C, 0xF0,
+	0xD0, 0x05, 0x1D, 0xF0, 0xB0, 0x05, 0x2E, 0xF0, 0x90, 0x05, 0x4E, 0xF0, 0x70, 0x05, 0x6F, 0xF0,
+	0x40, 0x05, 0x8F, 0xF0, 0x20, 0x03, 0xAF, 0xF0, 0x03, 0xCF, 0xD0, 0x03, 0xEF, 0xB0, 0x05, 0xF0,
+	0x1F, 0x90, 0x05, 0xF0, 0x3F, 0x70, 0x05, 0xF0, 0x5F, 0x50, 0x05, 0xF0, 0x7F, 0x30, 0x05, 0xF0,
+	0x9F, 0x10, 0x04, 0xF0, 0xAF, 0x04, 0xF0, 0xCD, 0x04, 0xF0, 0xEB, 0x06, 0xF0, 0xF0, 0x19, 0x06,
+	0xF0, 0xF0, 0x37, 0x06, 0xF0, 0xF0, 0x55, 0x06, 0xF0, 0xF0, 0x73, 0x85, 0x15, 0xF0, 0xF0, 0xA0,
+	0x85, 0x1F, 0xF0, 0xF0, 0x90, 0x07, 0x1F, 0x0F, 0x07, 0x10, 0x86, 0x04, 0x0F, 0x0F, 0x09, 0x07,
+	0x1F, 0x0F, 0x07, 0x10, 0x85, 0x0B, 0xF0, 0xF0, 0x90, 0x07, 0x1F, 0x0F, 0x07, 0x10, 0x86, 0x04,
+	0x0F, 0x0F, 0x09, 0x07, 0x1F, 0x0F, 0x07, 0x10, 0x85, 0x1E, 0xF0, 0xF0, 0x90, 0x85, 0x16, 0xF0,
+	0xF0, 0xA0, 0x07, 0x03, 0xF0, 0xF0, 0x70, 0x07, 0x05, 0xF0, 0xF0, 0x50, 0x07, 0x07, 0xF0, 0xF0,
+	0x30, 0x07, 0x09, 0xF0, 0xF0, 0x10, 0x05, 0x0B, 0xF0, 0xE0, 0x05, 0x0D, 0xF0, 0xC0, 0x05, 0x0F,
+	0xF0, 0xA0, 0x07, 0x1F, 0x01, 0xF0, 0x80, 0x07, 0x3F, 0x01, 0xF0, 0x60, 0x07, 0x5F, 0x01, 0xF0,
+	0x40, 0x07, 0x7F, 0x01, 0xF0, 0x20, 0x05, 0x9F, 0x01, 0xF0, 0x05, 0xBF, 0x01, 0xD0, 0x05, 0xDF,
+	0x01, 0xB0, 0x05, 0xF0, 0x1F, 0x90, 0x05, 0xF0, 0x3F, 0x70, 0x05, 0xF0, 0x5F, 0x50, 0x05, 0xF0,
+	0x7F, 0x30, 0x05, 0xF0, 0x9F, 0x10, 0x05, 0xF0, 0xCC, 0x10, 0x04, 0xF0, 0xEB, 0x06, 0xF0, 0xF0,
+	0x19, 0x04, 0xF0, 0xFA, 0x04, 0xF0, 0xDC, 0x05, 0xF0, 0xBD, 0x10, 0x05, 0xF0, 0x9F, 0x10, 0x05,
+	0xF0, 0x7F, 0x30, 0x07, 0xF0, 0x4F, 0x01, 0x50, 0x07, 0xF0, 0x2F, 0x01, 0x70, 0x05, 0xFF, 0x01,
+	0x90, 0x05, 0xDF, 0x01, 0xB0, 0x05, 0xBF, 0x01, 0xD0, 0x05, 0x9F, 0x01, 0xF0, 0x07, 0x7F, 0x01,
+	0xF0, 0x20, 0x07, 0x5F, 0x01, 0xF0, 0x40, 0x07, 0x2F, 0x02, 0xF0, 0x60, 0x07, 0x1F, 0x01, 0xF0,
+	0x80, 0x05, 0x0F, 0xF0, 0xA0, 0x05, 0x0D, 0xF0, 0xC0, 0x05, 0x0B, 0xF0, 0xE0, 0x07, 0x09, 0xF0,
+	0xF0, 0x10, 0x07, 0x07, 0xF0, 0xF0, 0x30, 0x07, 0x05, 0xF0, 0xF0, 0x50, 0x07, 0x03, 0xF0, 0xF0,
+	0x70, 0x85, 0x15, 0xF0, 0xF0, 0xA0, 0x85, 0x06, 0xF0, 0xF0, 0x40, 0x03, 0xAA, 0xE0, 0x05, 0x6F,
+	0x03, 0xA0, 0x05, 0x3F, 0x08, 0x80, 0x05, 0x1F, 0x0B, 0x70, 0x05, 0x0F, 0x0E, 0x50, 0x05, 0x0F,
+	0x0F, 0x40, 0x05, 0x09, 0x9C, 0x40, 0x05, 0x06, 0xEB, 0x30, 0x07, 0x04, 0xF0, 0x3A, 0x20, 0x07,
+	0x03, 0xF0, 0x59, 0x20, 0x85, 0x01, 0xF0, 0x99, 0x10, 0x05, 0xF0, 0xA8, 0x10, 0x04, 0xF0, 0xA9,
+	0x84, 0x08, 0xF0, 0xB8, 0x85, 0x02, 0xF0, 0xA8, 0x10, 0x05, 0xF0, 0x98, 0x20, 0x05, 0xF0, 0x89,
+	0x20, 0x05, 0xF0, 0x79, 0x30, 0x05, 0xF0, 0x6A, 0x30, 0x05, 0xF0, 0x3C, 0x40, 0x05, 0xBF, 0x03,
+	0x50, 0x05, 0xAF, 0x03, 0x60, 0x05, 0xAF, 0x01, 0x80, 0x03, 0xAE, 0xA0, 0x03, 0xAB, 0xD0, 0x85,
+	0x0B, 0xA8, 0xF0, 0x10, 0x05, 0xB6, 0xF0, 0x20, 0x85, 0x05, 0xF0, 0xF0, 0x40, 0x05, 0xB6, 0xF0,
+	0x20, 0x05, 0xA8, 0xF0, 0x10, 0x83, 0x06, 0x9A, 0xF0, 0x05, 0xA8, 0xF0, 0x10, 0x05, 0xB6, 0xF0,
+	0x20, 0x85, 0x0F, 0xF0, 0xF0, 0x40, 0x89, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xA0, 0x09, 0xF0, 0xF0,
+	0x3F, 0xF0, 0x70, 0x09, 0xF0, 0xDF, 0x09, 0xF0, 0x30, 0x07, 0xF0, 0xAF, 0x0F, 0xF0, 0x09, 0xF0,
+	0x7F, 0x0F, 0x05, 0xD0, 0x09, 0xF0, 0x5F, 0x0F, 0x09, 0xB0, 0x09, 0xF0, 0x3F, 0x0F, 0x0D, 0x90,
+	0x0B, 0xF0, 0x2F, 0x01, 0xDF, 0x01, 0x80, 0x07, 0xFE, 0xF0, 0x6D, 0x70, 0x07, 0xEC, 0xF0, 0xCB,
+	0x60, 0x07, 0xDB, 0xF0, 0xFB, 0x50, 0x09, 0xCA, 0xF0, 0xF0, 0x4A, 0x40, 0x09, 0xB9, 0xF0, 0xF0,
+	0x79, 0x40, 0x09, 0xA9, 0xF0, 0xF0, 0x99, 0x30, 0x09, 0x99, 0xF0, 0xF0, 0xB8, 0x30, 0x09, 0x98,
+	0xF0, 0xF0, 0xD8, 0x20, 0x09, 0x88, 0xF0, 0xF0, 0xE8, 0x20, 0x0B, 0x78, 0xF0, 0xF0, 0xF0, 0x18,
+	0x10, 0x09, 0x78, 0xF7, 0xF0, 0x98, 0x10, 0x09, 0x68, 0xEB, 0x67, 0xA7, 0x10, 0x09, 0x67, 0xDF,
+	0x47, 0xA7, 0x10, 0x0A, 0x58, 0xCF, 0x02, 0x27, 0xB8, 0x0A, 0x57, 0xCF, 0x04, 0x17, 0xB8, 0x08,
+	0x48, 0xBF, 0x0D, 0xB8, 0x08, 0x47, 0xBA, 0x5E, 0xC7, 0x08, 0x38, 0xA9, 0x8D, 0xC7, 0x08, 0x37,
+	0xB8, 0xAB, 0xD7, 0x08, 0x37, 0xA8, 0xCA, 0xD7, 0x08, 0x28, 0xA8, 0xD9, 0xD7, 0x08, 0x27, 0xA8,
+	0xE9, 0xD7, 0x08, 0x27, 0xA8, 0xF8, 0xD7, 0x0A, 0x27, 0xA7, 0xF0, 0x18, 0xD7, 0x0A, 0x18, 0x98,
+	0xF0, 0x17, 0xE7, 0x08, 0x17, 0xA8, 0xF8, 0xD8, 0x0A, 0x17, 0xA7, 0xF0, 0x18, 0xD8, 0x8B, 0x01,
+	0x17, 0xA7, 0xF0, 0x18, 0xD7, 0x10, 0x0B, 0x17, 0x98, 0xF0, 0x17, 0xE7, 0x10, 0x0B, 0x08, 0x98,
+	0xF0, 0x17, 0xE7, 0x10, 0x0B, 0x07, 0xA7, 0xF0, 0x18, 0xD8, 0x10, 0x8B, 0x01, 0x07, 0xA7, 0xF0,
+	0x18, 0xD7, 0x20, 0x0B, 0x07, 0xA7, 0xF0, 0x17, 0xD8, 0x20, 0x09, 0x07, 0xA7, 0xF8, 0xD7, 0x30,
+	0x09, 0x07, 0xA7, 0xE9, 0xD7, 0x30, 0x09, 0x07, 0xA8, 0xCA, 0xC7, 0x40, 0x09, 0x07, 0xA8, 0xBB,
+	0xB8, 0x40, 0x09, 0x07, 0xA8, 0xAD, 0xA7, 0x50, 0x09, 0x07, 0xB8, 0x8E, 0x89, 0x50, 0x0B, 0x07,
+	0xB9, 0x5F, 0x03, 0x59, 0x60, 0x0B, 0x08, 0xAF, 0x07, 0x2F, 0x06, 0x70, 0x0B, 0x08, 0xBF, 0x04,
+	0x4F, 0x05, 0x80, 0x0B, 0x17, 0xBF, 0x03, 0x6F, 0x03, 0x90, 0x0B, 0x17, 0xCF, 0x01, 0x8F, 0x01,
+	0xA0, 0x07, 0x17, 0xEC, 0xBD, 0xC0, 0x09, 0x18, 0xF7, 0xF0, 0x18, 0xF0, 0x0B, 0x18, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x10, 0x0B, 0x27, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x89, 0x01, 0x28, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x09, 0x38, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0x39, 0xF0, 0xF0, 0xF0, 0xD0, 0x09, 0x49, 0xF0,
+	0xF0, 0xF0, 0xC0, 0x09, 0x4A, 0xF0, 0xF0, 0xF0, 0xB0, 0x09, 0x5A, 0xF0, 0xF0, 0xF0, 0xA0, 0x09,
+	0x6B, 0xF0, 0xF0, 0xF0, 0x80, 0x09, 0x7C, 0xF0, 0xF0, 0xF0, 0x60, 0x09, 0x8D, 0xF0, 0xA4, 0xF0,
+	0x50, 0x09, 0x9F, 0x02, 0xF9, 0xF0, 0x50, 0x09, 0xAF, 0x0F, 0x0A, 0xF0, 0x50, 0x09, 0xCF, 0x0F,
+	0x08, 0xF0, 0x50, 0x09, 0xEF, 0x0F, 0x06, 0xF0, 0x50, 0x0B, 0xF0, 0x1F, 0x0F, 0x03, 0xF0, 0x60,
+	0x09, 0xF0, 0x4F, 0x0D, 0xF0, 0x80, 0x09, 0xF0, 0x9F, 0x02, 0xF0, 0xE0, 0x89, 0x05, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xA0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0x70, 0x07, 0xF0, 0x69, 0xF0, 0x70, 0x87, 0x01,
+	0xF0, 0x5B, 0xF0, 0x60, 0x07, 0xF0, 0x5C, 0xF0, 0x50, 0x07, 0xF0, 0x4D, 0xF0, 0x50, 0x87, 0x01,
+	0xF0, 0x4E, 0xF0, 0x40, 0x07, 0xF0, 0x3F, 0xF0, 0x40, 0x89, 0x01, 0xF0, 0x37, 0x18, 0xF0, 0x30,
+	0x09, 0xF0, 0x27, 0x28, 0xF0, 0x30, 0x09, 0xF0, 0x27, 0x38, 0xF0, 0x20, 0x09, 0xF0, 0x18, 0x38,
+	0xF0, 0x20, 0x09, 0xF0, 0x17, 0x48, 0xF0, 0x20, 0x09, 0xF0, 0x17, 0x58, 0xF0, 0x10, 0x07, 0xF8,
+	0x58, 0xF0, 0x10, 0x05, 0xF7, 0x69, 0xF0, 0x05, 0xF7, 0x78, 0xF0, 0x05, 0xE8, 0x78, 0xF0, 0x05,
+	0xE7, 0x89, 0xE0, 0x05, 0xE7, 0x98, 0xE0, 0x05, 0xD8, 0x98, 0xE0, 0x05, 0xD7, 0xA9, 0xD0, 0x85,
+	0x01, 0xC8, 0xB8, 0xD0, 0x05, 0xC7, 0xC9, 0xC0, 0x85, 0x01, 0xB8, 0xD8, 0xC0, 0x05, 0xB7, 0xE9,
+	0xB0, 0x05, 0xA8, 0xF8, 0xB0, 0x05, 0xA8, 0xF9, 0xA0, 0x07, 0xA7, 0xF0, 0x19, 0xA0, 0x07, 0x98,
+	0xF0, 0x28, 0xA0, 0x07, 0x98, 0xF0, 0x29, 0x90, 0x07, 0x97, 0xF0, 0x39, 0x90, 0x07, 0x88, 0xF0,
+	0x48, 0x90, 0x07, 0x88, 0xF0, 0x49, 0x80, 0x07, 0x78, 0xF0, 0x59, 0x80, 0x07, 0x78, 0xF0, 0x68,
+	0x80, 0x07, 0x7F, 0x0F, 0x08, 0x70, 0x07, 0x6F, 0x0F, 0x09, 0x70, 0x87, 0x01, 0x6F, 0x0F, 0x0A,
+	0x60, 0x07, 0x5F, 0x0F, 0x0B, 0x60, 0x07, 0x5F, 0x0F, 0x0C, 0x50, 0x07, 0x58, 0xF0, 0xA9, 0x50,
+	0x07, 0x48, 0xF0, 0xC8, 0x50, 0x07, 0x48, 0xF0, 0xC9, 0x40, 0x07, 0x39, 0xF0, 0xC9, 0x40, 0x07,
+	0x38, 0xF0, 0xE8, 0x40, 0x07, 0x38, 0xF0, 0xE9, 0x30, 0x07, 0x29, 0xF0, 0xE9, 0x30, 0x89, 0x01,
+	0x28, 0xF0, 0xF0, 0x19, 0x20, 0x09, 0x19, 0xF0, 0xF0, 0x19, 0x20, 0x89, 0x01, 0x18, 0xF0, 0xF0,
+	0x39, 0x10, 0x09, 0x09, 0xF0, 0xF0, 0x48, 0x10, 0x88, 0x01, 0x08, 0xF0, 0xF0, 0x59, 0x08, 0x07,
+	0xF0, 0xF0, 0x78, 0x87, 0x10, 0xF0, 0xF0, 0xF0, 0x70, 0x85, 0x0A, 0xF0, 0xF0, 0xA0, 0x07, 0x1F,
+	0x07, 0xF0, 0x20, 0x05, 0x0F, 0x0C, 0xD0, 0x05, 0x0F, 0x0E, 0xB0, 0x07, 0x0F, 0x0F, 0x01, 0x90,
+	0x07, 0x0F, 0x0F, 0x02, 0x80, 0x87, 0x01, 0x0F, 0x0F, 0x03, 0x70, 0x05, 0x09, 0xCD, 0x60, 0x05,
+	0x09, 0xEC, 0x50, 0x87, 0x01, 0x09, 0xF0, 0x1A, 0x50, 0x87, 0x01, 0x09, 0xF0, 0x2A, 0x40, 0x87,
+	0x06, 0x09, 0xF0, 0x39, 0x40, 0x07, 0x09, 0xF0, 0x38, 0x50, 0x87, 0x01, 0x09, 0xF0, 0x29, 0x50,
+	0x07, 0x09, 0xF0, 0x19, 0x60, 0x05, 0x09, 0xF9, 0x70, 0x05, 0x09, 0xEA, 0x70, 0x05, 0x09, 0xCB,
+	0x80, 0x05, 0x0F, 0x0F, 0xA0, 0x05, 0x0F, 0x0E, 0xB0, 0x05, 0x0F, 0x0F, 0xA0, 0x07, 0x0F, 0x0F,
+	0x03, 0x70, 0x07, 0x0F, 0x0F, 0x04, 0x60, 0x07, 0x0F, 0x0F, 0x05, 0x50, 0x05, 0x09, 0xED, 0x40,
+	0x07, 0x09, 0xF0, 0x2B, 0x30, 0x07, 0x09, 0xF0, 0x3B, 0x20, 0x07, 0x09, 0xF0, 0x59, 0x20, 0x07,
+	0x09, 0xF0, 0x5A, 0x10, 0x87, 0x01, 0x09, 0xF0, 0x69, 0x10, 0x86, 0x06, 0x09, 0xF0, 0x79, 0x06,
+	0x09, 0xF0, 0x6A, 0x87, 0x01, 0x09, 0xF0, 0x69, 0x10, 0x07, 0x09, 0xF0, 0x5A, 0x10, 0x07, 0x09,
+	0xF0, 0x4A, 0x20, 0x07, 0x09, 0xF0, 0x2C, 0x20, 0x05, 0x09, 0xFD, 0x30, 0x07, 0x0F, 0x0F, 0x06,
+	0x40, 0x07, 0x0F, 0x0F, 0x05, 0x50, 0x07, 0x0F, 0x0F, 0x04, 0x60, 0x07, 0x0F, 0x0F, 0x03, 0x70,
+	0x07, 0x0F, 0x0F, 0x01, 0x90, 0x05, 0x0F, 0x0E, 0xB0, 0x05, 0x1F, 0x09, 0xF0, 0x85, 0x10, 0xF0,
+	0xF0, 0xA0, 0x85, 0x09, 0xF0, 0xF0, 0xD0, 0x05, 0xF0, 0x6A, 0xC0, 0x07, 0xF0, 0x2F, 0x03, 0x80,
+	0x05, 0xFF, 0x07, 0x60, 0x05, 0xDF, 0x0B, 0x40, 0x05, 0xCF, 0x0E, 0x20, 0x07, 0xAF, 0x0F, 0x02,
+	0x10, 0x06, 0x9F, 0x0F, 0x04, 0x04, 0x8E, 0x9C, 0x04, 0x7D, 0xE9, 0x06, 0x7B, 0xF0, 0x37, 0x06,
+	0x6A, 0xF0, 0x75, 0x06, 0x5A, 0xF0, 0x94, 0x07, 0x5A, 0xF0, 0xA2, 0x10, 0x05, 0x4A, 0xF0, 0xE0,
+	0x05, 0x49, 0xF0, 0xF0, 0x05, 0x3A, 0xF0, 0xF0, 0x07, 0x39, 0xF0, 0xF0, 0x10, 0x07, 0x2A, 0xF0,
+	0xF0, 0x10, 0x87, 0x01, 0x29, 0xF0, 0xF0, 0x20, 0x87, 0x04, 0x19, 0xF0, 0xF0, 0x30, 0x87, 0x0D,
+	0x09, 0xF0, 0xF0, 0x40, 0x07, 0x0A, 0xF0, 0xF0, 0x30, 0x87, 0x02, 0x19, 0xF0, 0xF0, 0x30, 0x87,
+	0x01, 0x1A, 0xF0, 0xF0, 0x20, 0x07, 0x29, 0xF0, 0xF0, 0x20, 0x87, 0x01, 0x2A, 0xF0, 0xF0, 0x10,
+	0x85, 0x01, 0x3A, 0xF0, 0xF0, 0x06, 0x4A, 0xF0, 0xC2, 0x06, 0x4B, 0xF0, 0x94, 0x06, 0x5B, 0xF0,
+	0x75, 0x06, 0x6B, 0xF0, 0x47, 0x04, 0x6D, 0xF9, 0x04, 0x7F, 0x9C, 0x06, 0x8F, 0x0F, 0x05, 0x07,
+	0x9F, 0x0F, 0x03, 0x10, 0x07, 0xAF, 0x0F, 0x01, 0x20, 0x05, 0xCF, 0x0C, 0x40, 0x05, 0xEF, 0x08,
+	0x60, 0x07, 0xF0, 0x1F, 0x03, 0x90, 0x05, 0xF0, 0x5B, 0xC0, 0x85, 0x0F, 0xF0, 0xF0, 0xD0, 0x87,
+	0x0A, 0xF0, 0xF0, 0xF0, 0x20, 0x07, 0x1F, 0x08, 0xF0, 0x80, 0x07, 0x0F, 0x0E, 0xF0, 0x30, 0x09,
+	0x0F, 0x0F, 0x01, 0xF0, 0x10, 0x07, 0x0F, 0x0F, 0x04, 0xD0, 0x07, 0x0F, 0x0F, 0x05, 0xC0, 0x07,
+	0x0F, 0x0F, 0x07, 0xA0, 0x07, 0x0F, 0x0F, 0x08, 0x90, 0x07, 0x09, 0xEF, 0x01, 0x80, 0x07, 0x09,
+	0xF0, 0x2E, 0x70, 0x07, 0x09, 0xF0, 0x4D, 0x60, 0x07, 0x09, 0xF0, 0x6C, 0x50, 0x07, 0x09, 0xF0,
+	0x7B, 0x50, 0x07, 0x09, 0xF0, 0x8B, 0x40, 0x07, 0x09, 0xF0, 0x9A, 0x40, 0x07, 0x09, 0xF0, 0xAA,
+	0x30, 0x07, 0x09, 0xF0, 0xB9, 0x30, 0x07, 0x09, 0xF0, 0xBA, 0x20, 0x87, 0x01, 0x09, 0xF0, 0xC9,
+	0x20, 0x07, 0x09, 0xF0, 0xCA, 0x10, 0x87, 0x02, 0x09, 0xF0, 0xD9, 0x10, 0x06, 0x09, 0xF0, 0xDA,
+	0x86, 0x0C, 0x09, 0xF0, 0xE9, 0x87, 0x03, 0x09, 0xF0, 0xD9, 0x10, 0x07, 0x09, 0xF0, 0xCA, 0x10,
+	0x87, 0x01, 0x09, 0xF0, 0xC9, 0x20, 0x07, 0x09, 0xF0, 0xBA, 0x20, 0x07, 0x09, 0xF0, 0xB9, 0x30,
+	0x07, 0x09, 0xF0, 0xAA, 0x30, 0x87, 0x01, 0x09, 0xF0, 0x9A, 0x40, 0x07, 0x09, 0xF0, 0x8A, 0x50,
+	0x07, 0x09, 0xF0, 0x6B, 0x60, 0x07, 0x09, 0xF0, 0x5C, 0x60, 0x07, 0x09, 0xF0, 0x3D, 0x70, 0x07,
+	0x09, 0xEF, 0x01, 0x80, 0x07, 0x0F, 0x0F, 0x08, 0x90, 0x07, 0x0F, 0x0F, 0x06, 0xB0, 0x07, 0x0F,
+	0x0F, 0x05, 0xC0, 0x07, 0x0F, 0x0F, 0x03, 0xE0, 0x09, 0x0F, 0x0F, 0x01, 0xF0, 0x10, 0x07, 0x0F,
+	0x0D, 0xF0, 0x40, 0x07, 0x1F, 0x07, 0xF0, 0x90, 0x87, 0x10, 0xF0, 0xF0, 0xF0, 0x20, 0x85, 0x0A,
+	0xF0, 0xF0, 0x40, 0x07, 0x1F, 0x0F, 0x02, 0x10, 0x86, 0x04, 0x0F, 0x0F, 0x04, 0x07, 0x0F, 0x0F,
+	0x03, 0x10, 0x85, 0x11, 0x09, 0xF0, 0xA0, 0x05, 0x0F, 0x0E, 0x50, 0x85, 0x04, 0x0F, 0x0F, 0x40,
+	0x05, 0x0F, 0x0E, 0x50, 0x85, 0x15, 0x09, 0xF0, 0xA0, 0x07, 0x0F, 0x0F, 0x03, 0x10, 0x86, 0x04,
+	0x0F, 0x0F, 0x04, 0x07, 0x1F, 0x0F, 0x02, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0x40, 0x85, 0x0A, 0xF0,
+	0xF0, 0x20, 0x05, 0x1F, 0x0F, 0x10, 0x86, 0x04, 0x0F, 0x0F, 0x02, 0x07, 0x0F, 0x0F, 0x01, 0x10,
+	0x85, 0x13, 0x09, 0xF0, 0x80, 0x05, 0x0F, 0x0F, 0x20, 0x87, 0x04, 0x0F, 0x0F, 0x01, 0x10, 0x05,
+	0x0F, 0x0F, 0x20, 0x85, 0x19, 0x09, 0xF0, 0x80, 0x05, 0x17, 0xF0, 0x90, 0x85, 0x10, 0xF0, 0xF0,
+	0x20, 0x87, 0x09, 0xF0, 0xF0, 0xF0, 0x40, 0x05, 0xF0, 0x9C, 0xD0, 0x07, 0xF0, 0x5F, 0x05, 0x90,
+	0x07, 0xF0, 0x2F, 0x0B, 0x60, 0x05, 0xFF, 0x0F, 0x40, 0x07, 0xDF, 0x0F, 0x04, 0x20, 0x07, 0xCF,
+	0x0F, 0x06, 0x10, 0x06, 0xBF, 0x0F, 0x08, 0x04, 0xAF, 0xAE, 0x06, 0x9D, 0xF0, 0x2A, 0x06, 0x8C,
+	0xF0, 0x68, 0x06, 0x7B, 0xF0, 0xA6, 0x06, 0x6B, 0xF0, 0xD4, 0x07, 0x5B, 0xF0, 0xF2, 0x10, 0x07,
+	0x5A, 0xF0, 0xF0, 0x40, 0x07, 0x4A, 0xF0, 0xF0, 0x50, 0x07, 0x49, 0xF0, 0xF0, 0x60, 0x07, 0x3A,
+	0xF0, 0xF0, 0x60, 0x07, 0x39, 0xF0, 0xF0, 0x70, 0x07, 0x2A, 0xF0, 0xF0, 0x70, 0x87, 0x01, 0x29,
+	0xF0, 0xF0, 0x80, 0x07, 0x1A, 0xF0, 0xF0, 0x80, 0x87, 0x02, 0x19, 0xF0, 0xF0, 0x90, 0x07, 0x0A,
+	0xF0, 0xF0, 0x90, 0x87, 0x02, 0x09, 0xF0, 0xF0, 0xA0, 0x09, 0x09, 0xF0, 0x3F, 0x06, 0x10, 0x88,
+	0x04, 0x09, 0xF0, 0x2F, 0x08, 0x08, 0x09, 0xF0, 0x3F, 0x07, 0x88, 0x01, 0x09, 0xF0, 0xF0, 0x19,
+	0x06, 0x0A, 0xF0, 0xF9, 0x86, 0x02, 0x19, 0xF0, 0xF9, 0x06, 0x1A, 0xF0, 0xE9, 0x06, 0x29, 0xF0,
+	0xE9, 0x86, 0x01, 0x2A, 0xF0, 0xD9, 0x86, 0x01, 0x3A, 0xF0, 0xC9, 0x06, 0x4A, 0xF0, 0xB9, 0x06,
+	0x4B, 0xF0, 0xA9, 0x06, 0x5B, 0xF0, 0x99, 0x06, 0x5C, 0xF0, 0x89, 0x06, 0x6C, 0xF0, 0x79, 0x06,
+	0x7C, 0xF0, 0x69, 0x06, 0x8E, 0xF0, 0x1B, 0x06, 0x9F, 0x01, 0x9F, 0x06, 0xAF, 0x0F, 0x09, 0x06,
+	0xBF, 0x0F, 0x08, 0x07, 0xDF, 0x0F, 0x05, 0x10, 0x07, 0xEF, 0x0F, 0x02, 0x30, 0x07, 0xF0, 0x1F,
+	0x0C, 0x60, 0x07, 0xF0, 0x4F, 0x06, 0x90, 0x05, 0xF0, 0x8D, 0xD0, 0x87, 0x0F, 0xF0, 0xF0, 0xF0,
+	0x40, 0x85, 0x0A, 0xF0, 0xF0, 0xE0, 0x07, 0x17, 0xF0, 0xD7, 0x10, 0x86, 0x18, 0x09, 0xF0, 0xB9,
+	0x86, 0x06, 0x0F, 0x0F, 0x0E, 0x86, 0x1A, 0x09, 0xF0, 0xB9, 0x07, 0x17, 0xF0, 0xD7, 0x10, 0x85,
+	0x10, 0xF0, 0xF0, 0xE0, 0x81, 0x0A, 0x90, 0x03, 0x17, 0x10, 0x82, 0x3A, 0x09, 0x03, 0x17, 0x10,
+	0x81, 0x10, 0x90, 0x83, 0x0A, 0xF0, 0x90, 0x05, 0xF0, 0x17, 0x10, 0x82, 0x31, 0xF9, 0x83, 0x01,
+	0xE9, 0x10, 0x05, 0x03, 0xAA, 0x10, 0x05, 0x05, 0x7B, 0x10, 0x85, 0x01, 0x0F, 0x07, 0x20, 0x05,
+	0x0F, 0x06, 0x30, 0x05, 0x0F, 0x05, 0x40, 0x05, 0x1F, 0x03, 0x50, 0x03, 0x2F, 0x70, 0x03, 0x59,
+	0xA0, 0x83, 0x0F, 0xF0, 0x90, 0x85, 0x0A, 0xF0, 0xF0, 0xA0, 0x07, 0x17, 0xF0, 0x97, 0x10, 0x87,
+	0x01, 0x09, 0xF0, 0x69, 0x10, 0x07, 0x09, 0xF0, 0x59, 0x20, 0x07, 0x09, 0xF0, 0x4A, 0x20, 0x07,
+	0x09, 0xF0, 0x3A, 0x30, 0x07, 0x09, 0xF0, 0x2A, 0x40, 0x07, 0x09, 0xF0, 0x29, 0x50, 0x07, 0x09,
+	0xF0, 0x19, 0x60, 0x05, 0x09, 0xFA, 0x60, 0x05, 0x09, 0xEA, 0x70, 0x05, 0x09, 0xDA, 0x80, 0x05,
+	0x09, 0xD9, 0x90, 0x05, 0x09, 0xC9, 0xA0, 0x05, 0x09, 0xB9, 0xB0, 0x05, 0x09, 0xAA, 0xB0, 0x05,
+	0x09, 0x9A, 0xC0, 0x05, 0x09, 0x99, 0xD0, 0x05, 0x09, 0x89, 0xE0, 0x05, 0x09, 0x79, 0xF0, 0x07,
+	0x09, 0x69, 0xF0, 0x10, 0x87, 0x01, 0x09, 0x59, 0xF0, 0x20, 0x07, 0x09, 0x49, 0xF0, 0x30, 0x07,
+	0x09, 0x39, 0xF0, 0x40, 0x07, 0x09, 0x29, 0xF0, 0x50, 0x07, 0x09, 0x19, 0xF0, 0x60, 0x07, 0x09,
+	0x18, 0xF0, 0x70, 0x07, 0x0F, 0x03, 0xF0, 0x70, 0x07, 0x0F, 0x04, 0xF0, 0x60, 0x07, 0x09, 0x19,
+	0xF0, 0x60, 0x07, 0x09, 0x29, 0xF0, 0x50, 0x07, 0x09, 0x2A, 0xF0, 0x40, 0x07, 0x09, 0x3A, 0xF0,
+	0x30, 0x07, 0x09, 0x49, 0xF0, 0x30, 0x07, 0x09, 0x59, 0xF0, 0x20, 0x07, 0x09, 0x5A, 0xF0, 0x10,
+	0x05, 0x09, 0x6A, 0xF0, 0x05, 0x09, 0x79, 0xF0, 0x05, 0x09, 0x89, 0xE0, 0x05, 0x09, 0x8A, 0xD0,
+	0x05, 0x09, 0x9A, 0xC0, 0x05, 0x09, 0xA9, 0xC0, 0x05, 0x09, 0xAA, 0xB0, 0x05, 0x09, 0xBA, 0xA0,
+	0x05, 0x09, 0xCA, 0x90, 0x05, 0x09, 0xD9, 0x90, 0x05, 0x09, 0xDA, 0x80, 0x05, 0x09, 0xEA, 0x70,
+	0x05, 0x09, 0xFA, 0x60, 0x07, 0x09, 0xF0, 0x19, 0x60, 0x07, 0x09, 0xF0, 0x1A, 0x50, 0x07, 0x09,
+	0xF0, 0x2A, 0x40, 0x07, 0x09, 0xF0, 0x3A, 0x30, 0x07, 0x09, 0xF0, 0x49, 0x30, 0x07, 0x09, 0xF0,
+	0x4A, 0x20, 0x07, 0x09, 0xF0, 0x5A, 0x10, 0x06, 0x09, 0xF0, 0x6A, 0x86, 0x01, 0x09, 0xF0, 0x79,
+	0x06, 0x17, 0xF0, 0x98, 0x85, 0x10, 0xF0, 0xF0, 0xA0, 0x85, 0x0A, 0xF0, 0xF0, 0x10, 0x05, 0x17,
+	0xF0, 0x80, 0x85, 0x34, 0x09, 0xF0, 0x70, 0x05, 0x0F, 0x0F, 0x10, 0x86, 0x04, 0x0F, 0x0F, 0x01,
+	0x05, 0x1F, 0x0E, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0x10, 0x89, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0x60,
+	0x09, 0x2A, 0xF0, 0xF0, 0xCA, 0x20, 0x09, 0x1D, 0xF0, 0xF0, 0x8D, 0x10, 0x08, 0x0F, 0xF0, 0xF0,
+	0x6F, 0x0A, 0x0F, 0x01, 0xF0, 0xF0, 0x5F, 0x0C, 0x0F, 0x01, 0xF0, 0xF0, 0x4F, 0x01, 0x8C, 0x01,
+	0x0F, 0x02, 0xF0, 0xF0, 0x3F, 0x01, 0x0C, 0x0F, 0x02, 0xF0, 0xF0, 0x2F, 0x02, 0x0C, 0x09, 0x18,
+	0xF0, 0xF0, 0x17, 0x19, 0x0A, 0x09, 0x18, 0xF0, 0xF8, 0x19, 0x0A, 0x09, 0x18, 0xF0, 0xF7, 0x29,
+	0x0A, 0x09, 0x28, 0xF0, 0xE7, 0x29, 0x0A, 0x09, 0x28, 0xF0, 0xD8, 0x29, 0x8A, 0x01, 0x09, 0x38,
+	0xF0, 0xC7, 0x39, 0x0A, 0x09, 0x38, 0xF0, 0xB8, 0x39, 0x0A, 0x09, 0x48, 0xF0, 0xA7, 0x49, 0x0A,
+	0x09, 0x48, 0xF0, 0x98, 0x49, 0x0A, 0x09, 0x48, 0xF0, 0x97, 0x59, 0x0A, 0x09, 0x58, 0xF0, 0x87,
+	0x59, 0x0A, 0x09, 0x58, 0xF0, 0x78, 0x59, 0x0A, 0x09, 0x68, 0xF0, 0x67, 0x69, 0x0A, 0x09, 0x68,
+	0xF0, 0x58, 0x69, 0x0A, 0x09, 0x68, 0xF0, 0x57, 0x79, 0x0A, 0x09, 0x78, 0xF0, 0x47, 0x79, 0x0A,
+	0x09, 0x78, 0xF0, 0x38, 0x79, 0x0A, 0x09, 0x79, 0xF0, 0x27, 0x89, 0x8A, 0x01, 0x09, 0x88, 0xF0,
+	0x18, 0x89, 0x08, 0x09, 0x98, 0xF7, 0x99, 0x08, 0x09, 0x98, 0xE8, 0x99, 0x08, 0x09, 0x98, 0xE7,
+	0xA9, 0x08, 0x09, 0xA8, 0xD7, 0xA9, 0x08, 0x09, 0xA8, 0xC8, 0xA9, 0x08, 0x09, 0xA9, 0xB7, 0xB9,
+	0x88, 0x01, 0x09, 0xB8, 0xA8, 0xB9, 0x08, 0x09, 0xC8, 0x97, 0xC9, 0x08, 0x09, 0xC8, 0x88, 0xC9,
+	0x08, 0x09, 0xC8, 0x87, 0xD9, 0x88, 0x01, 0x09, 0xD8, 0x68, 0xD9, 0x08, 0x09, 0xD9, 0x57, 0xE9,
+	0x08, 0x09, 0xE8, 0x48, 0xE9, 0x08, 0x09, 0xE8, 0x47, 0xF9, 0x08, 0x09, 0xE9, 0x37, 0xF9, 0x08,
+	0x09, 0xF8, 0x28, 0xF9, 0x0A, 0x09, 0xF8, 0x27, 0xF0, 0x19, 0x8C, 0x01, 0x09, 0xF0, 0x1F, 0x01,
+	0xF0, 0x19, 0x0A, 0x09, 0xF0, 0x1F, 0xF0, 0x29, 0x0A, 0x09, 0xF0, 0x2E, 0xF0, 0x29, 0x8A, 0x01,
+	0x09, 0xF0, 0x2D, 0xF0, 0x39, 0x0A, 0x09, 0xF0, 0x3C, 0xF0, 0x39, 0x0A, 0x09, 0xF0, 0x3B, 0xF0,
+	0x49, 0x8A, 0x01, 0x09, 0xF0, 0x4A, 0xF0, 0x49, 0x0A, 0x09, 0xF0, 0x49, 0xF0, 0x59, 0x0A, 0x09,
+	0xF0, 0x58, 0xF0, 0x59, 0x0B, 0x17, 0xF0, 0x76, 0xF0, 0x77, 0x10, 0x89, 0x10, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x60, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0x10, 0x07, 0x29, 0xF0, 0xC7, 0x10, 0x06, 0x0D, 0xF0,
+	0x99, 0x06, 0x0E, 0xF0, 0x89, 0x86, 0x01, 0x0F, 0xF0, 0x79, 0x88, 0x01, 0x0F, 0x01, 0xF0, 0x69,
+	0x88, 0x01, 0x0F, 0x02, 0xF0, 0x59, 0x08, 0x0F, 0x03, 0xF0, 0x49, 0x08, 0x09, 0x18, 0xF0, 0x49,
+	0x08, 0x09, 0x19, 0xF0, 0x39, 0x08, 0x09, 0x28, 0xF0, 0x39, 0x88, 0x01, 0x09, 0x29, 0xF0, 0x29,
+	0x88, 0x01, 0x09, 0x39, 0xF0, 0x19, 0x86, 0x01, 0x09, 0x49, 0xF9, 0x06, 0x09, 0x58, 0xF9, 0x06,
+	0x09, 0x59, 0xE9, 0x06, 0x09, 0x68, 0xE9, 0x06, 0x09, 0x69, 0xD9, 0x06, 0x09, 0x78, 0xD9, 0x06,
+	0x09, 0x79, 0xC9, 0x06, 0x09, 0x88, 0xC9, 0x06, 0x09, 0x89, 0xB9, 0x06, 0x09, 0x98, 0xB9, 0x06,
+	0x09, 0x99, 0xA9, 0x06, 0x09, 0xA8, 0xA9, 0x06, 0x09, 0xA9, 0x99, 0x06, 0x09, 0xB8, 0x99, 0x06,
+	0x09, 0xB9, 0x89, 0x06, 0x09, 0xC8, 0x89, 0x06, 0x09, 0xC9, 0x79, 0x06, 0x09, 0xD8, 0x79, 0x06,
+	0x09, 0xD9, 0x69, 0x06, 0x09, 0xE8, 0x69, 0x06, 0x09, 0xE9, 0x59, 0x06, 0x09, 0xF8, 0x59, 0x06,
+	0x09, 0xF9, 0x49, 0x08, 0x09, 0xF0, 0x18, 0x49, 0x08, 0x09, 0xF0, 0x19, 0x39, 0x08, 0x09, 0xF0,
+	0x28, 0x39, 0x08, 0x09, 0xF0, 0x29, 0x29, 0x08, 0x09, 0xF0, 0x38, 0x29, 0x08, 0x09, 0xF0, 0x39,
+	0x19, 0x08, 0x09, 0xF0, 0x48, 0x19, 0x08, 0x09, 0xF0, 0x4F, 0x03, 0x88, 0x01, 0x09, 0xF0, 0x5F,
+	0x02, 0x88, 0x01, 0x09, 0xF0, 0x6F, 0x01, 0x86, 0x01, 0x09, 0xF0, 0x7F, 0x86, 0x01, 0x09, 0xF0,
+	0x8E, 0x06, 0x09, 0xF0, 0x9D, 0x06, 0x09, 0xF0, 0xAC, 0x07, 0x09, 0xF0, 0xBA, 0x10, 0x07, 0x17,
+	0xF0, 0xD8, 0x20, 0x87, 0x10, 0xF0, 0xF0, 0xF0, 0x10, 0x87, 0x09, 0xF0, 0xF0, 0xF0, 0x90, 0x07,
+	0xF0, 0x6D, 0xF0, 0x50, 0x09, 0xF0, 0x3F, 0x05, 0xF0, 0x10, 0x05, 0xFF, 0x0A, 0xE0, 0x05, 0xDF,
+	0x0E, 0xC0, 0x07, 0xBF, 0x0F, 0x03, 0xA0, 0x07, 0xAF, 0x0F, 0x05, 0x90, 0x07, 0x9F, 0x0F, 0x07,
+	0x80, 0x05, 0x8E, 0xAF, 0x70, 0x05, 0x7D, 0xFD, 0x60, 0x07, 0x6C, 0xF0, 0x4C, 0x50, 0x07, 0x5B,
+	0xF0, 0x7B, 0x50, 0x07, 0x5A, 0xF0, 0x9B, 0x40, 0x07, 0x4A, 0xF0, 0xBA, 0x40, 0x07, 0x4A, 0xF0,
+	0xCA, 0x30, 0x07, 0x3A, 0xF0, 0xDA, 0x30, 0x07, 0x39, 0xF0, 0xFA, 0x20, 0x09, 0x2A, 0xF0, 0xF0,
+	0x19, 0x20, 0x09, 0x29, 0xF0, 0xF0, 0x29, 0x20, 0x09, 0x29, 0xF0, 0xF0, 0x2A, 0x10, 0x09, 0x29,
+	0xF0, 0xF0, 0x39, 0x10, 0x89, 0x02, 0x19, 0xF0, 0xF0, 0x49, 0x10, 0x08, 0x19, 0xF0, 0xF0, 0x4A,
+	0x88, 0x0D, 0x09, 0xF0, 0xF0, 0x69, 0x09, 0x09, 0xF0, 0xF0, 0x59, 0x10, 0x09, 0x0A, 0xF0, 0xF0,
+	0x49, 0x10, 0x89, 0x02, 0x19, 0xF0, 0xF0, 0x49, 0x10, 0x09, 0x19, 0xF0, 0xF0, 0x39, 0x20, 0x09,
+	0x1A, 0xF0, 0xF0, 0x29, 0x20, 0x09, 0x29, 0xF0, 0xF0, 0x29, 0x20, 0x09, 0x29, 0xF0, 0xF0, 0x1A,
+	0x20, 0x07, 0x2A, 0xF0, 0xF9, 0x30, 0x07, 0x39, 0xF0, 0xEA, 0x30, 0x07, 0x3A, 0xF0, 0xCA, 0x40,
+	0x07, 0x4A, 0xF0, 0xBA, 0x40, 0x07, 0x4B, 0xF0, 0x9A, 0x50, 0x07, 0x5B, 0xF0, 0x7A, 0x60, 0x07,
+	0x5C, 0xF0, 0x4C, 0x60, 0x05, 0x6D, 0xFD, 0x70, 0x05, 0x7F, 0xAE, 0x80, 0x07, 0x8F, 0x0F, 0x07,
+	0x90, 0x07, 0x9F, 0x0F, 0x05, 0xA0, 0x07, 0xAF, 0x0F, 0x03, 0xB0, 0x05, 0xCF, 0x0E, 0xD0, 0x05,
+	0xEF, 0x0A, 0xF0, 0x09, 0xF0, 0x1F, 0x06, 0xF0, 0x20, 0x07, 0xF0, 0x5D, 0xF0, 0x60, 0x87, 0x0F,
+	0xF0, 0xF0, 0xF0, 0x90, 0x85, 0x0A, 0xF0, 0xF0, 0x70, 0x05, 0x1F, 0x06, 0xF0, 0x05, 0x0F, 0x0B,
+	0xB0, 0x05, 0x0F, 0x0D, 0x90, 0x05, 0x0F, 0x0F, 0x70, 0x07, 0x0F, 0x0F, 0x01, 0x60, 0x07, 0x0F,
+	0x0F, 0x02, 0x50, 0x07, 0x0F, 0x0F, 0x03, 0x40, 0x05, 0x09, 0xCD, 0x30, 0x05, 0x09, 0xEC, 0x20,
+	0x05, 0x09, 0xFB, 0x20, 0x07, 0x09, 0xF0, 0x1B, 0x10, 0x07, 0x09, 0xF0, 0x2A, 0x10, 0x07, 0x09,
+	0xF0, 0x39, 0x10, 0x06, 0x09, 0xF0, 0x3A, 0x86, 0x08, 0x09, 0xF0, 0x49, 0x87, 0x01, 0x09, 0xF0,
+	0x39, 0x10, 0x07, 0x09, 0xF0, 0x2A, 0x10, 0x07, 0x09, 0xF0, 0x29, 0x20, 0x07, 0x09, 0xF0, 0x1A,
+	0x20, 0x05, 0x09, 0xFB, 0x20, 0x05, 0x09, 0xDC, 0x30, 0x05, 0x09, 0xBD, 0x40, 0x87, 0x01, 0x0F,
+	0x0F, 0x02, 0x50, 0x05, 0x0F, 0x0F, 0x70, 0x05, 0x0F, 0x0E, 0x80, 0x05, 0x0F, 0x0C, 0xA0, 0x05,
+	0x0F, 0x0A, 0xC0, 0x07, 0x0F, 0x06, 0xF0, 0x10, 0x85, 0x15, 0x09, 0xF0, 0xD0, 0x05, 0x17, 0xF0,
+	0xE0, 0x85, 0x10, 0xF0, 0xF0, 0x70, 0x89, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x07, 0xF0, 0x6D,
+	0xF0, 0xC0, 0x09, 0xF0, 0x3F, 0x05, 0xF0, 0x80, 0x07, 0xFF, 0x0A, 0xF0, 0x60, 0x07, 0xDF, 0x0E,
+	0xF0, 0x40, 0x09, 0xBF, 0x0F, 0x03, 0xF0, 0x20, 0x09, 0xAF, 0x0F, 0x05, 0xF0, 0x10, 0x07, 0x9F,
+	0x0F, 0x07, 0xF0, 0x05, 0x8E, 0xAF, 0xE0, 0x05, 0x7D, 0xFD, 0xD0, 0x07, 0x6C, 0xF0, 0x4C, 0xC0,
+	0x07, 0x5B, 0xF0, 0x7B, 0xC0, 0x07, 0x5A, 0xF0, 0x9B, 0xB0, 0x07, 0x4A, 0xF0, 0xBA, 0xB0, 0x07,
+	0x4A, 0xF0, 0xCA, 0xA0, 0x07, 0x3A, 0xF0, 0xDA, 0xA0, 0x07, 0x39, 0xF0, 0xFA, 0x90, 0x09, 0x2A,
+	0xF0, 0xF0, 0x19, 0x90, 0x09, 0x29, 0xF0, 0xF0, 0x29, 0x90, 0x09, 0x29, 0xF0, 0xF0, 0x2A, 0x80,
+	0x09, 0x1A, 0xF0, 0xF0, 0x39, 0x80, 0x89, 0x02, 0x19, 0xF0, 0xF0, 0x49, 0x80, 0x09, 0x19, 0xF0,
+	0xF0, 0x4A, 0x70, 0x89, 0x0D, 0x09, 0xF0, 0xF0, 0x69, 0x70, 0x09, 0x09, 0xF0, 0xF0, 0x5A, 0x70,
+	0x09, 0x0A, 0xF0, 0xF0, 0x49, 0x80, 0x89, 0x02, 0x19, 0xF0, 0xF0, 0x49, 0x80, 0x09, 0x19, 0xF0,
+	0xF0, 0x3A, 0x80, 0x09, 0x1A, 0xF0, 0xF0, 0x29, 0x90, 0x09, 0x29, 0xF0, 0xF0, 0x29, 0x90, 0x09,
+	0x29, 0xF0, 0xF0, 0x1A, 0x90, 0x07, 0x2A, 0xF0, 0xF9, 0xA0, 0x07, 0x39, 0xF0, 0xEA, 0xA0, 0x07,
+	0x3A, 0xF0, 0xCA, 0xB0, 0x07, 0x4A, 0xF0, 0xBA, 0xB0, 0x07, 0x4B, 0xF0, 0x9A, 0xC0, 0x07, 0x5B,
+	0xF0, 0x7B, 0xC0, 0x07, 0x5C, 0xF0, 0x4C, 0xD0, 0x05, 0x6D, 0xFD, 0xE0, 0x05, 0x7F, 0xAF, 0xE0,
+	0x07, 0x8F, 0x0F, 0x0A, 0xD0, 0x07, 0x9F, 0x0F, 0x0A, 0xC0, 0x07, 0xAF, 0x0F, 0x0B, 0xA0, 0x07,
+	0xCF, 0x0F, 0x0A, 0x90, 0x07, 0xEF, 0x09, 0x3D, 0x70, 0x09, 0xF0, 0x1F, 0x05, 0x6E, 0x50, 0x07,
+	0xF0, 0x5C, 0xCE, 0x30, 0x07, 0xF0, 0xF0, 0xFF, 0x10, 0x08, 0xF0, 0xF0, 0xF0, 0x1F, 0x08, 0xF0,
+	0xF0, 0xF0, 0x3D, 0x08, 0xF0, 0xF0, 0xF0, 0x4C, 0x08, 0xF0, 0xF0, 0xF0, 0x6A, 0x08, 0xF0, 0xF0,
+	0xF0, 0x88, 0x08, 0xF0, 0xF0, 0xF0, 0xA6, 0x09, 0xF0, 0xF0, 0xF0, 0xC3, 0x10, 0x89, 0x07, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x10, 0x85, 0x0A, 0xF0, 0xF0, 0xB0, 0x07, 0x1F, 0x07, 0xF0, 0x30, 0x05, 0x0F,
+	0x0C, 0xE0, 0x05, 0x0F, 0x0E, 0xC0, 0x07, 0x0F, 0x0F, 0x01, 0xA0, 0x07, 0x0F, 0x0F, 0x02, 0x90,
+	0x07, 0x0F, 0x0F, 0x03, 0x80, 0x07, 0x0F, 0x0F, 0x04, 0x70, 0x05, 0x09, 0xCE, 0x60, 0x05, 0x09,
+	0xFB, 0x60, 0x07, 0x09, 0xF0, 0x1B, 0x50, 0x07, 0x09, 0xF0, 0x2A, 0x50, 0x07, 0x09, 0xF0, 0x39,
+	0x50, 0x07, 0x09, 0xF0, 0x3A, 0x40, 0x87, 0x06, 0x09, 0xF0, 0x49, 0x40, 0x07, 0x09, 0xF0, 0x3A,
+	0x40, 0x87, 0x01, 0x09, 0xF0, 0x39, 0x50, 0x07, 0x09, 0xF0, 0x29, 0x60, 0x07, 0x09, 0xF0, 0x1A,
+	0x60, 0x05, 0x09, 0xEB, 0x70, 0x05, 0x09, 0xCC, 0x80, 0x07, 0x0F, 0x0F, 0x02, 0x90, 0x07, 0x0F,
+	0x0F, 0x01, 0xA0, 0x05, 0x0F, 0x0F, 0xB0, 0x05, 0x0F, 0x0D, 0xD0, 0x05, 0x0F, 0x0B, 0xF0, 0x05,
+	0x0F, 0x0D, 0xD0, 0x05, 0x0F, 0x0E, 0xC0, 0x05, 0x09, 0x9C, 0xB0, 0x05, 0x09, 0xBB, 0xA0, 0x05,
+	0x09, 0xD9, 0xA0, 0x85, 0x01, 0x09, 0xE9, 0x90, 0x05, 0x09, 0xF9, 0x80, 0x07, 0x09, 0xF0, 0x18,
+	0x80, 0x07, 0x09, 0xF0, 0x19, 0x70, 0x07, 0x09, 0xF0, 0x28, 0x70, 0x87, 0x01, 0x09, 0xF0, 0x29,
+	0x60, 0x87, 0x01, 0x09, 0xF0, 0x39, 0x50, 0x07, 0x09, 0xF0, 0x48, 0x50, 0x87, 0x01, 0x09, 0xF0,
+	0x49, 0x40, 0x87, 0x01, 0x09, 0xF0, 0x59, 0x30, 0x07, 0x09, 0xF0, 0x68, 0x30, 0x87, 0x01, 0x09,
+	0xF0, 0x69, 0x20, 0x87, 0x01, 0x09, 0xF0, 0x79, 0x10, 0x07, 0x09, 0xF0, 0x88, 0x10, 0x86, 0x01,
+	0x09, 0xF0, 0x89, 0x07, 0x17, 0xF0, 0xA7, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0xB0, 0x85, 0x09, 0xF0,
+	0xF0, 0x70, 0x03, 0xFA, 0xC0, 0x05, 0xBF, 0x03, 0x80, 0x05, 0x9F, 0x07, 0x60, 0x05, 0x7F, 0x0B,
+	0x40, 0x05, 0x6F, 0x0D, 0x30, 0x05, 0x5F, 0x0E, 0x30, 0x05, 0x4F, 0x0F, 0x30, 0x05, 0x3D, 0x8A,
+	0x30, 0x05, 0x3B, 0xD7, 0x30, 0x07, 0x2A, 0xF0, 0x25, 0x30, 0x07, 0x29, 0xF0, 0x53, 0x30, 0x05,
+	0x29, 0xF0, 0xB0, 0x85, 0x05, 0x19, 0xF0, 0xC0, 0x85, 0x01, 0x1A, 0xF0, 0xB0, 0x05, 0x2A, 0xF0,
+	0xA0, 0x05, 0x2B, 0xF0, 0x90, 0x05, 0x2C, 0xF0, 0x80, 0x05, 0x3C, 0xF0, 0x70, 0x05, 0x3E, 0xF0,
+	0x50, 0x05, 0x4E, 0xF0, 0x40, 0x07, 0x5F, 0x01, 0xF0, 0x10, 0x05, 0x6F, 0x02, 0xE0, 0x05, 0x7F,
+	0x03, 0xC0, 0x05, 0x8F, 0x04, 0xA0, 0x05, 0x9F, 0x04, 0x90, 0x05, 0xBF, 0x04, 0x70, 0x05, 0xDF,
+	0x03, 0x60, 0x05, 0xFF, 0x02, 0x50, 0x07, 0xF0, 0x2F, 0x01, 0x40, 0x05, 0xF0, 0x4F, 0x30, 0x05,
+	0xF0, 0x6E, 0x20, 0x05, 0xF0, 0x8C, 0x20, 0x05, 0xF0, 0x9C, 0x10, 0x05, 0xF0, 0xAB, 0x10, 0x05,
+	0xF0, 0xBA, 0x10, 0x84, 0x01, 0xF0, 0xCA, 0x84, 0x05, 0xF0, 0xD9, 0x04, 0xF0, 0xCA, 0x05, 0xF0,
+	0xC9, 0x10, 0x07, 0x12, 0xF0, 0x8A, 0x10, 0x07, 0x04, 0xF0, 0x79, 0x20, 0x07, 0x06, 0xF0, 0x4A,
+	0x20, 0x05, 0x09, 0xEB, 0x30, 0x05, 0x0C, 0x9D, 0x30, 0x07, 0x0F, 0x0F, 0x03, 0x40, 0x07, 0x0F,
+	0x0F, 0x02, 0x50, 0x05, 0x1F, 0x0F, 0x60, 0x05, 0x2F, 0x0D, 0x70, 0x05, 0x4F, 0x09, 0x90, 0x05,
+	0x7F, 0x04, 0xB0, 0x03, 0xBB, 0xF0, 0x85, 0x0F, 0xF0, 0xF0, 0x70, 0x87, 0x0A, 0xF0, 0xF0, 0xF0,
+	0x20, 0x07, 0x1F, 0x0F, 0x0F, 0x10, 0x88, 0x04, 0x0F, 0x0F, 0x0F, 0x02, 0x07, 0x1F, 0x0F, 0x0F,
+	0x10, 0x87, 0x34, 0xF0, 0x49, 0xF0, 0x40, 0x07, 0xF0, 0x57, 0xF0, 0x50, 0x87, 0x10, 0xF0, 0xF0,
+	0xF0, 0x20, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0x10, 0x07, 0x17, 0xF0, 0xF7, 0x10, 0x86, 0x2A, 0x09,
+	0xF0, 0xD9, 0x07, 0x0A, 0xF0, 0xB9, 0x10, 0x87, 0x01, 0x19, 0xF0, 0xB9, 0x10, 0x07, 0x1A, 0xF0,
+	0x9A, 0x10, 0x07, 0x1A, 0xF0, 0x99, 0x20, 0x07, 0x2A, 0xF0, 0x7A, 0x20, 0x07, 0x2B, 0xF0, 0x6A,
+	0x20, 0x07, 0x3A, 0xF0, 0x5A, 0x30, 0x07, 0x3C, 0xF0, 0x2A, 0x40, 0x05, 0x4C, 0xEC, 0x40, 0x05,
+	0x5E, 0x8E, 0x50, 0x07, 0x5F, 0x0F, 0x05, 0x60, 0x07, 0x6F, 0x0F, 0x03, 0x70, 0x05, 0x8F, 0x0F,
+	0x80, 0x05, 0x9F, 0x0C, 0xA0, 0x05, 0xBF, 0x09, 0xB0, 0x05, 0xDF, 0x04, 0xE0, 0x07, 0xF0, 0x2B,
+	0xF0, 0x30, 0x87, 0x0F, 0xF0, 0xF0, 0xF0, 0x10, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0x60, 0x08, 0x08,
+	0xF0, 0xF0, 0x67, 0x88, 0x01, 0x09, 0xF0, 0xF0, 0x48, 0x08, 0x18, 0xF0, 0xF0, 0x39, 0x89, 0x01,
+	0x19, 0xF0, 0xF0, 0x28, 0x10, 0x09, 0x28, 0xF0, 0xF0, 0x19, 0x10, 0x87, 0x01, 0x29, 0xF0, 0xF8,
+	0x20, 0x07, 0x38, 0xF0, 0xE8, 0x30, 0x87, 0x01, 0x39, 0xF0, 0xD8, 0x30, 0x07, 0x48, 0xF0, 0xC8,
+	0x40, 0x87, 0x01, 0x49, 0xF0, 0xB8, 0x40, 0x07, 0x58, 0xF0, 0xA8, 0x50, 0x87, 0x01, 0x59, 0xF0,
+	0x98, 0x50, 0x07, 0x68, 0xF0, 0x88, 0x60, 0x07, 0x69, 0xF0, 0x78, 0x60, 0x07, 0x78, 0xF0, 0x78,
+	0x60, 0x07, 0x78, 0xF0, 0x68, 0x70, 0x07, 0x79, 0xF0, 0x58, 0x70, 0x07, 0x88, 0xF0, 0x58, 0x70,
+	0x07, 0x88, 0xF0, 0x48, 0x80, 0x07, 0x89, 0xF0, 0x38, 0x80, 0x07, 0x98, 0xF0, 0x37, 0x90, 0x07,
+	0x98, 0xF0, 0x28, 0x90, 0x07, 0x99, 0xF0, 0x18, 0x90, 0x07, 0xA8, 0xF0, 0x17, 0xA0, 0x05, 0xA8,
+	0xF8, 0xA0, 0x05, 0xA9, 0xE8, 0xA0, 0x05, 0xB8, 0xE7, 0xB0, 0x85, 0x01, 0xB9, 0xC8, 0xB0, 0x05,
+	0xC8, 0xC7, 0xC0, 0x05, 0xC9, 0xA8, 0xC0, 0x05, 0xD8, 0xA8, 0xC0, 0x05, 0xD8, 0xA7, 0xD0, 0x05,
+	0xD9, 0x88, 0xD0, 0x05, 0xE8, 0x88, 0xD0, 0x05, 0xE8, 0x87, 0xE0, 0x05, 0xE9, 0x68, 0xE0, 0x85,
+	0x01, 0xF8, 0x67, 0xF0, 0x05, 0xF9, 0x48, 0xF0, 0x89, 0x01, 0xF0, 0x18, 0x47, 0xF0, 0x10, 0x09,
+	0xF0, 0x19, 0x28, 0xF0, 0x10, 0x89, 0x01, 0xF0, 0x28, 0x27, 0xF0, 0x20, 0x09, 0xF0, 0x2F, 0x02,
+	0xF0, 0x20, 0x87, 0x01, 0xF0, 0x3F, 0xF0, 0x30, 0x07, 0xF0, 0x4E, 0xF0, 0x30, 0x87, 0x01, 0xF0,
+	0x4D, 0xF0, 0x40, 0x07, 0xF0, 0x5C, 0xF0, 0x40, 0x87, 0x01, 0xF0, 0x5B, 0xF0, 0x50, 0x07, 0xF0,
+	0x69, 0xF0, 0x60, 0x87, 0x10, 0xF0, 0xF0, 0xF0, 0x60, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x40, 0x0A, 0x08, 0xF0, 0xD7, 0xF0, 0xE7, 0x0A, 0x08, 0xF0, 0xC9, 0xF0, 0xC8, 0x8A, 0x01, 0x09,
+	0xF0, 0xB9, 0xF0, 0xC8, 0x0A, 0x18, 0xF0, 0xAB, 0xF0, 0xB8, 0x0A, 0x18, 0xF0, 0xAB, 0xF0, 0xA9,
+	0x0B, 0x19, 0xF0, 0x9B, 0xF0, 0xA8, 0x10, 0x0B, 0x19, 0xF0, 0x9C, 0xF0, 0x98, 0x10, 0x0B, 0x28,
+	0xF0, 0x8D, 0xF0, 0x98, 0x10, 0x0B, 0x28, 0xF0, 0x8D, 0xF0, 0x88, 0x20, 0x0B, 0x29, 0xF0, 0x7D,
+	0xF0, 0x88, 0x20, 0x0B, 0x38, 0xF0, 0x7E, 0xF0, 0x78, 0x20, 0x0B, 0x38, 0xF0, 0x6F, 0xF0, 0x78,
+	0x20, 0x0B, 0x39, 0xF0, 0x5F, 0xF0, 0x68, 0x30, 0x0D, 0x39, 0xF0, 0x57, 0x18, 0xF0, 0x58, 0x30,
+	0x0D, 0x48, 0xF0, 0x57, 0x18, 0xF0, 0x58, 0x30, 0x0D, 0x48, 0xF0, 0x47, 0x28, 0xF0, 0x48, 0x40,
+	0x0D, 0x49, 0xF0, 0x37, 0x28, 0xF0, 0x48, 0x40, 0x0D, 0x58, 0xF0, 0x37, 0x38, 0xF0, 0x38, 0x40,
+	0x0D, 0x58, 0xF0, 0x28, 0x38, 0xF0, 0x38, 0x40, 0x0D, 0x58, 0xF0, 0x27, 0x48, 0xF0, 0x28, 0x50,
+	0x0D, 0x59, 0xF0, 0x17, 0x57, 0xF0, 0x28, 0x50, 0x0D, 0x68, 0xF0, 0x17, 0x58, 0xF0, 0x18, 0x50,
+	0x0B, 0x68, 0xF8, 0x58, 0xF0, 0x17, 0x60, 0x09, 0x69, 0xE7, 0x68, 0xF8, 0x60, 0x09, 0x78, 0xE7,
+	0x78, 0xE8, 0x60, 0x09, 0x78, 0xE7, 0x78, 0xE7, 0x70, 0x09, 0x78, 0xD7, 0x88, 0xE7, 0x70, 0x09,
+	0x79, 0xC7, 0x88, 0xD8, 0x70, 0x09, 0x88, 0xC7, 0x98, 0xC8, 0x70, 0x09, 0x88, 0xC7, 0x98, 0xC7,
+	0x80, 0x09, 0x88, 0xB7, 0xA8, 0xC7, 0x80, 0x09, 0x98, 0xA7, 0xB7, 0xB8, 0x80, 0x89, 0x01, 0x98,
+	0xA7, 0xB8, 0xA7, 0x90, 0x09, 0x99, 0x87, 0xC8, 0x98, 0x90, 0x09, 0xA8, 0x87, 0xD8, 0x88, 0x90,
+	0x89, 0x01, 0xA8, 0x87, 0xD8, 0x87, 0xA0, 0x09, 0xB8, 0x67, 0xF7, 0x78, 0xA0, 0x89, 0x02, 0xB8,
+	0x67, 0xF8, 0x67, 0xB0, 0x0B, 0xC8, 0x47, 0xF0, 0x28, 0x48, 0xB0, 0x8B, 0x01, 0xC8, 0x47, 0xF0,
+	0x28, 0x47, 0xC0, 0x0B, 0xD7, 0x47, 0xF0, 0x28, 0x47, 0xC0, 0x8B, 0x01, 0xD8, 0x27, 0xF0, 0x48,
+	0x27, 0xD0, 0x0B, 0xE7, 0x27, 0xF0, 0x48, 0x27, 0xD0, 0x0B, 0xE8, 0x17, 0xF0, 0x57, 0x27, 0xD0,
+	0x87, 0x01, 0xEF, 0xF0, 0x6F, 0xE0, 0x07, 0xFE, 0xF0, 0x6F, 0xE0, 0x07, 0xFE, 0xF0, 0x7D, 0xF0,
+	0x07, 0xFD, 0xF0, 0x8D, 0xF0, 0x09, 0xF0, 0x1C, 0xF0, 0x8D, 0xF0, 0x09, 0xF0, 0x1C, 0xF0, 0x9C,
+	0xF0, 0x0B, 0xF0, 0x1C, 0xF0, 0x9B, 0xF0, 0x10, 0x0B, 0xF0, 0x1B, 0xF0, 0xAB, 0xF0, 0x10, 0x0B,
+	0xF0, 0x29, 0xF0, 0xC9, 0xF0, 0x20, 0x8B, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x85, 0x0A,
+	0xF0, 0xF0, 0xF0, 0x07, 0x18, 0xF0, 0xD7, 0x10, 0x06, 0x19, 0xF0, 0xB9, 0x07, 0x1A, 0xF0, 0xA8,
+	0x10, 0x07, 0x29, 0xF0, 0x99, 0x10, 0x07, 0x39, 0xF0, 0x79, 0x20, 0x07, 0x3A, 0xF0, 0x69, 0x20,
+	0x07, 0x49, 0xF0, 0x59, 0x30, 0x07, 0x4A, 0xF0, 0x48, 0x40, 0x07, 0x59, 0xF0, 0x39, 0x40, 0x07,
+	0x69, 0xF0, 0x28, 0x50, 0x07, 0x69, 0xF0, 0x19, 0x50, 0x05, 0x79, 0xE9, 0x60, 0x05, 0x7A, 0xD9,
+	0x60, 0x05, 0x89, 0xC9, 0x70, 0x05, 0x99, 0xB8, 0x80, 0x05, 0x99, 0xA9, 0x80, 0x05, 0xA9, 0x98,
+	0x90, 0x05, 0xA9, 0x89, 0x90, 0x05, 0xB9, 0x69, 0xA0, 0x05, 0xBA, 0x58, 0xB0, 0x05, 0xC9, 0x49,
+	0xB0, 0x05, 0xD9, 0x38, 0xC0, 0x05, 0xD9, 0x29, 0xC0, 0x05, 0xE9, 0x18, 0xD0, 0x05, 0xEF, 0x02,
+	0xE0, 0x05, 0xFF, 0x01, 0xE0, 0x85, 0x01, 0xF0, 0x1E, 0xF0, 0x07, 0xF0, 0x2C, 0xF0, 0x10, 0x07,
+	0xF0, 0x2B, 0xF0, 0x20, 0x87, 0x01, 0xF0, 0x2C, 0xF0, 0x10, 0x85, 0x01, 0xF0, 0x1E, 0xF0, 0x05,
+	0xFF, 0x01, 0xE0, 0x05, 0xEF, 0x03, 0xD0, 0x05, 0xE8, 0x19, 0xD0, 0x05, 0xD9, 0x29, 0xC0, 0x05,
+	0xD8, 0x39, 0xC0, 0x05, 0xC9, 0x49, 0xB0, 0x05, 0xB9, 0x69, 0xA0, 0x05, 0xB8, 0x79, 0xA0, 0x05,
+	0xA9, 0x89, 0x90, 0x05, 0xA8, 0x99, 0x90, 0x05, 0x99, 0xA9, 0x80, 0x05, 0x89, 0xB9, 0x80, 0x05,
+	0x89, 0xC9, 0x70, 0x05, 0x79, 0xE9, 0x60, 0x05, 0x78, 0xF9, 0x60, 0x07, 0x69, 0xF0, 0x19, 0x50,
+	0x07, 0x59, 0xF0, 0x29, 0x50, 0x07, 0x59, 0xF0, 0x39, 0x40, 0x07, 0x49, 0xF0, 0x4A, 0x30, 0x07,
+	0x49, 0xF0, 0x59, 0x30, 0x07, 0x39, 0xF0, 0x6A, 0x20, 0x07, 0x29, 0xF0, 0x89, 0x20, 0x07, 0x29,
+	0xF0, 0x99, 0x10, 0x07, 0x19, 0xF0, 0xA9, 0x10, 0x06, 0x19, 0xF0, 0xB9, 0x06, 0x09, 0xF0, 0xC9,
+	0x06, 0x17, 0xF0, 0xE8, 0x85, 0x10, 0xF0, 0xF0, 0xF0, 0x85, 0x0A, 0xF0, 0xF0, 0xF0, 0x07, 0x08,
+	0xF0, 0xE7, 0x10, 0x06, 0x09, 0xF0, 0xC9, 0x07, 0x19, 0xF0, 0xB8, 0x10, 0x07, 0x19, 0xF0, 0xA9,
+	0x10, 0x07, 0x28, 0xF0, 0xA8, 0x20, 0x07, 0x29, 0xF0, 0x89, 0x20, 0x07, 0x38, 0xF0, 0x88, 0x30,
+	0x07, 0x39, 0xF0, 0x69, 0x30, 0x07, 0x48, 0xF0, 0x68, 0x40, 0x07, 0x49, 0xF0, 0x49, 0x40, 0x07,
+	0x58, 0xF0, 0x48, 0x50, 0x07, 0x59, 0xF0, 0x29, 0x50, 0x07, 0x68, 0xF0, 0x28, 0x60, 0x05, 0x69,
+	0xF9, 0x60, 0x05, 0x78, 0xF8, 0x70, 0x05, 0x79, 0xD9, 0x70, 0x05, 0x88, 0xD8, 0x80, 0x05, 0x89,
+	0xC8, 0x80, 0x05, 0x98, 0xB8, 0x90, 0x05, 0x99, 0xA8, 0x90, 0x05, 0xA8, 0x98, 0xA0, 0x05, 0xA9,
+	0x88, 0xA0, 0x05, 0xB8, 0x78, 0xB0, 0x05, 0xB9, 0x68, 0xB0, 0x05, 0xC8, 0x58, 0xC0, 0x05, 0xC9,
+	0x48, 0xC0, 0x05, 0xD8, 0x38, 0xD0, 0x05, 0xD9, 0x28, 0xD0, 0x05, 0xE8, 0x18, 0xE0, 0x05, 0xEF,
+	0x02, 0xE0, 0x83, 0x01, 0xFF, 0xF0, 0x87, 0x01, 0xF0, 0x1D, 0xF0, 0x10, 0x87, 0x01, 0xF0, 0x2B,
+	0xF0, 0x20, 0x87, 0x17, 0xF0, 0x39, 0xF0, 0x30, 0x07, 0xF0, 0x47, 0xF0, 0x40, 0x85, 0x10, 0xF0,
+	0xF0, 0xF0, 0x85, 0x0A, 0xF0, 0xF0, 0xA0, 0x87, 0x01, 0x1F, 0x0F, 0x07, 0x20, 0x87, 0x02, 0x0F,
+	0x0F, 0x09, 0x10, 0x87, 0x01, 0x1F, 0x0F, 0x08, 0x10, 0x85, 0x01, 0xF0, 0xE9, 0x20, 0x85, 0x01,
+	0xF0, 0xD9, 0x30, 0x05, 0xF0, 0xC9, 0x40, 0x85, 0x01, 0xF0, 0xB9, 0x50, 0x05, 0xF0, 0xA9, 0x60,
+	0x85, 0x01, 0xF0, 0x99, 0x70, 0x05, 0xF0, 0x89, 0x80, 0x85, 0x01, 0xF0, 0x79, 0x90, 0x05, 0xF0,
+	0x69, 0xA0, 0x05, 0xF0, 0x68, 0xB0, 0x05, 0xF0, 0x59, 0xB0, 0x85, 0x01, 0xF0, 0x49, 0xC0, 0x05,
+	0xF0, 0x39, 0xD0, 0x85, 0x01, 0xF0, 0x29, 0xE0, 0x05, 0xF0, 0x19, 0xF0, 0x85, 0x01, 0xF9, 0xF0,
+	0x10, 0x05, 0xE9, 0xF0, 0x20, 0x85, 0x01, 0xD9, 0xF0, 0x30, 0x85, 0x01, 0xC9, 0xF0, 0x40, 0x05,
+	0xB9, 0xF0, 0x50, 0x85, 0x01, 0xA9, 0xF0, 0x60, 0x05, 0x99, 0xF0, 0x70, 0x85, 0x01, 0x89, 0xF0,
+	0x80, 0x05, 0x79, 0xF0, 0x90, 0x85, 0x01, 0x69, 0xF0, 0xA0, 0x05, 0x59, 0xF0, 0xB0, 0x05, 0x58,
+	0xF0, 0xC0, 0x05, 0x49, 0xF0, 0xC0, 0x85, 0x01, 0x39, 0xF0, 0xD0, 0x05, 0x29, 0xF0, 0xE0, 0x85,
+	0x01, 0x19, 0xF0, 0xF0, 0x07, 0x09, 0xF0, 0xF0, 0x10, 0x07, 0x0F, 0x0F, 0x09, 0x10, 0x86, 0x04,
+	0x0F, 0x0F, 0x0A, 0x07, 0x1F, 0x0F, 0x08, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0xA0, 0x83, 0x05, 0xF0,
+	0x10, 0x02, 0x1F, 0x84, 0x04, 0x0F, 0x01, 0x83, 0x44, 0x07, 0x90, 0x84, 0x04, 0x0F, 0x01, 0x02,
+	0x1F, 0x83, 0x01, 0xF0, 0x10, 0x85, 0x02, 0xF0, 0xF0, 0x60, 0x85, 0x01, 0x07, 0xF0, 0xE0, 0x85,
+	0x01, 0x08, 0xF0, 0xD0, 0x05, 0x17, 0xF0, 0xD0, 0x85, 0x01, 0x18, 0xF0, 0xC0, 0x85, 0x02, 0x28,
+	0xF0, 0xB0, 0x85, 0x01, 0x38, 0xF0, 0xA0, 0x05, 0x47, 0xF0, 0xA0, 0x85, 0x01, 0x48, 0xF0, 0x90,
+	0x05, 0x57, 0xF0, 0x90, 0x85, 0x01, 0x58, 0xF0, 0x80, 0x85, 0x02, 0x68, 0xF0, 0x70, 0x85, 0x02,
+	0x78, 0xF0, 0x60, 0x85, 0x01, 0x88, 0xF0, 0x50, 0x05, 0x97, 0xF0, 0x50, 0x85, 0x01, 0x98, 0xF0,
+	0x40, 0x85, 0x02, 0xA8, 0xF0, 0x30, 0x85, 0x02, 0xB8, 0xF0, 0x20, 0x85, 0x01, 0xC8, 0xF0, 0x10,
+	0x05, 0xD7, 0xF0, 0x10, 0x83, 0x01, 0xD8, 0xF0, 0x83, 0x02, 0xE8, 0xE0, 0x83, 0x02, 0xF8, 0xD0,
+	0x85, 0x01, 0xF0, 0x18, 0xC0, 0x05, 0xF0, 0x27, 0xC0, 0x85, 0x01, 0xF0, 0x28, 0xB0, 0x85, 0x02,
+	0xF0, 0x38, 0xA0, 0x85, 0x02, 0xF0, 0x48, 0x90, 0x85, 0x01, 0xF0, 0x58, 0x80, 0x05, 0xF0, 0x67,
+	0x80, 0x85, 0x01, 0xF0, 0x68, 0x70, 0x85, 0x02, 0xF0, 0x78, 0x60, 0x85, 0x02, 0xF0, 0x88, 0x50,
+	0x85, 0x01, 0xF0, 0x98, 0x40, 0x05, 0xF0, 0xA7, 0x40, 0x85, 0x01, 0xF0, 0xA8, 0x30, 0x05, 0xF0,
+	0xB7, 0x30, 0x85, 0x01, 0xF0, 0xB8, 0x20, 0x85, 0x02, 0xF0, 0xC8, 0x10, 0x84, 0x01, 0xF0, 0xD8,
+	0x04, 0xF0, 0xE7, 0x85, 0x03, 0xF0, 0xF0, 0x60, 0x83, 0x05, 0xF0, 0x20, 0x03, 0x1E, 0x20, 0x85,
+	0x01, 0x0F, 0x01, 0x10, 0x84, 0x01, 0x0F, 0x02, 0x04, 0x1F, 0x01, 0x82, 0x44, 0x98, 0x04, 0x1F,
+	0x01, 0x84, 0x01, 0x0F, 0x02, 0x85, 0x01, 0x0F, 0x01, 0x10, 0x03, 0x1E, 0x20, 0x83, 0x01, 0xF0,
+	0x20, 0x85, 0x0A, 0xF0, 0xF0, 0x80, 0x05, 0xF7, 0xF0, 0x10, 0x03, 0xE9, 0xF0, 0x83, 0x01, 0xDB,
+	0xE0, 0x83, 0x01, 0xCD, 0xD0, 0x03, 0xCE, 0xC0, 0x03, 0xBF, 0xC0, 0x05, 0xB7, 0x18, 0xB0, 0x05,
+	0xA8, 0x18, 0xB0, 0x05, 0xA7, 0x37, 0xB0, 0x05, 0x98, 0x38, 0xA0, 0x05, 0x97, 0x57, 0xA0, 0x05,
+	0x97, 0x58, 0x90, 0x05, 0x88, 0x58, 0x90, 0x05, 0x87, 0x78, 0x80, 0x05, 0x78, 0x78, 0x80, 0x05,
+	0x77, 0x98, 0x70, 0x85, 0x01, 0x68, 0x98, 0x70, 0x05, 0x67, 0xB8, 0x60, 0x05, 0x58, 0xB8, 0x60,
+	0x05, 0x57, 0xD8, 0x50, 0x05, 0x48, 0xD8, 0x50, 0x05, 0x48, 0xE8, 0x40, 0x05, 0x38, 0xF8, 0x40,
+	0x05, 0x38, 0xF9, 0x30, 0x87, 0x01, 0x28, 0xF0, 0x28, 0x30, 0x07, 0x28, 0xF0, 0x38, 0x20, 0x07,
+	0x18, 0xF0, 0x48, 0x20, 0x07, 0x18, 0xF0, 0x49, 0x10, 0x07, 0x08, 0xF0, 0x68, 0x10, 0x06, 0x08,
+	0xF0, 0x69, 0x07, 0x07, 0xF0, 0x87, 0x10, 0x85, 0x2A, 0xF0, 0xF0, 0x80, 0x87, 0x52, 0xF0, 0xF0,
+	0xF0, 0x30, 0x09, 0x1F, 0x0F, 0x0F, 0x01, 0x10, 0x88, 0x03, 0x0F, 0x0F, 0x0F, 0x03, 0x09, 0x1F,
+	0x0F, 0x0F, 0x01, 0x10, 0x81, 0x04, 0xF0, 0x03, 0x07, 0x80, 0x03, 0x08, 0x70, 0x03, 0x09, 0x60,
+	0x03, 0x18, 0x60, 0x03, 0x28, 0x50, 0x03, 0x37, 0x50, 0x03, 0x38, 0x40, 0x03, 0x48, 0x30, 0x03,
+	0x57, 0x30, 0x03, 0x67, 0x20, 0x03, 0x68, 0x10, 0x03, 0x77, 0x10, 0x02, 0x87, 0x02, 0x96, 0x02,
+	0xA5, 0x81, 0x44, 0xF0, 0x85, 0x19, 0xF0, 0xF0, 0x50, 0x03, 0xDB, 0xB0, 0x05, 0x9F, 0x03, 0x80,
+	0x05, 0x7F, 0x07, 0x60, 0x05, 0x5F, 0x0B, 0x40, 0x05, 0x3F, 0x0E, 0x30, 0x05, 0x2F, 0x0F, 0x30,
+	0x05, 0x2B, 0x8C, 0x20, 0x05, 0x28, 0xEA, 0x10, 0x07, 0x26, 0xF0, 0x29, 0x10, 0x07, 0x24, 0xF0,
+	0x58, 0x10, 0x07, 0x32, 0xF0, 0x68, 0x10, 0x04, 0xF0, 0xB9, 0x84, 0x06, 0xF0, 0xC8, 0x04, 0xEF,
+	0x06, 0x04, 0xAF, 0x0A, 0x04, 0x8F, 0x0C, 0x04, 0x6F, 0x0E, 0x06, 0x4F, 0x0F, 0x01, 0x06, 0x3F,
+	0x0F, 0x02, 0x04, 0x3C, 0xC8, 0x04, 0x2A, 0xF8, 0x06, 0x1A, 0xF0, 0x18, 0x06, 0x19, 0xF0, 0x28,
+	0x06, 0x18, 0xF0, 0x38, 0x86, 0x04, 0x08, 0xF0, 0x48, 0x06, 0x08, 0xF0, 0x39, 0x06, 0x09, 0xF0,
+	0x1A, 0x04, 0x09, 0xFB, 0x04, 0x19, 0xDC, 0x04, 0x1A, 0xAE, 0x06, 0x2B, 0x6F, 0x01, 0x06, 0x2F,
+	0x0A, 0x17, 0x06, 0x3F, 0x08, 0x27, 0x06, 0x4F, 0x06, 0x37, 0x06, 0x5F, 0x03, 0x57, 0x04, 0x7E,
+	0x86, 0x05, 0xA9, 0xF0, 0x10, 0x85, 0x0F, 0xF0, 0xF0, 0x50, 0x85, 0x06, 0xF0, 0xF0, 0x90, 0x07,
+	0x16, 0xF0, 0xF0, 0x20, 0x87, 0x11, 0x08, 0xF0, 0xF0, 0x10, 0x05, 0x08, 0xA8, 0xD0, 0x05, 0x08,
+	0x7E, 0xA0, 0x07, 0x08, 0x5F, 0x03, 0x80, 0x07, 0x08, 0x4F, 0x05, 0x70, 0x07, 0x08, 0x3F, 0x07,
+	0x60, 0x07, 0x08, 0x2F, 0x09, 0x50, 0x07, 0x08, 0x1F, 0x0B, 0x40, 0x07, 0x0F, 0x02, 0x6D, 0x30,
+	0x05, 0x0F, 0xAB, 0x30, 0x05, 0x0D, 0xDB, 0x20, 0x05, 0x0C, 0xFA, 0x20, 0x07, 0x0B, 0xF0, 0x29,
+	0x20, 0x07, 0x0A, 0xF0, 0x3A, 0x10, 0x07, 0x09, 0xF0, 0x4A, 0x10, 0x87, 0x01, 0x08, 0xF0, 0x69,
+	0x10, 0x06, 0x08, 0xF0, 0x6A, 0x86, 0x0B, 0x08, 0xF0, 0x79, 0x06, 0x08, 0xF0, 0x6A, 0x87, 0x02,
+	0x08, 0xF0, 0x69, 0x10, 0x07, 0x09, 0xF0, 0x4A, 0x10, 0x07, 0x0A, 0xF0, 0x39, 0x20, 0x07, 0x0B,
+	0xF0, 0x1A, 0x20, 0x05, 0x0C, 0xFA, 0x20, 0x05, 0x0D, 0xDA, 0x30, 0x05, 0x0F, 0xAB, 0x30, 0x07,
+	0x0F, 0x02, 0x6C, 0x40, 0x07, 0x07, 0x1F, 0x0B, 0x50, 0x07, 0x07, 0x2F, 0x0A, 0x50, 0x07, 0x07,
+	0x3F, 0x08, 0x60, 0x07, 0x07, 0x4F, 0x05, 0x80, 0x07, 0x07, 0x6F, 0x02, 0x90, 0x05, 0x07, 0x7E,
+	0xB0, 0x05, 0xF0, 0x28, 0xE0, 0x85, 0x0F, 0xF0, 0xF0, 0x90, 0x85, 0x19, 0xF0, 0xF0, 0x30, 0x03,
+	0xF9, 0x90, 0x03, 0xCF, 0x60, 0x05, 0xAF, 0x04, 0x40, 0x05, 0x8F, 0x07, 0x30, 0x05, 0x7F, 0x09,
+	0x20, 0x05, 0x6F, 0x0B, 0x10, 0x04, 0x5F, 0x0D, 0x04, 0x4D, 0x79, 0x04, 0x4B, 0xB7, 0x04, 0x3A,
+	0xF5, 0x06, 0x39, 0xF0, 0x24, 0x07, 0x2A, 0xF0, 0x32, 0x10, 0x05, 0x29, 0xF0, 0x70, 0x05, 0x1A,
+	0xF0, 0x70, 0x85, 0x02, 0x19, 0xF0, 0x80, 0x05, 0x0A, 0xF0, 0x80, 0x85, 0x0B, 0x09, 0xF0, 0x90,
+	0x05, 0x0A, 0xF0, 0x80, 0x85, 0x01, 0x19, 0xF0, 0x80, 0x85, 0x01, 0x1A, 0xF0, 0x70, 0x06, 0x2A,
+	0xF0, 0x42, 0x06, 0x2A, 0xF0, 0x24, 0x04, 0x3A, 0xF5, 0x04, 0x3C, 0xB7, 0x04, 0x4D, 0x79, 0x04,
+	0x4F, 0x0E, 0x05, 0x5F, 0x0C, 0x10, 0x05, 0x6F, 0x0B, 0x10, 0x05, 0x7F, 0x08, 0x30, 0x05, 0x9F,
+	0x05, 0x40, 0x03, 0xBF, 0x70, 0x03, 0xE9, 0xA0, 0x85, 0x0F, 0xF0, 0xF0, 0x30, 0x85, 0x06, 0xF0,
+	0xF0, 0x90, 0x07, 0xF0, 0xF0, 0x26, 0x10, 0x86, 0x11, 0xF0, 0xF0, 0x18, 0x04, 0xE8, 0x98, 0x04,
+	0xBE, 0x68, 0x06, 0x9F, 0x02, 0x58, 0x06, 0x7F, 0x06, 0x38, 0x06, 0x6F, 0x08, 0x28, 0x06, 0x5F,
+	0x0A, 0x18, 0x06, 0x5F, 0x0F, 0x04, 0x06, 0x4C, 0x6F, 0x02, 0x04, 0x3B, 0xAF, 0x04, 0x3A, 0xDD,
+	0x04, 0x2A, 0xFC, 0x06, 0x2A, 0xF0, 0x1B, 0x06, 0x29, 0xF0, 0x3A, 0x06, 0x1A, 0xF0, 0x49, 0x86,
+	0x02, 0x19, 0xF0, 0x68, 0x06, 0x0A, 0xF0, 0x68, 0x86, 0x0B, 0x09, 0xF0, 0x78, 0x06, 0x0A, 0xF0,
+	0x68, 0x86, 0x01, 0x19, 0xF0, 0x68, 0x06, 0x1A, 0xF0, 0x49, 0x06, 0x1A, 0xF0, 0x3A, 0x06, 0x29,
+	0xF0, 0x2B, 0x04, 0x2A, 0xFC, 0x04, 0x2B, 0xDD, 0x04, 0x3B, 0xAF, 0x06, 0x3D, 0x6F, 0x02, 0x06,
+	0x4F, 0x0C, 0x17, 0x06, 0x5F, 0x0A, 0x27, 0x06, 0x6F, 0x08, 0x37, 0x06, 0x7F, 0x05, 0x57, 0x06,
+	0x8F, 0x03, 0x67, 0x04, 0xAE, 0x87, 0x05, 0xD8, 0xF0, 0x30, 0x85, 0x0F, 0xF0, 0xF0, 0x90, 0x85,
+	0x19, 0xF0, 0xF0, 0x90, 0x03, 0xFA, 0xE0, 0x05, 0xCF, 0x02, 0xA0, 0x05, 0xAF, 0x06, 0x80, 0x05,
+	0x9F, 0x08, 0x70, 0x05, 0x7F, 0x0B, 0x60, 0x05, 0x6F, 0x0D, 0x50, 0x05, 0x5C, 0x7B, 0x40, 0x05,
+	0x5A, 0xBA, 0x30, 0x05, 0x49, 0xF8, 0x30, 0x07, 0x39, 0xF0, 0x19, 0x20, 0x07, 0x39, 0xF0, 0x28,
+	0x20, 0x07, 0x29, 0xF0, 0x48, 0x10, 0x87, 0x01, 0x28, 0xF0, 0x58, 0x10, 0x07, 0x19, 0xF0, 0x67,
+	0x10, 0x86, 0x02, 0x18, 0xF0, 0x78, 0x06, 0x09, 0xF0, 0x78, 0x86, 0x04, 0x0F, 0x0F, 0x09, 0x07,
+	0x0F, 0x0F, 0x08, 0x10, 0x85, 0x04, 0x09, 0xF0, 0xF0, 0x05, 0x18, 0xF0, 0xF0, 0x85, 0x02, 0x19,
+	0xF0, 0xE0, 0x85, 0x01, 0x29, 0xF0, 0xD0, 0x05, 0x2A, 0xF0, 0xC0, 0x05, 0x3A, 0xF0, 0xB0, 0x07,
+	0x3B, 0xF0, 0x53, 0x20, 0x07, 0x4B, 0xF0, 0x16, 0x20, 0x05, 0x5D, 0xA9, 0x20, 0x07, 0x6F, 0x0F,
+	0x01, 0x20, 0x05, 0x7F, 0x0F, 0x20, 0x05, 0x8F, 0x0D, 0x30, 0x05, 0xAF, 0x0A, 0x40, 0x05, 0xCF,
+	0x05, 0x70, 0x03, 0xFC, 0xC0, 0x85, 0x0F, 0xF0, 0xF0, 0x90, 0x83, 0x05, 0xF0, 0xD0, 0x05, 0xF0,
+	0x19, 0x30, 0x03, 0xDE, 0x10, 0x04, 0xCF, 0x01, 0x04, 0xBF, 0x02, 0x04, 0xAF, 0x03, 0x04, 0x9F,
+	0x04, 0x04, 0x99, 0x64, 0x03, 0x89, 0xB0, 0x83, 0x02, 0x88, 0xC0, 0x83, 0x09, 0x78, 0xD0, 0x05,
+	0x0F, 0x0A, 0x30, 0x85, 0x03, 0x0F, 0x0B, 0x20, 0x05, 0x0F, 0x0A, 0x30, 0x83, 0x25, 0x78, 0xD0,
+	0x03, 0x86, 0xE0, 0x83, 0x10, 0xF0, 0xD0, 0x85, 0x19, 0xF0, 0xF0, 0xA0, 0x05, 0xF9, 0xF0, 0x10,
+	0x05, 0xCF, 0x0C, 0x10, 0x04, 0xAF, 0x0F, 0x06, 0x8F, 0x0F, 0x02, 0x06, 0x7F, 0x0F, 0x03, 0x06,
+	0x6F, 0x0F, 0x04, 0x07, 0x6A, 0x6F, 0x02, 0x10, 0x05, 0x59, 0xA9, 0x70, 0x05, 0x49, 0xD7, 0x70,
+	0x05, 0x48, 0xE8, 0x60, 0x07, 0x47, 0xF0, 0x17, 0x60, 0x07, 0x38, 0xF0, 0x18, 0x50, 0x87, 0x06,
+	0x37, 0xF0, 0x37, 0x50, 0x07, 0x38, 0xF0, 0x18, 0x50, 0x07, 0x47, 0xF0, 0x17, 0x60, 0x85, 0x01,
+	0x48, 0xE8, 0x60, 0x05, 0x59, 0xA9, 0x70, 0x05, 0x6A, 0x6B, 0x70, 0x05, 0x6F, 0x0B, 0x80, 0x05,
+	0x5F, 0x0B, 0x90, 0x05, 0x4F, 0x0B, 0xA0, 0x05, 0x4F, 0x09, 0xC0, 0x05, 0x37, 0x2F, 0xD0, 0x07,
+	0x36, 0x69, 0xF0, 0x10, 0x87, 0x03, 0x27, 0xF0, 0xF0, 0x10, 0x05, 0x28, 0xF0, 0xF0, 0x05, 0x2A,
+	0xF0, 0xD0, 0x05, 0x3F, 0x08, 0xE0, 0x05, 0x3F, 0x0E, 0x80, 0x05, 0x4F, 0x0F, 0x60, 0x05, 0x6F,
+	0x0F, 0x40, 0x07, 0x5F, 0x0F, 0x02, 0x30, 0x07, 0x4F, 0x0F, 0x04, 0x20, 0x05, 0x39, 0xED, 0x10,
+	0x07, 0x29, 0xF0, 0x3A, 0x10, 0x06, 0x28, 0xF0, 0x69, 0x06, 0x18, 0xF0, 0x79, 0x06, 0x18, 0xF0,
+	0x88, 0x86, 0x03, 0x08, 0xF0, 0x98, 0x07, 0x08, 0xF0, 0x88, 0x10, 0x07, 0x09, 0xF0, 0x69, 0x10,
+	0x07, 0x0A, 0xF0, 0x4A, 0x10, 0x07, 0x1A, 0xF0, 0x2A, 0x20, 0x05, 0x1D, 0xBC, 0x30, 0x07, 0x2F,
+	0x0F, 0x04, 0x40, 0x07, 0x3F, 0x0F, 0x02, 0x50, 0x05, 0x4F, 0x0F, 0x60, 0x05, 0x6F, 0x0B, 0x80,
+	0x05, 0x8F, 0x07, 0xA0, 0x03, 0xCE, 0xE0, 0x85, 0x06, 0xF0, 0xF0, 0x70, 0x05, 0x16, 0xF0, 0xF0,
+	0x85, 0x11, 0x08, 0xF0, 0xE0, 0x05, 0x08, 0xA8, 0xB0, 0x05, 0x08, 0x7E, 0x80, 0x07, 0x08, 0x5F,
+	0x03, 0x60, 0x07, 0x08, 0x4F, 0x05, 0x50, 0x07, 0x08, 0x3F, 0x07, 0x40, 0x07, 0x08, 0x1F, 0x0A,
+	0x30, 0x07, 0x0F, 0x0F, 0x04, 0x30, 0x07, 0x0F, 0x02, 0x6C, 0x20, 0x05, 0x0F, 0xAA, 0x20, 0x05,
+	0x0E, 0xCA, 0x10, 0x05, 0x0C, 0xF9, 0x10, 0x07, 0x0B, 0xF0, 0x28, 0x10, 0x06, 0x0A, 0xF0, 0x39,
+	0x06, 0x09, 0xF0, 0x49, 0x86, 0x1E, 0x08, 0xF0, 0x68, 0x07, 0x16, 0xF0, 0x86, 0x10, 0x85, 0x10,
+	0xF0, 0xF0, 0x70, 0x81, 0x09, 0xA0, 0x03, 0x26, 0x20, 0x03, 0x18, 0x10, 0x82, 0x04, 0x0A, 0x03,
+	0x18, 0x10, 0x03, 0x26, 0x20, 0x81, 0x07, 0xA0, 0x03, 0x26, 0x20, 0x83, 0x2A, 0x18, 0x10, 0x03,
+	0x26, 0x20, 0x81, 0x10, 0xA0, 0x83, 0x09, 0xF0, 0x40, 0x03, 0xB6, 0x20, 0x03, 0xA8, 0x10, 0x82,
+	0x04, 0x9A, 0x03, 0xA8, 0x10, 0x03, 0xB6, 0x20, 0x83, 0x07, 0xF0, 0x40, 0x03, 0xB6, 0x20, 0x83,
+	0x31, 0xA8, 0x10, 0x03, 0x99, 0x10, 0x03, 0x98, 0x20, 0x03, 0x89, 0x20, 0x03, 0x7A, 0x20, 0x05,
+	0x0F, 0x02, 0x20, 0x05, 0x0F, 0x01, 0x30, 0x83, 0x01, 0x0F, 0x40, 0x03, 0x0E, 0x50, 0x03, 0x0C,
+	0x70, 0x03, 0x28, 0x90, 0x85, 0x06, 0xF0, 0xF0, 0x50, 0x05, 0x16, 0xF0, 0xD0, 0x85, 0x12, 0x08,
+	0xF0, 0xC0, 0x07, 0x08, 0xF0, 0x28, 0x20, 0x07, 0x08, 0xF0, 0x19, 0x20, 0x05, 0x08, 0xFA, 0x20,
+	0x05, 0x08, 0xEA, 0x30, 0x05, 0x08, 0xDA, 0x40, 0x05, 0x08, 0xCA, 0x50, 0x05, 0x08, 0xBA, 0x60,
+	0x05, 0x08, 0xB9, 0x70, 0x05, 0x08, 0xA9, 0x80, 0x05, 0x08, 0x99, 0x90, 0x05, 0x08, 0x89, 0xA0,
+	0x05, 0x08, 0x79, 0xB0, 0x05, 0x08, 0x69, 0xC0, 0x05, 0x08, 0x59, 0xD0, 0x05, 0x08, 0x49, 0xE0,
+	0x05, 0x08, 0x39, 0xF0, 0x07, 0x08, 0x29, 0xF0, 0x10, 0x07, 0x08, 0x1A, 0xF0, 0x10, 0x07, 0x08,
+	0x19, 0xF0, 0x20, 0x07, 0x0F, 0x02, 0xF0, 0x30, 0x07, 0x0F, 0x03, 0xF0, 0x20, 0x07, 0x08, 0x1A,
+	0xF0, 0x10, 0x05, 0x08, 0x2A, 0xF0, 0x05, 0x08, 0x39, 0xF0, 0x05, 0x08, 0x3A, 0xE0, 0x05, 0x08,
+	0x4A, 0xD0, 0x05, 0x08, 0x5A, 0xC0, 0x05, 0x08, 0x69, 0xC0, 0x05, 0x08, 0x6A, 0xB0, 0x05, 0x08,
+	0x7A, 0xA0, 0x05, 0x08, 0x8A, 0x90, 0x05, 0x08, 0x99, 0x90, 0x05, 0x08, 0x9A, 0x80, 0x05, 0x08,
+	0xAA, 0x70, 0x05, 0x08, 0xBA, 0x60, 0x05, 0x08, 0xC9, 0x60, 0x05, 0x08, 0xD9, 0x50, 0x05, 0x08,
+	0xDA, 0x40, 0x05, 0x08, 0xEA, 0x30, 0x05, 0x08, 0xFA, 0x20, 0x07, 0x08, 0xF0, 0x19, 0x20, 0x07,
+	0x08, 0xF0, 0x1A, 0x10, 0x06, 0x08, 0xF0, 0x2A, 0x06, 0x08, 0xF0, 0x39, 0x07, 0x16, 0xF0, 0x57,
+	0x10, 0x85, 0x10, 0xF0, 0xF0, 0x50, 0x81, 0x06, 0x80, 0x03, 0x16, 0x10, 0x82, 0x3E, 0x08, 0x03,
+	0x16, 0x10, 0x81, 0x10, 0x80, 0x89, 0x19, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0x09, 0xF0, 0x38, 0xF0,
+	0x48, 0xA0, 0x07, 0x07, 0x8D, 0xFD, 0x70, 0x0B, 0x07, 0x6F, 0x02, 0xBF, 0x01, 0x60, 0x0B, 0x07,
+	0x5F, 0x04, 0x9F, 0x03, 0x50, 0x0B, 0x07, 0x4F, 0x06, 0x7F, 0x05, 0x40, 0x0B, 0x07, 0x3F, 0x08,
+	0x4F, 0x08, 0x30, 0x0B, 0x07, 0x2F, 0x09, 0x3F, 0x0A, 0x20, 0x0B, 0x07, 0x19, 0x5C, 0x28, 0x6B,
+	0x20, 0x09, 0x0F, 0x9A, 0x18, 0x9A, 0x10, 0x09, 0x0D, 0xCF, 0x01, 0xC9, 0x10, 0x07, 0x0C, 0xEE,
+	0xD9, 0x10, 0x09, 0x0B, 0xF0, 0x1C, 0xF8, 0x10, 0x0A, 0x0A, 0xF0, 0x2B, 0xF0, 0x19, 0x0A, 0x09,
+	0xF0, 0x3A, 0xF0, 0x29, 0x8A, 0x1E, 0x08, 0xF0, 0x58, 0xF0, 0x48, 0x0B, 0x16, 0xF0, 0x76, 0xF0,
+	0x66, 0x10, 0x89, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0x85, 0x19, 0xF0, 0xF0, 0x70, 0x05, 0xF0,
+	0x38, 0xB0, 0x05, 0x07, 0x8E, 0x80, 0x07, 0x07, 0x6F, 0x03, 0x60, 0x07, 0x07, 0x5F, 0x05, 0x50,
+	0x07, 0x07, 0x4F, 0x07, 0x40, 0x07, 0x07, 0x3F, 0x09, 0x30, 0x07, 0x07, 0x2F, 0x0A, 0x30, 0x07,
+	0x07, 0x19, 0x6C, 0x20, 0x05, 0x0F, 0xAA, 0x20, 0x05, 0x0E, 0xCA, 0x10, 0x05, 0x0C, 0xF9, 0x10,
+	0x07, 0x0B, 0xF0, 0x28, 0x10, 0x06, 0x0A, 0xF0, 0x39, 0x06, 0x09, 0xF0, 0x49, 0x86, 0x1E, 0x08,
+	0xF0, 0x68, 0x07, 0x16, 0xF0, 0x86, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0x70, 0x85, 0x19, 0xF0, 0xF0,
+	0xC0, 0x05, 0xF0, 0x1B, 0xF0, 0x05, 0xDF, 0x02, 0xC0, 0x05, 0xBF, 0x06, 0xA0, 0x05, 0x9F, 0x0A,
+	0x80, 0x05, 0x8F, 0x0C, 0x70, 0x05, 0x6F, 0x0F, 0x60, 0x05, 0x6B, 0x8C, 0x50, 0x05, 0x5A, 0xCB,
+	0x40, 0x05, 0x4A, 0xEB, 0x30, 0x07, 0x3A, 0xF0, 0x1A, 0x30, 0x07, 0x39, 0xF0, 0x3A, 0x20, 0x87,
+	0x01, 0x29, 0xF0, 0x59, 0x20, 0x07, 0x29, 0xF0, 0x69, 0x10, 0x87, 0x02, 0x19, 0xF0, 0x79, 0x10,
+	0x06, 0x18, 0xF0, 0x99, 0x86, 0x0A, 0x09, 0xF0, 0x99, 0x07, 0x0A, 0xF0, 0x79, 0x10, 0x87, 0x02,
+	0x19, 0xF0, 0x79, 0x10, 0x07, 0x1A, 0xF0, 0x59, 0x20, 0x07, 0x29, 0xF0, 0x59, 0x20, 0x07, 0x2A,
+	0xF0, 0x3A, 0x20, 0x07, 0x2B, 0xF0, 0x1A, 0x30, 0x05, 0x3B, 0xEB, 0x30, 0x05, 0x3C, 0xCB, 0x40,
+	0x05, 0x4D, 0x8C, 0x50, 0x07, 0x5F, 0x0F, 0x01, 0x60, 0x05, 0x6F, 0x0E, 0x70, 0x05, 0x7F, 0x0C,
+	0x80, 0x05, 0x8F, 0x0A, 0x90, 0x05, 0xAF, 0x06, 0xB0, 0x05, 0xCF, 0x02, 0xD0, 0x05, 0xFB, 0xF0,
+	0x10, 0x85, 0x0F, 0xF0, 0xF0, 0xC0, 0x85, 0x19, 0xF0, 0xF0, 0x90, 0x05, 0xF0, 0x38, 0xD0, 0x05,
+	0x07, 0x8E, 0xA0, 0x07, 0x07, 0x6F, 0x03, 0x80, 0x07, 0x07, 0x5F, 0x05, 0x70, 0x07, 0x07, 0x4F,
+	0x07, 0x60, 0x07, 0x07, 0x2F, 0x0A, 0x50, 0x07, 0x07, 0x1F, 0x0C, 0x40, 0x07, 0x0F, 0x02, 0x6D,
+	0x30, 0x05, 0x0F, 0xAB, 0x30, 0x05, 0x0D, 0xDB, 0x20, 0x05, 0x0C, 0xFA, 0x20, 0x07, 0x0B, 0xF0,
+	0x29, 0x20, 0x07, 0x0A, 0xF0, 0x3A, 0x10, 0x07, 0x09, 0xF0, 0x59, 0x10, 0x87, 0x01, 0x08, 0xF0,
+	0x69, 0x10, 0x06, 0x08, 0xF0, 0x6A, 0x86, 0x0B, 0x08, 0xF0, 0x79, 0x06, 0x08, 0xF0, 0x6A, 0x87,
+	0x02, 0x08, 0xF0, 0x69, 0x10, 0x07, 0x09, 0xF0, 0x4A, 0x10, 0x07, 0x0A, 0xF0, 0x39, 0x20, 0x07,
+	0x0B, 0xF0, 0x1A, 0x20, 0x05, 0x0C, 0xFA, 0x20, 0x05, 0x0D, 0xDA, 0x30, 0x05, 0x0F, 0x9C, 0x30,
+	0x07, 0x0F, 0x02, 0x6C, 0x40, 0x07, 0x0F, 0x0F, 0x04, 0x50, 0x07, 0x08, 0x1F, 0x0A, 0x50, 0x07,
+	0x08, 0x2F, 0x08, 0x60, 0x07, 0x08, 0x3F, 0x05, 0x80, 0x07, 0x08, 0x5F, 0x02, 0x90, 0x05, 0x08,
+	0x6E, 0xB0, 0x05, 0x08, 0x98, 0xE0, 0x87, 0x0E, 0x08, 0xF0, 0xF0, 0x10, 0x07, 0x16, 0xF0, 0xF0,
+	0x20, 0x85, 0x19, 0xF0, 0xF0, 0x90, 0x05, 0xE8, 0xF0, 0x20, 0x04, 0xBE, 0x77, 0x06, 0x9F, 0x02,
+	0x67, 0x06, 0x8F, 0x05, 0x47, 0x06, 0x6F, 0x08, 0x37, 0x06, 0x5F, 0x0A, 0x27, 0x06, 0x5F, 0x0B,
+	0x17, 0x06, 0x4C, 0x6F, 0x02, 0x04, 0x3B, 0xAF, 0x04, 0x3A, 0xDD, 0x04, 0x2A, 0xFC, 0x06, 0x2A,
+	0xF0, 0x1B, 0x06, 0x29, 0xF0, 0x3A, 0x06, 0x1A, 0xF0, 0x49, 0x86, 0x02, 0x19, 0xF0, 0x68, 0x06,
+	0x0A, 0xF0, 0x68, 0x86, 0x0B, 0x09, 0xF0, 0x78, 0x06, 0x0A, 0xF0, 0x68, 0x86, 0x01, 0x19, 0xF0,
+	0x68, 0x06, 0x1A, 0xF0, 0x49, 0x06, 0x1A, 0xF0, 0x3A, 0x06, 0x29, 0xF0, 0x2B, 0x04, 0x2A, 0xFC,
+	0x04, 0x2B, 0xDD, 0x04, 0x3B, 0xAF, 0x06, 0x3D, 0x6F, 0x02, 0x06, 0x4F, 0x0B, 0x18, 0x06, 0x5F,
+	0x09, 0x28, 0x06, 0x6F, 0x07, 0x38, 0x06, 0x7F, 0x05, 0x48, 0x06, 0x8F, 0x03, 0x58, 0x04, 0xAE,
+	0x78, 0x04, 0xD8, 0xA8, 0x86, 0x0E, 0xF0, 0xF0, 0x18, 0x07, 0xF0, 0xF0, 0x26, 0x10, 0x83, 0x19,
+	0xF0, 0xA0, 0x05, 0xF0, 0x17, 0x20, 0x04, 0x07, 0x7B, 0x04, 0x07, 0x5D, 0x04, 0x07, 0x4E, 0x04,
+	0x07, 0x3F, 0x86, 0x01, 0x07, 0x2F, 0x01, 0x06, 0x07, 0x18, 0x54, 0x03, 0x0E, 0xB0, 0x03, 0x0D,
+	0xC0, 0x83, 0x01, 0x0C, 0xD0, 0x03, 0x0B, 0xE0, 0x03, 0x0A, 0xF0, 0x85, 0x01, 0x09, 0xF0, 0x10,
+	0x85, 0x1C, 0x08, 0xF0, 0x20, 0x05, 0x16, 0xF0, 0x30, 0x83, 0x10, 0xF0, 0xA0, 0x83, 0x19, 0xF0,
+	0xF0, 0x03, 0xC9, 0x90, 0x05, 0x9F, 0x01, 0x50, 0x05, 0x7F, 0x05, 0x30, 0x05, 0x5F, 0x08, 0x20,
+	0x05, 0x4F, 0x09, 0x20, 0x05, 0x3F, 0x0A, 0x20, 0x05, 0x3A, 0x87, 0x20, 0x05, 0x29, 0xD4, 0x20,
+	0x07, 0x28, 0xF0, 0x12, 0x20, 0x05, 0x19, 0xF0, 0x50, 0x85, 0x04, 0x18, 0xF0, 0x60, 0x05, 0x19,
+	0xF0, 0x50, 0x05, 0x29, 0xF0, 0x40, 0x05, 0x2A, 0xF0, 0x30, 0x05, 0x2C, 0xF0, 0x10, 0x03, 0x3D,
+	0xE0, 0x03, 0x4F, 0xB0, 0x05, 0x5F, 0x01, 0x90, 0x05, 0x6F, 0x02, 0x70, 0x05, 0x8F, 0x02, 0x50,
+	0x05, 0x9F, 0x02, 0x40, 0x03, 0xCF, 0x30, 0x03, 0xEE, 0x20, 0x05, 0xF0, 0x2C, 0x10, 0x05, 0xF0,
+	0x3B, 0x10, 0x05, 0xF0, 0x59, 0x10, 0x84, 0x01, 0xF0, 0x69, 0x84, 0x04, 0xF0, 0x78, 0x07, 0x03,
+	0xF0, 0x38, 0x10, 0x07, 0x04, 0xF0, 0x19, 0x10, 0x05, 0x06, 0xDA, 0x10, 0x05, 0x09, 0x8B, 0x20,
+	0x05, 0x0F, 0x0C, 0x30, 0x05, 0x0F, 0x0B, 0x40, 0x05, 0x1F, 0x09, 0x50, 0x05, 0x3F, 0x06, 0x60,
+	0x05, 0x5F, 0x02, 0x80, 0x03, 0x8A, 0xC0, 0x83, 0x0F, 0xF0, 0xF0, 0x83, 0x0E, 0xF0, 0xC0, 0x03,
+	0x86, 0xD0, 0x83, 0x0A, 0x78, 0xC0, 0x04, 0x1F, 0x0B, 0x84, 0x03, 0x0F, 0x0C, 0x05, 0x1F, 0x0A,
+	0x10, 0x83, 0x1C, 0x78, 0xC0, 0x83, 0x01, 0x79, 0xB0, 0x03, 0x89, 0xA0, 0x04, 0x8A, 0x63, 0x04,
+	0x8F, 0x04, 0x84, 0x01, 0x9F, 0x03, 0x04, 0xAF, 0x02, 0x04, 0xBF, 0x01, 0x03, 0xCE, 0x10, 0x03,
+	0xF8, 0x40, 0x83, 0x0F, 0xF0, 0xC0, 0x85, 0x1A, 0xF0, 0xF0, 0x60, 0x07, 0x16, 0xF0, 0x76, 0x10,
+	0x86, 0x1E, 0x08, 0xF0, 0x58, 0x06, 0x09, 0xF0, 0x39, 0x06, 0x09, 0xF0, 0x2A, 0x06, 0x18, 0xF0,
+	0x1B, 0x04, 0x19, 0xEC, 0x04, 0x1A, 0xCD, 0x04, 0x2A, 0x9F, 0x06, 0x2C, 0x59, 0x17, 0x06, 0x2F,
+	0x0A, 0x27, 0x06, 0x3F, 0x08, 0x37, 0x06, 0x4F, 0x06, 0x47, 0x06, 0x5F, 0x04, 0x57, 0x06, 0x6F,
+	0x02, 0x67, 0x05, 0x8D, 0x86, 0x10, 0x05, 0xA8, 0xF0, 0x30, 0x85, 0x0F, 0xF0, 0xF0, 0x60, 0x85,
+	0x1A, 0xF0, 0xF0, 0xA0, 0x07, 0x07, 0xF0, 0xB6, 0x10, 0x86, 0x01, 0x08, 0xF0, 0x98, 0x87, 0x01,
+	0x09, 0xF0, 0x78, 0x10, 0x07, 0x18, 0xF0, 0x78, 0x10, 0x07, 0x19, 0xF0, 0x58, 0x20, 0x87, 0x01,
+	0x28, 0xF0, 0x58, 0x20, 0x07, 0x29, 0xF0, 0x38, 0x30, 0x07, 0x38, 0xF0, 0x38, 0x30, 0x07, 0x38,
+	0xF0, 0x37, 0x40, 0x07, 0x39, 0xF0, 0x18, 0x40, 0x07, 0x48, 0xF0, 0x18, 0x40, 0x05, 0x48, 0xF8,
+	0x50, 0x05, 0x49, 0xE8, 0x50, 0x05, 0x58, 0xE8, 0x50, 0x05, 0x58, 0xD8, 0x60, 0x85, 0x01, 0x68,
+	0xC8, 0x60, 0x05, 0x68, 0xB8, 0x70, 0x85, 0x01, 0x78, 0xA8, 0x70, 0x05, 0x78, 0x98, 0x80, 0x05,
+	0x88, 0x88, 0x80, 0x05, 0x88, 0x87, 0x90, 0x05, 0x88, 0x78, 0x90, 0x05, 0x98, 0x68, 0x90, 0x05,
+	0x98, 0x67, 0xA0, 0x05, 0x99, 0x48, 0xA0, 0x05, 0xA8, 0x48, 0xA0, 0x05, 0xA8, 0x47, 0xB0, 0x85,
+	0x01, 0xB8, 0x28, 0xB0, 0x05, 0xB8, 0x27, 0xC0, 0x05, 0xCF, 0x01, 0xC0, 0x83, 0x01, 0xCF, 0xD0,
+	0x03, 0xDE, 0xD0, 0x83, 0x01, 0xDD, 0xE0, 0x03, 0xEC, 0xE0, 0x03, 0xEB, 0xF0, 0x03, 0xFA, 0xF0,
+	0x07, 0xF0, 0x18, 0xF0, 0x10, 0x85, 0x10, 0xF0, 0xF0, 0xA0, 0x89, 0x1A, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x30, 0x0A, 0x07, 0xF0, 0x67, 0xF0, 0x67, 0x8A, 0x01, 0x08, 0xF0, 0x48, 0xF0, 0x58, 0x0A, 0x08,
+	0xF0, 0x49, 0xF0, 0x48, 0x0B, 0x08, 0xF0, 0x49, 0xF0, 0x38, 0x10, 0x0B, 0x18, 0xF0, 0x2A, 0xF0,
+	0x38, 0x10, 0x0B, 0x18, 0xF0, 0x2B, 0xF0, 0x28, 0x10, 0x0B, 0x18, 0xF0, 0x2B, 0xF0, 0x27, 0x20,
+	0x89, 0x01, 0x28, 0xFC, 0xF0, 0x18, 0x20, 0x07, 0x28, 0xFD, 0xF7, 0x30, 0x07, 0x29, 0xED, 0xE8,
+	0x30, 0x07, 0x38, 0xDE, 0xE8, 0x30, 0x07, 0x38, 0xDF, 0xD8, 0x30, 0x09, 0x38, 0xD6, 0x27, 0xD7,
+	0x40, 0x09, 0x48, 0xC6, 0x27, 0xC8, 0x40, 0x09, 0x48, 0xB7, 0x27, 0xC8, 0x40, 0x09, 0x48, 0xB7,
+	0x28, 0xB7, 0x50, 0x89, 0x01, 0x58, 0xA6, 0x47, 0xA8, 0x50, 0x09, 0x58, 0x97, 0x48, 0x97, 0x60,
+	0x09, 0x67, 0x96, 0x67, 0x97, 0x60, 0x09, 0x68, 0x86, 0x67, 0x88, 0x60, 0x09, 0x68, 0x77, 0x67,
+	0x87, 0x70, 0x09, 0x68, 0x77, 0x68, 0x77, 0x70, 0x09, 0x78, 0x66, 0x87, 0x68, 0x70, 0x09, 0x78,
+	0x66, 0x87, 0x67, 0x80, 0x09, 0x78, 0x57, 0x88, 0x57, 0x80, 0x09, 0x87, 0x57, 0x97, 0x57, 0x80,
+	0x09, 0x88, 0x46, 0xA7, 0x48, 0x80, 0x09, 0x88, 0x46, 0xA7, 0x47, 0x90, 0x09, 0x97, 0x37, 0xA8,
+	0x37, 0x90, 0x09, 0x98, 0x27, 0xB7, 0x28, 0x90, 0x09, 0x98, 0x26, 0xC7, 0x27, 0xA0, 0x09, 0xA7,
+	0x26, 0xC8, 0x17, 0xA0, 0x09, 0xA7, 0x17, 0xD7, 0x17, 0xA0, 0x05, 0xAF, 0xDE, 0xB0, 0x05, 0xAE,
+	0xEE, 0xB0, 0x05, 0xBD, 0xEE, 0xB0, 0x05, 0xBD, 0xFC, 0xC0, 0x07, 0xBC, 0xF0, 0x1C, 0xC0, 0x07,
+	0xCB, 0xF0, 0x1C, 0xC0, 0x07, 0xCB, 0xF0, 0x2B, 0xC0, 0x07, 0xCB, 0xF0, 0x2A, 0xD0, 0x07, 0xD9,
+	0xF0, 0x48, 0xE0, 0x89, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0x85, 0x1A, 0xF0, 0xF0, 0x70, 0x07,
+	0x17, 0xF0, 0x67, 0x10, 0x07, 0x09, 0xF0, 0x48, 0x10, 0x07, 0x19, 0xF0, 0x38, 0x10, 0x07, 0x19,
+	0xF0, 0x28, 0x20, 0x05, 0x29, 0xF9, 0x20, 0x05, 0x39, 0xE8, 0x30, 0x05, 0x39, 0xD8, 0x40, 0x05,
+	0x49, 0xB9, 0x40, 0x05, 0x49, 0xB8, 0x50, 0x05, 0x59, 0x98, 0x60, 0x05, 0x69, 0x88, 0x60, 0x05,
+	0x69, 0x78, 0x70, 0x05, 0x79, 0x59, 0x70, 0x05, 0x89, 0x48, 0x80, 0x05, 0x89, 0x38, 0x90, 0x05,
+	0x99, 0x19, 0x90, 0x05, 0x99, 0x18, 0xA0, 0x05, 0xAF, 0x01, 0xB0, 0x03, 0xBF, 0xB0, 0x03, 0xBE,
+	0xC0, 0x03, 0xCD, 0xC0, 0x83, 0x01, 0xDB, 0xD0, 0x83, 0x01, 0xCD, 0xC0, 0x03, 0xBF, 0xB0, 0x85,
+	0x01, 0xAF, 0x02, 0xA0, 0x05, 0x98, 0x29, 0x90, 0x05, 0x88, 0x48, 0x90, 0x05, 0x88, 0x49, 0x80,
+	0x05, 0x78, 0x69, 0x70, 0x05, 0x69, 0x69, 0x70, 0x05, 0x68, 0x89, 0x60, 0x05, 0x58, 0xA9, 0x50,
+	0x05, 0x49, 0xA9, 0x50, 0x05, 0x48, 0xC9, 0x40, 0x05, 0x39, 0xC9, 0x40, 0x05, 0x38, 0xE9, 0x30,
+	0x07, 0x28, 0xF0, 0x19, 0x20, 0x07, 0x19, 0xF0, 0x19, 0x20, 0x07, 0x18, 0xF0, 0x39, 0x10, 0x06,
+	0x09, 0xF0, 0x3A, 0x06, 0x08, 0xF0, 0x59, 0x06, 0x07, 0xF0, 0x78, 0x85, 0x10, 0xF0, 0xF0, 0x70,
+	0x85, 0x1A, 0xF0, 0xF0, 0xA0, 0x07, 0x07, 0xF0, 0xB6, 0x10, 0x86, 0x01, 0x08, 0xF0, 0x98, 0x07,
+	0x09, 0xF0, 0x78, 0x10, 0x87, 0x01, 0x18, 0xF0, 0x78, 0x10, 0x07, 0x19, 0xF0, 0x58, 0x20, 0x87,
+	0x01, 0x28, 0xF0, 0x58, 0x20, 0x07, 0x29, 0xF0, 0x38, 0x30, 0x07, 0x38, 0xF0, 0x38, 0x30, 0x07,
+	0x38, 0xF0, 0x28, 0x40, 0x07, 0x39, 0xF0, 0x18, 0x40, 0x07, 0x48, 0xF0, 0x18, 0x40, 0x05, 0x49,
+	0xE8, 0x50, 0x85, 0x01, 0x58, 0xE8, 0x50, 0x05, 0x59, 0xC8, 0x60, 0x85, 0x01, 0x68, 0xC8, 0x60,
+	0x05, 0x69, 0xA8, 0x70, 0x05, 0x78, 0xA8, 0x70, 0x05, 0x78, 0xA7, 0x80, 0x85, 0x01, 0x88, 0x88,
+	0x80, 0x05, 0x88, 0x87, 0x90, 0x85, 0x01, 0x98, 0x68, 0x90, 0x05, 0x98, 0x67, 0xA0, 0x85, 0x01,
+	0xA8, 0x48, 0xA0, 0x05, 0xB8, 0x37, 0xB0, 0x85, 0x01, 0xB8, 0x28, 0xB0, 0x05, 0xC8, 0x17, 0xC0,
+	0x05, 0xCF, 0x01, 0xC0, 0x03, 0xCF, 0xD0, 0x83, 0x01, 0xDE, 0xD0, 0x83, 0x02, 0xEC, 0xE0, 0x83,
+	0x01, 0xFA, 0xF0, 0x05, 0xF0, 0x19, 0xF0, 0x87, 0x01, 0xF0, 0x18, 0xF0, 0x10, 0x85, 0x02, 0xF8,
+	0xF0, 0x20, 0x85, 0x01, 0xE8, 0xF0, 0x30, 0x05, 0xD9, 0xF0, 0x30, 0x85, 0x01, 0xD8, 0xF0, 0x40,
+	0x05, 0xC9, 0xF0, 0x40, 0x05, 0xC8, 0xF0, 0x50, 0x05, 0xB9, 0xF0, 0x50, 0x85, 0x01, 0xB8, 0xF0,
+	0x60, 0x05, 0xA9, 0xF0, 0x60, 0x05, 0xB7, 0xF0, 0x70, 0x83, 0x1A, 0xF0, 0xF0, 0x05, 0x1F, 0x0C,
+	0x20, 0x85, 0x04, 0x1F, 0x0D, 0x10, 0x05, 0x1F, 0x0C, 0x20, 0x05, 0xF0, 0x58, 0x20, 0x05, 0xF0,
+	0x49, 0x20, 0x05, 0xF0, 0x48, 0x30, 0x05, 0xF0, 0x38, 0x40, 0x05, 0xF0, 0x29, 0x40, 0x05, 0xF0,
+	0x28, 0x50, 0x05, 0xF0, 0x18, 0x60, 0x03, 0xF9, 0x60, 0x03, 0xF8, 0x70, 0x03, 0xE9, 0x70, 0x03,
+	0xD9, 0x80, 0x03, 0xD8, 0x90, 0x03, 0xC9, 0x90, 0x03, 0xB9, 0xA0, 0x03, 0xB8, 0xB0, 0x03, 0xA9,
+	0xB0, 0x03, 0xA8, 0xC0, 0x03, 0x98, 0xD0, 0x03, 0x89, 0xD0, 0x03, 0x88, 0xE0, 0x03, 0x78, 0xF0,
+	0x03, 0x69, 0xF0, 0x05, 0x68, 0xF0, 0x10, 0x05, 0x58, 0xF0, 0x20, 0x05, 0x49, 0xF0, 0x20, 0x05,
+	0x48, 0xF0, 0x30, 0x05, 0x38, 0xF0, 0x40, 0x05, 0x29, 0xF0, 0x40, 0x05, 0x28, 0xF0, 0x50, 0x85,
+	0x01, 0x18, 0xF0, 0x60, 0x05, 0x0F, 0x0E, 0x10, 0x84, 0x04, 0x0F, 0x0F, 0x05, 0x1F, 0x0D, 0x10,
+	0x83, 0x10, 0xF0, 0xF0, 0x83, 0x05, 0xF0, 0x80, 0x03, 0xF7, 0x10, 0x02, 0xDA, 0x02, 0xCB, 0x02,
+	0xBC, 0x82, 0x01, 0xAD, 0x03, 0x99, 0x50, 0x03, 0x98, 0x60, 0x83, 0x03, 0x97, 0x70, 0x83, 0x01,
+	0x88, 0x70, 0x83, 0x10, 0x87, 0x80, 0x03, 0x78, 0x80, 0x03, 0x77, 0x90, 0x03, 0x68, 0x90, 0x03,
+	0x58, 0xA0, 0x03, 0x49, 0xA0, 0x03, 0x0C, 0xB0, 0x03, 0x0B, 0xC0, 0x83, 0x01, 0x09, 0xE0, 0x03,
+	0x0B, 0xC0, 0x03, 0x1B, 0xB0, 0x03, 0x49, 0xA0, 0x03, 0x58, 0xA0, 0x03, 0x68, 0x90, 0x03, 0x77,
+	0x90, 0x03, 0x78, 0x80, 0x83, 0x13, 0x87, 0x80, 0x83, 0x01, 0x88, 0x70, 0x83, 0x03, 0x97, 0x70,
+	0x03, 0x98, 0x60, 0x03, 0x99, 0x50, 0x82, 0x01, 0xAD, 0x02, 0xBC, 0x02, 0xCB, 0x02, 0xDA, 0x03,
+	0xF7, 0x10, 0x83, 0x01, 0xF0, 0x80, 0x81, 0x04, 0x80, 0x03, 0x16, 0x10, 0x82, 0x51, 0x08, 0x03,
+	0x16, 0x10, 0x83, 0x05, 0xF0, 0x90, 0x03, 0x18, 0xF0, 0x03, 0x1A, 0xD0, 0x03, 0x1B, 0xC0, 0x03,
+	0x0D, 0xB0, 0x83, 0x01, 0x1D, 0xA0, 0x03, 0x68, 0xA0, 0x03, 0x78, 0x90, 0x83, 0x13, 0x87, 0x90,
+	0x83, 0x01, 0x88, 0x80, 0x83, 0x02, 0x97, 0x80, 0x03, 0x98, 0x70, 0x03, 0xA8, 0x60, 0x03, 0xAA,
+	0x40, 0x03, 0xBC, 0x10, 0x02, 0xDB, 0x82, 0x01, 0xF9, 0x02, 0xDB, 0x03, 0xCB, 0x10, 0x03, 0xC8,
+	0x40, 0x03, 0xB8, 0x50, 0x03, 0xA8, 0x60, 0x83, 0x01, 0xA7, 0x70, 0x03, 0x98, 0x70, 0x83, 0x03,
+	0x97, 0x80, 0x83, 0x01, 0x88, 0x80, 0x83, 0x12, 0x87, 0x90, 0x03, 0x78, 0x90, 0x03, 0x68, 0xA0,
+	0x83, 0x01, 0x1D, 0xA0, 0x03, 0x0D, 0xB0, 0x03, 0x1B, 0xC0, 0x03, 0x1A, 0xD0, 0x03, 0x18, 0xF0,
+	0x83, 0x01, 0xF0, 0x90, 0x85, 0x12, 0xF0, 0xF0, 0xC0, 0x05, 0x87, 0xF0, 0xC0, 0x06, 0x5D, 0xF0,
+	0x27, 0x06, 0x4F, 0xF0, 0x17, 0x06, 0x3F, 0x02, 0xF7, 0x06, 0x2F, 0x04, 0xE7, 0x06, 0x2F, 0x05,
+	0xD7, 0x06, 0x19, 0x58, 0xC7, 0x06, 0x18, 0x87, 0xA8, 0x07, 0x08, 0xA6, 0xA7, 0x10, 0x07, 0x08,
+	0xA7, 0x88, 0x10, 0x07, 0x07, 0xC8, 0x59, 0x10, 0x07, 0x07, 0xDF, 0x05, 0x20, 0x07, 0x07, 0xEF,
+	0x03, 0x30, 0x07, 0x07, 0xFF, 0x01, 0x40, 0x07, 0x07, 0xF0, 0x1E, 0x50, 0x05, 0xF0, 0x9C, 0x60,
+	0x05, 0xF0, 0xC7, 0x80, 0x85, 0x34, 0xF0, 0xF0, 0xC0,
+};
+
+char_info_t font89_rle_info[] = {
+	{2, 0}, 		/*   */ 
+	{10, 3}, 		/* ! */ 
+	{24, 44}, 		/* " */ 
+	{44, 84}, 		/* # */ 
+	{39, 181}, 		/* $ */ 
+	{62, 429}, 		/* % */ 
+	{56, 783}, 		/* & */ 
+	{8, 1118}, 		/* ' */ 
+	{17, 1141}, 		/* ( */ 
+	{17, 1258}, 		/* ) */ 
+	{33, 1385}, 		/* * */ 
+	{42, 1516}, 		/* + */ 
+	{15, 1574}, 		/* , */ 
+	{23, 1626}, 		/* - */ 
+	{10, 1646}, 		/* . */ 
+	{36, 1667}, 		/* / */ 
+	{43, 1907}, 		/* 0 */ 
+	{37, 2073}, 		/* 1 */ 
+	{38, 2162}, 		/* 2 */ 
+	{38, 2366}, 		/* 3 */ 
+	{44, 2578}, 		/* 4 */ 
+	{38, 2778}, 		/* 5 */ 
+	{40, 2930}, 		/* 6 */ 
+	{40, 3160}, 		/* 7 */ 
+	{41, 3352}, 		/* 8 */ 
+	{40, 3587}, 		/* 9 */ 
+	{10, 3808}, 		/* : */ 
+	{15, 3847}, 		/* ; */ 
+	{40, 3916}, 		/* < */ 
+	{39, 4096}, 		/* = */ 
+	{40, 4141}, 		/* > */ 
+	{34, 4342}, 		/* ? */ 
+	{70, 4486}, 		/* @ */ 
+	{52, 4931}, 		/* A */ 
+	{40, 5209}, 		/* B */ 
+	{43, 5426}, 		/* C */ 
+	{47, 5615}, 		/* D */ 
+	{34, 5838}, 		/* E */ 
+	{32, 5901}, 		/* F */ 
+	{49, 5953}, 		/* G */ 
+	{44, 6193}, 		/* H */ 
+	{9, 6228}, 		/* I */ 
+	{24, 6243}, 		/* J */ 
+	{40, 6293}, 		/* K */ 
+	{31, 6569}, 		/* L */ 
+	{66, 6601}, 		/* M */ 
+	{46, 6930}, 		/* N */ 
+	{54, 7177}, 		/* O */ 
+	{37, 7428}, 		/* P */ 
+	{61, 7574}, 		/* Q */ 
+	{41, 7876}, 		/* R */ 
+	{37, 8109}, 		/* S */ 
+	{47, 8331}, 		/* T */ 
+	{46, 8370}, 		/* U */ 
+	{51, 8472}, 		/* V */ 
+	{79, 8729}, 		/* W */ 
+	{45, 9102}, 		/* X */ 
+	{45, 9369}, 		/* Y */ 
+	{40, 9538}, 		/* Z */ 
+	{16, 9725}, 		/* [ */ 
+	{36, 9749}, 		/* \ */ 
+	{17, 9944}, 		/* ] */ 
+	{38, 9985}, 		/* ^ */ 
+	{48, 10124}, 		/* _ */ 
+	{15, 10148}, 		/* ` */ 
+	{35, 10196}, 		/* a */ 
+	{39, 10346}, 		/* b */ 
+	{33, 10522}, 		/* c */ 
+	{39, 10653}, 		/* d */ 
+	{39, 10799}, 		/* e */ 
+	{28, 10954}, 		/* f */ 
+	{40, 11015}, 		/* g */ 
+	{37, 11239}, 		/* h */ 
+	{10, 11331}, 		/* i */ 
+	{19, 11365}, 		/* j */ 
+	{35, 11428}, 		/* k */ 
+	{8, 11638}, 		/* l */ 
+	{63, 11653}, 		/* m */ 
+	{37, 11769}, 		/* n */ 
+	{42, 11852}, 		/* o */ 
+	{39, 12006}, 		/* p */ 
+	{39, 12177}, 		/* q */ 
+	{25, 12318}, 		/* r */ 
+	{30, 12381}, 		/* s */ 
+	{27, 12539}, 		/* t */ 
+	{36, 12598}, 		/* u */ 
+	{40, 12671}, 		/* v */ 
+	{63, 12842}, 		/* w */ 
+	{37, 13098}, 		/* x */ 
+	{40, 13280}, 		/* y */ 
+	{30, 13481}, 		/* z */ 
+	{23, 13620}, 		/* { */ 
+	{8, 13734}, 		/* | */ 
+	{24, 13746}, 		/* } */ 
+	{42, 13860}, 		/* ~ */ 
+};
+
+/*==================[external data definition]===============================*/
+
+Font_t font_22_rle = {
+	22,
+	font22_rle_info,
+	font22_rle_data,
+	FONT_RLE
+};
+
+Font_t font_30_rle = {
+	30,
+	font30_rle_info,
+	font30_rle_data,
+	FONT_RLE
+};
+
+Font_t font_59_rle = {
+	59,
+	font59_rle_info,
+	font59_rle_data,
+	FONT_RLE
+};
+
+Font_t font_89_rle = {
+	89,
+	font89_rle_info,
+	font89_rle_data,
+	FONT_RLE
+};
+
+/*==================[end of file]============================================*/
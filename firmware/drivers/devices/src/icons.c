@@ -12848,28 +12848,36 @@ icon_font_t icon_22 = {
     22,
     22,
     66,
-    icon22_data
+    icon22_data,
+    FONT_BITMAP,
+    NULL
 };
 
 icon_font_t icon_30 = {
     30,
     30,
     120,
-    icon30_data
+    icon30_data,
+    FONT_BITMAP,
+    NULL
 };
 
 icon_font_t icon_59 = {
     59,
     59,
     472,
-    icon59_data
+    icon59_data,
+    FONT_BITMAP,
+    NULL
 };
 
 icon_font_t icon_89 = {
     89,
     89,
     1068,
-    icon89_data
+    icon89_data,
+    FONT_BITMAP,
+    NULL
 };
 
 /*==================[internal functions definition]==========================*/
@@ -0,0 +1,2815 @@
+/**
+ * @file icons_rle.c
+ * @brief Run-length compressed version of icons.c. Created with tools/font_rle.py
+ */
+
+/*==================[inclusions]=============================================*/
+#include "icons.h"
+/*==================[internal data definition]===============================*/
+/**
+ * @brief 30x30 pixels run-length compressed icons array.
+ */
+const uint8_t icon30_rle_data[] = {
+	0x83, 0x04, 0xF0, 0xF0, 0x05, 0x5F, 0x02, 0x80, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x3F, 0x07, 0x50,
+	0x87, 0x01, 0x22, 0xF0, 0x42, 0x50, 0x07, 0x22, 0xF0, 0x44, 0x30, 0x87, 0x07, 0x22, 0xF0, 0x45,
+	0x20, 0x07, 0x22, 0xF0, 0x43, 0x40, 0x87, 0x01, 0x22, 0xF0, 0x42, 0x50, 0x05, 0x3F, 0x07, 0x50,
+	0x05, 0x3F, 0x06, 0x60, 0x05, 0x5F, 0x02, 0x80, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0,
+	0x05, 0x5F, 0x02, 0x80, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x3F, 0x07, 0x50, 0x07, 0x22, 0xF0, 0x42,
+	0x50, 0x07, 0x22, 0x32, 0xE2, 0x50, 0x07, 0x22, 0x24, 0xD4, 0x30, 0x87, 0x07, 0x22, 0x24, 0xD5,
+	0x20, 0x07, 0x22, 0x24, 0xD3, 0x40, 0x07, 0x22, 0x32, 0xE2, 0x50, 0x07, 0x22, 0xF0, 0x42, 0x50,
+	0x05, 0x3F, 0x07, 0x50, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x5F, 0x02, 0x80, 0x83, 0x04, 0xF0, 0xF0,
+	0x83, 0x04, 0xF0, 0xF0, 0x05, 0x5F, 0x02, 0x80, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x3F, 0x07, 0x50,
+	0x07, 0x22, 0xF0, 0x42, 0x50, 0x07, 0x22, 0x36, 0xA2, 0x50, 0x07, 0x22, 0x28, 0x94, 0x30, 0x87,
+	0x07, 0x22, 0x28, 0x95, 0x20, 0x07, 0x22, 0x28, 0x93, 0x40, 0x07, 0x22, 0x36, 0xA2, 0x50, 0x07,
+	0x22, 0xF0, 0x42, 0x50, 0x05, 0x3F, 0x07, 0x50, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x5F, 0x02, 0x80,
+	0x83, 0x04, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x05, 0x5F, 0x02, 0x80, 0x05, 0x3F, 0x06, 0x60,
+	0x05, 0x3F, 0x07, 0x50, 0x07, 0x22, 0xF0, 0x42, 0x50, 0x07, 0x22, 0x39, 0x72, 0x50, 0x07, 0x22,
+	0x2B, 0x64, 0x30, 0x87, 0x07, 0x22, 0x2B, 0x65, 0x20, 0x07, 0x22, 0x2B, 0x63, 0x40, 0x07, 0x22,
+	0x39, 0x72, 0x50, 0x07, 0x22, 0xF0, 0x42, 0x50, 0x05, 0x3F, 0x07, 0x50, 0x05, 0x3F, 0x06, 0x60,
+	0x05, 0x5F, 0x02, 0x80, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x05, 0x5F, 0x02, 0x80,
+	0x05, 0x3F, 0x06, 0x60, 0x05, 0x3F, 0x07, 0x50, 0x07, 0x22, 0xF0, 0x42, 0x50, 0x07, 0x22, 0x3D,
+	0x32, 0x50, 0x07, 0x22, 0x2F, 0x24, 0x30, 0x87, 0x07, 0x22, 0x2F, 0x25, 0x20, 0x07, 0x22, 0x2F,
+	0x23, 0x40, 0x07, 0x22, 0x3D, 0x32, 0x50, 0x07, 0x22, 0xF0, 0x42, 0x50, 0x05, 0x3F, 0x07, 0x50,
+	0x05, 0x3F, 0x06, 0x60, 0x05, 0x5F, 0x02, 0x80, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0,
+	0x05, 0x5F, 0x02, 0x80, 0x05, 0x3F, 0x06, 0x60, 0x05, 0x3F, 0x07, 0x50, 0x87, 0x01, 0x22, 0xF0,
+	0x42, 0x50, 0x07, 0x22, 0xF0, 0x44, 0x30, 0x07, 0x22, 0xF0, 0x45, 0x20, 0x07, 0x22, 0x83, 0x85,
+	0x20, 0x07, 0x22, 0x84, 0x75, 0x20, 0x09, 0x22, 0x43, 0x16, 0x55, 0x20, 0x09, 0x22, 0x65, 0x13,
+	0x45, 0x20, 0x07, 0x22, 0x74, 0x85, 0x20, 0x07, 0x22, 0x92, 0x85, 0x20, 0x07, 0x22, 0xA1, 0x85,
+	0x20, 0x07, 0x22, 0xF0, 0x43, 0x40, 0x87, 0x01, 0x22, 0xF0, 0x42, 0x50, 0x05, 0x3F, 0x07, 0x50,
+	0x05, 0x3F, 0x06, 0x60, 0x05, 0x5F, 0x02, 0x80, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0,
+	0x05, 0xF0, 0x64, 0x50, 0x05, 0xF0, 0x56, 0x40, 0x87, 0x03, 0xF0, 0x52, 0x22, 0x40, 0x07, 0xD4,
+	0x32, 0x22, 0x40, 0x07, 0xC6, 0x22, 0x22, 0x40, 0x89, 0x03, 0xC2, 0x22, 0x22, 0x22, 0x40, 0x0B,
+	0x62, 0x42, 0x22, 0x22, 0x22, 0x40, 0x0B, 0x45, 0x32, 0x22, 0x22, 0x22, 0x40, 0x0D, 0x42, 0x13,
+	0x22, 0x22, 0x22, 0x22, 0x40, 0x8D, 0x05, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x07, 0x46,
+	0x26, 0x26, 0x40, 0x07, 0x54, 0x44, 0x44, 0x50, 0x07, 0x61, 0x72, 0x71, 0x60, 0x83, 0x01, 0xF0,
+	0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x05, 0xF0, 0x72, 0x60, 0x05, 0xF0, 0x65, 0x40, 0x07, 0xF0, 0x53,
+	0x12, 0x40, 0x87, 0x03, 0xF0, 0x52, 0x22, 0x40, 0x07, 0xD4, 0x32, 0x22, 0x40, 0x07, 0xC6, 0x22,
+	0x22, 0x40, 0x89, 0x03, 0xC2, 0x22, 0x22, 0x22, 0x40, 0x0B, 0x54, 0x32, 0x22, 0x22, 0x22, 0x40,
+	0x8B, 0x07, 0x46, 0x22, 0x22, 0x22, 0x22, 0x40, 0x07, 0x46, 0x26, 0x26, 0x40, 0x07, 0x54, 0x44,
+	0x44, 0x50, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x05, 0xF0, 0x72, 0x60, 0x05, 0xF0,
+	0x65, 0x40, 0x07, 0xF0, 0x53, 0x12, 0x40, 0x87, 0x03, 0xF0, 0x52, 0x22, 0x40, 0x07, 0xD4, 0x32,
+	0x22, 0x40, 0x87, 0x04, 0xC6, 0x22, 0x22, 0x40, 0x09, 0x54, 0x36, 0x22, 0x22, 0x40, 0x89, 0x07,
+	0x46, 0x26, 0x22, 0x22, 0x40, 0x07, 0x46, 0x26, 0x26, 0x40, 0x07, 0x54, 0x44, 0x44, 0x50, 0x83,
+	0x02, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x05, 0xF0, 0x72, 0x60, 0x05, 0xF0, 0x65, 0x40, 0x85,
+	0x04, 0xF0, 0x56, 0x40, 0x05, 0xD4, 0x36, 0x40, 0x85, 0x04, 0xC6, 0x26, 0x40, 0x07, 0x54, 0x36,
+	0x26, 0x40, 0x87, 0x08, 0x46, 0x26, 0x26, 0x40, 0x07, 0x54, 0x44, 0x44, 0x50, 0x83, 0x02, 0xF0,
+	0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0xE2, 0xE0, 0x83, 0x01, 0xD4, 0xD0, 0x85, 0x01, 0xC2, 0x22,
+	0xC0, 0x85, 0x01, 0xB2, 0x42, 0xB0, 0x85, 0x01, 0xA2, 0x62, 0xA0, 0x85, 0x01, 0x92, 0x82, 0x90,
+	0x85, 0x01, 0x82, 0xA2, 0x80, 0x85, 0x01, 0x72, 0xC2, 0x70, 0x85, 0x01, 0x62, 0xE2, 0x60, 0x07,
+	0x52, 0x72, 0x72, 0x50, 0x07, 0x52, 0x48, 0x42, 0x50, 0x09, 0x43, 0x16, 0x26, 0x13, 0x40, 0x05,
+	0x56, 0x86, 0x50, 0x05, 0x62, 0xE2, 0x60, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x14, 0xF0, 0xF0, 0x83,
+	0x01, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x03, 0xE2, 0xE0, 0x83, 0x03, 0xF0, 0xF0,
+	0x83, 0x0E, 0xF0, 0xF0, 0x03, 0xD4, 0xD0, 0x03, 0xB8, 0xB0, 0x05, 0x94, 0x43, 0xA0, 0x05, 0x92,
+	0x82, 0x90, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x01, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0,
+	0x03, 0xE2, 0xE0, 0x83, 0x03, 0xF0, 0xF0, 0x83, 0x09, 0xF0, 0xF0, 0x03, 0xAA, 0xA0, 0x03, 0x8E,
+	0x80, 0x05, 0x65, 0x84, 0x70, 0x05, 0x53, 0xD3, 0x60, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x03, 0xD4,
+	0xD0, 0x03, 0xB8, 0xB0, 0x05, 0x94, 0x43, 0xA0, 0x05, 0x92, 0x82, 0x90, 0x83, 0x01, 0xF0, 0xF0,
+	0x83, 0x01, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x03, 0xE2, 0xE0, 0x83, 0x03, 0xF0,
+	0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xB8, 0xB0, 0x03, 0x7F, 0x80, 0x05, 0x56, 0x85, 0x60, 0x05,
+	0x44, 0xE4, 0x40, 0x07, 0x33, 0xF0, 0x33, 0x30, 0x07, 0x14, 0xF0, 0x53, 0x20, 0x07, 0x12, 0x7A,
+	0x63, 0x10, 0x03, 0x8E, 0x80, 0x05, 0x65, 0x84, 0x70, 0x05, 0x53, 0xD3, 0x60, 0x07, 0x52, 0xF0,
+	0x12, 0x50, 0x03, 0xD4, 0xD0, 0x03, 0xB8, 0xB0, 0x05, 0x94, 0x43, 0xA0, 0x05, 0x92, 0x82, 0x90,
+	0x83, 0x01, 0xF0, 0xF0, 0x83, 0x01, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x03, 0xE2,
+	0xE0, 0x83, 0x03, 0xF0, 0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x05, 0xF0, 0xB1, 0x30, 0x05, 0xF0, 0xA2,
+	0x30, 0x05, 0xB8, 0x52, 0x40, 0x05, 0x7D, 0x32, 0x50, 0x05, 0x56, 0xB3, 0x50, 0x05, 0x44, 0xD5,
+	0x40, 0x07, 0x33, 0xE2, 0x23, 0x30, 0x07, 0x14, 0xE2, 0x43, 0x20, 0x09, 0x12, 0x75, 0x33, 0x53,
+	0x10, 0x05, 0x86, 0x35, 0x80, 0x05, 0x64, 0x67, 0x70, 0x07, 0x53, 0x72, 0x43, 0x60, 0x07, 0x52,
+	0x72, 0x72, 0x50, 0x03, 0xD4, 0xD0, 0x03, 0xC7, 0xB0, 0x05, 0xB2, 0x43, 0xA0, 0x05, 0xA2, 0x72,
+	0x90, 0x05, 0x92, 0xF0, 0x40, 0x05, 0x82, 0xF0, 0x50, 0x05, 0x72, 0x44, 0xD0, 0x05, 0x62, 0x54,
+	0xD0, 0x05, 0x52, 0x56, 0xC0, 0x05, 0x42, 0x74, 0xD0, 0x05, 0x32, 0x92, 0xE0, 0x05, 0x22, 0xF0,
+	0xB0, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0xD2, 0xF0, 0x03, 0xD3, 0xE0, 0x03,
+	0xD4, 0xD0, 0x03, 0xD5, 0xC0, 0x05, 0xD2, 0x13, 0xB0, 0x05, 0xD2, 0x23, 0xA0, 0x07, 0x91, 0x32,
+	0x33, 0x90, 0x07, 0x92, 0x22, 0x33, 0x90, 0x07, 0x93, 0x12, 0x23, 0xA0, 0x05, 0xA5, 0x13, 0xB0,
+	0x03, 0xB7, 0xC0, 0x03, 0xC5, 0xD0, 0x03, 0xD3, 0xE0, 0x03, 0xC5, 0xD0, 0x03, 0xB7, 0xC0, 0x05,
+	0xA5, 0x13, 0xB0, 0x07, 0x93, 0x12, 0x23, 0xA0, 0x07, 0x92, 0x22, 0x33, 0x90, 0x07, 0x91, 0x32,
+	0x33, 0x90, 0x05, 0xD2, 0x23, 0xA0, 0x05, 0xD2, 0x13, 0xB0, 0x03, 0xD5, 0xC0, 0x03, 0xD4, 0xD0,
+	0x03, 0xD3, 0xE0, 0x03, 0xD2, 0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x06, 0xF0, 0xF0, 0x07, 0x28,
+	0x2F, 0x01, 0x20, 0x05, 0x28, 0xF4, 0x10, 0x8B, 0x01, 0x22, 0x12, 0x12, 0xF0, 0x22, 0x10, 0x89,
+	0x01, 0x22, 0x42, 0xF0, 0x22, 0x10, 0x87, 0x01, 0x28, 0xF0, 0x22, 0x10, 0x87, 0x06, 0x52, 0xF0,
+	0x52, 0x10, 0x07, 0x52, 0x2F, 0x05, 0x10, 0x07, 0x52, 0x2F, 0x04, 0x20, 0x87, 0x02, 0x52, 0x52,
+	0x52, 0x90, 0x05, 0x52, 0x2E, 0x70, 0x05, 0x52, 0x2F, 0x60, 0x03, 0xF0, 0xF0, 0x83, 0x05, 0xF0,
+	0xF0, 0x87, 0x01, 0x28, 0x2F, 0x01, 0x20, 0x8B, 0x01, 0x22, 0x12, 0x12, 0xF0, 0x22, 0x10, 0x89,
+	0x01, 0x22, 0x42, 0xF0, 0x22, 0x10, 0x87, 0x01, 0x28, 0xF0, 0x22, 0x10, 0x87, 0x02, 0x52, 0xF0,
+	0x52, 0x10, 0x07, 0x52, 0xB7, 0x22, 0x10, 0x07, 0x52, 0xA9, 0x21, 0x10, 0x05, 0x52, 0x9B, 0x30,
+	0x09, 0x52, 0x92, 0x24, 0x22, 0x20, 0x09, 0x52, 0x84, 0x22, 0x24, 0x10, 0x09, 0x52, 0x25, 0x15,
+	0x45, 0x10, 0x09, 0x52, 0x25, 0x16, 0x26, 0x10, 0x09, 0x52, 0x52, 0x15, 0x45, 0x10, 0x0B, 0x52,
+	0x52, 0x14, 0x22, 0x24, 0x10, 0x0B, 0x52, 0x43, 0x22, 0x24, 0x13, 0x20, 0x07, 0x52, 0x26, 0x1C,
+	0x20, 0x07, 0x51, 0x36, 0x2A, 0x30, 0x05, 0xF0, 0x37, 0x50, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xE2,
+	0xE0, 0x83, 0x01, 0xD4, 0xD0, 0x83, 0x01, 0xC6, 0xC0, 0x05, 0xE2, 0x45, 0x50, 0x05, 0xE2, 0x36,
+	0x50, 0x09, 0x73, 0x42, 0x32, 0x22, 0x50, 0x09, 0x65, 0x32, 0x32, 0x22, 0x50, 0x09, 0x62, 0x12,
+	0x32, 0x36, 0x50, 0x09, 0x62, 0x12, 0x32, 0x45, 0x50, 0x07, 0x65, 0x32, 0x52, 0x70, 0x07, 0x73,
+	0x42, 0x52, 0x70, 0x05, 0x73, 0x49, 0x70, 0x05, 0x82, 0x48, 0x80, 0x03, 0x89, 0xD0, 0x03, 0x97,
+	0xE0, 0x83, 0x01, 0xD3, 0xE0, 0x03, 0xC6, 0xC0, 0x05, 0xB3, 0x23, 0xB0, 0x85, 0x01, 0xB2, 0x42,
+	0xB0, 0x05, 0xC2, 0x22, 0xC0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x83, 0x07, 0xF0, 0xF0, 0x05,
+	0xF0, 0x22, 0xB0, 0x05, 0xF0, 0x23, 0xA0, 0x05, 0xF0, 0x24, 0x90, 0x05, 0xF0, 0x25, 0x80, 0x07,
+	0xF0, 0x22, 0x13, 0x70, 0x05, 0x4F, 0x23, 0x60, 0x05, 0x4E, 0x43, 0x50, 0x07, 0x42, 0xF0, 0x23,
+	0x40, 0x07, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x42, 0xF0, 0x23, 0x40, 0x05, 0x4E, 0x43, 0x50, 0x05,
+	0x4F, 0x23, 0x60, 0x05, 0x5E, 0x13, 0x70, 0x05, 0xF0, 0x25, 0x80, 0x05, 0xF0, 0x24, 0x90, 0x05,
+	0xF0, 0x23, 0xA0, 0x05, 0xF0, 0x22, 0xB0, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x06, 0xF0, 0xF0, 0x05,
+	0xC1, 0xF0, 0x20, 0x05, 0xB3, 0xF0, 0x10, 0x05, 0xA4, 0xF0, 0x10, 0x05, 0x95, 0xF0, 0x10, 0x07,
+	0x83, 0x12, 0xF0, 0x10, 0x07, 0x64, 0x22, 0xF0, 0x10, 0x05, 0x53, 0x4F, 0x30, 0x07, 0x43, 0x5F,
+	0x01, 0x20, 0x07, 0x33, 0xF0, 0x52, 0x20, 0x07, 0x32, 0xF0, 0x62, 0x20, 0x07, 0x33, 0xF0, 0x52,
+	0x20, 0x05, 0x43, 0x6F, 0x20, 0x07, 0x53, 0x4F, 0x01, 0x20, 0x05, 0x63, 0x3F, 0x30, 0x07, 0x73,
+	0x22, 0xF0, 0x10, 0x05, 0x86, 0xF0, 0x10, 0x05, 0x95, 0xF0, 0x10, 0x05, 0xB3, 0xF0, 0x10, 0x05,
+	0xC2, 0xF0, 0x10, 0x83, 0x03, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xC6, 0xC0, 0x03, 0xB8,
+	0xB0, 0x85, 0x0B, 0xB2, 0x42, 0xB0, 0x85, 0x01, 0x67, 0x47, 0x60, 0x05, 0x72, 0xC2, 0x70, 0x05,
+	0x82, 0xA2, 0x80, 0x05, 0x83, 0x83, 0x80, 0x05, 0x93, 0x63, 0x90, 0x05, 0xA3, 0x43, 0xA0, 0x05,
+	0xB3, 0x23, 0xB0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x03, 0xE2, 0xE0, 0x03, 0xF0, 0xF0, 0x83,
+	0x03, 0xF0, 0xF0, 0x03, 0xE2, 0xE0, 0x03, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x05, 0xB3, 0x23, 0xB0,
+	0x05, 0xB2, 0x42, 0xB0, 0x05, 0xA2, 0x62, 0xA0, 0x05, 0x92, 0x82, 0x90, 0x05, 0x83, 0x83, 0x80,
+	0x05, 0x73, 0xA3, 0x70, 0x05, 0x66, 0x66, 0x60, 0x85, 0x01, 0x67, 0x47, 0x60, 0x85, 0x0A, 0xB2,
+	0x42, 0xB0, 0x83, 0x01, 0xB8, 0xB0, 0x03, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x05, 0x54, 0xF0,
+	0x60, 0x05, 0x56, 0xF0, 0x40, 0x07, 0x42, 0x25, 0xF0, 0x20, 0x07, 0x42, 0x44, 0xF0, 0x10, 0x05,
+	0x42, 0x64, 0xE0, 0x05, 0x42, 0x84, 0xC0, 0x05, 0x42, 0xA4, 0xA0, 0x05, 0x42, 0xC4, 0x80, 0x05,
+	0x42, 0xD5, 0x60, 0x05, 0x42, 0xF4, 0x50, 0x07, 0x42, 0xF0, 0x24, 0x30, 0x87, 0x01, 0x42, 0xF0,
+	0x42, 0x30, 0x07, 0x42, 0xF0, 0x33, 0x30, 0x07, 0x42, 0xF0, 0x23, 0x40, 0x05, 0x42, 0xF4, 0x50,
+	0x05, 0x42, 0xD4, 0x70, 0x05, 0x42, 0xB4, 0x90, 0x05, 0x42, 0x94, 0xB0, 0x05, 0x42, 0x84, 0xC0,
+	0x05, 0x42, 0x64, 0xE0, 0x07, 0x42, 0x44, 0xF0, 0x10, 0x07, 0x43, 0x14, 0xF0, 0x30, 0x05, 0x55,
+	0xF0, 0x50, 0x05, 0x63, 0xF0, 0x60, 0x03, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x05, 0x64, 0xA4,
+	0x60, 0x05, 0x48, 0x68, 0x40, 0x09, 0x42, 0x42, 0x62, 0x42, 0x40, 0x89, 0x12, 0x42, 0x43, 0x43,
+	0x42, 0x40, 0x05, 0x48, 0x68, 0x40, 0x05, 0x57, 0x67, 0x50, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x03,
+	0xF0, 0xF0, 0x03, 0xE2, 0xE0, 0x03, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x05, 0xB3, 0x23, 0xB0, 0x05,
+	0xA3, 0x43, 0xA0, 0x05, 0xA2, 0x62, 0xA0, 0x05, 0x92, 0x82, 0x90, 0x05, 0x83, 0x83, 0x80, 0x05,
+	0x73, 0xA3, 0x70, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x52, 0xF0, 0x12, 0x50,
+	0x07, 0x42, 0xF0, 0x32, 0x40, 0x85, 0x01, 0x4F, 0x07, 0x40, 0x05, 0x6F, 0x03, 0x60, 0x83, 0x01,
+	0xF0, 0xF0, 0x05, 0x5F, 0x05, 0x50, 0x05, 0x4F, 0x07, 0x40, 0x87, 0x01, 0x42, 0xF0, 0x32, 0x40,
+	0x05, 0x4F, 0x07, 0x40, 0x05, 0x5F, 0x05, 0x50, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0,
+	0x05, 0x33, 0x93, 0xC0, 0x05, 0x35, 0x66, 0xA0, 0x09, 0x22, 0x23, 0x52, 0x23, 0x90, 0x09, 0x22,
+	0x33, 0x42, 0x33, 0x80, 0x09, 0x22, 0x43, 0x32, 0x43, 0x70, 0x09, 0x22, 0x53, 0x22, 0x53, 0x60,
+	0x09, 0x22, 0x72, 0x12, 0x64, 0x40, 0x07, 0x22, 0x84, 0x83, 0x30, 0x07, 0x22, 0x93, 0x93, 0x20,
+	0x07, 0x22, 0xA2, 0xA3, 0x10, 0x07, 0x22, 0xA2, 0xB2, 0x10, 0x07, 0x22, 0xA2, 0x93, 0x20, 0x07,
+	0x22, 0x93, 0x83, 0x30, 0x07, 0x22, 0x75, 0x73, 0x40, 0x09, 0x22, 0x63, 0x12, 0x63, 0x50, 0x09,
+	0x22, 0x53, 0x22, 0x53, 0x60, 0x09, 0x22, 0x43, 0x32, 0x43, 0x70, 0x09, 0x22, 0x33, 0x42, 0x24,
+	0x80, 0x09, 0x22, 0x13, 0x62, 0x13, 0xA0, 0x05, 0x34, 0x84, 0xB0, 0x05, 0x33, 0x93, 0xC0, 0x83,
+	0x02, 0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0, 0x05, 0xC3, 0x93, 0x30, 0x05, 0xA6, 0x65, 0x30, 0x09,
+	0x93, 0x22, 0x53, 0x22, 0x20, 0x09, 0x83, 0x32, 0x43, 0x32, 0x20, 0x09, 0x73, 0x42, 0x33, 0x42,
+	0x20, 0x09, 0x63, 0x52, 0x23, 0x52, 0x20, 0x09, 0x53, 0x62, 0x12, 0x72, 0x20, 0x07, 0x34, 0x74,
+	0x82, 0x20, 0x07, 0x23, 0x93, 0x92, 0x20, 0x07, 0x13, 0xA2, 0xA2, 0x20, 0x07, 0x12, 0xB2, 0xA2,
+	0x20, 0x07, 0x23, 0x92, 0xA2, 0x20, 0x07, 0x33, 0x84, 0x82, 0x20, 0x07, 0x43, 0x75, 0x72, 0x20,
+	0x09, 0x53, 0x62, 0x13, 0x62, 0x20, 0x09, 0x63, 0x52, 0x23, 0x52, 0x20, 0x09, 0x73, 0x42, 0x33,
+	0x42, 0x20, 0x09, 0x84, 0x22, 0x43, 0x32, 0x20, 0x09, 0xA3, 0x12, 0x63, 0x12, 0x20, 0x05, 0xB4,
+	0x84, 0x30, 0x05, 0xC3, 0x93, 0x30, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x05, 0x52,
+	0xE4, 0x50, 0x05, 0x45, 0xB6, 0x40, 0x09, 0x42, 0x13, 0xA2, 0x22, 0x40, 0x09, 0x42, 0x24, 0x82,
+	0x22, 0x40, 0x09, 0x42, 0x44, 0x62, 0x22, 0x40, 0x09, 0x42, 0x63, 0x52, 0x22, 0x40, 0x09, 0x42,
+	0x74, 0x32, 0x22, 0x40, 0x09, 0x42, 0x94, 0x12, 0x22, 0x40, 0x07, 0x42, 0xA6, 0x22, 0x40, 0x07,
+	0x42, 0xC4, 0x22, 0x40, 0x87, 0x01, 0x42, 0xE2, 0x22, 0x40, 0x07, 0x42, 0xD3, 0x22, 0x40, 0x07,
+	0x42, 0xB5, 0x22, 0x40, 0x07, 0x42, 0xA6, 0x22, 0x40, 0x09, 0x42, 0x84, 0x22, 0x22, 0x40, 0x09,
+	0x42, 0x73, 0x42, 0x22, 0x40, 0x09, 0x42, 0x54, 0x52, 0x22, 0x40, 0x09, 0x42, 0x34, 0x72, 0x22,
+	0x40, 0x09, 0x42, 0x24, 0x82, 0x22, 0x40, 0x07, 0x46, 0xA2, 0x22, 0x40, 0x05, 0x44, 0xC6, 0x40,
+	0x05, 0x52, 0xE4, 0x50, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x05, 0x54, 0xE2, 0x50,
+	0x05, 0x46, 0xB5, 0x40, 0x09, 0x42, 0x22, 0xA3, 0x12, 0x40, 0x09, 0x42, 0x22, 0x84, 0x22, 0x40,
+	0x09, 0x42, 0x22, 0x64, 0x42, 0x40, 0x09, 0x42, 0x22, 0x54, 0x52, 0x40, 0x09, 0x42, 0x22, 0x34,
+	0x72, 0x40, 0x09, 0x42, 0x22, 0x14, 0x92, 0x40, 0x07, 0x42, 0x26, 0xA2, 0x40, 0x07, 0x42, 0x24,
+	0xC2, 0x40, 0x87, 0x01, 0x42, 0x22, 0xE2, 0x40, 0x07, 0x42, 0x23, 0xD2, 0x40, 0x07, 0x42, 0x25,
+	0xB2, 0x40, 0x07, 0x42, 0x26, 0xA2, 0x40, 0x09, 0x42, 0x22, 0x24, 0x82, 0x40, 0x09, 0x42, 0x22,
+	0x43, 0x72, 0x40, 0x09, 0x42, 0x22, 0x54, 0x52, 0x40, 0x09, 0x42, 0x22, 0x74, 0x32, 0x40, 0x09,
+	0x42, 0x22, 0x84, 0x22, 0x40, 0x07, 0x42, 0x22, 0xA6, 0x40, 0x05, 0x46, 0xC4, 0x40, 0x05, 0x54,
+	0xE2, 0x50, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x83, 0x02, 0xE2, 0xE0, 0x07, 0xA2,
+	0x22, 0x22, 0xA0, 0x07, 0x84, 0x22, 0x24, 0x80, 0x07, 0x73, 0x42, 0x43, 0x70, 0x07, 0x63, 0x52,
+	0x53, 0x60, 0x07, 0x62, 0x62, 0x62, 0x60, 0x07, 0x52, 0x72, 0x72, 0x50, 0x07, 0x43, 0x72, 0x73,
+	0x40, 0x87, 0x01, 0x42, 0x82, 0x82, 0x40, 0x87, 0x04, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x43, 0xF0,
+	0x13, 0x40, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x05, 0x53, 0xE3, 0x50, 0x05, 0x63, 0xC3, 0x60, 0x05,
+	0x73, 0xA3, 0x70, 0x05, 0x84, 0x64, 0x80, 0x03, 0xAA, 0xA0, 0x03, 0xC6, 0xC0, 0x03, 0xF0, 0xF0,
+	0x83, 0x02, 0xF0, 0xF0, 0x03, 0xE2, 0xE0, 0x03, 0xB8, 0xB0, 0x05, 0xB3, 0x23, 0xB0, 0x05, 0xB2,
+	0x42, 0xB0, 0x09, 0x62, 0x32, 0x42, 0x41, 0x60, 0x05, 0x57, 0x58, 0x50, 0x05, 0x47, 0x78, 0x40,
+	0x07, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x32, 0x84, 0x73, 0x30, 0x07, 0x33, 0x66, 0x72, 0x30, 0x09,
+	0x34, 0x42, 0x42, 0x44, 0x30, 0x89, 0x01, 0x52, 0x32, 0x62, 0x32, 0x50, 0x09, 0x52, 0x32, 0x62,
+	0x31, 0x60, 0x09, 0x52, 0x32, 0x62, 0x32, 0x50, 0x09, 0x34, 0x42, 0x42, 0x43, 0x40, 0x07, 0x32,
+	0x68, 0x53, 0x30, 0x07, 0x33, 0x74, 0x82, 0x30, 0x07, 0x42, 0xF0, 0x32, 0x40, 0x05, 0x48, 0x77,
+	0x40, 0x05, 0x58, 0x57, 0x50, 0x09, 0x61, 0x42, 0x42, 0x32, 0x60, 0x05, 0xB2, 0x42, 0xB0, 0x03,
+	0xB8, 0xB0, 0x03, 0xC6, 0xC0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xC6, 0xC0,
+	0x03, 0xAA, 0xA0, 0x05, 0x94, 0x44, 0x90, 0x05, 0x83, 0x82, 0x90, 0x05, 0x82, 0xF0, 0x50, 0x05,
+	0x72, 0xC2, 0x70, 0x05, 0x72, 0xB4, 0x60, 0x05, 0x72, 0xA6, 0x50, 0x05, 0x72, 0x98, 0x40, 0x09,
+	0x72, 0x92, 0x12, 0x13, 0x30, 0x09, 0x72, 0x91, 0x22, 0x22, 0x30, 0x85, 0x01, 0x72, 0xC2, 0x70,
+	0x09, 0x41, 0x22, 0x21, 0x92, 0x70, 0x09, 0x33, 0x12, 0x12, 0x92, 0x70, 0x05, 0x48, 0x92, 0x70,
+	0x05, 0x56, 0xA2, 0x70, 0x05, 0x64, 0xB2, 0x70, 0x05, 0x72, 0xC2, 0x70, 0x05, 0xF0, 0x52, 0x80,
+	0x05, 0xA1, 0x83, 0x80, 0x05, 0x94, 0x44, 0x90, 0x03, 0xAA, 0xA0, 0x03, 0xC6, 0xC0, 0x83, 0x01,
+	0xF0, 0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x0B, 0xE2, 0xE0, 0x07, 0xA3, 0x12, 0x13, 0xA0, 0x03,
+	0xB8, 0xB0, 0x03, 0xC6, 0xC0, 0x05, 0xD4, 0x81, 0x40, 0x07, 0x42, 0x82, 0x82, 0x40, 0x87, 0x02,
+	0x42, 0xF0, 0x32, 0x40, 0x05, 0x4F, 0x07, 0x40, 0x05, 0x5F, 0x05, 0x50, 0x83, 0x02, 0xF0, 0xF0,
+	0x83, 0x04, 0xF0, 0xF0, 0x05, 0x5F, 0x01, 0x90, 0x05, 0x4F, 0x03, 0x80, 0x07, 0x42, 0x22, 0x85,
+	0x70, 0x09, 0x42, 0x22, 0x82, 0x13, 0x60, 0x09, 0x42, 0x22, 0x82, 0x24, 0x40, 0x07, 0x42, 0x2C,
+	0x42, 0x40, 0x07, 0x42, 0x3A, 0x52, 0x40, 0x87, 0x03, 0x42, 0xF0, 0x32, 0x40, 0x87, 0x01, 0x42,
+	0x2E, 0x22, 0x40, 0x89, 0x06, 0x42, 0x13, 0xA3, 0x12, 0x40, 0x05, 0x4F, 0x07, 0x40, 0x05, 0x5F,
+	0x05, 0x50, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x05, 0xF0, 0x25, 0x80, 0x03, 0xF8,
+	0x70, 0x05, 0xD4, 0x23, 0x80, 0x05, 0xD2, 0x42, 0x90, 0x07, 0xC3, 0x32, 0x51, 0x40, 0x07, 0xC2,
+	0x32, 0x53, 0x30, 0x07, 0xC2, 0x22, 0x54, 0x30, 0x07, 0xB3, 0x22, 0x45, 0x30, 0x09, 0xC2, 0x23,
+	0x22, 0x22, 0x30, 0x07, 0xC2, 0x35, 0x32, 0x30, 0x07, 0xB3, 0x43, 0x32, 0x40, 0x05, 0xA3, 0xB2,
+	0x40, 0x05, 0x93, 0xB2, 0x50, 0x05, 0x83, 0x59, 0x50, 0x05, 0x73, 0x58, 0x70, 0x07, 0x63, 0x53,
+	0x21, 0xA0, 0x05, 0x53, 0x53, 0xE0, 0x05, 0x43, 0x53, 0xF0, 0x07, 0x33, 0x53, 0xF0, 0x10, 0x07,
+	0x32, 0x53, 0xF0, 0x20, 0x07, 0x32, 0x43, 0xF0, 0x30, 0x07, 0x33, 0x23, 0xF0, 0x40, 0x05, 0x46,
+	0xF0, 0x50, 0x05, 0x54, 0xF0, 0x60, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0x79,
+	0xE0, 0x03, 0x6C, 0xC0, 0x05, 0x53, 0x65, 0xB0, 0x05, 0x52, 0x85, 0xA0, 0x07, 0x52, 0x82, 0x13,
+	0x90, 0x07, 0x52, 0x82, 0x23, 0x80, 0x07, 0x52, 0x82, 0x33, 0x70, 0x07, 0x52, 0x82, 0x43, 0x60,
+	0x07, 0x52, 0x83, 0x33, 0x60, 0x05, 0x52, 0x99, 0x50, 0x05, 0x52, 0xA8, 0x50, 0x87, 0x0B, 0x52,
+	0xF0, 0x12, 0x50, 0x05, 0x53, 0xE3, 0x50, 0x05, 0x6F, 0x03, 0x60, 0x05, 0x7F, 0x01, 0x70, 0x03,
+	0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0, 0x05, 0x48, 0xF0, 0x30, 0x05, 0x3A, 0xF0, 0x20, 0x07, 0x23,
+	0x63, 0xF0, 0x10, 0x05, 0x22, 0x8E, 0x40, 0x05, 0x22, 0x9E, 0x30, 0x07, 0x22, 0x74, 0xA3, 0x20,
+	0x05, 0x2B, 0xD2, 0x20, 0x05, 0x2A, 0xE2, 0x20, 0x07, 0x23, 0xF0, 0x62, 0x20, 0x87, 0x07, 0x22,
+	0xF0, 0x72, 0x20, 0x07, 0x23, 0xF0, 0x53, 0x20, 0x05, 0x3F, 0x09, 0x30, 0x05, 0x4F, 0x07, 0x40,
+	0x83, 0x03, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x05, 0xB3,
+	0x23, 0xB0, 0x05, 0xA3, 0x44, 0x90, 0x05, 0x83, 0x83, 0x80, 0x05, 0x73, 0xA3, 0x70, 0x05, 0x63,
+	0xC3, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x43, 0xF0, 0x13, 0x40, 0x87, 0x04, 0x42, 0xF0, 0x32,
+	0x40, 0x07, 0x42, 0x66, 0x62, 0x40, 0x07, 0x42, 0x58, 0x52, 0x40, 0x89, 0x05, 0x42, 0x52, 0x42,
+	0x52, 0x40, 0x85, 0x01, 0x49, 0x49, 0x40, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03,
+	0xD4, 0xD0, 0x03, 0xB8, 0xB0, 0x05, 0xA3, 0x43, 0xA0, 0x05, 0xA2, 0x62, 0xA0, 0x85, 0x04, 0x92,
+	0x82, 0x90, 0x05, 0xA2, 0x62, 0xA0, 0x05, 0xA4, 0x24, 0xA0, 0x03, 0xB8, 0xB0, 0x03, 0xD4, 0xD0,
+	0x83, 0x01, 0xF0, 0xF0, 0x05, 0x6F, 0x03, 0x60, 0x05, 0x5F, 0x05, 0x50, 0x87, 0x02, 0x52, 0xF0,
+	0x12, 0x50, 0x05, 0x53, 0xE3, 0x50, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x73, 0xA3, 0x70, 0x03, 0x8E,
+	0x80, 0x03, 0xAA, 0xA0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0, 0x05, 0xF0, 0xC1, 0x20,
+	0x05, 0xF0, 0xB2, 0x20, 0x05, 0xF0, 0xA2, 0x30, 0x05, 0xF0, 0x92, 0x40, 0x05, 0xF0, 0x82, 0x50,
+	0x05, 0xF0, 0x72, 0x60, 0x05, 0xF0, 0x62, 0x70, 0x05, 0xF0, 0x52, 0x80, 0x05, 0xF0, 0x42, 0x90,
+	0x05, 0xF0, 0x32, 0xA0, 0x05, 0x22, 0xD2, 0xB0, 0x05, 0x23, 0xB2, 0xC0, 0x05, 0x33, 0x92, 0xD0,
+	0x05, 0x43, 0x72, 0xE0, 0x05, 0x53, 0x52, 0xF0, 0x07, 0x63, 0x32, 0xF0, 0x10, 0x05, 0x76, 0xF0,
+	0x20, 0x05, 0x84, 0xF0, 0x30, 0x05, 0x92, 0xF0, 0x40, 0x83, 0x04, 0xF0, 0xF0, 0x83, 0x04, 0xF0,
+	0xF0, 0x07, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x05, 0x62, 0xE2, 0x60, 0x05,
+	0x72, 0xC2, 0x70, 0x05, 0x82, 0xA2, 0x80, 0x05, 0x92, 0x82, 0x90, 0x05, 0xA2, 0x62, 0xA0, 0x05,
+	0xB2, 0x42, 0xB0, 0x05, 0xC2, 0x22, 0xC0, 0x83, 0x02, 0xD4, 0xD0, 0x05, 0xC2, 0x22, 0xC0, 0x05,
+	0xB2, 0x42, 0xB0, 0x05, 0xA2, 0x62, 0xA0, 0x05, 0x92, 0x82, 0x90, 0x05, 0x82, 0xA2, 0x80, 0x05,
+	0x72, 0xC2, 0x70, 0x05, 0x62, 0xE2, 0x60, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x07, 0x42, 0xF0, 0x32,
+	0x40, 0x83, 0x03, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x03, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x05,
+	0xC2, 0x22, 0xC0, 0x85, 0x01, 0xB2, 0x42, 0xB0, 0x85, 0x01, 0xA2, 0x62, 0xA0, 0x07, 0x92, 0x32,
+	0x32, 0x90, 0x07, 0x83, 0x32, 0x33, 0x80, 0x07, 0x82, 0x42, 0x42, 0x80, 0x07, 0x73, 0x42, 0x43,
+	0x70, 0x07, 0x72, 0x52, 0x52, 0x70, 0x07, 0x63, 0x52, 0x53, 0x60, 0x07, 0x62, 0x62, 0x62, 0x60,
+	0x07, 0x52, 0x72, 0x72, 0x50, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x07, 0x42, 0xF0, 0x32, 0x40, 0x07,
+	0x42, 0x82, 0x82, 0x40, 0x07, 0x32, 0x92, 0x92, 0x30, 0x87, 0x01, 0x32, 0xF0, 0x52, 0x30, 0x05,
+	0x3F, 0x09, 0x30, 0x05, 0x4F, 0x07, 0x40, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03,
+	0xC6, 0xC0, 0x03, 0x9C, 0x90, 0x05, 0x84, 0x64, 0x80, 0x05, 0x64, 0xA4, 0x60, 0x05, 0x53, 0xE3,
+	0x50, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x87, 0x01, 0x42, 0x82, 0x82, 0x40, 0x87, 0x02, 0x32, 0x92,
+	0x92, 0x30, 0x07, 0x31, 0xA2, 0xA1, 0x30, 0x07, 0x22, 0xA2, 0xA2, 0x20, 0x07, 0x22, 0xA2, 0xA1,
+	0x30, 0x07, 0x32, 0x92, 0x92, 0x30, 0x87, 0x01, 0x32, 0xF0, 0x52, 0x30, 0x07, 0x33, 0x82, 0x83,
+	0x30, 0x07, 0x42, 0x82, 0x82, 0x40, 0x07, 0x43, 0xF0, 0x13, 0x40, 0x05, 0x53, 0xE3, 0x50, 0x05,
+	0x63, 0xC3, 0x60, 0x05, 0x74, 0x84, 0x70, 0x03, 0x9C, 0x90, 0x03, 0xB8, 0xB0, 0x83, 0x01, 0xF0,
+	0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0xC6, 0xC0, 0x03, 0x9C, 0x90, 0x05, 0x84, 0x64, 0x80, 0x05,
+	0x64, 0xA4, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x07, 0x42, 0x74, 0x72,
+	0x40, 0x07, 0x42, 0x66, 0x62, 0x40, 0x09, 0x32, 0x63, 0x23, 0x62, 0x30, 0x09, 0x32, 0x62, 0x42,
+	0x62, 0x30, 0x09, 0x32, 0x71, 0x42, 0x62, 0x30, 0x07, 0x31, 0xC2, 0x81, 0x30, 0x07, 0x22, 0xB3,
+	0x82, 0x20, 0x07, 0x22, 0xA3, 0x91, 0x30, 0x87, 0x01, 0x32, 0x92, 0x92, 0x30, 0x07, 0x32, 0xF0,
+	0x52, 0x30, 0x07, 0x33, 0xF0, 0x33, 0x30, 0x07, 0x42, 0x82, 0x82, 0x40, 0x07, 0x43, 0x72, 0x73,
+	0x40, 0x05, 0x53, 0xE3, 0x50, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x74, 0x84, 0x70, 0x03, 0x9C, 0x90,
+	0x03, 0xB8, 0xB0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0xC6, 0xC0, 0x03, 0x9C,
+	0x90, 0x05, 0x84, 0x64, 0x80, 0x05, 0x64, 0xA4, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x52, 0xF0,
+	0x12, 0x50, 0x87, 0x01, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x32, 0xF0, 0x52, 0x30, 0x89, 0x01, 0x32,
+	0x2F, 0x01, 0x22, 0x30, 0x09, 0x31, 0x32, 0xC2, 0x31, 0x30, 0x09, 0x22, 0x32, 0xC2, 0x32, 0x20,
+	0x09, 0x22, 0x32, 0xC2, 0x31, 0x30, 0x09, 0x32, 0x2F, 0x01, 0x22, 0x30, 0x07, 0x32, 0x3E, 0x32,
+	0x30, 0x07, 0x32, 0xF0, 0x52, 0x30, 0x07, 0x33, 0xF0, 0x33, 0x30, 0x07, 0x42, 0xF0, 0x32, 0x40,
+	0x07, 0x43, 0xF0, 0x13, 0x40, 0x05, 0x53, 0xE3, 0x50, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x74, 0x84,
+	0x70, 0x03, 0x9C, 0x90, 0x03, 0xB8, 0xB0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03,
+	0xE1, 0xF0, 0x03, 0xD3, 0xE0, 0x03, 0xC5, 0xD0, 0x05, 0xB3, 0x12, 0xD0, 0x05, 0xA3, 0x22, 0xD0,
+	0x05, 0xA2, 0x32, 0xD0, 0x05, 0x92, 0x32, 0xE0, 0x05, 0x83, 0x32, 0xE0, 0x05, 0x73, 0x48, 0x80,
+	0x05, 0x72, 0x5A, 0x60, 0x85, 0x01, 0x62, 0xE2, 0x60, 0x85, 0x04, 0x61, 0xF2, 0x60, 0x85, 0x01,
+	0x62, 0xE2, 0x60, 0x05, 0x62, 0xD2, 0x70, 0x05, 0x72, 0xC2, 0x70, 0x05, 0x74, 0x93, 0x70, 0x03,
+	0x8E, 0x80, 0x03, 0xAB, 0x90, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x03, 0xB8, 0xB0,
+	0x03, 0x9C, 0x90, 0x05, 0x74, 0x84, 0x70, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07,
+	0x43, 0x62, 0x83, 0x40, 0x07, 0x42, 0x72, 0x92, 0x40, 0x07, 0x33, 0x72, 0x93, 0x30, 0x87, 0x02,
+	0x32, 0x82, 0xA2, 0x30, 0x07, 0x22, 0x92, 0xB1, 0x30, 0x07, 0x22, 0x92, 0xB2, 0x20, 0x07, 0x31,
+	0xA2, 0xA1, 0x30, 0x07, 0x32, 0xA2, 0x82, 0x30, 0x07, 0x32, 0xB2, 0x72, 0x30, 0x07, 0x32, 0xC1,
+	0x72, 0x30, 0x87, 0x01, 0x42, 0xF0, 0x32, 0x40, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x05, 0x53, 0xE3,
+	0x50, 0x05, 0x64, 0xA4, 0x60, 0x05, 0x84, 0x64, 0x80, 0x03, 0x9C, 0x90, 0x03, 0xC6, 0xC0, 0x83,
+	0x01, 0xF0, 0xF0, 0x03, 0xF0, 0xF0, 0x07, 0x41, 0xF0, 0x51, 0x40, 0x07, 0x33, 0xF0, 0x33, 0x30,
+	0x07, 0x42, 0x58, 0x52, 0x40, 0x03, 0xAA, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x05, 0x83, 0x83, 0x80,
+	0x05, 0x73, 0xA3, 0x70, 0x05, 0x72, 0xC2, 0x70, 0x05, 0x63, 0xC3, 0x60, 0x08, 0x04, 0x22, 0xE2,
+	0x24, 0x09, 0x12, 0x32, 0xE2, 0x32, 0x10, 0x85, 0x01, 0x62, 0xE2, 0x60, 0x85, 0x01, 0x72, 0xC2,
+	0x70, 0x05, 0x82, 0xA2, 0x80, 0x09, 0x42, 0x23, 0x83, 0x22, 0x40, 0x09, 0x33, 0x32, 0x82, 0x33,
+	0x30, 0x09, 0x32, 0x52, 0x62, 0x52, 0x30, 0x85, 0x01, 0xA2, 0x62, 0xA0, 0x83, 0x01, 0xAA, 0xA0,
+	0x85, 0x01, 0xB2, 0x42, 0xB0, 0x03, 0xB8, 0xB0, 0x03, 0xC6, 0xC0, 0x83, 0x01, 0xF0, 0xF0, 0x83,
+	0x02, 0xF0, 0xF0, 0x05, 0xB8, 0x72, 0x20, 0x05, 0xAA, 0x52, 0x30, 0x07, 0x93, 0x63, 0x32, 0x40,
+	0x05, 0x83, 0xC2, 0x50, 0x05, 0x73, 0xC2, 0x60, 0x05, 0x72, 0xC2, 0x70, 0x05, 0x63, 0xB4, 0x60,
+	0x07, 0x62, 0xB2, 0x12, 0x60, 0x07, 0x62, 0xA2, 0x22, 0x60, 0x07, 0x62, 0x92, 0x32, 0x60, 0x07,
+	0x62, 0x82, 0x42, 0x60, 0x07, 0x72, 0x62, 0x42, 0x70, 0x07, 0x72, 0x52, 0x52, 0x70, 0x07, 0x82,
+	0x32, 0x52, 0x80, 0x05, 0xC2, 0x53, 0x80, 0x05, 0xB2, 0x62, 0x90, 0x05, 0xA2, 0x63, 0x90, 0x05,
+	0x93, 0x62, 0xA0, 0x05, 0x84, 0x62, 0xA0, 0x05, 0x72, 0x1A, 0xA0, 0x05, 0x62, 0x2A, 0xA0, 0x07,
+	0x52, 0x42, 0x42, 0xB0, 0x07, 0x42, 0x52, 0x42, 0xB0, 0x05, 0x32, 0x68, 0xB0, 0x05, 0x31, 0x86,
+	0xC0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x03, 0xD4, 0xD0, 0x03, 0xC6, 0xC0, 0x05,
+	0xB3, 0x23, 0xB0, 0x85, 0x01, 0xB2, 0x42, 0xB0, 0x85, 0x01, 0xB2, 0x44, 0x90, 0x05, 0xB2, 0x42,
+	0xB0, 0x05, 0xB2, 0x44, 0x90, 0x07, 0xB2, 0x12, 0x14, 0x90, 0x07, 0xB2, 0x12, 0x12, 0xB0, 0x87,
+	0x01, 0xB2, 0x12, 0x14, 0x90, 0x07, 0xB2, 0x12, 0x13, 0xA0, 0x87, 0x01, 0xB2, 0x12, 0x12, 0xB0,
+	0x07, 0xA3, 0x12, 0x13, 0xA0, 0x07, 0x93, 0x14, 0x13, 0x90, 0x87, 0x03, 0x92, 0x16, 0x12, 0x90,
+	0x07, 0x92, 0x24, 0x22, 0x90, 0x05, 0xA2, 0x62, 0xA0, 0x05, 0xA4, 0x24, 0xA0, 0x03, 0xC6, 0xC0,
+	0x83, 0x01, 0xF0, 0xF0, 0x83, 0x03, 0xF0, 0xF0, 0x05, 0xA2, 0x95, 0x40, 0x05, 0x94, 0x86, 0x30,
+	0x05, 0x85, 0xC2, 0x30, 0x07, 0x82, 0x22, 0xB2, 0x30, 0x07, 0x72, 0x33, 0xA2, 0x30, 0x07, 0x63,
+	0x42, 0x84, 0x30, 0x07, 0x62, 0x62, 0x74, 0x30, 0x07, 0x53, 0x62, 0x92, 0x30, 0x05, 0x5C, 0x82,
+	0x30, 0x05, 0x4E, 0x72, 0x30, 0x07, 0x42, 0xA2, 0x63, 0x30, 0x07, 0x42, 0xA2, 0x54, 0x30, 0x07,
+	0x32, 0xB3, 0x62, 0x30, 0x87, 0x01, 0x32, 0xC2, 0x62, 0x30, 0x07, 0x32, 0xC2, 0x53, 0x30, 0x07,
+	0x32, 0xC2, 0x44, 0x30, 0x07, 0x42, 0xA2, 0x63, 0x30, 0x07, 0x42, 0x93, 0x72, 0x30, 0x07, 0x53,
+	0x63, 0x82, 0x30, 0x07, 0x63, 0x34, 0x83, 0x30, 0x05, 0x78, 0x65, 0x40, 0x05, 0x94, 0x93, 0x50,
+	0x83, 0x02, 0xF0, 0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x03, 0xE2, 0xE0, 0x03, 0xD3, 0xE0, 0x03, 0xC4,
+	0xE0, 0x03, 0xB5, 0xE0, 0x05, 0xA3, 0x12, 0xE0, 0x07, 0x93, 0x22, 0x23, 0x90, 0x07, 0x92, 0x32,
+	0x23, 0x90, 0x07, 0x82, 0x42, 0x24, 0x80, 0x07, 0x73, 0x43, 0x15, 0x70, 0x07, 0x72, 0x65, 0x12,
+	0x70, 0x07, 0x62, 0x83, 0x32, 0x60, 0x05, 0x62, 0xE2, 0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x52,
+	0x72, 0x72, 0x50, 0x07, 0x52, 0x64, 0x62, 0x50, 0x07, 0x52, 0x56, 0x52, 0x50, 0x09, 0x52, 0x43,
+	0x23, 0x42, 0x50, 0x09, 0x52, 0x42, 0x42, 0x42, 0x50, 0x09, 0x52, 0x33, 0x43, 0x32, 0x50, 0x89,
+	0x01, 0x62, 0x22, 0x62, 0x22, 0x60, 0x09, 0x72, 0x12, 0x62, 0x12, 0x70, 0x05, 0x75, 0x65, 0x70,
+	0x05, 0x85, 0x36, 0x80, 0x03, 0xAA, 0xA0, 0x03, 0xC6, 0xC0, 0x83, 0x01, 0xF0, 0xF0, 0x03, 0xF0,
+	0xF0, 0x03, 0xC6, 0xC0, 0x03, 0xB8, 0xB0, 0x05, 0xA3, 0x43, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x85,
+	0x04, 0x92, 0x82, 0x90, 0x83, 0x01, 0x9C, 0x90, 0x05, 0x84, 0x64, 0x80, 0x05, 0x73, 0xA3, 0x70,
+	0x05, 0x63, 0xC3, 0x60, 0x07, 0x62, 0x62, 0x62, 0x60, 0x07, 0x62, 0x54, 0x52, 0x60, 0x87, 0x02,
+	0x52, 0x56, 0x52, 0x50, 0x07, 0x52, 0x64, 0x62, 0x50, 0x87, 0x01, 0x52, 0x72, 0x72, 0x50, 0x07,
+	0x62, 0x62, 0x62, 0x60, 0x07, 0x63, 0x52, 0x53, 0x60, 0x05, 0x72, 0xC2, 0x70, 0x05, 0x83, 0x83,
+	0x80, 0x05, 0x94, 0x44, 0x90, 0x03, 0xAA, 0xA0, 0x03, 0xD4, 0xD0, 0x03, 0xF0, 0xF0, 0x03, 0xC6,
+	0xC0, 0x03, 0xB8, 0xB0, 0x05, 0xA3, 0x43, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x85, 0x02, 0x92, 0x82,
+	0x90, 0x85, 0x01, 0x92, 0xF0, 0x40, 0x03, 0x9A, 0xB0, 0x03, 0x9C, 0x90, 0x05, 0x84, 0x64, 0x80,
+	0x05, 0x73, 0xA3, 0x70, 0x05, 0x63, 0xC3, 0x60, 0x07, 0x62, 0x62, 0x62, 0x60, 0x07, 0x62, 0x54,
+	0x52, 0x60, 0x87, 0x02, 0x52, 0x56, 0x52, 0x50, 0x07, 0x52, 0x64, 0x62, 0x50, 0x87, 0x01, 0x52,
+	0x72, 0x72, 0x50, 0x07, 0x62, 0x62, 0x62, 0x60, 0x07, 0x63, 0x52, 0x53, 0x60, 0x05, 0x72, 0xC2,
+	0x70, 0x05, 0x83, 0x83, 0x80, 0x05, 0x94, 0x44, 0x90, 0x03, 0xAA, 0xA0, 0x03, 0xD4, 0xD0, 0x83,
+	0x03, 0xF0, 0xF0, 0x05, 0x83, 0x83, 0x80, 0x05, 0x58, 0x48, 0x50, 0x09, 0x44, 0x33, 0x23, 0x34,
+	0x40, 0x07, 0x42, 0x66, 0x62, 0x40, 0x07, 0x32, 0x84, 0x82, 0x30, 0x07, 0x32, 0x92, 0x92, 0x30,
+	0x07, 0x22, 0xF0, 0x71, 0x30, 0x07, 0x22, 0xF0, 0x72, 0x20, 0x87, 0x01, 0x32, 0xF0, 0x52, 0x30,
+	0x07, 0x33, 0xF0, 0x33, 0x30, 0x07, 0x43, 0xF0, 0x13, 0x40, 0x07, 0x52, 0xF0, 0x12, 0x50, 0x05,
+	0x62, 0xE2, 0x60, 0x05, 0x63, 0xC3, 0x60, 0x05, 0x73, 0xA3, 0x70, 0x05, 0x83, 0x83, 0x80, 0x05,
+	0x93, 0x63, 0x90, 0x05, 0xB3, 0x24, 0xA0, 0x03, 0xC6, 0xC0, 0x03, 0xD4, 0xD0, 0x03, 0xE2, 0xE0,
+	0x83, 0x03, 0xF0, 0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x05, 0x95, 0x25, 0x90, 0x03, 0x9C, 0x90, 0x87,
+	0x01, 0x82, 0x42, 0x42, 0x80, 0x07, 0x73, 0x42, 0x43, 0x70, 0x07, 0x54, 0x52, 0x54, 0x50, 0x0B,
+	0x43, 0x42, 0x12, 0x12, 0x43, 0x40, 0x0B, 0x33, 0x52, 0x12, 0x12, 0x53, 0x30, 0x0B, 0x32, 0x44,
+	0x12, 0x14, 0x42, 0x30, 0x0B, 0x32, 0x42, 0x32, 0x32, 0x42, 0x30, 0x07, 0x31, 0xA2, 0xA2, 0x20,
+	0x0B, 0x32, 0x15, 0x32, 0x35, 0x12, 0x30, 0x07, 0x39, 0x22, 0x29, 0x30, 0x0B, 0x33, 0x42, 0x22,
+	0x22, 0x43, 0x30, 0x07, 0x42, 0x82, 0x82, 0x40, 0x07, 0x32, 0x92, 0x92, 0x30, 0x0B, 0x32, 0x33,
+	0x32, 0x33, 0x32, 0x30, 0x0B, 0x32, 0x34, 0x22, 0x24, 0x32, 0x30, 0x0B, 0x42, 0x42, 0x22, 0x22,
+	0x42, 0x40, 0x0B, 0x42, 0x43, 0x12, 0x13, 0x42, 0x40, 0x0B, 0x53, 0x31, 0x22, 0x21, 0x33, 0x50,
+	0x07, 0x64, 0x42, 0x45, 0x50, 0x07, 0x73, 0x42, 0x43, 0x70, 0x07, 0x82, 0x42, 0x42, 0x80, 0x03,
+	0x9C, 0x90, 0x03, 0xAA, 0xA0, 0x83, 0x01, 0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0, 0x03, 0xD4, 0xD0,
+	0x03, 0xAA, 0xA0, 0x05, 0x85, 0x45, 0x80, 0x05, 0x74, 0x93, 0x70, 0x07, 0x63, 0x28, 0x24, 0x50,
+	0x07, 0x44, 0x1C, 0x23, 0x40, 0x09, 0x15, 0x33, 0x63, 0x35, 0x10, 0x07, 0x14, 0xF0, 0x54, 0x10,
+	0x03, 0xF0, 0xF0, 0x05, 0x6F, 0x03, 0x60, 0x05, 0x6F, 0x02, 0x70, 0x07, 0x13, 0xF0, 0x73, 0x10,
+	0x09, 0x15, 0x32, 0x82, 0x35, 0x10, 0x07, 0x43, 0x2C, 0x23, 0x40, 0x07, 0x54, 0x29, 0x23, 0x50,
+	0x05, 0x73, 0xA4, 0x60, 0x05, 0x84, 0x64, 0x80, 0x03, 0xAB, 0x90, 0x03, 0xC6, 0xC0, 0x83, 0x04,
+	0xF0, 0xF0, 0x83, 0x05, 0xF0, 0xF0, 0x03, 0xAA, 0xA0, 0x05, 0x77, 0x27, 0x70, 0x05, 0x64, 0xA4,
+	0x60, 0x05, 0x53, 0xE3, 0x50, 0x07, 0x43, 0xF0, 0x13, 0x40, 0x07, 0x32, 0x76, 0x63, 0x30, 0x07,
+	0x23, 0x68, 0x63, 0x20, 0x09, 0x13, 0x62, 0x62, 0x63, 0x10, 0x09, 0x12, 0x63, 0x63, 0x62, 0x10,
+	0x08, 0x03, 0x62, 0x82, 0x63, 0x88, 0x01, 0x02, 0x72, 0x82, 0x72, 0x05, 0x92, 0x82, 0x90, 0x05,
+	0xA2, 0x62, 0xA0, 0x05, 0xA4, 0x24, 0xA0, 0x03, 0xB8, 0xB0, 0x03, 0xD4, 0xD0, 0x83, 0x06, 0xF0,
+	0xF0, 0x83, 0x01, 0xF0, 0xF0, 0x05, 0xF0, 0xB1, 0x30, 0x05, 0xF0, 0xA3, 0x20, 0x05, 0xF0, 0x93,
+	0x30, 0x05, 0xF0, 0x83, 0x40, 0x05, 0xA9, 0x33, 0x50, 0x07, 0x77, 0x23, 0x23, 0x60, 0x05, 0x64,
+	0xA4, 0x60, 0x05, 0x53, 0xB6, 0x50, 0x07, 0x34, 0xB3, 0x23, 0x40, 0x09, 0x33, 0x63, 0x23, 0x43,
+	0x30, 0x09, 0x23, 0x63, 0x24, 0x53, 0x20, 0x09, 0x13, 0x62, 0x35, 0x63, 0x10, 0x0B, 0x12, 0x63,
+	0x23, 0x13, 0x62, 0x10, 0x0A, 0x03, 0x62, 0x23, 0x32, 0x63, 0x0A, 0x02, 0x71, 0x23, 0x42, 0x72,
+	0x08, 0x02, 0x93, 0x52, 0x72, 0x05, 0xA3, 0x62, 0x90, 0x05, 0x93, 0x62, 0xA0, 0x05, 0x86, 0x24,
+	0xA0, 0x05, 0x73, 0x18, 0xB0, 0x05, 0x63, 0x44, 0xD0, 0x05, 0x53, 0xF0, 0x70, 0x05, 0x43, 0xF0,
+	0x80, 0x05, 0x33, 0xF0, 0x90, 0x05, 0x23, 0xF0, 0xA0, 0x05, 0x31, 0xF0, 0xB0, 0x83, 0x01, 0xF0,
+	0xF0, 0x83, 0x04, 0xF0, 0xF0, 0x03, 0xC6, 0xC0, 0x03, 0xAA, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x05,
+	0x83, 0x83, 0x80, 0x05, 0x73, 0xA3, 0x70, 0x05, 0x72, 0xC2, 0x70, 0x85, 0x01, 0x62, 0xE2, 0x60,
+	0x05, 0x44, 0xE4, 0x40, 0x05, 0x26, 0xE6, 0x20, 0x07, 0x13, 0xF0, 0x73, 0x10, 0x06, 0x03, 0xF0,
+	0x93, 0x86, 0x03, 0x02, 0xF0, 0xB2, 0x07, 0x12, 0xF0, 0x92, 0x10, 0x07, 0x14, 0xF0, 0x54, 0x10,
+	0x05, 0x2F, 0x0B, 0x20, 0x83, 0x05, 0xF0, 0xF0, 0x83, 0x02, 0xF0, 0xF0, 0x83, 0x02, 0xE2, 0xE0,
+	0x05, 0x62, 0xE2, 0x60, 0x05, 0x63, 0xC3, 0x60, 0x07, 0x72, 0x44, 0x42, 0x70, 0x03, 0xB8, 0xB0,
+	0x05, 0xA3, 0x43, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x05, 0x92, 0x82, 0x90, 0x05, 0x82, 0xA2, 0x80,
+	0x89, 0x01, 0x33, 0x22, 0xA2, 0x23, 0x30, 0x05, 0x82, 0xA2, 0x80, 0x05, 0x92, 0x82, 0x90, 0x05,
+	0x93, 0x63, 0x90, 0x05, 0xA3, 0x43, 0xA0, 0x03, 0xB8, 0xB0, 0x07, 0x72, 0x44, 0x42, 0x70, 0x05,
+	0x63, 0xC3, 0x60, 0x05, 0x62, 0xE2, 0x60, 0x83, 0x02, 0xE2, 0xE0, 0x83, 0x02, 0xF0, 0xF0, 0x83,
+	0x03, 0xF0, 0xF0, 0x03, 0xC6, 0xC0, 0x03, 0xAA, 0xA0, 0x05, 0x93, 0x63, 0x90, 0x05, 0x92, 0x82,
+	0x90, 0x85, 0x01, 0x82, 0xA2, 0x80, 0x05, 0x73, 0xA3, 0x70, 0x05, 0x45, 0xB6, 0x40, 0x05, 0x36,
+	0xC6, 0x30, 0x07, 0x23, 0xF0, 0x53, 0x20, 0x87, 0x03, 0x22, 0xF0, 0x72, 0x20, 0x07, 0x23, 0xF0,
+	0x53, 0x20, 0x05, 0x3F, 0x09, 0x30, 0x05, 0x4F, 0x07, 0x40, 0x07, 0x72, 0x52, 0x43, 0x70, 0x07,
+	0x72, 0x43, 0x43, 0x70, 0x07, 0x62, 0x52, 0x52, 0x80, 0x07, 0x53, 0x42, 0x52, 0x90, 0x07, 0x52,
+	0x52, 0x52, 0x90, 0x83, 0x03, 0xF0, 0xF0,
+};
+
+const uint16_t icon30_rle_offsets[] = {
+	0, 60, 128, 196, 264, 332, 428, 513, 582, 643, 689, 763,
+	784, 823, 881, 965, 1077, 1178, 1245, 1354, 1451, 1531, 1623, 1679,
+	1737, 1849, 1886, 1980, 2099, 2218, 2344, 2470, 2560, 2681, 2786, 2832,
+	2902, 3018, 3090, 3156, 3227, 3304, 3389, 3477, 3579, 3681, 3799, 3915,
+	3993, 4099, 4207, 4325, 4420, 4532, 4654, 4747, 4847, 4948, 5097, 5186,
+	5265, 5393, 5464, 5551,
+};
+
+/**
+ * @brief 59x59 pixels run-length compressed icons array.
+ */
+const uint8_t icon59_rle_data[] = {
+	0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0,
+	0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x89, 0x02, 0x54,
+	0xF0, 0xF0, 0x73, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x74, 0x90, 0x89, 0x10, 0x54, 0xF0, 0xF0, 0x78,
+	0x50, 0x09, 0x54, 0xF0, 0xF0, 0x74, 0x90, 0x89, 0x02, 0x54, 0xF0, 0xF0, 0x73, 0xA0, 0x89, 0x01,
+	0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0,
+	0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x87, 0x01, 0x6F, 0x0F, 0x0C,
+	0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73, 0xA0, 0x09, 0x54,
+	0x54, 0xF0, 0xD3, 0xA0, 0x09, 0x54, 0x46, 0xF0, 0xC3, 0xA0, 0x09, 0x54, 0x47, 0xF0, 0xB4, 0x90,
+	0x89, 0x10, 0x54, 0x47, 0xF0, 0xB8, 0x50, 0x09, 0x54, 0x47, 0xF0, 0xB4, 0x90, 0x09, 0x54, 0x46,
+	0xF0, 0xC3, 0xA0, 0x09, 0x54, 0x54, 0xF0, 0xD3, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73, 0xA0, 0x89,
+	0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x07, 0x7F, 0x0F, 0x0A,
+	0xC0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0A, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x87, 0x01, 0x6F, 0x0F,
+	0x0C, 0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73, 0xA0, 0x09,
+	0x54, 0x5C, 0xF0, 0x53, 0xA0, 0x09, 0x54, 0x4E, 0xF0, 0x43, 0xA0, 0x09, 0x54, 0x4E, 0xF0, 0x44,
+	0x90, 0x89, 0x10, 0x54, 0x4E, 0xF0, 0x48, 0x50, 0x09, 0x54, 0x4E, 0xF0, 0x44, 0x90, 0x09, 0x54,
+	0x4E, 0xF0, 0x43, 0xA0, 0x09, 0x54, 0x5C, 0xF0, 0x53, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73, 0xA0,
+	0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x07, 0x7F, 0x0F,
+	0x0A, 0xC0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0A, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x87, 0x01, 0x6F,
+	0x0F, 0x0C, 0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73, 0xA0,
+	0x09, 0x54, 0x5F, 0x03, 0xE3, 0xA0, 0x09, 0x54, 0x4F, 0x05, 0xD3, 0xA0, 0x09, 0x54, 0x4F, 0x05,
+	0xD4, 0x90, 0x89, 0x10, 0x54, 0x4F, 0x05, 0xD8, 0x50, 0x09, 0x54, 0x4F, 0x05, 0xD4, 0x90, 0x09,
+	0x54, 0x4F, 0x05, 0xD3, 0xA0, 0x09, 0x54, 0x5F, 0x03, 0xE3, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73,
+	0xA0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x07, 0x7F,
+	0x0F, 0x0A, 0xC0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0A,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x87, 0x01,
+	0x6F, 0x0F, 0x0C, 0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x73,
+	0xA0, 0x09, 0x54, 0x5F, 0x0B, 0x63, 0xA0, 0x09, 0x54, 0x4F, 0x0E, 0x43, 0xA0, 0x09, 0x54, 0x4F,
+	0x0E, 0x44, 0x90, 0x89, 0x10, 0x54, 0x4F, 0x0E, 0x48, 0x50, 0x09, 0x54, 0x4F, 0x0E, 0x44, 0x90,
+	0x09, 0x54, 0x4F, 0x0E, 0x43, 0xA0, 0x09, 0x54, 0x5F, 0x0B, 0x63, 0xA0, 0x09, 0x54, 0xF0, 0xF0,
+	0x73, 0xA0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x07,
+	0x7F, 0x0F, 0x0A, 0xC0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87,
+	0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x87,
+	0x01, 0x6F, 0x0F, 0x0C, 0xB0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x89, 0x02, 0x54, 0xF0,
+	0xF0, 0x73, 0xA0, 0x09, 0x54, 0xF0, 0xF0, 0x74, 0x90, 0x09, 0x54, 0xF0, 0xF0, 0x78, 0x50, 0x0B,
+	0x54, 0xF0, 0x11, 0xF0, 0x58, 0x50, 0x0B, 0x54, 0xF0, 0x13, 0xF0, 0x38, 0x50, 0x0B, 0x54, 0xF0,
+	0x14, 0xF0, 0x28, 0x50, 0x0B, 0x54, 0xF0, 0x15, 0xF0, 0x18, 0x50, 0x09, 0x54, 0xF0, 0x17, 0xE8,
+	0x50, 0x09, 0x54, 0x73, 0x69, 0xC8, 0x50, 0x09, 0x54, 0x76, 0x3A, 0xB8, 0x50, 0x09, 0x54, 0x9F,
+	0x04, 0x98, 0x50, 0x09, 0x54, 0xAB, 0x25, 0x98, 0x50, 0x09, 0x54, 0xC9, 0x62, 0x88, 0x50, 0x09,
+	0x54, 0xD8, 0xF0, 0x18, 0x50, 0x09, 0x54, 0xE7, 0xF0, 0x18, 0x50, 0x0B, 0x54, 0xF0, 0x15, 0xF0,
+	0x18, 0x50, 0x0B, 0x54, 0xF0, 0x33, 0xF0, 0x18, 0x50, 0x0B, 0x54, 0xF0, 0x41, 0xF0, 0x28, 0x50,
+	0x09, 0x54, 0xF0, 0xF0, 0x78, 0x50, 0x09, 0x54, 0xF0, 0xF0, 0x74, 0x90, 0x89, 0x02, 0x54, 0xF0,
+	0xF0, 0x73, 0xA0, 0x89, 0x01, 0x54, 0xF0, 0xF0, 0x64, 0xA0, 0x87, 0x01, 0x6F, 0x0F, 0x0C, 0xB0,
+	0x07, 0x7F, 0x0F, 0x0A, 0xC0, 0x07, 0x9F, 0x0F, 0x07, 0xD0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xF0, 0xE3, 0xC0, 0x07, 0xF0, 0xF0, 0xC7, 0xA0,
+	0x07, 0xF0, 0xF0, 0xB9, 0x90, 0x07, 0xF0, 0xF0, 0xAB, 0x80, 0x09, 0xF0, 0xF0, 0xA4, 0x34, 0x80,
+	0x89, 0x07, 0xF0, 0xF0, 0x94, 0x54, 0x70, 0x09, 0xF0, 0xC5, 0x74, 0x54, 0x70, 0x09, 0xF0, 0xA9,
+	0x54, 0x54, 0x70, 0x09, 0xF0, 0x9B, 0x44, 0x54, 0x70, 0x0B, 0xF0, 0x95, 0x15, 0x44, 0x54, 0x70,
+	0x0B, 0xF0, 0x94, 0x34, 0x44, 0x54, 0x70, 0x8B, 0x06, 0xF0, 0x84, 0x54, 0x34, 0x54, 0x70, 0x0B,
+	0xB5, 0x74, 0x54, 0x34, 0x54, 0x70, 0x0B, 0x98, 0x64, 0x54, 0x34, 0x54, 0x70, 0x0B, 0x99, 0x54,
+	0x54, 0x34, 0x54, 0x70, 0x0B, 0x8B, 0x44, 0x54, 0x34, 0x54, 0x70, 0x0D, 0x84, 0x34, 0x44, 0x54,
+	0x34, 0x54, 0x70, 0x8D, 0x0B, 0x74, 0x54, 0x34, 0x54, 0x34, 0x54, 0x70, 0x0D, 0x75, 0x34, 0x54,
+	0x34, 0x54, 0x35, 0x70, 0x07, 0x8B, 0x5B, 0x5B, 0x80, 0x07, 0x99, 0x79, 0x79, 0x90, 0x07, 0xA8,
+	0x87, 0x88, 0xA0, 0x07, 0xB5, 0xB5, 0xB5, 0xB0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xF0, 0xD5, 0xB0, 0x07, 0xF0, 0xF0, 0xB9, 0x90, 0x07, 0xF0,
+	0xF0, 0xAA, 0x90, 0x07, 0xF0, 0xF0, 0xAB, 0x80, 0x09, 0xF0, 0xF0, 0xA3, 0x54, 0x70, 0x89, 0x06,
+	0xF0, 0xF0, 0x94, 0x54, 0x70, 0x09, 0xF0, 0xC5, 0x74, 0x54, 0x70, 0x09, 0xF0, 0xB7, 0x64, 0x54,
+	0x70, 0x09, 0xF0, 0xA9, 0x54, 0x54, 0x70, 0x09, 0xF0, 0x9B, 0x44, 0x54, 0x70, 0x0B, 0xF0, 0x94,
+	0x34, 0x44, 0x54, 0x70, 0x8B, 0x06, 0xF0, 0x84, 0x54, 0x34, 0x54, 0x70, 0x0B, 0xC3, 0x84, 0x54,
+	0x34, 0x54, 0x70, 0x0B, 0xA7, 0x64, 0x54, 0x34, 0x54, 0x70, 0x0B, 0x99, 0x54, 0x54, 0x34, 0x54,
+	0x70, 0x8B, 0x01, 0x8B, 0x44, 0x54, 0x34, 0x54, 0x70, 0x8B, 0x0B, 0x7D, 0x34, 0x54, 0x34, 0x54,
+	0x70, 0x0B, 0x7D, 0x44, 0x34, 0x45, 0x44, 0x70, 0x0B, 0x8B, 0x55, 0x15, 0x55, 0x15, 0x80, 0x07,
+	0x8B, 0x5B, 0x5B, 0x80, 0x07, 0x99, 0x79, 0x79, 0x90, 0x07, 0xA7, 0x97, 0x97, 0xA0, 0x07, 0xD1,
+	0xF1, 0xF1, 0xD0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07,
+	0xF0, 0xF0, 0xD5, 0xB0, 0x07, 0xF0, 0xF0, 0xB9, 0x90, 0x07, 0xF0, 0xF0, 0xAA, 0x90, 0x07, 0xF0,
+	0xF0, 0xAB, 0x80, 0x09, 0xF0, 0xF0, 0xA3, 0x54, 0x70, 0x89, 0x06, 0xF0, 0xF0, 0x94, 0x54, 0x70,
+	0x09, 0xF0, 0xC5, 0x74, 0x54, 0x70, 0x09, 0xF0, 0xB7, 0x64, 0x54, 0x70, 0x09, 0xF0, 0xA9, 0x54,
+	0x54, 0x70, 0x89, 0x01, 0xF0, 0x9B, 0x44, 0x54, 0x70, 0x89, 0x06, 0xF0, 0x8D, 0x34, 0x54, 0x70,
+	0x09, 0xC3, 0x8D, 0x34, 0x54, 0x70, 0x09, 0xA7, 0x6D, 0x34, 0x54, 0x70, 0x09, 0x99, 0x5D, 0x34,
+	0x54, 0x70, 0x89, 0x01, 0x8B, 0x4D, 0x34, 0x54, 0x70, 0x89, 0x0B, 0x7D, 0x3D, 0x34, 0x54, 0x70,
+	0x09, 0x7D, 0x4B, 0x45, 0x44, 0x70, 0x09, 0x8B, 0x5B, 0x55, 0x15, 0x80, 0x07, 0x8B, 0x5B, 0x5B,
+	0x80, 0x07, 0x99, 0x79, 0x79, 0x90, 0x07, 0xA7, 0x97, 0x97, 0xA0, 0x07, 0xD1, 0xF1, 0xF1, 0xD0,
+	0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xF0, 0xD5,
+	0xB0, 0x07, 0xF0, 0xF0, 0xB9, 0x90, 0x07, 0xF0, 0xF0, 0xAA, 0x90, 0x07, 0xF0, 0xF0, 0xAB, 0x80,
+	0x07, 0xF0, 0xF0, 0xAC, 0x70, 0x87, 0x06, 0xF0, 0xF0, 0x9D, 0x70, 0x07, 0xF0, 0xC5, 0x7D, 0x70,
+	0x07, 0xF0, 0xB7, 0x6D, 0x70, 0x07, 0xF0, 0xA9, 0x5D, 0x70, 0x87, 0x01, 0xF0, 0x9B, 0x4D, 0x70,
+	0x87, 0x06, 0xF0, 0x8D, 0x3D, 0x70, 0x07, 0xC3, 0x8D, 0x3D, 0x70, 0x07, 0xA7, 0x6D, 0x3D, 0x70,
+	0x07, 0x99, 0x5D, 0x3D, 0x70, 0x87, 0x01, 0x8B, 0x4D, 0x3D, 0x70, 0x87, 0x0B, 0x7D, 0x3D, 0x3D,
+	0x70, 0x07, 0x7D, 0x4B, 0x4D, 0x70, 0x87, 0x01, 0x8B, 0x5B, 0x5B, 0x80, 0x07, 0x99, 0x79, 0x79,
+	0x90, 0x07, 0xA7, 0x97, 0x97, 0xA0, 0x07, 0xD1, 0xF1, 0xF1, 0xD0, 0x87, 0x04, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x07, 0xF0, 0xB7, 0xF0,
+	0xB0, 0x87, 0x01, 0xF0, 0xA9, 0xF0, 0xA0, 0x09, 0xF0, 0x95, 0x15, 0xF0, 0x90, 0x09, 0xF0, 0x94,
+	0x34, 0xF0, 0x90, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x84, 0x54, 0xF0, 0x80, 0x09,
+	0xF0, 0x75, 0x55, 0xF0, 0x70, 0x09, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x09, 0xF0, 0x65, 0x75, 0xF0,
+	0x60, 0x09, 0xF0, 0x64, 0x94, 0xF0, 0x60, 0x09, 0xF0, 0x55, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x54,
+	0xB4, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x09,
+	0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x8B, 0x01, 0xF0, 0x24, 0xF0,
+	0x24, 0xF0, 0x20, 0x8B, 0x01, 0xF0, 0x14, 0xF0, 0x44, 0xF0, 0x10, 0x87, 0x01, 0xF4, 0xF0, 0x64,
+	0xF0, 0x87, 0x01, 0xE4, 0xF0, 0x84, 0xE0, 0x87, 0x01, 0xD4, 0xF0, 0xA4, 0xD0, 0x87, 0x01, 0xC4,
+	0xF0, 0xC4, 0xC0, 0x87, 0x01, 0xB4, 0xF0, 0xE4, 0xB0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x07,
+	0xA4, 0xD5, 0xD4, 0xA0, 0x07, 0x94, 0xBB, 0xB4, 0x90, 0x09, 0x94, 0x7F, 0x04, 0x74, 0x90, 0x09,
+	0x94, 0x5F, 0x08, 0x54, 0x90, 0x09, 0x9F, 0x03, 0x5F, 0x03, 0x90, 0x05, 0x9F, 0xBF, 0x90, 0x07,
+	0x9B, 0xF0, 0x4A, 0xA0, 0x07, 0xA7, 0xF0, 0xA6, 0xB0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x87,
+	0x28, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x87,
+	0x05, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x87,
+	0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x1D, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0,
+	0x07, 0xF0, 0x7E, 0xF0, 0x80, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x4F, 0x05, 0xF0,
+	0x50, 0x09, 0xF0, 0x37, 0x87, 0xF0, 0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34,
+	0xF4, 0xF0, 0x30, 0x0B, 0xF0, 0x42, 0xF0, 0x22, 0xF0, 0x40, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x87, 0x05, 0xF0, 0xA9, 0xF0, 0xA0,
+	0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x87, 0x12, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0x9A, 0xF0, 0xA0, 0x09, 0xF0, 0x6F, 0x02, 0xF0,
+	0x60, 0x09, 0xF0, 0x3F, 0x07, 0xF0, 0x40, 0x09, 0xF0, 0x1F, 0x0B, 0xF0, 0x20, 0x05, 0xF8, 0xC9,
+	0xF0, 0x07, 0xD8, 0xF0, 0x27, 0xE0, 0x07, 0xC6, 0xF0, 0x77, 0xC0, 0x07, 0xB6, 0xF0, 0xA6, 0xB0,
+	0x07, 0xA5, 0xF0, 0xD6, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x09, 0xB2, 0xF0, 0xF0, 0x32,
+	0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x7E, 0xF0, 0x80, 0x09, 0xF0, 0x6F, 0x02, 0xF0,
+	0x60, 0x09, 0xF0, 0x4F, 0x05, 0xF0, 0x50, 0x09, 0xF0, 0x37, 0x87, 0xF0, 0x40, 0x09, 0xF0, 0x35,
+	0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x0B, 0xF0, 0x42, 0xF0, 0x22, 0xF0, 0x40,
+	0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0,
+	0x87, 0x05, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0,
+	0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xA8, 0xF0,
+	0xB0, 0x09, 0xF0, 0x4F, 0x06, 0xF0, 0x40, 0x09, 0xF0, 0x1F, 0x0B, 0xF0, 0x20, 0x07, 0xDF, 0x0F,
+	0x02, 0xE0, 0x05, 0xCB, 0xCC, 0xC0, 0x07, 0xA9, 0xF0, 0x69, 0xA0, 0x07, 0x88, 0xF0, 0xB8, 0x90,
+	0x09, 0x76, 0xF0, 0xF0, 0x27, 0x70, 0x09, 0x66, 0xF0, 0xF0, 0x56, 0x60, 0x09, 0x46, 0xF0, 0xF0,
+	0x86, 0x50, 0x09, 0x36, 0xF0, 0xF0, 0xA6, 0x40, 0x0B, 0x25, 0xF0, 0x2A, 0xF0, 0x25, 0x30, 0x09,
+	0x24, 0xFF, 0x02, 0xE4, 0x30, 0x09, 0x32, 0xDF, 0x07, 0xD3, 0x30, 0x09, 0xF0, 0x1F, 0x0B, 0xF0,
+	0x20, 0x05, 0xF8, 0xC9, 0xF0, 0x07, 0xD8, 0xF0, 0x27, 0xE0, 0x07, 0xC6, 0xF0, 0x77, 0xC0, 0x07,
+	0xB6, 0xF0, 0xA6, 0xB0, 0x07, 0xA5, 0xF0, 0xD6, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x09,
+	0xB2, 0xF0, 0xF0, 0x32, 0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x7E, 0xF0, 0x80, 0x09,
+	0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x4F, 0x05, 0xF0, 0x50, 0x09, 0xF0, 0x37, 0x87, 0xF0,
+	0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x0B, 0xF0, 0x42,
+	0xF0, 0x22, 0xF0, 0x40, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07,
+	0xF0, 0xB7, 0xF0, 0xB0, 0x87, 0x05, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07,
+	0xF0, 0xC5, 0xF0, 0xC0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x09, 0xF0, 0xF0, 0xF0, 0x62, 0x60, 0x09, 0xF0, 0xF0, 0xF0, 0x63, 0x50, 0x09, 0xF0, 0xF0, 0xF0,
+	0x45, 0x50, 0x09, 0xF0, 0xF0, 0xF0, 0x44, 0x60, 0x07, 0xF0, 0xA8, 0xE5, 0x70, 0x09, 0xF0, 0x4F,
+	0x06, 0x74, 0x80, 0x09, 0xF0, 0x1F, 0x09, 0x55, 0x90, 0x07, 0xDF, 0x0B, 0x64, 0xA0, 0x07, 0xCC,
+	0xB3, 0x55, 0xB0, 0x07, 0xA9, 0xF0, 0x96, 0xA0, 0x07, 0x88, 0xF0, 0xA9, 0x90, 0x07, 0x77, 0xF0,
+	0xCB, 0x70, 0x09, 0x66, 0xF0, 0xC5, 0x36, 0x60, 0x09, 0x46, 0xF0, 0xE4, 0x56, 0x50, 0x09, 0x36,
+	0xF0, 0xD5, 0x76, 0x40, 0x0B, 0x25, 0xF0, 0x27, 0x64, 0xA5, 0x30, 0x09, 0x24, 0xF9, 0x55, 0xC4,
+	0x30, 0x09, 0x32, 0xDB, 0x65, 0xD3, 0x30, 0x09, 0xF0, 0x1C, 0x59, 0xF0, 0x20, 0x05, 0xF8, 0x9C,
+	0xF0, 0x05, 0xD8, 0xAE, 0xE0, 0x07, 0xC7, 0xB5, 0x57, 0xC0, 0x07, 0xB6, 0xC5, 0x86, 0xB0, 0x07,
+	0xA5, 0xD5, 0xA6, 0xA0, 0x07, 0xA4, 0xD5, 0xD4, 0xA0, 0x07, 0xB2, 0xD5, 0xF2, 0xB0, 0x07, 0xF0,
+	0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x9C, 0xF0, 0x80, 0x07, 0xF0, 0x8F, 0xF0, 0x60, 0x09, 0xF0, 0x7F,
+	0x02, 0xF0, 0x50, 0x09, 0xF0, 0x74, 0x77, 0xF0, 0x40, 0x09, 0xF0, 0x55, 0xB5, 0xF0, 0x30, 0x09,
+	0xF0, 0x54, 0xD4, 0xF0, 0x30, 0x09, 0xF0, 0x35, 0xF2, 0xF0, 0x40, 0x09, 0xF0, 0x34, 0xF0, 0xF0,
+	0x70, 0x09, 0xF0, 0x15, 0xF0, 0xF0, 0x80, 0x09, 0xF0, 0x14, 0xF0, 0xF0, 0x90, 0x07, 0xE5, 0x93,
+	0xF0, 0xD0, 0x07, 0xE4, 0x87, 0xF0, 0xB0, 0x07, 0xC5, 0x89, 0xF0, 0xA0, 0x07, 0xC4, 0x99, 0xF0,
+	0xA0, 0x07, 0xA5, 0xA9, 0xF0, 0xA0, 0x07, 0xA4, 0xB9, 0xF0, 0xA0, 0x07, 0x85, 0xC9, 0xF0, 0xA0,
+	0x07, 0x84, 0xD9, 0xF0, 0xA0, 0x07, 0x65, 0xF7, 0xF0, 0xB0, 0x09, 0x64, 0xF0, 0x25, 0xF0, 0xC0,
+	0x09, 0x54, 0xF0, 0xF0, 0xF0, 0x50, 0x09, 0x53, 0xF0, 0xF0, 0xF0, 0x60, 0x09, 0x61, 0xF0, 0xF0,
+	0xF0, 0x70, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0,
+	0xA3, 0xF0, 0xF0, 0x10, 0x07, 0xF0, 0xA4, 0xF0, 0xF0, 0x07, 0xF0, 0xA5, 0xF0, 0xE0, 0x07, 0xF0,
+	0xA7, 0xF0, 0xC0, 0x07, 0xF0, 0xA8, 0xF0, 0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xAA,
+	0xF0, 0x90, 0x09, 0xF0, 0xA4, 0x16, 0xF0, 0x80, 0x09, 0xF0, 0xA4, 0x26, 0xF0, 0x70, 0x09, 0xF0,
+	0xA4, 0x36, 0xF0, 0x60, 0x09, 0xF0, 0xA4, 0x46, 0xF0, 0x50, 0x09, 0xF0, 0xA4, 0x65, 0xF0, 0x40,
+	0x09, 0xF0, 0xA4, 0x75, 0xF0, 0x30, 0x09, 0xF0, 0xA4, 0x85, 0xF0, 0x20, 0x09, 0xF0, 0xA4, 0x75,
+	0xF0, 0x30, 0x0B, 0xF0, 0x14, 0x54, 0x66, 0xF0, 0x30, 0x0B, 0xF0, 0x15, 0x44, 0x47, 0xF0, 0x40,
+	0x0B, 0xF0, 0x17, 0x24, 0x37, 0xF0, 0x50, 0x0B, 0xF0, 0x36, 0x14, 0x26, 0xF0, 0x70, 0x09, 0xF0,
+	0x4A, 0x16, 0xF0, 0x80, 0x07, 0xF0, 0x5F, 0xF0, 0x90, 0x07, 0xF0, 0x6D, 0xF0, 0xA0, 0x07, 0xF0,
+	0x7A, 0xF0, 0xC0, 0x87, 0x01, 0xF0, 0x97, 0xF0, 0xD0, 0x07, 0xF0, 0x89, 0xF0, 0xC0, 0x07, 0xF0,
+	0x7B, 0xF0, 0xB0, 0x07, 0xF0, 0x5F, 0xF0, 0x90, 0x09, 0xF0, 0x5F, 0x01, 0xF0, 0x80, 0x09, 0xF0,
+	0x3B, 0x26, 0xF0, 0x70, 0x0B, 0xF0, 0x26, 0x24, 0x36, 0xF0, 0x60, 0x0B, 0xF0, 0x16, 0x34, 0x46,
+	0xF0, 0x50, 0x0B, 0xF0, 0x14, 0x54, 0x65, 0xF0, 0x40, 0x0B, 0xF0, 0x22, 0x64, 0x75, 0xF0, 0x30,
+	0x09, 0xF0, 0xA4, 0x85, 0xF0, 0x20, 0x09, 0xF0, 0xA4, 0x76, 0xF0, 0x20, 0x09, 0xF0, 0xA4, 0x66,
+	0xF0, 0x30, 0x09, 0xF0, 0xA4, 0x56, 0xF0, 0x40, 0x09, 0xF0, 0xA4, 0x46, 0xF0, 0x50, 0x09, 0xF0,
+	0xA4, 0x35, 0xF0, 0x70, 0x09, 0xF0, 0xA4, 0x25, 0xF0, 0x80, 0x09, 0xF0, 0xA4, 0x15, 0xF0, 0x90,
+	0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xA8, 0xF0, 0xB0, 0x07, 0xF0, 0xA7, 0xF0, 0xC0, 0x07,
+	0xF0, 0xA6, 0xF0, 0xD0, 0x07, 0xF0, 0xA4, 0xF0, 0xF0, 0x09, 0xF0, 0xA3, 0xF0, 0xF0, 0x10, 0x09,
+	0xF0, 0xB1, 0xF0, 0xF0, 0x20, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0C, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x07, 0x5E, 0x4F, 0x0F, 0x60, 0x0B, 0x4F, 0x01, 0x3F, 0x0F, 0x02, 0x40, 0x0B, 0x4F, 0x01,
+	0x3F, 0x0F, 0x03, 0x30, 0x0B, 0x4F, 0x01, 0x4F, 0x0F, 0x02, 0x30, 0x0D, 0x43, 0x33, 0x34, 0xF0,
+	0xF0, 0x24, 0x30, 0x8D, 0x03, 0x43, 0x33, 0x34, 0xF0, 0xF0, 0x33, 0x30, 0x8B, 0x02, 0x43, 0x94,
+	0xF0, 0xF0, 0x33, 0x30, 0x8B, 0x02, 0x4F, 0x01, 0xF0, 0xF0, 0x33, 0x30, 0x09, 0x4F, 0xF0, 0xF0,
+	0x43, 0x30, 0x89, 0x0D, 0xA3, 0xF0, 0xF0, 0xA3, 0x30, 0x09, 0xA3, 0xF0, 0xF0, 0x94, 0x30, 0x89,
+	0x01, 0xA3, 0x4F, 0x0F, 0x09, 0x30, 0x09, 0xA3, 0x4F, 0x0F, 0x07, 0x50, 0x09, 0xA3, 0x4F, 0x0F,
+	0x05, 0x70, 0x89, 0x04, 0xA3, 0xA4, 0xA3, 0xF0, 0x40, 0x09, 0xA3, 0xA4, 0xA4, 0xF0, 0x30, 0x87,
+	0x01, 0xA3, 0x4F, 0x0E, 0xD0, 0x07, 0xA3, 0x5F, 0x0D, 0xD0, 0x07, 0xF0, 0x4F, 0x0B, 0xE0, 0x07,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0B, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0x4F, 0x4F, 0x0F, 0x60, 0x0B,
+	0x4F, 0x01, 0x3F, 0x0F, 0x02, 0x40, 0x0B, 0x4F, 0x01, 0x3F, 0x0F, 0x03, 0x30, 0x0B, 0x4F, 0x01,
+	0x4F, 0x0F, 0x02, 0x30, 0x8D, 0x03, 0x43, 0x33, 0x34, 0xF0, 0xF0, 0x33, 0x30, 0x0D, 0x43, 0x41,
+	0x44, 0xF0, 0xF0, 0x33, 0x30, 0x8B, 0x02, 0x43, 0x94, 0xF0, 0xF0, 0x33, 0x30, 0x0B, 0x44, 0x75,
+	0xF0, 0xF0, 0x33, 0x30, 0x8B, 0x01, 0x4F, 0x01, 0xF0, 0xF0, 0x33, 0x30, 0x09, 0x5E, 0xF0, 0xF0,
+	0x43, 0x30, 0x89, 0x04, 0xA3, 0xF0, 0xF0, 0xA3, 0x30, 0x09, 0xA3, 0xF0, 0xB8, 0x63, 0x30, 0x09,
+	0xA3, 0xF0, 0x8E, 0x42, 0x30, 0x0B, 0xA3, 0xF0, 0x7F, 0x01, 0x41, 0x30, 0x0B, 0xA3, 0xF0, 0x6F,
+	0x03, 0x31, 0x30, 0x09, 0xA3, 0xF0, 0x5F, 0x05, 0x60, 0x09, 0xA3, 0xF0, 0x4F, 0x07, 0x50, 0x0B,
+	0xA3, 0xF0, 0x35, 0x2A, 0x25, 0x40, 0x0B, 0xA3, 0xF0, 0x35, 0x38, 0x35, 0x40, 0x0B, 0xA3, 0xF0,
+	0x27, 0x36, 0x46, 0x30, 0x0B, 0xA3, 0x59, 0x38, 0x34, 0x47, 0x30, 0x0B, 0xA3, 0x4A, 0x39, 0x32,
+	0x48, 0x30, 0x09, 0xA3, 0x4A, 0x3A, 0x79, 0x30, 0x09, 0xA3, 0x4A, 0x3B, 0x5A, 0x30, 0x09, 0xA3,
+	0xA4, 0x3B, 0x4B, 0x30, 0x09, 0xA3, 0xA4, 0x3A, 0x6A, 0x30, 0x09, 0xA3, 0xA4, 0x39, 0x89, 0x30,
+	0x0B, 0xA3, 0xA4, 0x38, 0x43, 0x38, 0x30, 0x0B, 0xA3, 0xA4, 0x37, 0x45, 0x37, 0x30, 0x0B, 0xA3,
+	0xA4, 0x36, 0x47, 0x36, 0x30, 0x0B, 0xA3, 0x5A, 0x35, 0x39, 0x25, 0x40, 0x0B, 0xA3, 0x4C, 0x25,
+	0x2F, 0x01, 0x50, 0x09, 0xA3, 0x4C, 0x3F, 0x07, 0x50, 0x09, 0xA3, 0x4D, 0x3F, 0x05, 0x60, 0x09,
+	0xF0, 0xF0, 0x4F, 0x03, 0x70, 0x09, 0xF0, 0xF0, 0x5F, 0x01, 0x80, 0x07, 0xF0, 0xF0, 0x7C, 0xA0,
+	0x07, 0xF0, 0xF0, 0x98, 0xC0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xE1, 0xF0, 0xE0,
+	0x87, 0x01, 0xF0, 0xC5, 0xF0, 0xC0, 0x87, 0x01, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xA9, 0xF0,
+	0xA0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x87, 0x01, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0x9B, 0xF0,
+	0x90, 0x07, 0xF0, 0xD3, 0x89, 0xB0, 0x87, 0x02, 0xF0, 0xD3, 0x7B, 0xA0, 0x09, 0xE5, 0x93, 0x74,
+	0x43, 0xA0, 0x09, 0xD8, 0x73, 0x74, 0x43, 0xA0, 0x09, 0xCA, 0x63, 0x74, 0x43, 0xA0, 0x09, 0xB5,
+	0x15, 0x63, 0x7B, 0xA0, 0x89, 0x01, 0xB4, 0x34, 0x63, 0x7B, 0xA0, 0x09, 0xB5, 0x24, 0x63, 0x8A,
+	0xA0, 0x07, 0xBB, 0x63, 0xB4, 0xD0, 0x07, 0xC9, 0x73, 0xB4, 0xD0, 0x07, 0xD8, 0x73, 0xB4, 0xD0,
+	0x07, 0xE5, 0x93, 0xA4, 0xE0, 0x07, 0xF4, 0x93, 0x95, 0xE0, 0x87, 0x01, 0xF4, 0x9F, 0x01, 0xF0,
+	0x07, 0xF4, 0x9F, 0xF0, 0x10, 0x07, 0xF6, 0x7C, 0xF0, 0x40, 0x09, 0xF0, 0x1F, 0x01, 0xF0, 0xC0,
+	0x07, 0xF0, 0x2F, 0xF0, 0xC0, 0x07, 0xF0, 0x3D, 0xF0, 0xD0, 0x07, 0xF0, 0xA6, 0xF0, 0xD0, 0x87,
+	0x01, 0xF0, 0xC4, 0xF0, 0xD0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07,
+	0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x09, 0xF0, 0x84, 0x54, 0xF0, 0x80, 0x09,
+	0xF0, 0x83, 0x73, 0xF0, 0x80, 0x89, 0x02, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x09, 0xF0, 0x84, 0x54,
+	0xF0, 0x80, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0x9B,
+	0xF0, 0x90, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0F, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x09, 0xF0, 0xF0, 0x43, 0xF0, 0x70, 0x09, 0xF0, 0xF0, 0x35, 0xF0, 0x60, 0x09, 0xF0,
+	0xF0, 0x36, 0xF0, 0x50, 0x09, 0xF0, 0xF0, 0x37, 0xF0, 0x40, 0x09, 0xF0, 0xF0, 0x38, 0xF0, 0x30,
+	0x09, 0xF0, 0xF0, 0x39, 0xF0, 0x20, 0x09, 0xF0, 0xF0, 0x3A, 0xF0, 0x10, 0x09, 0xF0, 0xF0, 0x34,
+	0x16, 0xF0, 0x09, 0xF0, 0xF0, 0x34, 0x26, 0xE0, 0x07, 0x9F, 0x0D, 0x36, 0xD0, 0x07, 0x8F, 0x0E,
+	0x46, 0xC0, 0x07, 0x7F, 0x0F, 0x56, 0xB0, 0x07, 0x7F, 0x0E, 0x76, 0xA0, 0x09, 0x74, 0xF0, 0xF0,
+	0x36, 0x90, 0x09, 0x74, 0xF0, 0xF0, 0x46, 0x80, 0x09, 0x74, 0xF0, 0xF0, 0x56, 0x70, 0x09, 0x74,
+	0xF0, 0xF0, 0x65, 0x70, 0x09, 0x74, 0xF0, 0xF0, 0x55, 0x80, 0x09, 0x74, 0xF0, 0xF0, 0x45, 0x90,
+	0x09, 0x74, 0xF0, 0xF0, 0x35, 0xA0, 0x07, 0x7F, 0x0D, 0x85, 0xB0, 0x07, 0x7F, 0x0F, 0x56, 0xB0,
+	0x07, 0x7F, 0x0F, 0x46, 0xC0, 0x07, 0x8F, 0x0E, 0x36, 0xD0, 0x09, 0xF0, 0xF0, 0x34, 0x26, 0xE0,
+	0x09, 0xF0, 0xF0, 0x34, 0x16, 0xF0, 0x0B, 0xF0, 0xF0, 0x34, 0x15, 0xF0, 0x10, 0x09, 0xF0, 0xF0,
+	0x39, 0xF0, 0x20, 0x09, 0xF0, 0xF0, 0x38, 0xF0, 0x30, 0x09, 0xF0, 0xF0, 0x37, 0xF0, 0x40, 0x09,
+	0xF0, 0xF0, 0x36, 0xF0, 0x50, 0x09, 0xF0, 0xF0, 0x35, 0xF0, 0x60, 0x09, 0xF0, 0xF0, 0x34, 0xF0,
+	0x70, 0x09, 0xF0, 0xF0, 0x42, 0xF0, 0x80, 0x87, 0x08, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0E, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0x84, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x75, 0xF0, 0xF0, 0x20, 0x09,
+	0xF0, 0x66, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x57, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x48, 0xF0, 0xF0,
+	0x20, 0x09, 0xF0, 0x39, 0xF0, 0xF0, 0x20, 0x0B, 0xF0, 0x25, 0x14, 0xF0, 0xF0, 0x20, 0x0B, 0xF0,
+	0x15, 0x24, 0xF0, 0xF0, 0x20, 0x09, 0xF5, 0x34, 0xF0, 0xF0, 0x20, 0x09, 0xD6, 0x44, 0xF0, 0xF0,
+	0x20, 0x07, 0xC6, 0x5F, 0x0F, 0x60, 0x09, 0xB5, 0x7F, 0x0F, 0x01, 0x50, 0x09, 0xA5, 0x8F, 0x0F,
+	0x01, 0x50, 0x07, 0x95, 0xAF, 0x0F, 0x50, 0x09, 0x85, 0xF0, 0xF0, 0x74, 0x50, 0x09, 0x66, 0xF0,
+	0xF0, 0x84, 0x50, 0x09, 0x56, 0xF0, 0xF0, 0x94, 0x50, 0x89, 0x01, 0x55, 0xF0, 0xF0, 0xA4, 0x50,
+	0x09, 0x66, 0xF0, 0xF0, 0x84, 0x50, 0x09, 0x76, 0xF0, 0xF0, 0x74, 0x50, 0x07, 0x86, 0xBF, 0x0E,
+	0x50, 0x07, 0x96, 0x9F, 0x0F, 0x50, 0x09, 0xA6, 0x7F, 0x0F, 0x01, 0x50, 0x09, 0xB6, 0x6F, 0x0F,
+	0x01, 0x50, 0x09, 0xC6, 0x55, 0xF0, 0xF0, 0x10, 0x09, 0xD6, 0x44, 0xF0, 0xF0, 0x20, 0x09, 0xF5,
+	0x34, 0xF0, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0x24, 0xF0, 0xF0, 0x20, 0x0B, 0xF0, 0x25, 0x14, 0xF0,
+	0xF0, 0x20, 0x09, 0xF0, 0x39, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x48, 0xF0, 0xF0, 0x20, 0x09, 0xF0,
+	0x57, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x75, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0x84, 0xF0, 0xF0, 0x20,
+	0x09, 0xF0, 0x93, 0xF0, 0xF0, 0x20, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x87, 0x02, 0xF0, 0x7F, 0xF0, 0x70, 0x89, 0x16, 0xF0,
+	0x74, 0x74, 0xF0, 0x70, 0x05, 0xCE, 0x7E, 0xC0, 0x85, 0x01, 0xBF, 0x7F, 0xB0, 0x05, 0xCD, 0x9D,
+	0xC0, 0x07, 0xD4, 0xF0, 0xA4, 0xD0, 0x07, 0xE4, 0xF0, 0x84, 0xE0, 0x07, 0xE5, 0xF0, 0x65, 0xE0,
+	0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x0B, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x10, 0x09, 0xF0, 0x25, 0xF5,
+	0xF0, 0x20, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0,
+	0x55, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x65, 0x75, 0xF0, 0x60, 0x09, 0xF0, 0x66, 0x56, 0xF0, 0x60,
+	0x09, 0xF0, 0x76, 0x36, 0xF0, 0x70, 0x09, 0xF0, 0x86, 0x16, 0xF0, 0x80, 0x07, 0xF0, 0x9B, 0xF0,
+	0x90, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0,
+	0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x87, 0x01, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x87, 0x01, 0xF0, 0xB7, 0xF0,
+	0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x09, 0xF0, 0x95, 0x15, 0xF0, 0x90, 0x09, 0xF0, 0x85, 0x35,
+	0xF0, 0x80, 0x09, 0xF0, 0x75, 0x55, 0xF0, 0x70, 0x09, 0xF0, 0x65, 0x75, 0xF0, 0x60, 0x09, 0xF0,
+	0x55, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x54, 0xB4, 0xF0, 0x50, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40,
+	0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0xF0,
+	0x25, 0xF0, 0x10, 0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xD5, 0xF0,
+	0x85, 0xD0, 0x05, 0xCC, 0xBC, 0xC0, 0x05, 0xBE, 0x9E, 0xB0, 0x85, 0x01, 0xBF, 0x7F, 0xB0, 0x05,
+	0xCE, 0x7E, 0xC0, 0x89, 0x16, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x87, 0x02, 0xF0, 0x7F, 0xF0, 0x70,
+	0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xC5, 0xF0, 0xF0, 0xC0, 0x07, 0xA9, 0xF0, 0xF0, 0xA0, 0x07, 0x9C, 0xF0, 0xF0, 0x80, 0x09,
+	0x94, 0x27, 0xF0, 0xF0, 0x70, 0x09, 0x94, 0x38, 0xF0, 0xF0, 0x50, 0x09, 0x94, 0x58, 0xF0, 0xF0,
+	0x30, 0x09, 0x94, 0x78, 0xF0, 0xF0, 0x10, 0x07, 0x94, 0x98, 0xF0, 0xE0, 0x07, 0x94, 0xB8, 0xF0,
+	0xC0, 0x07, 0x94, 0xD7, 0xF0, 0xB0, 0x07, 0x94, 0xF7, 0xF0, 0x90, 0x09, 0x94, 0xF0, 0x18, 0xF0,
+	0x70, 0x09, 0x94, 0xF0, 0x38, 0xF0, 0x50, 0x09, 0x94, 0xF0, 0x57, 0xF0, 0x40, 0x09, 0x94, 0xF0,
+	0x77, 0xF0, 0x20, 0x07, 0x94, 0xF0, 0x88, 0xF0, 0x07, 0x94, 0xF0, 0xA8, 0xD0, 0x07, 0x94, 0xF0,
+	0xC8, 0xB0, 0x07, 0x94, 0xF0, 0xE8, 0x90, 0x09, 0x94, 0xF0, 0xF0, 0x17, 0x80, 0x09, 0x94, 0xF0,
+	0xF0, 0x37, 0x60, 0x09, 0x94, 0xF0, 0xF0, 0x46, 0x60, 0x09, 0x94, 0xF0, 0xF0, 0x65, 0x50, 0x89,
+	0x02, 0x94, 0xF0, 0xF0, 0x74, 0x50, 0x09, 0x94, 0xF0, 0xF0, 0x46, 0x60, 0x09, 0x94, 0xF0, 0xF0,
+	0x37, 0x60, 0x09, 0x94, 0xF0, 0xF0, 0x18, 0x70, 0x07, 0x94, 0xF0, 0xE8, 0x90, 0x07, 0x94, 0xF0,
+	0xD7, 0xB0, 0x07, 0x94, 0xF0, 0xB7, 0xD0, 0x07, 0x94, 0xF0, 0x98, 0xE0, 0x09, 0x94, 0xF0, 0x78,
+	0xF0, 0x10, 0x09, 0x94, 0xF0, 0x58, 0xF0, 0x30, 0x09, 0x94, 0xF0, 0x47, 0xF0, 0x50, 0x09, 0x94,
+	0xF0, 0x19, 0xF0, 0x60, 0x07, 0x94, 0xF8, 0xF0, 0x80, 0x07, 0x94, 0xD8, 0xF0, 0xA0, 0x07, 0x94,
+	0xB8, 0xF0, 0xC0, 0x07, 0x94, 0xA7, 0xF0, 0xE0, 0x09, 0x94, 0x87, 0xF0, 0xF0, 0x10, 0x09, 0x94,
+	0x68, 0xF0, 0xF0, 0x20, 0x09, 0x94, 0x48, 0xF0, 0xF0, 0x40, 0x09, 0x94, 0x28, 0xF0, 0xF0, 0x60,
+	0x07, 0x9C, 0xF0, 0xF0, 0x80, 0x07, 0xAA, 0xF0, 0xF0, 0x90, 0x07, 0xB7, 0xF0, 0xF0, 0xB0, 0x87,
+	0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x08, 0xF0, 0xF0, 0xF0, 0xE0, 0x05, 0xAC, 0xFC, 0xA0, 0x05,
+	0x9E, 0xDE, 0x90, 0x89, 0x01, 0x8F, 0x01, 0xBF, 0x01, 0x80, 0x09, 0x74, 0x95, 0x95, 0x94, 0x70,
+	0x89, 0x24, 0x74, 0xA4, 0x94, 0xA4, 0x70, 0x09, 0x75, 0x84, 0xB4, 0x85, 0x70, 0x09, 0x8F, 0x01,
+	0xBF, 0x01, 0x80, 0x05, 0x9E, 0xDE, 0x90, 0x05, 0xAC, 0xFC, 0xA0, 0x07, 0xC8, 0xF0, 0x48, 0xC0,
+	0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x08, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xC5, 0xF0,
+	0xC0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x9B, 0xF0, 0x90,
+	0x89, 0x01, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x75, 0x55, 0xF0, 0x70, 0x09, 0xF0, 0x65,
+	0x75, 0xF0, 0x60, 0x09, 0xF0, 0x55, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09,
+	0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x09, 0xF0, 0x25, 0xF5, 0xF0,
+	0x20, 0x0B, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x10, 0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x07, 0xE5, 0xF0,
+	0x65, 0xE0, 0x07, 0xD6, 0xF0, 0x66, 0xD0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xC5, 0xF0, 0xA5,
+	0xC0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09, 0x95, 0xF0, 0xF0, 0x15,
+	0x90, 0x09, 0x94, 0xF0, 0xF0, 0x34, 0x90, 0x89, 0x01, 0x84, 0xF0, 0xF0, 0x54, 0x80, 0x87, 0x01,
+	0x8F, 0x0F, 0x0D, 0x80, 0x87, 0x01, 0x9F, 0x0F, 0x0B, 0x90, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xBF, 0x0F, 0x07, 0xB0, 0x07, 0xAF, 0x0F, 0x09, 0xA0, 0x87, 0x01, 0x8F, 0x0F, 0x0D, 0x80,
+	0x09, 0x75, 0xF0, 0xF0, 0x55, 0x70, 0x89, 0x02, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x75, 0xF0,
+	0xF0, 0x55, 0x70, 0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x07, 0x9F, 0x0F, 0x0B, 0x90, 0x07, 0xAF, 0x0F,
+	0x09, 0xA0, 0x07, 0xCF, 0x0F, 0x05, 0xC0, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0A, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x09, 0x82, 0xF0, 0x72, 0xF0, 0xA0, 0x09, 0x66, 0xF0, 0x35, 0xF0, 0x90, 0x09,
+	0x58, 0xF0, 0x17, 0xF0, 0x80, 0x07, 0x59, 0xEA, 0xF0, 0x60, 0x0B, 0x54, 0x16, 0xC4, 0x16, 0xF0,
+	0x50, 0x0B, 0x54, 0x26, 0xB4, 0x35, 0xF0, 0x40, 0x0B, 0x54, 0x36, 0xA4, 0x46, 0xF0, 0x20, 0x0B,
+	0x54, 0x56, 0x84, 0x56, 0xF0, 0x10, 0x09, 0x54, 0x56, 0x84, 0x66, 0xF0, 0x09, 0x54, 0x76, 0x64,
+	0x76, 0xE0, 0x09, 0x54, 0x86, 0x54, 0x86, 0xD0, 0x09, 0x54, 0x96, 0x44, 0x96, 0xC0, 0x09, 0x54,
+	0xA6, 0x34, 0xB5, 0xB0, 0x09, 0x54, 0xC5, 0x24, 0xC6, 0x90, 0x07, 0x54, 0xDA, 0xD6, 0x80, 0x07,
+	0x54, 0xE9, 0xE6, 0x70, 0x09, 0x54, 0xF8, 0xF0, 0x15, 0x60, 0x0B, 0x54, 0xF0, 0x17, 0xF0, 0x26,
+	0x40, 0x0B, 0x54, 0xF0, 0x26, 0xF0, 0x36, 0x30, 0x0B, 0x54, 0xF0, 0x35, 0xF0, 0x45, 0x30, 0x8B,
+	0x02, 0x54, 0xF0, 0x44, 0xF0, 0x54, 0x30, 0x0B, 0x54, 0xF0, 0x35, 0xF0, 0x36, 0x30, 0x0B, 0x54,
+	0xF0, 0x26, 0xF0, 0x26, 0x40, 0x0B, 0x54, 0xF0, 0x17, 0xF0, 0x16, 0x50, 0x07, 0x54, 0xE9, 0xF5,
+	0x70, 0x07, 0x54, 0xDA, 0xD6, 0x80, 0x09, 0x54, 0xC5, 0x24, 0xC6, 0x90, 0x09, 0x54, 0xB6, 0x24,
+	0xB6, 0xA0, 0x09, 0x54, 0x96, 0x44, 0xA6, 0xB0, 0x09, 0x54, 0x87, 0x44, 0x96, 0xC0, 0x09, 0x54,
+	0x76, 0x64, 0x86, 0xD0, 0x09, 0x54, 0x66, 0x74, 0x75, 0xF0, 0x0B, 0x54, 0x56, 0x84, 0x56, 0xF0,
+	0x10, 0x0B, 0x54, 0x45, 0xA4, 0x46, 0xF0, 0x20, 0x0B, 0x54, 0x35, 0xB4, 0x35, 0xF0, 0x40, 0x0B,
+	0x54, 0x16, 0xC4, 0x16, 0xF0, 0x50, 0x07, 0x5A, 0xDA, 0xF0, 0x60, 0x07, 0x59, 0xF8, 0xF0, 0x70,
+	0x09, 0x66, 0xF0, 0x27, 0xF0, 0x80, 0x09, 0x83, 0xF0, 0x53, 0xF0, 0xA0, 0x87, 0x05, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0xA2, 0xF0, 0x72, 0x80, 0x09, 0xF0,
+	0x95, 0xF0, 0x36, 0x60, 0x09, 0xF0, 0x87, 0xF0, 0x18, 0x50, 0x07, 0xF0, 0x6A, 0xE9, 0x50, 0x0B,
+	0xF0, 0x56, 0x14, 0xC6, 0x14, 0x50, 0x0B, 0xF0, 0x45, 0x34, 0xB6, 0x24, 0x50, 0x0B, 0xF0, 0x26,
+	0x44, 0xA6, 0x34, 0x50, 0x0B, 0xF0, 0x16, 0x54, 0x86, 0x54, 0x50, 0x09, 0xF6, 0x64, 0x86, 0x54,
+	0x50, 0x09, 0xE6, 0x74, 0x66, 0x74, 0x50, 0x09, 0xD6, 0x84, 0x56, 0x84, 0x50, 0x09, 0xC6, 0x94,
+	0x46, 0x94, 0x50, 0x09, 0xB5, 0xB4, 0x36, 0xA4, 0x50, 0x09, 0x96, 0xC4, 0x25, 0xC4, 0x50, 0x07,
+	0x86, 0xDA, 0xD4, 0x50, 0x07, 0x76, 0xE9, 0xE4, 0x50, 0x09, 0x65, 0xF0, 0x18, 0xF4, 0x50, 0x0B,
+	0x46, 0xF0, 0x27, 0xF0, 0x14, 0x50, 0x0B, 0x36, 0xF0, 0x36, 0xF0, 0x24, 0x50, 0x0B, 0x35, 0xF0,
+	0x45, 0xF0, 0x34, 0x50, 0x8B, 0x02, 0x34, 0xF0, 0x54, 0xF0, 0x44, 0x50, 0x0B, 0x36, 0xF0, 0x35,
+	0xF0, 0x34, 0x50, 0x0B, 0x46, 0xF0, 0x26, 0xF0, 0x24, 0x50, 0x09, 0x56, 0xF0, 0x18, 0xF4, 0x50,
+	0x07, 0x76, 0xE9, 0xE4, 0x50, 0x07, 0x86, 0xDA, 0xD4, 0x50, 0x09, 0x96, 0xC4, 0x25, 0xC4, 0x50,
+	0x09, 0xA6, 0xB4, 0x26, 0xB4, 0x50, 0x09, 0xB6, 0xA4, 0x46, 0x94, 0x50, 0x09, 0xC6, 0x94, 0x56,
+	0x84, 0x50, 0x09, 0xE5, 0x84, 0x66, 0x74, 0x50, 0x09, 0xF6, 0x64, 0x76, 0x64, 0x50, 0x0B, 0xF0,
+	0x16, 0x54, 0x86, 0x54, 0x50, 0x0B, 0xF0, 0x26, 0x44, 0xA5, 0x44, 0x50, 0x0B, 0xF0, 0x45, 0x34,
+	0xB6, 0x24, 0x50, 0x0B, 0xF0, 0x56, 0x14, 0xC6, 0x14, 0x50, 0x07, 0xF0, 0x6A, 0xDA, 0x50, 0x07,
+	0xF0, 0x78, 0xF9, 0x50, 0x09, 0xF0, 0x87, 0xF0, 0x26, 0x60, 0x09, 0xF0, 0xA3, 0xF0, 0x53, 0x80,
+	0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x09, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xA3, 0xF0, 0xE7,
+	0xA0, 0x07, 0x96, 0xF0, 0xB9, 0x90, 0x07, 0x89, 0xF0, 0x8B, 0x80, 0x07, 0x7B, 0xF0, 0x6D, 0x70,
+	0x0B, 0x74, 0x27, 0xF0, 0x44, 0x54, 0x70, 0x0B, 0x74, 0x38, 0xF0, 0x24, 0x54, 0x70, 0x0B, 0x74,
+	0x57, 0xF0, 0x14, 0x54, 0x70, 0x09, 0x74, 0x77, 0xE4, 0x54, 0x70, 0x09, 0x74, 0x87, 0xD4, 0x54,
+	0x70, 0x09, 0x74, 0xA7, 0xB4, 0x54, 0x70, 0x09, 0x74, 0xC7, 0x94, 0x54, 0x70, 0x09, 0x74, 0xD7,
+	0x84, 0x54, 0x70, 0x09, 0x74, 0xF7, 0x64, 0x54, 0x70, 0x0B, 0x74, 0xF0, 0x26, 0x54, 0x54, 0x70,
+	0x0B, 0x74, 0xF0, 0x37, 0x34, 0x54, 0x70, 0x0B, 0x74, 0xF0, 0x48, 0x14, 0x54, 0x70, 0x09, 0x74,
+	0xF0, 0x6B, 0x54, 0x70, 0x09, 0x74, 0xF0, 0x89, 0x54, 0x70, 0x09, 0x74, 0xF0, 0xA7, 0x54, 0x70,
+	0x09, 0x74, 0xF0, 0xB6, 0x54, 0x70, 0x89, 0x03, 0x74, 0xF0, 0xD4, 0x54, 0x70, 0x09, 0x74, 0xF0,
+	0xC5, 0x54, 0x70, 0x09, 0x74, 0xF0, 0xA7, 0x54, 0x70, 0x09, 0x74, 0xF0, 0x89, 0x54, 0x70, 0x09,
+	0x74, 0xF0, 0x7A, 0x54, 0x70, 0x0B, 0x74, 0xF0, 0x57, 0x14, 0x54, 0x70, 0x0B, 0x74, 0xF0, 0x47,
+	0x24, 0x54, 0x70, 0x0B, 0x74, 0xF0, 0x27, 0x44, 0x54, 0x70, 0x09, 0x74, 0xF8, 0x54, 0x54, 0x70,
+	0x09, 0x74, 0xE7, 0x74, 0x54, 0x70, 0x09, 0x74, 0xC7, 0x94, 0x54, 0x70, 0x09, 0x74, 0xB7, 0xA4,
+	0x54, 0x70, 0x09, 0x74, 0x97, 0xC4, 0x54, 0x70, 0x09, 0x74, 0x77, 0xE4, 0x54, 0x70, 0x09, 0x74,
+	0x58, 0xF4, 0x54, 0x70, 0x0B, 0x74, 0x47, 0xF0, 0x24, 0x54, 0x70, 0x0B, 0x74, 0x36, 0xF0, 0x44,
+	0x54, 0x70, 0x07, 0x7C, 0xF0, 0x5D, 0x70, 0x07, 0x89, 0xF0, 0x8C, 0x70, 0x07, 0x88, 0xF0, 0x9B,
+	0x80, 0x07, 0x95, 0xF0, 0xC9, 0x90, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x09, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x07, 0xA7, 0xF0, 0xE3, 0xA0, 0x07, 0x99, 0xF0, 0xB6, 0x90, 0x07, 0x8B, 0xF0, 0x89,
+	0x80, 0x07, 0x7D, 0xF0, 0x6B, 0x70, 0x0B, 0x74, 0x54, 0xF0, 0x47, 0x24, 0x70, 0x0B, 0x74, 0x54,
+	0xF0, 0x28, 0x34, 0x70, 0x0B, 0x74, 0x54, 0xF0, 0x17, 0x54, 0x70, 0x09, 0x74, 0x54, 0xE7, 0x74,
+	0x70, 0x09, 0x74, 0x54, 0xD7, 0x84, 0x70, 0x09, 0x74, 0x54, 0xB7, 0xA4, 0x70, 0x09, 0x74, 0x54,
+	0x98, 0xB4, 0x70, 0x09, 0x74, 0x54, 0x87, 0xD4, 0x70, 0x09, 0x74, 0x54, 0x67, 0xF4, 0x70, 0x0B,
+	0x74, 0x54, 0x56, 0xF0, 0x24, 0x70, 0x0B, 0x74, 0x54, 0x37, 0xF0, 0x34, 0x70, 0x0B, 0x74, 0x54,
+	0x18, 0xF0, 0x44, 0x70, 0x09, 0x74, 0x5B, 0xF0, 0x64, 0x70, 0x09, 0x74, 0x59, 0xF0, 0x84, 0x70,
+	0x09, 0x74, 0x58, 0xF0, 0x94, 0x70, 0x09, 0x74, 0x56, 0xF0, 0xB4, 0x70, 0x89, 0x03, 0x74, 0x54,
+	0xF0, 0xD4, 0x70, 0x09, 0x74, 0x55, 0xF0, 0xC4, 0x70, 0x09, 0x74, 0x57, 0xF0, 0xA4, 0x70, 0x09,
+	0x74, 0x59, 0xF0, 0x84, 0x70, 0x09, 0x74, 0x5A, 0xF0, 0x74, 0x70, 0x0B, 0x74, 0x54, 0x17, 0xF0,
+	0x54, 0x70, 0x0B, 0x74, 0x54, 0x36, 0xF0, 0x44, 0x70, 0x0B, 0x74, 0x54, 0x47, 0xF0, 0x24, 0x70,
+	0x09, 0x74, 0x54, 0x58, 0xF4, 0x70, 0x09, 0x74, 0x54, 0x77, 0xE4, 0x70, 0x09, 0x74, 0x54, 0x97,
+	0xC4, 0x70, 0x09, 0x74, 0x54, 0xB7, 0xA4, 0x70, 0x09, 0x74, 0x54, 0xC7, 0x94, 0x70, 0x09, 0x74,
+	0x54, 0xE7, 0x74, 0x70, 0x09, 0x74, 0x54, 0xF8, 0x54, 0x70, 0x0B, 0x74, 0x54, 0xF0, 0x27, 0x44,
+	0x70, 0x0B, 0x74, 0x54, 0xF0, 0x47, 0x24, 0x70, 0x07, 0x7D, 0xF0, 0x5C, 0x70, 0x07, 0x7C, 0xF0,
+	0x89, 0x80, 0x07, 0x8B, 0xF0, 0x98, 0x80, 0x07, 0x99, 0xF0, 0xC5, 0x90, 0x87, 0x04, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x05, 0xF0,
+	0xD3, 0xF0, 0xD0, 0x0B, 0xF0, 0x52, 0x63, 0x53, 0xF0, 0x50, 0x0B, 0xF0, 0x35, 0x53, 0x55, 0xF0,
+	0x30, 0x0B, 0xF0, 0x26, 0x53, 0x56, 0xF0, 0x20, 0x07, 0xF8, 0x53, 0x58, 0xF0, 0x07, 0xE7, 0x73,
+	0x77, 0xE0, 0x07, 0xD6, 0x93, 0x96, 0xD0, 0x07, 0xC6, 0xA3, 0xA6, 0xC0, 0x07, 0xC5, 0xB3, 0xB5,
+	0xC0, 0x07, 0xB5, 0xC3, 0xC5, 0xB0, 0x07, 0xB4, 0xD3, 0xD4, 0xB0, 0x07, 0xA4, 0xE3, 0xE4, 0xA0,
+	0x87, 0x02, 0x94, 0xF3, 0xF4, 0x90, 0x8B, 0x02, 0x84, 0xF0, 0x13, 0xF0, 0x14, 0x80, 0x89, 0x06,
+	0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x83, 0xF0, 0xF0, 0x73, 0x80, 0x89, 0x01, 0x84, 0xF0, 0xF0,
+	0x54, 0x80, 0x89, 0x02, 0x94, 0xF0, 0xF0, 0x34, 0x90, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x07,
+	0xA5, 0xF0, 0xE5, 0xA0, 0x87, 0x01, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC6, 0xF0, 0x86, 0xC0, 0x07,
+	0xD6, 0xF0, 0x66, 0xD0, 0x07, 0xE6, 0xF0, 0x46, 0xE0, 0x05, 0xF7, 0xF7, 0xF0, 0x09, 0xF0, 0x1A,
+	0x7A, 0xF0, 0x10, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x07,
+	0xF0, 0x7F, 0xF0, 0x70, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x87, 0x01, 0xF0, 0xF0, 0xF0, 0xE0, 0x87,
+	0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x87, 0x02, 0xF0, 0x8D, 0xF0, 0x80,
+	0x89, 0x02, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x09, 0xC2, 0x75, 0x74, 0xF0, 0x70, 0x09, 0xB5, 0x45,
+	0x94, 0x55, 0xB0, 0x05, 0xAE, 0xAF, 0xA0, 0x05, 0x9F, 0xBF, 0x90, 0x05, 0x9E, 0xDE, 0x90, 0x0B,
+	0x85, 0x43, 0xF0, 0x35, 0x35, 0x80, 0x09, 0x84, 0xF0, 0xF0, 0x54, 0x80, 0x09, 0x74, 0xF0, 0xF0,
+	0x74, 0x70, 0x07, 0x74, 0xF7, 0xF4, 0x70, 0x07, 0x65, 0xDB, 0xD4, 0x70, 0x07, 0x64, 0xDD, 0xD4,
+	0x60, 0x09, 0x66, 0xA6, 0x36, 0xB5, 0x60, 0x09, 0x76, 0x85, 0x75, 0x87, 0x60, 0x09, 0x95, 0x74,
+	0x94, 0x85, 0x80, 0x09, 0xA4, 0x64, 0xB4, 0x65, 0x90, 0x09, 0xA5, 0x54, 0xB4, 0x55, 0xA0, 0x89,
+	0x02, 0xB4, 0x53, 0xD3, 0x54, 0xB0, 0x09, 0xA5, 0x54, 0xB4, 0x55, 0xA0, 0x09, 0x95, 0x64, 0xB4,
+	0x64, 0xA0, 0x09, 0x85, 0x84, 0x94, 0x75, 0x90, 0x09, 0x67, 0x85, 0x75, 0x86, 0x70, 0x09, 0x65,
+	0xB6, 0x36, 0xA6, 0x60, 0x07, 0x64, 0xDD, 0xD4, 0x60, 0x07, 0x74, 0xDB, 0xD5, 0x60, 0x07, 0x74,
+	0xF7, 0xF4, 0x70, 0x09, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x84, 0xF0, 0xF0, 0x54, 0x80, 0x0B,
+	0x85, 0x35, 0xF0, 0x33, 0x45, 0x80, 0x05, 0x9E, 0xDE, 0x90, 0x05, 0x9F, 0xBF, 0x90, 0x05, 0xAF,
+	0x9F, 0xA0, 0x09, 0xB5, 0x54, 0x95, 0x45, 0xB0, 0x09, 0xF0, 0x74, 0x75, 0x72, 0xC0, 0x89, 0x02,
+	0xF0, 0x74, 0x74, 0xF0, 0x70, 0x87, 0x02, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0xA9, 0xF0, 0xA0,
+	0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xC5, 0xF0,
+	0xC0, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x4F, 0x05,
+	0xF0, 0x50, 0x09, 0xF0, 0x38, 0x77, 0xF0, 0x40, 0x09, 0xF0, 0x26, 0xD5, 0xF0, 0x30, 0x09, 0xF0,
+	0x25, 0xF3, 0xF0, 0x40, 0x09, 0xF0, 0x15, 0xF0, 0xF0, 0x80, 0x07, 0xF5, 0xF0, 0xF0, 0x90, 0x07,
+	0xF4, 0xF0, 0xF0, 0xA0, 0x07, 0xF4, 0xF0, 0x83, 0xE0, 0x07, 0xE4, 0xF0, 0x85, 0xD0, 0x07, 0xE4,
+	0xF0, 0x77, 0xC0, 0x07, 0xE3, 0xF0, 0x79, 0xB0, 0x07, 0xE3, 0xF0, 0x6B, 0xA0, 0x07, 0xD4, 0xF0,
+	0x5D, 0x90, 0x07, 0xD4, 0xF0, 0x4F, 0x80, 0x0B, 0xD4, 0xF0, 0x36, 0x14, 0x15, 0x70, 0x0B, 0xD4,
+	0xF0, 0x25, 0x34, 0x16, 0x60, 0x0B, 0xD4, 0xF0, 0x25, 0x34, 0x25, 0x60, 0x0B, 0xD4, 0xF0, 0x32,
+	0x54, 0x33, 0x70, 0x87, 0x04, 0xD4, 0xF0, 0xA4, 0xD0, 0x0B, 0x73, 0x34, 0x52, 0xF0, 0x34, 0xD0,
+	0x0B, 0x65, 0x24, 0x35, 0xF0, 0x24, 0xD0, 0x0B, 0x66, 0x14, 0x35, 0xF0, 0x24, 0xD0, 0x09, 0x7A,
+	0x16, 0xF0, 0x34, 0xD0, 0x07, 0x8F, 0xF0, 0x44, 0xD0, 0x07, 0x9D, 0xF0, 0x54, 0xD0, 0x07, 0xAB,
+	0xF0, 0x63, 0xE0, 0x07, 0xB9, 0xF0, 0x73, 0xE0, 0x07, 0xC7, 0xF0, 0x74, 0xE0, 0x07, 0xD5, 0xF0,
+	0x84, 0xE0, 0x07, 0xE3, 0xF0, 0x84, 0xF0, 0x07, 0xF0, 0xF0, 0xA4, 0xF0, 0x09, 0xF0, 0xF0, 0x94,
+	0xF0, 0x10, 0x09, 0xF0, 0xF0, 0x85, 0xF0, 0x10, 0x09, 0xF0, 0x43, 0xF5, 0xF0, 0x20, 0x09, 0xF0,
+	0x35, 0xD6, 0xF0, 0x20, 0x09, 0xF0, 0x47, 0x78, 0xF0, 0x30, 0x09, 0xF0, 0x5F, 0x05, 0xF0, 0x40,
+	0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0xC5, 0xF0, 0xC0,
+	0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x08, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xE1, 0xF0,
+	0xE0, 0x87, 0x16, 0xF0, 0xD3, 0xF0, 0xD0, 0x0B, 0xF0, 0x63, 0x43, 0x43, 0xF0, 0x60, 0x0B, 0xF0,
+	0x64, 0x33, 0x34, 0xF0, 0x60, 0x0B, 0xF0, 0x65, 0x23, 0x25, 0xF0, 0x60, 0x0B, 0xF0, 0x75, 0x13,
+	0x15, 0xF0, 0x70, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0xA9,
+	0xF0, 0xA0, 0x0B, 0x82, 0xF0, 0x17, 0xF0, 0x12, 0x80, 0x0B, 0x74, 0xF0, 0x15, 0xF0, 0x14, 0x70,
+	0x0B, 0x74, 0xF0, 0x23, 0xF0, 0x24, 0x70, 0x0B, 0x74, 0xF0, 0x31, 0xF0, 0x34, 0x70, 0x89, 0x03,
+	0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x84, 0xF0, 0xF0, 0x54, 0x80, 0x09, 0x85, 0xF0, 0xF0, 0x35,
+	0x80, 0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x07, 0x9F, 0x0F, 0x0B, 0x90, 0x07, 0xAF, 0x0F, 0x09, 0xA0,
+	0x07, 0xDF, 0x0F, 0x03, 0xD0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x08, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x07, 0xDF, 0x0C, 0xF0, 0x40, 0x09, 0xAF, 0x0F, 0x01, 0xF0, 0x30, 0x09, 0x9F, 0x0F, 0x03,
+	0xF0, 0x20, 0x09, 0x8F, 0x0F, 0x05, 0xF0, 0x10, 0x09, 0x85, 0x34, 0xF0, 0x18, 0xF0, 0x09, 0x84,
+	0x44, 0xF0, 0x19, 0xE0, 0x0B, 0x74, 0x54, 0xF0, 0x13, 0x25, 0xD0, 0x0B, 0x74, 0x54, 0xF0, 0x13,
+	0x35, 0xC0, 0x0B, 0x74, 0x54, 0xF0, 0x13, 0x45, 0xB0, 0x0B, 0x74, 0x54, 0xF0, 0x13, 0x56, 0x90,
+	0x0B, 0x74, 0x54, 0xF0, 0x13, 0x66, 0x80, 0x09, 0x74, 0x54, 0xF4, 0x76, 0x70, 0x09, 0x74, 0x5F,
+	0x08, 0x94, 0x70, 0x09, 0x74, 0x6F, 0x06, 0xA4, 0x70, 0x09, 0x74, 0x7F, 0x04, 0xB4, 0x70, 0x89,
+	0x07, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x74, 0x5F, 0x0C, 0x54, 0x70, 0x89, 0x01, 0x74, 0x4F,
+	0x0E, 0x44, 0x70, 0x8B, 0x0C, 0x74, 0x44, 0xF0, 0x64, 0x44, 0x70, 0x0B, 0x84, 0x34, 0xF0, 0x64,
+	0x34, 0x80, 0x0B, 0x85, 0x15, 0xF0, 0x65, 0x15, 0x80, 0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x07, 0x9F,
+	0x0F, 0x0B, 0x90, 0x07, 0xAF, 0x0F, 0x09, 0xA0, 0x07, 0xDF, 0x0F, 0x03, 0xD0, 0x87, 0x04, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0xF0, 0x55, 0xF0, 0x40, 0x07,
+	0xF0, 0xF0, 0x1D, 0xF0, 0x05, 0xF0, 0xFF, 0xE0, 0x07, 0xF0, 0xDF, 0x02, 0xE0, 0x07, 0xF0, 0xC7,
+	0x55, 0xF0, 0x09, 0xF0, 0xB6, 0x65, 0xF0, 0x10, 0x09, 0xF0, 0xB4, 0x75, 0xF0, 0x20, 0x09, 0xF0,
+	0xA4, 0x75, 0xF0, 0x30, 0x09, 0xF0, 0x95, 0x65, 0x92, 0x80, 0x09, 0xF0, 0x94, 0x65, 0x94, 0x70,
+	0x09, 0xF0, 0x94, 0x55, 0x95, 0x70, 0x09, 0xF0, 0x84, 0x64, 0x96, 0x70, 0x09, 0xF0, 0x84, 0x54,
+	0x97, 0x70, 0x09, 0xF0, 0x84, 0x54, 0x89, 0x60, 0x0B, 0xF0, 0x84, 0x54, 0x75, 0x14, 0x60, 0x0B,
+	0xF0, 0x84, 0x54, 0x65, 0x24, 0x60, 0x0B, 0xF0, 0x84, 0x54, 0x55, 0x34, 0x60, 0x09, 0xF0, 0x84,
+	0x6C, 0x44, 0x60, 0x09, 0xF0, 0x84, 0x6B, 0x44, 0x70, 0x09, 0xF0, 0x84, 0x78, 0x64, 0x70, 0x09,
+	0xF0, 0x75, 0x95, 0x74, 0x70, 0x09, 0xF0, 0x65, 0xF0, 0x65, 0x70, 0x09, 0xF0, 0x55, 0xF0, 0x74,
+	0x80, 0x09, 0xF0, 0x45, 0xF0, 0x74, 0x90, 0x09, 0xF0, 0x35, 0xF0, 0x65, 0xA0, 0x09, 0xF0, 0x25,
+	0xF0, 0x57, 0xA0, 0x09, 0xF0, 0x15, 0xBF, 0x01, 0xB0, 0x05, 0xF5, 0xBF, 0xD0, 0x05, 0xE5, 0xBF,
+	0xE0, 0x07, 0xC6, 0xBD, 0xF0, 0x20, 0x07, 0xC5, 0xB5, 0xF0, 0xB0, 0x07, 0xA6, 0xB5, 0xF0, 0xC0,
+	0x07, 0xA5, 0xB5, 0xF0, 0xD0, 0x07, 0x86, 0xB5, 0xF0, 0xE0, 0x07, 0x85, 0xB5, 0xF0, 0xF0, 0x09,
+	0x75, 0xB5, 0xF0, 0xF0, 0x10, 0x09, 0x74, 0xB5, 0xF0, 0xF0, 0x20, 0x09, 0x64, 0xB5, 0xF0, 0xF0,
+	0x30, 0x09, 0x64, 0xA5, 0xF0, 0xF0, 0x40, 0x09, 0x64, 0x95, 0xF0, 0xF0, 0x50, 0x09, 0x64, 0x85,
+	0xF0, 0xF0, 0x60, 0x09, 0x74, 0x65, 0xF0, 0xF0, 0x70, 0x09, 0x75, 0x45, 0xF0, 0xF0, 0x80, 0x07,
+	0x7D, 0xF0, 0xF0, 0x90, 0x07, 0x8C, 0xF0, 0xF0, 0x90, 0x07, 0x99, 0xF0, 0xF0, 0xB0, 0x07, 0xC4,
+	0xF0, 0xF0, 0xD0, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07,
+	0xDF, 0x05, 0xF0, 0xB0, 0x07, 0xCF, 0x07, 0xF0, 0xA0, 0x07, 0xBF, 0x09, 0xF0, 0x90, 0x07, 0xAF,
+	0x0B, 0xF0, 0x80, 0x07, 0xA4, 0xF8, 0xF0, 0x70, 0x09, 0xA3, 0xF0, 0x19, 0xF0, 0x60, 0x09, 0xA3,
+	0xF0, 0x1A, 0xF0, 0x50, 0x0B, 0xA3, 0xF0, 0x14, 0x25, 0xF0, 0x40, 0x0B, 0xA3, 0xF0, 0x14, 0x35,
+	0xF0, 0x30, 0x0B, 0xA3, 0xF0, 0x14, 0x45, 0xF0, 0x20, 0x0B, 0xA3, 0xF0, 0x14, 0x55, 0xF0, 0x10,
+	0x09, 0xA3, 0xF0, 0x14, 0x65, 0xF0, 0x09, 0xA3, 0xF0, 0x14, 0x75, 0xE0, 0x09, 0xA3, 0xF0, 0x14,
+	0x85, 0xD0, 0x09, 0xA3, 0xF0, 0x23, 0x95, 0xC0, 0x09, 0xA3, 0xF0, 0x24, 0x86, 0xB0, 0x09, 0xA3,
+	0xF0, 0x2F, 0x03, 0xB0, 0x09, 0xA3, 0xF0, 0x3F, 0x03, 0xA0, 0x09, 0xA3, 0xF0, 0x4F, 0x02, 0xA0,
+	0x07, 0xA3, 0xF0, 0x6F, 0xA0, 0x89, 0x17, 0xA3, 0xF0, 0xF0, 0x33, 0xA0, 0x09, 0xA4, 0xF0, 0xF0,
+	0x14, 0xA0, 0x07, 0xAF, 0x0F, 0x09, 0xA0, 0x07, 0xBF, 0x0F, 0x07, 0xB0, 0x07, 0xCF, 0x0F, 0x05,
+	0xC0, 0x07, 0xDF, 0x0F, 0x03, 0xD0, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x0B, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x07, 0x8E, 0xF0, 0xF0, 0x70, 0x09, 0x7F, 0x02, 0xF0, 0xF0, 0x50, 0x09, 0x6F, 0x04,
+	0xF0, 0xF0, 0x40, 0x09, 0x55, 0xA6, 0xF0, 0xF0, 0x30, 0x09, 0x54, 0xD6, 0xF0, 0xF0, 0x10, 0x07,
+	0x54, 0xE6, 0xF0, 0xF0, 0x07, 0x54, 0xFF, 0x0C, 0x80, 0x09, 0x54, 0xF0, 0x2F, 0x0B, 0x70, 0x09,
+	0x54, 0xF0, 0x1F, 0x0D, 0x60, 0x07, 0x54, 0xFF, 0x0F, 0x50, 0x09, 0x54, 0xE6, 0xF0, 0x64, 0x50,
+	0x09, 0x54, 0xC6, 0xF0, 0x84, 0x50, 0x09, 0x5F, 0x06, 0xF0, 0x94, 0x50, 0x09, 0x5F, 0x05, 0xF0,
+	0xA4, 0x50, 0x09, 0x5F, 0x04, 0xF0, 0xB4, 0x50, 0x09, 0x5F, 0x02, 0xF0, 0xD4, 0x50, 0x89, 0x12,
+	0x54, 0xF0, 0xF0, 0xB4, 0x50, 0x09, 0x55, 0xF0, 0xF0, 0x95, 0x50, 0x09, 0x6F, 0x0F, 0x0F, 0x02,
+	0x60, 0x07, 0x7F, 0x0F, 0x0F, 0x70, 0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x87, 0x07, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07, 0xF0, 0xC5, 0xF0,
+	0xC0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x09, 0xF0, 0x86, 0x16, 0xF0,
+	0x80, 0x09, 0xF0, 0x76, 0x36, 0xF0, 0x70, 0x09, 0xF0, 0x66, 0x56, 0xF0, 0x60, 0x09, 0xF0, 0x47,
+	0x86, 0xF0, 0x40, 0x09, 0xF0, 0x36, 0xB6, 0xF0, 0x30, 0x09, 0xF0, 0x26, 0xD6, 0xF0, 0x20, 0x07,
+	0xF6, 0xF0, 0x26, 0xF0, 0x07, 0xE6, 0xF0, 0x46, 0xE0, 0x07, 0xD6, 0xF0, 0x66, 0xD0, 0x07, 0xC6,
+	0xF0, 0x86, 0xC0, 0x07, 0xB6, 0xF0, 0xA6, 0xB0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09, 0x95, 0xF0,
+	0xF0, 0x15, 0x90, 0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x09, 0x84, 0xF0, 0xF0, 0x54, 0x80, 0x89,
+	0x08, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x07, 0x74, 0xE9, 0xE4, 0x70, 0x87, 0x01, 0x74, 0xCD, 0xC4,
+	0x70, 0x07, 0x74, 0xBF, 0xB4, 0x70, 0x89, 0x0B, 0x74, 0xB4, 0x74, 0xB4, 0x70, 0x89, 0x01, 0x7F,
+	0x04, 0x7F, 0x04, 0x70, 0x09, 0x8F, 0x02, 0x9F, 0x02, 0x80, 0x05, 0x9F, 0xBF, 0x90, 0x87, 0x03,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07,
+	0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09,
+	0xF0, 0x57, 0x57, 0xF0, 0x50, 0x09, 0xF0, 0x46, 0x96, 0xF0, 0x40, 0x09, 0xF0, 0x45, 0xB5, 0xF0,
+	0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x0B, 0xF0, 0x24,
+	0xF0, 0x23, 0xF0, 0x30, 0x8B, 0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x0B, 0xF0, 0x33, 0xF0,
+	0x23, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09,
+	0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x46, 0x96, 0xF0, 0x40, 0x09, 0xF0, 0x57, 0x57, 0xF0,
+	0x50, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x07, 0xF0, 0x9B, 0xF0,
+	0x90, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xCF, 0x0F, 0x05,
+	0xC0, 0x07, 0xBF, 0x0F, 0x07, 0xB0, 0x07, 0xAF, 0x0F, 0x09, 0xA0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0,
+	0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x89, 0x01, 0xA3, 0xF0, 0xF0, 0x33, 0xA0, 0x89, 0x01, 0xA4,
+	0xF0, 0xF0, 0x14, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x13, 0xB0, 0x07, 0xB4, 0xF0, 0xE4, 0xB0, 0x07,
+	0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xD6, 0xF0, 0x66, 0xD0, 0x05, 0xE8,
+	0xF8, 0xE0, 0x05, 0xFA, 0x9A, 0xF0, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0x09, 0xF0, 0x4F, 0x06,
+	0xF0, 0x40, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x02, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x87, 0x0C, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0xF0, 0xF0, 0x73, 0x40, 0x09, 0xF0,
+	0xF0, 0xF0, 0x64, 0x40, 0x09, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x09, 0xF0, 0xF0, 0xF0, 0x45, 0x50,
+	0x09, 0xF0, 0xF0, 0xF0, 0x35, 0x60, 0x09, 0xF0, 0xF0, 0xF0, 0x25, 0x70, 0x09, 0xF0, 0xF0, 0xF0,
+	0x15, 0x80, 0x07, 0xF0, 0xF0, 0xF5, 0x90, 0x07, 0xF0, 0xF0, 0xE5, 0xA0, 0x07, 0xF0, 0xF0, 0xD5,
+	0xB0, 0x07, 0xF0, 0xF0, 0xC5, 0xC0, 0x07, 0xF0, 0xF0, 0xB5, 0xD0, 0x07, 0xF0, 0xF0, 0xA5, 0xE0,
+	0x07, 0xF0, 0xF0, 0x95, 0xF0, 0x09, 0xF0, 0xF0, 0x85, 0xF0, 0x10, 0x09, 0xF0, 0xF0, 0x75, 0xF0,
+	0x20, 0x09, 0xF0, 0xF0, 0x65, 0xF0, 0x30, 0x09, 0xF0, 0xF0, 0x55, 0xF0, 0x40, 0x09, 0x43, 0xF0,
+	0xC5, 0xF0, 0x50, 0x09, 0x44, 0xF0, 0xA5, 0xF0, 0x60, 0x09, 0x45, 0xF0, 0x85, 0xF0, 0x70, 0x09,
+	0x55, 0xF0, 0x65, 0xF0, 0x80, 0x09, 0x65, 0xF0, 0x45, 0xF0, 0x90, 0x09, 0x75, 0xF0, 0x25, 0xF0,
+	0xA0, 0x07, 0x85, 0xF5, 0xF0, 0xB0, 0x07, 0x95, 0xD5, 0xF0, 0xC0, 0x07, 0xA5, 0xB5, 0xF0, 0xD0,
+	0x07, 0xB5, 0x95, 0xF0, 0xE0, 0x07, 0xC5, 0x75, 0xF0, 0xF0, 0x09, 0xD5, 0x55, 0xF0, 0xF0, 0x10,
+	0x09, 0xE5, 0x35, 0xF0, 0xF0, 0x20, 0x07, 0xFB, 0xF0, 0xF0, 0x30, 0x09, 0xF0, 0x19, 0xF0, 0xF0,
+	0x40, 0x09, 0xF0, 0x27, 0xF0, 0xF0, 0x50, 0x09, 0xF0, 0x35, 0xF0, 0xF0, 0x60, 0x09, 0xF0, 0x43,
+	0xF0, 0xF0, 0x70, 0x87, 0x09, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x09, 0xF0, 0xF0, 0xF0, 0xE0, 0x89,
+	0x01, 0x93, 0xF0, 0xF0, 0x53, 0x90, 0x09, 0x95, 0xF0, 0xF0, 0x15, 0x90, 0x09, 0xA4, 0xF0, 0xF0,
+	0x14, 0xA0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC4, 0xF0, 0xC4, 0xC0, 0x07, 0xD5, 0xF0, 0x85,
+	0xD0, 0x07, 0xE4, 0xF0, 0x84, 0xE0, 0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x0B, 0xF0, 0x14, 0xF0, 0x44,
+	0xF0, 0x10, 0x09, 0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x09, 0xF0, 0x34, 0xF4, 0xF0, 0x30, 0x09, 0xF0,
+	0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x55, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x65, 0x75, 0xF0, 0x60,
+	0x09, 0xF0, 0x75, 0x55, 0xF0, 0x70, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x95, 0x15,
+	0xF0, 0x90, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x87, 0x02, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xA9,
+	0xF0, 0xA0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x75,
+	0x55, 0xF0, 0x70, 0x09, 0xF0, 0x65, 0x75, 0xF0, 0x60, 0x09, 0xF0, 0x55, 0x95, 0xF0, 0x50, 0x09,
+	0xF0, 0x54, 0xB4, 0xF0, 0x50, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34, 0xF4, 0xF0,
+	0x30, 0x0B, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x10, 0x0B, 0xF0, 0x14, 0xF0, 0x44, 0xF0, 0x10, 0x07,
+	0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xE4, 0xF0, 0x84, 0xE0, 0x07, 0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xC4,
+	0xF0, 0xC4, 0xC0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x09, 0x94,
+	0xF0, 0xF0, 0x34, 0x90, 0x09, 0x93, 0xF0, 0xF0, 0x53, 0x90, 0x09, 0x92, 0xF0, 0xF0, 0x72, 0x90,
+	0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xE1, 0xF0,
+	0xE0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x87, 0x01, 0xF0, 0xA9, 0xF0, 0xA0, 0x09, 0xF0, 0x95, 0x15,
+	0xF0, 0x90, 0x09, 0xF0, 0x94, 0x34, 0xF0, 0x90, 0x09, 0xF0, 0x84, 0x54, 0xF0, 0x80, 0x09, 0xF0,
+	0x75, 0x55, 0xF0, 0x70, 0x09, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x09, 0xF0, 0x65, 0x75, 0xF0, 0x60,
+	0x09, 0xF0, 0x64, 0x94, 0xF0, 0x60, 0x09, 0xF0, 0x54, 0xB4, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5,
+	0xF0, 0x40, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x0B, 0xF0, 0x35, 0x61, 0x65, 0xF0, 0x30, 0x0B,
+	0xF0, 0x34, 0x63, 0x64, 0xF0, 0x30, 0x0B, 0xF0, 0x25, 0x63, 0x65, 0xF0, 0x20, 0x0B, 0xF0, 0x24,
+	0x73, 0x74, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0x73, 0x75, 0xF0, 0x10, 0x0B, 0xF0, 0x14, 0x83, 0x84,
+	0xF0, 0x10, 0x87, 0x01, 0xF4, 0x93, 0x94, 0xF0, 0x87, 0x01, 0xE4, 0xA3, 0xA4, 0xE0, 0x07, 0xD4,
+	0xB3, 0xB4, 0xD0, 0x07, 0xC5, 0xB3, 0xB5, 0xC0, 0x07, 0xC4, 0xC3, 0xC4, 0xC0, 0x07, 0xB5, 0xC3,
+	0xC5, 0xB0, 0x07, 0xB4, 0xD3, 0xD4, 0xB0, 0x07, 0xA4, 0xE3, 0xE4, 0xA0, 0x09, 0xA4, 0xF0, 0xF0,
+	0x14, 0xA0, 0x09, 0x94, 0xF0, 0xF0, 0x34, 0x90, 0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x0B, 0x84,
+	0xF0, 0x21, 0xF0, 0x24, 0x80, 0x0B, 0x75, 0xF0, 0x13, 0xF0, 0x15, 0x70, 0x0B, 0x74, 0xF0, 0x15,
+	0xF0, 0x14, 0x70, 0x0B, 0x64, 0xF0, 0x25, 0xF0, 0x24, 0x60, 0x0B, 0x64, 0xF0, 0x33, 0xF0, 0x34,
+	0x60, 0x0B, 0x54, 0xF0, 0x51, 0xF0, 0x54, 0x50, 0x89, 0x02, 0x54, 0xF0, 0xF0, 0xB4, 0x50, 0x09,
+	0x5F, 0x0F, 0x0F, 0x04, 0x50, 0x09, 0x6F, 0x0F, 0x0F, 0x02, 0x60, 0x07, 0x7F, 0x0F, 0x0F, 0x70,
+	0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x5F, 0x04,
+	0xF0, 0x50, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0x09, 0xF0, 0x1A, 0x7A, 0xF0, 0x10, 0x07, 0xE7,
+	0xF0, 0x27, 0xE0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x07, 0xC6, 0xF0, 0x86, 0xC0, 0x07, 0xB5, 0xF0,
+	0xC5, 0xB0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x0B, 0x94, 0xF0,
+	0x11, 0xF0, 0x14, 0x90, 0x07, 0x85, 0xF3, 0xF5, 0x80, 0x0B, 0x84, 0xF0, 0x13, 0xF0, 0x14, 0x80,
+	0x8B, 0x01, 0x74, 0xF0, 0x23, 0xF0, 0x24, 0x70, 0x8B, 0x02, 0x64, 0xF0, 0x33, 0xF0, 0x34, 0x60,
+	0x8B, 0x0A, 0x54, 0xF0, 0x43, 0xF0, 0x44, 0x50, 0x09, 0x63, 0xF0, 0xF0, 0xB3, 0x60, 0x89, 0x01,
+	0x64, 0xF0, 0xF0, 0x94, 0x60, 0x0B, 0x74, 0xF0, 0x31, 0xF0, 0x34, 0x70, 0x8B, 0x01, 0x74, 0xF0,
+	0x15, 0xF0, 0x14, 0x70, 0x07, 0x84, 0xF5, 0xF4, 0x80, 0x07, 0x94, 0xF3, 0xF4, 0x90, 0x09, 0x95,
+	0xF0, 0xF0, 0x15, 0x90, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x07, 0xA6, 0xF0, 0xC6, 0xA0, 0x07, 0xB6,
+	0xF0, 0xA6, 0xB0, 0x07, 0xC6, 0xF0, 0x86, 0xC0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x05, 0xF8, 0xD8,
+	0xF0, 0x09, 0xF0, 0x1A, 0x7A, 0xF0, 0x10, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x5F,
+	0x04, 0xF0, 0x50, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x02, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x09, 0xF0,
+	0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20,
+	0x09, 0xF0, 0x1A, 0x7A, 0xF0, 0x10, 0x07, 0xE7, 0xF0, 0x27, 0xE0, 0x07, 0xD7, 0xF0, 0x47, 0xD0,
+	0x07, 0xC6, 0xF0, 0x86, 0xC0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09,
+	0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x07, 0x94, 0xF3, 0xF4, 0x90, 0x07, 0x85, 0xD7, 0xD5, 0x80, 0x07,
+	0x84, 0xD9, 0xD4, 0x80, 0x07, 0x74, 0xDB, 0xD4, 0x70, 0x09, 0x74, 0xC5, 0x35, 0xC4, 0x70, 0x09,
+	0x64, 0xD4, 0x54, 0xD4, 0x60, 0x89, 0x01, 0x64, 0xC4, 0x74, 0xC4, 0x60, 0x09, 0x54, 0xD4, 0x74,
+	0xD4, 0x50, 0x09, 0x54, 0xE3, 0x73, 0xE4, 0x50, 0x09, 0x54, 0xF0, 0x84, 0xE4, 0x50, 0x09, 0x54,
+	0xF0, 0x75, 0xE4, 0x50, 0x09, 0x54, 0xF0, 0x66, 0xE4, 0x50, 0x09, 0x54, 0xF0, 0x56, 0xF4, 0x50,
+	0x0B, 0x54, 0xF0, 0x55, 0xF0, 0x14, 0x50, 0x0B, 0x54, 0xF0, 0x45, 0xF0, 0x24, 0x50, 0x0B, 0x54,
+	0xF0, 0x44, 0xF0, 0x34, 0x50, 0x8B, 0x01, 0x54, 0xF0, 0x43, 0xF0, 0x44, 0x50, 0x0B, 0x63, 0xF0,
+	0x43, 0xF0, 0x43, 0x60, 0x89, 0x01, 0x64, 0xF0, 0xF0, 0x94, 0x60, 0x09, 0x74, 0xF0, 0xF0, 0x74,
+	0x70, 0x0B, 0x74, 0xF0, 0x31, 0xF0, 0x34, 0x70, 0x0B, 0x74, 0xF0, 0x23, 0xF0, 0x24, 0x70, 0x07,
+	0x84, 0xF5, 0xF4, 0x80, 0x07, 0x94, 0xE5, 0xE4, 0x90, 0x07, 0x95, 0xE3, 0xE5, 0x90, 0x07, 0xA5,
+	0xE1, 0xE5, 0xA0, 0x07, 0xA6, 0xF0, 0xC6, 0xA0, 0x07, 0xB6, 0xF0, 0xA6, 0xB0, 0x07, 0xC6, 0xF0,
+	0x86, 0xC0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x05, 0xF8, 0xD8, 0xF0, 0x09, 0xF0, 0x1A, 0x7A, 0xF0,
+	0x10, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x07, 0xF0, 0x9B,
+	0xF0, 0x90, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0,
+	0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0x09, 0xF0, 0x1A, 0x7A, 0xF0, 0x10,
+	0x07, 0xE7, 0xF0, 0x27, 0xE0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x07, 0xC6, 0xF0, 0x86, 0xC0, 0x07,
+	0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x09, 0xA4, 0xF0, 0xF0, 0x14, 0xA0, 0x09,
+	0x94, 0xF0, 0xF0, 0x34, 0x90, 0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x09, 0x84, 0xF0, 0xF0, 0x54,
+	0x80, 0x89, 0x01, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x64, 0xF0, 0xF0, 0x94, 0x60, 0x09, 0x64,
+	0x7F, 0x0A, 0x74, 0x60, 0x09, 0x64, 0x5F, 0x0E, 0x54, 0x60, 0x8B, 0x01, 0x54, 0x5F, 0x0F, 0x01,
+	0x54, 0x50, 0x8B, 0x05, 0x54, 0x44, 0xF0, 0xA4, 0x44, 0x50, 0x8B, 0x01, 0x54, 0x5F, 0x0F, 0x01,
+	0x54, 0x50, 0x09, 0x54, 0x6F, 0x0E, 0x64, 0x50, 0x09, 0x63, 0x7F, 0x0C, 0x73, 0x60, 0x89, 0x01,
+	0x64, 0xF0, 0xF0, 0x94, 0x60, 0x89, 0x02, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x84, 0xF0, 0xF0,
+	0x54, 0x80, 0x09, 0x94, 0xF0, 0xF0, 0x34, 0x90, 0x09, 0x95, 0xF0, 0xF0, 0x15, 0x90, 0x07, 0xA5,
+	0xF0, 0xE5, 0xA0, 0x07, 0xA6, 0xF0, 0xC6, 0xA0, 0x07, 0xB6, 0xF0, 0xA6, 0xB0, 0x07, 0xC6, 0xF0,
+	0x86, 0xC0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x05, 0xF8, 0xD8, 0xF0, 0x09, 0xF0, 0x1A, 0x7A, 0xF0,
+	0x10, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x07, 0xF0, 0x9B,
+	0xF0, 0x90, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xB4, 0xF0, 0xE0, 0x87, 0x01, 0xF0, 0xA7, 0xF0, 0xC0, 0x07, 0xF0,
+	0x99, 0xF0, 0xB0, 0x09, 0xF0, 0x85, 0x14, 0xF0, 0xB0, 0x89, 0x01, 0xF0, 0x75, 0x24, 0xF0, 0xB0,
+	0x09, 0xF0, 0x65, 0x34, 0xF0, 0xB0, 0x09, 0xF0, 0x55, 0x44, 0xF0, 0xB0, 0x09, 0xF0, 0x54, 0x54,
+	0xF0, 0xB0, 0x09, 0xF0, 0x44, 0x55, 0xF0, 0xB0, 0x09, 0xF0, 0x35, 0x54, 0xF0, 0xC0, 0x09, 0xF0,
+	0x25, 0x64, 0xF0, 0xC0, 0x09, 0xF0, 0x15, 0x74, 0xF0, 0xC0, 0x07, 0xF5, 0x74, 0xF0, 0xD0, 0x07,
+	0xE6, 0x75, 0xF0, 0xC0, 0x07, 0xD6, 0x8F, 0x03, 0xE0, 0x07, 0xD5, 0x9F, 0x04, 0xD0, 0x07, 0xC5,
+	0xBF, 0x04, 0xC0, 0x07, 0xC4, 0xF0, 0xC4, 0xC0, 0x87, 0x06, 0xB4, 0xF0, 0xE4, 0xB0, 0x07, 0xB4,
+	0xF0, 0xE3, 0xC0, 0x87, 0x03, 0xB4, 0xF0, 0xD4, 0xC0, 0x07, 0xB4, 0xF0, 0xD3, 0xD0, 0x87, 0x01,
+	0xB4, 0xF0, 0xC4, 0xD0, 0x07, 0xC3, 0xF0, 0xC4, 0xD0, 0x87, 0x01, 0xC4, 0xF0, 0xB4, 0xD0, 0x07,
+	0xD4, 0xF0, 0xA4, 0xD0, 0x07, 0xD5, 0xF0, 0x84, 0xE0, 0x07, 0xE5, 0xF0, 0x74, 0xE0, 0x07, 0xF7,
+	0xF0, 0x26, 0xE0, 0x07, 0xF0, 0x1F, 0x0D, 0xF0, 0x09, 0xF0, 0x3F, 0x0A, 0xF0, 0x10, 0x09, 0xF0,
+	0x4F, 0x08, 0xF0, 0x20, 0x09, 0xF0, 0x7F, 0x02, 0xF0, 0x50, 0x87, 0x05, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x07, 0xF0, 0x9B, 0xF0, 0x90,
+	0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x1A, 0x7A,
+	0xF0, 0x10, 0x05, 0xF8, 0xD8, 0xF0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x07, 0xC6, 0xF0, 0x86, 0xC0,
+	0x07, 0xB6, 0xF0, 0xA6, 0xB0, 0x07, 0xA6, 0xF0, 0xC6, 0xA0, 0x09, 0xA5, 0xC1, 0xF0, 0x15, 0xA0,
+	0x09, 0x95, 0xC3, 0xF0, 0x15, 0x90, 0x09, 0x94, 0xD4, 0xF0, 0x14, 0x90, 0x09, 0x84, 0xE4, 0xF0,
+	0x24, 0x80, 0x89, 0x02, 0x74, 0xF4, 0xF0, 0x34, 0x70, 0x8B, 0x01, 0x64, 0xF0, 0x14, 0xF0, 0x44,
+	0x60, 0x0B, 0x63, 0xF0, 0x24, 0xF0, 0x53, 0x60, 0x8B, 0x05, 0x54, 0xF0, 0x24, 0xF0, 0x54, 0x50,
+	0x0B, 0x54, 0xF0, 0x25, 0xF0, 0x44, 0x50, 0x0B, 0x54, 0xF0, 0x35, 0xF0, 0x34, 0x50, 0x0B, 0x54,
+	0xF0, 0x45, 0xF0, 0x24, 0x50, 0x0B, 0x54, 0xF0, 0x55, 0xF0, 0x14, 0x50, 0x09, 0x54, 0xF0, 0x65,
+	0xF4, 0x50, 0x09, 0x64, 0xF0, 0x65, 0xD4, 0x60, 0x09, 0x64, 0xF0, 0x74, 0xD4, 0x60, 0x09, 0x64,
+	0xF0, 0xF0, 0x94, 0x60, 0x89, 0x01, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x84, 0xF0, 0xF0, 0x54,
+	0x80, 0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x09, 0x94, 0xF0, 0xF0, 0x34, 0x90, 0x09, 0xA4, 0xF0,
+	0xF0, 0x14, 0xA0, 0x07, 0xA5, 0xF0, 0xE5, 0xA0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC6, 0xF0,
+	0x86, 0xC0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x07, 0xE7, 0xF0, 0x27, 0xE0, 0x09, 0xF0, 0x1A, 0x7A,
+	0xF0, 0x10, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0,
+	0x6F, 0x02, 0xF0, 0x60, 0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87,
+	0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0x73, 0xF0, 0xF0, 0x93, 0x70, 0x09, 0x74, 0xF0, 0xF0, 0x74,
+	0x70, 0x0B, 0x75, 0xF0, 0x21, 0xF0, 0x25, 0x70, 0x07, 0x84, 0xCB, 0xC4, 0x80, 0x09, 0x83, 0xAF,
+	0x02, 0xA3, 0x80, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0, 0x48, 0x58, 0xF0, 0x40, 0x09,
+	0xF0, 0x36, 0xB6, 0xF0, 0x30, 0x09, 0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0xF0, 0x25,
+	0xF0, 0x10, 0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xE4, 0xF0, 0x84,
+	0xE0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x87, 0x01, 0xD4, 0xF0, 0xA4, 0xD0, 0x0B, 0x16, 0x64, 0xF0,
+	0xA4, 0x66, 0x10, 0x8A, 0x01, 0x07, 0x63, 0xF0, 0xC3, 0x67, 0x0B, 0x15, 0x73, 0xF0, 0xC3, 0x75,
+	0x10, 0x87, 0x02, 0xD3, 0xF0, 0xC3, 0xD0, 0x87, 0x02, 0xD4, 0xF0, 0xA4, 0xD0, 0x87, 0x01, 0xE4,
+	0xF0, 0x84, 0xE0, 0x07, 0xF4, 0xF0, 0x64, 0xF0, 0x07, 0xF5, 0xF0, 0x45, 0xF0, 0x0B, 0xF0, 0x15,
+	0xF0, 0x25, 0xF0, 0x10, 0x09, 0x84, 0x55, 0xF5, 0x54, 0x80, 0x09, 0x75, 0x64, 0xF4, 0x65, 0x70,
+	0x09, 0x75, 0x73, 0xF3, 0x75, 0x70, 0x09, 0x74, 0x84, 0xD4, 0x84, 0x70, 0x09, 0x73, 0x94, 0xD4,
+	0x93, 0x70, 0x89, 0x02, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x89, 0x02, 0xF0, 0x5F, 0x04, 0xF0, 0x50,
+	0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x89, 0x03, 0xF0, 0x64, 0x94, 0xF0, 0x60, 0x09, 0xF0, 0x74,
+	0x74, 0xF0, 0x70, 0x87, 0x01, 0xF0, 0x7F, 0xF0, 0x70, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0,
+	0xB7, 0xF0, 0xB0, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x09,
+	0xF0, 0xE2, 0xF0, 0x61, 0x60, 0x09, 0xF0, 0x9B, 0xF0, 0x13, 0x50, 0x09, 0xF0, 0x6F, 0x02, 0xC4,
+	0x50, 0x09, 0xF0, 0x5F, 0x04, 0xA4, 0x60, 0x09, 0xF0, 0x48, 0x58, 0x85, 0x60, 0x09, 0xF0, 0x36,
+	0xB6, 0x64, 0x80, 0x09, 0xF0, 0x25, 0xF4, 0x55, 0x80, 0x0B, 0xF0, 0x15, 0xF0, 0x21, 0x64, 0xA0,
+	0x07, 0xF5, 0xF0, 0x95, 0xA0, 0x07, 0xE5, 0xF0, 0x94, 0xC0, 0x07, 0xE4, 0xF0, 0x95, 0xC0, 0x07,
+	0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xD4, 0xF0, 0x86, 0xD0, 0x07, 0xD4, 0xF0, 0x77, 0xD0, 0x07, 0xD4,
+	0xF0, 0x68, 0xD0, 0x09, 0xD3, 0xF0, 0x65, 0x13, 0xD0, 0x09, 0xD3, 0xF0, 0x55, 0x23, 0xD0, 0x09,
+	0xD3, 0xF0, 0x45, 0x33, 0xD0, 0x09, 0xD3, 0xF0, 0x35, 0x43, 0xD0, 0x09, 0xD3, 0xF0, 0x25, 0x53,
+	0xD0, 0x09, 0xD3, 0xF0, 0x15, 0x63, 0xD0, 0x07, 0xD4, 0xE5, 0x64, 0xD0, 0x07, 0xD4, 0xD5, 0x74,
+	0xD0, 0x07, 0xD4, 0xC5, 0x84, 0xD0, 0x07, 0xE4, 0xA5, 0x84, 0xE0, 0x07, 0xE5, 0x85, 0x94, 0xE0,
+	0x07, 0xF4, 0x75, 0x94, 0xF0, 0x07, 0xF5, 0x55, 0x95, 0xF0, 0x0B, 0xF0, 0x13, 0x55, 0x95, 0xF0,
+	0x10, 0x09, 0xF0, 0x85, 0x95, 0xF0, 0x20, 0x09, 0xF0, 0x75, 0xA4, 0xF0, 0x30, 0x09, 0xF0, 0x65,
+	0xB4, 0xF0, 0x30, 0x09, 0xF0, 0x55, 0xB4, 0xF0, 0x40, 0x09, 0xF0, 0x45, 0xC4, 0xF0, 0x40, 0x09,
+	0xF0, 0x35, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x26, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x17, 0xD4, 0xF0,
+	0x40, 0x07, 0xFF, 0x09, 0xF0, 0x50, 0x09, 0xE5, 0x1F, 0x04, 0xF0, 0x50, 0x09, 0xD5, 0x2F, 0x04,
+	0xF0, 0x50, 0x09, 0xC4, 0x5F, 0x03, 0xF0, 0x50, 0x09, 0xB5, 0x54, 0x94, 0xF0, 0x60, 0x09, 0xA4,
+	0x74, 0x94, 0xF0, 0x60, 0x09, 0x95, 0x74, 0x94, 0xF0, 0x60, 0x09, 0x84, 0x94, 0x94, 0xF0, 0x60,
+	0x09, 0x75, 0xA4, 0x74, 0xF0, 0x70, 0x07, 0x64, 0xCF, 0xF0, 0x70, 0x07, 0x55, 0xCF, 0xF0, 0x70,
+	0x07, 0x53, 0xFD, 0xF0, 0x80, 0x09, 0x62, 0xF0, 0x37, 0xF0, 0xB0, 0x87, 0x03, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0x9B, 0xF0,
+	0x90, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x75, 0x55,
+	0xF0, 0x70, 0x09, 0xF0, 0x74, 0x74, 0xF0, 0x70, 0x09, 0xF0, 0x73, 0x93, 0xF0, 0x70, 0x89, 0x01,
+	0xF0, 0x64, 0x94, 0xF0, 0x60, 0x09, 0xF0, 0x64, 0x97, 0xF0, 0x30, 0x89, 0x01, 0xF0, 0x64, 0x98,
+	0xF0, 0x20, 0x09, 0xF0, 0x64, 0x97, 0xF0, 0x30, 0x89, 0x02, 0xF0, 0x64, 0x94, 0xF0, 0x60, 0x8B,
+	0x01, 0xF0, 0x64, 0x33, 0x38, 0xF0, 0x20, 0x0B, 0xF0, 0x64, 0x33, 0x37, 0xF0, 0x30, 0x8B, 0x02,
+	0xF0, 0x64, 0x33, 0x34, 0xF0, 0x60, 0x8B, 0x01, 0xF0, 0x64, 0x33, 0x38, 0xF0, 0x20, 0x0B, 0xF0,
+	0x64, 0x33, 0x37, 0xF0, 0x30, 0x0B, 0xF0, 0x64, 0x33, 0x35, 0xF0, 0x50, 0x8B, 0x03, 0xF0, 0x64,
+	0x33, 0x34, 0xF0, 0x60, 0x8B, 0x01, 0xF0, 0x55, 0x33, 0x35, 0xF0, 0x50, 0x0B, 0xF0, 0x45, 0x43,
+	0x45, 0xF0, 0x40, 0x0B, 0xF0, 0x44, 0x37, 0x34, 0xF0, 0x40, 0x0B, 0xF0, 0x34, 0x39, 0x34, 0xF0,
+	0x30, 0x0B, 0xF0, 0x34, 0x2B, 0x24, 0xF0, 0x30, 0x0B, 0xF0, 0x24, 0x3B, 0x34, 0xF0, 0x20, 0x8B,
+	0x02, 0xF0, 0x24, 0x2D, 0x24, 0xF0, 0x20, 0x0B, 0xF0, 0x24, 0x3B, 0x34, 0xF0, 0x20, 0x0B, 0xF0,
+	0x33, 0x3B, 0x33, 0xF0, 0x30, 0x0B, 0xF0, 0x34, 0x39, 0x34, 0xF0, 0x30, 0x0B, 0xF0, 0x34, 0x47,
+	0x44, 0xF0, 0x30, 0x0B, 0xF0, 0x44, 0x45, 0x44, 0xF0, 0x40, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40,
+	0x09, 0xF0, 0x56, 0x76, 0xF0, 0x50, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x07, 0xF0, 0x7F, 0xF0,
+	0x70, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x87, 0x02, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x87, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0x53, 0xF0, 0x47, 0xA0, 0x09, 0xF0, 0x45,
+	0xF0, 0x39, 0x80, 0x09, 0xF0, 0x46, 0xF0, 0x2A, 0x70, 0x09, 0xF0, 0x37, 0xF0, 0x39, 0x70, 0x09,
+	0xF0, 0x29, 0xF0, 0x84, 0x60, 0x09, 0xF0, 0x1B, 0xF0, 0x74, 0x60, 0x0B, 0xF0, 0x14, 0x34, 0xF0,
+	0x74, 0x60, 0x09, 0xF4, 0x54, 0xF0, 0x64, 0x60, 0x09, 0xE5, 0x55, 0xF0, 0x54, 0x60, 0x09, 0xD5,
+	0x75, 0xF0, 0x44, 0x60, 0x09, 0xD4, 0x85, 0xF0, 0x17, 0x60, 0x07, 0xD4, 0x95, 0xF7, 0x60, 0x07,
+	0xC4, 0xB4, 0xF7, 0x60, 0x07, 0xB4, 0xD4, 0xF6, 0x60, 0x09, 0xB4, 0xD4, 0xF0, 0x24, 0x60, 0x09,
+	0xA5, 0xD5, 0xF0, 0x14, 0x60, 0x09, 0xAF, 0x08, 0xF0, 0x14, 0x60, 0x87, 0x01, 0x9F, 0x0A, 0xF4,
+	0x60, 0x07, 0x9F, 0x0B, 0xE4, 0x60, 0x09, 0x84, 0xF0, 0x44, 0xB7, 0x60, 0x09, 0x74, 0xF0, 0x54,
+	0xB7, 0x60, 0x89, 0x01, 0x74, 0xF0, 0x64, 0xA7, 0x60, 0x09, 0x74, 0xF0, 0x64, 0xD4, 0x60, 0x09,
+	0x74, 0xF0, 0x73, 0xD4, 0x60, 0x09, 0x64, 0xF0, 0x83, 0xD4, 0x60, 0x89, 0x02, 0x64, 0xF0, 0x84,
+	0xC4, 0x60, 0x09, 0x64, 0xF0, 0x84, 0xA6, 0x60, 0x09, 0x73, 0xF0, 0x83, 0xA7, 0x60, 0x89, 0x01,
+	0x74, 0xF0, 0x64, 0xA7, 0x60, 0x09, 0x74, 0xF0, 0x64, 0xD4, 0x60, 0x09, 0x75, 0xF0, 0x44, 0xE4,
+	0x60, 0x09, 0x85, 0xF0, 0x25, 0xE4, 0x60, 0x09, 0x94, 0xF0, 0x24, 0xF4, 0x60, 0x09, 0xA5, 0xD5,
+	0xF0, 0x14, 0x60, 0x09, 0xB6, 0x96, 0xF0, 0x24, 0x60, 0x07, 0xCF, 0x04, 0xC9, 0x70, 0x07, 0xDF,
+	0x02, 0xCA, 0x70, 0x05, 0xEF, 0xD9, 0x80, 0x09, 0xF0, 0x29, 0xF0, 0x18, 0x90, 0x87, 0x06, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x07, 0xF0,
+	0xB6, 0xF0, 0xC0, 0x07, 0xF0, 0xA7, 0xF0, 0xC0, 0x07, 0xF0, 0x98, 0xF0, 0xC0, 0x07, 0xF0, 0x89,
+	0xF0, 0xC0, 0x07, 0xF0, 0x7A, 0xF0, 0xC0, 0x09, 0xF0, 0x66, 0x14, 0xF0, 0xC0, 0x09, 0xF0, 0x65,
+	0x24, 0xF0, 0xC0, 0x0B, 0xF0, 0x55, 0x34, 0x43, 0xF0, 0x50, 0x0B, 0xF0, 0x45, 0x44, 0x44, 0xF0,
+	0x40, 0x0B, 0xF0, 0x35, 0x54, 0x45, 0xF0, 0x30, 0x0B, 0xF0, 0x34, 0x64, 0x45, 0xF0, 0x30, 0x0B,
+	0xF0, 0x24, 0x74, 0x46, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0x74, 0x47, 0xF0, 0x10, 0x07, 0xF5, 0x84,
+	0x48, 0xF0, 0x09, 0xF4, 0x94, 0x34, 0x14, 0xF0, 0x07, 0xE5, 0xAA, 0x15, 0xE0, 0x07, 0xE4, 0xB9,
+	0x34, 0xE0, 0x07, 0xD4, 0xD8, 0x44, 0xD0, 0x07, 0xD4, 0xE6, 0x54, 0xD0, 0x87, 0x01, 0xC4, 0xF0,
+	0xC4, 0xC0, 0x87, 0x01, 0xB4, 0xF0, 0xE4, 0xB0, 0x07, 0xB4, 0xD3, 0xD4, 0xB0, 0x07, 0xB3, 0xD5,
+	0xD3, 0xB0, 0x07, 0xA4, 0xC7, 0xC4, 0xA0, 0x07, 0xA4, 0xB9, 0xB4, 0xA0, 0x07, 0xA4, 0xAB, 0xA4,
+	0xA0, 0x09, 0xA4, 0xA5, 0x15, 0xA4, 0xA0, 0x09, 0xA3, 0xA5, 0x35, 0xA3, 0xA0, 0x09, 0xA4, 0x94,
+	0x54, 0x94, 0xA0, 0x09, 0xA4, 0x84, 0x74, 0x84, 0xA0, 0x09, 0xA4, 0x75, 0x75, 0x74, 0xA0, 0x09,
+	0xB3, 0x74, 0x94, 0x73, 0xB0, 0x09, 0xB4, 0x64, 0x94, 0x64, 0xB0, 0x89, 0x01, 0xB4, 0x54, 0xB4,
+	0x54, 0xB0, 0x09, 0xC4, 0x44, 0xB4, 0x44, 0xC0, 0x09, 0xC5, 0x33, 0xD3, 0x35, 0xC0, 0x09, 0xD4,
+	0x33, 0xD3, 0x34, 0xD0, 0x09, 0xE4, 0x24, 0xB4, 0x24, 0xE0, 0x05, 0xEA, 0xBA, 0xE0, 0x05, 0xFA,
+	0x9A, 0xF0, 0x09, 0xF0, 0x19, 0x99, 0xF0, 0x10, 0x09, 0xF0, 0x3A, 0x3A, 0xF0, 0x30, 0x09, 0xF0,
+	0x4F, 0x06, 0xF0, 0x40, 0x09, 0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07,
+	0xF0, 0xD3, 0xF0, 0xD0, 0x87, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x01, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09,
+	0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x56, 0x76, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5, 0xF0,
+	0x40, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34,
+	0xF4, 0xF0, 0x30, 0x8B, 0x07, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x0B, 0xF0, 0x24, 0x49, 0x44,
+	0xF0, 0x20, 0x0B, 0xF0, 0x25, 0x1D, 0x15, 0xF0, 0x20, 0x89, 0x01, 0xF0, 0x2F, 0x0A, 0xF0, 0x20,
+	0x09, 0xF0, 0x28, 0x98, 0xF0, 0x20, 0x09, 0xF0, 0x17, 0xD7, 0xF0, 0x10, 0x07, 0xF6, 0xF0, 0x26,
+	0xF0, 0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xD4, 0xF0, 0xA4, 0xD0,
+	0x07, 0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xC4, 0xB5, 0xB4, 0xC0, 0x07, 0xB4, 0xB7, 0xB4, 0xB0, 0x07,
+	0xB4, 0xA9, 0xA4, 0xB0, 0x07, 0xB4, 0x9B, 0x94, 0xB0, 0x07, 0xA4, 0xAB, 0xA4, 0xA0, 0x87, 0x02,
+	0xA4, 0x9D, 0x94, 0xA0, 0x87, 0x01, 0xA3, 0xBB, 0xB3, 0xA0, 0x07, 0xA4, 0xB9, 0xB4, 0xA0, 0x07,
+	0xA4, 0xC7, 0xC4, 0xA0, 0x07, 0xA4, 0xD5, 0xD4, 0xA0, 0x07, 0xB3, 0xD5, 0xD3, 0xB0, 0x87, 0x01,
+	0xB4, 0xC5, 0xC4, 0xB0, 0x07, 0xB5, 0xB5, 0xB5, 0xB0, 0x07, 0xC4, 0xB5, 0xB4, 0xC0, 0x07, 0xC5,
+	0xF0, 0xA5, 0xC0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xE5, 0xF0, 0x74, 0xE0, 0x07, 0xF5, 0xF0,
+	0x45, 0xF0, 0x09, 0xF0, 0x16, 0xF6, 0xF0, 0x10, 0x09, 0xF0, 0x26, 0xD6, 0xF0, 0x20, 0x09, 0xF0,
+	0x3A, 0x3A, 0xF0, 0x30, 0x09, 0xF0, 0x4F, 0x06, 0xF0, 0x40, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60,
+	0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x01, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09,
+	0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x56, 0x76, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5, 0xF0,
+	0x40, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x34,
+	0xF4, 0xF0, 0x30, 0x8B, 0x03, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x0B, 0xF0, 0x24, 0xF0, 0x23,
+	0xF0, 0x30, 0x89, 0x02, 0xF0, 0x24, 0xF0, 0xF0, 0x80, 0x09, 0xF0, 0x24, 0x49, 0xF0, 0xA0, 0x09,
+	0xF0, 0x25, 0x1D, 0xF0, 0x80, 0x09, 0xF0, 0x2F, 0x07, 0xF0, 0x50, 0x09, 0xF0, 0x2F, 0x08, 0xF0,
+	0x40, 0x09, 0xF0, 0x28, 0x98, 0xF0, 0x20, 0x09, 0xF0, 0x17, 0xD7, 0xF0, 0x10, 0x07, 0xF6, 0xF0,
+	0x26, 0xF0, 0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xD4, 0xF0, 0xA4,
+	0xD0, 0x07, 0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xC4, 0xB5, 0xB4, 0xC0, 0x07, 0xB4, 0xB7, 0xB4, 0xB0,
+	0x07, 0xB4, 0xA9, 0xA4, 0xB0, 0x07, 0xB4, 0x9B, 0x94, 0xB0, 0x07, 0xA4, 0xAB, 0xA4, 0xA0, 0x87,
+	0x02, 0xA4, 0x9D, 0x94, 0xA0, 0x87, 0x01, 0xA3, 0xBB, 0xB3, 0xA0, 0x07, 0xA4, 0xB9, 0xB4, 0xA0,
+	0x07, 0xA4, 0xC7, 0xC4, 0xA0, 0x07, 0xA4, 0xD5, 0xD4, 0xA0, 0x07, 0xB3, 0xD5, 0xD3, 0xB0, 0x87,
+	0x01, 0xB4, 0xC5, 0xC4, 0xB0, 0x07, 0xB5, 0xB5, 0xB5, 0xB0, 0x07, 0xC4, 0xB5, 0xB4, 0xC0, 0x07,
+	0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xE5, 0xF0, 0x74, 0xE0, 0x07, 0xF5,
+	0xF0, 0x45, 0xF0, 0x09, 0xF0, 0x16, 0xF6, 0xF0, 0x10, 0x09, 0xF0, 0x26, 0xD6, 0xF0, 0x20, 0x09,
+	0xF0, 0x3A, 0x3A, 0xF0, 0x30, 0x09, 0xF0, 0x4F, 0x06, 0xF0, 0x40, 0x09, 0xF0, 0x6F, 0x02, 0xF0,
+	0x60, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x08, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x05, 0xDA, 0xDA, 0xD0, 0x05, 0xCD, 0x9D, 0xC0, 0x09, 0xAF, 0x01, 0x7F, 0x01, 0xA0, 0x09,
+	0x9F, 0x03, 0x5F, 0x03, 0x90, 0x09, 0x86, 0x95, 0x35, 0x96, 0x80, 0x07, 0x75, 0xCB, 0xC5, 0x70,
+	0x07, 0x74, 0xE9, 0xE4, 0x70, 0x0B, 0x64, 0xF0, 0x17, 0xF0, 0x14, 0x60, 0x0B, 0x64, 0xF0, 0x25,
+	0xF0, 0x24, 0x60, 0x0B, 0x54, 0xF0, 0x43, 0xF0, 0x44, 0x50, 0x0B, 0x54, 0xF0, 0x51, 0xF0, 0x54,
+	0x50, 0x89, 0x05, 0x54, 0xF0, 0xF0, 0xB4, 0x50, 0x09, 0x64, 0xF0, 0xF0, 0x94, 0x60, 0x09, 0x65,
+	0xF0, 0xF0, 0x75, 0x60, 0x09, 0x74, 0xF0, 0xF0, 0x74, 0x70, 0x09, 0x75, 0xF0, 0xF0, 0x55, 0x70,
+	0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x09, 0x95, 0xF0, 0xF0, 0x15, 0x90, 0x09, 0xA4, 0xF0, 0xF0,
+	0x14, 0xA0, 0x07, 0xB4, 0xF0, 0xE4, 0xB0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC5, 0xF0, 0xA5,
+	0xC0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xF5, 0xF0, 0x45, 0xF0,
+	0x0B, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x10, 0x09, 0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x09, 0xF0, 0x35,
+	0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x55, 0x95, 0xF0, 0x50, 0x09,
+	0xF0, 0x66, 0x56, 0xF0, 0x60, 0x09, 0xF0, 0x85, 0x35, 0xF0, 0x80, 0x09, 0xF0, 0x95, 0x15, 0xF0,
+	0x90, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0xC5, 0xF0, 0xC0,
+	0x07, 0xF0, 0xD3, 0xF0, 0xD0, 0x07, 0xF0, 0xE1, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x87, 0x02, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0x81, 0xB1, 0xF0, 0x80, 0x09, 0xF0, 0x57, 0x57,
+	0xF0, 0x50, 0x09, 0xF0, 0x3B, 0x1B, 0xF0, 0x30, 0x09, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x0B, 0xF0,
+	0x25, 0x39, 0x44, 0xF0, 0x20, 0x0B, 0xF0, 0x24, 0x65, 0x64, 0xF0, 0x20, 0x0B, 0xF0, 0x23, 0x84,
+	0x73, 0xF0, 0x20, 0x0B, 0xF0, 0x23, 0x83, 0x84, 0xF0, 0x10, 0x0B, 0xF0, 0x14, 0x83, 0x84, 0xF0,
+	0x10, 0x07, 0xE6, 0x83, 0x86, 0xE0, 0x07, 0xC7, 0x93, 0x97, 0xC0, 0x07, 0xA9, 0x93, 0x99, 0xA0,
+	0x0B, 0x97, 0x63, 0x33, 0x42, 0x67, 0x90, 0x0B, 0x86, 0x74, 0x33, 0x34, 0x76, 0x80, 0x0B, 0x76,
+	0x93, 0x33, 0x34, 0x86, 0x70, 0x0B, 0x75, 0x94, 0x33, 0x34, 0x95, 0x70, 0x0B, 0x65, 0x95, 0x33,
+	0x35, 0x95, 0x60, 0x0B, 0x64, 0x78, 0x33, 0x38, 0x74, 0x60, 0x0B, 0x54, 0x87, 0x43, 0x47, 0x84,
+	0x50, 0x0B, 0x54, 0x85, 0x63, 0x65, 0x84, 0x50, 0x8B, 0x01, 0x54, 0xF0, 0x43, 0xF0, 0x44, 0x50,
+	0x0B, 0x54, 0x46, 0x93, 0x96, 0x44, 0x50, 0x0B, 0x54, 0x29, 0x83, 0x89, 0x24, 0x50, 0x0B, 0x54,
+	0x1C, 0x63, 0x6C, 0x14, 0x50, 0x0B, 0x6F, 0x02, 0x53, 0x5F, 0x02, 0x60, 0x0B, 0x67, 0x55, 0x53,
+	0x55, 0x57, 0x60, 0x0B, 0x75, 0x83, 0x53, 0x53, 0x85, 0x70, 0x0B, 0x74, 0xA2, 0x53, 0x52, 0xA4,
+	0x70, 0x8B, 0x03, 0x74, 0xF0, 0x23, 0xF0, 0x24, 0x70, 0x0B, 0x74, 0x56, 0x63, 0x66, 0x54, 0x70,
+	0x0B, 0x74, 0x57, 0x53, 0x57, 0x54, 0x70, 0x0B, 0x74, 0x58, 0x43, 0x48, 0x54, 0x70, 0x0B, 0x74,
+	0x85, 0x43, 0x45, 0x84, 0x70, 0x0B, 0x74, 0x94, 0x43, 0x44, 0x94, 0x70, 0x8B, 0x01, 0x84, 0x94,
+	0x33, 0x34, 0x94, 0x80, 0x0B, 0x95, 0x74, 0x33, 0x34, 0x84, 0x90, 0x0B, 0xA6, 0x54, 0x33, 0x43,
+	0x56, 0xA0, 0x0B, 0xA8, 0x41, 0x53, 0x51, 0x48, 0xA0, 0x07, 0xC7, 0x93, 0x97, 0xC0, 0x07, 0xD7,
+	0x83, 0x87, 0xD0, 0x0B, 0xF0, 0x14, 0x83, 0x84, 0xF0, 0x10, 0x0B, 0xF0, 0x23, 0x83, 0x83, 0xF0,
+	0x20, 0x0B, 0xF0, 0x23, 0x75, 0x73, 0xF0, 0x20, 0x0B, 0xF0, 0x26, 0x37, 0x45, 0xF0, 0x20, 0x89,
+	0x01, 0xF0, 0x3F, 0x08, 0xF0, 0x30, 0x09, 0xF0, 0x58, 0x38, 0xF0, 0x50, 0x87, 0x03, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x87, 0x0C, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0x8D, 0xF0, 0x80, 0x09, 0xF0, 0x6F,
+	0x03, 0xF0, 0x50, 0x09, 0xF0, 0x4F, 0x07, 0xF0, 0x30, 0x09, 0xF0, 0x2A, 0x69, 0xF0, 0x20, 0x05,
+	0xF8, 0xD8, 0xF0, 0x07, 0xE7, 0xF0, 0x27, 0xE0, 0x07, 0xD6, 0x85, 0x86, 0xD0, 0x07, 0xB7, 0x5D,
+	0x57, 0xB0, 0x09, 0xA7, 0x3F, 0x04, 0x47, 0x90, 0x09, 0x87, 0x3F, 0x08, 0x37, 0x80, 0x09, 0x76,
+	0x48, 0x98, 0x46, 0x70, 0x09, 0x48, 0x56, 0xD6, 0x58, 0x40, 0x0B, 0x1A, 0x72, 0xF0, 0x42, 0x7A,
+	0x10, 0x09, 0x18, 0xF0, 0xF0, 0xB8, 0x10, 0x09, 0x16, 0xF0, 0xF0, 0xF6, 0x10, 0x0B, 0x31, 0xF0,
+	0xF0, 0xF0, 0x61, 0x30, 0x87, 0x02, 0xBF, 0x0F, 0x05, 0xD0, 0x07, 0xCF, 0x0F, 0x03, 0xE0, 0x0B,
+	0x23, 0xF0, 0xF0, 0xF0, 0x43, 0x20, 0x09, 0x17, 0xF0, 0xF0, 0xD7, 0x10, 0x09, 0x19, 0xF0, 0xF0,
+	0x99, 0x10, 0x0B, 0x2A, 0x64, 0xF0, 0x14, 0x5A, 0x20, 0x09, 0x58, 0x47, 0xB7, 0x48, 0x50, 0x09,
+	0x77, 0x4F, 0x09, 0x37, 0x70, 0x09, 0x97, 0x3F, 0x06, 0x46, 0x90, 0x09, 0xB6, 0x5F, 0x01, 0x47,
+	0xA0, 0x07, 0xC7, 0x6A, 0x66, 0xC0, 0x07, 0xD7, 0xF0, 0x47, 0xD0, 0x07, 0xF7, 0xF0, 0x16, 0xF0,
+	0x09, 0xF0, 0x19, 0xA8, 0xF0, 0x10, 0x09, 0xF0, 0x3B, 0x1C, 0xF0, 0x20, 0x09, 0xF0, 0x5F, 0x05,
+	0xF0, 0x40, 0x09, 0xF0, 0x7F, 0x01, 0xF0, 0x60, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x87, 0x09, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x87, 0x0A, 0xF0, 0xF0, 0xF0, 0xE0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x09, 0xF0,
+	0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x2F, 0x0A, 0xF0, 0x20, 0x09, 0xF0, 0x1F, 0x0C, 0xF0, 0x10,
+	0x05, 0xDA, 0xDA, 0xD0, 0x07, 0xC8, 0xF0, 0x48, 0xC0, 0x07, 0xB7, 0xF0, 0x87, 0xB0, 0x07, 0xA6,
+	0xF0, 0xC6, 0xA0, 0x07, 0x96, 0xF0, 0xE6, 0x90, 0x09, 0x85, 0xF0, 0xF0, 0x35, 0x80, 0x07, 0x75,
+	0xE7, 0xE5, 0x70, 0x07, 0x65, 0xDB, 0xD5, 0x60, 0x07, 0x55, 0xCF, 0xC5, 0x50, 0x09, 0x45, 0xCF,
+	0x02, 0xC5, 0x40, 0x09, 0x35, 0xC6, 0x76, 0xC5, 0x30, 0x09, 0x34, 0xD4, 0xB4, 0xD4, 0x30, 0x09,
+	0x25, 0xC4, 0xD4, 0xC5, 0x20, 0x09, 0x24, 0xD4, 0xD4, 0xD4, 0x20, 0x89, 0x01, 0x14, 0xD4, 0xF4,
+	0xD4, 0x10, 0x0B, 0x14, 0xD3, 0xF0, 0x23, 0xD4, 0x10, 0x8A, 0x01, 0x04, 0xE3, 0xF0, 0x23, 0xE4,
+	0x08, 0x04, 0xE4, 0xF4, 0xE4, 0x09, 0x12, 0xF4, 0xF4, 0xF2, 0x10, 0x09, 0xF0, 0x34, 0xF4, 0xF0,
+	0x30, 0x09, 0xF0, 0x44, 0xD4, 0xF0, 0x40, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x55,
+	0x95, 0xF0, 0x50, 0x09, 0xF0, 0x57, 0x57, 0xF0, 0x50, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x07,
+	0xF0, 0x8D, 0xF0, 0x80, 0x07, 0xF0, 0xA9, 0xF0, 0xA0, 0x87, 0x0E, 0xF0, 0xF0, 0xF0, 0xE0, 0x87,
+	0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x09, 0xF0, 0xF0, 0xF0, 0x63, 0x50, 0x09, 0xF0, 0xF0, 0xF0, 0x54,
+	0x50, 0x09, 0xF0, 0xF0, 0xF0, 0x45, 0x50, 0x09, 0xF0, 0xF0, 0xF0, 0x35, 0x60, 0x09, 0xF0, 0xF0,
+	0xF0, 0x25, 0x70, 0x09, 0xF0, 0xF0, 0xF0, 0x15, 0x80, 0x07, 0xF0, 0x9B, 0xA5, 0x90, 0x09, 0xF0,
+	0x6F, 0x02, 0x65, 0xA0, 0x09, 0xF0, 0x2F, 0x06, 0x55, 0xB0, 0x09, 0xF0, 0x1F, 0x06, 0x55, 0xC0,
+	0x07, 0xDA, 0xF0, 0x35, 0xD0, 0x07, 0xC8, 0xF0, 0x57, 0xC0, 0x07, 0xB7, 0xF0, 0x69, 0xB0, 0x07,
+	0xA6, 0xF0, 0x7B, 0xA0, 0x09, 0x96, 0xF0, 0x75, 0x26, 0x90, 0x09, 0x76, 0xF0, 0x85, 0x55, 0x80,
+	0x09, 0x75, 0xE4, 0x55, 0x75, 0x70, 0x09, 0x65, 0xD5, 0x55, 0x95, 0x60, 0x09, 0x55, 0xC6, 0x55,
+	0xB5, 0x50, 0x09, 0x45, 0xC6, 0x56, 0xC5, 0x40, 0x09, 0x35, 0xC6, 0x58, 0xC5, 0x30, 0x09, 0x34,
+	0xD4, 0x69, 0xD4, 0x30, 0x0B, 0x25, 0xC4, 0x65, 0x24, 0xC5, 0x20, 0x0B, 0x24, 0xD4, 0x55, 0x34,
+	0xD4, 0x20, 0x0B, 0x14, 0xD4, 0x55, 0x54, 0xD4, 0x10, 0x0B, 0x14, 0xD3, 0x55, 0x64, 0xD4, 0x10,
+	0x0B, 0x14, 0xD2, 0x55, 0x83, 0xD4, 0x10, 0x0A, 0x04, 0xE1, 0x55, 0x93, 0xE4, 0x0A, 0x04, 0xF0,
+	0x45, 0xA3, 0xE4, 0x0A, 0x04, 0xF0, 0x35, 0xA4, 0xE4, 0x0B, 0x12, 0xF0, 0x35, 0xB4, 0xF2, 0x10,
+	0x09, 0xF0, 0x55, 0xC4, 0xF0, 0x30, 0x09, 0xF0, 0x45, 0xC4, 0xF0, 0x40, 0x09, 0xF0, 0x36, 0xB5,
+	0xF0, 0x40, 0x09, 0xF0, 0x28, 0x95, 0xF0, 0x50, 0x09, 0xF0, 0x1B, 0x57, 0xF0, 0x50, 0x09, 0xF5,
+	0x1F, 0x02, 0xF0, 0x60, 0x07, 0xE5, 0x4D, 0xF0, 0x80, 0x07, 0xD5, 0x79, 0xF0, 0xA0, 0x07, 0xC5,
+	0xF0, 0xF0, 0xC0, 0x07, 0xB5, 0xF0, 0xF0, 0xD0, 0x07, 0xA5, 0xF0, 0xF0, 0xE0, 0x07, 0x95, 0xF0,
+	0xF0, 0xF0, 0x09, 0x85, 0xF0, 0xF0, 0xF0, 0x10, 0x09, 0x75, 0xF0, 0xF0, 0xF0, 0x20, 0x09, 0x65,
+	0xF0, 0xF0, 0xF0, 0x30, 0x09, 0x55, 0xF0, 0xF0, 0xF0, 0x40, 0x09, 0x54, 0xF0, 0xF0, 0xF0, 0x50,
+	0x09, 0x53, 0xF0, 0xF0, 0xF0, 0x60, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x09, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x07, 0xF0, 0xB7, 0xF0, 0xB0, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09, 0xF0, 0x5F, 0x04,
+	0xF0, 0x50, 0x09, 0xF0, 0x4A, 0x1A, 0xF0, 0x40, 0x09, 0xF0, 0x37, 0x97, 0xF0, 0x30, 0x09, 0xF0,
+	0x25, 0xF5, 0xF0, 0x20, 0x0B, 0xF0, 0x15, 0xF0, 0x25, 0xF0, 0x10, 0x07, 0xF5, 0xF0, 0x45, 0xF0,
+	0x07, 0xE5, 0xF0, 0x65, 0xE0, 0x07, 0xE4, 0xF0, 0x84, 0xE0, 0x87, 0x01, 0xD4, 0xF0, 0xA4, 0xD0,
+	0x07, 0xD3, 0xF0, 0xC3, 0xD0, 0x87, 0x01, 0xC4, 0xF0, 0xC4, 0xC0, 0x07, 0xC3, 0xF0, 0xE3, 0xC0,
+	0x07, 0x78, 0xF0, 0xE8, 0x70, 0x07, 0x5A, 0xF0, 0xEA, 0x50, 0x07, 0x4B, 0xF0, 0xEB, 0x40, 0x09,
+	0x3A, 0xF0, 0xF0, 0x3A, 0x30, 0x09, 0x26, 0xF0, 0xF0, 0xD6, 0x20, 0x0B, 0x15, 0xF0, 0xF0, 0xF0,
+	0x25, 0x10, 0x8B, 0x01, 0x14, 0xF0, 0xF0, 0xF0, 0x44, 0x10, 0x8A, 0x05, 0x04, 0xF0, 0xF0, 0xF0,
+	0x64, 0x8B, 0x01, 0x14, 0xF0, 0xF0, 0xF0, 0x44, 0x10, 0x0B, 0x24, 0xF0, 0xF0, 0xF0, 0x24, 0x20,
+	0x09, 0x26, 0xF0, 0xF0, 0xD6, 0x20, 0x09, 0x3F, 0x0F, 0x0F, 0x08, 0x30, 0x09, 0x4F, 0x0F, 0x0F,
+	0x06, 0x40, 0x09, 0x6F, 0x0F, 0x0F, 0x02, 0x60, 0x07, 0x8F, 0x0F, 0x0D, 0x80, 0x87, 0x0A, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x05, 0xF0, 0xD3, 0xF0, 0xD0, 0x07,
+	0xD1, 0xE3, 0xE1, 0xD0, 0x07, 0xC3, 0xF0, 0xE3, 0xC0, 0x07, 0xB5, 0xF0, 0xC5, 0xB0, 0x07, 0xC5,
+	0xF0, 0xA5, 0xC0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07, 0xE4, 0x87, 0x84, 0xE0, 0x07, 0xF2, 0x6D,
+	0x62, 0xF0, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x09, 0xF0, 0x56,
+	0x76, 0xF0, 0x50, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09,
+	0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x8B, 0x01, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x8B, 0x01, 0xF0,
+	0x14, 0xF0, 0x44, 0xF0, 0x10, 0x8B, 0x02, 0x57, 0x44, 0xF0, 0x44, 0x47, 0x50, 0x8B, 0x01, 0xF0,
+	0x14, 0xF0, 0x44, 0xF0, 0x10, 0x8B, 0x01, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x20, 0x09, 0xF0, 0x25,
+	0xF5, 0xF0, 0x20, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x45, 0xB5, 0xF0, 0x40, 0x09,
+	0xF0, 0x56, 0x76, 0xF0, 0x50, 0x09, 0xF0, 0x6F, 0x02, 0xF0, 0x60, 0x07, 0xF0, 0x7F, 0xF0, 0x70,
+	0x07, 0xF2, 0x6D, 0x62, 0xF0, 0x07, 0xE4, 0x86, 0x94, 0xE0, 0x07, 0xD5, 0xF0, 0x85, 0xD0, 0x07,
+	0xC5, 0xF0, 0xA5, 0xC0, 0x07, 0xC4, 0xF0, 0xC4, 0xC0, 0x07, 0xC3, 0xF0, 0xE3, 0xC0, 0x87, 0x06,
+	0xF0, 0xD3, 0xF0, 0xD0, 0x87, 0x04, 0xF0, 0xF0, 0xF0, 0xE0, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x07, 0xF0, 0xC5, 0xF0, 0xC0, 0x07, 0xF0, 0x9B, 0xF0, 0x90, 0x07, 0xF0, 0x7F, 0xF0, 0x70, 0x09,
+	0xF0, 0x5F, 0x04, 0xF0, 0x50, 0x09, 0xF0, 0x47, 0x77, 0xF0, 0x40, 0x09, 0xF0, 0x36, 0xB6, 0xF0,
+	0x30, 0x09, 0xF0, 0x35, 0xD5, 0xF0, 0x30, 0x09, 0xF0, 0x25, 0xF5, 0xF0, 0x20, 0x0B, 0xF0, 0x24,
+	0xF0, 0x24, 0xF0, 0x20, 0x0B, 0xF0, 0x14, 0xF0, 0x44, 0xF0, 0x10, 0x0B, 0xF0, 0x13, 0xF0, 0x63,
+	0xF0, 0x10, 0x87, 0x02, 0xF4, 0xF0, 0x64, 0xF0, 0x07, 0xB8, 0xF0, 0x68, 0xB0, 0x07, 0x9A, 0xF0,
+	0x6A, 0x90, 0x07, 0x7B, 0xF0, 0x7C, 0x70, 0x07, 0x6C, 0xF0, 0x8C, 0x60, 0x09, 0x56, 0xF0, 0xF0,
+	0x76, 0x50, 0x09, 0x55, 0xF0, 0xF0, 0x95, 0x50, 0x09, 0x54, 0xF0, 0xF0, 0xB4, 0x50, 0x89, 0x01,
+	0x44, 0xF0, 0xF0, 0xD4, 0x40, 0x89, 0x02, 0x43, 0xF0, 0xF0, 0xF3, 0x40, 0x89, 0x01, 0x44, 0xF0,
+	0xF0, 0xD4, 0x40, 0x09, 0x54, 0xF0, 0xF0, 0xB4, 0x50, 0x09, 0x55, 0xF0, 0xF0, 0x95, 0x50, 0x09,
+	0x65, 0xF0, 0xF0, 0x75, 0x60, 0x09, 0x6F, 0x0F, 0x0F, 0x02, 0x60, 0x07, 0x7F, 0x0F, 0x0F, 0x70,
+	0x07, 0x9F, 0x0F, 0x0B, 0x90, 0x07, 0xBF, 0x0F, 0x07, 0xB0, 0x07, 0xE4, 0x95, 0x94, 0xE0, 0x07,
+	0xD5, 0x94, 0x95, 0xE0, 0x07, 0xD4, 0x95, 0x94, 0xF0, 0x07, 0xC4, 0xA4, 0x95, 0xF0, 0x09, 0xC4,
+	0x94, 0x95, 0xF0, 0x10, 0x09, 0xB4, 0x95, 0x94, 0xF0, 0x20, 0x09, 0xA5, 0x94, 0x95, 0xF0, 0x20,
+	0x09, 0xA4, 0x95, 0x94, 0xF0, 0x30, 0x09, 0xA4, 0xA3, 0xA3, 0xF0, 0x40, 0x09, 0xB1, 0xD1, 0xC2,
+	0xF0, 0x40, 0x87, 0x06, 0xF0, 0xF0, 0xF0, 0xE0,
+};
+
+const uint16_t icon59_rle_offsets[] = {
+	0, 91, 204, 317, 430, 543, 736, 894, 1049, 1190, 1313, 1519,
+	1557, 1648, 1798, 2010, 2296, 2587, 2724, 2976, 3212, 3421, 3644, 3787,
+	3930, 4197, 4262, 4477, 4738, 4998, 5260, 5522, 5711, 5942, 6198, 6331,
+	6499, 6777, 6940, 7073, 7236, 7474, 7689, 7926, 8187, 8403, 8685, 8925,
+	9120, 9375, 9609, 9905, 10161, 10403, 10682, 10938, 11211, 11440, 11762, 11971,
+	12159, 12460, 12643, 12842,
+};
+
+/**
+ * @brief 89x89 pixels run-length compressed icons array.
+ */
+const uint8_t icon89_rle_data[] = {
+	0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B,
+	0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F,
+	0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F,
+	0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0,
+	0xF0, 0xF0, 0x96, 0xF0, 0x0B, 0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0,
+	0xA6, 0xF0, 0x8B, 0x04, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xBB,
+	0x90, 0x8B, 0x01, 0x76, 0xF0, 0xF0, 0xF0, 0xBC, 0x80, 0x8B, 0x14, 0x76, 0xF0, 0xF0, 0xF0, 0xBD,
+	0x70, 0x8B, 0x01, 0x76, 0xF0, 0xF0, 0xF0, 0xBC, 0x80, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xBA, 0xA0,
+	0x8B, 0x04, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B,
+	0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D, 0x87, 0xF0,
+	0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x9F, 0x0F,
+	0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B, 0xBF, 0x0F,
+	0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F, 0x0F, 0x06,
+	0xF0, 0x80, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50,
+	0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0D,
+	0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D,
+	0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0B, 0x85,
+	0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0,
+	0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0x86, 0xF0, 0xF0, 0xC5, 0xF0, 0x0B, 0x76, 0x79, 0xF0, 0xF0, 0xA5,
+	0xF0, 0x0B, 0x76, 0x6A, 0xF0, 0xF0, 0xA5, 0xF0, 0x0B, 0x76, 0x6B, 0xF0, 0xF0, 0x95, 0xF0, 0x0B,
+	0x76, 0x6B, 0xF0, 0xF0, 0x9B, 0x90, 0x8B, 0x01, 0x76, 0x6B, 0xF0, 0xF0, 0x9C, 0x80, 0x8B, 0x14,
+	0x76, 0x6B, 0xF0, 0xF0, 0x9D, 0x70, 0x8B, 0x01, 0x76, 0x6B, 0xF0, 0xF0, 0x9C, 0x80, 0x0B, 0x76,
+	0x6B, 0xF0, 0xF0, 0x9A, 0xA0, 0x0B, 0x76, 0x6B, 0xF0, 0xF0, 0x95, 0xF0, 0x0B, 0x76, 0x6A, 0xF0,
+	0xF0, 0xA5, 0xF0, 0x0B, 0x76, 0x79, 0xF0, 0xF0, 0xA5, 0xF0, 0x0B, 0x76, 0x86, 0xF0, 0xF0, 0xC5,
+	0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B,
+	0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D, 0x87, 0xF0,
+	0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x9F, 0x0F,
+	0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B, 0xBF, 0x0F,
+	0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F, 0x0F, 0x06,
+	0xF0, 0x80, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50,
+	0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0D,
+	0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D,
+	0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0B, 0x85,
+	0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0,
+	0xF0, 0xB5, 0xF0, 0x0D, 0x76, 0x8F, 0x02, 0xF0, 0xF0, 0x15, 0xF0, 0x0B, 0x76, 0x7F, 0x05, 0xF0,
+	0xE5, 0xF0, 0x0B, 0x76, 0x6F, 0x06, 0xF0, 0xE5, 0xF0, 0x0B, 0x76, 0x6F, 0x07, 0xF0, 0xD5, 0xF0,
+	0x0B, 0x76, 0x6F, 0x07, 0xF0, 0xDB, 0x90, 0x8B, 0x01, 0x76, 0x6F, 0x07, 0xF0, 0xDC, 0x80, 0x8B,
+	0x14, 0x76, 0x6F, 0x07, 0xF0, 0xDD, 0x70, 0x8B, 0x01, 0x76, 0x6F, 0x07, 0xF0, 0xDC, 0x80, 0x0B,
+	0x76, 0x6F, 0x07, 0xF0, 0xDA, 0xA0, 0x0B, 0x76, 0x6F, 0x07, 0xF0, 0xD5, 0xF0, 0x0B, 0x76, 0x6F,
+	0x06, 0xF0, 0xE5, 0xF0, 0x0B, 0x76, 0x7F, 0x05, 0xF0, 0xE5, 0xF0, 0x0D, 0x76, 0x8F, 0x02, 0xF0,
+	0xF0, 0x15, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6,
+	0xF0, 0x0B, 0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D,
+	0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D,
+	0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B,
+	0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F,
+	0x0F, 0x06, 0xF0, 0x80, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0F, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B,
+	0xF0, 0x50, 0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0,
+	0x30, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0,
+	0x10, 0x0D, 0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0,
+	0x0B, 0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76,
+	0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0x8F, 0x0B, 0xF0, 0x75, 0xF0, 0x0B, 0x76, 0x7F, 0x0E,
+	0xF0, 0x55, 0xF0, 0x8D, 0x01, 0x76, 0x6F, 0x0F, 0x01, 0xF0, 0x45, 0xF0, 0x0D, 0x76, 0x6F, 0x0F,
+	0x01, 0xF0, 0x4B, 0x90, 0x8D, 0x01, 0x76, 0x6F, 0x0F, 0x01, 0xF0, 0x4C, 0x80, 0x8D, 0x14, 0x76,
+	0x6F, 0x0F, 0x01, 0xF0, 0x4D, 0x70, 0x8D, 0x01, 0x76, 0x6F, 0x0F, 0x01, 0xF0, 0x4C, 0x80, 0x0D,
+	0x76, 0x6F, 0x0F, 0x01, 0xF0, 0x4A, 0xA0, 0x8D, 0x01, 0x76, 0x6F, 0x0F, 0x01, 0xF0, 0x45, 0xF0,
+	0x0B, 0x76, 0x7F, 0x0E, 0xF0, 0x55, 0xF0, 0x0B, 0x76, 0x8F, 0x0B, 0xF0, 0x75, 0xF0, 0x0B, 0x76,
+	0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x85, 0xF0, 0xF0,
+	0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D, 0x87, 0xF0, 0xF0, 0xF0, 0x67,
+	0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x03,
+	0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0,
+	0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x8B,
+	0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xBF, 0x0F,
+	0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0D, 0x9F, 0x0F, 0x0F,
+	0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x87, 0xF0, 0xF0,
+	0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0B, 0x85, 0xF0, 0xF0, 0xF0,
+	0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0,
+	0x0B, 0x76, 0x8F, 0x0F, 0x09, 0x95, 0xF0, 0x0B, 0x76, 0x7F, 0x0F, 0x0C, 0x75, 0xF0, 0x8B, 0x01,
+	0x76, 0x6F, 0x0F, 0x0E, 0x65, 0xF0, 0x0B, 0x76, 0x6F, 0x0F, 0x0E, 0x6B, 0x90, 0x8B, 0x01, 0x76,
+	0x6F, 0x0F, 0x0E, 0x6C, 0x80, 0x8B, 0x14, 0x76, 0x6F, 0x0F, 0x0E, 0x6D, 0x70, 0x8B, 0x01, 0x76,
+	0x6F, 0x0F, 0x0E, 0x6C, 0x80, 0x0B, 0x76, 0x6F, 0x0F, 0x0E, 0x6A, 0xA0, 0x8B, 0x01, 0x76, 0x6F,
+	0x0F, 0x0E, 0x65, 0xF0, 0x0B, 0x76, 0x7F, 0x0F, 0x0C, 0x75, 0xF0, 0x0B, 0x76, 0x8F, 0x0F, 0x09,
+	0x95, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0,
+	0x0B, 0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D, 0x87,
+	0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D, 0x9F,
+	0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B, 0xBF,
+	0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F, 0x0F,
+	0x06, 0xF0, 0x80, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x0B, 0xFF, 0x0F, 0x0F, 0x06, 0xF0, 0x80, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0,
+	0x50, 0x0B, 0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30,
+	0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10,
+	0x0D, 0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0B,
+	0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x8B, 0x04, 0x76,
+	0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xBB, 0x90, 0x0B, 0x76, 0xF0, 0xF0,
+	0xF0, 0xBC, 0x80, 0x0B, 0x76, 0xF0, 0xA1, 0xF0, 0xFC, 0x80, 0x0B, 0x76, 0xF0, 0x93, 0xF0, 0xED,
+	0x70, 0x0B, 0x76, 0xF0, 0x95, 0xF0, 0xCD, 0x70, 0x0B, 0x76, 0xF0, 0x96, 0xF0, 0xBD, 0x70, 0x0B,
+	0x76, 0xF0, 0x98, 0xF0, 0x9D, 0x70, 0x0B, 0x76, 0xF0, 0x99, 0xF0, 0x8D, 0x70, 0x0B, 0x76, 0xF0,
+	0x9B, 0xF0, 0x6D, 0x70, 0x0B, 0x76, 0xF0, 0x9C, 0xF0, 0x5D, 0x70, 0x0B, 0x76, 0xB4, 0x9E, 0xF0,
+	0x3D, 0x70, 0x0B, 0x76, 0xB7, 0x6F, 0xF0, 0x2D, 0x70, 0x0B, 0x76, 0xC9, 0x3F, 0x02, 0xFD, 0x70,
+	0x09, 0x76, 0xEF, 0x0D, 0xED, 0x70, 0x0B, 0x76, 0xFF, 0x02, 0x38, 0xDD, 0x70, 0x0D, 0x76, 0xF0,
+	0x1F, 0x01, 0x66, 0xCD, 0x70, 0x0B, 0x76, 0xF0, 0x3E, 0x93, 0xCD, 0x70, 0x0B, 0x76, 0xF0, 0x4D,
+	0xF0, 0x9D, 0x70, 0x0B, 0x76, 0xF0, 0x6B, 0xF0, 0x9D, 0x70, 0x0B, 0x76, 0xF0, 0x7A, 0xF0, 0x9D,
+	0x70, 0x0B, 0x76, 0xF0, 0x98, 0xF0, 0x9D, 0x70, 0x0B, 0x76, 0xF0, 0xA7, 0xF0, 0x9D, 0x70, 0x0B,
+	0x76, 0xF0, 0xC5, 0xF0, 0x9D, 0x70, 0x0B, 0x76, 0xF0, 0xD3, 0xF0, 0xAD, 0x70, 0x0B, 0x76, 0xF0,
+	0xF1, 0xF0, 0xAC, 0x80, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xBC, 0x80, 0x0B, 0x76, 0xF0, 0xF0, 0xF0,
+	0xBA, 0xA0, 0x8B, 0x04, 0x76, 0xF0, 0xF0, 0xF0, 0xB5, 0xF0, 0x0B, 0x76, 0xF0, 0xF0, 0xF0, 0xA6,
+	0xF0, 0x0B, 0x85, 0xF0, 0xF0, 0xF0, 0xA6, 0xF0, 0x0B, 0x86, 0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0x0D,
+	0x87, 0xF0, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0x10, 0x0D,
+	0x9F, 0x0F, 0x0F, 0x0F, 0x03, 0xF0, 0x20, 0x0D, 0xAF, 0x0F, 0x0F, 0x0F, 0x01, 0xF0, 0x30, 0x0B,
+	0xBF, 0x0F, 0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xDF, 0x0F, 0x0F, 0x0B, 0xF0, 0x50, 0x0B, 0xFF, 0x0F,
+	0x0F, 0x06, 0xF0, 0x80, 0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0A, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x65, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x49, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x2D, 0xE0, 0x8B, 0x01, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x1F, 0xD0, 0x0B, 0xF0, 0xF0, 0xF0, 0xFF, 0x02, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF6, 0x56,
+	0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF5, 0x76, 0xB0, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xE6, 0x76, 0xB0,
+	0x0B, 0xF0, 0xF0, 0xB7, 0xB6, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x9B, 0x96, 0x76, 0xB0, 0x0B, 0xF0,
+	0xF0, 0x8D, 0x86, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0x76, 0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x6F,
+	0x02, 0x66, 0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0x66, 0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x66,
+	0x56, 0x66, 0x76, 0xB0, 0x8D, 0x0A, 0xF0, 0xF0, 0x56, 0x76, 0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x35,
+	0xC6, 0x76, 0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x19, 0xA6, 0x76, 0x56, 0x76, 0xB0, 0x0B, 0xEC, 0x96,
+	0x76, 0x56, 0x76, 0xB0, 0x0B, 0xDE, 0x86, 0x76, 0x56, 0x76, 0xB0, 0x0B, 0xDF, 0x76, 0x76, 0x56,
+	0x76, 0xB0, 0x0D, 0xCF, 0x02, 0x66, 0x76, 0x56, 0x76, 0xB0, 0x0D, 0xC6, 0x47, 0x66, 0x76, 0x56,
+	0x76, 0xB0, 0x0D, 0xB6, 0x66, 0x66, 0x76, 0x56, 0x76, 0xB0, 0x8D, 0x11, 0xB6, 0x76, 0x56, 0x76,
+	0x56, 0x76, 0xB0, 0x0D, 0xB6, 0x66, 0x76, 0x56, 0x76, 0x66, 0xB0, 0x0D, 0xC7, 0x37, 0x77, 0x37,
+	0x77, 0x37, 0xC0, 0x0D, 0xCF, 0x02, 0x7F, 0x02, 0x7F, 0x02, 0xC0, 0x07, 0xDF, 0x9F, 0x9F, 0xD0,
+	0x07, 0xED, 0xBD, 0xBD, 0xE0, 0x07, 0xFB, 0xDB, 0xDB, 0xF0, 0x0B, 0xF0, 0x19, 0xF9, 0xF9, 0xF0,
+	0x10, 0x0F, 0xF0, 0x42, 0xF0, 0x73, 0xF0, 0x72, 0xF0, 0x40, 0x8B, 0x06, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x65,
+	0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x49, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x2D,
+	0xE0, 0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0xD0, 0x0B, 0xF0, 0xF0, 0xF0, 0xFF, 0x02, 0xC0,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xF6, 0x56, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF5, 0x76, 0xB0, 0x8B, 0x0A,
+	0xF0, 0xF0, 0xF0, 0xE6, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0xB7, 0xB6, 0x76, 0xB0, 0x0B, 0xF0, 0xF0,
+	0x9B, 0x96, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x8D, 0x86, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0x76,
+	0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0x66, 0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0x66,
+	0x76, 0xB0, 0x0D, 0xF0, 0xF0, 0x66, 0x56, 0x66, 0x76, 0xB0, 0x8D, 0x0A, 0xF0, 0xF0, 0x56, 0x76,
+	0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x35, 0xC6, 0x76, 0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x19, 0xA6, 0x76,
+	0x56, 0x76, 0xB0, 0x0B, 0xEC, 0x96, 0x76, 0x56, 0x76, 0xB0, 0x0B, 0xDE, 0x86, 0x76, 0x56, 0x76,
+	0xB0, 0x0B, 0xDF, 0x76, 0x76, 0x56, 0x76, 0xB0, 0x8D, 0x01, 0xCF, 0x02, 0x66, 0x76, 0x56, 0x76,
+	0xB0, 0x0D, 0xBF, 0x03, 0x66, 0x76, 0x56, 0x76, 0xB0, 0x8D, 0x11, 0xBF, 0x04, 0x56, 0x76, 0x56,
+	0x76, 0xB0, 0x0D, 0xBF, 0x03, 0x76, 0x56, 0x76, 0x66, 0xB0, 0x0D, 0xCF, 0x02, 0x77, 0x37, 0x77,
+	0x37, 0xC0, 0x0D, 0xCF, 0x02, 0x7F, 0x02, 0x7F, 0x02, 0xC0, 0x07, 0xDF, 0x9F, 0x9F, 0xD0, 0x07,
+	0xED, 0xBD, 0xBD, 0xE0, 0x07, 0xFB, 0xDB, 0xDB, 0xF0, 0x0B, 0xF0, 0x19, 0xF9, 0xF9, 0xF0, 0x10,
+	0x0F, 0xF0, 0x42, 0xF0, 0x73, 0xF0, 0x72, 0xF0, 0x40, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x65, 0xF0,
+	0x30, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x49, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x2D, 0xE0,
+	0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0xD0, 0x0B, 0xF0, 0xF0, 0xF0, 0xFF, 0x02, 0xC0, 0x0B,
+	0xF0, 0xF0, 0xF0, 0xF6, 0x56, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF5, 0x76, 0xB0, 0x8B, 0x0A, 0xF0,
+	0xF0, 0xF0, 0xE6, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0xB7, 0xB6, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x9B,
+	0x96, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x8D, 0x86, 0x76, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0x76, 0x76,
+	0xB0, 0x8D, 0x02, 0xF0, 0xF0, 0x6F, 0x02, 0x66, 0x76, 0xB0, 0x8D, 0x0A, 0xF0, 0xF0, 0x5F, 0x04,
+	0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x35, 0xCF, 0x04, 0x56, 0x76, 0xB0, 0x0D, 0xF0, 0x19, 0xAF, 0x04,
+	0x56, 0x76, 0xB0, 0x0B, 0xEC, 0x9F, 0x04, 0x56, 0x76, 0xB0, 0x0B, 0xDE, 0x8F, 0x04, 0x56, 0x76,
+	0xB0, 0x0B, 0xDF, 0x7F, 0x04, 0x56, 0x76, 0xB0, 0x8D, 0x01, 0xCF, 0x02, 0x6F, 0x04, 0x56, 0x76,
+	0xB0, 0x0D, 0xBF, 0x03, 0x6F, 0x04, 0x56, 0x76, 0xB0, 0x8D, 0x11, 0xBF, 0x04, 0x5F, 0x04, 0x56,
+	0x76, 0xB0, 0x0D, 0xBF, 0x03, 0x7F, 0x02, 0x76, 0x66, 0xB0, 0x0D, 0xCF, 0x02, 0x7F, 0x02, 0x77,
+	0x37, 0xC0, 0x0D, 0xCF, 0x02, 0x7F, 0x02, 0x7F, 0x02, 0xC0, 0x07, 0xDF, 0x9F, 0x9F, 0xD0, 0x07,
+	0xED, 0xBD, 0xBD, 0xE0, 0x07, 0xFB, 0xDB, 0xDB, 0xF0, 0x0B, 0xF0, 0x19, 0xF9, 0xF9, 0xF0, 0x10,
+	0x0F, 0xF0, 0x42, 0xF0, 0x73, 0xF0, 0x72, 0xF0, 0x40, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x65, 0xF0,
+	0x30, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x49, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x2D, 0xE0,
+	0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0xD0, 0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0xFF, 0x02, 0xC0,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xFF, 0x03, 0xB0, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xEF, 0x04, 0xB0, 0x0B,
+	0xF0, 0xF0, 0xB7, 0xBF, 0x04, 0xB0, 0x0B, 0xF0, 0xF0, 0x9B, 0x9F, 0x04, 0xB0, 0x0B, 0xF0, 0xF0,
+	0x8D, 0x8F, 0x04, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0x7F, 0x04, 0xB0, 0x8D, 0x02, 0xF0, 0xF0, 0x6F,
+	0x02, 0x6F, 0x04, 0xB0, 0x8D, 0x0A, 0xF0, 0xF0, 0x5F, 0x04, 0x5F, 0x04, 0xB0, 0x0D, 0xF0, 0x35,
+	0xCF, 0x04, 0x5F, 0x04, 0xB0, 0x0D, 0xF0, 0x19, 0xAF, 0x04, 0x5F, 0x04, 0xB0, 0x0B, 0xEC, 0x9F,
+	0x04, 0x5F, 0x04, 0xB0, 0x0B, 0xDE, 0x8F, 0x04, 0x5F, 0x04, 0xB0, 0x0B, 0xDF, 0x7F, 0x04, 0x5F,
+	0x04, 0xB0, 0x8D, 0x01, 0xCF, 0x02, 0x6F, 0x04, 0x5F, 0x04, 0xB0, 0x0D, 0xBF, 0x03, 0x6F, 0x04,
+	0x5F, 0x04, 0xB0, 0x8D, 0x11, 0xBF, 0x04, 0x5F, 0x04, 0x5F, 0x04, 0xB0, 0x0D, 0xBF, 0x03, 0x7F,
+	0x02, 0x7F, 0x03, 0xB0, 0x8D, 0x01, 0xCF, 0x02, 0x7F, 0x02, 0x7F, 0x02, 0xC0, 0x07, 0xDF, 0x9F,
+	0x9F, 0xD0, 0x07, 0xED, 0xBD, 0xBD, 0xE0, 0x07, 0xFB, 0xDB, 0xDB, 0xF0, 0x0B, 0xF0, 0x19, 0xF9,
+	0xF9, 0xF0, 0x10, 0x0F, 0xF0, 0x42, 0xF0, 0x73, 0xF0, 0x72, 0xF0, 0x40, 0x8B, 0x07, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3,
+	0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0,
+	0xA0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80,
+	0x0D, 0xF0, 0xF0, 0x77, 0x17, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x76, 0x36, 0xF0, 0xF0, 0x70,
+	0x0D, 0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x66, 0x56, 0xF0, 0xF0, 0x60,
+	0x0D, 0xF0, 0xF0, 0x57, 0x57, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x56, 0x76, 0xF0, 0xF0, 0x50,
+	0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x46, 0x96, 0xF0, 0xF0, 0x40,
+	0x0D, 0xF0, 0xF0, 0x37, 0x97, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30,
+	0x0D, 0xF0, 0xF0, 0x27, 0xB7, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x26, 0xD6, 0xF0, 0xF0, 0x20,
+	0x0D, 0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x16, 0xF6, 0xF0, 0xF0, 0x10,
+	0x09, 0xF0, 0xF7, 0xF7, 0xF0, 0xF0, 0x0B, 0xF0, 0xF6, 0xF0, 0x26, 0xF0, 0xF0, 0x0B, 0xF0, 0xE7,
+	0xF0, 0x27, 0xF0, 0xE0, 0x0B, 0xF0, 0xE6, 0xF0, 0x46, 0xF0, 0xE0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47,
+	0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xC6, 0xF0, 0x86, 0xF0, 0xC0, 0x8B, 0x01, 0xF0, 0xB6, 0xF0, 0xA6, 0xF0, 0xB0, 0x8B,
+	0x01, 0xF0, 0xA6, 0xF0, 0xC6, 0xF0, 0xA0, 0x8B, 0x01, 0xF0, 0x96, 0xF0, 0xE6, 0xF0, 0x90, 0x8D,
+	0x01, 0xF0, 0x86, 0xF0, 0xF0, 0x16, 0xF0, 0x80, 0x8D, 0x01, 0xF0, 0x76, 0xF0, 0xF0, 0x36, 0xF0,
+	0x70, 0x8D, 0x01, 0xF0, 0x66, 0xF0, 0xF0, 0x56, 0xF0, 0x60, 0x8D, 0x01, 0xF0, 0x56, 0xF0, 0xF0,
+	0x76, 0xF0, 0x50, 0x8D, 0x01, 0xF0, 0x46, 0xF0, 0xF0, 0x96, 0xF0, 0x40, 0x8D, 0x01, 0xF0, 0x36,
+	0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x8D, 0x01, 0xF0, 0x26, 0xF0, 0xF0, 0xD6, 0xF0, 0x20, 0x8D, 0x01,
+	0xF0, 0x16, 0xF0, 0xF0, 0xF6, 0xF0, 0x10, 0x0B, 0xF6, 0xF0, 0x73, 0xF0, 0x76, 0xF0, 0x0B, 0xF6,
+	0xF0, 0x49, 0xF0, 0x46, 0xF0, 0x0B, 0xE6, 0xF0, 0x2F, 0xF0, 0x26, 0xE0, 0x09, 0xE6, 0xEF, 0x06,
+	0xE6, 0xE0, 0x09, 0xD6, 0xBF, 0x0E, 0xB6, 0xD0, 0x0B, 0xD6, 0x8F, 0x0F, 0x05, 0x86, 0xD0, 0x0D,
+	0xD6, 0x5F, 0x04, 0x3F, 0x04, 0x56, 0xD0, 0x09, 0xDF, 0x0C, 0x9F, 0x0C, 0xD0, 0x0B, 0xDF, 0x08,
+	0xF0, 0x2F, 0x08, 0xD0, 0x0B, 0xEF, 0x04, 0xF0, 0x8F, 0x04, 0xE0, 0x09, 0xEF, 0x01, 0xF0, 0xEF,
+	0xF0, 0x0B, 0xFB, 0xF0, 0xF0, 0x7A, 0xF0, 0x10, 0x0D, 0xF0, 0x26, 0xF0, 0xF0, 0xD6, 0xF0, 0x20,
+	0x8B, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0,
+	0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B, 0x04, 0xF0,
+	0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0,
+	0xF0, 0xC0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x2C, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70,
+	0x0D, 0xF0, 0xF0, 0x4F, 0x05, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x2F, 0x09, 0xF0, 0xF0, 0x30,
+	0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xEF, 0x0F, 0xF0, 0xF0, 0x09, 0xF0,
+	0xDB, 0xAB, 0xF0, 0xE0, 0x0B, 0xF0, 0xC9, 0xF0, 0x19, 0xF0, 0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0x48,
+	0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0xF0, 0x77, 0xF0, 0xC0, 0x0B, 0xF0, 0xC5, 0xF0, 0x96, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xD3, 0xF0, 0xC3, 0xF0, 0xD0, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B, 0x04, 0xF0, 0xF0,
+	0x7F, 0xF0, 0xF0, 0x70, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x9B,
+	0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0,
+	0xC0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x1C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x0D, 0xF0, 0xF0, 0x6F, 0x01, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x2F, 0x09, 0xF0, 0xF0,
+	0x30, 0x09, 0xF0, 0xEF, 0x0F, 0xF0, 0xF0, 0x0B, 0xF0, 0xCF, 0x0F, 0x04, 0xF0, 0xD0, 0x0B, 0xF0,
+	0xAF, 0x0F, 0x08, 0xF0, 0xB0, 0x0D, 0xF0, 0x8F, 0x02, 0x8F, 0x02, 0xF0, 0x90, 0x0B, 0xF0, 0x7D,
+	0xF0, 0x3E, 0xF0, 0x70, 0x0B, 0xF0, 0x5C, 0xF0, 0x9C, 0xF0, 0x60, 0x0B, 0xF0, 0x4B, 0xF0, 0xEA,
+	0xF0, 0x50, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x4A, 0xF0, 0x30, 0x0D, 0xF0, 0x29, 0xF0, 0xF0, 0x79,
+	0xF0, 0x20, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xA9, 0xF0, 0x10, 0x0B, 0xF8, 0xF0, 0xF0, 0xC8, 0xF0,
+	0x10, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0D, 0xF6, 0xF0, 0xF0, 0xF0, 0x25, 0xF0, 0x10, 0x0F,
+	0xF0, 0x13, 0xF0, 0xF0, 0xF0, 0x54, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x4F, 0x05, 0xF0, 0xF0, 0x50, 0x0D, 0xF0,
+	0xF0, 0x2F, 0x09, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0,
+	0xEF, 0x0F, 0xF0, 0xF0, 0x09, 0xF0, 0xDB, 0xAB, 0xF0, 0xE0, 0x0B, 0xF0, 0xC9, 0xF0, 0x19, 0xF0,
+	0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0xF0, 0x77, 0xF0, 0xC0, 0x0B,
+	0xF0, 0xC5, 0xF0, 0x96, 0xF0, 0xC0, 0x0B, 0xF0, 0xD3, 0xF0, 0xC3, 0xF0, 0xD0, 0x8B, 0x04, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xA9,
+	0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0,
+	0xF0, 0x80, 0x8B, 0x04, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x8B, 0x01, 0xF0, 0xF0, 0x8D, 0xF0,
+	0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0,
+	0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x8C, 0xF0, 0xF0, 0x90, 0x0D, 0xF0,
+	0xF0, 0x2F, 0x09, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xDF, 0x0F, 0x02, 0xF0, 0xE0, 0x0B, 0xF0, 0xAF,
+	0x0F, 0x08, 0xF0, 0xB0, 0x0B, 0xF0, 0x7F, 0x0F, 0x0E, 0xF0, 0x80, 0x0D, 0xF0, 0x5F, 0x0F, 0x0F,
+	0x03, 0xF0, 0x60, 0x0F, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x40, 0x0B, 0xF0, 0x1F, 0xF0,
+	0xBF, 0xF0, 0x20, 0x09, 0xFD, 0xF0, 0xF0, 0x3D, 0xF0, 0x09, 0xDC, 0xF0, 0xF0, 0x8C, 0xE0, 0x09,
+	0xBC, 0xF0, 0xF0, 0xDB, 0xC0, 0x0B, 0xAA, 0xF0, 0xF0, 0xF0, 0x3A, 0xB0, 0x0B, 0x9A, 0xF0, 0xF0,
+	0xF0, 0x6A, 0x90, 0x0B, 0x89, 0xF0, 0xF0, 0xF0, 0x9A, 0x80, 0x0B, 0x69, 0xF0, 0xF0, 0xF0, 0xD9,
+	0x70, 0x0B, 0x59, 0xF0, 0xF0, 0xF0, 0xF9, 0x60, 0x0D, 0x49, 0xF0, 0xF0, 0xF0, 0xF0, 0x38, 0x50,
+	0x0D, 0x38, 0xF0, 0xAF, 0x01, 0xF0, 0xA8, 0x40, 0x0D, 0x37, 0xF0, 0x7F, 0x09, 0xF0, 0x77, 0x40,
+	0x0D, 0x36, 0xF0, 0x5F, 0x0F, 0xF0, 0x56, 0x40, 0x0F, 0x44, 0xF0, 0x4F, 0x0F, 0x04, 0xF0, 0x45,
+	0x40, 0x0F, 0x52, 0xF0, 0x3F, 0x0F, 0x08, 0xF0, 0x41, 0x60, 0x0D, 0xF0, 0x8F, 0x02, 0x8F, 0x02,
+	0xF0, 0x90, 0x0B, 0xF0, 0x7D, 0xF0, 0x3E, 0xF0, 0x70, 0x0B, 0xF0, 0x5C, 0xF0, 0x9C, 0xF0, 0x60,
+	0x0B, 0xF0, 0x4B, 0xF0, 0xEA, 0xF0, 0x50, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x4A, 0xF0, 0x30, 0x0D,
+	0xF0, 0x29, 0xF0, 0xF0, 0x79, 0xF0, 0x20, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xA9, 0xF0, 0x10, 0x0B,
+	0xF8, 0xF0, 0xF0, 0xC8, 0xF0, 0x10, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0D, 0xF6, 0xF0, 0xF0,
+	0xF0, 0x25, 0xF0, 0x10, 0x0F, 0xF0, 0x13, 0xF0, 0xF0, 0xF0, 0x54, 0xF0, 0x10, 0x0B, 0xF0, 0xF0,
+	0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x4F, 0x05,
+	0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x2F, 0x09, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C,
+	0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xEF, 0x0F, 0xF0, 0xF0, 0x09, 0xF0, 0xDB, 0xAB, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xC9, 0xF0, 0x19, 0xF0, 0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7,
+	0xF0, 0x77, 0xF0, 0xC0, 0x0B, 0xF0, 0xC5, 0xF0, 0x96, 0xF0, 0xC0, 0x0B, 0xF0, 0xD3, 0xF0, 0xC3,
+	0xF0, 0xD0, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0,
+	0xC0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B,
+	0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B, 0x04, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x8B,
+	0x01, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0,
+	0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x8B, 0x0B, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x32, 0x90, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x24, 0x80, 0x0D, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x16, 0x70, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF7, 0x70, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE7, 0x80, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xD7, 0x90, 0x0B, 0xF0, 0xF0, 0x8C, 0xF0, 0x77, 0xA0,
+	0x0B, 0xF0, 0xF0, 0x2F, 0x09, 0xF7, 0xB0, 0x0B, 0xF0, 0xDF, 0x0F, 0x02, 0xA7, 0xC0, 0x0B, 0xF0,
+	0xAF, 0x0F, 0x06, 0x87, 0xD0, 0x0B, 0xF0, 0x7F, 0x0F, 0x08, 0x87, 0xE0, 0x0B, 0xF0, 0x5F, 0x0F,
+	0x09, 0x87, 0xF0, 0x0F, 0xF0, 0x3F, 0x03, 0xF0, 0x25, 0x87, 0xF0, 0x10, 0x0D, 0xF0, 0x1F, 0xF0,
+	0xF0, 0x48, 0xF0, 0x10, 0x09, 0xFD, 0xF0, 0xF0, 0x6A, 0xF0, 0x09, 0xDC, 0xF0, 0xF0, 0x8C, 0xE0,
+	0x09, 0xBC, 0xF0, 0xF0, 0x9F, 0xC0, 0x0B, 0xAB, 0xF0, 0xF0, 0xAF, 0x02, 0xB0, 0x0B, 0x9A, 0xF0,
+	0xF0, 0xB7, 0x3A, 0x90, 0x0B, 0x89, 0xF0, 0xF0, 0xC7, 0x5A, 0x80, 0x0B, 0x69, 0xF0, 0xF0, 0xD7,
+	0x89, 0x70, 0x0B, 0x59, 0xF0, 0xF0, 0xD7, 0xA9, 0x60, 0x0B, 0x49, 0xF0, 0xF0, 0xD7, 0xD8, 0x50,
+	0x0B, 0x38, 0xF0, 0xAB, 0x87, 0xF8, 0x40, 0x0D, 0x37, 0xF0, 0x7E, 0x87, 0xF0, 0x27, 0x40, 0x0F,
+	0x36, 0xF0, 0x5F, 0x01, 0x87, 0xF0, 0x46, 0x40, 0x0F, 0x44, 0xF0, 0x4F, 0x02, 0x89, 0xF0, 0x45,
+	0x40, 0x0F, 0x51, 0xF0, 0x4F, 0x03, 0x8C, 0xF0, 0x41, 0x60, 0x0B, 0xF0, 0x8F, 0x03, 0x9F, 0xF0,
+	0x90, 0x0B, 0xF0, 0x7D, 0xEF, 0x03, 0xF0, 0x70, 0x0D, 0xF0, 0x5C, 0xF0, 0x1F, 0x05, 0xF0, 0x60,
+	0x0D, 0xF0, 0x4A, 0xF0, 0x37, 0x5A, 0xF0, 0x50, 0x0D, 0xF0, 0x3A, 0xF0, 0x37, 0x8A, 0xF0, 0x30,
+	0x0D, 0xF0, 0x29, 0xF0, 0x47, 0xAA, 0xF0, 0x20, 0x0D, 0xF0, 0x18, 0xF0, 0x57, 0xD9, 0xF0, 0x10,
+	0x0B, 0xF8, 0xF0, 0x57, 0xF8, 0xF0, 0x10, 0x0B, 0xF7, 0xF0, 0x57, 0xF0, 0x37, 0xF0, 0x0D, 0xF6,
+	0xF0, 0x57, 0xF0, 0x55, 0xF0, 0x10, 0x0F, 0xF0, 0x13, 0xF0, 0x67, 0xF0, 0x74, 0xF0, 0x10, 0x0B,
+	0xF0, 0xF0, 0x98, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x8E, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0,
+	0x7F, 0x02, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x6F, 0x05, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0,
+	0x5F, 0x08, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0x4F, 0x0A, 0xF0, 0xF0, 0x0B, 0xF0, 0xF0, 0x37,
+	0x9B, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x27, 0xD9, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0, 0x17, 0xF0, 0x18,
+	0xF0, 0xC0, 0x0B, 0xF0, 0xF7, 0xF0, 0x37, 0xF0, 0xC0, 0x0B, 0xF0, 0xE7, 0xF0, 0x56, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xD7, 0xF0, 0x83, 0xF0, 0xD0, 0x0B, 0xF0, 0xC7, 0xF0, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0,
+	0xB7, 0xF0, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xA7, 0xF0, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0x97, 0xF0,
+	0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0x87, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0x77, 0xD5, 0xF0, 0xF0,
+	0xC0, 0x0B, 0xF0, 0x67, 0xC9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0x57, 0xCB, 0xF0, 0xF0, 0x90, 0x0B,
+	0xF0, 0x47, 0xCD, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0x37, 0xDD, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0x27,
+	0xDF, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0x17, 0xEF, 0xF0, 0xF0, 0x70, 0x09, 0xF7, 0xFF, 0xF0, 0xF0,
+	0x70, 0x0B, 0xE7, 0xF0, 0x1F, 0xF0, 0xF0, 0x70, 0x0B, 0xD7, 0xF0, 0x2F, 0xF0, 0xF0, 0x70, 0x0B,
+	0xC7, 0xF0, 0x4D, 0xF0, 0xF0, 0x80, 0x0B, 0xB7, 0xF0, 0x5D, 0xF0, 0xF0, 0x80, 0x0B, 0xA7, 0xF0,
+	0x7B, 0xF0, 0xF0, 0x90, 0x0B, 0x97, 0xF0, 0x99, 0xF0, 0xF0, 0xA0, 0x0B, 0x87, 0xF0, 0xC5, 0xF0,
+	0xF0, 0xC0, 0x0B, 0x77, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x10, 0x0D, 0x84, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x30, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x0D, 0xF0, 0xF0, 0x91, 0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x84, 0xF0, 0xF0, 0xF0,
+	0x20, 0x0D, 0xF0, 0xF0, 0x76, 0xF0, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0x77, 0xF0, 0xF0, 0xF0,
+	0x0B, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x7A, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0,
+	0xF0, 0x7B, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7C, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x7D,
+	0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x7E, 0xF0, 0xF0, 0x80, 0x0D, 0xF0, 0xF0, 0x76, 0x18, 0xF0,
+	0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x76, 0x28, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x76, 0x38, 0xF0,
+	0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x76, 0x48, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x76, 0x58, 0xF0,
+	0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x76, 0x69, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0x76, 0x79, 0xF0,
+	0xF0, 0x0B, 0xF0, 0xF0, 0x76, 0x89, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x76, 0xA8, 0xF0, 0xD0, 0x0B,
+	0xF0, 0xF0, 0x76, 0xB8, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x76, 0xC8, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0,
+	0x76, 0xD7, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x76, 0xC8, 0xF0, 0xB0, 0x0B, 0xF0, 0xA4, 0x86, 0xB8,
+	0xF0, 0xC0, 0x0B, 0xF0, 0x96, 0x76, 0xA8, 0xF0, 0xD0, 0x0B, 0xF0, 0x97, 0x66, 0x89, 0xF0, 0xE0,
+	0x0B, 0xF0, 0x99, 0x46, 0x79, 0xF0, 0xF0, 0x0D, 0xF0, 0xA9, 0x36, 0x69, 0xF0, 0xF0, 0x10, 0x0D,
+	0xF0, 0xB9, 0x26, 0x59, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xC9, 0x16, 0x48, 0xF0, 0xF0, 0x40, 0x0B,
+	0xF0, 0xEE, 0x29, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xFD, 0x19, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0,
+	0x1F, 0x06, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x2F, 0x04, 0xF0, 0xF0, 0x80, 0x0D, 0xF0, 0xF0,
+	0x3F, 0x01, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x5D, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x6B,
+	0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x79, 0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0x6B, 0xF0, 0xF0,
+	0xC0, 0x0B, 0xF0, 0xF0, 0x5D, 0xF0, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x3F, 0x01, 0xF0, 0xF0, 0xA0,
+	0x0D, 0xF0, 0xF0, 0x2F, 0x04, 0xF0, 0xF0, 0x80, 0x0D, 0xF0, 0xF0, 0x1F, 0x06, 0xF0, 0xF0, 0x70,
+	0x0B, 0xF0, 0xFD, 0x19, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xEE, 0x29, 0xF0, 0xF0, 0x50, 0x0D, 0xF0,
+	0xC9, 0x16, 0x48, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xB9, 0x26, 0x59, 0xF0, 0xF0, 0x20, 0x0D, 0xF0,
+	0xA9, 0x36, 0x69, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0x99, 0x46, 0x79, 0xF0, 0xF0, 0x0B, 0xF0, 0x97,
+	0x66, 0x89, 0xF0, 0xE0, 0x0B, 0xF0, 0x96, 0x76, 0xA8, 0xF0, 0xD0, 0x0B, 0xF0, 0xA4, 0x86, 0xB8,
+	0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x76, 0xC8, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x76, 0xD7, 0xF0, 0xB0,
+	0x0B, 0xF0, 0xF0, 0x76, 0xC8, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x76, 0xB8, 0xF0, 0xC0, 0x0B, 0xF0,
+	0xF0, 0x76, 0xA8, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0x76, 0x89, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x76,
+	0x79, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x76, 0x69, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x76, 0x58,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x76, 0x48, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x76, 0x38,
+	0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x76, 0x28, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x76, 0x18,
+	0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x7E, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x7D, 0xF0, 0xF0,
+	0x90, 0x0B, 0xF0, 0xF0, 0x7C, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x7B, 0xF0, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xF0, 0x7A, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x78, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0,
+	0x77, 0xF0, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x76, 0xF0, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x84,
+	0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x91, 0xF0, 0xF0, 0xF0, 0x40, 0x8B, 0x05, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x13, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0x7F, 0x07, 0x6F,
+	0x0F, 0x0F, 0x90, 0x0D, 0x6F, 0x08, 0x6F, 0x0F, 0x0F, 0x02, 0x70, 0x0D, 0x6F, 0x09, 0x5F, 0x0F,
+	0x0F, 0x03, 0x60, 0x8D, 0x01, 0x6F, 0x09, 0x5F, 0x0F, 0x0F, 0x04, 0x50, 0x0F, 0x65, 0x37, 0x36,
+	0xF0, 0xF0, 0xF0, 0x28, 0x40, 0x0F, 0x65, 0x45, 0x46, 0xF0, 0xF0, 0xF0, 0x46, 0x40, 0x8F, 0x04,
+	0x65, 0x45, 0x46, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x0F, 0x65, 0x53, 0x56, 0xF0, 0xF0, 0xF0, 0x55,
+	0x40, 0x8D, 0x04, 0x65, 0xD6, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x8D, 0x03, 0x6F, 0x09, 0xF0, 0xF0,
+	0xF0, 0x55, 0x40, 0x0D, 0x6F, 0x08, 0xF0, 0xF0, 0xF0, 0x65, 0x40, 0x0D, 0x7F, 0x06, 0xF0, 0xF0,
+	0xF0, 0x75, 0x40, 0x8B, 0x13, 0xF5, 0xF0, 0xF0, 0xF0, 0xF5, 0x40, 0x8B, 0x01, 0xF5, 0xF0, 0xF0,
+	0xF0, 0xE6, 0x40, 0x0B, 0xF5, 0x6F, 0x0F, 0x0F, 0x0E, 0x40, 0x8B, 0x01, 0xF5, 0x6F, 0x0F, 0x0F,
+	0x0D, 0x50, 0x0B, 0xF5, 0x6F, 0x0F, 0x0F, 0x0C, 0x60, 0x0B, 0xF5, 0x6F, 0x0F, 0x0F, 0x0A, 0x80,
+	0x0B, 0xF5, 0x6F, 0x0F, 0x0F, 0x08, 0xA0, 0x89, 0x08, 0xF5, 0xF6, 0xF5, 0xF0, 0xD0, 0x0B, 0xF5,
+	0x7F, 0x0F, 0x0C, 0xF0, 0x50, 0x8B, 0x02, 0xF5, 0x6F, 0x0F, 0x0E, 0xF0, 0x40, 0x0B, 0xF5, 0x7F,
+	0x0F, 0x0D, 0xF0, 0x40, 0x0D, 0xF0, 0x21, 0xAF, 0x0F, 0x0A, 0xF0, 0x60, 0x8B, 0x01, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x11, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0x7F, 0x06, 0x7F,
+	0x0F, 0x0F, 0x90, 0x0D, 0x6F, 0x08, 0x6F, 0x0F, 0x0F, 0x02, 0x70, 0x0D, 0x6F, 0x09, 0x5F, 0x0F,
+	0x0F, 0x03, 0x60, 0x8D, 0x01, 0x6F, 0x09, 0x5F, 0x0F, 0x0F, 0x04, 0x50, 0x0D, 0x6F, 0x09, 0x6F,
+	0x0F, 0x0F, 0x04, 0x40, 0x0F, 0x65, 0x45, 0x46, 0xF0, 0xF0, 0xF0, 0x46, 0x40, 0x8F, 0x04, 0x65,
+	0x45, 0x46, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x0F, 0x65, 0x53, 0x56, 0xF0, 0xF0, 0xF0, 0x55, 0x40,
+	0x8D, 0x04, 0x65, 0xD6, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x0D, 0x66, 0xC6, 0xF0, 0xF0, 0xF0, 0x55,
+	0x40, 0x8D, 0x02, 0x6F, 0x09, 0xF0, 0xF0, 0xF0, 0x55, 0x40, 0x0D, 0x6F, 0x08, 0xF0, 0xF0, 0xF0,
+	0x65, 0x40, 0x0D, 0x7F, 0x07, 0xF0, 0xF0, 0xF0, 0x65, 0x40, 0x8B, 0x07, 0xF5, 0xF0, 0xF0, 0xF0,
+	0xF5, 0x40, 0x0B, 0xF5, 0xF0, 0xF0, 0x9C, 0x95, 0x40, 0x0D, 0xF5, 0xF0, 0xF0, 0x6F, 0x03, 0x65,
+	0x40, 0x0D, 0xF5, 0xF0, 0xF0, 0x4F, 0x07, 0x63, 0x40, 0x0D, 0xF5, 0xF0, 0xF0, 0x3F, 0x09, 0x62,
+	0x40, 0x0D, 0xF5, 0xF0, 0xF0, 0x2F, 0x0B, 0x52, 0x40, 0x0B, 0xF5, 0xF0, 0xFF, 0x0E, 0x51, 0x40,
+	0x09, 0xF5, 0xF0, 0xFF, 0x0F, 0x90, 0x0B, 0xF5, 0xF0, 0xEF, 0x0F, 0x02, 0x80, 0x0B, 0xF5, 0xF0,
+	0xDF, 0x0F, 0x04, 0x70, 0x0D, 0xF5, 0xF0, 0xC7, 0x3F, 0x01, 0x36, 0x70, 0x0B, 0xF5, 0xF0, 0xC7,
+	0x4E, 0x47, 0x60, 0x0B, 0xF5, 0xF0, 0xB8, 0x5C, 0x57, 0x60, 0x0B, 0xF5, 0xF0, 0xB9, 0x5A, 0x59,
+	0x50, 0x0B, 0xF5, 0xF0, 0xBA, 0x58, 0x5A, 0x50, 0x0B, 0xF5, 0x6F, 0x4C, 0x56, 0x5C, 0x40, 0x0B,
+	0xF5, 0x6F, 0x4D, 0x54, 0x5D, 0x40, 0x0B, 0xF5, 0x6F, 0x4E, 0x52, 0x5E, 0x40, 0x09, 0xF5, 0x6F,
+	0x4F, 0xAF, 0x40, 0x0D, 0xF5, 0x6F, 0x4F, 0x01, 0x8F, 0x01, 0x40, 0x0D, 0xF5, 0x6F, 0x4F, 0x02,
+	0x6F, 0x02, 0x40, 0x0D, 0xF5, 0xF6, 0x4F, 0x02, 0x6F, 0x02, 0x40, 0x0D, 0xF5, 0xF6, 0x4F, 0x01,
+	0x8F, 0x01, 0x40, 0x09, 0xF5, 0xF6, 0x4F, 0xAF, 0x40, 0x0B, 0xF5, 0xF6, 0x4E, 0x52, 0x5E, 0x40,
+	0x0B, 0xF5, 0xF6, 0x4D, 0x54, 0x5D, 0x40, 0x0B, 0xF5, 0xF6, 0x4C, 0x56, 0x5C, 0x40, 0x0B, 0xF5,
+	0xF6, 0x5A, 0x58, 0x5A, 0x50, 0x0B, 0xF5, 0xF6, 0x59, 0x5A, 0x59, 0x50, 0x0B, 0xF5, 0xF6, 0x58,
+	0x5C, 0x57, 0x60, 0x0D, 0xF5, 0x7F, 0x01, 0x47, 0x4E, 0x47, 0x60, 0x0F, 0xF5, 0x6F, 0x02, 0x47,
+	0x3F, 0x01, 0x27, 0x70, 0x0D, 0xF5, 0x6F, 0x03, 0x4F, 0x0F, 0x04, 0x70, 0x0D, 0xF5, 0x6F, 0x03,
+	0x5F, 0x0F, 0x02, 0x80, 0x0B, 0xF5, 0x6F, 0x04, 0x5F, 0x0F, 0x90, 0x0D, 0xF0, 0x13, 0x9F, 0x03,
+	0x5F, 0x0D, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0x7F, 0x0B, 0xB0, 0x0B, 0xF0, 0xF0, 0xF0, 0x8F, 0x09,
+	0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xAF, 0x05, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xCF, 0x01, 0xF0, 0x10,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xEC, 0xF0, 0x30, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x8B, 0x01, 0xF0,
+	0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x8B, 0x01, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B, 0x01, 0xF0, 0xF0, 0x7F,
+	0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x8D, 0x02, 0xF0, 0xF0, 0x5F,
+	0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xC5,
+	0xCD, 0xF0, 0x20, 0x8B, 0x01, 0xF0, 0xF0, 0xC5, 0xBF, 0x01, 0xF0, 0x8B, 0x02, 0xF0, 0xF0, 0xC5,
+	0xAF, 0x02, 0xF0, 0x0B, 0xF0, 0x76, 0xE5, 0xA6, 0x65, 0xF0, 0x0B, 0xF0, 0x5A, 0xC5, 0xA6, 0x65,
+	0xF0, 0x0B, 0xF0, 0x4C, 0xB5, 0xA6, 0x65, 0xF0, 0x0B, 0xF0, 0x3E, 0xA5, 0xA6, 0x65, 0xF0, 0x0D,
+	0xF0, 0x2F, 0x01, 0x95, 0xA6, 0x65, 0xF0, 0x0D, 0xF0, 0x27, 0x27, 0x95, 0xAF, 0x02, 0xF0, 0x0D,
+	0xF0, 0x26, 0x46, 0x95, 0xAF, 0x02, 0xF0, 0x0D, 0xF0, 0x25, 0x65, 0x95, 0xAF, 0x02, 0xF0, 0x0D,
+	0xF0, 0x25, 0x65, 0x95, 0xBF, 0x01, 0xF0, 0x0D, 0xF0, 0x26, 0x46, 0x95, 0xBF, 0x01, 0xF0, 0x0D,
+	0xF0, 0x27, 0x36, 0x95, 0xCE, 0xF0, 0x10, 0x0F, 0xF0, 0x2F, 0x01, 0x95, 0xF0, 0x16, 0xF0, 0x50,
+	0x0D, 0xF0, 0x3E, 0xA5, 0xF0, 0x16, 0xF0, 0x50, 0x0D, 0xF0, 0x4D, 0xA5, 0xF0, 0x16, 0xF0, 0x50,
+	0x0D, 0xF0, 0x5B, 0xB5, 0xF0, 0x16, 0xF0, 0x50, 0x0D, 0xF0, 0x68, 0xD5, 0xF0, 0x15, 0xF0, 0x60,
+	0x0B, 0xF0, 0x76, 0xE5, 0xF6, 0xF0, 0x60, 0x0B, 0xF0, 0x76, 0xE5, 0xE7, 0xF0, 0x60, 0x0D, 0xF0,
+	0x76, 0xE5, 0x3F, 0x02, 0xF0, 0x70, 0x0B, 0xF0, 0x76, 0xEF, 0x0A, 0xF0, 0x70, 0x0B, 0xF0, 0x76,
+	0xEF, 0x09, 0xF0, 0x80, 0x0B, 0xF0, 0x76, 0xEF, 0x08, 0xF0, 0x90, 0x0B, 0xF0, 0x86, 0xDF, 0x07,
+	0xF0, 0xA0, 0x0B, 0xF0, 0x88, 0xBF, 0x04, 0xF0, 0xD0, 0x0D, 0xF0, 0x9F, 0x01, 0x28, 0xF0, 0xF0,
+	0x90, 0x0B, 0xF0, 0x9F, 0x09, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xAF, 0x08, 0xF0, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xBF, 0x06, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xDF, 0x04, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0,
+	0x7A, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xA7, 0xF0, 0xF0, 0xC0, 0x8B, 0x02, 0xF0, 0xF0, 0xB6,
+	0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0,
+	0x80, 0x8D, 0x01, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0,
+	0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x8D, 0x01, 0xF0, 0xF0, 0x46, 0x96,
+	0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x45, 0xB5, 0xF0, 0xF0, 0x40, 0x8D, 0x02, 0xF0, 0xF0, 0x36,
+	0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x45, 0xB5, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x46,
+	0x96, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x57,
+	0x57, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x6F,
+	0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0,
+	0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x8B, 0x17, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0x64, 0xF0, 0xF0, 0x40,
+	0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0xF0, 0x57, 0xF0, 0xF0, 0x20,
+	0x0D, 0xF0, 0xF0, 0xF0, 0x58, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x0B,
+	0xF0, 0xF0, 0xF0, 0x5A, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5B, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0,
+	0xF0, 0x5C, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5D, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5E,
+	0xF0, 0xA0, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x18, 0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x28,
+	0xF0, 0x80, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x38, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x48,
+	0xF0, 0x60, 0x0B, 0xDF, 0x0F, 0x0D, 0x58, 0xF0, 0x50, 0x0B, 0xCF, 0x0F, 0x0E, 0x68, 0xF0, 0x40,
+	0x0B, 0xBF, 0x0F, 0x0F, 0x78, 0xF0, 0x30, 0x0B, 0xBF, 0x0F, 0x0F, 0x88, 0xF0, 0x20, 0x0B, 0xBF,
+	0x0F, 0x0E, 0xA8, 0xF0, 0x10, 0x09, 0xBF, 0x0F, 0x0D, 0xC8, 0xF0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0,
+	0x58, 0xE0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x68, 0xD0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x78, 0xC0,
+	0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x88, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x97, 0xB0, 0x0B, 0xB6,
+	0xF0, 0xF0, 0xF0, 0x88, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x87, 0xC0, 0x0B, 0xB6, 0xF0, 0xF0,
+	0xF0, 0x77, 0xD0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x67, 0xE0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x57,
+	0xF0, 0x0D, 0xB6, 0xF0, 0xF0, 0xF0, 0x47, 0xF0, 0x10, 0x0B, 0xBF, 0x0F, 0x0D, 0xB8, 0xF0, 0x10,
+	0x0B, 0xBF, 0x0F, 0x0E, 0x98, 0xF0, 0x20, 0x0B, 0xBF, 0x0F, 0x0F, 0x78, 0xF0, 0x30, 0x0B, 0xBF,
+	0x0F, 0x0F, 0x68, 0xF0, 0x40, 0x0B, 0xCF, 0x0F, 0x0E, 0x58, 0xF0, 0x50, 0x0B, 0xDF, 0x0F, 0x0D,
+	0x48, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x38, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0xF0, 0x56,
+	0x28, 0xF0, 0x80, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0x27, 0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0xF0, 0x56,
+	0x17, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5D, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5C, 0xF0,
+	0xC0, 0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0x5B, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5A, 0xF0, 0xE0,
+	0x0B, 0xF0, 0xF0, 0xF0, 0x59, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0xF0, 0x58, 0xF0, 0xF0, 0x10, 0x0D,
+	0xF0, 0xF0, 0xF0, 0x57, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0xF0, 0x56, 0xF0, 0xF0, 0x30, 0x0D,
+	0xF0, 0xF0, 0xF0, 0x64, 0xF0, 0xF0, 0x40, 0x8B, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B,
+	0x15, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0x64, 0xF0, 0xF0, 0xF0, 0x40, 0x0D,
+	0xF0, 0xF0, 0x56, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x47, 0xF0, 0xF0, 0xF0, 0x30, 0x0D,
+	0xF0, 0xF0, 0x38, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x29, 0xF0, 0xF0, 0xF0, 0x30, 0x0B,
+	0xF0, 0xFB, 0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xEC, 0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xDD,
+	0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xCE, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xB8, 0x16, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xA8, 0x26, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x98, 0x36, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x88, 0x46, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x78, 0x56, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x59, 0x66, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x49, 0x76, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0x39, 0x8F, 0x0F, 0x0F, 0x90, 0x0D, 0xF0, 0x28, 0xAF, 0x0F, 0x0F,
+	0x01, 0x80, 0x0D, 0xF0, 0x18, 0xBF, 0x0F, 0x0F, 0x01, 0x80, 0x0B, 0xF8, 0xCF, 0x0F, 0x0F, 0x02,
+	0x70, 0x0B, 0xE8, 0xEF, 0x0F, 0x0F, 0x01, 0x70, 0x0B, 0xD8, 0xF0, 0x1F, 0x0F, 0x0F, 0x70, 0x0B,
+	0xC8, 0xF0, 0xF0, 0xF0, 0xB6, 0x70, 0x0B, 0xA9, 0xF0, 0xF0, 0xF0, 0xC6, 0x70, 0x0B, 0x99, 0xF0,
+	0xF0, 0xF0, 0xD6, 0x70, 0x0B, 0x89, 0xF0, 0xF0, 0xF0, 0xE6, 0x70, 0x0D, 0x87, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x16, 0x70, 0x0D, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x70, 0x0D, 0x87, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x16, 0x70, 0x0B, 0x89, 0xF0, 0xF0, 0xF0, 0xE6, 0x70, 0x0B, 0x99, 0xF0, 0xF0, 0xF0, 0xD6,
+	0x70, 0x0B, 0xA9, 0xF0, 0xF0, 0xF0, 0xC6, 0x70, 0x0B, 0xC8, 0xF0, 0xF0, 0xF0, 0xB6, 0x70, 0x0B,
+	0xD8, 0xF0, 0x1F, 0x0F, 0x0F, 0x70, 0x0B, 0xE8, 0xEF, 0x0F, 0x0F, 0x01, 0x70, 0x0B, 0xF8, 0xCF,
+	0x0F, 0x0F, 0x02, 0x70, 0x0D, 0xF0, 0x18, 0xBF, 0x0F, 0x0F, 0x01, 0x80, 0x0D, 0xF0, 0x28, 0xAF,
+	0x0F, 0x0F, 0x01, 0x80, 0x0B, 0xF0, 0x39, 0x8F, 0x0F, 0x0E, 0xA0, 0x0D, 0xF0, 0x49, 0x76, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x59, 0x66, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x78, 0x56, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x88, 0x46, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x98, 0x36, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xA8, 0x26, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xB8, 0x16, 0xF0,
+	0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xCE, 0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xDD, 0xF0, 0xF0, 0xF0,
+	0x30, 0x0B, 0xF0, 0xEC, 0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xF0, 0xFB, 0xF0, 0xF0, 0xF0, 0x30, 0x0D,
+	0xF0, 0xF0, 0x29, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x38, 0xF0, 0xF0, 0xF0, 0x30, 0x0D,
+	0xF0, 0xF0, 0x47, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x56, 0xF0, 0xF0, 0xF0, 0x30, 0x0D,
+	0xF0, 0xF0, 0x64, 0xF0, 0xF0, 0xF0, 0x40, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D,
+	0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x8D, 0x03, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30,
+	0x8D, 0x22, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x3F, 0x06, 0xBF, 0x06, 0xF0,
+	0x30, 0x8D, 0x02, 0xF0, 0x2F, 0x07, 0xBF, 0x07, 0xF0, 0x20, 0x0D, 0xF0, 0x2F, 0x06, 0xDF, 0x06,
+	0xF0, 0x20, 0x0D, 0xF0, 0x3F, 0x04, 0xFF, 0x04, 0xF0, 0x30, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77,
+	0xF0, 0x40, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37,
+	0xF0, 0x60, 0x0D, 0xF0, 0x77, 0xF0, 0xF0, 0x17, 0xF0, 0x70, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0,
+	0x70, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B, 0xF0, 0x98, 0xF0, 0xA8, 0xF0, 0x90, 0x0B,
+	0xF0, 0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0xB8, 0xF0, 0x68, 0xF0, 0xB0, 0x0B, 0xF0, 0xC7,
+	0xF0, 0x67, 0xF0, 0xC0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27,
+	0xF0, 0xE0, 0x09, 0xF0, 0xF7, 0xF7, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0, 0x10,
+	0x0D, 0xF0, 0xF0, 0x18, 0xB8, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x28, 0x98, 0xF0, 0xF0, 0x20,
+	0x0D, 0xF0, 0xF0, 0x38, 0x78, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x48, 0x58, 0xF0, 0xF0, 0x40,
+	0x0D, 0xF0, 0xF0, 0x58, 0x38, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60,
+	0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0,
+	0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0,
+	0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xE1, 0xF0,
+	0xF0, 0xE0, 0x8B, 0x01, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x8B, 0x01, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B,
+	0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0,
+	0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x58,
+	0x38, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x48, 0x58, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x38,
+	0x78, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x28, 0x98, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x18,
+	0xB8, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF7, 0xF7,
+	0xF0, 0xF0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0,
+	0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B, 0xF0, 0xB8, 0xF0, 0x68, 0xF0, 0xB0, 0x0B, 0xF0,
+	0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0x98, 0xF0, 0xA8, 0xF0, 0x90, 0x0B, 0xF0, 0x88, 0xF0,
+	0xC8, 0xF0, 0x80, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0D, 0xF0, 0x77, 0xF0, 0xF0, 0x17,
+	0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57,
+	0xF0, 0x50, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x3F, 0x04, 0xFF, 0x04,
+	0xF0, 0x30, 0x0D, 0xF0, 0x2F, 0x06, 0xDF, 0x06, 0xF0, 0x20, 0x8D, 0x02, 0xF0, 0x2F, 0x07, 0xBF,
+	0x07, 0xF0, 0x20, 0x0D, 0xF0, 0x3F, 0x06, 0xBF, 0x06, 0xF0, 0x30, 0x8D, 0x22, 0xF0, 0xF0, 0x36,
+	0xB6, 0xF0, 0xF0, 0x30, 0x8D, 0x03, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0,
+	0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x8B, 0x01, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0x37,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0x1B, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x09, 0xFE, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x0B, 0xEF, 0x02, 0xF0, 0xF0, 0xF0, 0xD0, 0x0B, 0xEF, 0x03, 0xF0, 0xF0, 0xF0,
+	0xC0, 0x0B, 0xD7, 0x3B, 0xF0, 0xF0, 0xF0, 0xA0, 0x0B, 0xD6, 0x5C, 0xF0, 0xF0, 0xF0, 0x80, 0x0B,
+	0xD6, 0x7C, 0xF0, 0xF0, 0xF0, 0x60, 0x0B, 0xD6, 0x9C, 0xF0, 0xF0, 0xF0, 0x40, 0x0B, 0xD6, 0xBB,
+	0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xD6, 0xDB, 0xF0, 0xF0, 0xF0, 0x10, 0x09, 0xD6, 0xFB, 0xF0, 0xF0,
+	0xE0, 0x0B, 0xD6, 0xF0, 0x1C, 0xF0, 0xF0, 0xC0, 0x0B, 0xD6, 0xF0, 0x3C, 0xF0, 0xF0, 0xA0, 0x0B,
+	0xD6, 0xF0, 0x5B, 0xF0, 0xF0, 0x90, 0x0B, 0xD6, 0xF0, 0x7B, 0xF0, 0xF0, 0x70, 0x0B, 0xD6, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x50, 0x0B, 0xD6, 0xF0, 0xAC, 0xF0, 0xF0, 0x30, 0x0B, 0xD6, 0xF0, 0xCC, 0xF0,
+	0xF0, 0x10, 0x09, 0xD6, 0xF0, 0xEB, 0xF0, 0xF0, 0x0B, 0xD6, 0xF0, 0xF0, 0x1B, 0xF0, 0xD0, 0x0B,
+	0xD6, 0xF0, 0xF0, 0x3B, 0xF0, 0xB0, 0x0B, 0xD6, 0xF0, 0xF0, 0x4C, 0xF0, 0x90, 0x0B, 0xD6, 0xF0,
+	0xF0, 0x6C, 0xF0, 0x70, 0x0B, 0xD6, 0xF0, 0xF0, 0x8C, 0xF0, 0x50, 0x0B, 0xD6, 0xF0, 0xF0, 0xAB,
+	0xF0, 0x40, 0x0B, 0xD6, 0xF0, 0xF0, 0xCB, 0xF0, 0x20, 0x09, 0xD6, 0xF0, 0xF0, 0xDC, 0xF0, 0x09,
+	0xD6, 0xF0, 0xF0, 0xFC, 0xD0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x2B, 0xC0, 0x0B, 0xD6, 0xF0, 0xF0,
+	0xF0, 0x4B, 0xA0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x6A, 0x90, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x79,
+	0x90, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x98, 0x80, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0xB6, 0x80, 0x8B,
+	0x01, 0xD6, 0xF0, 0xF0, 0xF0, 0xC5, 0x80, 0x8B, 0x01, 0xD6, 0xF0, 0xF0, 0xF0, 0xB6, 0x80, 0x0B,
+	0xD6, 0xF0, 0xF0, 0xF0, 0x98, 0x80, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x79, 0x90, 0x0B, 0xD6, 0xF0,
+	0xF0, 0xF0, 0x6A, 0x90, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x4B, 0xA0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0,
+	0x2B, 0xC0, 0x09, 0xD6, 0xF0, 0xF0, 0xFC, 0xD0, 0x09, 0xD6, 0xF0, 0xF0, 0xDC, 0xF0, 0x0B, 0xD6,
+	0xF0, 0xF0, 0xCB, 0xF0, 0x20, 0x0B, 0xD6, 0xF0, 0xF0, 0xAB, 0xF0, 0x40, 0x0B, 0xD6, 0xF0, 0xF0,
+	0x8C, 0xF0, 0x50, 0x0B, 0xD6, 0xF0, 0xF0, 0x6C, 0xF0, 0x70, 0x0B, 0xD6, 0xF0, 0xF0, 0x4C, 0xF0,
+	0x90, 0x0B, 0xD6, 0xF0, 0xF0, 0x3B, 0xF0, 0xB0, 0x0B, 0xD6, 0xF0, 0xF0, 0x1B, 0xF0, 0xD0, 0x09,
+	0xD6, 0xF0, 0xEB, 0xF0, 0xF0, 0x0B, 0xD6, 0xF0, 0xCC, 0xF0, 0xF0, 0x10, 0x0B, 0xD6, 0xF0, 0xAC,
+	0xF0, 0xF0, 0x30, 0x0B, 0xD6, 0xF0, 0x9B, 0xF0, 0xF0, 0x50, 0x0B, 0xD6, 0xF0, 0x7B, 0xF0, 0xF0,
+	0x70, 0x0B, 0xD6, 0xF0, 0x5B, 0xF0, 0xF0, 0x90, 0x0B, 0xD6, 0xF0, 0x3C, 0xF0, 0xF0, 0xA0, 0x0B,
+	0xD6, 0xF0, 0x1C, 0xF0, 0xF0, 0xC0, 0x09, 0xD6, 0xFB, 0xF0, 0xF0, 0xE0, 0x0B, 0xD6, 0xDB, 0xF0,
+	0xF0, 0xF0, 0x10, 0x0B, 0xD6, 0xBB, 0xF0, 0xF0, 0xF0, 0x30, 0x0B, 0xD6, 0x9C, 0xF0, 0xF0, 0xF0,
+	0x40, 0x0B, 0xD6, 0x7C, 0xF0, 0xF0, 0xF0, 0x60, 0x0B, 0xD6, 0x5C, 0xF0, 0xF0, 0xF0, 0x80, 0x0B,
+	0xD7, 0x3B, 0xF0, 0xF0, 0xF0, 0xA0, 0x0B, 0xEF, 0x03, 0xF0, 0xF0, 0xF0, 0xC0, 0x0B, 0xEF, 0x02,
+	0xF0, 0xF0, 0xF0, 0xD0, 0x09, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0x0D, 0xF0, 0x1B, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x20, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x8B, 0x03, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x8B, 0x0C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0x3D, 0xF0, 0xCD, 0xF0,
+	0x30, 0x0B, 0xFF, 0x03, 0xF0, 0x8F, 0x03, 0xF0, 0x0B, 0xEF, 0x05, 0xF0, 0x6F, 0x05, 0xE0, 0x0B,
+	0xDF, 0x07, 0xF0, 0x4F, 0x07, 0xD0, 0x8B, 0x01, 0xCF, 0x09, 0xF0, 0x2F, 0x09, 0xC0, 0x09, 0xB7,
+	0xC7, 0xF7, 0xC7, 0xB0, 0x89, 0x38, 0xB6, 0xE6, 0xF6, 0xE6, 0xB0, 0x09, 0xB7, 0xC7, 0xF7, 0xC7,
+	0xB0, 0x8B, 0x01, 0xCF, 0x09, 0xF0, 0x2F, 0x09, 0xC0, 0x0B, 0xDF, 0x07, 0xF0, 0x4F, 0x07, 0xD0,
+	0x0B, 0xEF, 0x05, 0xF0, 0x6F, 0x05, 0xE0, 0x0B, 0xFF, 0x03, 0xF0, 0x8F, 0x03, 0xF0, 0x0B, 0xF0,
+	0x3D, 0xF0, 0xCD, 0xF0, 0x30, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0C, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0xB7,
+	0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0,
+	0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D,
+	0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x58, 0x38, 0xF0, 0xF0, 0x50, 0x0D,
+	0xF0, 0xF0, 0x48, 0x58, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x0D,
+	0xF0, 0xF0, 0x37, 0x97, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x27, 0xB7, 0xF0, 0xF0, 0x20, 0x0D,
+	0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF8, 0xD8, 0xF0, 0xF0, 0x09, 0xF0, 0xE8,
+	0xF8, 0xF0, 0xE0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0,
+	0xD0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0xF0, 0x87, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0x98, 0xF0, 0xA8, 0xF0, 0x90, 0x0B, 0xF0, 0x97,
+	0xF0, 0xC7, 0xF0, 0x90, 0x0B, 0xF0, 0x87, 0xF0, 0xE7, 0xF0, 0x80, 0x0D, 0xF0, 0x77, 0xF0, 0xF0,
+	0x17, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60, 0x0D, 0xF0, 0x58, 0xF0, 0xF0,
+	0x38, 0xF0, 0x50, 0x0D, 0xF0, 0x48, 0xF0, 0xF0, 0x58, 0xF0, 0x40, 0x0D, 0xF0, 0x47, 0xF0, 0xF0,
+	0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0, 0x27, 0xF0, 0xF0,
+	0xB7, 0xF0, 0x20, 0x0D, 0xF0, 0x17, 0xF0, 0xF0, 0xD7, 0xF0, 0x10, 0x09, 0xF8, 0xF0, 0xF0, 0xD8,
+	0xF0, 0x09, 0xE8, 0xF0, 0xF0, 0xF8, 0xE0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x0B, 0xD7,
+	0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0, 0x67, 0xC0, 0x8B, 0x01, 0xC6, 0xF0,
+	0xF0, 0xF0, 0x86, 0xC0, 0x0B, 0xC5, 0xF0, 0xF0, 0xF0, 0xA5, 0xC0, 0x8B, 0x01, 0xCF, 0x0F, 0x0F,
+	0x0F, 0x05, 0xC0, 0x8B, 0x01, 0xDF, 0x0F, 0x0F, 0x0F, 0x03, 0xD0, 0x0B, 0xEF, 0x0F, 0x0F, 0x0F,
+	0x01, 0xE0, 0x0D, 0xF0, 0x1F, 0x0F, 0x0F, 0x0C, 0xF0, 0x10, 0x8B, 0x06, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0D, 0xF0, 0x2F, 0x0F, 0x0F, 0x0A, 0xF0, 0x20, 0x09, 0xFF, 0x0F, 0x0F, 0x0E, 0xF0,
+	0x0B, 0xEF, 0x0F, 0x0F, 0x0F, 0x01, 0xE0, 0x0B, 0xDF, 0x0F, 0x0F, 0x0F, 0x03, 0xD0, 0x8B, 0x01,
+	0xCF, 0x0F, 0x0F, 0x0F, 0x05, 0xC0, 0x0B, 0xB7, 0xF0, 0xF0, 0xF0, 0x87, 0xB0, 0x8B, 0x04, 0xB6,
+	0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xB7, 0xF0, 0xF0, 0xF0, 0x87, 0xB0, 0x8B, 0x01, 0xCF, 0x0F,
+	0x0F, 0x0F, 0x05, 0xC0, 0x0B, 0xDF, 0x0F, 0x0F, 0x0F, 0x03, 0xD0, 0x0B, 0xEF, 0x0F, 0x0F, 0x0F,
+	0x01, 0xE0, 0x09, 0xFF, 0x0F, 0x0F, 0x0E, 0xF0, 0x0D, 0xF0, 0x3F, 0x0F, 0x0F, 0x08, 0xF0, 0x30,
+	0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x0D, 0xC4, 0xF0, 0xF0, 0x23, 0xF0, 0xF0, 0x80, 0x0B, 0xA8, 0xF0, 0xC8, 0xF0, 0xF0, 0x60, 0x0B,
+	0x9A, 0xF0, 0xAA, 0xF0, 0xF0, 0x50, 0x0B, 0x8C, 0xF0, 0x9B, 0xF0, 0xF0, 0x40, 0x0B, 0x8D, 0xF0,
+	0x7E, 0xF0, 0xF0, 0x20, 0x0B, 0x8F, 0xF0, 0x5F, 0xF0, 0xF0, 0x10, 0x0D, 0x76, 0x29, 0xF0, 0x45,
+	0x29, 0xF0, 0xF0, 0x0D, 0x76, 0x39, 0xF0, 0x35, 0x48, 0xF0, 0xE0, 0x0D, 0x76, 0x58, 0xF0, 0x25,
+	0x58, 0xF0, 0xD0, 0x0D, 0x76, 0x68, 0xF0, 0x15, 0x69, 0xF0, 0xB0, 0x0B, 0x76, 0x79, 0xE5, 0x79,
+	0xF0, 0xA0, 0x0B, 0x76, 0x89, 0xD5, 0x89, 0xF0, 0x90, 0x0B, 0x76, 0x99, 0xC5, 0xA8, 0xF0, 0x80,
+	0x0B, 0x76, 0xA9, 0xB5, 0xB8, 0xF0, 0x70, 0x0B, 0x76, 0xC8, 0xA5, 0xC9, 0xF0, 0x50, 0x0B, 0x76,
+	0xD9, 0x85, 0xD9, 0xF0, 0x40, 0x0B, 0x76, 0xE9, 0x75, 0xE9, 0xF0, 0x30, 0x0B, 0x76, 0xF9, 0x65,
+	0xF9, 0xF0, 0x20, 0x0F, 0x76, 0xF0, 0x19, 0x55, 0xF0, 0x28, 0xF0, 0x10, 0x0D, 0x76, 0xF0, 0x38,
+	0x45, 0xF0, 0x39, 0xE0, 0x0D, 0x76, 0xF0, 0x48, 0x35, 0xF0, 0x49, 0xD0, 0x0D, 0x76, 0xF0, 0x59,
+	0x15, 0xF0, 0x59, 0xC0, 0x0B, 0x76, 0xF0, 0x6E, 0xF0, 0x69, 0xB0, 0x0B, 0x76, 0xF0, 0x7D, 0xF0,
+	0x88, 0xA0, 0x0B, 0x76, 0xF0, 0x9B, 0xF0, 0x98, 0x90, 0x0B, 0x76, 0xF0, 0xAA, 0xF0, 0xA9, 0x70,
+	0x0B, 0x76, 0xF0, 0xB9, 0xF0, 0xB9, 0x60, 0x0B, 0x76, 0xF0, 0xC8, 0xF0, 0xC9, 0x50, 0x0B, 0x76,
+	0xF0, 0xD7, 0xF0, 0xD8, 0x50, 0x0B, 0x76, 0xF0, 0xE6, 0xF0, 0xF7, 0x40, 0x8D, 0x02, 0x76, 0xF0,
+	0xF5, 0xF0, 0xF0, 0x16, 0x40, 0x0B, 0x76, 0xF0, 0xE6, 0xF0, 0xF7, 0x40, 0x0B, 0x76, 0xF0, 0xD7,
+	0xF0, 0xD8, 0x50, 0x0B, 0x76, 0xF0, 0xC8, 0xF0, 0xC9, 0x50, 0x0B, 0x76, 0xF0, 0xB9, 0xF0, 0xB9,
+	0x60, 0x0B, 0x76, 0xF0, 0xAA, 0xF0, 0xA9, 0x70, 0x0B, 0x76, 0xF0, 0x9B, 0xF0, 0x98, 0x90, 0x0B,
+	0x76, 0xF0, 0x7D, 0xF0, 0x88, 0xA0, 0x0B, 0x76, 0xF0, 0x6E, 0xF0, 0x69, 0xB0, 0x0D, 0x76, 0xF0,
+	0x59, 0x15, 0xF0, 0x59, 0xC0, 0x0D, 0x76, 0xF0, 0x48, 0x35, 0xF0, 0x49, 0xD0, 0x0D, 0x76, 0xF0,
+	0x38, 0x45, 0xF0, 0x39, 0xE0, 0x0F, 0x76, 0xF0, 0x19, 0x55, 0xF0, 0x28, 0xF0, 0x10, 0x0B, 0x76,
+	0xF9, 0x65, 0xF9, 0xF0, 0x20, 0x0B, 0x76, 0xE9, 0x75, 0xE9, 0xF0, 0x30, 0x0B, 0x76, 0xD9, 0x85,
+	0xD9, 0xF0, 0x40, 0x0B, 0x76, 0xC8, 0xA5, 0xC9, 0xF0, 0x50, 0x0B, 0x76, 0xA9, 0xB5, 0xB8, 0xF0,
+	0x70, 0x0B, 0x76, 0x99, 0xC5, 0xA8, 0xF0, 0x80, 0x0B, 0x76, 0x89, 0xD5, 0x89, 0xF0, 0x90, 0x0B,
+	0x76, 0x79, 0xE5, 0x79, 0xF0, 0xA0, 0x0D, 0x76, 0x68, 0xF0, 0x15, 0x69, 0xF0, 0xB0, 0x0D, 0x76,
+	0x58, 0xF0, 0x25, 0x58, 0xF0, 0xD0, 0x0D, 0x76, 0x39, 0xF0, 0x35, 0x48, 0xF0, 0xE0, 0x0D, 0x76,
+	0x29, 0xF0, 0x45, 0x29, 0xF0, 0xF0, 0x0B, 0x8F, 0xF0, 0x5F, 0xF0, 0xF0, 0x10, 0x0B, 0x8D, 0xF0,
+	0x7E, 0xF0, 0xF0, 0x20, 0x0B, 0x8C, 0xF0, 0x9B, 0xF0, 0xF0, 0x40, 0x0B, 0x9A, 0xF0, 0xAA, 0xF0,
+	0xF0, 0x50, 0x0B, 0xA8, 0xF0, 0xC8, 0xF0, 0xF0, 0x60, 0x0D, 0xC4, 0xF0, 0xF0, 0x23, 0xF0, 0xF0,
+	0x80, 0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x0D, 0xF0, 0xF0, 0x83, 0xF0, 0xF0, 0x24, 0xC0, 0x0B, 0xF0, 0xF0, 0x68, 0xF0, 0xC8, 0xA0,
+	0x0B, 0xF0, 0xF0, 0x5A, 0xF0, 0xAA, 0x90, 0x0B, 0xF0, 0xF0, 0x4B, 0xF0, 0x9C, 0x80, 0x0B, 0xF0,
+	0xF0, 0x2E, 0xF0, 0x7D, 0x80, 0x0B, 0xF0, 0xF0, 0x1F, 0xF0, 0x5F, 0x80, 0x0D, 0xF0, 0xF9, 0x25,
+	0xF0, 0x49, 0x26, 0x70, 0x0D, 0xF0, 0xE8, 0x45, 0xF0, 0x39, 0x36, 0x70, 0x0D, 0xF0, 0xD8, 0x55,
+	0xF0, 0x29, 0x46, 0x70, 0x0D, 0xF0, 0xB9, 0x65, 0xF0, 0x18, 0x66, 0x70, 0x0B, 0xF0, 0xA9, 0x75,
+	0xE9, 0x76, 0x70, 0x0B, 0xF0, 0x99, 0x85, 0xD9, 0x86, 0x70, 0x0B, 0xF0, 0x89, 0x95, 0xC9, 0x96,
+	0x70, 0x0B, 0xF0, 0x78, 0xB5, 0xB9, 0xA6, 0x70, 0x0B, 0xF0, 0x68, 0xC5, 0xA8, 0xC6, 0x70, 0x0B,
+	0xF0, 0x49, 0xD5, 0x98, 0xD6, 0x70, 0x0B, 0xF0, 0x39, 0xE5, 0x79, 0xE6, 0x70, 0x0B, 0xF0, 0x29,
+	0xF5, 0x69, 0xF6, 0x70, 0x0F, 0xF0, 0x18, 0xF0, 0x25, 0x59, 0xF0, 0x16, 0x70, 0x0D, 0xF8, 0xF0,
+	0x35, 0x48, 0xF0, 0x36, 0x70, 0x0D, 0xD9, 0xF0, 0x45, 0x38, 0xF0, 0x46, 0x70, 0x0D, 0xC9, 0xF0,
+	0x55, 0x19, 0xF0, 0x56, 0x70, 0x0B, 0xB9, 0xF0, 0x6E, 0xF0, 0x66, 0x70, 0x0B, 0xA9, 0xF0, 0x7D,
+	0xF0, 0x76, 0x70, 0x0B, 0x98, 0xF0, 0x9C, 0xF0, 0x86, 0x70, 0x0B, 0x79, 0xF0, 0xAA, 0xF0, 0xA6,
+	0x70, 0x0B, 0x69, 0xF0, 0xB9, 0xF0, 0xB6, 0x70, 0x0B, 0x59, 0xF0, 0xC8, 0xF0, 0xC6, 0x70, 0x0B,
+	0x58, 0xF0, 0xD7, 0xF0, 0xD6, 0x70, 0x0B, 0x47, 0xF0, 0xF6, 0xF0, 0xE6, 0x70, 0x8D, 0x02, 0x46,
+	0xF0, 0xF0, 0x15, 0xF0, 0xF6, 0x70, 0x0B, 0x47, 0xF0, 0xF6, 0xF0, 0xE6, 0x70, 0x0B, 0x58, 0xF0,
+	0xD7, 0xF0, 0xD6, 0x70, 0x0B, 0x59, 0xF0, 0xC8, 0xF0, 0xC6, 0x70, 0x0B, 0x69, 0xF0, 0xB9, 0xF0,
+	0xB6, 0x70, 0x0B, 0x79, 0xF0, 0xAA, 0xF0, 0xA6, 0x70, 0x0B, 0x98, 0xF0, 0x9C, 0xF0, 0x86, 0x70,
+	0x0B, 0xA9, 0xF0, 0x7D, 0xF0, 0x76, 0x70, 0x0B, 0xB9, 0xF0, 0x6E, 0xF0, 0x66, 0x70, 0x0D, 0xC9,
+	0xF0, 0x55, 0x19, 0xF0, 0x56, 0x70, 0x0D, 0xD9, 0xF0, 0x45, 0x38, 0xF0, 0x46, 0x70, 0x0D, 0xF8,
+	0xF0, 0x35, 0x48, 0xF0, 0x36, 0x70, 0x0F, 0xF0, 0x18, 0xF0, 0x25, 0x59, 0xF0, 0x16, 0x70, 0x0B,
+	0xF0, 0x29, 0xF5, 0x69, 0xF6, 0x70, 0x0B, 0xF0, 0x39, 0xE5, 0x79, 0xE6, 0x70, 0x0B, 0xF0, 0x49,
+	0xD5, 0x98, 0xD6, 0x70, 0x0B, 0xF0, 0x68, 0xC5, 0xA8, 0xC6, 0x70, 0x0B, 0xF0, 0x78, 0xB5, 0xB9,
+	0xA6, 0x70, 0x0B, 0xF0, 0x89, 0x95, 0xC9, 0x96, 0x70, 0x0B, 0xF0, 0x99, 0x85, 0xD9, 0x86, 0x70,
+	0x0B, 0xF0, 0xA9, 0x75, 0xE9, 0x76, 0x70, 0x0D, 0xF0, 0xB9, 0x65, 0xF0, 0x18, 0x66, 0x70, 0x0D,
+	0xF0, 0xD8, 0x55, 0xF0, 0x29, 0x46, 0x70, 0x0D, 0xF0, 0xE8, 0x45, 0xF0, 0x39, 0x36, 0x70, 0x0D,
+	0xF0, 0xF9, 0x25, 0xF0, 0x49, 0x26, 0x70, 0x0B, 0xF0, 0xF0, 0x1F, 0xF0, 0x5F, 0x80, 0x0B, 0xF0,
+	0xF0, 0x2E, 0xF0, 0x7D, 0x80, 0x0B, 0xF0, 0xF0, 0x4B, 0xF0, 0x9C, 0x80, 0x0B, 0xF0, 0xF0, 0x5A,
+	0xF0, 0xAA, 0x90, 0x0B, 0xF0, 0xF0, 0x68, 0xF0, 0xC8, 0xA0, 0x0D, 0xF0, 0xF0, 0x83, 0xF0, 0xF0,
+	0x24, 0xC0, 0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xF0, 0x13, 0xF0, 0xF0, 0xFA, 0xF0, 0x09, 0xE7, 0xF0, 0xF0, 0xBD, 0xE0, 0x09,
+	0xDA, 0xF0, 0xF0, 0x8F, 0xD0, 0x0B, 0xCD, 0xF0, 0xF0, 0x5F, 0x02, 0xC0, 0x0B, 0xCE, 0xF0, 0xF0,
+	0x4F, 0x03, 0xB0, 0x0D, 0xBF, 0x02, 0xF0, 0xF0, 0x1F, 0x04, 0xB0, 0x0B, 0xB6, 0x2B, 0xF0, 0xE6,
+	0x76, 0xB0, 0x0B, 0xB6, 0x4A, 0xF0, 0xD6, 0x76, 0xB0, 0x0B, 0xB6, 0x5B, 0xF0, 0xB6, 0x76, 0xB0,
+	0x0B, 0xB6, 0x7A, 0xF0, 0xA6, 0x76, 0xB0, 0x0B, 0xB6, 0x8B, 0xF0, 0x86, 0x76, 0xB0, 0x0B, 0xB6,
+	0xAB, 0xF0, 0x66, 0x76, 0xB0, 0x0B, 0xB6, 0xCA, 0xF0, 0x56, 0x76, 0xB0, 0x0B, 0xB6, 0xDB, 0xF0,
+	0x36, 0x76, 0xB0, 0x0B, 0xB6, 0xFB, 0xF0, 0x16, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0x2A, 0xF6, 0x76,
+	0xB0, 0x0B, 0xB6, 0xF0, 0x3B, 0xD6, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0x5A, 0xC6, 0x76, 0xB0, 0x0B,
+	0xB6, 0xF0, 0x6B, 0xA6, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0x8B, 0x86, 0x76, 0xB0, 0x0B, 0xB6, 0xF0,
+	0xAA, 0x76, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xBB, 0x56, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xDB, 0x36,
+	0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xEB, 0x26, 0x76, 0xB0, 0x0D, 0xB6, 0xF0, 0xF0, 0x1F, 0x02, 0x76,
+	0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x3F, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x4E, 0x76, 0xB0, 0x0B,
+	0xB6, 0xF0, 0xF0, 0x6C, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x8A, 0x76, 0xB0, 0x0B, 0xB6, 0xF0,
+	0xF0, 0x99, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0xB7, 0x76, 0xB0, 0x8B, 0x04, 0xB6, 0xF0, 0xF0,
+	0xC6, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0xB7, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x99, 0x76,
+	0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x8A, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x6C, 0x76, 0xB0, 0x0B,
+	0xB6, 0xF0, 0xF0, 0x4E, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0x3F, 0x76, 0xB0, 0x0D, 0xB6, 0xF0,
+	0xF0, 0x1F, 0x02, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xEB, 0x26, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xDB,
+	0x36, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xBB, 0x56, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0xAA, 0x76, 0x76,
+	0xB0, 0x0B, 0xB6, 0xF0, 0x8B, 0x86, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0x6B, 0xA6, 0x76, 0xB0, 0x0B,
+	0xB6, 0xF0, 0x5A, 0xC6, 0x76, 0xB0, 0x0B, 0xB6, 0xF0, 0x3B, 0xD6, 0x76, 0xB0, 0x0B, 0xB6, 0xF0,
+	0x2A, 0xF6, 0x76, 0xB0, 0x0B, 0xB6, 0xFB, 0xF0, 0x16, 0x76, 0xB0, 0x0B, 0xB6, 0xDB, 0xF0, 0x36,
+	0x76, 0xB0, 0x0B, 0xB6, 0xCA, 0xF0, 0x56, 0x76, 0xB0, 0x0B, 0xB6, 0xAB, 0xF0, 0x66, 0x76, 0xB0,
+	0x0B, 0xB6, 0x8B, 0xF0, 0x86, 0x76, 0xB0, 0x0B, 0xB6, 0x7A, 0xF0, 0xA6, 0x76, 0xB0, 0x0B, 0xB6,
+	0x5B, 0xF0, 0xB6, 0x76, 0xB0, 0x0B, 0xB6, 0x4A, 0xF0, 0xD6, 0x76, 0xB0, 0x0B, 0xB6, 0x2B, 0xF0,
+	0xE6, 0x76, 0xB0, 0x0D, 0xBF, 0x02, 0xF0, 0xF0, 0x1F, 0x04, 0xB0, 0x0B, 0xCE, 0xF0, 0xF0, 0x4F,
+	0x03, 0xB0, 0x0B, 0xCD, 0xF0, 0xF0, 0x5F, 0x02, 0xC0, 0x09, 0xDA, 0xF0, 0xF0, 0x8F, 0xD0, 0x09,
+	0xE7, 0xF0, 0xF0, 0xBD, 0xE0, 0x0B, 0xF0, 0x13, 0xF0, 0xF0, 0xFA, 0xF0, 0x8B, 0x06, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xFA, 0xF0, 0xF0,
+	0xF3, 0xF0, 0x10, 0x09, 0xED, 0xF0, 0xF0, 0xB7, 0xE0, 0x09, 0xDF, 0xF0, 0xF0, 0x8A, 0xD0, 0x0B,
+	0xCF, 0x02, 0xF0, 0xF0, 0x5D, 0xC0, 0x0B, 0xBF, 0x03, 0xF0, 0xF0, 0x4E, 0xC0, 0x0D, 0xBF, 0x04,
+	0xF0, 0xF0, 0x1F, 0x02, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xEB, 0x26, 0xB0, 0x0B, 0xB6, 0x76, 0xF0,
+	0xDB, 0x36, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xBB, 0x56, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xAA, 0x76,
+	0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x8B, 0x86, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x6B, 0xA6, 0xB0, 0x0B,
+	0xB6, 0x76, 0xF0, 0x5A, 0xC6, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x3B, 0xD6, 0xB0, 0x0B, 0xB6, 0x76,
+	0xF0, 0x2A, 0xF6, 0xB0, 0x0B, 0xB6, 0x76, 0xFB, 0xF0, 0x16, 0xB0, 0x0B, 0xB6, 0x76, 0xDB, 0xF0,
+	0x36, 0xB0, 0x0B, 0xB6, 0x76, 0xCA, 0xF0, 0x56, 0xB0, 0x0B, 0xB6, 0x76, 0xAB, 0xF0, 0x66, 0xB0,
+	0x0B, 0xB6, 0x76, 0x8B, 0xF0, 0x86, 0xB0, 0x0B, 0xB6, 0x76, 0x7A, 0xF0, 0xA6, 0xB0, 0x0B, 0xB6,
+	0x76, 0x5B, 0xF0, 0xB6, 0xB0, 0x0B, 0xB6, 0x76, 0x4A, 0xF0, 0xD6, 0xB0, 0x0B, 0xB6, 0x76, 0x2B,
+	0xF0, 0xE6, 0xB0, 0x0D, 0xB6, 0x7F, 0x02, 0xF0, 0xF0, 0x16, 0xB0, 0x0B, 0xB6, 0x7F, 0xF0, 0xF0,
+	0x36, 0xB0, 0x0B, 0xB6, 0x7E, 0xF0, 0xF0, 0x46, 0xB0, 0x0B, 0xB6, 0x7C, 0xF0, 0xF0, 0x66, 0xB0,
+	0x0B, 0xB6, 0x7B, 0xF0, 0xF0, 0x76, 0xB0, 0x0B, 0xB6, 0x79, 0xF0, 0xF0, 0x96, 0xB0, 0x0B, 0xB6,
+	0x77, 0xF0, 0xF0, 0xB6, 0xB0, 0x8B, 0x04, 0xB6, 0x76, 0xF0, 0xF0, 0xC6, 0xB0, 0x0B, 0xB6, 0x77,
+	0xF0, 0xF0, 0xB6, 0xB0, 0x0B, 0xB6, 0x79, 0xF0, 0xF0, 0x96, 0xB0, 0x0B, 0xB6, 0x7B, 0xF0, 0xF0,
+	0x76, 0xB0, 0x0B, 0xB6, 0x7C, 0xF0, 0xF0, 0x66, 0xB0, 0x0B, 0xB6, 0x7E, 0xF0, 0xF0, 0x46, 0xB0,
+	0x0B, 0xB6, 0x7F, 0xF0, 0xF0, 0x36, 0xB0, 0x0D, 0xB6, 0x7F, 0x02, 0xF0, 0xF0, 0x16, 0xB0, 0x0B,
+	0xB6, 0x76, 0x2B, 0xF0, 0xE6, 0xB0, 0x0B, 0xB6, 0x76, 0x4A, 0xF0, 0xD6, 0xB0, 0x0B, 0xB6, 0x76,
+	0x5B, 0xF0, 0xB6, 0xB0, 0x0B, 0xB6, 0x76, 0x7A, 0xF0, 0xA6, 0xB0, 0x0B, 0xB6, 0x76, 0x8B, 0xF0,
+	0x86, 0xB0, 0x0B, 0xB6, 0x76, 0xAB, 0xF0, 0x66, 0xB0, 0x0B, 0xB6, 0x76, 0xCA, 0xF0, 0x56, 0xB0,
+	0x0B, 0xB6, 0x76, 0xDB, 0xF0, 0x36, 0xB0, 0x0B, 0xB6, 0x76, 0xFB, 0xF0, 0x16, 0xB0, 0x0B, 0xB6,
+	0x76, 0xF0, 0x2A, 0xF6, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x3B, 0xD6, 0xB0, 0x0B, 0xB6, 0x76, 0xF0,
+	0x5A, 0xC6, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x6B, 0xA6, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0x8B, 0x86,
+	0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xAA, 0x76, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xBB, 0x56, 0xB0, 0x0B,
+	0xB6, 0x76, 0xF0, 0xDB, 0x36, 0xB0, 0x0B, 0xB6, 0x76, 0xF0, 0xEB, 0x26, 0xB0, 0x0D, 0xBF, 0x04,
+	0xF0, 0xF0, 0x1F, 0x02, 0xB0, 0x0B, 0xBF, 0x03, 0xF0, 0xF0, 0x4E, 0xC0, 0x0B, 0xCF, 0x02, 0xF0,
+	0xF0, 0x5D, 0xC0, 0x09, 0xDF, 0xF0, 0xF0, 0x8A, 0xD0, 0x09, 0xED, 0xF0, 0xF0, 0xB7, 0xE0, 0x0B,
+	0xFA, 0xF0, 0xF0, 0xF3, 0xF0, 0x10, 0x8B, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0A,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x8B, 0x08, 0xF0,
+	0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0F, 0xF0, 0xF0, 0x12, 0x95, 0x83, 0xF0, 0xF0, 0x10, 0x0B, 0xF0,
+	0xE6, 0x75, 0x76, 0xF0, 0xE0, 0x0B, 0xF0, 0xC8, 0x75, 0x78, 0xF0, 0xC0, 0x0B, 0xF0, 0xB9, 0x75,
+	0x79, 0xF0, 0xB0, 0x0B, 0xF0, 0x9B, 0x75, 0x7B, 0xF0, 0x90, 0x0B, 0xF0, 0x8B, 0x85, 0x8B, 0xF0,
+	0x80, 0x0B, 0xF0, 0x7A, 0xA5, 0xAA, 0xF0, 0x70, 0x0B, 0xF0, 0x69, 0xC5, 0xC9, 0xF0, 0x60, 0x0B,
+	0xF0, 0x59, 0xD5, 0xD9, 0xF0, 0x50, 0x0B, 0xF0, 0x48, 0xF5, 0xF8, 0xF0, 0x40, 0x0F, 0xF0, 0x38,
+	0xF0, 0x15, 0xF0, 0x18, 0xF0, 0x30, 0x0F, 0xF0, 0x37, 0xF0, 0x25, 0xF0, 0x27, 0xF0, 0x30, 0x0F,
+	0xF0, 0x27, 0xF0, 0x35, 0xF0, 0x37, 0xF0, 0x20, 0x0F, 0xF0, 0x17, 0xF0, 0x45, 0xF0, 0x47, 0xF0,
+	0x10, 0x0F, 0xF0, 0x16, 0xF0, 0x55, 0xF0, 0x56, 0xF0, 0x10, 0x0B, 0xF7, 0xF0, 0x55, 0xF0, 0x57,
+	0xF0, 0x0B, 0xF6, 0xF0, 0x65, 0xF0, 0x66, 0xF0, 0x8B, 0x01, 0xE6, 0xF0, 0x75, 0xF0, 0x76, 0xE0,
+	0x8B, 0x01, 0xD6, 0xF0, 0x85, 0xF0, 0x86, 0xD0, 0x0B, 0xD5, 0xF0, 0x95, 0xF0, 0x95, 0xD0, 0x8B,
+	0x02, 0xC6, 0xF0, 0x95, 0xF0, 0x96, 0xC0, 0x0B, 0xC5, 0xF0, 0xC1, 0xF0, 0xC5, 0xC0, 0x8B, 0x09,
+	0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x8B, 0x01, 0xC5, 0xF0, 0xF0, 0xF0, 0xA5, 0xC0, 0x8B, 0x02,
+	0xC6, 0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x8B, 0x01, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B, 0xD7,
+	0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xE6, 0xF0, 0xF0, 0xF0, 0x46, 0xE0, 0x0B, 0xE7, 0xF0, 0xF0,
+	0xF0, 0x27, 0xE0, 0x0B, 0xF6, 0xF0, 0xF0, 0xF0, 0x26, 0xF0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0,
+	0x0D, 0xF0, 0x17, 0xF0, 0xF0, 0xD7, 0xF0, 0x10, 0x8D, 0x01, 0xF0, 0x27, 0xF0, 0xF0, 0xB7, 0xF0,
+	0x20, 0x0D, 0xF0, 0x38, 0xF0, 0xF0, 0x87, 0xF0, 0x30, 0x0D, 0xF0, 0x48, 0xF0, 0xF0, 0x58, 0xF0,
+	0x40, 0x0D, 0xF0, 0x58, 0xF0, 0xF0, 0x38, 0xF0, 0x50, 0x0D, 0xF0, 0x68, 0xF0, 0xF0, 0x18, 0xF0,
+	0x60, 0x0B, 0xF0, 0x79, 0xF0, 0xC9, 0xF0, 0x70, 0x0B, 0xF0, 0x8A, 0xF0, 0x8A, 0xF0, 0x80, 0x0B,
+	0xF0, 0x9C, 0xF0, 0x2C, 0xF0, 0x90, 0x09, 0xF0, 0xAE, 0xBE, 0xF0, 0xA0, 0x0B, 0xF0, 0xCF, 0x0F,
+	0x05, 0xF0, 0xC0, 0x0B, 0xF0, 0xEF, 0x0F, 0x01, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0,
+	0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0,
+	0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x02, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0,
+	0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x8D, 0x03, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0,
+	0x40, 0x0D, 0xF0, 0xF0, 0x46, 0x96, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x45, 0xB5, 0xF0, 0xF0,
+	0x40, 0x8D, 0x02, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x33, 0xB7, 0xB6, 0xF0,
+	0xF0, 0x30, 0x0D, 0xF0, 0x26, 0x96, 0xD6, 0xA5, 0xF0, 0x20, 0x0D, 0xF0, 0x19, 0x58, 0xD7, 0x68,
+	0xF0, 0x20, 0x0B, 0xFF, 0x07, 0xEF, 0x07, 0xF0, 0x10, 0x0B, 0xFF, 0x06, 0xF0, 0x1F, 0x07, 0xF0,
+	0x0B, 0xEF, 0x07, 0xF0, 0x2F, 0x07, 0xE0, 0x0B, 0xDF, 0x07, 0xF0, 0x4F, 0x06, 0xE0, 0x0B, 0xD7,
+	0x3A, 0xF0, 0x7C, 0x27, 0xD0, 0x0B, 0xC7, 0x74, 0xF0, 0xD7, 0x57, 0xC0, 0x0B, 0xC6, 0xF0, 0xF0,
+	0xF0, 0x86, 0xC0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0x97, 0xB0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6,
+	0xB0, 0x0B, 0xA6, 0xF0, 0x99, 0xF0, 0x87, 0xA0, 0x0B, 0xA6, 0xF0, 0x6F, 0xF0, 0x66, 0xA0, 0x0D,
+	0x97, 0xF0, 0x5F, 0x02, 0xF0, 0x56, 0xA0, 0x0D, 0x96, 0xF0, 0x5F, 0x04, 0xF0, 0x56, 0x90, 0x0D,
+	0x98, 0xF0, 0x2F, 0x06, 0xF0, 0x37, 0x90, 0x0B, 0x99, 0xF9, 0x59, 0xF0, 0x18, 0x90, 0x09, 0xA9,
+	0xD8, 0x98, 0xDA, 0x90, 0x09, 0xB9, 0xB7, 0xD7, 0xB9, 0xB0, 0x09, 0xD8, 0xA6, 0xF6, 0xB8, 0xC0,
+	0x09, 0xE7, 0xA6, 0xF6, 0xA8, 0xD0, 0x0B, 0xF7, 0x86, 0xF0, 0x26, 0x96, 0xF0, 0x0F, 0xF0, 0x16,
+	0x86, 0xF0, 0x26, 0x86, 0xF0, 0x10, 0x0F, 0xF0, 0x16, 0x85, 0xF0, 0x45, 0x86, 0xF0, 0x10, 0x0F,
+	0xF0, 0x25, 0x85, 0xF0, 0x45, 0x86, 0xF0, 0x10, 0x0F, 0xF0, 0x25, 0x85, 0xF0, 0x45, 0x85, 0xF0,
+	0x20, 0x0F, 0xF0, 0x16, 0x85, 0xF0, 0x45, 0x85, 0xF0, 0x20, 0x0F, 0xF0, 0x16, 0x85, 0xF0, 0x45,
+	0x86, 0xF0, 0x10, 0x0F, 0xF0, 0x16, 0x86, 0xF0, 0x26, 0x86, 0xF0, 0x10, 0x0B, 0xF6, 0x96, 0xF0,
+	0x26, 0x87, 0xF0, 0x09, 0xD8, 0xA6, 0xF6, 0xA7, 0xE0, 0x09, 0xC8, 0xB6, 0xF6, 0xA8, 0xD0, 0x09,
+	0xB9, 0xB7, 0xD6, 0xC9, 0xB0, 0x09, 0x9A, 0xD8, 0x98, 0xD9, 0xA0, 0x0B, 0x98, 0xF0, 0x19, 0x59,
+	0xF9, 0x90, 0x0D, 0x97, 0xF0, 0x3F, 0x06, 0xF0, 0x28, 0x90, 0x0D, 0x96, 0xF0, 0x5F, 0x04, 0xF0,
+	0x56, 0x90, 0x0D, 0xA6, 0xF0, 0x5F, 0x02, 0xF0, 0x57, 0x90, 0x0B, 0xA6, 0xF0, 0x6E, 0xF0, 0x76,
+	0xA0, 0x0B, 0xA7, 0xF0, 0x89, 0xF0, 0x96, 0xA0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B,
+	0xB7, 0xF0, 0xF0, 0xF0, 0x96, 0xB0, 0x0B, 0xC6, 0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x0B, 0xC7, 0x57,
+	0xF0, 0xD4, 0x77, 0xC0, 0x0B, 0xD7, 0x2C, 0xF0, 0x7A, 0x37, 0xD0, 0x0B, 0xEF, 0x06, 0xF0, 0x4F,
+	0x07, 0xD0, 0x0B, 0xEF, 0x07, 0xF0, 0x2F, 0x07, 0xE0, 0x09, 0xFF, 0x07, 0xFF, 0x07, 0xF0, 0x0B,
+	0xF0, 0x1F, 0x07, 0xEF, 0x07, 0xF0, 0x0D, 0xF0, 0x28, 0x67, 0xD8, 0x59, 0xF0, 0x10, 0x0D, 0xF0,
+	0x25, 0xA6, 0xD6, 0x96, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x36, 0xB7, 0xB3, 0xF0, 0x30, 0x8D, 0x02,
+	0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x45, 0xB5, 0xF0, 0xF0, 0x40, 0x0D,
+	0xF0, 0xF0, 0x49, 0x39, 0xF0, 0xF0, 0x40, 0x8D, 0x02, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0, 0x40,
+	0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B,
+	0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0,
+	0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0,
+	0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xEF, 0x0F, 0xF0, 0xF0, 0x09, 0xF0, 0xDC, 0x9C, 0xF0,
+	0xD0, 0x09, 0xF0, 0xCA, 0xF9, 0xF0, 0xD0, 0x0B, 0xF0, 0xB9, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0,
+	0xB7, 0xF0, 0x76, 0xF0, 0xD0, 0x0B, 0xF0, 0xA7, 0xF0, 0xA4, 0xF0, 0xD0, 0x0B, 0xF0, 0x97, 0xF0,
+	0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0x87, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0x86, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x0B, 0xF0, 0x77, 0xF0, 0xF0, 0xF0, 0xF0, 0x0D, 0xF0, 0x76, 0xF0, 0xF0, 0x63, 0xF0, 0x70,
+	0x0D, 0xF0, 0x76, 0xF0, 0xF0, 0x55, 0xF0, 0x60, 0x0D, 0xF0, 0x66, 0xF0, 0xF0, 0x57, 0xF0, 0x50,
+	0x0D, 0xF0, 0x66, 0xF0, 0xF0, 0x49, 0xF0, 0x40, 0x0D, 0xF0, 0x66, 0xF0, 0xF0, 0x3B, 0xF0, 0x30,
+	0x0D, 0xF0, 0x65, 0xF0, 0xF0, 0x3D, 0xF0, 0x20, 0x0D, 0xF0, 0x65, 0xF0, 0xF0, 0x2F, 0xF0, 0x10,
+	0x0D, 0xF0, 0x56, 0xF0, 0xF0, 0x1F, 0x02, 0xF0, 0x0B, 0xF0, 0x56, 0xF0, 0xFF, 0x04, 0xE0, 0x0B,
+	0xF0, 0x56, 0xF0, 0xEF, 0x06, 0xD0, 0x0D, 0xF0, 0x56, 0xF0, 0xD8, 0x16, 0x17, 0xC0, 0x0D, 0xF0,
+	0x56, 0xF0, 0xC8, 0x26, 0x27, 0xB0, 0x0D, 0xF0, 0x56, 0xF0, 0xB8, 0x36, 0x28, 0xA0, 0x0D, 0xF0,
+	0x56, 0xF0, 0xB7, 0x46, 0x38, 0x90, 0x0D, 0xF0, 0x56, 0xF0, 0xB6, 0x56, 0x47, 0x90, 0x0D, 0xF0,
+	0x56, 0xF0, 0xB5, 0x66, 0x55, 0xA0, 0x0D, 0xF0, 0x56, 0xF0, 0xC3, 0x76, 0x72, 0xB0, 0x8D, 0x06,
+	0xF0, 0x56, 0xF0, 0xF0, 0x76, 0xF0, 0x50, 0x0D, 0xB2, 0x76, 0x73, 0xF0, 0xC6, 0xF0, 0x50, 0x0D,
+	0xA5, 0x56, 0x65, 0xF0, 0xB6, 0xF0, 0x50, 0x0D, 0x97, 0x46, 0x56, 0xF0, 0xB6, 0xF0, 0x50, 0x0D,
+	0x98, 0x36, 0x47, 0xF0, 0xB6, 0xF0, 0x50, 0x0D, 0xA8, 0x26, 0x38, 0xF0, 0xB6, 0xF0, 0x50, 0x0D,
+	0xB8, 0x16, 0x28, 0xF0, 0xC6, 0xF0, 0x50, 0x0B, 0xCE, 0x18, 0xF0, 0xD6, 0xF0, 0x50, 0x0B, 0xDF,
+	0x06, 0xF0, 0xE6, 0xF0, 0x50, 0x0B, 0xEF, 0x04, 0xF0, 0xF6, 0xF0, 0x50, 0x0D, 0xFF, 0x02, 0xF0,
+	0xF0, 0x16, 0xF0, 0x50, 0x0D, 0xF0, 0x1F, 0xF0, 0xF0, 0x25, 0xF0, 0x60, 0x0D, 0xF0, 0x2D, 0xF0,
+	0xF0, 0x35, 0xF0, 0x60, 0x0D, 0xF0, 0x3B, 0xF0, 0xF0, 0x36, 0xF0, 0x60, 0x0D, 0xF0, 0x49, 0xF0,
+	0xF0, 0x46, 0xF0, 0x60, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x56, 0xF0, 0x60, 0x0D, 0xF0, 0x65, 0xF0,
+	0xF0, 0x56, 0xF0, 0x70, 0x0D, 0xF0, 0x73, 0xF0, 0xF0, 0x66, 0xF0, 0x70, 0x8B, 0x01, 0xF0, 0xF0,
+	0xF0, 0xF6, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0xF0, 0xE6, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xF0, 0xD7,
+	0xF0, 0x90, 0x0B, 0xF0, 0xD4, 0xF0, 0xA7, 0xF0, 0xA0, 0x0B, 0xF0, 0xD6, 0xF0, 0x77, 0xF0, 0xB0,
+	0x0B, 0xF0, 0xC8, 0xF0, 0x49, 0xF0, 0xB0, 0x09, 0xF0, 0xD9, 0xFA, 0xF0, 0xC0, 0x09, 0xF0, 0xDC,
+	0x9C, 0xF0, 0xD0, 0x09, 0xF0, 0xFF, 0x0F, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0,
+	0x10, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0,
+	0x40, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x8B,
+	0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x21, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0F, 0xF0,
+	0xF0, 0x22, 0x85, 0x82, 0xF0, 0xF0, 0x20, 0x0F, 0xF0, 0xF0, 0x15, 0x65, 0x65, 0xF0, 0xF0, 0x10,
+	0x0F, 0xF0, 0xF0, 0x16, 0x55, 0x56, 0xF0, 0xF0, 0x10, 0x0F, 0xF0, 0xF0, 0x17, 0x45, 0x47, 0xF0,
+	0xF0, 0x10, 0x0F, 0xF0, 0xF0, 0x18, 0x35, 0x38, 0xF0, 0xF0, 0x10, 0x0F, 0xF0, 0xF0, 0x28, 0x25,
+	0x28, 0xF0, 0xF0, 0x20, 0x0F, 0xF0, 0xF0, 0x38, 0x15, 0x18, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0,
+	0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0,
+	0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x8D,
+	0xF0, 0x91, 0xD0, 0x0B, 0xC4, 0xF0, 0x8B, 0xF0, 0x84, 0xC0, 0x0B, 0xB6, 0xF0, 0x89, 0xF0, 0x86,
+	0xB0, 0x0B, 0xB6, 0xF0, 0x97, 0xF0, 0x96, 0xB0, 0x0B, 0xB6, 0xF0, 0xA5, 0xF0, 0xA6, 0xB0, 0x0B,
+	0xB6, 0xF0, 0xB3, 0xF0, 0xB6, 0xB0, 0x8B, 0x06, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xC6,
+	0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0, 0x67, 0xC0, 0x0B, 0xCF, 0x0F, 0x0F,
+	0x0F, 0x05, 0xC0, 0x0B, 0xDF, 0x0F, 0x0F, 0x0F, 0x03, 0xD0, 0x0B, 0xEF, 0x0F, 0x0F, 0x0F, 0x01,
+	0xE0, 0x09, 0xFF, 0x0F, 0x0F, 0x0E, 0xF0, 0x0D, 0xF0, 0x1F, 0x0F, 0x0F, 0x0C, 0xF0, 0x10, 0x0D,
+	0xF0, 0x4F, 0x0F, 0x0F, 0x06, 0xF0, 0x40, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B,
+	0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0x4F, 0x0F, 0x0B, 0xF0, 0xE0, 0x0B, 0xF0,
+	0x1F, 0x0F, 0x0F, 0xF0, 0xD0, 0x0B, 0xFF, 0x0F, 0x0F, 0x02, 0xF0, 0xC0, 0x0B, 0xEF, 0x0F, 0x0F,
+	0x04, 0xF0, 0xB0, 0x0B, 0xDF, 0x0F, 0x0F, 0x06, 0xF0, 0xA0, 0x0B, 0xCF, 0x0F, 0x0F, 0x09, 0xF0,
+	0x80, 0x0B, 0xC7, 0x56, 0xF0, 0x9D, 0xF0, 0x70, 0x0B, 0xC6, 0x66, 0xF0, 0x9E, 0xF0, 0x60, 0x0D,
+	0xB6, 0x76, 0xF0, 0x95, 0x19, 0xF0, 0x50, 0x0D, 0xB6, 0x76, 0xF0, 0x95, 0x38, 0xF0, 0x40, 0x0D,
+	0xB6, 0x76, 0xF0, 0x95, 0x48, 0xF0, 0x30, 0x0D, 0xB6, 0x76, 0xF0, 0x95, 0x58, 0xF0, 0x20, 0x0D,
+	0xB6, 0x76, 0xF0, 0x95, 0x68, 0xF0, 0x10, 0x0B, 0xB6, 0x76, 0xF0, 0x95, 0x79, 0xE0, 0x0B, 0xB6,
+	0x76, 0xF0, 0x95, 0x89, 0xD0, 0x0B, 0xB6, 0x76, 0xF0, 0x95, 0x99, 0xC0, 0x0B, 0xB6, 0x76, 0xF0,
+	0x86, 0xA9, 0xB0, 0x0B, 0xB6, 0x7F, 0x0F, 0x05, 0xC7, 0xB0, 0x0B, 0xB6, 0x8F, 0x0F, 0x04, 0xD6,
+	0xB0, 0x0B, 0xB6, 0x8F, 0x0F, 0x03, 0xE6, 0xB0, 0x0B, 0xB6, 0x9F, 0x0F, 0x01, 0xF6, 0xB0, 0x0B,
+	0xB6, 0xAF, 0x0E, 0xF0, 0x16, 0xB0, 0x8B, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xB6,
+	0x8F, 0x0F, 0x09, 0x86, 0xB0, 0x0B, 0xB6, 0x7F, 0x0F, 0x0B, 0x76, 0xB0, 0x8B, 0x01, 0xB6, 0x6F,
+	0x0F, 0x0D, 0x66, 0xB0, 0x0B, 0xB6, 0x5F, 0x0F, 0x0F, 0x56, 0xB0, 0x8D, 0x13, 0xB6, 0x56, 0xF0,
+	0xF0, 0x36, 0x56, 0xB0, 0x0D, 0xC6, 0x46, 0xF0, 0xF0, 0x36, 0x46, 0xC0, 0x0D, 0xC7, 0x36, 0xF0,
+	0xF0, 0x36, 0x37, 0xC0, 0x0B, 0xCF, 0x0F, 0x0F, 0x0F, 0x05, 0xC0, 0x0B, 0xDF, 0x0F, 0x0F, 0x0F,
+	0x03, 0xD0, 0x0B, 0xEF, 0x0F, 0x0F, 0x0F, 0x01, 0xE0, 0x09, 0xFF, 0x0F, 0x0F, 0x0E, 0xF0, 0x0D,
+	0xF0, 0x1F, 0x0F, 0x0F, 0x0C, 0xF0, 0x10, 0x0D, 0xF0, 0x4F, 0x0F, 0x0F, 0x06, 0xF0, 0x40, 0x8B,
+	0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xF0, 0x96, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xF0, 0x5E, 0xF0, 0xA0, 0x0D, 0xF0, 0xF0,
+	0xF0, 0x2F, 0x05, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0xFF, 0x08, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xEF,
+	0x09, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xCF, 0x0B, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xBB, 0x78, 0xF0,
+	0x70, 0x0B, 0xF0, 0xF0, 0xAA, 0x88, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x99, 0x98, 0xF0, 0x90, 0x0B,
+	0xF0, 0xF0, 0x97, 0xA8, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x87, 0xA8, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0,
+	0x77, 0xA8, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0x76, 0xA8, 0xD3, 0xC0, 0x0B, 0xF0, 0xF0, 0x67, 0x98,
+	0xD5, 0xB0, 0x0B, 0xF0, 0xF0, 0x66, 0x98, 0xD6, 0xB0, 0x0B, 0xF0, 0xF0, 0x66, 0x97, 0xD7, 0xB0,
+	0x0B, 0xF0, 0xF0, 0x56, 0x97, 0xD9, 0xA0, 0x0B, 0xF0, 0xF0, 0x56, 0x87, 0xDA, 0xA0, 0x0B, 0xF0,
+	0xF0, 0x55, 0x96, 0xDB, 0xA0, 0x0B, 0xF0, 0xF0, 0x55, 0x86, 0xDC, 0xA0, 0x0B, 0xF0, 0xF0, 0x46,
+	0x86, 0xCE, 0x90, 0x0D, 0xF0, 0xF0, 0x46, 0x86, 0xB8, 0x16, 0x90, 0x0D, 0xF0, 0xF0, 0x46, 0x86,
+	0xA8, 0x26, 0x90, 0x0D, 0xF0, 0xF0, 0x46, 0x86, 0x98, 0x36, 0x90, 0x0D, 0xF0, 0xF0, 0x46, 0x86,
+	0x88, 0x46, 0x90, 0x0D, 0xF0, 0xF0, 0x55, 0x96, 0x68, 0x56, 0x90, 0x0D, 0xF0, 0xF0, 0x55, 0x9F,
+	0x04, 0x65, 0xA0, 0x0D, 0xF0, 0xF0, 0x55, 0xAF, 0x02, 0x66, 0xA0, 0x0B, 0xF0, 0xF0, 0x56, 0xAF,
+	0x76, 0xA0, 0x0B, 0xF0, 0xF0, 0x47, 0xBC, 0x96, 0xA0, 0x0B, 0xF0, 0xF0, 0x38, 0xCA, 0x96, 0xB0,
+	0x0B, 0xF0, 0xF0, 0x28, 0xF6, 0xB6, 0xB0, 0x0D, 0xF0, 0xF0, 0x18, 0xF0, 0xF0, 0x27, 0xB0, 0x0B,
+	0xF0, 0xF8, 0xF0, 0xF0, 0x36, 0xC0, 0x0B, 0xF0, 0xE8, 0xF0, 0xF0, 0x37, 0xC0, 0x0B, 0xF0, 0xD8,
+	0xF0, 0xF0, 0x37, 0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0xF0, 0x37, 0xE0, 0x0B, 0xF0, 0xB8, 0xF0, 0xF0,
+	0x28, 0xF0, 0x0B, 0xF0, 0xA8, 0xF0, 0xF0, 0x1A, 0xF0, 0x0D, 0xF0, 0x98, 0xF0, 0x23, 0xAB, 0xF0,
+	0x10, 0x0D, 0xF0, 0x88, 0xF0, 0x2F, 0x09, 0xF0, 0x20, 0x0D, 0xF0, 0x78, 0xF0, 0x2F, 0x08, 0xF0,
+	0x40, 0x0D, 0xF0, 0x68, 0xF0, 0x2F, 0x08, 0xF0, 0x50, 0x0D, 0xF0, 0x58, 0xF0, 0x2F, 0x07, 0xF0,
+	0x70, 0x0D, 0xF0, 0x48, 0xF0, 0x2F, 0x05, 0xF0, 0xA0, 0x0D, 0xF0, 0x38, 0xF0, 0x28, 0x44, 0xF0,
+	0xF0, 0x0D, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0xF0, 0x90, 0x0D, 0xF0, 0x18, 0xF0, 0x28, 0xF0, 0xF0,
+	0xA0, 0x0B, 0xF8, 0xF0, 0x28, 0xF0, 0xF0, 0xB0, 0x0B, 0xE8, 0xF0, 0x28, 0xF0, 0xF0, 0xC0, 0x0B,
+	0xD8, 0xF0, 0x28, 0xF0, 0xF0, 0xD0, 0x0B, 0xC8, 0xF0, 0x28, 0xF0, 0xF0, 0xE0, 0x0B, 0xC7, 0xF0,
+	0x28, 0xF0, 0xF0, 0xF0, 0x0D, 0xB7, 0xF0, 0x28, 0xF0, 0xF0, 0xF0, 0x10, 0x0D, 0xA7, 0xF0, 0x28,
+	0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0xA6, 0xF0, 0x28, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0xA6, 0xF0, 0x18,
+	0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0x96, 0xF0, 0x18, 0xF0, 0xF0, 0xF0, 0x50, 0x0B, 0x96, 0xF8, 0xF0,
+	0xF0, 0xF0, 0x60, 0x0B, 0x96, 0xE8, 0xF0, 0xF0, 0xF0, 0x70, 0x0B, 0x96, 0xD8, 0xF0, 0xF0, 0xF0,
+	0x80, 0x0B, 0x96, 0xC8, 0xF0, 0xF0, 0xF0, 0x90, 0x0B, 0xA6, 0xA8, 0xF0, 0xF0, 0xF0, 0xA0, 0x0B,
+	0xA7, 0x88, 0xF0, 0xF0, 0xF0, 0xB0, 0x0B, 0xB7, 0x59, 0xF0, 0xF0, 0xF0, 0xC0, 0x0B, 0xBF, 0x05,
+	0xF0, 0xF0, 0xF0, 0xD0, 0x0B, 0xCF, 0x03, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xDF, 0x01, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x0B, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0x1A, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x30, 0x0D, 0xF0, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0x7F, 0x0B, 0xF0, 0xF0, 0xB0,
+	0x0D, 0xF0, 0x4F, 0x0F, 0x01, 0xF0, 0xF0, 0x90, 0x0D, 0xF0, 0x3F, 0x0F, 0x03, 0xF0, 0xF0, 0x80,
+	0x0D, 0xF0, 0x2F, 0x0F, 0x05, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0x1F, 0x0F, 0x07, 0xF0, 0xF0, 0x60,
+	0x0D, 0xF0, 0x1F, 0x0F, 0x08, 0xF0, 0xF0, 0x50, 0x0B, 0xF7, 0xF0, 0x7B, 0xF0, 0xF0, 0x40, 0x0B,
+	0xF6, 0xF0, 0x8C, 0xF0, 0xF0, 0x30, 0x0B, 0xF5, 0xF0, 0x9D, 0xF0, 0xF0, 0x20, 0x0B, 0xF5, 0xF0,
+	0x9E, 0xF0, 0xF0, 0x10, 0x0B, 0xF5, 0xF0, 0x96, 0x18, 0xF0, 0xF0, 0x0B, 0xF5, 0xF0, 0x96, 0x28,
+	0xF0, 0xE0, 0x0B, 0xF5, 0xF0, 0x96, 0x38, 0xF0, 0xD0, 0x0B, 0xF5, 0xF0, 0x96, 0x48, 0xF0, 0xC0,
+	0x0B, 0xF5, 0xF0, 0x96, 0x58, 0xF0, 0xB0, 0x0B, 0xF5, 0xF0, 0x96, 0x68, 0xF0, 0xA0, 0x0B, 0xF5,
+	0xF0, 0x96, 0x78, 0xF0, 0x90, 0x0B, 0xF5, 0xF0, 0x96, 0x88, 0xF0, 0x80, 0x0B, 0xF5, 0xF0, 0x96,
+	0x98, 0xF0, 0x70, 0x0B, 0xF5, 0xF0, 0x96, 0xA8, 0xF0, 0x60, 0x0B, 0xF5, 0xF0, 0x96, 0xB8, 0xF0,
+	0x50, 0x0B, 0xF5, 0xF0, 0x96, 0xC8, 0xF0, 0x40, 0x0B, 0xF5, 0xF0, 0xA5, 0xD8, 0xF0, 0x30, 0x0B,
+	0xF5, 0xF0, 0xA6, 0xD8, 0xF0, 0x20, 0x0B, 0xF5, 0xF0, 0xA8, 0xB9, 0xF0, 0x10, 0x0B, 0xF5, 0xF0,
+	0xAF, 0x0D, 0xF0, 0x10, 0x09, 0xF5, 0xF0, 0xBF, 0x0D, 0xF0, 0x09, 0xF5, 0xF0, 0xCF, 0x0C, 0xF0,
+	0x09, 0xF5, 0xF0, 0xDF, 0x0B, 0xF0, 0x09, 0xF5, 0xF0, 0xFF, 0x09, 0xF0, 0x8B, 0x24, 0xF5, 0xF0,
+	0xF0, 0xF0, 0x45, 0xF0, 0x0B, 0xF6, 0xF0, 0xF0, 0xF0, 0x26, 0xF0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7,
+	0xF0, 0x8D, 0x01, 0xF0, 0x1F, 0x0F, 0x0F, 0x0C, 0xF0, 0x10, 0x0D, 0xF0, 0x2F, 0x0F, 0x0F, 0x0A,
+	0xF0, 0x20, 0x0D, 0xF0, 0x3F, 0x0F, 0x0F, 0x08, 0xF0, 0x30, 0x0D, 0xF0, 0x4F, 0x0F, 0x0F, 0x06,
+	0xF0, 0x40, 0x0B, 0xF0, 0x7F, 0x0F, 0x0F, 0xF0, 0x70, 0x8B, 0x03, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x8B, 0x11, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xDF, 0x05, 0xF0, 0xF0, 0xF0, 0xB0,
+	0x0B, 0xBF, 0x09, 0xF0, 0xF0, 0xF0, 0x90, 0x0B, 0xAF, 0x0C, 0xF0, 0xF0, 0xF0, 0x70, 0x0B, 0x9F,
+	0x0E, 0xF0, 0xF0, 0xF0, 0x60, 0x0D, 0x8F, 0x0F, 0x01, 0xF0, 0xF0, 0xF0, 0x50, 0x0B, 0x87, 0xFA,
+	0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0x86, 0xF0, 0x48, 0xF0, 0xF0, 0xF0, 0x30, 0x0D, 0x76, 0xF0, 0x69,
+	0xF0, 0xF0, 0xF0, 0x10, 0x0B, 0x76, 0xF0, 0x79, 0xF0, 0xF0, 0xF0, 0x0B, 0x76, 0xF0, 0x8F, 0x0F,
+	0x0A, 0xD0, 0x0B, 0x76, 0xF0, 0xAF, 0x0F, 0x0A, 0xB0, 0x0B, 0x76, 0xF0, 0xBF, 0x0F, 0x0A, 0xA0,
+	0x0B, 0x76, 0xF0, 0xAF, 0x0F, 0x0C, 0x90, 0x0B, 0x76, 0xF0, 0x9F, 0x0F, 0x0E, 0x80, 0x0B, 0x76,
+	0xF0, 0x8F, 0x0F, 0x0F, 0x80, 0x0D, 0x76, 0xF0, 0x79, 0xF0, 0xF0, 0x16, 0x80, 0x0D, 0x76, 0xF0,
+	0x68, 0xF0, 0xF0, 0x46, 0x70, 0x0D, 0x76, 0xF0, 0x49, 0xF0, 0xF0, 0x56, 0x70, 0x0D, 0x7F, 0x0F,
+	0x03, 0xF0, 0xF0, 0x66, 0x70, 0x0D, 0x7F, 0x0F, 0x02, 0xF0, 0xF0, 0x76, 0x70, 0x0D, 0x7F, 0x0F,
+	0x01, 0xF0, 0xF0, 0x86, 0x70, 0x0B, 0x7F, 0x0E, 0xF0, 0xF0, 0xA6, 0x70, 0x0B, 0x7F, 0x0D, 0xF0,
+	0xF0, 0xB6, 0x70, 0x0B, 0x7F, 0x0B, 0xF0, 0xF0, 0xD6, 0x70, 0x8D, 0x1B, 0x76, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x36, 0x70, 0x0D, 0x86, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x80, 0x0B, 0x87, 0xF0, 0xF0, 0xF0,
+	0xE7, 0x80, 0x0B, 0x8F, 0x0F, 0x0F, 0x0F, 0x0D, 0x80, 0x0B, 0x9F, 0x0F, 0x0F, 0x0F, 0x0B, 0x90,
+	0x0B, 0xAF, 0x0F, 0x0F, 0x0F, 0x09, 0xA0, 0x0B, 0xBF, 0x0F, 0x0F, 0x0F, 0x07, 0xB0, 0x0B, 0xDF,
+	0x0F, 0x0F, 0x0F, 0x03, 0xD0, 0x8B, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x09, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5,
+	0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0,
+	0xA0, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D,
+	0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x59, 0x29, 0xF0, 0xF0, 0x40, 0x0D,
+	0xF0, 0xF0, 0x39, 0x59, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x29, 0x79, 0xF0, 0xF0, 0x20, 0x0D,
+	0xF0, 0xF0, 0x19, 0x99, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF9, 0xC9, 0xF0, 0xE0, 0x09, 0xF0, 0xD9,
+	0xF9, 0xF0, 0xD0, 0x0B, 0xF0, 0xC9, 0xF0, 0x29, 0xF0, 0xC0, 0x0B, 0xF0, 0xB9, 0xF0, 0x49, 0xF0,
+	0xB0, 0x0B, 0xF0, 0x99, 0xF0, 0x89, 0xF0, 0x90, 0x0B, 0xF0, 0x89, 0xF0, 0xA9, 0xF0, 0x80, 0x0B,
+	0xF0, 0x79, 0xF0, 0xC9, 0xF0, 0x70, 0x0B, 0xF0, 0x69, 0xF0, 0xE9, 0xF0, 0x60, 0x0D, 0xF0, 0x49,
+	0xF0, 0xF0, 0x39, 0xF0, 0x40, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x29,
+	0xF0, 0xF0, 0x79, 0xF0, 0x20, 0x0D, 0xF0, 0x19, 0xF0, 0xF0, 0x99, 0xF0, 0x10, 0x09, 0xF8, 0xF0,
+	0xF0, 0xD8, 0xF0, 0x09, 0xE8, 0xF0, 0xF0, 0xF8, 0xE0, 0x0B, 0xD8, 0xF0, 0xF0, 0xF0, 0x28, 0xD0,
+	0x0B, 0xD7, 0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0, 0x67, 0xC0, 0x0B, 0xC6,
+	0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x8B, 0x0D, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xB6, 0xF0,
+	0x6D, 0xF0, 0x66, 0xB0, 0x0D, 0xB6, 0xF0, 0x4F, 0x02, 0xF0, 0x46, 0xB0, 0x0D, 0xB6, 0xF0, 0x3F,
+	0x04, 0xF0, 0x36, 0xB0, 0x8D, 0x01, 0xB6, 0xF0, 0x2F, 0x06, 0xF0, 0x26, 0xB0, 0x0D, 0xB6, 0xF0,
+	0x1F, 0x08, 0xF0, 0x16, 0xB0, 0x8D, 0x11, 0xB6, 0xF0, 0x16, 0xB6, 0xF0, 0x16, 0xB0, 0x89, 0x02,
+	0xBF, 0x0D, 0xBF, 0x0D, 0xB0, 0x09, 0xCF, 0x0B, 0xDF, 0x0B, 0xC0, 0x09, 0xDF, 0x09, 0xFF, 0x09,
+	0xD0, 0x0B, 0xEF, 0x07, 0xF0, 0x2F, 0x07, 0xE0, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0B,
+	0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0,
+	0xF0, 0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0,
+	0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x1A, 0x7A, 0xF0, 0xF0, 0x10, 0x09, 0xF0,
+	0xF9, 0xB9, 0xF0, 0xF0, 0x09, 0xF0, 0xE8, 0xF8, 0xF0, 0xE0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0,
+	0xE0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x8B,
+	0x01, 0xF0, 0xC6, 0xF0, 0x86, 0xF0, 0xC0, 0x0B, 0xF0, 0xB6, 0xF0, 0xA5, 0xF0, 0xC0, 0x8B, 0x07,
+	0xF0, 0xB6, 0xF0, 0xA6, 0xF0, 0xB0, 0x0B, 0xF0, 0xC5, 0xF0, 0xA5, 0xF0, 0xC0, 0x8B, 0x01, 0xF0,
+	0xC6, 0xF0, 0x86, 0xF0, 0xC0, 0x0B, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x0B, 0xF0, 0xD7, 0xF0,
+	0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x09, 0xF0, 0xE8, 0xF8, 0xF0, 0xE0,
+	0x09, 0xF0, 0xF9, 0xB9, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x1A, 0x7A, 0xF0, 0xF0, 0x10, 0x0D, 0xF0,
+	0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0,
+	0xF0, 0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0,
+	0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0x4F,
+	0x0F, 0x0F, 0x06, 0xF0, 0x40, 0x0D, 0xF0, 0x3F, 0x0F, 0x0F, 0x08, 0xF0, 0x30, 0x0D, 0xF0, 0x2F,
+	0x0F, 0x0F, 0x0A, 0xF0, 0x20, 0x0D, 0xF0, 0x1F, 0x0F, 0x0F, 0x0C, 0xF0, 0x10, 0x09, 0xFF, 0x0F,
+	0x0F, 0x0E, 0xF0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0B, 0xF6, 0xF0, 0xF0, 0xF0, 0x26, 0xF0,
+	0x8B, 0x03, 0xF5, 0xF0, 0xF0, 0xF0, 0x45, 0xF0, 0x8B, 0x02, 0xF6, 0xF0, 0xF0, 0xF0, 0x26, 0xF0,
+	0x0D, 0xF6, 0xF0, 0xF0, 0xF0, 0x25, 0xF0, 0x10, 0x0D, 0xF0, 0x16, 0xF0, 0xF0, 0xF6, 0xF0, 0x10,
+	0x0D, 0xF0, 0x17, 0xF0, 0xF0, 0xD7, 0xF0, 0x10, 0x0D, 0xF0, 0x27, 0xF0, 0xF0, 0xB7, 0xF0, 0x20,
+	0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0, 0x38, 0xF0, 0xF0, 0x78, 0xF0, 0x30,
+	0x0D, 0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0, 0x40, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0B,
+	0xF0, 0x6C, 0xF0, 0x8C, 0xF0, 0x60, 0x0D, 0xF0, 0x7F, 0x01, 0xDF, 0x01, 0xF0, 0x70, 0x0B, 0xF0,
+	0x9F, 0x0F, 0x0B, 0xF0, 0x90, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0B, 0xF0, 0xDF, 0x0F,
+	0x03, 0xF0, 0xD0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0,
+	0x40, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x8B, 0x12, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x44, 0x60,
+	0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0x60, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x26, 0x60,
+	0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x17, 0x60, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x60, 0x0B,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE8, 0x70, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xD8, 0x80, 0x0B, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xC8, 0x90, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xB8, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xA8, 0xB0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x98, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x88, 0xD0,
+	0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0xE0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x68, 0xF0, 0x0D, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x58, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x48, 0xF0, 0x20, 0x0D, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x38, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0x28, 0xF0, 0x40, 0x0D, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x18, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0x60, 0x0B, 0xF0, 0xF0,
+	0xF0, 0xE8, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0xF0, 0xD8, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0xF0, 0xC8,
+	0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xF0, 0xB8, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0xA8, 0xF0, 0xB0,
+	0x0B, 0xF0, 0xF0, 0xF0, 0x98, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0x88, 0xF0, 0xD0, 0x0B, 0x81,
+	0xF0, 0xF0, 0xD8, 0xF0, 0xE0, 0x0B, 0x65, 0xF0, 0xF0, 0xA8, 0xF0, 0xF0, 0x0D, 0x66, 0xF0, 0xF0,
+	0x88, 0xF0, 0xF0, 0x10, 0x0D, 0x67, 0xF0, 0xF0, 0x68, 0xF0, 0xF0, 0x20, 0x0D, 0x68, 0xF0, 0xF0,
+	0x48, 0xF0, 0xF0, 0x30, 0x0D, 0x78, 0xF0, 0xF0, 0x28, 0xF0, 0xF0, 0x40, 0x0B, 0x88, 0xF0, 0xF8,
+	0xF0, 0xF0, 0x50, 0x0B, 0x98, 0xF0, 0xD8, 0xF0, 0xF0, 0x60, 0x0B, 0xA8, 0xF0, 0xB8, 0xF0, 0xF0,
+	0x70, 0x0B, 0xB8, 0xF0, 0x98, 0xF0, 0xF0, 0x80, 0x0B, 0xC8, 0xF0, 0x78, 0xF0, 0xF0, 0x90, 0x0B,
+	0xD8, 0xF0, 0x58, 0xF0, 0xF0, 0xA0, 0x0B, 0xE8, 0xF0, 0x38, 0xF0, 0xF0, 0xB0, 0x0B, 0xF8, 0xF0,
+	0x18, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0x18, 0xE8, 0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0x28, 0xC8, 0xF0,
+	0xF0, 0xE0, 0x0B, 0xF0, 0x38, 0xA8, 0xF0, 0xF0, 0xF0, 0x0D, 0xF0, 0x48, 0x88, 0xF0, 0xF0, 0xF0,
+	0x10, 0x0D, 0xF0, 0x58, 0x68, 0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0x68, 0x48, 0xF0, 0xF0, 0xF0,
+	0x30, 0x0D, 0xF0, 0x78, 0x28, 0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0x8F, 0x01, 0xF0, 0xF0, 0xF0,
+	0x50, 0x0B, 0xF0, 0x9E, 0xF0, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xAC, 0xF0, 0xF0, 0xF0, 0x70, 0x0B,
+	0xF0, 0xBA, 0xF0, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xC8, 0xF0, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xD6,
+	0xF0, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xE4, 0xF0, 0xF0, 0xF0, 0xB0, 0x8B, 0x0E, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x8B, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xE3, 0xF0, 0xF0, 0xF0,
+	0xA3, 0xE0, 0x0B, 0xD5, 0xF0, 0xF0, 0xF0, 0x85, 0xD0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0,
+	0x0B, 0xD7, 0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x09, 0xF7,
+	0xF0, 0xF0, 0xF7, 0xF0, 0x0D, 0xF0, 0x17, 0xF0, 0xF0, 0xD7, 0xF0, 0x10, 0x0D, 0xF0, 0x27, 0xF0,
+	0xF0, 0xB7, 0xF0, 0x20, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0, 0x47, 0xF0,
+	0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x67, 0xF0,
+	0xF0, 0x37, 0xF0, 0x60, 0x0D, 0xF0, 0x77, 0xF0, 0xF0, 0x17, 0xF0, 0x70, 0x0B, 0xF0, 0x87, 0xF0,
+	0xE7, 0xF0, 0x80, 0x0B, 0xF0, 0x97, 0xF0, 0xC7, 0xF0, 0x90, 0x0B, 0xF0, 0xA7, 0xF0, 0xA7, 0xF0,
+	0xA0, 0x0B, 0xF0, 0xB7, 0xF0, 0x87, 0xF0, 0xB0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B,
+	0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x09, 0xF0, 0xF7,
+	0xF7, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x27, 0xB7,
+	0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x37, 0x97, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x47, 0x77,
+	0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x57, 0x57, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x67, 0x37,
+	0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0,
+	0x80, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x02, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0,
+	0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0,
+	0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0,
+	0x57, 0x57, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0,
+	0x37, 0x97, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x27, 0xB7, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0,
+	0x17, 0xD7, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF7, 0xF7, 0xF0, 0xF0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27,
+	0xF0, 0xE0, 0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xB7, 0xF0, 0x87, 0xF0, 0xB0, 0x0B, 0xF0, 0xA7, 0xF0, 0xA7, 0xF0, 0xA0, 0x0B, 0xF0,
+	0x97, 0xF0, 0xC7, 0xF0, 0x90, 0x0B, 0xF0, 0x87, 0xF0, 0xE7, 0xF0, 0x80, 0x0D, 0xF0, 0x77, 0xF0,
+	0xF0, 0x17, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60, 0x0D, 0xF0, 0x57, 0xF0,
+	0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x37, 0xF0,
+	0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0, 0x27, 0xF0, 0xF0, 0xB7, 0xF0, 0x20, 0x0D, 0xF0, 0x17, 0xF0,
+	0xF0, 0xD7, 0xF0, 0x10, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27,
+	0xE0, 0x0B, 0xD7, 0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B,
+	0xD5, 0xF0, 0xF0, 0xF0, 0x85, 0xD0, 0x0B, 0xE3, 0xF0, 0xF0, 0xF0, 0xA3, 0xE0, 0x8B, 0x0A, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0,
+	0xD3, 0xF0, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0,
+	0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x8B, 0x01, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0,
+	0x70, 0x0D, 0xF0, 0xF0, 0x67, 0x37, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x66, 0x56, 0xF0, 0xF0,
+	0x60, 0x0D, 0xF0, 0xF0, 0x56, 0x76, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0,
+	0x40, 0x0D, 0xF0, 0xF0, 0x46, 0x96, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x37, 0x97, 0xF0, 0xF0,
+	0x30, 0x0D, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x27, 0xB7, 0xF0, 0xF0,
+	0x20, 0x0D, 0xF0, 0xF0, 0x26, 0xD6, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x17, 0xD7, 0xF0, 0xF0,
+	0x10, 0x0D, 0xF0, 0xF0, 0x16, 0xF6, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF6, 0xF0, 0x26, 0xF0, 0xF0,
+	0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x0B, 0xF0, 0xE6, 0xF0, 0x46, 0xF0, 0xE0, 0x0B, 0xF0,
+	0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0x93, 0x96, 0xF0, 0xD0, 0x0B, 0xF0, 0xC7, 0x85,
+	0x87, 0xF0, 0xC0, 0x0B, 0xF0, 0xC6, 0x95, 0x96, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0x95, 0x97, 0xF0,
+	0xB0, 0x0B, 0xF0, 0xB6, 0xA5, 0xA6, 0xF0, 0xB0, 0x0B, 0xF0, 0xA6, 0xB5, 0xB6, 0xF0, 0xA0, 0x0B,
+	0xF0, 0x97, 0xB5, 0xB7, 0xF0, 0x90, 0x0B, 0xF0, 0x96, 0xC5, 0xC6, 0xF0, 0x90, 0x0B, 0xF0, 0x87,
+	0xC5, 0xC7, 0xF0, 0x80, 0x0B, 0xF0, 0x86, 0xD5, 0xD6, 0xF0, 0x80, 0x0B, 0xF0, 0x77, 0xD5, 0xD7,
+	0xF0, 0x70, 0x0B, 0xF0, 0x76, 0xE5, 0xE6, 0xF0, 0x70, 0x0B, 0xF0, 0x67, 0xE5, 0xE7, 0xF0, 0x60,
+	0x0B, 0xF0, 0x66, 0xF5, 0xF6, 0xF0, 0x60, 0x0F, 0xF0, 0x56, 0xF0, 0x15, 0xF0, 0x16, 0xF0, 0x50,
+	0x0F, 0xF0, 0x47, 0xF0, 0x15, 0xF0, 0x17, 0xF0, 0x40, 0x0F, 0xF0, 0x46, 0xF0, 0x25, 0xF0, 0x26,
+	0xF0, 0x40, 0x0F, 0xF0, 0x37, 0xF0, 0x25, 0xF0, 0x27, 0xF0, 0x30, 0x0F, 0xF0, 0x36, 0xF0, 0x35,
+	0xF0, 0x36, 0xF0, 0x30, 0x0F, 0xF0, 0x27, 0xF0, 0x35, 0xF0, 0x37, 0xF0, 0x20, 0x0F, 0xF0, 0x26,
+	0xF0, 0x45, 0xF0, 0x46, 0xF0, 0x20, 0x0F, 0xF0, 0x17, 0xF0, 0x45, 0xF0, 0x47, 0xF0, 0x10, 0x0F,
+	0xF0, 0x16, 0xF0, 0x55, 0xF0, 0x56, 0xF0, 0x10, 0x0B, 0xF6, 0xF0, 0x73, 0xF0, 0x76, 0xF0, 0x0B,
+	0xF6, 0xF0, 0xF0, 0xF0, 0x26, 0xF0, 0x0B, 0xE6, 0xF0, 0xF0, 0xF0, 0x46, 0xE0, 0x0B, 0xD7, 0xF0,
+	0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0,
+	0x67, 0xC0, 0x0B, 0xC6, 0xF0, 0xA3, 0xF0, 0xA6, 0xC0, 0x0B, 0xB7, 0xF0, 0x95, 0xF0, 0x97, 0xB0,
+	0x0B, 0xB6, 0xF0, 0x97, 0xF0, 0x96, 0xB0, 0x8B, 0x01, 0xA6, 0xF0, 0xA7, 0xF0, 0xA6, 0xA0, 0x0B,
+	0x96, 0xF0, 0xB7, 0xF0, 0xB6, 0x90, 0x0B, 0x87, 0xF0, 0xC5, 0xF0, 0xC7, 0x80, 0x0B, 0x86, 0xF0,
+	0xE3, 0xF0, 0xE6, 0x80, 0x0D, 0x86, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x80, 0x0D, 0x85, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x35, 0x80, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0x36, 0x70, 0x0D, 0x85, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x35, 0x80, 0x0D, 0x86, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x80, 0x0B, 0x8F, 0x0F, 0x0F,
+	0x0F, 0x0D, 0x80, 0x8B, 0x01, 0x9F, 0x0F, 0x0F, 0x0F, 0x0B, 0x90, 0x0B, 0xAF, 0x0F, 0x0F, 0x0F,
+	0x09, 0xA0, 0x0B, 0xBF, 0x0F, 0x0F, 0x0F, 0x07, 0xB0, 0x0B, 0xDF, 0x0F, 0x0F, 0x0F, 0x03, 0xD0,
+	0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D,
+	0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0B, 0xF0, 0xDF,
+	0x0F, 0x03, 0xF0, 0xD0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x09, 0xF0, 0x9F, 0xBF, 0xF0,
+	0x90, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x0B, 0xF0, 0x6B, 0xF0, 0xAB, 0xF0, 0x60, 0x0B,
+	0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0D, 0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0, 0x40, 0x0D, 0xF0,
+	0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0, 0x20, 0x0D, 0xF0,
+	0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x09, 0xF8, 0xF0, 0xF0, 0xD8, 0xF0, 0x09, 0xF7, 0xF0, 0xF0,
+	0xF7, 0xF0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x0B, 0xD7, 0xF0, 0x83, 0xF0, 0x87, 0xD0,
+	0x0B, 0xD6, 0xF0, 0x85, 0xF0, 0x86, 0xD0, 0x0B, 0xC7, 0xF0, 0x85, 0xF0, 0x87, 0xC0, 0x0B, 0xC6,
+	0xF0, 0x95, 0xF0, 0x96, 0xC0, 0x8B, 0x01, 0xB6, 0xF0, 0xA5, 0xF0, 0xA6, 0xB0, 0x8B, 0x01, 0xA6,
+	0xF0, 0xB5, 0xF0, 0xB6, 0xA0, 0x8B, 0x02, 0x96, 0xF0, 0xC5, 0xF0, 0xC6, 0x90, 0x0B, 0x95, 0xF0,
+	0xD5, 0xF0, 0xD5, 0x90, 0x8B, 0x02, 0x86, 0xF0, 0xD5, 0xF0, 0xD6, 0x80, 0x8B, 0x02, 0x85, 0xF0,
+	0xE5, 0xF0, 0xE5, 0x80, 0x0B, 0x76, 0xF0, 0xE5, 0xF0, 0xE5, 0x80, 0x8B, 0x02, 0x76, 0xF0, 0xE5,
+	0xF0, 0xE6, 0x70, 0x0B, 0x76, 0xF0, 0xE5, 0xF0, 0xE5, 0x80, 0x8B, 0x02, 0x85, 0xF0, 0xE5, 0xF0,
+	0xE5, 0x80, 0x0B, 0x86, 0xF0, 0xD5, 0xF0, 0xD6, 0x80, 0x0B, 0x86, 0xF0, 0xE3, 0xF0, 0xE6, 0x80,
+	0x0D, 0x86, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x80, 0x0D, 0x95, 0xF0, 0xF0, 0xF0, 0xF0, 0x15, 0x90,
+	0x8B, 0x02, 0x96, 0xF0, 0xF0, 0xF0, 0xE6, 0x90, 0x0B, 0xA6, 0xF0, 0xD1, 0xF0, 0xD6, 0xA0, 0x0B,
+	0xA6, 0xF0, 0xB5, 0xF0, 0xB6, 0xA0, 0x8B, 0x01, 0xB6, 0xF0, 0x97, 0xF0, 0x96, 0xB0, 0x0B, 0xC6,
+	0xF0, 0x87, 0xF0, 0x86, 0xC0, 0x0B, 0xC7, 0xF0, 0x77, 0xF0, 0x77, 0xC0, 0x0B, 0xD6, 0xF0, 0x85,
+	0xF0, 0x86, 0xD0, 0x0B, 0xD7, 0xF0, 0x83, 0xF0, 0x87, 0xD0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27,
+	0xE0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x09, 0xF8, 0xF0, 0xF0, 0xD8, 0xF0, 0x0D, 0xF0, 0x18,
+	0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0, 0x20, 0x0D, 0xF0, 0x39,
+	0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0, 0x40, 0x0B, 0xF0, 0x5A,
+	0xF0, 0xEA, 0xF0, 0x50, 0x0B, 0xF0, 0x6B, 0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C,
+	0xF0, 0x80, 0x09, 0xF0, 0x9F, 0xBF, 0xF0, 0x90, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x2F,
+	0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xD3,
+	0xF0, 0xF0, 0xD0, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x08, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0,
+	0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0,
+	0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x09, 0xF0,
+	0x9F, 0xBF, 0xF0, 0x90, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x0B, 0xF0, 0x6B, 0xF0, 0xAB,
+	0xF0, 0x60, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0D, 0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0,
+	0x40, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0,
+	0x20, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x09, 0xF8, 0xF0, 0xF0, 0xD8, 0xF0, 0x09,
+	0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x0B, 0xD7, 0xF0, 0x75,
+	0xF0, 0x77, 0xD0, 0x0B, 0xD6, 0xF0, 0x5B, 0xF0, 0x56, 0xD0, 0x0B, 0xC7, 0xF0, 0x4D, 0xF0, 0x47,
+	0xC0, 0x0B, 0xC6, 0xF0, 0x4F, 0xF0, 0x46, 0xC0, 0x0D, 0xB6, 0xF0, 0x4F, 0x02, 0xF0, 0x46, 0xB0,
+	0x0D, 0xB6, 0xF0, 0x3F, 0x04, 0xF0, 0x36, 0xB0, 0x0D, 0xA6, 0xF0, 0x38, 0x58, 0xF0, 0x36, 0xA0,
+	0x0D, 0xA6, 0xF0, 0x36, 0x96, 0xF0, 0x36, 0xA0, 0x0D, 0x96, 0xF0, 0x46, 0x96, 0xF0, 0x46, 0x90,
+	0x0D, 0x96, 0xF0, 0x45, 0xB5, 0xF0, 0x46, 0x90, 0x0D, 0x96, 0xF0, 0x36, 0xB6, 0xF0, 0x36, 0x90,
+	0x0D, 0x95, 0xF0, 0x46, 0xB6, 0xF0, 0x45, 0x90, 0x0D, 0x86, 0xF0, 0x46, 0xB6, 0xF0, 0x46, 0x80,
+	0x0D, 0x86, 0xF0, 0x55, 0xB5, 0xF0, 0x56, 0x80, 0x0D, 0x86, 0xF0, 0x63, 0xC5, 0xF0, 0x56, 0x80,
+	0x0D, 0x85, 0xF0, 0xF0, 0x66, 0xF0, 0x65, 0x80, 0x0D, 0x85, 0xF0, 0xF0, 0x57, 0xF0, 0x65, 0x80,
+	0x0D, 0x85, 0xF0, 0xF0, 0x47, 0xF0, 0x75, 0x80, 0x0D, 0x76, 0xF0, 0xF0, 0x38, 0xF0, 0x75, 0x80,
+	0x0D, 0x76, 0xF0, 0xF0, 0x28, 0xF0, 0x86, 0x70, 0x0D, 0x76, 0xF0, 0xF0, 0x18, 0xF0, 0x96, 0x70,
+	0x0B, 0x76, 0xF0, 0xF8, 0xF0, 0xA6, 0x70, 0x0B, 0x76, 0xF0, 0xF7, 0xF0, 0xB5, 0x80, 0x0B, 0x85,
+	0xF0, 0xE7, 0xF0, 0xC5, 0x80, 0x0B, 0x85, 0xF0, 0xE6, 0xF0, 0xD5, 0x80, 0x0B, 0x85, 0xF0, 0xE5,
+	0xF0, 0xE5, 0x80, 0x8B, 0x02, 0x86, 0xF0, 0xD5, 0xF0, 0xD6, 0x80, 0x0B, 0x95, 0xF0, 0xE3, 0xF0,
+	0xE5, 0x90, 0x8B, 0x02, 0x96, 0xF0, 0xF0, 0xF0, 0xE6, 0x90, 0x8B, 0x01, 0xA6, 0xF0, 0xF0, 0xF0,
+	0xC6, 0xA0, 0x0B, 0xB6, 0xF0, 0xB3, 0xF0, 0xB6, 0xB0, 0x0B, 0xB6, 0xF0, 0xA5, 0xF0, 0xA6, 0xB0,
+	0x0B, 0xC6, 0xF0, 0x87, 0xF0, 0x86, 0xC0, 0x0B, 0xC7, 0xF0, 0x77, 0xF0, 0x77, 0xC0, 0x0B, 0xD6,
+	0xF0, 0x77, 0xF0, 0x76, 0xD0, 0x0B, 0xD7, 0xF0, 0x67, 0xF0, 0x67, 0xD0, 0x0B, 0xE7, 0xF0, 0x65,
+	0xF0, 0x67, 0xE0, 0x0B, 0xF7, 0xF0, 0x63, 0xF0, 0x67, 0xF0, 0x09, 0xF8, 0xF0, 0xF0, 0xD8, 0xF0,
+	0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0, 0x20,
+	0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0, 0x40,
+	0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0B, 0xF0, 0x6B, 0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0,
+	0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x09, 0xF0, 0x9F, 0xBF, 0xF0, 0x90, 0x0B, 0xF0, 0xBF, 0x0F, 0x07,
+	0xF0, 0xB0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D,
+	0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B,
+	0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x08,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0,
+	0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0xFF,
+	0x0E, 0xF0, 0xF0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0,
+	0xB0, 0x09, 0xF0, 0x9F, 0xBF, 0xF0, 0x90, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x0B, 0xF0,
+	0x6B, 0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0D, 0xF0, 0x49, 0xF0,
+	0xF0, 0x39, 0xF0, 0x40, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x28, 0xF0,
+	0xF0, 0x98, 0xF0, 0x20, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x09, 0xF8, 0xF0, 0xF0,
+	0xD8, 0xF0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x0B,
+	0xD7, 0xF0, 0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B, 0xC7, 0xF0,
+	0xF0, 0xF0, 0x67, 0xC0, 0x0B, 0xC6, 0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x8B, 0x01, 0xB6, 0xF0, 0xF0,
+	0xF0, 0xA6, 0xB0, 0x8B, 0x01, 0xA6, 0xF0, 0xF0, 0xF0, 0xC6, 0xA0, 0x0B, 0x96, 0xF0, 0xF0, 0xF0,
+	0xE6, 0x90, 0x0B, 0x96, 0xBF, 0x0F, 0x07, 0xB6, 0x90, 0x0B, 0x96, 0x8F, 0x0F, 0x0D, 0x86, 0x90,
+	0x0B, 0x95, 0x8F, 0x0F, 0x0F, 0x85, 0x90, 0x8D, 0x02, 0x86, 0x7F, 0x0F, 0x0F, 0x02, 0x76, 0x80,
+	0x8D, 0x02, 0x85, 0x76, 0xF0, 0xF0, 0x76, 0x75, 0x80, 0x0D, 0x76, 0x76, 0xF0, 0xF0, 0x76, 0x75,
+	0x80, 0x8D, 0x02, 0x76, 0x76, 0xF0, 0xF0, 0x76, 0x76, 0x70, 0x0D, 0x76, 0x76, 0xF0, 0xF0, 0x76,
+	0x75, 0x80, 0x0D, 0x85, 0x76, 0xF0, 0xF0, 0x76, 0x75, 0x80, 0x8D, 0x01, 0x85, 0x8F, 0x0F, 0x0F,
+	0x02, 0x85, 0x80, 0x0D, 0x86, 0x7F, 0x0F, 0x0F, 0x02, 0x76, 0x80, 0x0B, 0x86, 0x8F, 0x0F, 0x0F,
+	0x86, 0x80, 0x0B, 0x86, 0x9F, 0x0F, 0x0D, 0x96, 0x80, 0x0B, 0x95, 0xBF, 0x0F, 0x09, 0xB5, 0x90,
+	0x8B, 0x02, 0x96, 0xF0, 0xF0, 0xF0, 0xE6, 0x90, 0x8B, 0x01, 0xA6, 0xF0, 0xF0, 0xF0, 0xC6, 0xA0,
+	0x8B, 0x01, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xC6, 0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x0B,
+	0xC7, 0xF0, 0xF0, 0xF0, 0x67, 0xC0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B, 0xD7, 0xF0,
+	0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7,
+	0xF0, 0x09, 0xF8, 0xF0, 0xF0, 0xD8, 0xF0, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x0D,
+	0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0, 0x20, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D,
+	0xF0, 0x49, 0xF0, 0xF0, 0x39, 0xF0, 0x40, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0B, 0xF0,
+	0x6B, 0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x09, 0xF0, 0x9F, 0xBF,
+	0xF0, 0x90, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0,
+	0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0,
+	0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x04, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0,
+	0xA5, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x97, 0xF0, 0xF0, 0xD0, 0x8B, 0x01, 0xF0, 0xF0, 0x8A,
+	0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7C, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x6D, 0xF0, 0xF0,
+	0xA0, 0x0D, 0xF0, 0xF0, 0x66, 0x26, 0xF0, 0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0x57, 0x26, 0xF0, 0xF0,
+	0x90, 0x0D, 0xF0, 0xF0, 0x47, 0x36, 0xF0, 0xF0, 0x90, 0x8D, 0x01, 0xF0, 0xF0, 0x37, 0x46, 0xF0,
+	0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0x27, 0x56, 0xF0, 0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0x17, 0x66, 0xF0,
+	0xF0, 0x90, 0x0B, 0xF0, 0xF7, 0x76, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF7, 0x75, 0xF0, 0xF0, 0xA0,
+	0x0B, 0xF0, 0xE7, 0x76, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xD7, 0x86, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0,
+	0xC7, 0x96, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xB8, 0x86, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xB7, 0x96,
+	0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xA7, 0xA6, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0x97, 0xA6, 0xF0, 0xF0,
+	0xC0, 0x0B, 0xF0, 0x87, 0xB6, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0x78, 0xB6, 0xF0, 0xF0, 0xC0, 0x0B,
+	0xF0, 0x68, 0xCF, 0x0B, 0xF0, 0x70, 0x0B, 0xF0, 0x58, 0xDF, 0x0C, 0xF0, 0x60, 0x0B, 0xF0, 0x57,
+	0xEF, 0x0D, 0xF0, 0x50, 0x0D, 0xF0, 0x47, 0xF0, 0x1F, 0x0D, 0xF0, 0x40, 0x0D, 0xF0, 0x46, 0xF0,
+	0x3F, 0x0D, 0xF0, 0x30, 0x0D, 0xF0, 0x36, 0xF0, 0xF0, 0xA7, 0xF0, 0x30, 0x0D, 0xF0, 0x36, 0xF0,
+	0xF0, 0xB7, 0xF0, 0x20, 0x0D, 0xF0, 0x26, 0xF0, 0xF0, 0xD6, 0xF0, 0x20, 0x8D, 0x01, 0xF0, 0x26,
+	0xF0, 0xF0, 0xE5, 0xF0, 0x20, 0x8D, 0x01, 0xF0, 0x25, 0xF0, 0xF0, 0xF5, 0xF0, 0x20, 0x8D, 0x04,
+	0xF0, 0x25, 0xF0, 0xF0, 0xE6, 0xF0, 0x20, 0x8D, 0x01, 0xF0, 0x25, 0xF0, 0xF0, 0xE5, 0xF0, 0x30,
+	0x8D, 0x04, 0xF0, 0x25, 0xF0, 0xF0, 0xD6, 0xF0, 0x30, 0x8D, 0x01, 0xF0, 0x25, 0xF0, 0xF0, 0xD5,
+	0xF0, 0x40, 0x0D, 0xF0, 0x25, 0xF0, 0xF0, 0xC6, 0xF0, 0x40, 0x8D, 0x02, 0xF0, 0x26, 0xF0, 0xF0,
+	0xB6, 0xF0, 0x40, 0x0D, 0xF0, 0x35, 0xF0, 0xF0, 0xB6, 0xF0, 0x40, 0x8D, 0x01, 0xF0, 0x36, 0xF0,
+	0xF0, 0xA5, 0xF0, 0x50, 0x0D, 0xF0, 0x46, 0xF0, 0xF0, 0x86, 0xF0, 0x50, 0x0D, 0xF0, 0x47, 0xF0,
+	0xF0, 0x76, 0xF0, 0x50, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x66, 0xF0, 0x50, 0x0D, 0xF0, 0x58, 0xF0,
+	0xF0, 0x46, 0xF0, 0x60, 0x0D, 0xF0, 0x68, 0xF0, 0xF0, 0x36, 0xF0, 0x60, 0x0B, 0xF0, 0x79, 0xF0,
+	0xE8, 0xF0, 0x60, 0x0B, 0xF0, 0x8A, 0xF0, 0xB8, 0xF0, 0x70, 0x0B, 0xF0, 0x9F, 0x0F, 0x0C, 0xF0,
+	0x80, 0x0B, 0xF0, 0xAF, 0x0F, 0x0A, 0xF0, 0x90, 0x0B, 0xF0, 0xCF, 0x0F, 0x07, 0xF0, 0xA0, 0x0B,
+	0xF0, 0xDF, 0x0F, 0x05, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x1F, 0x0F, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0,
+	0x4F, 0x09, 0xF0, 0xF0, 0x10, 0x8B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x07, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x0D, 0xF0, 0xF0, 0x6F,
+	0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x09, 0xF0, 0xFF, 0x0E,
+	0xF0, 0xF0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0,
+	0x09, 0xF0, 0x9F, 0xBF, 0xF0, 0x90, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x0B, 0xF0, 0x6B,
+	0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0D, 0xF0, 0x49, 0xF0, 0xF0,
+	0x39, 0xF0, 0x40, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x28, 0xF0, 0xF0,
+	0x98, 0xF0, 0x20, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x09, 0xF8, 0xF0, 0xF0, 0xD8,
+	0xF0, 0x0B, 0xF7, 0xF0, 0x42, 0xF0, 0x97, 0xF0, 0x0B, 0xE7, 0xF0, 0x35, 0xF0, 0x97, 0xE0, 0x0B,
+	0xD7, 0xF0, 0x45, 0xF0, 0xA7, 0xD0, 0x0B, 0xD6, 0xF0, 0x56, 0xF0, 0xA6, 0xD0, 0x0B, 0xC7, 0xF0,
+	0x56, 0xF0, 0xA7, 0xC0, 0x0B, 0xC6, 0xF0, 0x66, 0xF0, 0xB6, 0xC0, 0x8B, 0x01, 0xB6, 0xF0, 0x76,
+	0xF0, 0xC6, 0xB0, 0x8B, 0x01, 0xA6, 0xF0, 0x86, 0xF0, 0xD6, 0xA0, 0x8B, 0x02, 0x96, 0xF0, 0x96,
+	0xF0, 0xE6, 0x90, 0x0B, 0x95, 0xF0, 0xA6, 0xF0, 0xF5, 0x90, 0x8B, 0x02, 0x86, 0xF0, 0xA6, 0xF0,
+	0xF6, 0x80, 0x8D, 0x02, 0x85, 0xF0, 0xB6, 0xF0, 0xF0, 0x15, 0x80, 0x0D, 0x76, 0xF0, 0xB6, 0xF0,
+	0xF0, 0x15, 0x80, 0x8D, 0x01, 0x76, 0xF0, 0xB6, 0xF0, 0xF0, 0x16, 0x70, 0x0B, 0x76, 0xF0, 0xB7,
+	0xF0, 0xF6, 0x70, 0x0B, 0x76, 0xF0, 0xB8, 0xF0, 0xE5, 0x80, 0x0B, 0x85, 0xF0, 0xC8, 0xF0, 0xD5,
+	0x80, 0x0B, 0x85, 0xF0, 0xD8, 0xF0, 0xC5, 0x80, 0x0B, 0x85, 0xF0, 0xE8, 0xF0, 0xB5, 0x80, 0x0B,
+	0x86, 0xF0, 0xE8, 0xF0, 0x96, 0x80, 0x0B, 0x86, 0xF0, 0xF8, 0xF0, 0x86, 0x80, 0x0D, 0x86, 0xF0,
+	0xF0, 0x18, 0xF0, 0x76, 0x80, 0x0D, 0x95, 0xF0, 0xF0, 0x27, 0xF0, 0x75, 0x90, 0x0D, 0x96, 0xF0,
+	0xF0, 0x27, 0xF0, 0x56, 0x90, 0x0D, 0x96, 0xF0, 0xF0, 0x36, 0xF0, 0x56, 0x90, 0x0D, 0x96, 0xF0,
+	0xF0, 0x44, 0xF0, 0x66, 0x90, 0x8B, 0x01, 0xA6, 0xF0, 0xF0, 0xF0, 0xC6, 0xA0, 0x8B, 0x01, 0xB6,
+	0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B, 0xC6, 0xF0, 0xF0, 0xF0, 0x86, 0xC0, 0x0B, 0xC7, 0xF0, 0xF0,
+	0xF0, 0x67, 0xC0, 0x0B, 0xD6, 0xF0, 0xF0, 0xF0, 0x66, 0xD0, 0x0B, 0xD7, 0xF0, 0xF0, 0xF0, 0x47,
+	0xD0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0, 0x27, 0xE0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x09, 0xF8,
+	0xF0, 0xF0, 0xD8, 0xF0, 0x0D, 0xF0, 0x18, 0xF0, 0xF0, 0xB8, 0xF0, 0x10, 0x0D, 0xF0, 0x28, 0xF0,
+	0xF0, 0x98, 0xF0, 0x20, 0x0D, 0xF0, 0x39, 0xF0, 0xF0, 0x59, 0xF0, 0x30, 0x0D, 0xF0, 0x49, 0xF0,
+	0xF0, 0x39, 0xF0, 0x40, 0x0B, 0xF0, 0x5A, 0xF0, 0xEA, 0xF0, 0x50, 0x0B, 0xF0, 0x6B, 0xF0, 0xAB,
+	0xF0, 0x60, 0x0B, 0xF0, 0x8C, 0xF0, 0x4C, 0xF0, 0x80, 0x09, 0xF0, 0x9F, 0xBF, 0xF0, 0x90, 0x0B,
+	0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x09, 0xF0, 0xFF,
+	0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x6F, 0x02,
+	0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x8B, 0x03, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xC2, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x12, 0xC0, 0x0B, 0xA5, 0xF0, 0xF0, 0xF0, 0xE5, 0xA0, 0x0B, 0xA6, 0xF0, 0xF0, 0xF0, 0xC6, 0xA0,
+	0x0B, 0xA7, 0xF0, 0xF0, 0xF0, 0xA7, 0xA0, 0x0B, 0xA8, 0xF0, 0xA3, 0xF0, 0xA8, 0xA0, 0x0B, 0xB7,
+	0xF0, 0x4F, 0xF0, 0x47, 0xB0, 0x0D, 0xC6, 0xF0, 0x1F, 0x06, 0xF0, 0x16, 0xC0, 0x09, 0xD4, 0xFF,
+	0x0A, 0xF4, 0xD0, 0x09, 0xF1, 0xFF, 0x0C, 0xF1, 0xF0, 0x0B, 0xF0, 0xEF, 0x0F, 0x01, 0xF0, 0xE0,
+	0x09, 0xF0, 0xDC, 0x9C, 0xF0, 0xD0, 0x09, 0xF0, 0xCA, 0xFA, 0xF0, 0xC0, 0x0B, 0xF0, 0xB9, 0xF0,
+	0x49, 0xF0, 0xB0, 0x0B, 0xF0, 0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0x98, 0xF0, 0xA8, 0xF0,
+	0x90, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B, 0xF0, 0x87, 0xF0, 0xE7, 0xF0, 0x80, 0x0D,
+	0xF0, 0x77, 0xF0, 0xF0, 0x17, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60, 0x0D,
+	0xF0, 0x66, 0xF0, 0xF0, 0x56, 0xF0, 0x60, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x8D,
+	0x01, 0xF0, 0x56, 0xF0, 0xF0, 0x76, 0xF0, 0x50, 0x8D, 0x01, 0xF0, 0x46, 0xF0, 0xF0, 0x96, 0xF0,
+	0x40, 0x0D, 0x19, 0x96, 0xF0, 0xF0, 0x96, 0x99, 0x10, 0x0C, 0x0B, 0x86, 0xF0, 0xF0, 0x96, 0x8B,
+	0x8C, 0x01, 0x0B, 0x85, 0xF0, 0xF0, 0xB5, 0x8B, 0x0D, 0x19, 0x95, 0xF0, 0xF0, 0xB5, 0x99, 0x10,
+	0x8D, 0x03, 0xF0, 0x45, 0xF0, 0xF0, 0xB5, 0xF0, 0x40, 0x8D, 0x02, 0xF0, 0x46, 0xF0, 0xF0, 0x96,
+	0xF0, 0x40, 0x0D, 0xF0, 0x55, 0xF0, 0xF0, 0x95, 0xF0, 0x50, 0x8D, 0x01, 0xF0, 0x56, 0xF0, 0xF0,
+	0x76, 0xF0, 0x50, 0x8D, 0x01, 0xF0, 0x66, 0xF0, 0xF0, 0x56, 0xF0, 0x60, 0x0D, 0xF0, 0x76, 0xF0,
+	0xF0, 0x36, 0xF0, 0x70, 0x0D, 0xF0, 0x77, 0xF0, 0xF0, 0x17, 0xF0, 0x70, 0x0B, 0xF0, 0x87, 0xF0,
+	0xE7, 0xF0, 0x80, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B, 0xF0, 0x98, 0xF0, 0xA8, 0xF0,
+	0x90, 0x0B, 0xD4, 0x87, 0xF0, 0xA7, 0x84, 0xD0, 0x0B, 0xC6, 0x87, 0xF0, 0x87, 0x86, 0xC0, 0x0B,
+	0xB7, 0x96, 0xF0, 0x86, 0x97, 0xB0, 0x0B, 0xA8, 0xA5, 0xF0, 0x85, 0xA8, 0xA0, 0x0B, 0xA7, 0xB6,
+	0xF0, 0x66, 0xB7, 0xA0, 0x0B, 0xA6, 0xC6, 0xF0, 0x66, 0xC6, 0xA0, 0x0B, 0xA5, 0xD6, 0xF0, 0x66,
+	0xD5, 0xA0, 0x0B, 0xB3, 0xF5, 0xF0, 0x65, 0xF3, 0xB0, 0x8B, 0x03, 0xF0, 0xE6, 0xF0, 0x46, 0xF0,
+	0xE0, 0x0B, 0xF0, 0xF5, 0xF0, 0x45, 0xF0, 0xF0, 0x89, 0x02, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x8D,
+	0x02, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x8D, 0x01, 0xF0, 0xF0, 0x16, 0xF6, 0xF0, 0xF0,
+	0x10, 0x0D, 0xF0, 0xF0, 0x25, 0xF5, 0xF0, 0xF0, 0x20, 0x8D, 0x02, 0xF0, 0xF0, 0x26, 0xD6, 0xF0,
+	0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x8D, 0x01, 0xF0, 0xF0, 0x3F, 0x08,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x5F, 0x04,
+	0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0,
+	0xA0, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x07, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xE0, 0x0D, 0xF0, 0xF0, 0xD4, 0xF0, 0xF0, 0x12, 0x90, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xA4, 0x80,
+	0x0D, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0x66, 0x70, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0x37, 0x70,
+	0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0x17, 0x80, 0x0B, 0xF0, 0xEF, 0x0F, 0x01, 0xD7, 0x90, 0x09,
+	0xF0, 0xDC, 0x9C, 0xB7, 0xA0, 0x09, 0xF0, 0xCA, 0xFA, 0x97, 0xB0, 0x0B, 0xF0, 0xB9, 0xF0, 0x48,
+	0x87, 0xC0, 0x0B, 0xF0, 0xA8, 0xF0, 0x85, 0x87, 0xD0, 0x0B, 0xF0, 0x98, 0xF0, 0xA3, 0x87, 0xE0,
+	0x0B, 0xF0, 0x88, 0xF0, 0xF0, 0x67, 0xF0, 0x0D, 0xF0, 0x87, 0xF0, 0xF0, 0x67, 0xF0, 0x10, 0x0D,
+	0xF0, 0x77, 0xF0, 0xF0, 0x67, 0xF0, 0x20, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x67, 0xF0, 0x30, 0x0D,
+	0xF0, 0x66, 0xF0, 0xF0, 0x67, 0xF0, 0x40, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D,
+	0xF0, 0x56, 0xF0, 0xF0, 0x58, 0xF0, 0x50, 0x0D, 0xF0, 0x56, 0xF0, 0xF0, 0x49, 0xF0, 0x50, 0x0D,
+	0xF0, 0x46, 0xF0, 0xF0, 0x4A, 0xF0, 0x50, 0x0D, 0xF0, 0x46, 0xF0, 0xF0, 0x3C, 0xF0, 0x40, 0x0D,
+	0xF0, 0x46, 0xF0, 0xF0, 0x2D, 0xF0, 0x40, 0x0F, 0xF0, 0x45, 0xF0, 0xF0, 0x27, 0x16, 0xF0, 0x40,
+	0x0F, 0xF0, 0x45, 0xF0, 0xF0, 0x17, 0x35, 0xF0, 0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xF7, 0x45, 0xF0,
+	0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xE7, 0x55, 0xF0, 0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xD7, 0x65, 0xF0,
+	0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xC7, 0x75, 0xF0, 0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xB7, 0x85, 0xF0,
+	0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xA7, 0x95, 0xF0, 0x40, 0x0D, 0xF0, 0x46, 0xF0, 0x87, 0x96, 0xF0,
+	0x40, 0x0D, 0xF0, 0x46, 0xF0, 0x77, 0xA6, 0xF0, 0x40, 0x0D, 0xF0, 0x46, 0xF0, 0x67, 0xB6, 0xF0,
+	0x40, 0x0D, 0xF0, 0x55, 0xF0, 0x57, 0xC5, 0xF0, 0x50, 0x0D, 0xF0, 0x56, 0xF0, 0x37, 0xC6, 0xF0,
+	0x50, 0x0D, 0xF0, 0x56, 0xF0, 0x27, 0xD6, 0xF0, 0x50, 0x0B, 0xF0, 0x66, 0xF7, 0xD6, 0xF0, 0x60,
+	0x0B, 0xF0, 0x67, 0xD7, 0xE6, 0xF0, 0x60, 0x0B, 0xF0, 0x76, 0xC7, 0xE6, 0xF0, 0x70, 0x0B, 0xF0,
+	0x77, 0xA7, 0xE7, 0xF0, 0x70, 0x0B, 0xF0, 0x87, 0x87, 0xE7, 0xF0, 0x80, 0x0B, 0xF0, 0x86, 0x87,
+	0xE8, 0xF0, 0x80, 0x0B, 0xF0, 0x94, 0x87, 0xE8, 0xF0, 0x90, 0x0B, 0xF0, 0xA2, 0x87, 0xF7, 0xF0,
+	0xA0, 0x0B, 0xF0, 0xF0, 0x47, 0xF7, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x37, 0xF0, 0x16, 0xF0, 0xC0,
+	0x0D, 0xF0, 0xF0, 0x27, 0xF0, 0x26, 0xF0, 0xC0, 0x0D, 0xF0, 0xF0, 0x17, 0xF0, 0x26, 0xF0, 0xD0,
+	0x0B, 0xF0, 0xF7, 0xF0, 0x36, 0xF0, 0xD0, 0x0B, 0xF0, 0xE7, 0xF0, 0x46, 0xF0, 0xD0, 0x0B, 0xF0,
+	0xD7, 0xF0, 0x56, 0xF0, 0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0x55, 0xF0, 0xE0, 0x0B, 0xF0, 0xB9, 0xF0,
+	0x46, 0xF0, 0xE0, 0x0B, 0xF0, 0xAA, 0xF0, 0x46, 0xF0, 0xE0, 0x0B, 0xF0, 0x9B, 0xF0, 0x46, 0xF0,
+	0xE0, 0x0B, 0xF0, 0x8C, 0xF0, 0x45, 0xF0, 0xF0, 0x0B, 0xF0, 0x7F, 0x0F, 0x07, 0xF0, 0xF0, 0x0B,
+	0xF0, 0x67, 0x2F, 0x0E, 0xF0, 0xF0, 0x0B, 0xF0, 0x57, 0x3F, 0x0E, 0xF0, 0xF0, 0x0B, 0xF0, 0x47,
+	0x5F, 0x0D, 0xF0, 0xF0, 0x0D, 0xF0, 0x37, 0x6F, 0x0C, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0x27, 0x7F,
+	0x0C, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0x17, 0x86, 0xF6, 0xF0, 0xF0, 0x10, 0x0B, 0xF7, 0x96, 0xF6,
+	0xF0, 0xF0, 0x10, 0x0B, 0xE7, 0xB5, 0xF5, 0xF0, 0xF0, 0x20, 0x0B, 0xD7, 0xC6, 0xD6, 0xF0, 0xF0,
+	0x20, 0x0B, 0xC7, 0xD6, 0xD6, 0xF0, 0xF0, 0x20, 0x0B, 0xB7, 0xE6, 0xD6, 0xF0, 0xF0, 0x20, 0x0D,
+	0xA7, 0xF0, 0x16, 0xB6, 0xF0, 0xF0, 0x30, 0x0D, 0x97, 0xF0, 0x2F, 0x08, 0xF0, 0xF0, 0x30, 0x0D,
+	0x87, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0x77, 0xF0, 0x5F, 0x06, 0xF0, 0xF0, 0x40, 0x0D,
+	0x76, 0xF0, 0x7F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0x84, 0xF0, 0x9F, 0x02, 0xF0, 0xF0, 0x60, 0x0B,
+	0x92, 0xF0, 0xDB, 0xF0, 0xF0, 0x90, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x06,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0,
+	0x8D, 0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x6F, 0x02,
+	0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x48, 0x58,
+	0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x47, 0x77, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x37, 0x97,
+	0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x36, 0xB6, 0xF0, 0xF0, 0x30, 0x8D, 0x01, 0xF0, 0xF0, 0x35,
+	0xD5, 0xF0, 0xF0, 0x30, 0x8D, 0x02, 0xF0, 0xF0, 0x26, 0xD6, 0xF0, 0xF0, 0x20, 0x0B, 0xF0, 0xF0,
+	0x26, 0xDA, 0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0x26, 0xDB, 0xF0, 0xC0, 0x8B, 0x02, 0xF0, 0xF0, 0x26,
+	0xDC, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x26, 0xDB, 0xF0, 0xC0, 0x8D, 0x03, 0xF0, 0xF0, 0x26, 0xD6,
+	0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x26, 0x53, 0x5B, 0xF0, 0xC0, 0x8D, 0x02, 0xF0, 0xF0, 0x26,
+	0x45, 0x4C, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x26, 0x45, 0x4B, 0xF0, 0xC0, 0x8F, 0x03, 0xF0, 0xF0,
+	0x26, 0x45, 0x46, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x26, 0x45, 0x4B, 0xF0, 0xC0, 0x8D, 0x02,
+	0xF0, 0xF0, 0x26, 0x45, 0x4C, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x26, 0x45, 0x4B, 0xF0, 0xC0, 0x0D,
+	0xF0, 0xF0, 0x26, 0x45, 0x49, 0xF0, 0xE0, 0x8F, 0x06, 0xF0, 0xF0, 0x26, 0x45, 0x46, 0xF0, 0xF0,
+	0x20, 0x0F, 0xF0, 0xF0, 0x17, 0x45, 0x47, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF8, 0x45, 0x48, 0xF0,
+	0xF0, 0x0B, 0xF0, 0xE8, 0x55, 0x58, 0xF0, 0xE0, 0x0B, 0xF0, 0xE7, 0x65, 0x67, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xD7, 0x67, 0x67, 0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0x5B, 0x56, 0xF0, 0xD0, 0x0B, 0xF0, 0xC6,
+	0x5D, 0x56, 0xF0, 0xC0, 0x0B, 0xF0, 0xC6, 0x4F, 0x46, 0xF0, 0xC0, 0x0D, 0xF0, 0xB6, 0x4F, 0x02,
+	0x45, 0xF0, 0xC0, 0x8D, 0x01, 0xF0, 0xB6, 0x4F, 0x02, 0x46, 0xF0, 0xB0, 0x8D, 0x03, 0xF0, 0xB6,
+	0x3F, 0x04, 0x36, 0xF0, 0xB0, 0x8D, 0x01, 0xF0, 0xB6, 0x4F, 0x02, 0x46, 0xF0, 0xB0, 0x0D, 0xF0,
+	0xC5, 0x4F, 0x01, 0x55, 0xF0, 0xC0, 0x0B, 0xF0, 0xC6, 0x4F, 0x46, 0xF0, 0xC0, 0x0B, 0xF0, 0xC6,
+	0x5D, 0x56, 0xF0, 0xC0, 0x0B, 0xF0, 0xD6, 0x5B, 0x56, 0xF0, 0xD0, 0x0B, 0xF0, 0xD7, 0x67, 0x67,
+	0xF0, 0xD0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x09, 0xF0, 0xE8, 0xF8, 0xF0, 0xE0, 0x09,
+	0xF0, 0xF9, 0xB9, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x1B, 0x5B, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0,
+	0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0,
+	0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0B, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x13, 0xF0, 0xFA, 0xF0, 0x09, 0xF0, 0xF5, 0xF0, 0xDD,
+	0xD0, 0x09, 0xF0, 0xE7, 0xF0, 0xCE, 0xC0, 0x09, 0xF0, 0xD9, 0xF0, 0xBF, 0xB0, 0x09, 0xF0, 0xD9,
+	0xF0, 0xCF, 0xA0, 0x09, 0xF0, 0xCB, 0xF0, 0xCE, 0xA0, 0x0B, 0xF0, 0xBD, 0xF0, 0xF0, 0x46, 0xA0,
+	0x0B, 0xF0, 0xAF, 0xF0, 0xF0, 0x46, 0x90, 0x0D, 0xF0, 0x98, 0x17, 0xF0, 0xF0, 0x46, 0x90, 0x0D,
+	0xF0, 0x97, 0x37, 0xF0, 0xF0, 0x36, 0x90, 0x0D, 0xF0, 0x87, 0x57, 0xF0, 0xF0, 0x26, 0x90, 0x0D,
+	0xF0, 0x77, 0x77, 0xF0, 0xF0, 0x16, 0x90, 0x0D, 0xF0, 0x76, 0x87, 0xF0, 0xF0, 0x16, 0x90, 0x0B,
+	0xF0, 0x67, 0x97, 0xF0, 0xF6, 0x90, 0x0B, 0xF0, 0x57, 0xB7, 0xF0, 0xE6, 0x90, 0x0B, 0xF0, 0x56,
+	0xC7, 0xF0, 0xAA, 0x90, 0x0B, 0xF0, 0x47, 0xD7, 0xF0, 0x8B, 0x90, 0x0B, 0xF0, 0x46, 0xF6, 0xF0,
+	0x8B, 0x90, 0x0D, 0xF0, 0x36, 0xF0, 0x17, 0xF0, 0x7B, 0x90, 0x0D, 0xF0, 0x27, 0xF0, 0x26, 0xF0,
+	0x7B, 0x90, 0x0D, 0xF0, 0x26, 0xF0, 0x46, 0xF0, 0x89, 0x90, 0x0D, 0xF0, 0x17, 0xF0, 0x46, 0xF0,
+	0xB6, 0x90, 0x0D, 0xF0, 0x16, 0xF0, 0x66, 0xF0, 0xA6, 0x90, 0x0B, 0xF7, 0xF0, 0x66, 0xF0, 0xA6,
+	0x90, 0x0B, 0xFF, 0x0F, 0x05, 0xF0, 0x96, 0x90, 0x8B, 0x01, 0xEF, 0x0F, 0x07, 0xF0, 0x86, 0x90,
+	0x8B, 0x02, 0xDF, 0x0F, 0x09, 0xF0, 0x76, 0x90, 0x0B, 0xC6, 0xF0, 0xE6, 0xF0, 0x66, 0x90, 0x0B,
+	0xC6, 0xF0, 0xE6, 0xF0, 0x1B, 0x90, 0x0B, 0xB6, 0xF0, 0xF6, 0xF0, 0x1B, 0x90, 0x8B, 0x01, 0xB6,
+	0xF0, 0xF0, 0x16, 0xFB, 0x90, 0x0B, 0xA6, 0xF0, 0xF0, 0x35, 0xFB, 0x90, 0x8D, 0x02, 0xA6, 0xF0,
+	0xF0, 0x36, 0xF0, 0x46, 0x90, 0x0D, 0xA5, 0xF0, 0xF0, 0x55, 0xF0, 0x46, 0x90, 0x0D, 0x96, 0xF0,
+	0xF0, 0x55, 0xF0, 0x46, 0x90, 0x8D, 0x04, 0x96, 0xF0, 0xF0, 0x56, 0xF0, 0x36, 0x90, 0x0D, 0x96,
+	0xF0, 0xF0, 0x55, 0xF0, 0x19, 0x90, 0x0B, 0xA5, 0xF0, 0xF0, 0x55, 0xEB, 0x90, 0x8B, 0x02, 0xA6,
+	0xF0, 0xF0, 0x36, 0xEB, 0x90, 0x0D, 0xB6, 0xF0, 0xF0, 0x16, 0xF0, 0x1A, 0x90, 0x0D, 0xB6, 0xF0,
+	0xF0, 0x16, 0xF0, 0x56, 0x90, 0x0B, 0xB7, 0xF0, 0xE6, 0xF0, 0x66, 0x90, 0x0B, 0xC7, 0xF0, 0xC7,
+	0xF0, 0x66, 0x90, 0x0B, 0xD6, 0xF0, 0xB7, 0xF0, 0x76, 0x90, 0x0B, 0xD7, 0xF0, 0xA7, 0xF0, 0x76,
+	0x90, 0x0B, 0xE8, 0xF0, 0x68, 0xF0, 0x86, 0x90, 0x0B, 0xF8, 0xF0, 0x48, 0xF0, 0x96, 0x90, 0x0B,
+	0xF0, 0x19, 0xF9, 0xF0, 0xA6, 0x90, 0x0B, 0xF0, 0x2A, 0xBA, 0xF0, 0xA6, 0xA0, 0x0B, 0xF0, 0x3F,
+	0x0E, 0xF0, 0x3E, 0xA0, 0x0B, 0xF0, 0x4F, 0x0C, 0xF0, 0x3F, 0xA0, 0x0B, 0xF0, 0x5F, 0x09, 0xF0,
+	0x4F, 0xB0, 0x0B, 0xF0, 0x7F, 0x06, 0xF0, 0x5E, 0xC0, 0x09, 0xF0, 0xAF, 0xF0, 0x8D, 0xD0, 0x09,
+	0xF0, 0xD9, 0xF0, 0xCA, 0xF0, 0x8B, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x06, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xF0, 0xB7,
+	0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xA8, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x99, 0xF0, 0xF0,
+	0xB0, 0x0B, 0xF0, 0xF0, 0x8A, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x7B, 0xF0, 0xF0, 0xB0, 0x0B,
+	0xF0, 0xF0, 0x6C, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0x5D, 0xF0, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0,
+	0x48, 0x15, 0xF0, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x38, 0x25, 0xF0, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0,
+	0x28, 0x35, 0xF0, 0xF0, 0xB0, 0x0D, 0xF0, 0xF0, 0x18, 0x45, 0xF0, 0xF0, 0xB0, 0x0F, 0xF0, 0xF0,
+	0x17, 0x55, 0x73, 0xF0, 0xF0, 0x10, 0x0B, 0xF0, 0xF7, 0x65, 0x65, 0xF0, 0xF0, 0x0B, 0xF0, 0xE7,
+	0x75, 0x66, 0xF0, 0xE0, 0x0B, 0xF0, 0xD7, 0x85, 0x67, 0xF0, 0xD0, 0x8B, 0x01, 0xF0, 0xC7, 0x95,
+	0x68, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0xA5, 0x69, 0xF0, 0xB0, 0x0B, 0xF0, 0xA7, 0xB5, 0x6A, 0xF0,
+	0xA0, 0x8B, 0x01, 0xF0, 0x97, 0xC5, 0x6B, 0xF0, 0x90, 0x0B, 0xF0, 0x87, 0xD5, 0x6C, 0xF0, 0x80,
+	0x0D, 0xF0, 0x77, 0xE5, 0x65, 0x17, 0xF0, 0x70, 0x0D, 0xF0, 0x76, 0xF6, 0x46, 0x26, 0xF0, 0x70,
+	0x0D, 0xF0, 0x67, 0xFF, 0x01, 0x27, 0xF0, 0x60, 0x0D, 0xF0, 0x66, 0xF0, 0x2E, 0x46, 0xF0, 0x60,
+	0x0D, 0xF0, 0x57, 0xF0, 0x2E, 0x47, 0xF0, 0x50, 0x0D, 0xF0, 0x56, 0xF0, 0x4C, 0x66, 0xF0, 0x50,
+	0x0D, 0xF0, 0x46, 0xF0, 0x6A, 0x86, 0xF0, 0x40, 0x0D, 0xF0, 0x46, 0xF0, 0x86, 0xA6, 0xF0, 0x40,
+	0x8D, 0x01, 0xF0, 0x36, 0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x8D, 0x02, 0xF0, 0x26, 0xF0, 0xF0, 0xD6,
+	0xF0, 0x20, 0x0D, 0xF0, 0x16, 0xF0, 0xF0, 0xF6, 0xF0, 0x10, 0x0F, 0xF0, 0x16, 0xF0, 0x63, 0xF0,
+	0x66, 0xF0, 0x10, 0x0F, 0xF0, 0x16, 0xF0, 0x47, 0xF0, 0x46, 0xF0, 0x10, 0x0F, 0xF0, 0x15, 0xF0,
+	0x57, 0xF0, 0x55, 0xF0, 0x10, 0x0B, 0xF6, 0xF0, 0x49, 0xF0, 0x46, 0xF0, 0x0B, 0xF6, 0xF0, 0x3B,
+	0xF0, 0x36, 0xF0, 0x0B, 0xF6, 0xF0, 0x2D, 0xF0, 0x26, 0xF0, 0x0B, 0xF6, 0xF0, 0x1F, 0xF0, 0x16,
+	0xF0, 0x09, 0xF6, 0xF8, 0x18, 0xF6, 0xF0, 0x0D, 0xF5, 0xF0, 0x17, 0x37, 0xF0, 0x15, 0xF0, 0x09,
+	0xF5, 0xF7, 0x57, 0xF5, 0xF0, 0x09, 0xF6, 0xD7, 0x77, 0xD6, 0xF0, 0x09, 0xF6, 0xD6, 0x96, 0xD6,
+	0xF0, 0x09, 0xF6, 0xC7, 0x97, 0xC6, 0xF0, 0x09, 0xF6, 0xB7, 0xB7, 0xB6, 0xF0, 0x09, 0xF6, 0xB6,
+	0xD6, 0xB6, 0xF0, 0x0D, 0xF0, 0x15, 0xB6, 0xD6, 0xB5, 0xF0, 0x10, 0x8D, 0x01, 0xF0, 0x16, 0x96,
+	0xF6, 0x96, 0xF0, 0x10, 0x0F, 0xF0, 0x16, 0x86, 0xF0, 0x26, 0x86, 0xF0, 0x10, 0x8F, 0x01, 0xF0,
+	0x26, 0x76, 0xF0, 0x26, 0x76, 0xF0, 0x20, 0x0F, 0xF0, 0x36, 0x66, 0xF0, 0x26, 0x66, 0xF0, 0x30,
+	0x0F, 0xF0, 0x37, 0x55, 0xF0, 0x45, 0x57, 0xF0, 0x30, 0x0F, 0xF0, 0x46, 0x55, 0xF0, 0x45, 0x56,
+	0xF0, 0x40, 0x0F, 0xF0, 0x47, 0x45, 0xF0, 0x45, 0x47, 0xF0, 0x40, 0x0F, 0xF0, 0x57, 0x35, 0xF0,
+	0x45, 0x37, 0xF0, 0x50, 0x0F, 0xF0, 0x67, 0x26, 0xF0, 0x26, 0x27, 0xF0, 0x60, 0x0F, 0xF0, 0x68,
+	0x16, 0xF0, 0x26, 0x18, 0xF0, 0x60, 0x09, 0xF0, 0x7F, 0xFF, 0xF0, 0x70, 0x09, 0xF0, 0x8E, 0xFE,
+	0xF0, 0x80, 0x09, 0xF0, 0x9E, 0xDE, 0xF0, 0x90, 0x09, 0xF0, 0xAE, 0xAF, 0xF0, 0xA0, 0x09, 0xF0,
+	0xCF, 0x5F, 0xF0, 0xC0, 0x0B, 0xF0, 0xDF, 0x0F, 0x03, 0xF0, 0xD0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0,
+	0xF0, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x4F, 0x06, 0xF0, 0xF0,
+	0x40, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B,
+	0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x02, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0,
+	0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x4F, 0x07, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0,
+	0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x1D, 0x1D, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF9,
+	0xB9, 0xF0, 0xF0, 0x09, 0xF0, 0xF7, 0xE8, 0xF0, 0xF0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0,
+	0x0B, 0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x0B, 0xF0,
+	0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x8B, 0x01, 0xF0, 0xC6, 0xF0, 0x86, 0xF0, 0xC0, 0x8B, 0x0B, 0xF0,
+	0xB6, 0xF0, 0xA6, 0xF0, 0xB0, 0x0B, 0xF0, 0xB6, 0x6D, 0x66, 0xF0, 0xB0, 0x0D, 0xF0, 0xB6, 0x3F,
+	0x04, 0x36, 0xF0, 0xB0, 0x8B, 0x02, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0D, 0xF0, 0xBF, 0x01,
+	0x5F, 0x01, 0xF0, 0xB0, 0x09, 0xF0, 0xBB, 0xFB, 0xF0, 0xB0, 0x0B, 0xF0, 0xAA, 0xF0, 0x4A, 0xF0,
+	0xA0, 0x0B, 0xF0, 0x99, 0xF0, 0x89, 0xF0, 0x90, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B,
+	0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60, 0x0D, 0xF0,
+	0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x56, 0xF0, 0xF0, 0x76, 0xF0, 0x50, 0x0D, 0xF0,
+	0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0,
+	0x36, 0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x0F, 0xF0, 0x27, 0xF0, 0x19, 0xF0, 0x17, 0xF0, 0x20, 0x0F,
+	0xF0, 0x26, 0xF0, 0x1B, 0xF0, 0x16, 0xF0, 0x20, 0x0B, 0xF0, 0x26, 0xFD, 0xF6, 0xF0, 0x20, 0x0B,
+	0xF0, 0x16, 0xFF, 0xF6, 0xF0, 0x10, 0x0D, 0xF0, 0x16, 0xEF, 0x02, 0xE6, 0xF0, 0x10, 0x0D, 0xF0,
+	0x15, 0xFF, 0x02, 0xF5, 0xF0, 0x10, 0x09, 0xF6, 0xFF, 0x02, 0xF6, 0xF0, 0x89, 0x03, 0xF6, 0xEF,
+	0x04, 0xE6, 0xF0, 0x8D, 0x01, 0xF5, 0xF0, 0x1F, 0x02, 0xF0, 0x15, 0xF0, 0x0B, 0xF5, 0xF0, 0x2F,
+	0xF0, 0x25, 0xF0, 0x0B, 0xF6, 0xF0, 0x1F, 0xF0, 0x16, 0xF0, 0x0B, 0xF6, 0xF0, 0x2D, 0xF0, 0x26,
+	0xF0, 0x0B, 0xF6, 0xF0, 0x3B, 0xF0, 0x36, 0xF0, 0x8B, 0x01, 0xF6, 0xF0, 0x57, 0xF0, 0x56, 0xF0,
+	0x0F, 0xF0, 0x15, 0xF0, 0x57, 0xF0, 0x55, 0xF0, 0x10, 0x8F, 0x01, 0xF0, 0x16, 0xF0, 0x47, 0xF0,
+	0x46, 0xF0, 0x10, 0x8F, 0x01, 0xF0, 0x26, 0xF0, 0x37, 0xF0, 0x36, 0xF0, 0x20, 0x0F, 0xF0, 0x27,
+	0xF0, 0x27, 0xF0, 0x27, 0xF0, 0x20, 0x0F, 0xF0, 0x36, 0xF0, 0x27, 0xF0, 0x26, 0xF0, 0x30, 0x0F,
+	0xF0, 0x37, 0xF0, 0x25, 0xF0, 0x27, 0xF0, 0x30, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40,
+	0x8D, 0x01, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x68, 0xF0, 0xF0, 0x27, 0xF0,
+	0x60, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B,
+	0xF0, 0x99, 0xF0, 0x89, 0xF0, 0x90, 0x0B, 0xF0, 0xAA, 0xF0, 0x4A, 0xF0, 0xA0, 0x09, 0xF0, 0xBB,
+	0xFB, 0xF0, 0xB0, 0x0D, 0xF0, 0xCF, 0x01, 0x3F, 0x01, 0xF0, 0xC0, 0x0B, 0xF0, 0xEF, 0x0F, 0x01,
+	0xF0, 0xE0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20,
+	0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0, 0x80, 0x0B,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x02, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0,
+	0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x5F,
+	0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x4F, 0x07, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x2F,
+	0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x1D, 0x1D, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xF9, 0xB9,
+	0xF0, 0xF0, 0x09, 0xF0, 0xF7, 0xE8, 0xF0, 0xF0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xD7, 0xF0, 0x47, 0xF0, 0xD0, 0x0B, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x0B, 0xF0, 0xC7,
+	0xF0, 0x67, 0xF0, 0xC0, 0x8B, 0x01, 0xF0, 0xC6, 0xF0, 0x86, 0xF0, 0xC0, 0x8B, 0x04, 0xF0, 0xB6,
+	0xF0, 0xA6, 0xF0, 0xB0, 0x0B, 0xF0, 0xB6, 0xF0, 0xB5, 0xF0, 0xB0, 0x0B, 0xF0, 0xB6, 0xF0, 0xB4,
+	0xF0, 0xC0, 0x8B, 0x04, 0xF0, 0xB6, 0xF0, 0xF0, 0xF0, 0xC0, 0x0B, 0xF0, 0xB6, 0x6D, 0xF0, 0xF0,
+	0x80, 0x0D, 0xF0, 0xB6, 0x3F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xBF, 0x0F, 0x01, 0xF0, 0xF0,
+	0x20, 0x0B, 0xF0, 0xBF, 0x0F, 0x03, 0xF0, 0xF0, 0x0B, 0xF0, 0xBF, 0x0F, 0x04, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xBF, 0x01, 0x5F, 0xF0, 0xC0, 0x09, 0xF0, 0xBB, 0xFB, 0xF0, 0xB0, 0x0B, 0xF0, 0xAA, 0xF0,
+	0x4A, 0xF0, 0xA0, 0x0B, 0xF0, 0x99, 0xF0, 0x89, 0xF0, 0x90, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0,
+	0x80, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0, 0x60,
+	0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x56, 0xF0, 0xF0, 0x76, 0xF0, 0x50,
+	0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30,
+	0x0D, 0xF0, 0x36, 0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x0F, 0xF0, 0x27, 0xF0, 0x19, 0xF0, 0x17, 0xF0,
+	0x20, 0x0F, 0xF0, 0x26, 0xF0, 0x1B, 0xF0, 0x16, 0xF0, 0x20, 0x0B, 0xF0, 0x26, 0xFD, 0xF6, 0xF0,
+	0x20, 0x0B, 0xF0, 0x16, 0xFF, 0xF6, 0xF0, 0x10, 0x0D, 0xF0, 0x16, 0xEF, 0x02, 0xE6, 0xF0, 0x10,
+	0x0D, 0xF0, 0x15, 0xFF, 0x02, 0xF5, 0xF0, 0x10, 0x09, 0xF6, 0xFF, 0x02, 0xF6, 0xF0, 0x89, 0x03,
+	0xF6, 0xEF, 0x04, 0xE6, 0xF0, 0x8D, 0x01, 0xF5, 0xF0, 0x1F, 0x02, 0xF0, 0x15, 0xF0, 0x0B, 0xF5,
+	0xF0, 0x2F, 0xF0, 0x25, 0xF0, 0x0B, 0xF6, 0xF0, 0x1F, 0xF0, 0x16, 0xF0, 0x0B, 0xF6, 0xF0, 0x2D,
+	0xF0, 0x26, 0xF0, 0x0B, 0xF6, 0xF0, 0x3B, 0xF0, 0x36, 0xF0, 0x8B, 0x01, 0xF6, 0xF0, 0x57, 0xF0,
+	0x56, 0xF0, 0x0F, 0xF0, 0x15, 0xF0, 0x57, 0xF0, 0x55, 0xF0, 0x10, 0x8F, 0x01, 0xF0, 0x16, 0xF0,
+	0x47, 0xF0, 0x46, 0xF0, 0x10, 0x8F, 0x01, 0xF0, 0x26, 0xF0, 0x37, 0xF0, 0x36, 0xF0, 0x20, 0x0F,
+	0xF0, 0x27, 0xF0, 0x27, 0xF0, 0x27, 0xF0, 0x20, 0x0F, 0xF0, 0x36, 0xF0, 0x27, 0xF0, 0x26, 0xF0,
+	0x30, 0x0F, 0xF0, 0x37, 0xF0, 0x25, 0xF0, 0x27, 0xF0, 0x30, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77,
+	0xF0, 0x40, 0x8D, 0x01, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D, 0xF0, 0x68, 0xF0, 0xF0,
+	0x27, 0xF0, 0x60, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0,
+	0x80, 0x0B, 0xF0, 0x99, 0xF0, 0x89, 0xF0, 0x90, 0x0B, 0xF0, 0xAA, 0xF0, 0x4A, 0xF0, 0xA0, 0x09,
+	0xF0, 0xBB, 0xFB, 0xF0, 0xB0, 0x0D, 0xF0, 0xCF, 0x01, 0x3F, 0x01, 0xF0, 0xC0, 0x0B, 0xF0, 0xEF,
+	0x0F, 0x01, 0xF0, 0xE0, 0x09, 0xF0, 0xFF, 0x0E, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0,
+	0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x8D, 0xF0, 0xF0,
+	0x80, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x0B, 0xF0, 0x89, 0xF0, 0xA9, 0xF0, 0x80, 0x0B, 0xF0, 0x5F, 0xF0, 0x4F, 0xF0, 0x50, 0x0D, 0xF0,
+	0x3F, 0x04, 0xFF, 0x04, 0xF0, 0x30, 0x0D, 0xF0, 0x1F, 0x07, 0xCF, 0x08, 0xF0, 0x10, 0x09, 0xFF,
+	0x0A, 0x9F, 0x0A, 0xF0, 0x09, 0xEF, 0x0C, 0x7F, 0x0C, 0xE0, 0x09, 0xDA, 0xA9, 0x59, 0xAA, 0xD0,
+	0x09, 0xC9, 0xE8, 0x38, 0xE9, 0xC0, 0x0D, 0xB8, 0xF0, 0x28, 0x18, 0xF0, 0x28, 0xB0, 0x0B, 0xB7,
+	0xF0, 0x4F, 0xF0, 0x47, 0xB0, 0x0B, 0xA7, 0xF0, 0x6D, 0xF0, 0x67, 0xA0, 0x0B, 0x97, 0xF0, 0x8B,
+	0xF0, 0x87, 0x90, 0x0B, 0x96, 0xF0, 0xA9, 0xF0, 0xA6, 0x90, 0x0B, 0x96, 0xF0, 0xB7, 0xF0, 0xB6,
+	0x90, 0x8B, 0x01, 0x86, 0xF0, 0xD5, 0xF0, 0xD6, 0x80, 0x0B, 0x86, 0xF0, 0xF1, 0xF0, 0xF6, 0x80,
+	0x0D, 0x85, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0x80, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0x80,
+	0x8D, 0x01, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0x36, 0x70, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0x35,
+	0x80, 0x0D, 0x85, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0x80, 0x8D, 0x02, 0x86, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x16, 0x80, 0x8B, 0x01, 0x96, 0xF0, 0xF0, 0xF0, 0xE6, 0x90, 0x0B, 0x97, 0xF0, 0xF0, 0xF0, 0xC7,
+	0x90, 0x0B, 0xA7, 0xF0, 0xF0, 0xF0, 0xA7, 0xA0, 0x0B, 0xB6, 0xF0, 0xF0, 0xF0, 0xA6, 0xB0, 0x0B,
+	0xB7, 0xF0, 0xF0, 0xF0, 0x87, 0xB0, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0, 0x67, 0xC0, 0x0B, 0xC8, 0xF0,
+	0xF0, 0xF0, 0x47, 0xD0, 0x0B, 0xD8, 0xF0, 0xF0, 0xF0, 0x28, 0xD0, 0x0B, 0xE7, 0xF0, 0xF0, 0xF0,
+	0x27, 0xE0, 0x09, 0xF7, 0xF0, 0xF0, 0xF7, 0xF0, 0x0D, 0xF0, 0x17, 0xF0, 0xF0, 0xD7, 0xF0, 0x10,
+	0x0D, 0xF0, 0x27, 0xF0, 0xF0, 0xB7, 0xF0, 0x20, 0x0D, 0xF0, 0x28, 0xF0, 0xF0, 0x98, 0xF0, 0x20,
+	0x0D, 0xF0, 0x38, 0xF0, 0xF0, 0x78, 0xF0, 0x30, 0x0D, 0xF0, 0x48, 0xF0, 0xF0, 0x58, 0xF0, 0x40,
+	0x0D, 0xF0, 0x58, 0xF0, 0xF0, 0x38, 0xF0, 0x50, 0x0D, 0xF0, 0x68, 0xF0, 0xF0, 0x18, 0xF0, 0x60,
+	0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0, 0x70, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B, 0xF0,
+	0x98, 0xF0, 0xA8, 0xF0, 0x90, 0x0B, 0xF0, 0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0xB8, 0xF0,
+	0x68, 0xF0, 0xB0, 0x0B, 0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0, 0xD8, 0xF0, 0x28, 0xF0,
+	0xD0, 0x09, 0xF0, 0xE8, 0xF8, 0xF0, 0xE0, 0x09, 0xF0, 0xF8, 0xD8, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0,
+	0x19, 0x99, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0xF0, 0x38, 0x79, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0,
+	0x48, 0x58, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x58, 0x38, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0,
+	0x68, 0x18, 0xF0, 0xF0, 0x60, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0, 0x8D,
+	0xF0, 0xF0, 0x80, 0x0B, 0xF0, 0xF0, 0x9B, 0xF0, 0xF0, 0x90, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0,
+	0xA0, 0x0B, 0xF0, 0xF0, 0xB7, 0xF0, 0xF0, 0xB0, 0x0B, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0B,
+	0xF0, 0xF0, 0xD3, 0xF0, 0xF0, 0xD0, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x04,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0x43, 0xF3, 0xF0, 0xF0, 0x40, 0x09, 0xF0,
+	0xFB, 0x7B, 0xF0, 0xF0, 0x09, 0xF0, 0xDF, 0x3F, 0xF0, 0xD0, 0x0D, 0xF0, 0xCF, 0x02, 0x1F, 0x02,
+	0xF0, 0xC0, 0x0B, 0xF0, 0xCF, 0x0F, 0x05, 0xF0, 0xC0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0,
+	0x0B, 0xF0, 0xB7, 0x5D, 0x66, 0xF0, 0xB0, 0x0B, 0xF0, 0xA6, 0x99, 0x96, 0xF0, 0xA0, 0x0B, 0xF0,
+	0xA6, 0xA7, 0xA6, 0xF0, 0xA0, 0x0B, 0xF0, 0xA5, 0xC6, 0xB5, 0xF0, 0xA0, 0x0B, 0xF0, 0xA5, 0xC5,
+	0xC5, 0xF0, 0xA0, 0x0B, 0xF0, 0xA5, 0xC5, 0xC6, 0xF0, 0x90, 0x0B, 0xF0, 0x96, 0xC5, 0xC6, 0xF0,
+	0x90, 0x0B, 0xF0, 0x78, 0xC5, 0xC8, 0xF0, 0x70, 0x0B, 0xF0, 0x5A, 0xC5, 0xCA, 0xF0, 0x50, 0x0B,
+	0xF0, 0x3B, 0xD5, 0xDB, 0xF0, 0x30, 0x0B, 0xF0, 0x1D, 0xD5, 0xDD, 0xF0, 0x10, 0x0B, 0xFC, 0x72,
+	0x65, 0x62, 0x7C, 0xF0, 0x0B, 0xEA, 0x95, 0x45, 0x54, 0x9A, 0xE0, 0x0B, 0xD9, 0xA6, 0x45, 0x46,
+	0xA9, 0xD0, 0x0B, 0xC8, 0xC6, 0x45, 0x46, 0xC8, 0xC0, 0x0B, 0xB8, 0xE5, 0x45, 0x46, 0xD8, 0xB0,
+	0x0B, 0xA8, 0xE6, 0x45, 0x46, 0xE8, 0xA0, 0x0B, 0xA7, 0xF6, 0x45, 0x46, 0xF7, 0xA0, 0x0B, 0x97,
+	0xE8, 0x45, 0x48, 0xE7, 0x90, 0x0B, 0x96, 0xBB, 0x55, 0x5B, 0xB6, 0x90, 0x0B, 0x86, 0xBC, 0x55,
+	0x5C, 0xB6, 0x80, 0x0B, 0x86, 0xBB, 0x65, 0x6B, 0xB6, 0x80, 0x0B, 0x86, 0xB9, 0x85, 0x89, 0xB6,
+	0x80, 0x0B, 0x85, 0xD6, 0xA5, 0xA6, 0xD5, 0x80, 0x8B, 0x02, 0x85, 0xF0, 0xE5, 0xF0, 0xE6, 0x70,
+	0x0B, 0x85, 0x69, 0xE5, 0xE9, 0x65, 0x80, 0x0B, 0x86, 0x4C, 0xC5, 0xCC, 0x46, 0x80, 0x0F, 0x86,
+	0x2F, 0x01, 0xA5, 0xAF, 0x01, 0x26, 0x80, 0x0F, 0x86, 0x1F, 0x03, 0x95, 0x9F, 0x03, 0x16, 0x80,
+	0x0B, 0x9F, 0x0A, 0x85, 0x8F, 0x0A, 0x90, 0x0B, 0x9D, 0x48, 0x85, 0x88, 0x4D, 0x90, 0x0B, 0x9B,
+	0x87, 0x75, 0x77, 0x8B, 0x90, 0x0B, 0xA9, 0xA6, 0x75, 0x76, 0xA9, 0xA0, 0x0B, 0xA8, 0xC5, 0x75,
+	0x75, 0xC8, 0xA0, 0x0B, 0xB6, 0xE3, 0x85, 0x83, 0xE6, 0xB0, 0x0B, 0xB6, 0xF0, 0xA5, 0xF0, 0xA6,
+	0xB0, 0x0B, 0xB6, 0xF0, 0xA5, 0xF0, 0xB5, 0xB0, 0x0B, 0xB5, 0xF0, 0xB5, 0xF0, 0xB5, 0xB0, 0x8B,
+	0x02, 0xA6, 0xF0, 0xB5, 0xF0, 0xB6, 0xA0, 0x0B, 0xA6, 0x97, 0xA5, 0xA7, 0x96, 0xA0, 0x0B, 0xA6,
+	0x89, 0x95, 0x99, 0x86, 0xA0, 0x0B, 0xA6, 0x8A, 0x85, 0x8A, 0x86, 0xA0, 0x0B, 0xA6, 0x8B, 0x75,
+	0x7B, 0x86, 0xA0, 0x0B, 0xB5, 0x9B, 0x65, 0x6B, 0x96, 0xA0, 0x0B, 0xB5, 0xD7, 0x65, 0x67, 0xD5,
+	0xB0, 0x0B, 0xB6, 0xD6, 0x65, 0x66, 0xD6, 0xB0, 0x0B, 0xB6, 0xE6, 0x55, 0x56, 0xE6, 0xB0, 0x8B,
+	0x01, 0xC6, 0xD6, 0x55, 0x56, 0xD6, 0xC0, 0x0B, 0xD6, 0xC6, 0x55, 0x56, 0xC7, 0xC0, 0x0B, 0xD8,
+	0xA6, 0x55, 0x56, 0xB7, 0xD0, 0x0B, 0xE8, 0xA5, 0x55, 0x55, 0xA8, 0xE0, 0x0B, 0xF9, 0x85, 0x55,
+	0x64, 0x89, 0xF0, 0x0B, 0xFC, 0x62, 0x75, 0x72, 0x6C, 0xF0, 0x0B, 0xF0, 0x2C, 0xD5, 0xDD, 0xF0,
+	0x10, 0x0B, 0xF0, 0x3B, 0xD5, 0xDB, 0xF0, 0x30, 0x0B, 0xF0, 0x4B, 0xC5, 0xCB, 0xF0, 0x40, 0x0B,
+	0xF0, 0x69, 0xC5, 0xC9, 0xF0, 0x60, 0x0B, 0xF0, 0x96, 0xC5, 0xC6, 0xF0, 0x90, 0x0B, 0xF0, 0xA5,
+	0xC5, 0xC5, 0xF0, 0xA0, 0x0B, 0xF0, 0xA5, 0xB7, 0xB5, 0xF0, 0xA0, 0x0B, 0xF0, 0xA6, 0xA7, 0xA6,
+	0xF0, 0xA0, 0x0B, 0xF0, 0xB8, 0x5B, 0x68, 0xF0, 0xA0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0,
+	0x8B, 0x01, 0xF0, 0xCF, 0x0F, 0x05, 0xF0, 0xC0, 0x09, 0xF0, 0xEF, 0x1F, 0xF0, 0xE0, 0x0D, 0xF0,
+	0xF0, 0x1B, 0x5B, 0xF0, 0xF0, 0x10, 0x8B, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x12,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0,
+	0x4F, 0x06, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0xF0, 0x2F, 0x0B, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xFF,
+	0x0F, 0xF0, 0xE0, 0x0B, 0xF0, 0xDF, 0x0F, 0x04, 0xF0, 0xC0, 0x09, 0xF0, 0xBF, 0x8E, 0xF0, 0xB0,
+	0x0B, 0xF0, 0xAC, 0xF0, 0x1C, 0xF0, 0x90, 0x0B, 0xF0, 0x8B, 0xF0, 0x6B, 0xF0, 0x80, 0x0B, 0xF0,
+	0x7A, 0xF0, 0xAB, 0xF0, 0x60, 0x0B, 0xF0, 0x5B, 0xF0, 0xDA, 0xF0, 0x50, 0x0B, 0xF0, 0x4A, 0xC7,
+	0xD9, 0xF0, 0x40, 0x0D, 0xF0, 0x39, 0x9F, 0x02, 0x9A, 0xF0, 0x20, 0x0D, 0xF0, 0x1A, 0x7F, 0x08,
+	0x89, 0xF0, 0x10, 0x09, 0xFA, 0x5F, 0x0E, 0x6A, 0xE0, 0x0B, 0xDA, 0x5F, 0x0F, 0x03, 0x5A, 0xD0,
+	0x0B, 0xCA, 0x5F, 0x0F, 0x05, 0x6A, 0xB0, 0x09, 0xAA, 0x6C, 0xDC, 0x6A, 0xA0, 0x0B, 0x7C, 0x79,
+	0xF0, 0x49, 0x7C, 0x70, 0x0B, 0x3F, 0x87, 0xF0, 0x87, 0x9E, 0x30, 0x0B, 0x2E, 0xB3, 0xF0, 0xE3,
+	0xBE, 0x20, 0x0D, 0x2C, 0xF0, 0xF0, 0xF0, 0xF0, 0x1C, 0x20, 0x0D, 0x2B, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x3B, 0x20, 0x0D, 0x28, 0xF0, 0xF0, 0xF0, 0xF0, 0x98, 0x20, 0x0F, 0x42, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x22, 0x40, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8D, 0x03, 0xF0, 0x2F, 0x0F, 0x0F,
+	0x08, 0xF0, 0x40, 0x0D, 0xF0, 0x3F, 0x0F, 0x0F, 0x06, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xE0, 0x0D, 0x35, 0xF0, 0xF0, 0xF0, 0xF0, 0xD5, 0x30, 0x0D, 0x29, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x79, 0x20, 0x0D, 0x2B, 0xF0, 0xF0, 0xF0, 0xF0, 0x3B, 0x20, 0x0B, 0x2D, 0xF0, 0xF0, 0xF0, 0xED,
+	0x20, 0x0B, 0x2F, 0xA4, 0xF0, 0xC5, 0xAE, 0x20, 0x0B, 0x4E, 0x97, 0xF0, 0x77, 0x8E, 0x40, 0x0B,
+	0x8B, 0x7A, 0xF0, 0x2A, 0x7B, 0x80, 0x09, 0xAB, 0x6D, 0xAD, 0x6A, 0xA0, 0x0B, 0xCA, 0x5F, 0x0F,
+	0x06, 0x4A, 0xC0, 0x0B, 0xEA, 0x5F, 0x0F, 0x02, 0x5A, 0xD0, 0x09, 0xFA, 0x6F, 0x0D, 0x69, 0xF0,
+	0x0D, 0xF0, 0x29, 0x8F, 0x07, 0x7A, 0xF0, 0x10, 0x0D, 0xF0, 0x3A, 0x9F, 0x01, 0x99, 0xF0, 0x30,
+	0x0D, 0xF0, 0x4A, 0xF0, 0xF0, 0x1A, 0xF0, 0x40, 0x0B, 0xF0, 0x6A, 0xF0, 0xCB, 0xF0, 0x50, 0x0B,
+	0xF0, 0x7B, 0xF0, 0x9A, 0xF0, 0x70, 0x0B, 0xF0, 0x9B, 0xF0, 0x5B, 0xF0, 0x80, 0x09, 0xF0, 0xAD,
+	0xEC, 0xF0, 0xA0, 0x0D, 0xF0, 0xCF, 0x01, 0x3F, 0x02, 0xF0, 0xB0, 0x0B, 0xF0, 0xEF, 0x0F, 0x02,
+	0xF0, 0xD0, 0x0B, 0xF0, 0xF0, 0x1F, 0x0D, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x3F, 0x09, 0xF0, 0xF0,
+	0x20, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x9C, 0xF0, 0xF0, 0x80,
+	0x8B, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	0x0D, 0xF0, 0xF0, 0x6F, 0x02, 0xF0, 0xF0, 0x60, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20,
+	0x0B, 0xF0, 0xEF, 0x0F, 0x01, 0xF0, 0xE0, 0x0B, 0xF0, 0xBF, 0x0F, 0x07, 0xF0, 0xB0, 0x0B, 0xF0,
+	0x9F, 0x0F, 0x0B, 0xF0, 0x90, 0x0D, 0xF0, 0x7F, 0x03, 0x9F, 0x03, 0xF0, 0x70, 0x0B, 0xF0, 0x5F,
+	0xF0, 0x4F, 0xF0, 0x50, 0x0B, 0xF0, 0x4C, 0xF0, 0xCC, 0xF0, 0x40, 0x0D, 0xF0, 0x2C, 0xF0, 0xF0,
+	0x1C, 0xF0, 0x20, 0x0D, 0xF0, 0x1B, 0xF0, 0xF0, 0x5B, 0xF0, 0x10, 0x09, 0xFA, 0xF0, 0xF0, 0x9A,
+	0xF0, 0x09, 0xE9, 0xF0, 0xF0, 0xD9, 0xE0, 0x09, 0xD9, 0xF0, 0xF0, 0xF9, 0xD0, 0x0B, 0xC8, 0xF0,
+	0xF0, 0xF0, 0x48, 0xC0, 0x0B, 0xB8, 0xF0, 0xF0, 0xF0, 0x68, 0xB0, 0x0B, 0xA8, 0xF0, 0x6B, 0xF0,
+	0x68, 0xA0, 0x0D, 0x98, 0xF0, 0x4F, 0x02, 0xF0, 0x48, 0x90, 0x0D, 0x87, 0xF0, 0x5F, 0x04, 0xF0,
+	0x48, 0x80, 0x0D, 0x78, 0xF0, 0x3F, 0x08, 0xF0, 0x38, 0x70, 0x0D, 0x68, 0xF0, 0x3F, 0x0A, 0xF0,
+	0x37, 0x70, 0x0D, 0x67, 0xF0, 0x3B, 0x5B, 0xF0, 0x37, 0x60, 0x0D, 0x57, 0xF0, 0x39, 0xB9, 0xF0,
+	0x37, 0x50, 0x0D, 0x56, 0xF0, 0x47, 0xF7, 0xF0, 0x46, 0x50, 0x0F, 0x47, 0xF0, 0x37, 0xF0, 0x27,
+	0xF0, 0x37, 0x40, 0x0F, 0x37, 0xF0, 0x37, 0xF0, 0x47, 0xF0, 0x37, 0x30, 0x0F, 0x36, 0xF0, 0x46,
+	0xF0, 0x66, 0xF0, 0x46, 0x30, 0x0F, 0x27, 0xF0, 0x46, 0xF0, 0x66, 0xF0, 0x47, 0x20, 0x8F, 0x01,
+	0x26, 0xF0, 0x46, 0xF0, 0x86, 0xF0, 0x46, 0x20, 0x0F, 0x16, 0xF0, 0x56, 0xF0, 0x86, 0xF0, 0x56,
+	0x10, 0x0F, 0x16, 0xF0, 0x55, 0xF0, 0xA5, 0xF0, 0x56, 0x10, 0x0F, 0x15, 0xF0, 0x65, 0xF0, 0xA5,
+	0xF0, 0x65, 0x10, 0x8E, 0x02, 0x06, 0xF0, 0x65, 0xF0, 0xA5, 0xF0, 0x66, 0x0E, 0x05, 0xF0, 0x76,
+	0xF0, 0x86, 0xF0, 0x75, 0x0F, 0x22, 0xF0, 0x86, 0xF0, 0x86, 0xF0, 0x82, 0x20, 0x0B, 0xF0, 0xC6,
+	0xF0, 0x86, 0xF0, 0xC0, 0x8B, 0x01, 0xF0, 0xD6, 0xF0, 0x66, 0xF0, 0xD0, 0x0B, 0xF0, 0xE6, 0xF0,
+	0x46, 0xF0, 0xE0, 0x0B, 0xF0, 0xE7, 0xF0, 0x27, 0xF0, 0xE0, 0x09, 0xF0, 0xF7, 0xF7, 0xF0, 0xF0,
+	0x09, 0xF0, 0xF9, 0xB9, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x1B, 0x5B, 0xF0, 0xF0, 0x10, 0x0D, 0xF0,
+	0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0,
+	0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0B, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x8B, 0x15, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x06, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xE0, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x32, 0x90, 0x0D, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x24, 0x80, 0x0D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x16, 0x70, 0x0B, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF7, 0x70, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xE7, 0x80, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xD7,
+	0x90, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xC7, 0xA0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0xB0, 0x0B,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xA7, 0xC0, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0xD0, 0x0B, 0xF0, 0xF0,
+	0x6F, 0x02, 0xF7, 0xE0, 0x0B, 0xF0, 0xF0, 0x2F, 0x0A, 0xA7, 0xF0, 0x0B, 0xF0, 0xEF, 0x0E, 0x87,
+	0xF0, 0x10, 0x0D, 0xF0, 0xBF, 0x0F, 0x01, 0x87, 0xF0, 0x20, 0x0D, 0xF0, 0x9F, 0x0F, 0x02, 0x87,
+	0xF0, 0x30, 0x0D, 0xF0, 0x7F, 0x03, 0x87, 0x87, 0xF0, 0x40, 0x0B, 0xF0, 0x5F, 0xF0, 0xC7, 0xF0,
+	0x50, 0x0B, 0xF0, 0x4C, 0xF0, 0xF9, 0xF0, 0x40, 0x0D, 0xF0, 0x2C, 0xF0, 0xF0, 0x1C, 0xF0, 0x20,
+	0x0D, 0xF0, 0x1B, 0xF0, 0xF0, 0x2E, 0xF0, 0x10, 0x0B, 0xFA, 0xF0, 0xF0, 0x3F, 0x01, 0xF0, 0x0B,
+	0xE9, 0xF0, 0xF0, 0x47, 0x29, 0xE0, 0x0B, 0xD9, 0xF0, 0xF0, 0x47, 0x49, 0xD0, 0x0B, 0xB9, 0xF0,
+	0xF0, 0x57, 0x78, 0xC0, 0x0B, 0xA9, 0xF0, 0xF0, 0x57, 0x98, 0xB0, 0x0B, 0xA8, 0xF0, 0x66, 0x87,
+	0xB8, 0xA0, 0x0B, 0x98, 0xF0, 0x48, 0x87, 0xD8, 0x90, 0x0B, 0x88, 0xF0, 0x48, 0x87, 0xF8, 0x80,
+	0x0D, 0x78, 0xF0, 0x39, 0x87, 0xF0, 0x28, 0x70, 0x0D, 0x68, 0xF0, 0x39, 0x88, 0xF0, 0x37, 0x70,
+	0x0D, 0x67, 0xF0, 0x39, 0x8A, 0xF0, 0x37, 0x60, 0x0D, 0x57, 0xF0, 0x39, 0x8C, 0xF0, 0x37, 0x50,
+	0x0D, 0x56, 0xF0, 0x47, 0x9D, 0xF0, 0x46, 0x50, 0x0D, 0x47, 0xF0, 0x37, 0x9F, 0xF0, 0x37, 0x40,
+	0x0F, 0x37, 0xF0, 0x37, 0x97, 0x37, 0xF0, 0x37, 0x30, 0x0F, 0x36, 0xF0, 0x46, 0x97, 0x56, 0xF0,
+	0x46, 0x30, 0x0F, 0x27, 0xF0, 0x46, 0x87, 0x66, 0xF0, 0x46, 0x30, 0x0F, 0x26, 0xF0, 0x46, 0x87,
+	0x86, 0xF0, 0x46, 0x20, 0x0F, 0x26, 0xF0, 0x45, 0x87, 0x96, 0xF0, 0x46, 0x20, 0x0F, 0x16, 0xF0,
+	0x54, 0x87, 0xA6, 0xF0, 0x56, 0x10, 0x0F, 0x16, 0xF0, 0x53, 0x87, 0xC5, 0xF0, 0x56, 0x10, 0x0F,
+	0x15, 0xF0, 0x62, 0x87, 0xD5, 0xF0, 0x65, 0x10, 0x0E, 0x06, 0xF0, 0x61, 0x87, 0xE5, 0xF0, 0x66,
+	0x0C, 0x06, 0xF0, 0xE7, 0xF5, 0xF0, 0x66, 0x0E, 0x06, 0xF0, 0xD7, 0xF0, 0x15, 0xF0, 0x66, 0x0E,
+	0x05, 0xF0, 0xD7, 0xF0, 0x16, 0xF0, 0x75, 0x0F, 0x22, 0xF0, 0xD7, 0xF0, 0x26, 0xF0, 0x82, 0x20,
+	0x0D, 0xF0, 0xF0, 0x17, 0xF0, 0x36, 0xF0, 0xC0, 0x0B, 0xF0, 0xF7, 0xF0, 0x36, 0xF0, 0xD0, 0x0B,
+	0xF0, 0xE7, 0xF0, 0x46, 0xF0, 0xD0, 0x0B, 0xF0, 0xD8, 0xF0, 0x37, 0xF0, 0xD0, 0x0B, 0xF0, 0xC9,
+	0xF0, 0x27, 0xF0, 0xE0, 0x09, 0xF0, 0xBB, 0xF7, 0xF0, 0xF0, 0x09, 0xF0, 0xAE, 0xB9, 0xF0, 0xF0,
+	0x0D, 0xF0, 0x9F, 0x03, 0x5B, 0xF0, 0xF0, 0x10, 0x0D, 0xF0, 0x87, 0x2F, 0x0A, 0xF0, 0xF0, 0x20,
+	0x0D, 0xF0, 0x77, 0x4F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0x67, 0x7F, 0x04, 0xF0, 0xF0, 0x50,
+	0x0B, 0xF0, 0x57, 0xAF, 0xF0, 0xF0, 0x70, 0x0B, 0xF0, 0x47, 0xDB, 0xF0, 0xF0, 0x90, 0x0D, 0xF0,
+	0x37, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x0D, 0xF0, 0x27, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x0D, 0xF0,
+	0x17, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x0B, 0xF7, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x0B, 0xE7, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x80, 0x0B, 0xD7, 0xF0, 0xF0, 0xF0, 0xF0, 0x90, 0x0B, 0xC7, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xA0, 0x0B, 0xB7, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0x0B, 0xA7, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
+	0x0B, 0x97, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0, 0x0B, 0x87, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0x77,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x0D, 0x84, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x0D, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0x8B, 0x06, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x0E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0,
+	0x9B, 0xF0, 0xF0, 0x90, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0, 0x3F,
+	0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xFF, 0x0F,
+	0xF0, 0xE0, 0x09, 0xF0, 0xDF, 0x3F, 0xF0, 0xD0, 0x09, 0xF0, 0xCB, 0xDB, 0xF0, 0xC0, 0x0B, 0xF0,
+	0xB9, 0xF0, 0x49, 0xF0, 0xB0, 0x0B, 0xF0, 0xA8, 0xF0, 0x88, 0xF0, 0xA0, 0x0B, 0xF0, 0x98, 0xF0,
+	0xA8, 0xF0, 0x90, 0x0B, 0xF0, 0x88, 0xF0, 0xC8, 0xF0, 0x80, 0x0B, 0xF0, 0x78, 0xF0, 0xE8, 0xF0,
+	0x70, 0x0D, 0xF0, 0x77, 0xF0, 0xF0, 0x17, 0xF0, 0x70, 0x0D, 0xF0, 0x67, 0xF0, 0xF0, 0x37, 0xF0,
+	0x60, 0x0D, 0xF0, 0x66, 0xF0, 0xF0, 0x56, 0xF0, 0x60, 0x8D, 0x01, 0xF0, 0x56, 0xF0, 0xF0, 0x76,
+	0xF0, 0x50, 0x8D, 0x01, 0xF0, 0x46, 0xF0, 0xF0, 0x96, 0xF0, 0x40, 0x0D, 0xF0, 0x45, 0xF0, 0xF0,
+	0xB5, 0xF0, 0x40, 0x8D, 0x02, 0xF0, 0x36, 0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x0D, 0xF0, 0x35, 0xF0,
+	0xF0, 0xD5, 0xF0, 0x30, 0x09, 0xCB, 0xF0, 0xF0, 0xDB, 0xC0, 0x09, 0xAD, 0xF0, 0xF0, 0xDD, 0xA0,
+	0x09, 0x8F, 0xF0, 0xF0, 0xDF, 0x80, 0x0D, 0x6F, 0x02, 0xF0, 0xF0, 0xDF, 0x02, 0x60, 0x0D, 0x5F,
+	0x02, 0xF0, 0xF0, 0xFF, 0x02, 0x50, 0x0F, 0x4F, 0x01, 0xF0, 0xF0, 0xF0, 0x4F, 0x01, 0x40, 0x0D,
+	0x39, 0xF0, 0xF0, 0xF0, 0xF0, 0x59, 0x30, 0x0D, 0x37, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0x30, 0x0D,
+	0x27, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0x20, 0x0D, 0x26, 0xF0, 0xF0, 0xF0, 0xF0, 0xD6, 0x20, 0x8D,
+	0x01, 0x16, 0xF0, 0xF0, 0xF0, 0xF0, 0xF6, 0x10, 0x0F, 0x15, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x25,
+	0x10, 0x8E, 0x07, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x26, 0x8D, 0x01, 0x16, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF6, 0x10, 0x0D, 0x17, 0xF0, 0xF0, 0xF0, 0xF0, 0xD7, 0x10, 0x0D, 0x27, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xB7, 0x20, 0x0D, 0x37, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0x30, 0x0D, 0x39, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x59, 0x30, 0x0B, 0x4B, 0xF0, 0xF0, 0xF0, 0xEB, 0x40, 0x0D, 0x5F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x04, 0x50, 0x0D, 0x6F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x60, 0x0B, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x70, 0x0B, 0x9F, 0x0F, 0x0F, 0x0F, 0x0B, 0x90, 0x0B, 0xCF, 0x0F, 0x0F, 0x0F, 0x05, 0xC0, 0x8B,
+	0x10, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B,
+	0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x8B, 0x08, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0, 0x0F, 0xF0,
+	0x51, 0xF0, 0x65, 0xF0, 0x61, 0xF0, 0x50, 0x0F, 0xF0, 0x34, 0xF0, 0x71, 0xF0, 0x74, 0xF0, 0x30,
+	0x0D, 0xF0, 0x35, 0xF0, 0xF0, 0xD5, 0xF0, 0x30, 0x0D, 0xF0, 0x27, 0xF0, 0xF0, 0xB7, 0xF0, 0x20,
+	0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D, 0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40,
+	0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0B, 0xF0, 0x66, 0xD9, 0xD6, 0xF0, 0x60, 0x0B,
+	0xF0, 0x75, 0xAF, 0xA5, 0xF0, 0x70, 0x0D, 0xF0, 0x83, 0x9F, 0x04, 0x93, 0xF0, 0x80, 0x0D, 0xF0,
+	0xF0, 0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0,
+	0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xFA, 0x9A, 0xF0, 0xF0, 0x09, 0xF0, 0xE8, 0xE9,
+	0xF0, 0xE0, 0x0B, 0xF0, 0xD8, 0xF0, 0x28, 0xF0, 0xD0, 0x0B, 0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7, 0xF0, 0x87, 0xF0, 0xB0, 0x0B, 0xF0,
+	0xB6, 0xF0, 0xA6, 0xF0, 0xB0, 0x0B, 0xF0, 0xA6, 0xF0, 0xB7, 0xF0, 0xA0, 0x8B, 0x01, 0xF0, 0xA6,
+	0xF0, 0xC6, 0xF0, 0xA0, 0x8B, 0x01, 0xF0, 0x96, 0xF0, 0xE6, 0xF0, 0x90, 0x8B, 0x01, 0x8A, 0x66,
+	0xF0, 0xE6, 0x6A, 0x80, 0x0B, 0x7C, 0x56, 0xF0, 0xE6, 0x5C, 0x70, 0x8B, 0x01, 0x8A, 0x66, 0xF0,
+	0xE6, 0x6A, 0x80, 0x8B, 0x01, 0xF0, 0x96, 0xF0, 0xE6, 0xF0, 0x90, 0x8B, 0x01, 0xF0, 0xA6, 0xF0,
+	0xC6, 0xF0, 0xA0, 0x0B, 0xF0, 0xA7, 0xF0, 0xA7, 0xF0, 0xA0, 0x0B, 0xF0, 0xB6, 0xF0, 0xA6, 0xF0,
+	0xB0, 0x0B, 0xF0, 0xB7, 0xF0, 0x87, 0xF0, 0xB0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B,
+	0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0, 0xD8, 0xF0, 0x28, 0xF0, 0xD0, 0x09, 0xF0, 0xE9,
+	0xD9, 0xF0, 0xE0, 0x09, 0xF0, 0xFA, 0x9A, 0xF0, 0xF0, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0,
+	0x10, 0x0D, 0xF0, 0xF0, 0x2F, 0x0A, 0xF0, 0xF0, 0x20, 0x0D, 0xF0, 0xF0, 0x3F, 0x08, 0xF0, 0xF0,
+	0x30, 0x0D, 0xF0, 0x83, 0x9F, 0x04, 0x93, 0xF0, 0x80, 0x0B, 0xF0, 0x75, 0xAF, 0xA5, 0xF0, 0x70,
+	0x0B, 0xF0, 0x66, 0xD8, 0xE6, 0xF0, 0x60, 0x0D, 0xF0, 0x57, 0xF0, 0xF0, 0x57, 0xF0, 0x50, 0x0D,
+	0xF0, 0x47, 0xF0, 0xF0, 0x77, 0xF0, 0x40, 0x0D, 0xF0, 0x37, 0xF0, 0xF0, 0x97, 0xF0, 0x30, 0x0D,
+	0xF0, 0x36, 0xF0, 0xF0, 0xB6, 0xF0, 0x30, 0x0D, 0xF0, 0x35, 0xF0, 0xF0, 0xD5, 0xF0, 0x30, 0x0F,
+	0xF0, 0x34, 0xF0, 0x71, 0xF0, 0x74, 0xF0, 0x30, 0x8B, 0x09, 0xF0, 0xF0, 0xC5, 0xF0, 0xF0, 0xC0,
+	0x0B, 0xF0, 0xF0, 0xE1, 0xF0, 0xF0, 0xE0, 0x8B, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8B,
+	0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x0B, 0xF0, 0xF0, 0xA9, 0xF0, 0xF0, 0xA0, 0x0B, 0xF0,
+	0xF0, 0x7F, 0xF0, 0xF0, 0x70, 0x0D, 0xF0, 0xF0, 0x5F, 0x04, 0xF0, 0xF0, 0x50, 0x0D, 0xF0, 0xF0,
+	0x3F, 0x08, 0xF0, 0xF0, 0x30, 0x0D, 0xF0, 0xF0, 0x1F, 0x0C, 0xF0, 0xF0, 0x10, 0x09, 0xF0, 0xFF,
+	0x0E, 0xF0, 0xF0, 0x09, 0xF0, 0xEA, 0xBA, 0xF0, 0xE0, 0x09, 0xF0, 0xD9, 0xF9, 0xF0, 0xD0, 0x0B,
+	0xF0, 0xC8, 0xF0, 0x48, 0xF0, 0xC0, 0x0B, 0xF0, 0xC7, 0xF0, 0x67, 0xF0, 0xC0, 0x0B, 0xF0, 0xB7,
+	0xF0, 0x87, 0xF0, 0xB0, 0x0B, 0xF0, 0xA7, 0xF0, 0xA7, 0xF0, 0xA0, 0x0B, 0xF0, 0xA6, 0xF0, 0xC6,
+	0xF0, 0xA0, 0x8B, 0x01, 0xF0, 0x96, 0xF0, 0xE6, 0xF0, 0x90, 0x0D, 0xF0, 0x95, 0xF0, 0xF0, 0x15,
+	0xF0, 0x90, 0x8D, 0x01, 0xF0, 0x86, 0xF0, 0xF0, 0x16, 0xF0, 0x80, 0x8D, 0x01, 0xF0, 0x85, 0xF0,
+	0xF0, 0x35, 0xF0, 0x80, 0x0D, 0xF0, 0x76, 0xF0, 0xF0, 0x36, 0xF0, 0x70, 0x0D, 0xF0, 0x1C, 0xF0,
+	0xF0, 0x3C, 0xF0, 0x10, 0x09, 0xEE, 0xF0, 0xF0, 0x3E, 0xE0, 0x0D, 0xCF, 0x01, 0xF0, 0xF0, 0x3F,
+	0x01, 0xC0, 0x0D, 0xBF, 0x01, 0xF0, 0xF0, 0x4F, 0x02, 0xB0, 0x0D, 0xAF, 0x02, 0xF0, 0xF0, 0x5F,
+	0x02, 0xA0, 0x0B, 0x9A, 0xF0, 0xF0, 0xF0, 0x6A, 0x90, 0x0B, 0x88, 0xF0, 0xF0, 0xF0, 0xC8, 0x80,
+	0x0B, 0x87, 0xF0, 0xF0, 0xF0, 0xE7, 0x80, 0x0D, 0x77, 0xF0, 0xF0, 0xF0, 0xF0, 0x17, 0x70, 0x0D,
+	0x76, 0xF0, 0xF0, 0xF0, 0xF0, 0x36, 0x70, 0x8D, 0x02, 0x66, 0xF0, 0xF0, 0xF0, 0xF0, 0x56, 0x60,
+	0x8D, 0x04, 0x65, 0xF0, 0xF0, 0xF0, 0xF0, 0x75, 0x60, 0x8D, 0x01, 0x66, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x56, 0x60, 0x0D, 0x67, 0xF0, 0xF0, 0xF0, 0xF0, 0x37, 0x60, 0x0D, 0x76, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x36, 0x70, 0x0D, 0x77, 0xF0, 0xF0, 0xF0, 0xF0, 0x17, 0x70, 0x0B, 0x87, 0xF0, 0xF0, 0xF0, 0xE7,
+	0x80, 0x0B, 0x98, 0xF0, 0xF0, 0xF0, 0xA8, 0x90, 0x0B, 0x9F, 0x0F, 0x0F, 0x0F, 0x0B, 0x90, 0x0B,
+	0xAF, 0x0F, 0x0F, 0x0F, 0x09, 0xA0, 0x0B, 0xBF, 0x0F, 0x0F, 0x0F, 0x07, 0xB0, 0x0B, 0xDF, 0x0F,
+	0x0F, 0x0F, 0x03, 0xD0, 0x09, 0xFF, 0x0F, 0x0F, 0x0E, 0xF0, 0x0D, 0xF0, 0x2F, 0x0F, 0x0F, 0x0A,
+	0xF0, 0x20, 0x0B, 0xF0, 0x67, 0xE6, 0xE7, 0xF0, 0x50, 0x0B, 0xF0, 0x66, 0xE7, 0xD7, 0xF0, 0x60,
+	0x0B, 0xF0, 0x57, 0xD7, 0xE6, 0xF0, 0x70, 0x0B, 0xF0, 0x56, 0xE6, 0xE7, 0xF0, 0x70, 0x0B, 0xF0,
+	0x46, 0xE7, 0xE6, 0xF0, 0x80, 0x0B, 0xF0, 0x37, 0xE6, 0xE7, 0xF0, 0x80, 0x0B, 0xF0, 0x36, 0xE7,
+	0xD7, 0xF0, 0x90, 0x0B, 0xF0, 0x27, 0xE6, 0xE6, 0xF0, 0xA0, 0x0B, 0xF0, 0x26, 0xE6, 0xE7, 0xF0,
+	0xA0, 0x0B, 0xF0, 0x16, 0xE7, 0xE6, 0xF0, 0xB0, 0x09, 0xF7, 0xE6, 0xE7, 0xF0, 0xB0, 0x09, 0xF6,
+	0xE7, 0xE6, 0xF0, 0xC0, 0x09, 0xF6, 0xE6, 0xF5, 0xF0, 0xD0, 0x0D, 0xF5, 0xF0, 0x14, 0xF0, 0x15,
+	0xF0, 0xD0, 0x0F, 0xF0, 0x13, 0xF0, 0x32, 0xF0, 0x33, 0xF0, 0xE0, 0x8B, 0x0A, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xE0,
+};
+
+const uint16_t icon89_rle_offsets[] = {
+	0, 218, 490, 764, 1031, 1291, 1660, 1922, 2177, 2417, 2644, 3048,
+	3130, 3305, 3599, 4020, 4585, 5156, 5364, 5776, 6272, 6655, 7087, 7370,
+	7653, 8162, 8269, 8696, 9161, 9626, 10084, 10542, 10929, 11431, 11927, 12159,
+	12439, 12977, 13265, 13517, 13824, 14240, 14659, 15125, 15640, 16091, 16622, 17093,
+	17517, 18002, 18457, 19038, 19452, 19869, 20407, 20902, 21432, 21886, 22414, 22808,
+	23180, 23765, 24119, 24527,
+};
+
+/*==================[external data definition]===============================*/
+
+icon_font_t icon_30_rle = {
+	30,
+	30,
+	0,
+	icon30_rle_data,
+	FONT_RLE,
+	icon30_rle_offsets
+};
+
+icon_font_t icon_59_rle = {
+	59,
+	59,
+	0,
+	icon59_rle_data,
+	FONT_RLE,
+	icon59_rle_offsets
+};
+
+icon_font_t icon_89_rle = {
+	89,
+	89,
+	0,
+	icon89_rle_data,
+	FONT_RLE,
+	icon89_rle_offsets
+};
+
+/*==================[end of file]============================================*/
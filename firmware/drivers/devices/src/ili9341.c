@@ -15,14 +15,24 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
+#undef NULL
 #define NULL 0
 
 #define SPI_BR 20000000				/*!< Frequency of sck for SPI communication */
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
-#define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define DMA_CHUNK_SIZE 4092			/*!< Bytes per DMA transfer (limited by max_transfer_sz of the SPI bus) */
+#define GLYPH_CACHE_ENTRIES 24		/*!< Maximum number of expanded glyphs kept in cache */
+#define GLYPH_CACHE_BYTES 32768		/*!< Maximum memory used by the glyph cache */
+#define MAX_RUN_CHARS 64			/*!< Maximum number of characters sent in a single window */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -40,7 +50,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Defines the vertical scrolling area (VSCRDEF) */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_START	0x37 	/*!< Line of frame memory shown at the top of the scrolling area (VSCRSADD) */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -82,6 +94,69 @@ typedef struct {
     uint32_t databytes; 	/*!< Number of bytes of data to transmit */
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
+
+/**
+ * @brief Pending asynchronous transfer
+ */
+typedef struct {
+	uint16_t x0;						/*!< Start column */
+	uint16_t y0;						/*!< Start row */
+	uint16_t x1;						/*!< End column */
+	uint16_t y1;						/*!< End row */
+	uint16_t color;						/*!< Fill color (used when pic is NULL) */
+	const uint8_t *pic;					/*!< Picture to draw, NULL for a fill */
+	ili9341_callback_t func_p;			/*!< Callback function for transfer end */
+	void *param_p;						/*!< Parameter for callback function */
+} lcd_async_t;
+
+/**
+ * @brief Glyph expanded to RGB565
+ */
+typedef struct {
+	const Font_t *font;			/*!< Font of the glyph, NULL if entry is free */
+	char data;					/*!< Character */
+	uint16_t foreground;		/*!< Color for char (RGB565) */
+	uint16_t background;		/*!< Color for char background (RGB565) */
+	uint8_t *pixels;			/*!< Pixels ready to be sent to the LCD (2 bytes/pixel, row by row) */
+	uint32_t size;				/*!< Size of pixels in bytes */
+	uint32_t last_use;			/*!< Value of glyph_clock when glyph was last used */
+	bool in_use;				/*!< Glyph is part of the text run being drawn, it can't be evicted */
+} glyph_t;
+
+/**
+ * @brief State of the decoder of a glyph (character or icon), kept between rows
+ */
+typedef struct {
+	const uint8_t *src;			/*!< Next byte of glyph data */
+	const uint8_t *runs;		/*!< Run lengths of current row (FONT_RLE) */
+	font_format_t format;		/*!< Glyph data format */
+	uint8_t width;				/*!< Glyph width in pixels */
+	uint8_t nibbles;			/*!< Run lengths in current row (FONT_RLE) */
+	uint8_t repeat;				/*!< Times current row has yet to be drawn (FONT_RLE) */
+} glyph_decoder_t;
+
+/**
+ * @brief State of the decoder of a compressed image, kept between chunks
+ */
+typedef struct {
+	const uint16_t *palette;	/*!< Image palette, NULL if pixels are stored as RGB565 */
+	const uint8_t *src;			/*!< Next byte of compressed data */
+	uint8_t count;				/*!< Pixels left in current packet */
+	bool run;					/*!< Current packet is a run of the same pixel */
+	uint16_t pixel;				/*!< Pixel of current run, with bytes in LCD order */
+} rle_decoder_t;
+
+/**
+ * @brief Rectangle made of consecutive spans with the same columns and color
+ */
+typedef struct {
+	int16_t x0;					/*!< Start column */
+	int16_t x1;					/*!< End column */
+	int16_t y0;					/*!< Start row */
+	int16_t y1;					/*!< End row */
+	uint16_t color;				/*!< Color (RGB565) */
+	bool pending;				/*!< There are spans not sent yet */
+} lcd_span_rect_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -114,6 +189,182 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Copy a picture to an area of LCD, preparing each chunk while the previous one is transmitted
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	pic: Pointer to first byte of picture
+ * @retval 		None
+ */
+void Picture(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, const uint8_t* pic);
+
+/**
+ * @brief  		Task that performs asynchronous fills and pictures
+ * @param[in]  	pvParameter: Not used
+ * @retval 		None
+ */
+void AsyncTask(void *pvParameter);
+
+/**
+ * @brief  		Launch an asynchronous transfer (waits for the previous one to end)
+ * @param[in]  	job: Transfer to perform
+ * @retval 		None
+ */
+void StartAsync(lcd_async_t *job);
+
+/**
+ * @brief  		Add an horizontal span to the pending rectangle, sending it first when it can't be merged
+ * @param[in]  	x0: Start column
+ * @param[in]  	x1: End column
+ * @param[in]  	y: Row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void SpanAdd(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Send the pending rectangle of spans (if any)
+ * @retval 		None
+ */
+void SpanFlush(void);
+
+/**
+ * @brief  		Rasterize a filled circle as spans
+ * @param[in]  	x0: X coordinate of center circle point
+ * @param[in]  	y0: Y coordinate of center circle point
+ * @param[in]  	r: Circle radius
+ * @param[in]  	color: Circle color (RGB565)
+ * @retval 		None
+ */
+void FilledCircleSpans(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Rasterize a filled triangle as spans
+ * @param[in]  	x0, y0, x1, y1, x2, y2: Vertices coordinates
+ * @param[in]  	color: Triangle color (RGB565)
+ * @retval 		None
+ */
+void FilledTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+/**
+ * @brief  		Prepare a decoder to expand a glyph from its first row
+ * @param[out] 	dec: Decoder
+ * @param[in] 	data: Pointer to glyph data
+ * @param[in] 	width: Glyph width in pixels
+ * @param[in] 	format: Glyph data format
+ * @retval 		None
+ */
+void GlyphDecoderInit(glyph_decoder_t *dec, const uint8_t *data, uint8_t width, font_format_t format);
+
+/**
+ * @brief  		Expand next row of a glyph to RGB565
+ * @note		Runs of compressed glyphs are written as 16 bits fills, so dst must be 2 bytes aligned
+ * @param[in] 	dec: Decoder
+ * @param[in]  	foreground: Color for glyph (RGB565)
+ * @param[in]  	background: Color for glyph background (RGB565)
+ * @param[out] 	dst: Pointer to buffer where pixels are stored
+ * @retval 		None
+ */
+void GlyphDecodeRow(glyph_decoder_t *dec, uint16_t foreground, uint16_t background, uint8_t *dst);
+
+/**
+ * @brief  		Get a glyph from the cache, expanding it (and evicting the least recently used ones) on a miss
+ * @param[in]  	font: Pointer to used font
+ * @param[in] 	data: Character
+ * @param[in]  	foreground: Color for char (RGB565)
+ * @param[in]  	background: Color for char background (RGB565)
+ * @retval 		Pointer to cached glyph, NULL if glyph doesn't fit in cache
+ */
+glyph_t* GetGlyph(const Font_t *font, char data, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Send rows of pixels to LCD memory, preparing each chunk while the previous one is transmitted
+ * @note		Area must be already defined with SetCursorPosition
+ * @param[in]  	rows: Number of rows
+ * @param[in]  	row_bytes: Bytes per row
+ * @param[in]  	row_func: Function that writes a row of pixels to a buffer
+ * @retval 		None
+ */
+void StreamRows(uint16_t rows, uint32_t row_bytes, void (*row_func)(uint16_t row, uint8_t *dst));
+
+/**
+ * @brief  		Writes a row of the current text run (used with StreamRows)
+ * @param[in] 	row: Row of the text run
+ * @param[out] 	dst: Pointer to buffer where pixels are stored
+ * @retval 		None
+ */
+void RunRow(uint16_t row, uint8_t *dst);
+
+/**
+ * @brief  		Draw characters that fit in the same line in a single window
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in] 	str: Pointer to first character
+ * @param[in] 	len: Number of characters (up to MAX_RUN_CHARS)
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for chars (RGB565)
+ * @param[in]  	background: Color for chars background (RGB565)
+ * @retval 		None
+ */
+void DrawRun(uint16_t x, uint16_t y, const char *str, uint8_t len, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Compute the colors between background and foreground for the 16 coverage levels 
+ * 				of anti-aliased fonts. Table is only recomputed when colors change
+ * @param[in]  	foreground: Color for glyph (RGB565)
+ * @param[in]  	background: Color for glyph background (RGB565)
+ * @retval 		None
+ */
+void BlendLutUpdate(uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Writes a row of the icon being drawn (used with StreamRows)
+ * @param[in] 	row: Row of the icon
+ * @param[out] 	dst: Pointer to buffer where pixels are stored
+ * @retval 		None
+ */
+void IconRow(uint16_t row, uint8_t *dst);
+
+/**
+ * @brief  		Draw one primitive of a batch
+ * @param[in]  	prim: Primitive to draw
+ * @retval 		None
+ */
+void DrawPrimitive(const ili9341_primitive_t *prim);
+
+/**
+ * @brief  		Read a pixel of a compressed image
+ * @param[in]  	dec: Decoder state
+ * @retval 		Pixel with bytes in LCD order (high byte first in memory)
+ */
+uint16_t RleReadPixel(rle_decoder_t *dec);
+
+/**
+ * @brief  		Decompress pixels of an image straight to a buffer
+ * @param[in]  	dec: Decoder state
+ * @param[out] 	dst: Pointer to buffer where pixels are stored
+ * @param[in]  	pixels: Number of pixels to decompress
+ * @retval 		None
+ */
+void RleDecode(rle_decoder_t *dec, uint16_t *dst, uint32_t pixels);
+
+/**
+ * @brief  		Set the vertical scrolling area
+ * @param[in]  	top: Lines of the top fixed area
+ * @param[in]  	lines: Lines of the scrolling area
+ * @retval 		None
+ */
+void SetScrollArea(uint16_t top, uint16_t lines);
+
+/**
+ * @brief  		Set the frame memory line shown at the start of the scrolling area
+ * @param[in]  	line: Frame memory line
+ * @retval 		None
+ */
+void SetScrollStart(uint16_t line);
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -185,6 +436,53 @@ spi_mcu_config_t spi_conf = {
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
+static DMA_ATTR uint8_t dma_buffer[2][DMA_CHUNK_SIZE];	/*!< Ping-pong buffers for DMA transfers */
+
+static TaskHandle_t async_task_handle = NULL;		/*!< Task that performs asynchronous transfers */
+static SemaphoreHandle_t async_free = NULL;			/*!< Taken while an asynchronous transfer is in progress */
+static lcd_async_t async_job;						/*!< Current asynchronous transfer */
+static lcd_span_rect_t span_rect;					/*!< Spans waiting to be sent */
+static int16_t circle_half_width[ILI9341_HEIGHT];	/*!< Half width of each row of a filled circle */
+static glyph_t glyph_cache[GLYPH_CACHE_ENTRIES];	/*!< Expanded glyphs */
+static uint32_t glyph_cache_bytes = 0;				/*!< Memory used by the glyph cache */
+static uint32_t glyph_clock = 0;					/*!< Incremented on each glyph use, for LRU eviction */
+static uint16_t blend_lut[16];						/*!< Pixel for each coverage level, with bytes in LCD order */
+static uint16_t blend_fg, blend_bg;					/*!< Colors blend_lut was computed for */
+static bool blend_valid = false;					/*!< blend_lut was computed */
+
+/**
+ * @brief Strip chart being drawn
+ */
+static struct {
+	ili9341_strip_chart_t config;					/*!< Chart configuration */
+	uint16_t tfa;									/*!< Frame memory lines before the scrolling area */
+	uint16_t next;									/*!< Scrolling area line where the next sample goes */
+	uint16_t last;									/*!< Pixel of the last sample, across the chart */
+	uint8_t line[ILI9341_WIDTH * 2];				/*!< Pixels of a line of the chart */
+} strip_chart;
+
+/**
+ * @brief Text run being drawn
+ */
+static struct {
+	const char *str;					/*!< First character */
+	uint8_t len;						/*!< Number of characters */
+	Font_t *font;						/*!< Font */
+	uint16_t foreground;				/*!< Color for chars (RGB565) */
+	uint16_t background;				/*!< Color for chars background (RGB565) */
+	glyph_t *glyph[MAX_RUN_CHARS];		/*!< Cached glyph of each char, NULL if not cached */
+	glyph_decoder_t decoder[MAX_RUN_CHARS];	/*!< Decoder of each char not cached */
+} text_run;
+
+/**
+ * @brief Icon being drawn
+ */
+static struct {
+	glyph_decoder_t decoder;			/*!< Icon decoder */
+	uint16_t foreground;				/*!< Color for icon (RGB565) */
+	uint16_t background;				/*!< Color for icon background (RGB565) */
+} icon_run;
+
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
 		ILI9341_HEIGHT,
@@ -194,7 +492,12 @@ static orientation_properties_t lcd_orientation = {
 /*==================[internal functions definition]==========================*/
 
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
+	/* Drawing functions called while an asynchronous transfer is in progress wait for it to end */
+	if (async_task_handle != NULL && xTaskGetCurrentTaskHandle() != async_task_handle){
+		ILI9341WaitAsync();
+	}
+	/* DC line can't change until queued pixel data is sent */
+	SpiQueueWait(ili9341_spi, 0);
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
 		/* Send command */
@@ -210,7 +513,7 @@ void WriteLCD(lcd_cmd_t * data){
 }
 
 void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
-	static uint16_t aux;
+	uint16_t aux;
 	/* The lower column must be send first */
 	if (x0 > x1){
 		aux = x0;
@@ -232,10 +535,9 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	/* Not static: also run by AsyncTask while other tasks draw */
+	int32_t i, bytes_count, chunk;
+	int16_t x_dist, y_dist;
 
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
@@ -250,21 +552,538 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+
+	/* The same buffer is queued over and over, so it only has to be prepared once */
+	chunk = (bytes_count < DMA_CHUNK_SIZE) ? bytes_count : DMA_CHUNK_SIZE;
+	for (i = 0; i < chunk; i += 2){
+		dma_buffer[0][i] = HighByte(color);
+		dma_buffer[0][i + 1] = LowByte(color);
 	}
+	GPIOOn(ili9341_dc);
+	while(bytes_count > 0){
+		chunk = (bytes_count < DMA_CHUNK_SIZE) ? bytes_count : DMA_CHUNK_SIZE;
+		SpiWriteQueued(ili9341_spi, dma_buffer[0], chunk);
+		bytes_count -= chunk;
+	}
+	SpiQueueWait(ili9341_spi, 0);
+}
+
+void Picture(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, const uint8_t* pic){
+	/* Not static: also run by AsyncTask while other tasks draw */
+	uint8_t buf;
+	int32_t bytes_count, chunk;
+
+	SetCursorPosition(x0, y0, x1, y1);
+
+	/* Number of bytes to write. We have to write 2 bytes/pixel */
+	bytes_count = (x1 - x0 + 1) * (y1 - y0 + 1) * 2;
+
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+	GPIOOn(ili9341_dc);
+	buf = 0;
+	while(bytes_count > 0){
+		chunk = (bytes_count < DMA_CHUNK_SIZE) ? bytes_count : DMA_CHUNK_SIZE;
+		/* Wait until the buffer is not in use by the transfer queued two chunks ago */
+		SpiQueueWait(ili9341_spi, 1);
+		memcpy(dma_buffer[buf], pic, chunk);
+		SpiWriteQueued(ili9341_spi, dma_buffer[buf], chunk);
+		pic += chunk;
+		bytes_count -= chunk;
+		buf ^= 1;
+	}
+	SpiQueueWait(ili9341_spi, 0);
+}
+
+void SpanAdd(int16_t x0, int16_t x1, int16_t y, uint16_t color){
+	static int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	/* Clip to screen */
+	if (y < 0 || y >= lcd_orientation.height || x1 < 0 || x0 >= lcd_orientation.width){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	/* Spans with the same columns on the next row grow the pending rectangle */
+	if (span_rect.pending && span_rect.color == color && span_rect.x0 == x0 && 
+		span_rect.x1 == x1 && span_rect.y1 + 1 == y){
+		span_rect.y1 = y;
+		return;
+	}
+	SpanFlush();
+	span_rect.x0 = x0;
+	span_rect.x1 = x1;
+	span_rect.y0 = y;
+	span_rect.y1 = y;
+	span_rect.color = color;
+	span_rect.pending = true;
+}
+
+void SpanFlush(void){
+	if (span_rect.pending){
+		Fill(span_rect.x0, span_rect.y0, span_rect.x1, span_rect.y1, span_rect.color);
+		span_rect.pending = false;
+	}
+}
+
+void FilledCircleSpans(int16_t x0, int16_t y0, int16_t r, uint16_t color){
+	static int16_t f, ddF_x, ddF_y, x, y, dy;
+
+	if (r < 0 || r >= ILI9341_HEIGHT){
+		return;
+	}
+	f = 1 - r;
+	ddF_x = 1;
+	ddF_y = -2 * r;
+	x = 0;
+	y = r;
+
+	/* Same midpoint walk as ILI9341DrawCircle, keeping the widest point of each row */
+	for (dy = 0; dy <= r; dy++){
+		circle_half_width[dy] = 0;
+	}
+	circle_half_width[0] = r;
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		if (x > circle_half_width[y]){
+			circle_half_width[y] = x;
+		}
+		if (y > circle_half_width[x]){
+			circle_half_width[x] = y;
+		}
+	}
+	/* One span per row, top to bottom so rows of equal width merge */
+	for (dy = -r; dy <= r; dy++){
+		x = circle_half_width[dy < 0 ? -dy : dy];
+		SpanAdd(x0 - x, x0 + x, y0 + dy, color);
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+}
+
+void FilledTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
+	static int16_t aux, y, xa, xb;
+
+	/* Sort vertices by row (y0 <= y1 <= y2) */
+	if (y0 > y1){
+		aux = y0; y0 = y1; y1 = aux;
+		aux = x0; x0 = x1; x1 = aux;
+	}
+	if (y1 > y2){
+		aux = y1; y1 = y2; y2 = aux;
+		aux = x1; x1 = x2; x2 = aux;
+	}
+	if (y0 > y1){
+		aux = y0; y0 = y1; y1 = aux;
+		aux = x0; x0 = x1; x1 = aux;
+	}
+	/* Degenerate triangle: a single row */
+	if (y0 == y2){
+		xa = x0;
+		xb = x0;
+		if (x1 < xa) xa = x1;
+		if (x1 > xb) xb = x1;
+		if (x2 < xa) xa = x2;
+		if (x2 > xb) xb = x2;
+		SpanAdd(xa, xb, y0, color);
+		return;
+	}
+	for (y = y0; y <= y2; y++){
+		/* Long edge, from vertex 0 to vertex 2 */
+		xa = x0 + (int32_t)(x2 - x0) * (y - y0) / (y2 - y0);
+		/* Short edges, from vertex 0 to vertex 1 and from vertex 1 to vertex 2 */
+		if (y < y1){
+			xb = x0 + (int32_t)(x1 - x0) * (y - y0) / (y1 - y0);
+		}
+		else if (y2 != y1){
+			xb = x1 + (int32_t)(x2 - x1) * (y - y1) / (y2 - y1);
+		}
+		else{
+			xb = x1;
+		}
+		SpanAdd(xa, xb, y, color);
+	}
+}
+
+void DrawPrimitive(const ili9341_primitive_t *prim){
+	switch(prim->shape){
+	case ILI9341_LINE:
+		SpanFlush();
+		ILI9341DrawLine(prim->x0, prim->y0, prim->x1, prim->y1, prim->color);
+		break;
+
+	case ILI9341_RECTANGLE:
+		SpanFlush();
+		ILI9341DrawRectangle(prim->x0, prim->y0, prim->x1, prim->y1, prim->color);
+		break;
+
+	case ILI9341_FILLED_RECTANGLE:
+		SpanFlush();
+		Fill(prim->x0, prim->y0, prim->x1, prim->y1, prim->color);
+		break;
+
+	case ILI9341_CIRCLE:
+		SpanFlush();
+		ILI9341DrawCircle(prim->x0, prim->y0, prim->r, prim->color);
+		break;
+
+	case ILI9341_FILLED_CIRCLE:
+		FilledCircleSpans(prim->x0, prim->y0, prim->r, prim->color);
+		break;
+
+	case ILI9341_TRIANGLE:
+		SpanFlush();
+		ILI9341DrawTriangle(prim->x0, prim->y0, prim->x1, prim->y1, prim->x2, prim->y2, prim->color);
+		break;
+
+	case ILI9341_FILLED_TRIANGLE:
+		FilledTriangleSpans(prim->x0, prim->y0, prim->x1, prim->y1, prim->x2, prim->y2, prim->color);
+		break;
+	}
+}
+
+void GlyphDecoderInit(glyph_decoder_t *dec, const uint8_t *data, uint8_t width, font_format_t format){
+	dec->src = data;
+	dec->format = format;
+	dec->width = width;
+	dec->repeat = 0;
+}
+
+void GlyphDecodeRow(glyph_decoder_t *dec, uint16_t foreground, uint16_t background, uint8_t *dst){
+	static uint16_t j, color;
+	static uint8_t bits, mask, header, run;
+	static bool fg;
+	uint16_t *pixel;
+
+	if (dec->format == FONT_AA4){
+		/* Coverage of each pixel selects a precomputed color, 2 pixels per byte */
+		BlendLutUpdate(foreground, background);
+		pixel = (uint16_t *)dst;
+		for (j = 0; j + 1 < dec->width; j += 2){
+			*pixel++ = blend_lut[*dec->src >> 4];
+			*pixel++ = blend_lut[*dec->src++ & 0x0F];
+		}
+		if (j < dec->width){
+			*pixel = blend_lut[*dec->src++ >> 4];
+		}
+		return;
+	}
+
+	if (dec->format == FONT_RLE){
+		/* Row header: number of run lengths, bit 7 set if the row repeats */
+		if (dec->repeat == 0){
+			header = *dec->src++;
+			dec->repeat = 1;
+			if (header & MSK_BIT8){
+				dec->repeat += *dec->src++;
+			}
+			dec->nibbles = header & ~MSK_BIT8;
+			dec->runs = dec->src;
+			dec->src += (dec->nibbles + 1) / 2;
+		}
+		dec->repeat--;
+		/* Runs alternate background and foreground, starting with background.
+		 * Bytes are swapped so the high byte is sent first */
+		pixel = (uint16_t *)dst;
+		fg = false;
+		for (j = 0; j < dec->nibbles; j++){
+			run = (j & 1) ? (dec->runs[j / 2] & 0x0F) : (dec->runs[j / 2] >> 4);
+			color = fg ? foreground : background;
+			color = (color >> 8) | (color << 8);
+			while (run--){
+				*pixel++ = color;
+			}
+			fg = !fg;
+		}
+		return;
+	}
+
+	bits = *dec->src++;
+	mask = MSK_BIT8;
+	for (j = 0; j < dec->width; j++){
+		if (bits & mask){
+			*dst++ = HighByte(foreground);
+			*dst++ = LowByte(foreground);
+		}
+		else{
+			*dst++ = HighByte(background);
+			*dst++ = LowByte(background);
+		}
+		mask >>= 1;
+		if (mask == 0 && j + 1 < dec->width){
+			bits = *dec->src++;
+			mask = MSK_BIT8;
+		}
+	}
+}
+
+glyph_t* GetGlyph(const Font_t *font, char data, uint16_t foreground, uint16_t background){
+	static uint16_t i, row, row_bytes;
+	static uint32_t size;
+	static glyph_decoder_t dec;
+	glyph_t *glyph, *lru;
+
+	glyph_clock++;
+	for (i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+		glyph = &glyph_cache[i];
+		if (glyph->font == font && glyph->data == data && 
+			glyph->foreground == foreground && glyph->background == background){
+			glyph->last_use = glyph_clock;
+			return glyph;
+		}
+	}
+	row_bytes = font->info[data - ' '].width * 2;
+	size = row_bytes * font->font_height;
+	if (size == 0 || size > GLYPH_CACHE_BYTES){
+		return NULL;
+	}
+	/* Evict least recently used glyphs until there is a free entry and enough memory */
+	while (1){
+		glyph = NULL;
+		lru = NULL;
+		for (i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+			if (glyph_cache[i].font == NULL){
+				glyph = &glyph_cache[i];
+			}
+			else if (!glyph_cache[i].in_use && (lru == NULL || glyph_cache[i].last_use < lru->last_use)){
+				lru = &glyph_cache[i];
+			}
+		}
+		if (glyph != NULL && glyph_cache_bytes + size <= GLYPH_CACHE_BYTES){
+			break;
+		}
+		if (lru == NULL){
+			return NULL;
+		}
+		heap_caps_free(lru->pixels);
+		glyph_cache_bytes -= lru->size;
+		lru->font = NULL;
+	}
+	glyph->pixels = heap_caps_malloc(size, MALLOC_CAP_DMA);
+	if (glyph->pixels == NULL){
+		return NULL;
+	}
+	GlyphDecoderInit(&dec, &font->data[font->info[data - ' '].offset], font->info[data - ' '].width, font->format);
+	for (row = 0; row < font->font_height; row++){
+		GlyphDecodeRow(&dec, foreground, background, &glyph->pixels[row * row_bytes]);
+	}
+	glyph->font = font;
+	glyph->data = data;
+	glyph->foreground = foreground;
+	glyph->background = background;
+	glyph->size = size;
+	glyph->last_use = glyph_clock;
+	glyph->in_use = false;
+	glyph_cache_bytes += size;
+	return glyph;
+}
+
+void StreamRows(uint16_t rows, uint32_t row_bytes, void (*row_func)(uint16_t row, uint8_t *dst)){
+	static uint8_t buf;
+	static uint16_t row, rows_chunk, i;
+
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+
+	GPIOOn(ili9341_dc);
+	rows_chunk = DMA_CHUNK_SIZE / row_bytes;
+	buf = 0;
+	row = 0;
+	while (row < rows){
+		if (rows_chunk > rows - row){
+			rows_chunk = rows - row;
+		}
+		/* Wait until the buffer is not in use by the transfer queued two chunks ago */
+		SpiQueueWait(ili9341_spi, 1);
+		for (i = 0; i < rows_chunk; i++){
+			row_func(row + i, &dma_buffer[buf][i * row_bytes]);
+		}
+		SpiWriteQueued(ili9341_spi, dma_buffer[buf], rows_chunk * row_bytes);
+		row += rows_chunk;
+		buf ^= 1;
+	}
+	SpiQueueWait(ili9341_spi, 0);
+}
+
+void RunRow(uint16_t row, uint8_t *dst){
+	static uint8_t i;
+	static uint16_t row_bytes;
+
+	for (i = 0; i < text_run.len; i++){
+		row_bytes = text_run.font->info[text_run.str[i] - ' '].width * 2;
+		if (text_run.glyph[i] != NULL){
+			memcpy(dst, &text_run.glyph[i]->pixels[row * row_bytes], row_bytes);
+		}
+		else{
+			GlyphDecodeRow(&text_run.decoder[i], text_run.foreground, text_run.background, dst);
+		}
+		dst += row_bytes;
+		/* One pixel of space between characters */
+		if (i < text_run.len - 1){
+			*dst++ = HighByte(text_run.background);
+			*dst++ = LowByte(text_run.background);
+		}
+	}
+}
+
+void DrawRun(uint16_t x, uint16_t y, const char *str, uint8_t len, Font_t *font, uint16_t foreground, uint16_t background){
+	static uint8_t i;
+	static uint16_t width;
+
+	text_run.str = str;
+	text_run.len = len;
+	text_run.font = font;
+	text_run.foreground = foreground;
+	text_run.background = background;
+	width = 0;
+	for (i = 0; i < len; i++){
+		width += font->info[str[i] - ' '].width + 1;
+		text_run.glyph[i] = GetGlyph(font, str[i], foreground, background);
+		if (text_run.glyph[i] != NULL){
+			text_run.glyph[i]->in_use = true;
+		}
+		else{
+			GlyphDecoderInit(&text_run.decoder[i], &font->data[font->info[str[i] - ' '].offset], 
+				font->info[str[i] - ' '].width, font->format);
+		}
+	}
+	/* Last character has no space after it */
+	width--;
+	SetCursorPosition(x, y, x + width - 1, y + font->font_height - 1);
+	StreamRows(font->font_height, width * 2, RunRow);
+	for (i = 0; i < len; i++){
+		if (text_run.glyph[i] != NULL){
+			text_run.glyph[i]->in_use = false;
+		}
+	}
+}
+
+void BlendLutUpdate(uint16_t foreground, uint16_t background){
+	static uint8_t i;
+	static int32_t r, g, b;
+
+	if (blend_valid && foreground == blend_fg && background == blend_bg){
+		return;
+	}
+	for (i = 0; i < 16; i++){
+		/* Interpolate each channel of RGB565 */
+		r = (background >> 11) + ((int32_t)(foreground >> 11) - (background >> 11)) * i / 15;
+		g = ((background >> 5) & 0x3F) + ((int32_t)((foreground >> 5) & 0x3F) - ((background >> 5) & 0x3F)) * i / 15;
+		b = (background & 0x1F) + ((int32_t)(foreground & 0x1F) - (background & 0x1F)) * i / 15;
+		blend_lut[i] = (r << 11) | (g << 5) | b;
+		/* Swap bytes so the high byte is sent first */
+		blend_lut[i] = (blend_lut[i] >> 8) | (blend_lut[i] << 8);
+	}
+	blend_fg = foreground;
+	blend_bg = background;
+	blend_valid = true;
+}
+
+void IconRow(uint16_t row, uint8_t *dst){
+	GlyphDecodeRow(&icon_run.decoder, icon_run.foreground, icon_run.background, dst);
+}
+
+uint16_t RleReadPixel(rle_decoder_t *dec){
+	static uint16_t color;
+	/* ESP32-C6 is little endian: swap bytes so the high byte is sent first */
+	if (dec->palette != NULL){
+		color = dec->palette[*dec->src++];
+		return (color >> 8) | (color << 8);
+	}
+	color = dec->src[0] | (dec->src[1] << 8);
+	dec->src += 2;
+	return color;
+}
+
+void RleDecode(rle_decoder_t *dec, uint16_t *dst, uint32_t pixels){
+	static uint8_t header, n;
+
+	while (pixels > 0){
+		/* Start a new packet */
+		if (dec->count == 0){
+			header = *dec->src++;
+			dec->count = (header & 0x7F) + 1;
+			dec->run = header & 0x80;
+			if (dec->run){
+				dec->pixel = RleReadPixel(dec);
+			}
+		}
+		n = (dec->count < pixels) ? dec->count : pixels;
+		dec->count -= n;
+		pixels -= n;
+		if (dec->run){
+			while (n--){
+				*dst++ = dec->pixel;
+			}
+		}
+		else{
+			while (n--){
+				*dst++ = RleReadPixel(dec);
+			}
+		}
+	}
+}
+
+void SetScrollArea(uint16_t top, uint16_t lines){
+	uint16_t bottom = ILI9341_HEIGHT - top - lines;
+	uint8_t scroll_def[] = {HighByte(top), LowByte(top), HighByte(lines), LowByte(lines), HighByte(bottom), LowByte(bottom)};
+	lcd_cmd_t lcd_scroll_def = {VERT_SCROLL_DEF, sizeof(scroll_def), scroll_def};
+	WriteLCD(&lcd_scroll_def);
+}
+
+void SetScrollStart(uint16_t line){
+	uint8_t scroll_start[] = {HighByte(line), LowByte(line)};
+	lcd_cmd_t lcd_scroll_start = {VERT_SCROLL_START, sizeof(scroll_start), scroll_start};
+	WriteLCD(&lcd_scroll_start);
+}
+
+void AsyncTask(void *pvParameter){
+	lcd_async_t job;
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		/* Local copy, a new transfer can be launched as soon as async_free is given */
+		job = async_job;
+		if (job.pic == NULL){
+			Fill(job.x0, job.y0, job.x1, job.y1, job.color);
+		}
+		else{
+			Picture(job.x0, job.y0, job.x1, job.y1, job.pic);
+		}
+		xSemaphoreGive(async_free);
+		if (job.func_p != NULL){
+			job.func_p(job.param_p);
+		}
+	}
+}
+
+void StartAsync(lcd_async_t *job){
+	if (async_task_handle == NULL){
+		async_free = xSemaphoreCreateBinary();
+		xSemaphoreGive(async_free);
+		xTaskCreate(AsyncTask, "ili9341_async", 2048, NULL, 5, &async_task_handle);
+	}
+	xSemaphoreTake(async_free, portMAX_DELAY);
+	async_job = *job;
+	xTaskNotifyGive(async_task_handle);
 }
 
 /*==================[external functions definition]==========================*/
@@ -273,6 +1092,7 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	/* SPI configuration */
 	spi_conf.device = spi_dev;
 	ili9341_spi = spi_dev;
+	SpiInit(&spi_conf);
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
@@ -350,11 +1170,10 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static int32_t bytes_count, chunk;
+	static uint8_t *pixels;
+	glyph_t *glyph;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -366,57 +1185,34 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
+	glyph = GetGlyph(font, data, foreground, background);
+	if (glyph == NULL){
+		/* Glyph too big for the cache: expand it while it is sent */
+		DrawRun(lcd_x, lcd_y, &data, 1, font, foreground, background);
+		return;
+	}
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
+	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
 
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
+	/* Cached glyph is already in RGB565, send it straight from the cache */
+	GPIOOn(ili9341_dc);
+	pixels = glyph->pixels;
+	bytes_count = glyph->size;
+	while (bytes_count > 0){
+		chunk = (bytes_count < DMA_CHUNK_SIZE) ? bytes_count : DMA_CHUNK_SIZE;
+		SpiWriteQueued(ili9341_spi, pixels, chunk);
+		pixels += chunk;
+		bytes_count -= chunk;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	SpiQueueWait(ili9341_spi, 0);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -430,47 +1226,16 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
+	/* Compressed icons have different sizes, their positions are in a table */
+	if (icon_font->format == FONT_RLE){
+		GlyphDecoderInit(&icon_run.decoder, &icon_font->data[icon_font->offsets[icon]], icon_font->width, FONT_RLE);
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	else{
+		GlyphDecoderInit(&icon_run.decoder, &icon_font->data[icon * icon_font->offset], icon_font->width, FONT_BITMAP);
+	}
+	icon_run.foreground = foreground;
+	icon_run.background = background;
+	StreamRows(icon_font->height, icon_font->width * 2, IconRow);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
@@ -489,7 +1254,8 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
 }
 
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
-	static uint16_t lcd_x, lcd_y;
+	static uint16_t lcd_x, lcd_y, width, char_width;
+	static uint8_t len;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -508,17 +1274,48 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 				lcd_x = x;
 			}
 			str++;
+			continue;
 		}
 		else if (*str == '\r'){
-				str++;
+			str++;
+			continue;
+		}
+
+		/* Characters up to the end of line or the right border of the screen are sent in one window */
+		len = 0;
+		width = 0;
+		while (str[len] != '\0' && str[len] != '\n' && str[len] != '\r' && len < MAX_RUN_CHARS){
+			char_width = font->info[str[len] - ' '].width;
+			if (lcd_x + width + char_width > lcd_orientation.width){
+				break;
 			}
+			width += char_width + 1;
+			len++;
+		}
+		if (len == 0){
+			/* Character doesn't fit in this line, ILI9341DrawChar moves it to a new one */
+			ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
+			lcd_x += font->info[*str - ' '].width + 1;
+			str++;
+		}
+		else{
+			DrawRun(lcd_x, lcd_y, str, len, font, foreground, background);
+			lcd_x += width;
+			str += len;
+		}
+	}
+}
 
-		/* Put character to LCD */
-		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-		lcd_x += font->info[*str - ' '].width + 1;
-		/* Next character */
-		str++;
+void ILI9341GlyphCacheClear(void){
+	static uint16_t i;
+
+	for (i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+		if (glyph_cache[i].font != NULL){
+			heap_caps_free(glyph_cache[i].pixels);
+			glyph_cache[i].font = NULL;
+		}
 	}
+	glyph_cache_bytes = 0;
 }
 
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height){
@@ -536,6 +1333,7 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static uint16_t run_x, run_y, next_x, next_y;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -576,25 +1374,36 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	/* Diagonal line */
 	else{
 		error = x_dist - y_dist;
+		run_x = x0;
+		run_y = y0;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
 			if (x0 == x1 && y0 == y1){
+				Fill(run_x, run_y, x0, y0, color);
 				break;
 			}
 			error_2 = 2 * error;
+			next_x = x0;
+			next_y = y0;
 			/* Determine if line must grow in x direction */
 			if (error_2 > -y_dist){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
+				next_x += x_grow;
 			}
 			/* Determine if line must grow in y direction */
 			if (error_2 < x_dist){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+				next_y += y_grow;
 			}
+			/* Pixels are sent in runs: a run ends when the line leaves its row (flat lines) or its column (steep lines) */
+			if ((x_dist >= y_dist && next_y != y0) || (x_dist < y_dist && next_x != x0)){
+				Fill(run_x, run_y, x0, y0, color);
+				run_x = next_x;
+				run_y = next_y;
+			}
+			x0 = next_x;	/* Move start point */
+			y0 = next_y;
 		}
 	}
 }
@@ -647,36 +1456,8 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
-
-	f = 1 - r;
-	ddF_x = 1;
-	ddF_y = -2 * r;
-	x = 0;
-	y = r;
-
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
-    }
+	FilledCircleSpans(x0, y0, r, color);
+	SpanFlush();
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -686,148 +1467,194 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
 }
 
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
-	static int16_t x_0 = 0;
-	static int16_t y_0 = 0;
-	static int16_t x_1 = 0;
-	static int16_t y_1 = 0;
-	static int16_t x_2 = 0;
-	static int16_t y_2 = 0;
-	static int16_t x_aux = 0;
-	static int16_t y_aux = 0;
-	static int16_t scanline_y = 0;
-	float invslope1, invslope2, curx1, curx2;
-	if((y0 <= y1) && (y0 <= y2)){
-		x_0 = x0;
-		y_0 = y0;
-		if(y1 <= y2){
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x1;
-			y_2 = y1;
-		}
-	}else if((y1 <= y2) && (y1 <= y0)){
-		x_0 = x1;
-		y_0 = y1;
-		if(y0 <= y2){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x0;
-			y_2 = y0;
-		}
-	}else if((y2 <= y1) && (y2 <= y0)){
-		x_0 = x2;
-		y_0 = y2;
-		if(y0 <= y1){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x1;
-			y_2 = y1;
-		} else{
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x0;
-			y_2 = y0;
-		}
-	}
-	if(y_1 == y_2){
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-  	}
-  	else if (y_0 == y_1){
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		invslope2 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-  	}
-  	else{
-		// Split in a flat top triangle and a bottom flat triangle
-		x_aux = (int)(x_0 + (float)(y_1 - y_0) / (float)(y_2 - y_0) * (x_2 - x_0));
-		y_aux = y_1;
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_aux - x_0) / (float)(y_aux - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		invslope2 = (float)(x_2 - x_aux) / (float)(y_2 - y_aux);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
-  	}
+	FilledTriangleSpans(x0, y0, x1, y1, x2, y2, color);
+	SpanFlush();
+}
+
+void ILI9341DrawSpans(const ili9341_span_t *spans, uint16_t n, uint16_t color){
+	static uint16_t i;
+
+	ILI9341WaitAsync();
+	SpiAcquire(ili9341_spi);
+	for (i = 0; i < n; i++){
+		SpanAdd(spans[i].x0, spans[i].x1, spans[i].y, color);
+	}
+	SpanFlush();
+	SpiRelease(ili9341_spi);
+}
+
+void ILI9341DrawBatch(const ili9341_primitive_t *prims, uint16_t n){
+	static uint16_t i;
+
+	ILI9341WaitAsync();
+	SpiAcquire(ili9341_spi);
+	for (i = 0; i < n; i++){
+		DrawPrimitive(&prims[i]);
+	}
+	SpanFlush();
+	SpiRelease(ili9341_spi);
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	Picture(x, y, x + width - 1, y + height - 1, pic);
+}
 
-	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+void ILI9341DrawRleImage(uint16_t x, uint16_t y, const ili9341_rle_image_t *image){
+	static uint8_t buf;
+	static int32_t pixels_count, chunk;
+	rle_decoder_t dec = {image->palette, image->data, 0, false, 0};
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = width * height * 2;
+	SetCursorPosition(x, y, x + image->width - 1, y + image->height - 1);
+	pixels_count = image->width * image->height;
 
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	GPIOOn(ili9341_dc);
+	buf = 0;
+	while (pixels_count > 0){
+		chunk = (pixels_count < DMA_CHUNK_SIZE / 2) ? pixels_count : DMA_CHUNK_SIZE / 2;
+		/* Wait until the buffer is not in use by the transfer queued two chunks ago */
+		SpiQueueWait(ili9341_spi, 1);
+		RleDecode(&dec, (uint16_t *)dma_buffer[buf], chunk);
+		SpiWriteQueued(ili9341_spi, dma_buffer[buf], chunk * 2);
+		pixels_count -= chunk;
+		buf ^= 1;
+	}
+	SpiQueueWait(ili9341_spi, 0);
+}
+
+void ILI9341FillAsync(uint16_t color, ili9341_callback_t func_p, void *param_p){
+	lcd_async_t job = {0, 0, lcd_orientation.width, lcd_orientation.height, color, NULL, func_p, param_p};
+	StartAsync(&job);
+}
+
+void ILI9341DrawPictureAsync(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic, 
+	ili9341_callback_t func_p, void *param_p){
+	lcd_async_t job = {x, y, x + width - 1, y + height - 1, 0, pic, func_p, param_p};
+	StartAsync(&job);
+}
+
+void ILI9341WaitAsync(void){
+	if (async_free != NULL){
+		xSemaphoreTake(async_free, portMAX_DELAY);
+		xSemaphoreGive(async_free);
+	}
+}
+
+bool ILI9341StripChartInit(ili9341_strip_chart_t *chart){
+	/* Nothing of the chart inside the LCD or reversed range: rejected, no chart active */
+	if (chart->top >= ILI9341_HEIGHT || chart->length == 0 || chart->pos >= ILI9341_WIDTH || 
+		chart->height == 0 || chart->max < chart->min){
+		strip_chart.config.length = 0;
+		return false;
+	}
+	strip_chart.config = *chart;
+	if (strip_chart.config.top + strip_chart.config.length > ILI9341_HEIGHT){
+		strip_chart.config.length = ILI9341_HEIGHT - strip_chart.config.top;
+	}
+	if (strip_chart.config.pos + strip_chart.config.height > ILI9341_WIDTH){
+		strip_chart.config.height = ILI9341_WIDTH - strip_chart.config.pos;
+	}
+	if (strip_chart.config.max == strip_chart.config.min){
+		if (strip_chart.config.max == INT32_MAX){
+			strip_chart.config.min--;
+		}
+		else{
+			strip_chart.config.max++;
+		}
+	}
+	strip_chart.next = 0;
+	strip_chart.last = 0;
+	/* In Portrait_2 and Landscape_2 frame memory lines are written in reverse order (MY = 1) */
+	if (lcd_orientation.orientation == ILI9341_Portrait_2 || lcd_orientation.orientation == ILI9341_Landscape_2){
+		strip_chart.tfa = ILI9341_HEIGHT - strip_chart.config.top - strip_chart.config.length;
+	}
+	else{
+		strip_chart.tfa = strip_chart.config.top;
+	}
+	SetScrollArea(strip_chart.tfa, strip_chart.config.length);
+	SetScrollStart(strip_chart.tfa);
+	/* Clear the chart area */
+	if (lcd_orientation.orientation == ILI9341_Landscape_1 || lcd_orientation.orientation == ILI9341_Landscape_2){
+		Fill(strip_chart.config.top, strip_chart.config.pos, 
+			strip_chart.config.top + strip_chart.config.length - 1, strip_chart.config.pos + strip_chart.config.height - 1, 
+			strip_chart.config.background);
+	}
+	else{
+		Fill(strip_chart.config.pos, strip_chart.config.top, 
+			strip_chart.config.pos + strip_chart.config.height - 1, strip_chart.config.top + strip_chart.config.length - 1, 
+			strip_chart.config.background);
+	}
+	return true;
+}
+
+void ILI9341StripChartAdd(int32_t sample){
+	static uint16_t i, line, pixel, from, to;
+	static bool landscape, flipped;
+	ili9341_strip_chart_t *chart = &strip_chart.config;
+
+	/* No chart active */
+	if (chart->length == 0){
+		return;
+	}
+	landscape = (lcd_orientation.orientation == ILI9341_Landscape_1 || lcd_orientation.orientation == ILI9341_Landscape_2);
+	flipped = (lcd_orientation.orientation == ILI9341_Portrait_2 || lcd_orientation.orientation == ILI9341_Landscape_2);
+
+	/* Scale sample to a pixel across the chart (0: min, height - 1: max) */
+	if (sample < chart->min){
+		sample = chart->min;
+	}
+	if (sample > chart->max){
+		sample = chart->max;
+	}
+	pixel = ((int64_t)sample - chart->min) * (chart->height - 1) / ((int64_t)chart->max - chart->min);
+
+	/* Background, plus a segment joining the previous sample with the new one */
+	from = (pixel < strip_chart.last) ? pixel : strip_chart.last;
+	to = (pixel < strip_chart.last) ? strip_chart.last : pixel;
+	for (i = 0; i < chart->height; i++){
+		/* In landscape the line is written top to bottom, so max goes first */
+		uint16_t p = landscape ? (chart->height - 1 - i) : i;
+		if (p >= from && p <= to){
+			strip_chart.line[2 * i] = HighByte(chart->foreground);
+			strip_chart.line[2 * i + 1] = LowByte(chart->foreground);
+		}
+		else{
+			strip_chart.line[2 * i] = HighByte(chart->background);
+			strip_chart.line[2 * i + 1] = LowByte(chart->background);
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	strip_chart.last = pixel;
+
+	/* The oldest line is overwritten and becomes the newest one when the start of the scrolling area moves. 
+	 * The newest line is the last one shown, or the first one when frame memory is written in reverse order */
+	if (flipped){
+		strip_chart.next = (strip_chart.next + chart->length - 1) % chart->length;
+		line = ILI9341_HEIGHT - 1 - (strip_chart.tfa + strip_chart.next);
+	}
+	else{
+		line = strip_chart.tfa + strip_chart.next;
+	}
+	if (landscape){
+		SetCursorPosition(line, chart->pos, line, chart->pos + chart->height - 1);
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	else{
+		SetCursorPosition(chart->pos, line, chart->pos + chart->height - 1, line);
+	}
+	lcd_cmd_t lcd_pixels = {MEM_WRITE, chart->height * 2, strip_chart.line};
+	WriteLCD(&lcd_pixels);
+	if (!flipped){
+		strip_chart.next = (strip_chart.next + 1) % chart->length;
+	}
+	SetScrollStart(strip_chart.tfa + strip_chart.next);
+}
+
+void ILI9341StripChartDeInit(void){
+	strip_chart.config.length = 0;
+	SetScrollArea(0, ILI9341_HEIGHT);
+	SetScrollStart(0);
 }
 
 uint8_t ILI9341DeInit(void){
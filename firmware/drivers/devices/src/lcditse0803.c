@@ -12,6 +12,8 @@
 /*==================[inclusions]=============================================*/
 #include "lcditse0803.h"
 #include "gpio_mcu.h"
+#include "gpio_fast_out_mcu.h"
+#include "delay_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_BCD_1	GPIO_20
 #define GPIO_BCD_2	GPIO_21
@@ -20,60 +22,94 @@
 #define GPIO_SEL_1	GPIO_19
 #define GPIO_SEL_2	GPIO_18
 #define GPIO_SEL_3	GPIO_9
+#define LCD_DIGITS	3
+#define LATCH_US	1		/* Latch enable pulse width */
+#define BCD_BLANK	0x0F	/* BCD code that turns a digit off */
+#define BCD_OFF		0xFFF	/* All digits off */
+/* Bundle bits: BCD in b0-b3, SEL_1 to SEL_3 in b4-b6 */
+#define FAST_BCD_MASK	0x0F
+#define FAST_SEL(digit)	(1 << (4 + (digit)))
+#define FAST_SEL_MASK	(FAST_SEL(0) | FAST_SEL(1) | FAST_SEL(2))
+/* Fallback without dedicated GPIO channels: BCD pins are consecutive */
+#define BCD_SHIFT	GPIO_BCD_1
+#define BCD_MASK	(0x0F << BCD_SHIFT)
+#define SEL_MASK	(GPIO_MASK(GPIO_SEL_1) | GPIO_MASK(GPIO_SEL_2) | GPIO_MASK(GPIO_SEL_3))
+/* Packed BCD of 0 to 999: hundreds in b8-b11, tens in b4-b7, units in b0-b3 */
+#define BCD(h, t, u)	(((h) << 8) | ((t) << 4) | (u))
+#define BCD_UNITS(h, t)	BCD(h, t, 0), BCD(h, t, 1), BCD(h, t, 2), BCD(h, t, 3), BCD(h, t, 4), \
+						BCD(h, t, 5), BCD(h, t, 6), BCD(h, t, 7), BCD(h, t, 8), BCD(h, t, 9)
+#define BCD_TENS(h)		BCD_UNITS(h, 0), BCD_UNITS(h, 1), BCD_UNITS(h, 2), BCD_UNITS(h, 3), BCD_UNITS(h, 4), \
+						BCD_UNITS(h, 5), BCD_UNITS(h, 6), BCD_UNITS(h, 7), BCD_UNITS(h, 8), BCD_UNITS(h, 9)
 /*==================[internal data definition]===============================*/
 static uint16_t actual_value = 0; /*variable that saves the value to be shown in the display LCD*/
+static uint16_t shown_bcd;		/* Packed BCD currently latched in the display */
+static gpio_fast_t lcd_bundle;
+static bool lcd_fast = false;	/* Pins driven by dedicated GPIO channels */
+static const gpio_t lcd_pins[] = {GPIO_BCD_1, GPIO_BCD_2, GPIO_BCD_3, GPIO_BCD_4, GPIO_SEL_1, GPIO_SEL_2, GPIO_SEL_3};
+static const uint32_t sel_mask[LCD_DIGITS] = {GPIO_MASK(GPIO_SEL_1), GPIO_MASK(GPIO_SEL_2), GPIO_MASK(GPIO_SEL_3)};
+static const uint16_t bcd_table[1000] = {
+	BCD_TENS(0), BCD_TENS(1), BCD_TENS(2), BCD_TENS(3), BCD_TENS(4),
+	BCD_TENS(5), BCD_TENS(6), BCD_TENS(7), BCD_TENS(8), BCD_TENS(9)
+};
 /*==================[internal functions declaration]=========================*/
 /** @brief Aux function to load a digit to the LCD Display
  *
+ * Data and latch enable are written together (the latch is transparent), the falling
+ * edge of the latch enable keeps the digit.
+ *
+ * @param digit Digit (0: hundreds, 1: tens, 2: units)
+ * @param bcd BCD code
  */
-bool LcdItsE0803BCDtoPin(uint8_t value){
-	GPIOState(GPIO_BCD_1, (value & (1<<0))>>0);
-	GPIOState(GPIO_BCD_2, (value & (1<<1))>>1);
-	GPIOState(GPIO_BCD_3, (value & (1<<2))>>2);
-	GPIOState(GPIO_BCD_4, (value & (1<<3))>>3);
-	return true;
+static void LcdItsE0803Digit(uint8_t digit, uint8_t bcd){
+	if(lcd_fast){
+		GPIOFastBundleWrite(&lcd_bundle, FAST_BCD_MASK | FAST_SEL_MASK, bcd | FAST_SEL(digit));
+		DelayUs(LATCH_US);
+		GPIOFastBundleWrite(&lcd_bundle, FAST_SEL_MASK, 0);
+	}else{
+		GPIOWriteMask(BCD_MASK | SEL_MASK, ((uint32_t)bcd << BCD_SHIFT) | sel_mask[digit]);
+		DelayUs(LATCH_US);
+		GPIOClearMask(SEL_MASK);
+	}
+}
+
+/** @brief Aux function to show a packed BCD value, only changed digits are written
+ *
+ * @param bcd Packed BCD (hundreds in b8-b11)
+ */
+static void LcdItsE0803Show(uint16_t bcd){
+	uint8_t digit, shift;
+
+	for(digit = 0; digit < LCD_DIGITS; digit++){
+		shift = (LCD_DIGITS - 1 - digit) * 4;
+		if(((bcd ^ shown_bcd) >> shift) & 0x0F){
+			LcdItsE0803Digit(digit, (bcd >> shift) & 0x0F);
+		}
+	}
+	shown_bcd = bcd;
 }
 /*==================[external functions definition]==========================*/
 bool LcdItsE0803Init(void){
-	/* Configuration of pins of data*/
-	GPIOInit(GPIO_BCD_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_3, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_4, GPIO_OUTPUT);
+	uint8_t i;
 
-	/* Configuration of pins of control*/
-	GPIOInit(GPIO_SEL_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
+	/* Configuration of pins of data and control, dedicated GPIO channels if free */
+	lcd_fast = GPIOFastBundleInit(&lcd_bundle, lcd_pins, sizeof(lcd_pins) / sizeof(gpio_t));
+	if(!lcd_fast){
+		for(i = 0; i < sizeof(lcd_pins) / sizeof(gpio_t); i++){
+			GPIOInit(lcd_pins[i], GPIO_OUTPUT);
+		}
+	}
 
-	actual_value=0;
-	LcdItsE0803Write(actual_value);
+	actual_value = 0;
+	/* Every digit differs: all of them are written */
+	shown_bcd = ~bcd_table[actual_value];
+	LcdItsE0803Show(bcd_table[actual_value]);
 	return true;
 };
 
 bool LcdItsE0803Write(uint16_t value) {
-	uint8_t units, tens, hundreds;
 	if(value<1000)	 {
 		actual_value = value;
-
-		hundreds = value/100;
-		tens = (value-(hundreds*100))/10;
-		units = (value-(hundreds*100)-(tens*10));
-
-		/* Write hundreds */
-		LcdItsE0803BCDtoPin(hundreds);
-		GPIOOn(GPIO_SEL_1);
-		GPIOOff(GPIO_SEL_1);
-
-		/* Write tens */
-		LcdItsE0803BCDtoPin(tens);
-		GPIOOn(GPIO_SEL_2);
-		GPIOOff(GPIO_SEL_2);
-
-		/* Write units */
-		LcdItsE0803BCDtoPin(units);
-		GPIOOn(GPIO_SEL_3);
-		GPIOOff(GPIO_SEL_3);
+		LcdItsE0803Show(bcd_table[value]);
 		return true; /* return 1 for values lower than 999 */
 	}
 	else
@@ -85,20 +121,14 @@ uint16_t LcdItsE0803Read(void){
 }
 
 void LcdItsE0803Off(void){
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_1);
-	GPIOOff(GPIO_SEL_1);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_2);
-	GPIOOff(GPIO_SEL_2);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_3);
-	GPIOOff(GPIO_SEL_3);
+	LcdItsE0803Show(BCD_OFF);
 }
 
 bool LcdItsE0803DeInit(void){
+	if(lcd_fast){
+		GPIOFastBundleDeinit(&lcd_bundle);
+		lcd_fast = false;
+	}
 	GPIODeinit();
 	return true;
 }
@@ -11,33 +11,84 @@
 
 /*==================[inclusions]=============================================*/
 #include "led.h"
+#include <stddef.h>
 #include "gpio_mcu.h"
+#include "pwm_mcu.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_LED1 GPIO_11
 #define GPIO_LED2 GPIO_10
 #define GPIO_LED3 GPIO_5
+#define GPIO_LEDS_MASK (GPIO_MASK(GPIO_LED1) | GPIO_MASK(GPIO_LED2) | GPIO_MASK(GPIO_LED3))
+#define LED_QTY		3
+#define LED_PWM_FREQ	1000	/* PWM frequency of dimmable LEDs (Hz) */
+#define LED_FULL	100
+typedef struct {
+	gpio_t pin;
+	pwm_out_t out;
+	uint8_t brightness;			/* Last brightness set (%) */
+	bool up;					/* Breathing: next ramp is a fade in */
+	uint32_t fade_ms;			/* Breathing: ramp time */
+	esp_timer_handle_t timer;	/* Breathing: starts each ramp */
+} led_dim_t;
 /*==================[internal data declaration]==============================*/
-
+static gpio_port_t leds_port;	/* b0: LED_3, b1: LED_2, b2: LED_1 (same as led_t) */
+static bool dim_mode = false;	/* LEDs driven by PWM outputs */
+static led_dim_t led_dim[LED_QTY] = {	/* Same order as led_t bits */
+	{.pin = GPIO_LED3, .out = PWM_2},
+	{.pin = GPIO_LED2, .out = PWM_1},
+	{.pin = GPIO_LED1, .out = PWM_0},
+};
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Gets the dimmable LED data of a LED
+ * 
+ * @param led LED number
+ * @return led_dim_t* NULL if invalid LED number
+ */
+static led_dim_t *LedDimData(led_t led);
 
+/**
+ * @brief Breathing timer callback: starts the next ramp
+ * 
+ * @param args Pointer to dimmable LED data
+ */
+static void LedBreatheStep(void *args);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static led_dim_t *LedDimData(led_t led){
+	switch (led){
+	case LED_3:
+		return &led_dim[0];
+	case LED_2:
+		return &led_dim[1];
+	case LED_1:
+		return &led_dim[2];
+	}
+	return NULL;
+}
+
+static void LedBreatheStep(void *args){
+	led_dim_t *dim = args;
+
+	dim->brightness = dim->up ? LED_FULL : 0;
+	PWMFade(dim->out, dim->brightness, dim->fade_ms);
+	dim->up = !dim->up;
+}
 
 /*==================[external functions definition]==========================*/
 
 uint8_t LedsInit(void){
+	const gpio_t leds_pins[] = {GPIO_LED3, GPIO_LED2, GPIO_LED1};
+
 	/** Configuration of the GPIO */
-	GPIOInit(GPIO_LED1, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED2, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED3, GPIO_OUTPUT);
+	GPIOPortInit(&leds_port, leds_pins, sizeof(leds_pins) / sizeof(gpio_t));
 
 	/** Turn off leds*/
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
+	GPIOClearMask(GPIO_LEDS_MASK);
 
 	return true;
 }
@@ -45,6 +96,9 @@ uint8_t LedsInit(void){
 /** \brief Function to turn on a specific led */
 uint8_t LedOn(led_t led){
 	uint8_t result = false;
+	if(dim_mode){
+		return LedDim(led, LED_FULL);
+	}
 	switch (led){
 	case LED_1:
 		GPIOOn(GPIO_LED1);
@@ -64,6 +118,9 @@ uint8_t LedOn(led_t led){
 
 uint8_t LedOff(led_t led){
 	uint8_t result = false;
+	if(dim_mode){
+		return LedDim(led, 0);
+	}
 	switch (led){
 	case LED_1:
 		GPIOOff(GPIO_LED1);
@@ -83,6 +140,10 @@ uint8_t LedOff(led_t led){
 
 uint8_t LedToggle(led_t led){
 	uint8_t result = false;
+	if(dim_mode){
+		led_dim_t *dim = LedDimData(led);
+		return (dim != NULL) && LedDim(led, dim->brightness ? 0 : LED_FULL);
+	}
 
 	switch (led){
 	case LED_1:
@@ -103,17 +164,80 @@ uint8_t LedToggle(led_t led){
 }
 
 uint8_t LedsOffAll(void){
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
+	if(dim_mode){
+		return LedsMask(0);
+	}
+	GPIOClearMask(GPIO_LEDS_MASK);
 	
 	return true;
 }
 
 uint8_t LedsMask(uint8_t mask){
-	GPIOState(GPIO_LED1, (mask & LED_1) >> 2);
-	GPIOState(GPIO_LED2, (mask & LED_2) >> 1);
-	GPIOState(GPIO_LED3, (mask & LED_3));
+	if(dim_mode){
+		LedDim(LED_3, (mask & LED_3) ? LED_FULL : 0);
+		LedDim(LED_2, (mask & LED_2) ? LED_FULL : 0);
+		LedDim(LED_1, (mask & LED_1) ? LED_FULL : 0);
+		return true;
+	}
+	GPIOPortWrite(&leds_port, mask);
+	return true;
+}
+
+uint8_t LedsDimInit(void){
+	uint8_t i;
+
+	for(i = 0; i < LED_QTY; i++){
+		PWMInit(led_dim[i].out, led_dim[i].pin, LED_PWM_FREQ);
+		led_dim[i].brightness = 0;
+		if(led_dim[i].timer == NULL){
+			const esp_timer_create_args_t timer_args = {
+				.callback = LedBreatheStep,
+				.arg = &led_dim[i],
+				.name = "led",
+			};
+			esp_timer_create(&timer_args, &led_dim[i].timer);
+		}
+	}
+	dim_mode = true;
+	return true;
+}
+
+uint8_t LedDim(led_t led, uint8_t brightness){
+	led_dim_t *dim = LedDimData(led);
+
+	if(!dim_mode || dim == NULL){
+		return false;
+	}
+	esp_timer_stop(dim->timer);
+	dim->brightness = brightness;
+	PWMSetDutyCycle(dim->out, brightness);
+	return true;
+}
+
+uint8_t LedFade(led_t led, uint8_t brightness, uint32_t time_ms){
+	led_dim_t *dim = LedDimData(led);
+
+	if(!dim_mode || dim == NULL){
+		return false;
+	}
+	esp_timer_stop(dim->timer);
+	dim->brightness = brightness;
+	PWMFade(dim->out, brightness, time_ms);
+	return true;
+}
+
+uint8_t LedBreathe(led_t led, uint32_t period_ms){
+	led_dim_t *dim = LedDimData(led);
+
+	if(!dim_mode || dim == NULL || period_ms < 2){
+		return false;
+	}
+	esp_timer_stop(dim->timer);
+	/* Ramps slightly shorter than half a period: each one ends before the next starts */
+	dim->fade_ms = period_ms / 2 - period_ms / 32;
+	dim->up = (dim->brightness < LED_FULL / 2);
+	LedBreatheStep(dim);
+	esp_timer_start_periodic(dim->timer, (uint64_t)period_ms * 1000 / 2);
 	return true;
 }
 
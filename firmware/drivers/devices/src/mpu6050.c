@@ -13,32 +13,317 @@
 #include "mpu6050.h"
 #include "math.h"
 #include <string.h>
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 /*==================[macros and definitions]=================================*/
-#define I2C_NUM I2C_NUM_0
+#define STREAM_SAMPLE_BYTES     12      /*!< Accelerometer and gyroscope X, Y, Z in FIFO */
+#define STREAM_BURST_SAMPLES    (UINT8_MAX / STREAM_SAMPLE_BYTES)  /*!< Samples in a burst read */
+#define STREAM_FIFO_SIZE        1024    /*!< FIFO size in bytes */
+#define STREAM_GYRO_RATE        1000    /*!< Gyroscope output rate with DLPF enabled (Hz) */
+#define EVENT_MG_PER_LSB        2       /*!< FF_THR, MOT_THR and ZRMOT_THR unit */
+#define EVENT_STILL_MS_PER_LSB  64      /*!< ZRMOT_DUR unit */
 
 /*==================[internal data definition]===============================*/
 uint8_t devAddr;
 uint8_t buffer[14];
+
+/**
+ * @brief FIFO stream state
+ */
+static struct {
+	mpu6050_stream_config_t config;		/*!< Stream configuration */
+	TaskHandle_t task;					/*!< Task that drains the FIFO */
+	QueueHandle_t queue;				/*!< Blocks ready to be read */
+	uint32_t period;					/*!< Time between samples (us) */
+	uint8_t accel_fs;					/*!< Accelerometer full scale range */
+	uint8_t gyro_fs;					/*!< Gyroscope full scale range */
+	volatile uint32_t isr_samples;		/*!< Samples signalled by data ready interrupt */
+	volatile int64_t isr_time;			/*!< Time of last data ready interrupt (us) */
+	uint32_t read_samples;				/*!< Samples read from FIFO */
+	uint32_t lost;						/*!< Samples lost */
+	bool running;						/*!< Stream is running */
+} stream;
+/**
+ * @brief Data ready pipeline state
+ */
+static struct {
+	mpu6050_sample_callback_t func_p;	/*!< Function called with each sample */
+	void *param_p;						/*!< Parameter for func_p */
+	TaskHandle_t task;					/*!< Task that reads the samples */
+	gpio_t int_pin;						/*!< GPIO connected to MPU6050 INT pin */
+	float accel_scale;					/*!< g per LSB */
+	float gyro_scale;					/*!< degrees/s per LSB */
+	volatile int64_t isr_time;			/*!< Time of last data ready interrupt (us) */
+	bool running;						/*!< Pipeline is running */
+} data_ready;
+/**
+ * @brief Motion events state
+ */
+static struct {
+	mpu6050_event_callback_t func_p;	/*!< Function called with the events */
+	void *param_p;						/*!< Parameter for func_p */
+	TaskHandle_t task;					/*!< Task that reads the interrupt status */
+	gpio_t int_pin;						/*!< GPIO connected to MPU6050 INT pin */
+	bool running;						/*!< Event detection is running */
+} event;
+static portMUX_TYPE stream_lock = portMUX_INITIALIZER_UNLOCKED;	/*!< Protects interrupt counters */
+static float accel_gain[3] = {1.0f, 1.0f, 1.0f};	/*!< Accelerometer scale correction (calibration) */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Configure sample rate, data ready interrupt on INT pin and the GPIO interrupt
+ * @param int_pin GPIO connected to MPU6050 INT pin
+ * @param rate Sample rate in Hz (4 to 1000)
+ * @param isr Function called on each data ready pulse
+ * @return Time between samples (us)
+ */
+uint32_t MPU6050_dataReadyConfig(gpio_t int_pin, uint16_t rate, void (*isr)(void *args));
 
-/*==================[external functions definition]==========================*/
-void MPU6050_ReadRegister(uint8_t reg, uint8_t *data, uint8_t len){
-	uint8_t dev = 0x68;
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(dev, reg);
+/**
+ * @brief Check if the INT pin is in use: stream, data ready pipeline and events share it
+ * @return true if any of them is running
+ */
+bool MPU6050_intBusy(void);
+
+/**
+ * @brief Data ready interrupt: timestamps the sample and wakes the data ready task
+ * @param args Not used
+ */
+void IRAM_ATTR MPU6050_dataReadyIsr(void *args);
+
+/**
+ * @brief Task that reads each sample when it is ready and hands it to the callback
+ * @param pvParameter Not used
+ */
+void MPU6050_dataReadyTask(void *pvParameter);
+
+/**
+ * @brief Data ready interrupt: counts samples and wakes the stream task when a block is complete
+ * @param args Not used
+ */
+void IRAM_ATTR MPU6050_streamIsr(void *args);
+
+/**
+ * @brief Event interrupt: wakes the event task
+ * @param args Not used
+ */
+void IRAM_ATTR MPU6050_eventIsr(void *args);
 
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (dev << 1) | I2C_MASTER_READ, 1));
+/**
+ * @brief Task that reads the interrupt status and calls the event callback
+ * @param pvParameter Not used
+ */
+void MPU6050_eventTask(void *pvParameter);
 
-	if(len>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, len, I2C_MASTER_ACK));
+/**
+ * @brief Convert an acceleration threshold to the detectors unit
+ * @param mg Threshold (mg)
+ * @return Register value (2 mg/LSB, 1 to 255)
+ */
+uint8_t MPU6050_eventThreshold(uint16_t mg);
 
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+len-1, I2C_MASTER_NACK));
+/**
+ * @brief Task that drains sample blocks from the FIFO
+ * @param pvParameter Not used
+ */
+void MPU6050_streamTask(void *pvParameter);
 
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000));
-	i2c_cmd_link_delete(cmd);
+/**
+ * @brief Empty FIFO and resynchronize sample count with the interrupt
+ */
+void MPU6050_streamRestart();
+
+/*==================[internal functions definition]==========================*/
+uint32_t MPU6050_dataReadyConfig(gpio_t int_pin, uint16_t rate, void (*isr)(void *args)){
+	uint8_t dlpf;
+	uint32_t period;
+
+	I2C_batchBegin(devAddr);
+	/* Sample rate = 1 kHz / (1 + SMPLRT_DIV), with DLPF enabled */
+	dlpf = MPU6050_getDLPFMode();
+	if(dlpf == MPU6050_DLPF_BW_256 || dlpf > MPU6050_DLPF_BW_5){
+		MPU6050_setDLPFMode(MPU6050_DLPF_BW_188);
+	}
+	MPU6050_setRate(STREAM_GYRO_RATE / rate - 1);
+	period = 1000000UL * (MPU6050_getRate() + 1) / STREAM_GYRO_RATE;
+	/* Data ready pulse on INT pin, active high */
+	MPU6050_setInterruptMode(false);
+	MPU6050_setInterruptDrive(false);
+	MPU6050_setInterruptLatch(false);
+	MPU6050_setIntEnabled(1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+	I2C_batchEnd(devAddr);
+
+	GPIOInit(int_pin, GPIO_INPUT);
+	GPIOActivInt(int_pin, isr, true, NULL);
+	return period;
+}
+
+bool MPU6050_intBusy(void){
+	return stream.running || data_ready.running || event.running;
+}
+
+void IRAM_ATTR MPU6050_dataReadyIsr(void *args){
+	BaseType_t woken = pdFALSE;
+	data_ready.isr_time = esp_timer_get_time();
+	vTaskNotifyGiveFromISR(data_ready.task, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+void IRAM_ATTR MPU6050_eventIsr(void *args){
+	BaseType_t woken = pdFALSE;
+	vTaskNotifyGiveFromISR(event.task, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+void MPU6050_eventTask(void *pvParameter){
+	uint8_t status, events;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!event.running){
+			continue;
+		}
+		/* Reading INT_STATUS clears it and releases the INT pin */
+		status = MPU6050_getIntStatus();
+		events = 0;
+		if(status & (1 << MPU6050_INTERRUPT_FF_BIT)){
+			events |= MPU6050_EVENT_FREEFALL;
+		}
+		if(status & (1 << MPU6050_INTERRUPT_MOT_BIT)){
+			events |= MPU6050_EVENT_MOTION;
+		}
+		if(status & (1 << MPU6050_INTERRUPT_ZMOT_BIT)){
+			/* Zero motion interrupts on both transitions */
+			events |= MPU6050_getZeroMotionDetected() ? MPU6050_EVENT_STILL : MPU6050_EVENT_MOVING;
+		}
+		if(events != 0){
+			event.func_p(events, event.param_p);
+		}
+	}
+}
+
+uint8_t MPU6050_eventThreshold(uint16_t mg){
+	mg /= EVENT_MG_PER_LSB;
+	return mg == 0 ? 1 : (mg > UINT8_MAX ? UINT8_MAX : mg);
+}
+
+void MPU6050_dataReadyTask(void *pvParameter){
+	static mpu6050_sample_t sample;
+	static uint8_t data[14];
+	static const float deg_to_rad = 3.14159265f / 180.0f;
+	uint8_t j;
+	int16_t raw;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(!data_ready.running){
+			continue;
+		}
+		sample.timestamp = data_ready.isr_time;
+		/* Accelerometer, temperature and gyroscope in one burst read */
+		if(I2C_readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, sizeof(data), data, I2C_MASTER_TIMEOUT_MS) == 0){
+			continue;
+		}
+		for(j = 0; j < 3; j++){
+			raw = (data[2 * j] << 8) | data[2 * j + 1];
+			sample.accel[j] = raw * data_ready.accel_scale * accel_gain[j];
+			raw = (data[8 + 2 * j] << 8) | data[9 + 2 * j];
+			sample.gyro[j] = raw * data_ready.gyro_scale * deg_to_rad;
+		}
+		raw = (data[6] << 8) | data[7];
+		sample.temperature = raw / 340.0f + 36.53f;
+		data_ready.func_p(&sample, data_ready.param_p);
+	}
+}
+
+void IRAM_ATTR MPU6050_streamIsr(void *args){
+	BaseType_t woken = pdFALSE;
+	portENTER_CRITICAL_ISR(&stream_lock);
+	stream.isr_time = esp_timer_get_time();
+	stream.isr_samples++;
+	portEXIT_CRITICAL_ISR(&stream_lock);
+	if(stream.isr_samples - stream.read_samples >= stream.config.block){
+		vTaskNotifyGiveFromISR(stream.task, &woken);
+	}
+	portYIELD_FROM_ISR(woken);
+}
+
+void MPU6050_streamRestart(){
+	MPU6050_setFIFOEnabled(false);
+	MPU6050_resetFIFO();
+	portENTER_CRITICAL(&stream_lock);
+	stream.read_samples = stream.isr_samples;
+	portEXIT_CRITICAL(&stream_lock);
+	MPU6050_setFIFOEnabled(true);
+}
+
+void MPU6050_streamTask(void *pvParameter){
+	static mpu6050_block_t block;
+	static uint8_t data[STREAM_BURST_SAMPLES * STREAM_SAMPLE_BYTES];
+	uint16_t available;
+	uint32_t isr_samples;
+	int64_t isr_time;
+	uint8_t i, j, burst;
+	int16_t raw;
+
+	while(true){
+		/* Woken when a block is complete, the timeout recovers from missed interrupts */
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(stream.config.block * stream.period / 500 + 10));
+		if(!stream.running){
+			continue;
+		}
+		available = MPU6050_getFIFOCount();
+		if(available >= STREAM_FIFO_SIZE){
+			/* Overflow: oldest samples were overwritten */
+			stream.lost += available / STREAM_SAMPLE_BYTES;
+			MPU6050_streamRestart();
+			continue;
+		}
+		available /= STREAM_SAMPLE_BYTES;
+		while(available >= stream.config.block){
+			portENTER_CRITICAL(&stream_lock);
+			isr_samples = stream.isr_samples;
+			isr_time = stream.isr_time;
+			portEXIT_CRITICAL(&stream_lock);
+			/* Last interrupt is the newest sample, go back to the first sample of the block */
+			block.timestamp = isr_time - (int64_t)(isr_samples - 1 - stream.read_samples) * stream.period;
+			block.period = stream.period;
+			block.count = 0;
+			while(block.count < stream.config.block){
+				burst = stream.config.block - block.count;
+				if(burst > STREAM_BURST_SAMPLES){
+					burst = STREAM_BURST_SAMPLES;
+				}
+				MPU6050_getFIFOBytes(data, burst * STREAM_SAMPLE_BYTES);
+				for(i = 0; i < burst; i++){
+					for(j = 0; j < 3; j++){
+						/* 16384 LSB/g at +/-2g, halved on each range up. Result in mg */
+						raw = (data[i * STREAM_SAMPLE_BYTES + 2 * j] << 8) | data[i * STREAM_SAMPLE_BYTES + 2 * j + 1];
+						block.accel[block.count][j] = (int32_t)raw * 1000 * (1 << stream.accel_fs) / 16384;
+						/* 131 LSB/(degrees/s) at +/-250 degrees/s, halved on each range up. Result in 0.1 degrees/s */
+						raw = (data[i * STREAM_SAMPLE_BYTES + 6 + 2 * j] << 8) | data[i * STREAM_SAMPLE_BYTES + 7 + 2 * j];
+						block.gyro[block.count][j] = (int32_t)raw * 10 * (1 << stream.gyro_fs) / 131;
+					}
+					block.count++;
+				}
+			}
+			stream.read_samples += block.count;
+			available -= block.count;
+			if(xQueueSend(stream.queue, &block, 0) != pdTRUE){
+				stream.lost += block.count;
+			}
+			else if(stream.config.func_p != NULL){
+				stream.config.func_p(stream.config.param_p);
+			}
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void MPU6050_ReadRegister(uint8_t reg, uint8_t *data, uint8_t len){
+	I2C_readBytes(MPU6050_DEFAULT_ADDRESS, reg, len, data, I2C_MASTER_TIMEOUT_MS);
 }
 
 void MPU6050_Address(uint8_t address) {
@@ -47,10 +332,27 @@ void MPU6050_Address(uint8_t address) {
 
 void MPU6050_initialize() {
 	devAddr = MPU6050_DEFAULT_ADDRESS;
+    MPU6050_enableShadow();
+    I2C_batchBegin(devAddr);
     MPU6050_setClockSource(MPU6050_CLOCK_PLL_XGYRO);
     MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_250);
     MPU6050_setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
     MPU6050_setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
+    I2C_batchEnd(devAddr);
+}
+
+/** Keep configuration registers in the I2C register shadow.
+ * Bit writes to them (most of the set* functions) don't read the register over the bus.
+ * Status, data, FIFO, USER_CTRL and SIGNAL_PATH_RESET registers are left out: the device changes them 
+ * by itself.
+ */
+void MPU6050_enableShadow() {
+    /* SMPLRT_DIV ... I2C_SLV4_CTRL (I2C_SLV4_DI and I2C_MST_STATUS are read-only) */
+    I2C_shadowEnable(devAddr, MPU6050_RA_SMPLRT_DIV, MPU6050_RA_I2C_SLV4_CTRL);
+    /* INT_PIN_CFG, INT_ENABLE */
+    I2C_shadowEnable(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_RA_INT_ENABLE);
+    /* PWR_MGMT_1, PWR_MGMT_2 (DEVICE_RESET clears itself, MPU6050_reset invalidates the shadow) */
+    I2C_shadowEnable(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_RA_PWR_MGMT_2);
 }
 
 /** Verify the I2C connection.
@@ -2409,6 +2711,8 @@ void MPU6050_resetSensors() {
  */
 void MPU6050_reset() {
     I2C_writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true);
+    /* All registers go back to their reset values */
+    I2C_shadowInvalidate(devAddr);
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2766,4 +3070,184 @@ void MPU6050_setDeviceID(uint8_t id) {
     I2C_writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
 }
 
+void MPU6050_getAccelOffset(int16_t* x, int16_t* y, int16_t* z) {
+    I2C_readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, buffer, I2C_MASTER_TIMEOUT_MS);
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+}
+
+void MPU6050_setAccelOffset(int16_t x, int16_t y, int16_t z) {
+    uint8_t data[6] = {x >> 8, x & 0xFF, y >> 8, y & 0xFF, z >> 8, z & 0xFF};
+    I2C_writeBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data);
+}
+
+void MPU6050_getGyroOffset(int16_t* x, int16_t* y, int16_t* z) {
+    I2C_readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, buffer, I2C_MASTER_TIMEOUT_MS);
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+}
+
+void MPU6050_setGyroOffset(int16_t x, int16_t y, int16_t z) {
+    uint8_t data[6] = {x >> 8, x & 0xFF, y >> 8, y & 0xFF, z >> 8, z & 0xFF};
+    I2C_writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data);
+}
+
+void MPU6050_setAccelScale(const float scale[3]) {
+    uint8_t i;
+    for(i = 0; i < 3; i++){
+        accel_gain[i] = scale[i];
+    }
+}
+
+bool MPU6050_streamStart(const mpu6050_stream_config_t *config){
+	if(config->rate < 4 || config->rate > STREAM_GYRO_RATE || config->block == 0 || 
+		config->block > MPU6050_STREAM_BLOCK_MAX){
+		return false;
+	}
+	if(stream.running){
+		MPU6050_streamStop();
+	}
+	if(MPU6050_intBusy()){
+		return false;
+	}
+	stream.config = *config;
+	if(stream.task == NULL){
+		stream.queue = xQueueCreate(MPU6050_STREAM_QUEUE_SIZE, sizeof(mpu6050_block_t));
+		xTaskCreate(MPU6050_streamTask, "mpu6050_stream", 3072, NULL, 10, &stream.task);
+	}
+	xQueueReset(stream.queue);
+	stream.lost = 0;
+
+	stream.period = MPU6050_dataReadyConfig(config->int_pin, config->rate, MPU6050_streamIsr);
+	stream.accel_fs = MPU6050_getFullScaleAccelRange();
+	stream.gyro_fs = MPU6050_getFullScaleGyroRange();
+	/* Accelerometer and gyroscope in FIFO (12 bytes per sample) */
+	I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT) | 
+		(1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT));
+	MPU6050_streamRestart();
+	stream.running = true;
+	return true;
+}
+
+bool MPU6050_streamRead(mpu6050_block_t *block, uint32_t timeout){
+	if(stream.queue == NULL){
+		return false;
+	}
+	return xQueueReceive(stream.queue, block, pdMS_TO_TICKS(timeout)) == pdTRUE;
+}
+
+uint32_t MPU6050_streamLost(){
+	return stream.lost;
+}
+
+void MPU6050_streamStop(){
+	stream.running = false;
+	MPU6050_setIntEnabled(0);
+	GPIODeactivInt(stream.config.int_pin);
+	MPU6050_setFIFOEnabled(false);
+	I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+	MPU6050_resetFIFO();
+}
+
+bool MPU6050_dataReadyStart(gpio_t int_pin, uint16_t rate, mpu6050_sample_callback_t func_p, void *param_p){
+	if(rate < 4 || rate > STREAM_GYRO_RATE || func_p == NULL){
+		return false;
+	}
+	if(data_ready.running){
+		MPU6050_dataReadyStop();
+	}
+	if(MPU6050_intBusy()){
+		return false;
+	}
+	data_ready.func_p = func_p;
+	data_ready.param_p = param_p;
+	if(data_ready.task == NULL){
+		xTaskCreate(MPU6050_dataReadyTask, "mpu6050_drdy", 3072, NULL, 10, &data_ready.task);
+	}
+	/* 16384 LSB/g and 131 LSB/(degrees/s) on the lowest ranges, halved on each range up */
+	data_ready.accel_scale = (1 << MPU6050_getFullScaleAccelRange()) / 16384.0f;
+	data_ready.gyro_scale = (1 << MPU6050_getFullScaleGyroRange()) / 131.0f;
+	MPU6050_dataReadyConfig(int_pin, rate, MPU6050_dataReadyIsr);
+	data_ready.int_pin = int_pin;
+	data_ready.running = true;
+	return true;
+}
+
+void MPU6050_dataReadyStop(){
+	data_ready.running = false;
+	MPU6050_setIntEnabled(0);
+	GPIODeactivInt(data_ready.int_pin);
+}
+
+bool MPU6050_eventStart(const mpu6050_event_config_t *config){
+	uint8_t enabled = 0;
+	uint16_t still;
+
+	if(config->func_p == NULL || (config->events & (MPU6050_EVENT_FREEFALL | MPU6050_EVENT_MOTION | 
+		MPU6050_EVENT_STILL | MPU6050_EVENT_MOVING)) == 0){
+		return false;
+	}
+	/* Free fall needs the high pass filter off, motion and zero motion need it on */
+	if((config->events & MPU6050_EVENT_FREEFALL) && (config->events & ~MPU6050_EVENT_FREEFALL)){
+		return false;
+	}
+	if(event.running){
+		MPU6050_eventStop();
+	}
+	if(MPU6050_intBusy()){
+		return false;
+	}
+	event.func_p = config->func_p;
+	event.param_p = config->param_p;
+	if(event.task == NULL){
+		xTaskCreate(MPU6050_eventTask, "mpu6050_event", 2048, NULL, 10, &event.task);
+	}
+
+	I2C_batchBegin(devAddr);
+	if(config->events & MPU6050_EVENT_FREEFALL){
+		MPU6050_setFreefallDetectionThreshold(MPU6050_eventThreshold(config->freefall_threshold));
+		MPU6050_setFreefallDetectionDuration(config->freefall_duration);
+		enabled |= 1 << MPU6050_INTERRUPT_FF_BIT;
+	}
+	if(config->events & MPU6050_EVENT_MOTION){
+		MPU6050_setMotionDetectionThreshold(MPU6050_eventThreshold(config->motion_threshold));
+		MPU6050_setMotionDetectionDuration(config->motion_duration);
+		enabled |= 1 << MPU6050_INTERRUPT_MOT_BIT;
+	}
+	if(config->events & (MPU6050_EVENT_STILL | MPU6050_EVENT_MOVING)){
+		still = config->still_duration / EVENT_STILL_MS_PER_LSB;
+		MPU6050_setZeroMotionDetectionThreshold(MPU6050_eventThreshold(config->still_threshold));
+		MPU6050_setZeroMotionDetectionDuration(still > UINT8_MAX ? UINT8_MAX : still);
+		enabled |= 1 << MPU6050_INTERRUPT_ZMOT_BIT;
+	}
+	/* Free fall: raw acceleration. Motion and zero motion: high pass filtered (gravity removed) */
+	MPU6050_setDHPFMode((config->events & MPU6050_EVENT_FREEFALL) ? MPU6050_DHPF_RESET : MPU6050_DHPF_5);
+	MPU6050_setFreefallDetectionCounterDecrement(1);
+	MPU6050_setMotionDetectionCounterDecrement(1);
+	/* INT pin active high, held until INT_STATUS is read */
+	MPU6050_setInterruptMode(false);
+	MPU6050_setInterruptDrive(false);
+	MPU6050_setInterruptLatch(true);
+	MPU6050_setInterruptLatchClear(false);
+	MPU6050_setIntEnabled(enabled);
+	I2C_batchEnd(devAddr);
+
+	GPIOInit(config->int_pin, GPIO_INPUT);
+	GPIOActivInt(config->int_pin, MPU6050_eventIsr, true, NULL);
+	event.int_pin = config->int_pin;
+	event.running = true;
+	/* Release the INT pin if an event was already latched */
+	MPU6050_getIntStatus();
+	return true;
+}
+
+void MPU6050_eventStop(){
+	event.running = false;
+	MPU6050_setIntEnabled(0);
+	GPIODeactivInt(event.int_pin);
+	MPU6050_getIntStatus();
+}
+
 /*==================[end of file]============================================*/
@@ -0,0 +1,256 @@
+/**
+ * @file mpu6050_cal.c
+ * @author Juan Cerrudo (juan.cerrudo@uner.edu.ar)
+ * @brief Calibration of the MPU6050 offsets, persisted in NVS
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "mpu6050_cal.h"
+#include "mpu6050.h"
+#include "delay_mcu.h"
+#include "nvs.h"
+/*==================[macros and definitions]=================================*/
+#define CAL_NVS_NAMESPACE   "mpu6050"
+#define CAL_NVS_KEY         "cal"
+#define CAL_VERSION         1
+#define CAL_SETTLE_SAMPLES  50          /*!< Samples discarded after changing ranges */
+#define CAL_ACCEL_1G        16384       /*!< LSB/g on +/-2 g range */
+#define CAL_ACCEL_REG       8           /*!< Accelerometer LSB (+/-2 g) per offset register LSB (+/-16 g) */
+#define CAL_GYRO_REG        4           /*!< Gyroscope LSB (+/-250 degrees/s) per offset register LSB (+/-1000 degrees/s) */
+#define CAL_GYRO_STILL      393         /*!< Gyroscope peak to peak allowed while still (3 degrees/s) */
+#define CAL_ACCEL_STILL     1638        /*!< Accelerometer peak to peak allowed while still (0.1 g) */
+
+/*==================[internal data definition]===============================*/
+/**
+ * @brief Calibration saved in NVS
+ */
+typedef struct {
+	uint8_t version;				/*!< CAL_VERSION */
+	mpu6050_cal_t cal;				/*!< Calibration */
+} cal_blob_t;
+
+static mpu6050_cal_t calibration = {.accel_scale = {1.0f, 1.0f, 1.0f}};
+/**
+ * @brief Accelerometer pose captures, without offset registers (+/-2 g LSB)
+ */
+static struct {
+	int32_t up[3];					/*!< Axis pointing up (+1 g) */
+	int32_t down[3];				/*!< Axis pointing down (-1 g) */
+	uint8_t up_done;				/*!< Axes captured up (bit mask) */
+	uint8_t down_done;				/*!< Axes captured down (bit mask) */
+} pose;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Average accelerometer and gyroscope at +/-2 g and +/-250 degrees/s
+ * Ranges and sample rate are restored after the capture.
+ * @param samples Samples to average
+ * @param mean Mean of ax, ay, az, gx, gy, gz
+ * @return false if the sensor moved during the capture
+ */
+bool MPU6050_calCapture(uint16_t samples, int32_t mean[6]);
+
+/**
+ * @brief Write the calibration to the sensor
+ */
+void MPU6050_calApply(void);
+
+/**
+ * @brief Division rounded to nearest
+ */
+int32_t MPU6050_calDiv(int32_t num, int32_t den);
+/*==================[internal functions definition]==========================*/
+bool MPU6050_calCapture(uint16_t samples, int32_t mean[6]){
+	int16_t raw[6];
+	int32_t sum[6] = {0};
+	int16_t min[6], max[6];
+	uint8_t accel_fs, gyro_fs, rate;
+	uint16_t i;
+	uint8_t j;
+
+	if(samples == 0){
+		return false;
+	}
+	accel_fs = MPU6050_getFullScaleAccelRange();
+	gyro_fs = MPU6050_getFullScaleGyroRange();
+	rate = MPU6050_getRate();
+	MPU6050_setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
+	MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_250);
+	MPU6050_setRate(0);
+
+	for(i = 0; i < CAL_SETTLE_SAMPLES + samples; i++){
+		DelayUs(1000);
+		MPU6050_getMotion6(&raw[0], &raw[1], &raw[2], &raw[3], &raw[4], &raw[5]);
+		if(i < CAL_SETTLE_SAMPLES){
+			continue;
+		}
+		for(j = 0; j < 6; j++){
+			if(i == CAL_SETTLE_SAMPLES){
+				min[j] = max[j] = raw[j];
+			}
+			min[j] = raw[j] < min[j] ? raw[j] : min[j];
+			max[j] = raw[j] > max[j] ? raw[j] : max[j];
+			sum[j] += raw[j];
+		}
+	}
+
+	MPU6050_setFullScaleAccelRange(accel_fs);
+	MPU6050_setFullScaleGyroRange(gyro_fs);
+	MPU6050_setRate(rate);
+
+	for(j = 0; j < 6; j++){
+		if(max[j] - min[j] > (j < 3 ? CAL_ACCEL_STILL : CAL_GYRO_STILL)){
+			return false;
+		}
+		mean[j] = MPU6050_calDiv(sum[j], samples);
+	}
+	return true;
+}
+
+void MPU6050_calApply(void){
+	MPU6050_setGyroOffset(calibration.gyro_offset[0], calibration.gyro_offset[1], calibration.gyro_offset[2]);
+	MPU6050_setAccelOffset(calibration.accel_offset[0], calibration.accel_offset[1], calibration.accel_offset[2]);
+	MPU6050_setAccelScale(calibration.accel_scale);
+}
+
+int32_t MPU6050_calDiv(int32_t num, int32_t den){
+	return (num >= 0 ? num + den / 2 : num - den / 2) / den;
+}
+/*==================[external functions definition]==========================*/
+bool MPU6050_calibrate(bool force){
+	if(!force && MPU6050_calLoad()){
+		return true;
+	}
+	if(!MPU6050_calRun(MPU6050_CAL_SAMPLES)){
+		return false;
+	}
+	return MPU6050_calSave();
+}
+
+bool MPU6050_calRun(uint16_t samples){
+	int32_t mean[6], expected;
+	int16_t accel[3], gyro[3];
+	uint8_t j, vertical = 0;
+
+	MPU6050_getAccelOffset(&accel[0], &accel[1], &accel[2]);
+	MPU6050_getGyroOffset(&gyro[0], &gyro[1], &gyro[2]);
+	if(!MPU6050_calCapture(samples, mean)){
+		return false;
+	}
+	for(j = 1; j < 3; j++){
+		if(abs(mean[j]) > abs(mean[vertical])){
+			vertical = j;
+		}
+	}
+	for(j = 0; j < 3; j++){
+		/* Gyroscope reads zero, accelerometer +/-1 g on the vertical axis and zero on the others */
+		calibration.gyro_offset[j] = gyro[j] - MPU6050_calDiv(mean[3 + j], CAL_GYRO_REG);
+		expected = 0;
+		if(j == vertical){
+			expected = CAL_ACCEL_1G / calibration.accel_scale[j];
+			expected = mean[j] < 0 ? -expected : expected;
+		}
+		/* Bit 0 is reserved */
+		calibration.accel_offset[j] = ((accel[j] - MPU6050_calDiv(mean[j] - expected, CAL_ACCEL_REG)) & ~1) | (accel[j] & 1);
+	}
+	MPU6050_calApply();
+	return true;
+}
+
+bool MPU6050_calAccelPose(uint16_t samples, uint8_t *axes){
+	int32_t mean[6], center, sensitivity;
+	int16_t accel[3];
+	uint8_t j, vertical = 0;
+
+	MPU6050_getAccelOffset(&accel[0], &accel[1], &accel[2]);
+	MPU6050_getGyroOffset(&calibration.gyro_offset[0], &calibration.gyro_offset[1], &calibration.gyro_offset[2]);
+	for(j = 0; j < 3; j++){
+		calibration.accel_offset[j] = accel[j];
+	}
+	if(!MPU6050_calCapture(samples, mean)){
+		*axes = pose.up_done & pose.down_done;
+		return false;
+	}
+	for(j = 1; j < 3; j++){
+		if(abs(mean[j]) > abs(mean[vertical])){
+			vertical = j;
+		}
+	}
+	/* Remove the offset register, so captures don't depend on it */
+	if(mean[vertical] > 0){
+		pose.up[vertical] = mean[vertical] - accel[vertical] * CAL_ACCEL_REG;
+		pose.up_done |= 1 << vertical;
+	}else{
+		pose.down[vertical] = mean[vertical] - accel[vertical] * CAL_ACCEL_REG;
+		pose.down_done |= 1 << vertical;
+	}
+	if(pose.up_done & pose.down_done & (1 << vertical)){
+		center = (pose.up[vertical] + pose.down[vertical]) / 2;
+		sensitivity = (pose.up[vertical] - pose.down[vertical]) / 2;
+		calibration.accel_offset[vertical] = (-MPU6050_calDiv(center, CAL_ACCEL_REG) & ~1) | (accel[vertical] & 1);
+		calibration.accel_scale[vertical] = (float)CAL_ACCEL_1G / sensitivity;
+		MPU6050_calApply();
+	}
+	*axes = pose.up_done & pose.down_done;
+	return true;
+}
+
+bool MPU6050_calLoad(void){
+	nvs_handle_t handle;
+	cal_blob_t blob;
+	size_t size = sizeof(blob);
+	esp_err_t ret;
+
+	if(nvs_open(CAL_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK){
+		return false;
+	}
+	ret = nvs_get_blob(handle, CAL_NVS_KEY, &blob, &size);
+	nvs_close(handle);
+	if(ret != ESP_OK || size != sizeof(blob) || blob.version != CAL_VERSION){
+		return false;
+	}
+	calibration = blob.cal;
+	MPU6050_calApply();
+	return true;
+}
+
+bool MPU6050_calSave(void){
+	nvs_handle_t handle;
+	cal_blob_t blob = {.version = CAL_VERSION, .cal = calibration};
+	esp_err_t ret;
+
+	if(nvs_open(CAL_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK){
+		return false;
+	}
+	ret = nvs_set_blob(handle, CAL_NVS_KEY, &blob, sizeof(blob));
+	if(ret == ESP_OK){
+		ret = nvs_commit(handle);
+	}
+	nvs_close(handle);
+	return ret == ESP_OK;
+}
+
+bool MPU6050_calErase(void){
+	nvs_handle_t handle;
+	esp_err_t ret;
+
+	if(nvs_open(CAL_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK){
+		return false;
+	}
+	ret = nvs_erase_key(handle, CAL_NVS_KEY);
+	if(ret == ESP_OK){
+		ret = nvs_commit(handle);
+	}
+	nvs_close(handle);
+	return ret == ESP_OK || ret == ESP_ERR_NVS_NOT_FOUND;
+}
+
+void MPU6050_calGet(mpu6050_cal_t *cal){
+	*cal = calibration;
+}
+/*==================[end of file]============================================*/
@@ -12,18 +12,163 @@
 /*==================[inclusions]=============================================*/
 #include "switch.h"
 #include "gpio_mcu.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_SWITCH1 GPIO_4
 #define GPIO_SWITCH2 GPIO_15
+#define SWITCH_QTY			2
+#define SWITCH_TICK_MS		5		/* Debounce and state machine period */
+#define DEBOUNCE_TICKS		(SWITCH_DEBOUNCE_MS / SWITCH_TICK_MS)
+typedef enum {
+	SW_IDLE,				/* Released */
+	SW_PRESSED,				/* Pressed, waiting for long press */
+	SW_HELD,				/* Long press, repeating */
+	SW_WAIT_DOUBLE,			/* Released after a click, waiting for a second press */
+} sw_state_t;
+typedef struct {
+	gpio_t pin;
+	switch_t sw;
+	sw_state_t state;
+	bool pressed;			/* Debounced level */
+	bool second;			/* Second press of a double click */
+	uint8_t count;			/* Ticks the level differs from the debounced one */
+	uint32_t next;			/* Time of the next long press, repeat or click (ms) */
+	volatile bool edge;		/* Press edge not debounced yet */
+	volatile int64_t edge_time;	/* Time of the press edge (us) */
+} sw_data_t;
 /*==================[internal data declaration]==============================*/
-
+static sw_data_t sw_list[SWITCH_QTY] = {
+	{.pin = GPIO_SWITCH1, .sw = SWITCH_1},
+	{.pin = GPIO_SWITCH2, .sw = SWITCH_2},
+};
+static QueueHandle_t switch_queue = NULL;
+static esp_timer_handle_t switch_timer = NULL;
+static uint32_t switch_dropped = 0;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Switch press edge ISR: timestamps the edge and starts the debounce timer
+ * 
+ * @param args Pointer to switch data
+ */
+static void SwitchEdgeIsr(void *args);
+
+/**
+ * @brief Debounce timer callback: debounces the switches and generates the events
+ * 
+ * @param args Not used
+ */
+static void SwitchTick(void *args);
 
+/**
+ * @brief Posts an event to the queue
+ * 
+ * @param sw Switch
+ * @param type Event
+ * @param time Time (ms)
+ */
+static void SwitchPost(switch_t sw, switch_event_type_t type, uint32_t time);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void IRAM_ATTR SwitchEdgeIsr(void *args){
+	sw_data_t *sw = args;
+
+	/* First edge of a press (release bounces come while still pressed) */
+	if(!sw->pressed && !sw->edge){
+		sw->edge_time = esp_timer_get_time();
+		sw->edge = true;
+	}
+	/* Already running: ESP_ERR_INVALID_STATE, nothing to do */
+	esp_timer_start_periodic(switch_timer, SWITCH_TICK_MS * 1000);
+}
+
+static void SwitchPost(switch_t sw, switch_event_type_t type, uint32_t time){
+	switch_event_t event = {
+		.sw = sw,
+		.type = type,
+		.time = time,
+	};
+	if(xQueueSend(switch_queue, &event, 0) != pdTRUE){
+		switch_dropped++;
+	}
+}
+
+static void SwitchTick(void *args){
+	uint32_t now = esp_timer_get_time() / 1000;
+	bool active = false, level;
+	uint8_t i;
+	sw_data_t *sw;
+
+	for(i = 0; i < SWITCH_QTY; i++){
+		sw = &sw_list[i];
+		level = !GPIORead(sw->pin);
+		if(level != sw->pressed){
+			if(++sw->count >= DEBOUNCE_TICKS){
+				sw->count = 0;
+				sw->pressed = level;
+				if(level){
+					/* Press: timestamped at its first edge */
+					uint32_t time = sw->edge ? (uint32_t)(sw->edge_time / 1000) : now - SWITCH_DEBOUNCE_MS;
+					sw->edge = false;
+					SwitchPost(sw->sw, SWITCH_EV_PRESS, time);
+					sw->second = (sw->state == SW_WAIT_DOUBLE);
+					if(sw->second){
+						SwitchPost(sw->sw, SWITCH_EV_DOUBLE_CLICK, now);
+					}
+					sw->state = SW_PRESSED;
+					sw->next = time + SWITCH_LONG_MS;
+				}else{
+					SwitchPost(sw->sw, SWITCH_EV_RELEASE, now);
+					if(sw->state == SW_PRESSED && !sw->second){
+						sw->state = SW_WAIT_DOUBLE;
+						sw->next = now + SWITCH_DOUBLE_MS;
+					}else{
+						sw->state = SW_IDLE;
+					}
+				}
+			}
+		}else{
+			sw->count = 0;
+			/* Edge without press (glitch) */
+			if(sw->edge && !level && (int32_t)(now - (uint32_t)(sw->edge_time / 1000)) > SWITCH_DEBOUNCE_MS){
+				sw->edge = false;
+			}
+		}
+		switch(sw->state){
+			case SW_PRESSED:
+			case SW_HELD:
+				if((int32_t)(now - sw->next) >= 0){
+					SwitchPost(sw->sw, (sw->state == SW_PRESSED) ? SWITCH_EV_LONG_PRESS : SWITCH_EV_REPEAT, now);
+					sw->state = SW_HELD;
+					sw->next += SWITCH_REPEAT_MS;
+				}
+			break;
+			case SW_WAIT_DOUBLE:
+				if((int32_t)(now - sw->next) >= 0){
+					SwitchPost(sw->sw, SWITCH_EV_CLICK, now);
+					sw->state = SW_IDLE;
+				}
+			break;
+			default:
+			break;
+		}
+		active |= (sw->state != SW_IDLE) || sw->pressed || sw->count > 0 || sw->edge;
+	}
+	if(!active){
+		esp_timer_stop(switch_timer);
+		/* An edge between the checks and the stop: keep running */
+		for(i = 0; i < SWITCH_QTY; i++){
+			if(sw_list[i].edge){
+				esp_timer_start_periodic(switch_timer, SWITCH_TICK_MS * 1000);
+				break;
+			}
+		}
+	}
+}
 
 /*==================[external functions definition]==========================*/
 int8_t SwitchesInit(void){
@@ -54,4 +199,35 @@ void SwitchActivInt(switch_t sw, void *ptr_int_func, void *args){
 		break;
 	}
 }
+
+bool SwitchEventsInit(void){
+	uint8_t i;
+
+	if(switch_queue != NULL){
+		return true;
+	}
+	switch_queue = xQueueCreate(SWITCH_QUEUE_LEN, sizeof(switch_event_t));
+	if(switch_queue == NULL){
+		return false;
+	}
+	const esp_timer_create_args_t timer_args = {
+		.callback = SwitchTick,
+		.name = "switch",
+	};
+	if(esp_timer_create(&timer_args, &switch_timer) != ESP_OK){
+		return false;
+	}
+	for(i = 0; i < SWITCH_QTY; i++){
+		GPIOActivInt(sw_list[i].pin, SwitchEdgeIsr, false, &sw_list[i]);
+	}
+	return true;
+}
+
+bool SwitchEventWait(switch_event_t *event, TickType_t timeout){
+	return xQueueReceive(switch_queue, event, timeout) == pdTRUE;
+}
+
+uint32_t SwitchEventsDropped(void){
+	return switch_dropped;
+}
 /*==================[end of file]============================================*/
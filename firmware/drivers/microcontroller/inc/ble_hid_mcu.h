@@ -20,6 +20,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 19/10/2026 | Reports queued and paced to the connection interval, mouse coalescing	|
  * 
  **/
 
@@ -194,6 +195,9 @@ ble_status_t BleHidStatus(void);
 /**
  * @brief Send a group of keys to be pressed together
  * 
+ * @note Press and release reports are queued and sent in consecutive connection 
+ * intervals, so keystrokes of successive calls are typed in order.
+ * 
  * @param special_key_mask      Modifier keys mask
  * @param keyboard_cmd          Array with keys (max: 6)
  * @param num_key               Number of keys (in keyboard_cmd array) to be pressed together (max: 6)
@@ -203,6 +207,11 @@ void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cm
 /**
  * @brief Send mouse position and click event
  * 
+ * @note One mouse report is sent per connection interval: movements of successive 
+ * calls with the same buttons are added together (they can be called at the sensor 
+ * rate) and movements beyond one report are spread over the following intervals.
+ * Button changes are never merged.
+ * 
  * @param mouse_button      Button to be clicked
  * @param delta_x           X cursor relative position
  * @param delta_y           Y cursor relative position
@@ -13,6 +13,9 @@
  * so it can be used to communicate with common Android apps, like "Bluetooth Electronics"
  * (https://play.google.com/store/apps/details?id=com.keuwl.arduinobluetooth)
  * 
+ * A second service (0xFFF0) carries binary packets in notifications of characteristic 
+ * 0xFFF1 and receives commands in characteristic 0xFFF2. It's used by ble_stream.h.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -20,6 +23,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 19/10/2026 | MTU exchange, data length extension and 2M PHY, no fixed send delay	|
+ * | 19/10/2026 | Transmission ring with congestion flow control and counters			|
+ * | 19/10/2026 | Streaming service (0xFFF0) for binary sample blocks (ble_stream.h)	|
  * 
  **/
 
@@ -53,6 +59,15 @@ typedef enum ble_status {
 	BLE_DISCONNECTED,		/*!< BLE device disconnected */
 	BLE_CONNECTED			/*!< BLE device connected */
 } ble_status_t;
+
+/**
+ * @brief BLE transmission counters
+ */
+typedef struct {
+	uint32_t sent;			/*!< Bytes sent in notifications */
+	uint32_t dropped;		/*!< Bytes dropped because the transmission ring was full */
+	uint32_t congestions;	/*!< Times the stack paused transmission (congestion) */
+} ble_tx_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -72,6 +87,46 @@ void BleInit(ble_config_t * ble_device);
  */
 ble_status_t BleStatus(void);
 
+/**
+ * @brief Gets the bytes sent in one notification
+ * 
+ * @note 20 until the central negotiates a larger MTU (up to 244). Sending buffers of 
+ * this size gives the highest throughput.
+ * 
+ * @return uint16_t Notification payload size
+ */
+uint16_t BleMaxPayload(void);
+
+/**
+ * @brief Send data trough BLE (if connected)
+ * 
+ * @note Data is copied to a transmission ring and sent in the background, in notifications
+ * of BleMaxPayload() bytes, pausing while the BLE stack is congested. It never waits: if 
+ * the ring hasn't room for the whole message, it's dropped and counted (BleTxStats). 
+ * The same applies to BleSendByte, BleSendString and BleSendBuffer.
+ * 
+ * @param data Pointer to data to be transmitted
+ * @param length Number of bytes to be transmitted
+ * @return true if data was queued, false if dropped or not connected
+ */
+bool BleSend(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Gets free space in the transmission ring
+ * 
+ * @note Producers can check it to send only what fits (flow control).
+ * 
+ * @return uint32_t Free bytes
+ */
+uint32_t BleTxFree(void);
+
+/**
+ * @brief Gets transmission counters
+ * 
+ * @param stats Counters of bytes sent and dropped and congestion events
+ */
+void BleTxStats(ble_tx_stats_t *stats);
+
 /**
  * @brief Send a single byte trough BLE (if connected)
  * 
@@ -94,6 +149,27 @@ void BleSendString(const char *msg);
  */
 void BleSendBuffer(const char *data, uint8_t nbytes);
 
+/**
+ * @brief Sets the function called on writes to the stream control characteristic (0xFFF2)
+ * 
+ * @note It is also called with length 0 when the connection is lost.
+ * 
+ * @param func_p Pointer to callback function (called from a task, not from an ISR)
+ */
+void BleStreamControl(read_func func_p);
+
+/**
+ * @brief Send a packet in one notification of the stream characteristic (0xFFF1)
+ * 
+ * @note Packets are queued and sent before the data of BleSend. It never waits: packets 
+ * longer than BleMaxPayload() or that don't fit in the queue are dropped and counted.
+ * 
+ * @param packet Pointer to packet
+ * @param length Packet length in bytes
+ * @return true if the packet was queued, false if dropped or not connected
+ */
+bool BleStreamNotify(const uint8_t *packet, uint16_t length);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
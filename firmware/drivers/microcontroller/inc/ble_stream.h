@@ -0,0 +1,129 @@
+#ifndef BLE_STREAM_H
+#define BLE_STREAM_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup BLE_Stream BLE sample stream
+ ** @{ */
+
+/** \brief Binary streaming of multichannel 12 bits samples (ADC) over BLE.
+ *
+ * Samples are grouped in blocks, one block per notification of the streaming service
+ * characteristic (0xFFF1, see ble_mcu.h). Block format (little endian):
+ *
+ * | Offset | Size           | Description                                              |
+ * |:------:|:--------------:|:---------------------------------------------------------|
+ * | 0      | 2              | Sequence number (lost blocks are detected by the host)   |
+ * | 2      | 4              | Timestamp of the first sample of the block (us)          |
+ * | 6      | 1              | Number of channels                                       |
+ * | 7      | 1              | Samples per channel                                      |
+ * | 8      | (channels+1)/2 | Coding of each channel, one nibble (low nibble first)    |
+ * | ...    | ...            | Bit stream (LSB first), one channel after the other      |
+ *
+ * Each channel starts with its first sample (12 bits). Following samples are sent as
+ * differences to the previous one (zigzag coded) with the number of bits given by the
+ * coding nibble (0 to 11), or as 12 bits samples if the nibble is 15. Slow signals
+ * (biosignals) need a few bits per sample.
+ *
+ * The host controls the stream writing to characteristic 0xFFF2:
+ * BLE_STREAM_CMD_STOP, BLE_STREAM_CMD_START [rate] or BLE_STREAM_CMD_RATE rate,
+ * rate in Hz as uint16_t little endian. BLE_STREAM_CMD_START is ignored (the stream
+ * stays stopped) if one frame, coded as 12 bits samples, doesn't fit in a notification:
+ * with the default MTU (20 bytes payload) up to 6 channels can be streamed. The stream
+ * stops when the connection is lost, the host starts it again after reconnecting.
+ *
+ * tools/ble_stream/ble_stream.py decodes the stream.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define BLE_STREAM_MAX_CHANNELS	8		/*!< Maximum number of channels */
+#define BLE_STREAM_MAX_SAMPLES	160		/*!< Maximum samples in a block (all channels) */
+#define BLE_STREAM_HEADER_SIZE	8		/*!< Block header size (without coding nibbles) */
+#define BLE_STREAM_RAW			0x0F	/*!< Coding nibble: 12 bits samples */
+#define BLE_STREAM_CMD_STOP		0x00	/*!< Control command: stop stream */
+#define BLE_STREAM_CMD_START	0x01	/*!< Control command: start stream, optional rate */
+#define BLE_STREAM_CMD_RATE		0x02	/*!< Control command: set rate */
+/*==================[typedef]================================================*/
+/**
+ * @brief Prototype of callback function for stream control
+ *
+ * @note The application starts or stops its sampling and sets its rate accordingly.
+ *
+ * @param run    true if the host started the stream, false if stopped
+ * @param rate   sample rate requested by the host (Hz)
+ */
+typedef void (*ble_stream_func)(bool run, uint16_t rate);
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Stream initialization
+ *
+ * @note BleInit must be called first. The stream starts stopped, until the host
+ * writes BLE_STREAM_CMD_START.
+ *
+ * @param channels Number of channels (1 to BLE_STREAM_MAX_CHANNELS)
+ * @param rate Default sample rate (Hz)
+ * @param func_p Pointer to callback function for stream control (can be NULL)
+ */
+void BleStreamInit(uint8_t channels, uint16_t rate, ble_stream_func func_p);
+
+/**
+ * @brief Adds a frame (one sample of each channel) to the current block
+ *
+ * @note The block is sent when full. Its size is set when the stream starts, so the
+ * worst case fits in one notification (BleMaxPayload). Must be called from one task.
+ *
+ * @param frame Array of samples, one per channel (12 bits)
+ * @return false if stream stopped or a full block was dropped (BleTxStats)
+ */
+bool BleStreamPush(const uint16_t *frame);
+
+/**
+ * @brief Gets stream status
+ *
+ * @return true if the host started the stream
+ */
+bool BleStreamRunning(void);
+
+/**
+ * @brief Gets sample rate set by the host
+ *
+ * @return uint16_t Sample rate (Hz)
+ */
+uint16_t BleStreamRate(void);
+
+/**
+ * @brief Encodes a block of samples
+ *
+ * @param packet Pointer to output buffer, up to BLE_STREAM_HEADER_SIZE + (channels+1)/2 +
+ * (channels*block*12+7)/8 bytes
+ * @param seq Sequence number
+ * @param timestamp Timestamp of the first sample (us)
+ * @param samples Samples (12 bits), all the samples of the first channel, then of the second ...
+ * @param channels Number of channels
+ * @param block Samples per channel
+ * @return uint16_t Packet length (bytes)
+ */
+uint16_t BleStreamEncode(uint8_t *packet, uint16_t seq, uint32_t timestamp,
+						 const uint16_t *samples, uint8_t channels, uint8_t block);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BLE_STREAM_H */
+
+/*==================[end of file]============================================*/
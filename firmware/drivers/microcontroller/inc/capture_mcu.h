@@ -0,0 +1,206 @@
+#ifndef CAPTURE_MCU_H
+#define CAPTURE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Capture Capture
+ ** @{ */
+
+/** \brief Timestamped edge capture of GPIO inputs, to measure pulses, periods,
+ * frequencies and duty cycles.
+ *
+ * Edges are timestamped by the MCPWM capture hardware when they arrive at the pin, so
+ * interrupt latency doesn't affect the measurement (the resolution is one capture
+ * timer tick). The ISR only stores the timestamp and the edge in a ring buffer
+ * (ring_buffer_mcu.h), read by a task in blocks:
+ *
+ * @code
+ * static void TachoTask(void *pvParameter){
+ *     capture_event_t edges[64];
+ *     uint32_t n;
+ *     CaptureNotify(CAPTURE_A, xTaskGetCurrentTaskHandle(), 64);
+ *     CaptureStart(CAPTURE_A);
+ *     while(1){
+ *         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+ *         n = CaptureRead(CAPTURE_A, edges, 64);
+ *         frequency = CaptureFrequency(edges, n);
+ *         duty = CaptureDuty(edges, n);
+ *     }
+ * }
+ *
+ * capture_config_t tacho = {
+ *     .capture = CAPTURE_A,
+ *     .pin = GPIO_3,
+ *     .edge = CAPTURE_BOTH,
+ *     .size = 256,
+ * };
+ * CaptureInit(&tacho);
+ * @endcode
+ *
+ * @note Timestamps are 32 bits: intervals measured must be shorter than
+ * 2^32 / CaptureResolution() seconds (about 26 s at 160 MHz).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros]=================================================*/
+#define CAPTURE_DEFAULT_SIZE	128		/*!< Edges stored if capture_config_t size is 0 */
+/*==================[typedef]================================================*/
+/**
+ * @brief List of available capture channels in this driver
+ */
+typedef enum captures {
+	CAPTURE_A,					/*!< Capture channel A */
+	CAPTURE_B,					/*!< Capture channel B */
+	CAPTURE_C					/*!< Capture channel C */
+} capture_mcu_t;
+
+/**
+ * @brief Edges captured
+ */
+typedef enum {
+	CAPTURE_RISING = 1,			/*!< Rising edges */
+	CAPTURE_FALLING,			/*!< Falling edges */
+	CAPTURE_BOTH				/*!< Rising and falling edges */
+} capture_edge_t;
+
+/**
+ * @brief Captured edge
+ */
+typedef struct {
+	uint32_t ticks;				/*!< Timestamp (capture timer ticks, see CaptureResolution) */
+	bool rising;				/*!< true: rising edge, false: falling edge */
+} capture_event_t;
+
+/**
+ * @brief Capture configuration struct
+ */
+typedef struct {
+	capture_mcu_t capture;		/*!< Selected capture channel */
+	gpio_t pin;					/*!< Input GPIO */
+	capture_edge_t edge;		/*!< Edges captured */
+	bool pull_up;				/*!< Enable internal pull-up */
+	uint32_t size;				/*!< Edges stored until read (power of 2, 0: CAPTURE_DEFAULT_SIZE) */
+} capture_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Capture channel initialization
+ *
+ * @note Channels are stopped after init
+ *
+ * @param capture_ini Pointer to capture configuration
+ * @return false if the channel couldn't be created
+ */
+bool CaptureInit(capture_config_t *capture_ini);
+
+/**
+ * @brief Starts capturing edges
+ *
+ * @param capture Capture channel
+ */
+void CaptureStart(capture_mcu_t capture);
+
+/**
+ * @brief Stops capturing edges, stored edges can still be read
+ *
+ * @param capture Capture channel
+ */
+void CaptureStop(capture_mcu_t capture);
+
+/**
+ * @brief Sets the task notified (vTaskNotifyGive) when edges are stored
+ *
+ * @param capture Capture channel
+ * @param task Task to notify (NULL: no notification)
+ * @param threshold Edges stored to notify the task
+ */
+void CaptureNotify(capture_mcu_t capture, TaskHandle_t task, uint32_t threshold);
+
+/**
+ * @brief Takes the oldest edges stored
+ *
+ * @param capture Capture channel
+ * @param events Pointer to destination of max edges
+ * @param max Maximum number of edges
+ * @return uint32_t Number of edges taken
+ */
+uint32_t CaptureRead(capture_mcu_t capture, capture_event_t *events, uint32_t max);
+
+/**
+ * @brief Gets the number of edges lost because they weren't read in time
+ *
+ * @param capture Capture channel
+ * @return uint32_t Edges lost since init
+ */
+uint32_t CaptureDropped(capture_mcu_t capture);
+
+/**
+ * @brief Gets the capture timer resolution
+ *
+ * @return uint32_t Ticks per second
+ */
+uint32_t CaptureResolution(void);
+
+/**
+ * @brief Converts an interval between two timestamps to microseconds
+ *
+ * @param ticks Interval (capture timer ticks)
+ * @return float Interval (us)
+ */
+float CaptureTicksToUs(uint32_t ticks);
+
+/**
+ * @brief Average period over a block of edges
+ *
+ * @note Measured between rising edges (or falling edges if there are no rising ones),
+ * first to last, so the timing error is that of two edges however long the block is.
+ *
+ * @param events Edges (CaptureRead)
+ * @param n Number of edges
+ * @return float Period (us), 0 if there are less than two edges of the same direction
+ */
+float CapturePeriod(const capture_event_t *events, uint32_t n);
+
+/**
+ * @brief Average frequency over a block of edges
+ *
+ * @param events Edges (CaptureRead)
+ * @param n Number of edges
+ * @return float Frequency (Hz), 0 if it can't be measured (see CapturePeriod)
+ */
+float CaptureFrequency(const capture_event_t *events, uint32_t n);
+
+/**
+ * @brief Average duty cycle over a block of edges
+ *
+ * @note Requires CAPTURE_BOTH. High time over total time of the complete cycles in
+ * the block (first to last rising edge).
+ *
+ * @param events Edges (CaptureRead)
+ * @param n Number of edges
+ * @return float Duty cycle (0 to 100 %), 0 if there isn't a complete cycle
+ */
+float CaptureDuty(const capture_event_t *events, uint32_t n);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CAPTURE_MCU_H */
+
+/*==================[end of file]============================================*/
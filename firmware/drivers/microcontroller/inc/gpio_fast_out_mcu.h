@@ -8,6 +8,10 @@
  ** @{ */
 
 /** \brief GPIO driver to use gpio ouputs with faster functions than gpio_mcu.
+ * 
+ * Pins are driven by the CPU dedicated GPIO channels (8 on ESP32-C6), so a write to
+ * all the pins of a bundle takes a single instruction. GPIOFastInit and GPIOFastWrite
+ * use a default bundle, GPIOFastBundleInit creates additional bundles.
  * 
  * @author Albano Peñalva
  *
@@ -16,6 +20,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 19/10/2026 | Additional bundles (GPIOFastBundleInit)								|
  * 
  **/
 
@@ -23,9 +28,17 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "gpio_mcu.h"
+#include "driver/dedic_gpio.h"
 /*==================[macros]=================================================*/
-
+#define GPIO_FAST_MAX_PINS	8	/**< Maximum number of pins of a bundle */
 /*==================[typedef]================================================*/
+/**
+ * @brief Bundle of pins driven by dedicated GPIO channels
+ */
+typedef struct {
+	dedic_gpio_bundle_handle_t handle;	/**< Dedicated GPIO bundle */
+	int gpios[GPIO_FAST_MAX_PINS];		/**< GPIO numbers, bit n of written values to gpios[n] */
+} gpio_fast_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -46,6 +59,32 @@ void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
  */
 void GPIOFastWrite(uint16_t value);
 
+/**
+ * @brief Creates a bundle of output pins
+ * 
+ * @param bundle Pointer to bundle
+ * @param pin_list Array of GPIO numbers (bit n of written values to pin_list[n])
+ * @param pin_qty Number of pins (max: GPIO_FAST_MAX_PINS)
+ * @return false if there are not enough free dedicated GPIO channels
+ */
+bool GPIOFastBundleInit(gpio_fast_t *bundle, const gpio_t *pin_list, uint8_t pin_qty);
+
+/**
+ * @brief Writes the pins of a bundle in mask, with one instruction
+ * 
+ * @param bundle Pointer to bundle
+ * @param mask Bits of the pins to be written
+ * @param value Value (bit n to pin n)
+ */
+void GPIOFastBundleWrite(gpio_fast_t *bundle, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Releases the dedicated GPIO channels of a bundle
+ * 
+ * @param bundle Pointer to bundle
+ */
+void GPIOFastBundleDeinit(gpio_fast_t *bundle);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
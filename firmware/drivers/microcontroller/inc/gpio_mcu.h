@@ -26,13 +26,19 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Multi-pin writes: GPIO ports and register masks						|
+ * | 19/10/2026 | GPIO input interruption removal										|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
 /*==================[macros]=================================================*/
+#define GPIO_MASK(pin)		(1UL << (pin))	/**< Register mask of a GPIO (GPIOSetMask, GPIOClearMask, GPIOWriteMask) */
+#define GPIO_PORT_MAX_PINS	16				/**< Maximum number of pins of a GPIO port */
 
 /*==================[typedef]================================================*/
 /**
@@ -75,6 +81,15 @@ typedef enum gpio_list{
 	GPIO_23, 	/**< GPIO23 */
 } gpio_t;
 
+/**
+ * @brief GPIO port: a set of output pins written together (see GPIOPortInit)
+ */
+typedef struct {
+	uint32_t mask;								/**< Register mask of all the pins */
+	uint8_t nibbles;							/**< Number of 4 bits groups of the port value */
+	uint32_t table[GPIO_PORT_MAX_PINS / 4][16];	/**< Register mask of the pins set by each value of each group */
+} gpio_port_t;
+
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -134,6 +149,13 @@ bool GPIORead(gpio_t pin);
  */
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
 
+/**
+ * @brief Disable GPIO input interruption and remove its callback
+ * 
+ * @param pin GPIO number
+ */
+void GPIODeactivInt(gpio_t pin);
+
 /**
  * @brief Configure an input glitch filter to a GPIO
  * 
@@ -150,6 +172,69 @@ void GPIOInputFilter(gpio_t pin);
  */
 void GPIODeinit(void);
 
+/**
+ * @brief GPIO port initialization, pins are configured as outputs
+ * 
+ * @note Bit n of the value written by GPIOPortWrite goes to pins[n]. Pins can be any 
+ * GPIO, in any order.
+ * 
+ * @param port Pointer to port
+ * @param pins Array of GPIO numbers
+ * @param pin_qty Number of pins (max: GPIO_PORT_MAX_PINS)
+ */
+void GPIOPortInit(gpio_port_t *port, const gpio_t *pins, uint8_t pin_qty);
+
+/**
+ * @brief Writes a value to all the pins of a port
+ * 
+ * @note Value bits are translated to the register with one table look up per 4 bits
+ * and written with GPIOWriteMask. It can be called from ISRs.
+ * 
+ * @warning Pins don't change at once, see GPIOWriteMask.
+ * 
+ * @param port Pointer to port
+ * @param value Value (bit n to pin n)
+ */
+void GPIOPortWrite(const gpio_port_t *port, uint16_t value);
+
+/**
+ * @brief Sets to high all the GPIOs in mask, with one register write
+ * 
+ * @param mask Register mask (GPIO_MASK(GPIO_x) | GPIO_MASK(GPIO_y) ...)
+ */
+static inline void GPIOSetMask(uint32_t mask){
+	REG_WRITE(GPIO_OUT_W1TS_REG, mask);
+}
+
+/**
+ * @brief Sets to low all the GPIOs in mask, with one register write
+ * 
+ * @param mask Register mask (GPIO_MASK(GPIO_x) | GPIO_MASK(GPIO_y) ...)
+ */
+static inline void GPIOClearMask(uint32_t mask){
+	REG_WRITE(GPIO_OUT_W1TC_REG, mask);
+}
+
+/**
+ * @brief Writes the GPIOs in mask: high where value is 1, low where it's 0
+ * 
+ * @note Two register writes (clear, then set), without read-modify-write: GPIOs out of 
+ * mask, changed by other tasks or ISRs, are never affected. With constant arguments it 
+ * compiles to two stores.
+ * 
+ * @warning Between both writes the GPIOs being set are still low: for a few cycles the 
+ * outputs show an intermediate value (a BCD 0111 to 1000 goes through 0000). Where the 
+ * pins must change at once (latched or edge sensitive inputs) use a dedicated GPIO 
+ * bundle (GPIOFastBundleWrite, gpio_fast_out_mcu.h).
+ * 
+ * @param mask Register mask of the GPIOs to be written
+ * @param value Register value (GPIO_MASK of the GPIOs to be set)
+ */
+static inline void GPIOWriteMask(uint32_t mask, uint32_t value){
+	GPIOClearMask(mask & ~value);
+	GPIOSetMask(mask & value);
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -13,6 +13,13 @@
  * @note SDA: GPIO_6, SCL: GPIO_7.
  * 
  * @note ESP-EDU have 4 I2C connector in the board (J4, J5, J6 and J8), but all of them are routed to the same I2C port.
+ * 
+ * @note Built on the ESP-IDF i2c_master bus/device driver. Each slave address gets its own device handle 
+ * the first time it is used, and register reads are a single write-read transaction with a repeated start.
+ * 
+ * @note Configuration registers of a device can be kept in a write-through shadow (I2C_shadowEnable), so 
+ * bit writes don't read the register over the bus, and consecutive register writes can be coalesced into 
+ * burst writes (I2C_batchBegin / I2C_batchEnd).
  *
  * @author Juan Ignacio Cerrudo
  * 
@@ -21,6 +28,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 19/10/2026 | i2c_master driver, combined write-read and async reads |
+ * | 19/10/2026 | Register shadow and batched writes             |
  *
  */
 
@@ -28,7 +37,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_log.h"
-#include "driver/i2c.h"
+#include "driver/i2c_master.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 
@@ -40,6 +49,16 @@
 #define I2C_MASTER_TX_BUF_DISABLE   0           /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_RX_BUF_DISABLE   0           /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_TIMEOUT_MS       1000
+#define I2C_MAX_DEVICES             4           /*!< Maximum number of slave addresses in use */
+#define I2C_ASYNC_QUEUE_SIZE        4           /*!< Maximum number of pending asynchronous reads */
+#define I2C_BATCH_SIZE              32          /*!< Maximum length of a coalesced burst write */
+
+/**
+ * @brief Function called when an asynchronous transfer ends
+ * @param param Parameter given when the transfer was launched
+ * @param status Status of the transfer (true = success)
+ */
+typedef void (*i2c_callback_t)(void *param, bool status);
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -158,6 +177,69 @@ bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
 
+/** @fn I2C_writeRead(uint8_t devAddr, const uint8_t *txData, uint8_t txLength, uint8_t *rxData, uint8_t rxLength, uint16_t timeout)
+ * @brief Write bytes to device and read its answer in a single transaction (repeated start, no stop in between).
+ * @param devAddr I2C slave device address
+ * @param txData Bytes to write (usually a register address)
+ * @param txLength Number of bytes to write
+ * @param rxData Buffer to store read data in
+ * @param rxLength Number of bytes to read
+ * @param timeout Optional timeout in milliseconds (0 to use I2C_MASTER_TIMEOUT_MS)
+ * @return Status of operation (true = success)
+ */
+bool I2C_writeRead(uint8_t devAddr, const uint8_t *txData, uint8_t txLength, uint8_t *rxData, uint8_t rxLength, uint16_t timeout);
+
+/** @fn I2C_readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, i2c_callback_t callback, void *param)
+ * @brief Read multiple bytes from an 8-bit device register without blocking. 
+ * 
+ * Reads are queued and performed in order by a driver task, callback is called from that task when each one ends.
+ * Pending batched writes of the device are sent before the read is queued.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in (must be valid until callback is called)
+ * @param callback Function called when read ends (can be NULL)
+ * @param param Parameter for callback function
+ * @return Status of operation (true = read queued, false = queue full, I2C not initialized or pending writes failed)
+ */
+bool I2C_readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, i2c_callback_t callback, void *param);
+
+/** @fn I2C_shadowEnable(uint8_t devAddr, uint8_t firstReg, uint8_t lastReg)
+ * @brief Keep a range of registers in the device shadow, loading them with one burst read.
+ * 
+ * Reads of registers in the shadow don't use the bus, writes update the shadow and the device.
+ * Only use it for registers that change just when they are written (configuration registers): 
+ * never for status, data or FIFO registers, or bits the device clears by itself.
+ * @param devAddr I2C slave device address
+ * @param firstReg First register of the range
+ * @param lastReg Last register of the range
+ * @return Status of operation (true = success)
+ */
+bool I2C_shadowEnable(uint8_t devAddr, uint8_t firstReg, uint8_t lastReg);
+
+/** @fn I2C_shadowInvalidate(uint8_t devAddr)
+ * @brief Discard shadow values of a device (e.g. after a device reset). They are read again from the 
+ * device the next time they are used.
+ * @param devAddr I2C slave device address
+ */
+void I2C_shadowInvalidate(uint8_t devAddr);
+
+/** @fn I2C_batchBegin(uint8_t devAddr)
+ * @brief Start coalescing writes to a device. 
+ * 
+ * Writes to consecutive registers are sent as one burst write (device must auto-increment the 
+ * register address). Pending writes are sent before any read that is not served from the shadow.
+ * @param devAddr I2C slave device address
+ */
+void I2C_batchBegin(uint8_t devAddr);
+
+/** @fn I2C_batchEnd(uint8_t devAddr)
+ * @brief Send pending writes and stop coalescing writes to a device.
+ * @param devAddr I2C slave device address
+ * @return Status of pending writes (true = success)
+ */
+bool I2C_batchEnd(uint8_t devAddr);
+
 /** @fn I2C_SelectRegister(uint8_t dev, uint8_t reg)
  * @brief Select a register
  * @param devAddr I2C slave device address
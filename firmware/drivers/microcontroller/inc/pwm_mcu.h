@@ -14,6 +14,9 @@
  * @note It can setup up to 4 PWM outputs, with independet duty 
  * cycle and frequency configuration
  *
+ * @note PWMFade ramps the duty cycle in hardware (LEDC fade): once started it
+ * doesn't need the CPU.
+ *
  * @author Albano Peñalva
  * 
  * @section changelog
@@ -21,6 +24,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 23/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Hardware duty cycle fades (PWMFade)            |
  *
  */
 
@@ -74,6 +78,18 @@ void PWMOff(pwm_out_t out);
  */
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle);
 
+/**
+ * @brief Ramps the duty cycle of an PWM output, from the current one
+ * 
+ * @note The fade is done by the LEDC hardware and the function returns at once.
+ * PWMSetDutyCycle or a new PWMFade stop the ongoing fade.
+ * 
+ * @param out PWM output 
+ * @param duty_cycle Final duty cycle in % (0 to 100)
+ * @param time_ms Fade time (ms)
+ */
+void PWMFade(pwm_out_t out, uint8_t duty_cycle, uint32_t time_ms);
+
 /**
  * @brief Change frequency of an PWM output
  * 
@@ -0,0 +1,133 @@
+#ifndef RING_BUFFER_MCU_H
+#define RING_BUFFER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup RING_BUFFER Ring buffer
+ ** @{ */
+
+/** \brief Lock-free ring buffer to pass data from one producer (usually an ISR) to
+ * one consumer task, without a FreeRTOS queue per item.
+ *
+ * The ISR captures its sample and pushes it (RingPush is in IRAM and doesn't block).
+ * The task is notified once every "threshold" items and pops all of them together:
+ *
+ * @code
+ * static uint16_t samples[256];
+ * static ring_mcu_t ring;
+ *
+ * void FuncTimerA(void *param){
+ *     uint16_t value;
+ *     AnalogInputReadSingle(CH1, &value);
+ *     RingPush(&ring, &value);
+ * }
+ *
+ * static void ProcessTask(void *pvParameter){
+ *     uint16_t block[32];
+ *     uint32_t n;
+ *     RingNotify(&ring, xTaskGetCurrentTaskHandle(), 32);
+ *     while(1){
+ *         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+ *         while((n = RingPop(&ring, block, 32)) > 0){
+ *             ...
+ *         }
+ *     }
+ * }
+ *
+ * RingInit(&ring, samples, sizeof(uint16_t), 256);
+ * @endcode
+ *
+ * @note Only one producer and one consumer per ring. Items are dropped (and counted)
+ * when the ring is full, the producer never waits.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Ring buffer
+ */
+typedef struct {
+	uint8_t *buffer;			/*!< Storage, size * item_size bytes */
+	uint32_t size;				/*!< Capacity in items (power of 2) */
+	uint16_t item_size;			/*!< Item size in bytes */
+	volatile uint32_t head;		/*!< Items pushed (free running, written by the producer only) */
+	volatile uint32_t tail;		/*!< Items popped (free running, written by the consumer only) */
+	volatile uint32_t dropped;	/*!< Items dropped because the ring was full */
+	uint32_t threshold;			/*!< Items stored to notify the consumer task */
+	TaskHandle_t task;			/*!< Consumer task, NULL: no notification */
+	volatile bool pending;		/*!< Consumer notified and not popped yet */
+} ring_mcu_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Ring buffer initialization
+ *
+ * @param ring Pointer to ring buffer
+ * @param buffer Storage for size items (static or internal RAM if pushed from IRAM ISRs)
+ * @param item_size Item size in bytes
+ * @param size Capacity in items (power of 2)
+ * @return false if size is not a power of 2
+ */
+bool RingInit(ring_mcu_t *ring, void *buffer, uint16_t item_size, uint32_t size);
+
+/**
+ * @brief Sets the task notified (vTaskNotifyGive) when items are available
+ *
+ * @note The task is notified when threshold items are stored, once until it pops.
+ *
+ * @param ring Pointer to ring buffer
+ * @param task Consumer task (NULL: no notification)
+ * @param threshold Items stored to notify the task (1 to size)
+ */
+void RingNotify(ring_mcu_t *ring, TaskHandle_t task, uint32_t threshold);
+
+/**
+ * @brief Adds one item (producer side, from an ISR or a task)
+ *
+ * @param ring Pointer to ring buffer
+ * @param item Pointer to item (item_size bytes)
+ * @return false if the ring was full (item dropped)
+ */
+bool RingPush(ring_mcu_t *ring, const void *item);
+
+/**
+ * @brief Takes up to max items (consumer side)
+ *
+ * @param ring Pointer to ring buffer
+ * @param items Pointer to destination of max items (NULL: items are discarded)
+ * @param max Maximum number of items
+ * @return uint32_t Number of items taken
+ */
+uint32_t RingPop(ring_mcu_t *ring, void *items, uint32_t max);
+
+/**
+ * @brief Gets the number of items stored
+ *
+ * @param ring Pointer to ring buffer
+ * @return uint32_t Number of items
+ */
+uint32_t RingCount(ring_mcu_t *ring);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RING_BUFFER_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -21,14 +21,22 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 19/10/2026 | Queued writes (SpiWriteQueued, SpiQueueWait)							|
+ * | 19/10/2026 | Bus reservation (SpiAcquire, SpiRelease)								|
+ * | 19/10/2026 | Queued reads and writes with end callback (SpiQueue)					|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_SIZE	8		/*!< Maximum number of queued transactions per device */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Function called when a queued transaction ends
+ */
+typedef void (*spi_callback_t)(void *param);
 
 /**
  * @brief ESP-EDU only have 1 SPI port, than can be connected up to 3 diferent devices using 
@@ -108,6 +116,68 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue a transfer on SPI port and return without waiting for it to end
+ * 
+ * Transactions come from a preallocated pool of SPI_QUEUE_SIZE per device, so nothing 
+ * is built on the stack and nothing is allocated. Transfers queued to several devices 
+ * run back to back on the bus while the caller goes on. Slots of ended transactions are 
+ * recycled on the next call; if SPI_QUEUE_SIZE transactions are already in flight, 
+ * waits for the oldest one.
+ * 
+ * @note Buffers must be DMA capable (internal RAM, 32 bits aligned) and must not be 
+ * used until the transaction ends (func_p called, or SpiQueueWait returned).
+ * 
+ * @param device SPI device
+ * @param tx_buffer pointer to data to write (NULL to only read)
+ * @param rx_buffer pointer to buffer where data read is stored (NULL to only write)
+ * @param buffer_size numbers of bytes to transfer
+ * @param func_p function called when the transaction ends, from the SPI interrupt: must 
+ * be in IRAM and short (NULL for none)
+ * @param param_p parameter for func_p
+ */
+void SpiQueue(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size, 
+        spi_callback_t func_p, void *param_p);
+/**
+ * @brief Queue a write on SPI port and return without waiting for it to end
+ * 
+ * @note tx_buffer must be DMA capable (internal RAM, 32 bits aligned) and must not be 
+ * modified until the transaction is reaped with SpiQueueWait. If SPI_QUEUE_SIZE 
+ * transactions are already in flight, waits for the oldest one.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored
+ * @param tx_buffer_size numbers of bytes to write
+ */
+void SpiWriteQueued(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
+
+/**
+ * @brief Wait for queued transfers to end
+ * 
+ * @note Blocking transfers (SpiRead, SpiWrite, SpiReadWrite) wait for the queued ones 
+ * of the same device before starting.
+ * 
+ * @param device SPI device
+ * @param pending number of queued transfers that may still be in flight on return
+ */
+void SpiQueueWait(spi_dev_t device, uint8_t pending);
+
+/**
+ * @brief Reserve the SPI bus for a device, speeding up a sequence of transfers
+ * 
+ * @note Transfers to other devices wait until SpiRelease is called.
+ * 
+ * @param device SPI device
+ */
+void SpiAcquire(spi_dev_t device);
+
+/**
+ * @brief Release the SPI bus reserved with SpiAcquire
+ * 
+ * @param device SPI device
+ */
+void SpiRelease(spi_dev_t device);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
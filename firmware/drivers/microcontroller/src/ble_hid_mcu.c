@@ -27,8 +27,16 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "ble_hid"
+#define HID_KEY_QUEUE_LEN					32	/* Keyboard reports waiting to be sent (press and release) */
+#define HID_MOUSE_QUEUE_LEN					8	/* Mouse reports with different buttons waiting to be sent */
+#define HID_CONN_INTERVAL_MIN				6	/* Connection interval requested (x 1.25 ms) */
+#define HID_CONN_INTERVAL_MAX				12	/* Connection interval requested (x 1.25 ms) */
+#define HID_CONN_TIMEOUT					400	/* Supervision timeout (x 10 ms) */
+#define HID_CONN_INTERVAL_UNIT_US			1250
 /********************esp_hidd_prf_api**********************/
 // HID keyboard input report length
 #define HID_KEYBOARD_IN_RPT_LEN     		8
@@ -397,6 +405,12 @@ typedef struct {
 } hidd_le_env_t;
 
 /***************************hidd****************************/
+/* Mouse report being coalesced: deltas are added while buttons don't change */
+typedef struct {
+    uint8_t buttons;
+    int32_t delta_x;
+    int32_t delta_y;
+} hid_mouse_acc_t;
 
 /*==================[internal data declaration]==============================*/
 /********************esp_hidd_prf_api**********************/
@@ -499,6 +513,26 @@ static void hid_add_id_tbl(void);
  * @brief           
  */
 static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *param);
+/**
+ * @brief           Wakes the report task once per connection interval
+ */
+static void hid_sched_timer_cb(void *arg);
+/**
+ * @brief           Sends queued reports, one keyboard and one mouse report per connection interval
+ */
+static void hid_report_task(void *arg);
+/**
+ * @brief           Starts pacing reports, if idle (called with hid_mutex taken)
+ */
+static void hid_sched_kick(void);
+/**
+ * @brief           Sets reports period to the connection interval (x 1.25 ms)
+ */
+static void hid_sched_period(uint16_t interval);
+/**
+ * @brief           Discards queued reports and stops pacing
+ */
+static void hid_sched_clear(void);
 
 /*==================[internal data definition]===============================*/
 /********************esp_hidd_prf_api**********************/
@@ -951,6 +985,17 @@ static esp_ble_adv_params_t hidd_adv_params = {
 };
 static uint16_t hid_conn_id = 0;
 static bool sec_conn = false;
+/* Report scheduler */
+static SemaphoreHandle_t hid_mutex = NULL;			/* Serializes producers and report task */
+static TaskHandle_t hid_task = NULL;
+static esp_timer_handle_t hid_timer = NULL;			/* Paces reports to the connection interval */
+static uint32_t hid_period_us = HID_CONN_INTERVAL_MAX * HID_CONN_INTERVAL_UNIT_US;
+static volatile bool hid_congested = false;			/* Stack asked to stop sending */
+static uint8_t key_queue[HID_KEY_QUEUE_LEN][HID_KEYBOARD_IN_RPT_LEN];
+static uint8_t key_head = 0, key_count = 0;
+static hid_mouse_acc_t mouse_queue[HID_MOUSE_QUEUE_LEN];
+static uint8_t mouse_head = 0, mouse_count = 0;
+static uint8_t mouse_buttons = HID_NO_BUTTON;		/* Buttons of the last queued mouse report */
 ble_status_t status = BLE_OFF;
 
 /*==================[external data definition]===============================*/
@@ -1089,6 +1134,7 @@ void esp_hidd_prf_cb_hdl(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
             cb_param.connect.conn_id = param->connect.conn_id;
             hidd_clcb_alloc(param->connect.conn_id, param->connect.remote_bda);
             esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_NO_MITM);
+            hid_sched_period(param->connect.conn_params.interval);
             if(hidd_le_env.hidd_cb != NULL) {
                 (hidd_le_env.hidd_cb)(ESP_HIDD_EVENT_BLE_CONNECT, &cb_param);
             }
@@ -1103,6 +1149,9 @@ void esp_hidd_prf_cb_hdl(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
         }
         case ESP_GATTS_CLOSE_EVT:
             break;
+        case ESP_GATTS_CONGEST_EVT:
+            hid_congested = param->congest.congested;
+            break;
         case ESP_GATTS_WRITE_EVT: {
             esp_hidd_cb_param_t cb_param = {0};
             if (param->write.handle == hidd_le_env.hidd_inst.att_tbl[HIDD_LE_IDX_REPORT_LED_OUT_VAL]) {
@@ -1305,6 +1354,15 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
 		case ESP_HIDD_EVENT_BLE_CONNECT: {
             ESP_LOGI(TAG, "ESP_HIDD_EVENT_BLE_CONNECT");
             hid_conn_id = param->connect.conn_id;
+            /* Short connection interval: reports are paced to it */
+            esp_ble_conn_update_params_t conn_params = {
+                .min_int = HID_CONN_INTERVAL_MIN,
+                .max_int = HID_CONN_INTERVAL_MAX,
+                .latency = 0,
+                .timeout = HID_CONN_TIMEOUT,
+            };
+            memcpy(conn_params.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+            esp_ble_gap_update_conn_params(&conn_params);
             break;
         }
         case ESP_HIDD_EVENT_BLE_DISCONNECT: {
@@ -1312,6 +1370,7 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
             sec_conn = false;
             ESP_LOGI(TAG, "ESP_HIDD_EVENT_BLE_DISCONNECT");
             status = BLE_DISCONNECTED;
+            hid_sched_clear();
             esp_ble_gap_start_advertising(&hidd_adv_params);
             break;
         }
@@ -1331,6 +1390,92 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
     return;
 }
 
+static void hid_sched_timer_cb(void *arg){
+    xTaskNotifyGive(hid_task);
+}
+
+static void hid_sched_kick(void){
+    if(!esp_timer_is_active(hid_timer)){
+        /* First report goes now, the following ones once per connection interval */
+        xTaskNotifyGive(hid_task);
+        esp_timer_start_periodic(hid_timer, hid_period_us);
+    }
+}
+
+static void hid_sched_period(uint16_t interval){
+    if(interval == 0){
+        return;
+    }
+    xSemaphoreTake(hid_mutex, portMAX_DELAY);
+    hid_period_us = interval * HID_CONN_INTERVAL_UNIT_US;
+    if(esp_timer_is_active(hid_timer)){
+        esp_timer_restart(hid_timer, hid_period_us);
+    }
+    xSemaphoreGive(hid_mutex);
+}
+
+static void hid_sched_clear(void){
+    xSemaphoreTake(hid_mutex, portMAX_DELAY);
+    key_count = 0;
+    mouse_count = 0;
+    mouse_buttons = HID_NO_BUTTON;
+    hid_congested = false;
+    esp_timer_stop(hid_timer);
+    xSemaphoreGive(hid_mutex);
+}
+
+static void hid_report_task(void *arg){
+    uint8_t key[HID_KEYBOARD_IN_RPT_LEN];
+    uint8_t mouse[HID_MOUSE_IN_RPT_LEN] = {0};
+    hid_mouse_acc_t *acc;
+    int32_t delta_x, delta_y;
+    bool send_key, send_mouse;
+
+    while(1){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if(status != BLE_CONNECTED || hid_congested){
+            continue;
+        }
+        send_key = false;
+        send_mouse = false;
+        xSemaphoreTake(hid_mutex, portMAX_DELAY);
+        if(key_count > 0){
+            memcpy(key, key_queue[key_head], HID_KEYBOARD_IN_RPT_LEN);
+            key_head = (key_head + 1) % HID_KEY_QUEUE_LEN;
+            key_count--;
+            send_key = true;
+        }
+        if(mouse_count > 0){
+            /* Movements beyond one report are spread over the next intervals */
+            acc = &mouse_queue[mouse_head];
+            delta_x = acc->delta_x > 127 ? 127 : (acc->delta_x < -127 ? -127 : acc->delta_x);
+            delta_y = acc->delta_y > 127 ? 127 : (acc->delta_y < -127 ? -127 : acc->delta_y);
+            acc->delta_x -= delta_x;
+            acc->delta_y -= delta_y;
+            mouse[0] = acc->buttons;
+            mouse[1] = (int8_t)delta_x;
+            mouse[2] = (int8_t)delta_y;
+            if(acc->delta_x == 0 && acc->delta_y == 0){
+                mouse_head = (mouse_head + 1) % HID_MOUSE_QUEUE_LEN;
+                mouse_count--;
+            }
+            send_mouse = true;
+        }
+        if(key_count == 0 && mouse_count == 0){
+            esp_timer_stop(hid_timer);
+        }
+        xSemaphoreGive(hid_mutex);
+        if(send_key){
+            hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
+                                HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT, HID_KEYBOARD_IN_RPT_LEN, key);
+        }
+        if(send_mouse){
+            hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
+                                HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT, HID_MOUSE_IN_RPT_LEN, mouse);
+        }
+    }
+}
+
 static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param){
     switch (event) {
     case ESP_GAP_BLE_ADV_DATA_SET_COMPLETE_EVT:
@@ -1357,6 +1502,10 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
             ESP_LOGE(TAG, "fail reason = 0x%x",param->ble_security.auth_cmpl.fail_reason);
         }
         break;
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+        ESP_LOGI(TAG, "connection interval = %d", param->update_conn_params.conn_int);
+        hid_sched_period(param->update_conn_params.conn_int);
+        break;
     default:
         break;
     }
@@ -1398,6 +1547,15 @@ void BleHidInit(char * hid_dev_name){
     if((ret = esp_hidd_profile_init()) != ESP_OK) {
         ESP_LOGE(TAG, "%s init bluedroid failed\n", __func__);
     }
+    /* Report scheduler */
+    hid_mutex = xSemaphoreCreateMutex();
+    configASSERT(hid_mutex);
+    const esp_timer_create_args_t timer_args = {
+        .callback = hid_sched_timer_cb,
+        .name = "hid_reports",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &hid_timer));
+    xTaskCreate(hid_report_task, "hid_reports", 1024*4, NULL, 10, &hid_task);
     ///register the callback function to the gap module
     esp_ble_gap_register_callback(gap_event_handler);
     esp_hidd_register_callbacks(hidd_event_callback);
@@ -1419,39 +1577,62 @@ ble_status_t BleHidStatus(void){
 }
 
 void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cmd, uint8_t num_key){
+    uint8_t *press, *release;
+
     if (num_key > HID_KEYBOARD_IN_RPT_LEN - 2) {
         ESP_LOGE(TAG, "%s(), the number key should not be more than %d", __func__, HID_KEYBOARD_IN_RPT_LEN);
         return;
     }
-    uint8_t buffer[HID_KEYBOARD_IN_RPT_LEN] = {0};
     if(status == BLE_CONNECTED){
-        buffer[0] = special_key_mask;
-        for (int i = 0; i < num_key; i++) {
-            buffer[i+2] = keyboard_cmd[i];
-        }
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT, HID_KEYBOARD_IN_RPT_LEN, buffer);
-        for (int i = 0; i < num_key; i++) {
-            buffer[i+2] = 0;
+        xSemaphoreTake(hid_mutex, portMAX_DELAY);
+        if(key_count <= HID_KEY_QUEUE_LEN - 2){
+            /* Press and release reports, sent in consecutive connection intervals.
+             * Release is all zeros: modifiers are released with the keys */
+            press = key_queue[(key_head + key_count) % HID_KEY_QUEUE_LEN];
+            release = key_queue[(key_head + key_count + 1) % HID_KEY_QUEUE_LEN];
+            memset(press, 0, HID_KEYBOARD_IN_RPT_LEN);
+            memset(release, 0, HID_KEYBOARD_IN_RPT_LEN);
+            press[0] = special_key_mask;
+            for (int i = 0; i < num_key; i++) {
+                press[i+2] = keyboard_cmd[i];
+            }
+            key_count += 2;
+            hid_sched_kick();
+        }else{
+            ESP_LOGW(TAG, "%s(), keyboard queue full, keys dropped", __func__);
         }
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT, HID_KEYBOARD_IN_RPT_LEN, buffer);
+        xSemaphoreGive(hid_mutex);
     }
     return;
 }
 
 void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y){
-    uint8_t buffer[HID_MOUSE_IN_RPT_LEN];
-    buffer[0] = mouse_button;       // Buttons
-    buffer[1] = delta_x;            // X
-    buffer[2] = delta_y;            // Y
-    buffer[3] = 0;                  // Wheel
-    buffer[4] = 0;                  // AC Pan
+    hid_mouse_acc_t *acc = NULL;
+
     if(status == BLE_CONNECTED){
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT, HID_MOUSE_IN_RPT_LEN, buffer);
+        xSemaphoreTake(hid_mutex, portMAX_DELAY);
+        if(mouse_count > 0){
+            acc = &mouse_queue[(mouse_head + mouse_count - 1) % HID_MOUSE_QUEUE_LEN];
+        }
+        if(acc != NULL && acc->buttons == mouse_button){
+            /* Coalesced with the report waiting for the next connection interval */
+            acc->delta_x += delta_x;
+            acc->delta_y += delta_y;
+        }else if(mouse_button != mouse_buttons || delta_x != 0 || delta_y != 0){
+            if(mouse_count < HID_MOUSE_QUEUE_LEN){
+                acc = &mouse_queue[(mouse_head + mouse_count) % HID_MOUSE_QUEUE_LEN];
+                acc->buttons = mouse_button;
+                acc->delta_x = delta_x;
+                acc->delta_y = delta_y;
+                mouse_count++;
+                mouse_buttons = mouse_button;
+                hid_sched_kick();
+            }else{
+                ESP_LOGW(TAG, "%s(), mouse queue full, report dropped", __func__);
+            }
+        }
+        xSemaphoreGive(hid_mutex);
     }
     return;
 }
-
 /*==================[end of file]============================================*/
\ No newline at end of file
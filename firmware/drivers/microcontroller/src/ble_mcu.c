@@ -21,21 +21,32 @@
 #include "esp_bt.h"
 #include "esp_gap_ble_api.h"
 #include "esp_gatts_api.h"
+#include "esp_gatt_common_api.h"
 #include "esp_bt_defs.h"
 #include "esp_bt_main.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "ble_mcu"
-#define MTU_MAX_BYTES		20	 /* GATT Maximum Transmission Unit */
-#define PAYLOAD_SIZE        128  /* Maximun number of bytes transmitted in one transaction */
+#define MTU_DEFAULT			23	 /* GATT Maximum Transmission Unit before MTU exchange */
+#define MTU_LOCAL			247	 /* GATT MTU offered: 244 bytes notifications fit in one 251 bytes LL packet */
+#define ATT_HEADER_SIZE		3	 /* Notification header (opcode + handle) */
+#define PAYLOAD_SIZE        (MTU_LOCAL - ATT_HEADER_SIZE)  /* Maximun number of bytes transmitted in one transaction */
+#define LL_TX_OCTETS		251	 /* Data length extension: maximum LL payload */
+#define CONN_INTERVAL_MIN	0x06 /* Connection interval requested for throughput (x 1.25 ms) */
+#define CONN_INTERVAL_MAX	0x0C /* Connection interval requested for throughput (x 1.25 ms) */
+#define CONN_TIMEOUT		400	 /* Supervision timeout (x 10 ms) */
+#define TX_RING_SIZE		4096 /* Transmission ring size in bytes (power of 2) */
 #define SPP_PROFILE_NUM     1       
 #define SPP_PROFILE_APP_IDX 0
 #define ESP_SPP_APP_ID      0x56
 #define SPP_SVC_INST_ID     0
-#define SPP_DATA_MAX_LEN    (128) /* Maximun number of bytes transmitted in one transaction */
+#define SPP_DATA_MAX_LEN    PAYLOAD_SIZE /* Maximun number of bytes transmitted in one transaction */
+#define STREAM_SVC_INST_ID  1
+#define STREAM_QUEUE_LEN	8	 /* Stream packets waiting to be notified */
 /* List of attributes to be added to the service database */
 enum{
     SPP_IDX_SVC,
@@ -46,9 +57,22 @@ enum{
     SPP_IDX_SPP_DATA_RECV_CFG,
     SPP_IDX_NB,
 };
+/* List of attributes of the streaming service */
+enum{
+    STREAM_IDX_SVC,
+    STREAM_IDX_DATA_CHAR,
+    STREAM_IDX_DATA_VAL,
+    STREAM_IDX_DATA_CFG,
+    STREAM_IDX_CTRL_CHAR,
+    STREAM_IDX_CTRL_VAL,
+    STREAM_IDX_NB,
+};
 /* Characteristics UUID */
 #define ESP_GATT_UUID_SPP_SERVICE               0xFFE0  /* Service ID */
 #define ESP_GATT_UUID_SPP_DATA_RECEIVE_NOTIFY   0xFFE1  /* Characteristic ID */
+#define ESP_GATT_UUID_STREAM_SERVICE            0xFFF0  /* Streaming service ID */
+#define ESP_GATT_UUID_STREAM_DATA               0xFFF1  /* Stream packets characteristic ID (notify) */
+#define ESP_GATT_UUID_STREAM_CONTROL            0xFFF2  /* Stream control characteristic ID (write) */
 
 #define ADV_CONFIG_FLAG			                (1 << 0)
 #define SCAN_RSP_CONFIG_FLAG	                (1 << 1)
@@ -59,7 +83,7 @@ typedef enum {
     CMD_BLUETOOTH_AUTH,          /* device authentification */
     CMD_BLUETOOTH_DATA,          /* data reception */
     CMD_BLUETOOTH_DISCONNECT,    /* device disconnection */
-    CMD_SEND_DATA,               /* data transmission */
+    CMD_STREAM_CONTROL,          /* write to the stream control characteristic */
 } comd_bt_ev_t;
 /* Struct used to handle Bluetooth events */
 typedef struct {
@@ -70,11 +94,19 @@ typedef struct {
 	uint8_t payload[PAYLOAD_SIZE];
 	TaskHandle_t taskHandle;
 } CMD_t;
+/* Packet waiting to be notified on the stream characteristic */
+typedef struct {
+	uint16_t length;
+	uint8_t data[PAYLOAD_SIZE];
+} stream_packet_t;
 /*==================[internal data declaration]==============================*/
 char * device_name; /* Device name */
 void (*ble_read_isr_p)(uint8_t * data, uint8_t length);  /* Pointer to callback function for reading data */
 ble_status_t status = BLE_OFF;
+static volatile uint16_t mtu_payload = MTU_DEFAULT - ATT_HEADER_SIZE;	/* Notification size allowed by negotiated MTU */
 static uint16_t spp_handle_table[SPP_IDX_NB];   /* Service database table */
+static uint16_t stream_handle_table[STREAM_IDX_NB];   /* Streaming service database table */
+static read_func ble_stream_ctrl_p = BLE_NO_INT;	/* Pointer to callback function for stream control writes */
 /* GATT profile struct */
 struct gatts_profile_inst {
 	esp_gatts_cb_t gatts_cb;
@@ -91,9 +123,21 @@ struct gatts_profile_inst {
 	esp_bt_uuid_t descr_uuid;
 };
 QueueHandle_t xQueueEvents = NULL;  /* Queue for handling Bluettoth events */
+static TaskHandle_t events_task = NULL;		/* Task that handles events and sends notifications */
+/* Transmission ring: producers append at head, events task sends from tail */
+static uint8_t tx_ring[TX_RING_SIZE];
+static volatile uint32_t tx_head = 0;		/* Free running write index */
+static volatile uint32_t tx_tail = 0;		/* Free running read index */
+static SemaphoreHandle_t tx_mutex = NULL;	/* Serializes producers */
+static volatile bool tx_congested = false;	/* Stack asked to stop sending */
+static ble_tx_stats_t tx_stats;				/* Transmission counters */
 QueueHandle_t xQueueRead = NULL;    /* Queue for handling received data */
+static QueueHandle_t xQueueStream = NULL;	/* Queue of stream packets to be notified */
 
 /*==================[internal functions declaration]=========================*/
+static void BleEventPost(CMD_t *cmd, TickType_t timeout);
+static bool BleTxAppend(const uint8_t *data, size_t length);
+static void BleTxFlush(void);
 static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 										esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
 /*==================[internal data definition]===============================*/
@@ -194,6 +238,46 @@ static const esp_gatts_attr_db_t spp_gatt_db[SPP_IDX_NB] = {
 	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_description_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
 	sizeof(uint16_t),sizeof(spp_data_notify_ccc), (uint8_t *)spp_data_notify_ccc}},
 };
+static const uint16_t stream_service_uuid = ESP_GATT_UUID_STREAM_SERVICE;
+static const uint16_t stream_data_uuid = ESP_GATT_UUID_STREAM_DATA;
+static const uint16_t stream_ctrl_uuid = ESP_GATT_UUID_STREAM_CONTROL;
+static const uint8_t char_prop_notify = ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static const uint8_t char_prop_write = ESP_GATT_CHAR_PROP_BIT_WRITE|ESP_GATT_CHAR_PROP_BIT_WRITE_NR;
+static const uint8_t stream_data_val[1] = {0x00};
+static const uint8_t stream_data_ccc[2] = {0x00, 0x00};
+static const uint8_t stream_ctrl_val[1] = {0x00};
+/* Streaming service database: binary sample blocks (ble_stream.h) */
+static const esp_gatts_attr_db_t stream_gatt_db[STREAM_IDX_NB] = {
+	/* Stream - Service Declaration */
+	[STREAM_IDX_SVC]			=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&primary_service_uuid, ESP_GATT_PERM_READ,
+	sizeof(stream_service_uuid), sizeof(stream_service_uuid), (uint8_t *)&stream_service_uuid}},
+
+	/* Stream - packets characteristic Declaration */
+	[STREAM_IDX_DATA_CHAR]		=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_notify}},
+
+	/* Stream - packets characteristic Value */
+	[STREAM_IDX_DATA_VAL]		=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&stream_data_uuid, ESP_GATT_PERM_READ,
+	PAYLOAD_SIZE, sizeof(stream_data_val), (uint8_t *)stream_data_val}},
+
+	/* Stream - packets characteristic - Client Characteristic Configuration Descriptor */
+	[STREAM_IDX_DATA_CFG]		=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_client_config_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
+	sizeof(uint16_t), sizeof(stream_data_ccc), (uint8_t *)stream_data_ccc}},
+
+	/* Stream - control characteristic Declaration */
+	[STREAM_IDX_CTRL_CHAR]		=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_write}},
+
+	/* Stream - control characteristic Value */
+	[STREAM_IDX_CTRL_VAL]		=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&stream_ctrl_uuid, ESP_GATT_PERM_WRITE,
+	PAYLOAD_SIZE, sizeof(stream_ctrl_val), (uint8_t *)stream_ctrl_val}},
+};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -256,7 +340,7 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 			break;
 		case ESP_GAP_BLE_AUTH_CMPL_EVT: {
 			cmdBuf.command = CMD_BLUETOOTH_AUTH;
-			xQueueSend(xQueueEvents, &cmdBuf, 0);
+			BleEventPost(&cmdBuf, 0);
 			break;
 	}
 	case ESP_GAP_BLE_REMOVE_BOND_DEV_COMPLETE_EVT: {
@@ -302,11 +386,19 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 			esp_ble_gap_config_local_privacy(true);
 			esp_ble_gap_config_adv_data_raw((uint8_t *)spp_adv_data, sizeof(spp_adv_data));
 			esp_ble_gatts_create_attr_tab(spp_gatt_db, gatts_if, SPP_IDX_NB, SPP_SVC_INST_ID);
+			esp_ble_gatts_create_attr_tab(stream_gatt_db, gatts_if, STREAM_IDX_NB, STREAM_SVC_INST_ID);
 			break;
 		case ESP_GATTS_READ_EVT:
 			break;
 		case ESP_GATTS_WRITE_EVT:
-			cmdBuf.command = CMD_BLUETOOTH_DATA;
+			if(param->write.handle == stream_handle_table[STREAM_IDX_DATA_CFG]){
+				break;
+			}
+			if(param->write.handle == stream_handle_table[STREAM_IDX_CTRL_VAL]){
+				cmdBuf.command = CMD_STREAM_CONTROL;
+			}else{
+				cmdBuf.command = CMD_BLUETOOTH_DATA;
+			}
 			memcpy(cmdBuf.payload, param->write.value, param->write.len);
 			cmdBuf.length = param->write.len;
 			xQueueSend(xQueueRead, &cmdBuf, 0);
@@ -314,6 +406,11 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_EXEC_WRITE_EVT:
 			break;
 		case ESP_GATTS_MTU_EVT:
+			ESP_LOGI(TAG, "MTU %d", param->mtu.mtu);
+			mtu_payload = param->mtu.mtu - ATT_HEADER_SIZE;
+			if(mtu_payload > PAYLOAD_SIZE){
+				mtu_payload = PAYLOAD_SIZE;
+			}
 			break;
 		case ESP_GATTS_CONF_EVT:
 			break;
@@ -328,15 +425,30 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_CONNECT_EVT:
 			/* start security connect with peer device when receive the connect event sent by the master */
 			esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_MITM);
+			/* Throughput: long LL packets, short connection interval and 2M PHY (if peer supports them) */
+			mtu_payload = MTU_DEFAULT - ATT_HEADER_SIZE;
+			esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, LL_TX_OCTETS);
+			esp_ble_conn_update_params_t conn_params = {
+				.min_int = CONN_INTERVAL_MIN,
+				.max_int = CONN_INTERVAL_MAX,
+				.latency = 0,
+				.timeout = CONN_TIMEOUT,
+			};
+			memcpy(conn_params.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+			esp_ble_gap_update_conn_params(&conn_params);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+			esp_ble_gap_set_preferred_phy(param->connect.remote_bda, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK, 
+				ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
 			cmdBuf.command = CMD_BLUETOOTH_CONNECT;
 			cmdBuf.spp_conn_id = p_data->connect.conn_id;
 			cmdBuf.spp_gatts_if = gatts_if;
-			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+			BleEventPost(&cmdBuf, portMAX_DELAY);
 			break;
 		case ESP_GATTS_DISCONNECT_EVT:
 			cmdBuf.command = CMD_BLUETOOTH_DISCONNECT;
 			status = BLE_DISCONNECTED;
-			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+			BleEventPost(&cmdBuf, portMAX_DELAY);
 			/* start advertising again when missing the connect */
 			esp_ble_gap_start_advertising(&spp_adv_params);
 			break;
@@ -349,9 +461,25 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_LISTEN_EVT:
 			break;
 		case ESP_GATTS_CONGEST_EVT:
+			/* Flow control: pause notifications until the stack drains its buffers */
+			tx_congested = param->congest.congested;
+			if(tx_congested){
+				tx_stats.congestions++;
+			}else{
+				xTaskNotifyGive(events_task);
+			}
 			break;
 		case ESP_GATTS_CREAT_ATTR_TAB_EVT: {
-			if (param->create.status == ESP_GATT_OK){
+			if (param->create.status == ESP_GATT_OK && param->add_attr_tab.svc_inst_id == STREAM_SVC_INST_ID){
+				if(param->add_attr_tab.num_handle == STREAM_IDX_NB) {
+					memcpy(stream_handle_table, param->add_attr_tab.handles,
+					sizeof(stream_handle_table));
+					esp_ble_gatts_start_service(stream_handle_table[STREAM_IDX_SVC]);
+				}else{
+					ESP_LOGE(__FUNCTION__, "Create attribute table abnormally, num_handle (%d) doesn't equal to STREAM_IDX_NB(%d)",
+						param->add_attr_tab.num_handle, STREAM_IDX_NB);
+				}
+			}else if (param->create.status == ESP_GATT_OK){
 				if(param->add_attr_tab.num_handle == SPP_IDX_NB) {
 					memcpy(spp_handle_table, param->add_attr_tab.handles,
 					sizeof(spp_handle_table));
@@ -397,54 +525,133 @@ static void read_task(void* pvParameters) {
 	CMD_t cmdBuf;
 	while(1) {
 		xQueueReceive(xQueueRead, &cmdBuf, portMAX_DELAY);
-		if(ble_read_isr_p != BLE_NO_INT){
+		if(cmdBuf.command == CMD_STREAM_CONTROL){
+			if(ble_stream_ctrl_p != BLE_NO_INT){
+				ble_stream_ctrl_p(cmdBuf.payload, cmdBuf.length);
+			}
+		}else if(ble_read_isr_p != BLE_NO_INT){
             ble_read_isr_p(cmdBuf.payload, cmdBuf.length);
         }
 	} 
 }
 
+static void BleEventPost(CMD_t *cmd, TickType_t timeout) {
+	if(xQueueSend(xQueueEvents, cmd, timeout) == pdTRUE){
+		xTaskNotifyGive(events_task);
+	}
+}
+
+static bool BleTxAppend(const uint8_t *data, size_t length) {
+	uint32_t head, start, first;
+	bool appended = false;
+
+	if(status != BLE_CONNECTED){
+		return false;
+	}
+	xSemaphoreTake(tx_mutex, portMAX_DELAY);
+	head = tx_head;
+	if(length <= TX_RING_SIZE - (head - tx_tail)){
+		start = head & (TX_RING_SIZE - 1);
+		first = TX_RING_SIZE - start;
+		if(first > length){
+			first = length;
+		}
+		memcpy(&tx_ring[start], data, first);
+		memcpy(tx_ring, &data[first], length - first);
+		tx_head = head + length;
+		appended = true;
+	}else{
+		/* Never wait for the link: drop the whole message */
+		tx_stats.dropped += length;
+	}
+	xSemaphoreGive(tx_mutex);
+	if(appended){
+		xTaskNotifyGive(events_task);
+	}
+	return appended;
+}
+
+static void BleTxFlush(void) {
+	tx_tail = tx_head;
+	tx_congested = false;
+	xQueueReset(xQueueStream);
+}
+
 void bluetooth_events_task(void * arg) {
 	CMD_t cmdBuf;
 	uint16_t spp_conn_id = 0xffff;
 	esp_gatt_if_t spp_gatts_if = 0xff;
-	int data_sent, i;
+	uint32_t pending, start, chunk;
+	TickType_t wait = portMAX_DELAY;
+	stream_packet_t packet;
+	bool packet_ready = false;
 
 	while(1){
-		vTaskDelay(50 / portTICK_PERIOD_MS);
-		xQueueReceive(xQueueEvents, &cmdBuf, portMAX_DELAY);
-        switch(cmdBuf.command){
-            case CMD_BLUETOOTH_CONNECT:
-                spp_conn_id = cmdBuf.spp_conn_id;
-                spp_gatts_if = cmdBuf.spp_gatts_if;
-            break;
-            case CMD_BLUETOOTH_AUTH:
-                ESP_LOGI(TAG, "Device connected");
-				status = BLE_CONNECTED;
-            break;
-            case CMD_BLUETOOTH_DISCONNECT:
-                ESP_LOGI(TAG, "Device disconnected");
-				status = BLE_DISCONNECTED;
-            break;
-            case CMD_SEND_DATA:
-                if (status == BLE_CONNECTED) {
-					data_sent = 0;
-					i = 0;
-					while(data_sent < cmdBuf.length){
-						if((cmdBuf.length - data_sent) > MTU_MAX_BYTES){
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], MTU_MAX_BYTES, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-							i++;
-						}else{
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], cmdBuf.length - data_sent, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-						}
-					}
-                }
-            break;
-            case CMD_BLUETOOTH_DATA:
-                xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
-            break;
-        }
+		/* Woken by events, new data in the ring or end of congestion */
+		ulTaskNotifyTake(pdTRUE, wait);
+		wait = portMAX_DELAY;
+		while(xQueueReceive(xQueueEvents, &cmdBuf, 0) == pdTRUE){
+			switch(cmdBuf.command){
+				case CMD_BLUETOOTH_CONNECT:
+					spp_conn_id = cmdBuf.spp_conn_id;
+					spp_gatts_if = cmdBuf.spp_gatts_if;
+					BleTxFlush();
+				break;
+				case CMD_BLUETOOTH_AUTH:
+					ESP_LOGI(TAG, "Device connected");
+					status = BLE_CONNECTED;
+				break;
+				case CMD_BLUETOOTH_DISCONNECT:
+					ESP_LOGI(TAG, "Device disconnected");
+					status = BLE_DISCONNECTED;
+					BleTxFlush();
+					packet_ready = false;
+					/* Stream control without command: the stream stops */
+					cmdBuf.command = CMD_STREAM_CONTROL;
+					cmdBuf.length = 0;
+					xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
+				break;
+				case CMD_BLUETOOTH_DATA:
+					xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
+				break;
+			}
+		}
+		/* Stream packets go first: one notification each, they can't be split */
+		while(status == BLE_CONNECTED && !tx_congested){
+			if(!packet_ready){
+				if(xQueueReceive(xQueueStream, &packet, 0) != pdTRUE){
+					break;
+				}
+				packet_ready = true;
+			}
+			if(esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, stream_handle_table[STREAM_IDX_DATA_VAL], 
+					packet.length, packet.data, false) != ESP_OK){
+				wait = pdMS_TO_TICKS(10);
+				break;
+			}
+			packet_ready = false;
+			tx_stats.sent += packet.length;
+		}
+		/* Notifications as long as the negotiated MTU allows, straight from the ring */
+		while(status == BLE_CONNECTED && !tx_congested && !packet_ready && (pending = tx_head - tx_tail) > 0){
+			start = tx_tail & (TX_RING_SIZE - 1);
+			chunk = TX_RING_SIZE - start;
+			if(chunk > pending){
+				chunk = pending;
+			}
+			if(chunk > mtu_payload){
+				chunk = mtu_payload;
+			}
+			/* The stack copies the value before returning */
+			if(esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], 
+					chunk, &tx_ring[start], false) != ESP_OK){
+				/* Stack out of buffers: retry later */
+				wait = pdMS_TO_TICKS(10);
+				break;
+			}
+			tx_tail += chunk;
+			tx_stats.sent += chunk;
+		}
 	} 
 }
 
@@ -492,6 +699,10 @@ esp_err_t ret;
 		ESP_LOGE(TAG, "gap register error, error code = %x", ret);
 		return;
 	}
+	ret = esp_ble_gatt_set_local_mtu(MTU_LOCAL);
+	if (ret){
+		ESP_LOGE(TAG, "set local MTU error, error code = %x", ret);
+	}
 	ret = esp_ble_gatts_app_register(ESP_SPP_APP_ID);
 	if (ret){
 		ESP_LOGE(TAG, "gatts app register error, error code = %x", ret);
@@ -521,46 +732,71 @@ esp_err_t ret;
 	configASSERT(xQueueEvents);
 	xQueueRead = xQueueCreate( 10, sizeof(CMD_t) );
 	configASSERT(xQueueRead);
+	tx_mutex = xSemaphoreCreateMutex();
+	configASSERT(tx_mutex);
+	xQueueStream = xQueueCreate(STREAM_QUEUE_LEN, sizeof(stream_packet_t));
+	configASSERT(xQueueStream);
 
 	/* Start tasks */
 	xTaskCreate(read_task, "read", 1024*4, NULL, 2, NULL);
-	xTaskCreate(bluetooth_events_task, "bluetooth_events", 1024*4, NULL, 10, NULL);
+	xTaskCreate(bluetooth_events_task, "bluetooth_events", 1024*4, NULL, 10, &events_task);
 }
 
 ble_status_t BleStatus(void){
 	return status;
 }
 
+uint16_t BleMaxPayload(void){
+	return mtu_payload;
+}
+
 void BleSendByte(const char *data){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 1;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
-	}
+	BleTxAppend((const uint8_t *)data, 1);
 }
 
 void BleSendString(const char *msg){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 0;
-		while(msg[cmdBuf.length] != '\0'){
-			cmdBuf.length++;
-		}
-		memcpy(cmdBuf.payload, msg, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
-	}
+	BleTxAppend((const uint8_t *)msg, strlen(msg));
 }
 
 void BleSendBuffer(const char *data, uint8_t nbytes){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = nbytes;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+	BleTxAppend((const uint8_t *)data, nbytes);
+}
+
+bool BleSend(const uint8_t *data, uint16_t length){
+	return BleTxAppend(data, length);
+}
+
+uint32_t BleTxFree(void){
+	return TX_RING_SIZE - (tx_head - tx_tail);
+}
+
+void BleTxStats(ble_tx_stats_t *stats){
+	*stats = tx_stats;
+}
+
+void BleStreamControl(read_func func_p){
+	ble_stream_ctrl_p = func_p;
+}
+
+bool BleStreamNotify(const uint8_t *packet, uint16_t length){
+	stream_packet_t buf;
+	bool queued = false;
+
+	if(status != BLE_CONNECTED){
+		return false;
+	}
+	if(length <= mtu_payload){
+		buf.length = length;
+		memcpy(buf.data, packet, length);
+		queued = (xQueueSend(xQueueStream, &buf, 0) == pdTRUE);
+	}
+	if(queued){
+		xTaskNotifyGive(events_task);
+	}else{
+		xSemaphoreTake(tx_mutex, portMAX_DELAY);
+		tx_stats.dropped += length;
+		xSemaphoreGive(tx_mutex);
 	}
+	return queued;
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
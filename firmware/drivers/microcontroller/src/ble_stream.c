@@ -0,0 +1,228 @@
+/**
+ * @file ble_stream.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Binary streaming of multichannel 12 bits samples over BLE
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ble_stream.h"
+#include "ble_mcu.h"
+#include <stddef.h>
+#include <string.h>
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_BITS		12
+#define SAMPLE_MASK		0x0FFF
+#define PACKET_MAX		(BLE_STREAM_HEADER_SIZE + (BLE_STREAM_MAX_CHANNELS + 1) / 2 + \
+						(BLE_STREAM_MAX_SAMPLES * SAMPLE_BITS + 7) / 8)
+/*==================[typedef]================================================*/
+/* Bit stream writer (LSB first) */
+typedef struct {
+	uint8_t *data;
+	uint32_t acc;
+	uint8_t bits;
+} bit_writer_t;
+/*==================[internal data declaration]==============================*/
+static struct {
+	uint8_t channels;
+	uint8_t block;				/* Samples per channel in a block (BleStreamPush only) */
+	uint8_t count;				/* Samples per channel in the current block (BleStreamPush only) */
+	uint16_t seq;				/* BleStreamPush only */
+	volatile uint8_t next_block;	/* Block size set by the last start */
+	volatile bool restart;		/* Started again: BleStreamPush takes next_block and starts a new block */
+	uint32_t timestamp;
+	uint16_t rate;
+	volatile bool running;
+	ble_stream_func func_p;
+	uint16_t samples[BLE_STREAM_MAX_SAMPLES];	/* Channel after channel */
+} stream;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Handles writes to the stream control characteristic
+ *
+ * @param data Command and its parameters
+ * @param length Number of bytes
+ */
+static void BleStreamCommand(uint8_t *data, uint8_t length);
+
+/**
+ * @brief Appends a value to the bit stream
+ *
+ * @param bw Bit stream writer
+ * @param value Value (only the lower bits are used)
+ * @param bits Number of bits
+ */
+static void BitPut(bit_writer_t *bw, uint32_t value, uint8_t bits);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void BitPut(bit_writer_t *bw, uint32_t value, uint8_t bits){
+	bw->acc |= (value & ((1UL << bits) - 1)) << bw->bits;
+	bw->bits += bits;
+	while(bw->bits >= 8){
+		*bw->data++ = bw->acc;
+		bw->acc >>= 8;
+		bw->bits -= 8;
+	}
+}
+
+static void BleStreamCommand(uint8_t *data, uint8_t length){
+	uint8_t stop = BLE_STREAM_CMD_STOP;
+	int block;
+
+	if(length == 0){
+		/* Connection lost: blocks are sized for its MTU */
+		if(!stream.running){
+			return;
+		}
+		stream.running = false;
+		data = &stop;
+	}
+	else if(length >= 3){
+		stream.rate = data[1] | (data[2] << 8);
+	}
+	switch(data[0]){
+		case BLE_STREAM_CMD_START:
+			stream.running = false;
+			/* Largest block whose worst case (12 bits samples) fits in one notification */
+			block = ((BleMaxPayload() - BLE_STREAM_HEADER_SIZE - (stream.channels + 1) / 2) * 8) / (SAMPLE_BITS * stream.channels);
+			if(block < 1){
+				/* Not even one frame fits (small MTU, many channels): stays stopped */
+				break;
+			}
+			if(block > BLE_STREAM_MAX_SAMPLES / stream.channels){
+				block = BLE_STREAM_MAX_SAMPLES / stream.channels;
+			}
+			/* Block state belongs to BleStreamPush (application task), it applies the new size */
+			stream.next_block = block;
+			stream.restart = true;
+			stream.running = true;
+		break;
+		case BLE_STREAM_CMD_STOP:
+			stream.running = false;
+		break;
+		case BLE_STREAM_CMD_RATE:
+		break;
+		default:
+			return;
+	}
+	if(stream.func_p != NULL){
+		stream.func_p(stream.running, stream.rate);
+	}
+}
+/*==================[external functions definition]==========================*/
+void BleStreamInit(uint8_t channels, uint16_t rate, ble_stream_func func_p){
+	if(channels == 0 || channels > BLE_STREAM_MAX_CHANNELS){
+		channels = BLE_STREAM_MAX_CHANNELS;
+	}
+	stream.channels = channels;
+	stream.rate = rate;
+	stream.func_p = func_p;
+	stream.running = false;
+	stream.restart = false;
+	BleStreamControl(BleStreamCommand);
+}
+
+bool BleStreamPush(const uint16_t *frame){
+	static uint8_t packet[PACKET_MAX];
+	uint16_t length;
+	uint8_t ch;
+	bool sent = true;
+
+	if(!stream.running){
+		return false;
+	}
+	if(stream.restart){
+		stream.restart = false;
+		stream.block = stream.next_block;
+		stream.count = 0;
+		stream.seq = 0;
+	}
+	if(stream.count == 0){
+		stream.timestamp = esp_timer_get_time();
+	}
+	for(ch = 0; ch < stream.channels; ch++){
+		stream.samples[ch * stream.block + stream.count] = frame[ch] & SAMPLE_MASK;
+	}
+	if(++stream.count >= stream.block){
+		length = BleStreamEncode(packet, stream.seq, stream.timestamp, stream.samples, stream.channels, stream.block);
+		/* Sequence number advances also on drops, so the host sees the gap */
+		sent = BleStreamNotify(packet, length);
+		stream.seq++;
+		stream.count = 0;
+	}
+	return sent;
+}
+
+bool BleStreamRunning(void){
+	return stream.running;
+}
+
+uint16_t BleStreamRate(void){
+	return stream.rate;
+}
+
+uint16_t BleStreamEncode(uint8_t *packet, uint16_t seq, uint32_t timestamp,
+						 const uint16_t *samples, uint8_t channels, uint8_t block){
+	bit_writer_t bw;
+	const uint16_t *s;
+	uint8_t coding[BLE_STREAM_MAX_CHANNELS];
+	uint32_t zz, max;
+	int32_t delta;
+	uint8_t ch, bits;
+	uint16_t i;
+
+	packet[0] = seq;
+	packet[1] = seq >> 8;
+	packet[2] = timestamp;
+	packet[3] = timestamp >> 8;
+	packet[4] = timestamp >> 16;
+	packet[5] = timestamp >> 24;
+	packet[6] = channels;
+	packet[7] = block;
+	/* Bits needed by the largest difference of each channel */
+	for(ch = 0; ch < channels; ch++){
+		s = &samples[ch * block];
+		max = 0;
+		for(i = 1; i < block; i++){
+			delta = (int32_t)(s[i] & SAMPLE_MASK) - (int32_t)(s[i - 1] & SAMPLE_MASK);
+			zz = (delta < 0) ? ((uint32_t)(-delta) << 1) - 1 : (uint32_t)delta << 1;
+			max |= zz;
+		}
+		bits = 0;
+		while(max >> bits){
+			bits++;
+		}
+		coding[ch] = (bits < SAMPLE_BITS) ? bits : BLE_STREAM_RAW;
+	}
+	memset(&packet[BLE_STREAM_HEADER_SIZE], 0, (channels + 1) / 2);
+	for(ch = 0; ch < channels; ch++){
+		packet[BLE_STREAM_HEADER_SIZE + ch / 2] |= coding[ch] << ((ch & 1) * 4);
+	}
+	bw.data = &packet[BLE_STREAM_HEADER_SIZE + (channels + 1) / 2];
+	bw.acc = 0;
+	bw.bits = 0;
+	for(ch = 0; ch < channels; ch++){
+		s = &samples[ch * block];
+		BitPut(&bw, s[0], SAMPLE_BITS);
+		for(i = 1; i < block; i++){
+			if(coding[ch] == BLE_STREAM_RAW){
+				BitPut(&bw, s[i], SAMPLE_BITS);
+			}else if(coding[ch] > 0){
+				delta = (int32_t)(s[i] & SAMPLE_MASK) - (int32_t)(s[i - 1] & SAMPLE_MASK);
+				zz = (delta < 0) ? ((uint32_t)(-delta) << 1) - 1 : (uint32_t)delta << 1;
+				BitPut(&bw, zz, coding[ch]);
+			}
+		}
+	}
+	if(bw.bits > 0){
+		*bw.data++ = bw.acc;
+	}
+	return bw.data - packet;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,184 @@
+/**
+ * @file capture_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Timestamped edge capture (MCPWM capture)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "capture_mcu.h"
+#include "ring_buffer_mcu.h"
+#include <stdint.h>
+#include "driver/mcpwm_cap.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+/*==================[macros and definitions]=================================*/
+#define CAPTURE_QTY		3
+/*==================[internal data declaration]==============================*/
+static mcpwm_cap_timer_handle_t cap_timer = NULL;	/*!< Capture timer, shared by all channels */
+static uint32_t cap_resolution = 0;					/*!< Capture timer ticks per second */
+static struct {
+	mcpwm_cap_channel_handle_t channel;	/*!< Capture channel handle */
+	ring_mcu_t ring;					/*!< Edges captured, not read yet */
+} capture_list[CAPTURE_QTY];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Capture ISR: stores the edge
+ */
+static bool IRAM_ATTR capture_isr(mcpwm_cap_channel_handle_t cap_chan, const mcpwm_capture_event_data_t *edata, void *user_data);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool IRAM_ATTR capture_isr(mcpwm_cap_channel_handle_t cap_chan, const mcpwm_capture_event_data_t *edata, void *user_data){
+	capture_event_t event = {
+		.ticks = edata->cap_value,
+		.rising = (edata->cap_edge == MCPWM_CAP_EDGE_POS),
+	};
+	RingPush((ring_mcu_t *)user_data, &event);
+	return false;
+}
+/*==================[external functions definition]==========================*/
+bool CaptureInit(capture_config_t *capture_ini){
+	capture_event_t *buffer;
+	uint32_t size = capture_ini->size ? capture_ini->size : CAPTURE_DEFAULT_SIZE;
+
+	if(capture_ini->capture >= CAPTURE_QTY || capture_list[capture_ini->capture].channel != NULL){
+		return false;
+	}
+	if(cap_timer == NULL){
+		mcpwm_capture_timer_config_t timer_config = {
+			.group_id = 0,
+			.clk_src = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+		};
+		if(mcpwm_new_capture_timer(&timer_config, &cap_timer) != ESP_OK){
+			return false;
+		}
+		mcpwm_capture_timer_get_resolution(cap_timer, &cap_resolution);
+		mcpwm_capture_timer_enable(cap_timer);
+		mcpwm_capture_timer_start(cap_timer);
+	}
+	/* Internal RAM: written from the ISR */
+	buffer = heap_caps_malloc(size * sizeof(capture_event_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if(buffer == NULL){
+		return false;
+	}
+	if(!RingInit(&capture_list[capture_ini->capture].ring, buffer, sizeof(capture_event_t), size)){
+		heap_caps_free(buffer);
+		return false;
+	}
+	mcpwm_capture_channel_config_t channel_config = {
+		.gpio_num = capture_ini->pin,
+		.prescale = 1,
+		.flags.pos_edge = (capture_ini->edge & CAPTURE_RISING) != 0,
+		.flags.neg_edge = (capture_ini->edge & CAPTURE_FALLING) != 0,
+		.flags.pull_up = capture_ini->pull_up,
+	};
+	if(mcpwm_new_capture_channel(cap_timer, &channel_config, &capture_list[capture_ini->capture].channel) != ESP_OK){
+		capture_list[capture_ini->capture].channel = NULL;
+		heap_caps_free(buffer);
+		return false;
+	}
+	mcpwm_capture_event_callbacks_t callbacks = {
+		.on_cap = capture_isr,
+	};
+	mcpwm_capture_channel_register_event_callbacks(capture_list[capture_ini->capture].channel, &callbacks,
+		&capture_list[capture_ini->capture].ring);
+	return true;
+}
+
+void CaptureStart(capture_mcu_t capture){
+	mcpwm_capture_channel_enable(capture_list[capture].channel);
+}
+
+void CaptureStop(capture_mcu_t capture){
+	mcpwm_capture_channel_disable(capture_list[capture].channel);
+}
+
+void CaptureNotify(capture_mcu_t capture, TaskHandle_t task, uint32_t threshold){
+	RingNotify(&capture_list[capture].ring, task, threshold);
+}
+
+uint32_t CaptureRead(capture_mcu_t capture, capture_event_t *events, uint32_t max){
+	return RingPop(&capture_list[capture].ring, events, max);
+}
+
+uint32_t CaptureDropped(capture_mcu_t capture){
+	return capture_list[capture].ring.dropped;
+}
+
+uint32_t CaptureResolution(void){
+	return cap_resolution;
+}
+
+float CaptureTicksToUs(uint32_t ticks){
+	return cap_resolution ? (float)ticks * 1000000.0f / cap_resolution : 0;
+}
+
+float CapturePeriod(const capture_event_t *events, uint32_t n){
+	uint32_t i, first = 0, last = 0, count = 0;
+	bool rising = false;
+
+	/* Rising edges if there are any, falling edges if not */
+	for(i = 0; i < n; i++){
+		if(events[i].rising){
+			rising = true;
+			break;
+		}
+	}
+	for(i = 0; i < n; i++){
+		if(events[i].rising == rising){
+			if(count == 0){
+				first = i;
+			}
+			last = i;
+			count++;
+		}
+	}
+	if(count < 2){
+		return 0;
+	}
+	/* Unsigned difference: right across timer overflows */
+	return CaptureTicksToUs(events[last].ticks - events[first].ticks) / (count - 1);
+}
+
+float CaptureFrequency(const capture_event_t *events, uint32_t n){
+	float period = CapturePeriod(events, n);
+
+	return (period > 0) ? 1000000.0f / period : 0;
+}
+
+float CaptureDuty(const capture_event_t *events, uint32_t n){
+	uint64_t high = 0;
+	uint32_t i, first = 0, last = 0, rise = 0, pulse = 0;
+	bool started = false, is_high = false;
+
+	for(i = 0; i < n; i++){
+		if(events[i].rising){
+			/* A cycle ends: its pulse counts */
+			if(started){
+				high += pulse;
+			}else{
+				started = true;
+				first = i;
+			}
+			last = i;
+			rise = events[i].ticks;
+			pulse = 0;
+			is_high = true;
+		}else if(is_high){
+			pulse = events[i].ticks - rise;
+			is_high = false;
+		}
+	}
+	if(!started || last == first){
+		return 0;
+	}
+	return 100.0f * high / (uint32_t)(events[last].ticks - events[first].ticks);
+}
+/*==================[end of file]============================================*/
@@ -13,46 +13,73 @@
 #include "gpio_fast_out_mcu.h"
 #include "gpio_mcu.h"
 #include <stdint.h>
-#include <string.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
-dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+static gpio_fast_t bundleA = {.handle = NULL};
 /*==================[internal functions declaration]=========================*/
-
+/**
+ * @brief Configures the pins as outputs and creates the bundle
+ * 
+ * @param bundle Pointer to bundle
+ * @param pin_list Array of GPIO numbers
+ * @param pin_qty Number of pins
+ * @return esp_err_t ESP_ERR_NOT_FOUND if there are not enough free channels
+ */
+static esp_err_t GPIOFastNewBundle(gpio_fast_t *bundle, const gpio_t *pin_list, uint8_t pin_qty);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-
-/*==================[external functions definition]==========================*/
-
-void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
+static esp_err_t GPIOFastNewBundle(gpio_fast_t *bundle, const gpio_t *pin_list, uint8_t pin_qty){
+    if (pin_qty > GPIO_FAST_MAX_PINS) {
+        pin_qty = GPIO_FAST_MAX_PINS;
+    }
     gpio_config_t io_conf = {
         .mode = GPIO_MODE_OUTPUT,
     };
     for (int i = 0; i < pin_qty; i++) {
-        io_conf.pin_bit_mask = 1ULL << bundleA_gpios[i];
+        bundle->gpios[i] = pin_list[i];
+        io_conf.pin_bit_mask = 1ULL << bundle->gpios[i];
         gpio_config(&io_conf);
     }
-    // Create bundleA, output only
-    dedic_gpio_bundle_config_t bundleA_config = {
-        .gpio_array = bundleA_gpios,
+    // Create bundle, output only
+    dedic_gpio_bundle_config_t bundle_config = {
+        .gpio_array = bundle->gpios,
         .array_size = pin_qty,
         .flags = {
             .out_en = 1,
         },
     };
-    ESP_ERROR_CHECK(dedic_gpio_new_bundle(&bundleA_config, &bundleA));
+    bundle->handle = NULL;
+    return dedic_gpio_new_bundle(&bundle_config, &bundle->handle);
+}
+/*==================[external functions definition]==========================*/
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+    ESP_ERROR_CHECK(GPIOFastNewBundle(&bundleA, pin_list, pin_qty));
 }
 
 void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+    dedic_gpio_bundle_write(bundleA.handle, 0xFF, value);
+}
+
+bool GPIOFastBundleInit(gpio_fast_t *bundle, const gpio_t *pin_list, uint8_t pin_qty){
+    return GPIOFastNewBundle(bundle, pin_list, pin_qty) == ESP_OK;
+}
+
+void GPIOFastBundleWrite(gpio_fast_t *bundle, uint32_t mask, uint32_t value){
+    dedic_gpio_bundle_write(bundle->handle, mask, value);
+}
+
+void GPIOFastBundleDeinit(gpio_fast_t *bundle){
+    if (bundle->handle != NULL) {
+        dedic_gpio_del_bundle(bundle->handle);
+        bundle->handle = NULL;
+    }
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -12,8 +12,10 @@
 /*==================[inclusions]=============================================*/
 #include "gpio_mcu.h"
 #include <stdint.h>
+#include <string.h>
 #include "driver/gpio.h"
 #include "driver/gpio_filter.h"
+#include "esp_attr.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_QTY 	24
 #define FILTER_QTY	8
@@ -94,7 +96,8 @@ void GPIOState(gpio_t pin, bool state){
 }
 
 void GPIOToggle(gpio_t pin){
-	gpio_list[pin].state = !gpio_list[pin].state;
+	/* Output register, it may have been written by a port */
+	gpio_list[pin].state = !(REG_READ(GPIO_OUT_REG) & GPIO_MASK(pin));
 	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
 }
 
@@ -116,6 +119,11 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
     gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
 }
 
+void GPIODeactivInt(gpio_t pin){
+	gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_DISABLE);
+	gpio_isr_handler_remove(gpio_list[pin].pin);
+}
+
 void GPIOInputFilter(gpio_t pin){
 	static uint8_t filter_count = 0;
 	gpio_glitch_filter_handle_t filter;
@@ -131,4 +139,38 @@ void GPIODeinit(void){
 	
 }
 
+void GPIOPortInit(gpio_port_t *port, const gpio_t *pins, uint8_t pin_qty){
+	uint8_t group, value, bit;
+
+	if(pin_qty > GPIO_PORT_MAX_PINS){
+		pin_qty = GPIO_PORT_MAX_PINS;
+	}
+	memset(port, 0, sizeof(gpio_port_t));
+	port->nibbles = (pin_qty + 3) / 4;
+	for(bit = 0; bit < pin_qty; bit++){
+		GPIOInit(pins[bit], GPIO_OUTPUT);
+		port->mask |= GPIO_MASK(pins[bit]);
+	}
+	/* Register mask for every value of every 4 bits group */
+	for(group = 0; group < port->nibbles; group++){
+		for(value = 0; value < 16; value++){
+			for(bit = 0; bit < 4 && group * 4 + bit < pin_qty; bit++){
+				if(value & (1 << bit)){
+					port->table[group][value] |= GPIO_MASK(pins[group * 4 + bit]);
+				}
+			}
+		}
+	}
+}
+
+void IRAM_ATTR GPIOPortWrite(const gpio_port_t *port, uint16_t value){
+	uint32_t set = 0;
+	uint8_t group;
+
+	for(group = 0; group < port->nibbles; group++){
+		set |= port->table[group][(value >> (group * 4)) & 0x0F];
+	}
+	GPIOWriteMask(port->mask, set);
+}
+
 /*==================[end of file]============================================*/
@@ -14,40 +14,202 @@
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 //#include "sdkconfig.h"
 
+#include <string.h>
+
 #include "i2c_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
+#define I2C_GLITCH_IGNORE_CNT	7		/*!< Glitches shorter than this number of source clock cycles are filtered */
+#define REG_MAP_WORDS			8		/*!< 32 bits words in a bit map of the 256 registers */
+#define RegInMap(map, reg)		((map)[(reg) >> 5] & (1UL << ((reg) & 0x1F)))
+#define RegSetInMap(map, reg)	((map)[(reg) >> 5] |= (1UL << ((reg) & 0x1F)))
 
 #undef ESP_ERROR_CHECK
 #define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
 
+/*==================[typedef]================================================*/
+/**
+ * @brief Device handle of a slave address
+ */
+typedef struct {
+	uint8_t address;					/*!< I2C slave device address */
+	i2c_master_dev_handle_t handle;		/*!< i2c_master device handle, NULL if entry is free */
+	uint32_t cacheable[REG_MAP_WORDS];	/*!< Registers kept in the shadow (bit map) */
+	uint32_t valid[REG_MAP_WORDS];		/*!< Registers whose shadow value is valid (bit map) */
+	uint8_t shadow[UINT8_MAX + 1];		/*!< Last value read from or written to each register */
+	bool batch;							/*!< Writes are being coalesced */
+	uint8_t batch_reg;					/*!< First register of pending burst write */
+	uint8_t batch_length;				/*!< Bytes in pending burst write */
+	uint8_t batch_data[I2C_BATCH_SIZE];	/*!< Pending burst write */
+} i2c_device_t;
+
+/**
+ * @brief Asynchronous read
+ */
+typedef struct {
+	uint8_t devAddr;					/*!< I2C slave device address */
+	uint8_t regAddr;					/*!< First register to read from */
+	uint8_t length;						/*!< Number of bytes to read */
+	uint8_t *data;						/*!< Buffer to store read data in */
+	i2c_callback_t callback;			/*!< Function called when read ends */
+	void *param;						/*!< Parameter for callback function */
+} i2c_async_t;
+
 /*==================[internal data definition]===============================*/
+static i2c_master_bus_handle_t bus_handle = NULL;		/*!< I2C bus handle */
+static uint32_t bus_clock = I2C_MASTER_FREQ_HZ;			/*!< SCL frequency for the devices */
+static i2c_device_t devices[I2C_MAX_DEVICES];			/*!< Device handle of each slave address in use */
+static SemaphoreHandle_t devices_lock = NULL;			/*!< Protects devices table */
+static QueueHandle_t async_queue = NULL;				/*!< Pending asynchronous reads */
+static TaskHandle_t async_task_handle = NULL;			/*!< Task that performs asynchronous reads */
 
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Get the device of a slave address, adding it to the bus the first time
+ * @param devAddr I2C slave device address
+ * @return Device, NULL if there are no free entries
+ */
+i2c_device_t* I2C_getDevice(uint8_t devAddr);
 
-/*==================[external functions definition]==========================*/
+/**
+ * @brief Write bytes to consecutive registers in one transaction
+ * @param dev Device
+ * @param regAddr First register to write to
+ * @param data Bytes to write
+ * @param length Number of bytes to write
+ * @return Status of operation (true = success)
+ */
+bool I2C_transmit(i2c_device_t *dev, uint8_t regAddr, const uint8_t *data, uint8_t length);
 
-/** Initialize I2C0
+/**
+ * @brief Send the pending burst write of a batch (if any)
+ * @param dev Device
+ * @return Status of operation (true = success)
  */
-bool I2C_initialize( uint32_t clockRateHz )
-{
-	int i2c_master_port = I2C_MASTER_NUM;
+bool I2C_batchFlush(i2c_device_t *dev);
 
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = clockRateHz,
-    };
+/**
+ * @brief Task that performs the queued asynchronous reads
+ * @param pvParameter Not used
+ */
+void I2C_asyncTask(void *pvParameter);
+
+/**
+ * @brief Convert a timeout in milliseconds to the i2c_master timeout
+ * @param timeout Timeout in milliseconds (0 to use I2C_MASTER_TIMEOUT_MS)
+ * @return Timeout in milliseconds
+ */
+static inline int I2C_timeout(uint16_t timeout){
+	return (timeout == 0) ? I2C_MASTER_TIMEOUT_MS : timeout;
+}
 
-    i2c_param_config(i2c_master_port, &conf);
+/*==================[internal functions definition]==========================*/
+i2c_device_t* I2C_getDevice(uint8_t devAddr){
+	i2c_device_t *dev = NULL;
+	uint8_t i;
+
+	xSemaphoreTake(devices_lock, portMAX_DELAY);
+	for(i = 0; i < I2C_MAX_DEVICES && devices[i].handle != NULL; i++){
+		if(devices[i].address == devAddr){
+			dev = &devices[i];
+			break;
+		}
+	}
+	if(dev == NULL && i < I2C_MAX_DEVICES){
+		i2c_device_config_t dev_config = {
+			.dev_addr_length = I2C_ADDR_BIT_LEN_7,
+			.device_address = devAddr,
+			.scl_speed_hz = bus_clock,
+		};
+		if(i2c_master_bus_add_device(bus_handle, &dev_config, &devices[i].handle) == ESP_OK){
+			devices[i].address = devAddr;
+			dev = &devices[i];
+		}
+		else{
+			devices[i].handle = NULL;
+		}
+	}
+	xSemaphoreGive(devices_lock);
+	if(dev == NULL){
+		ESP_LOGE("i2c", "no handle for device 0x%02x", devAddr);
+	}
+	return dev;
+}
 
-    return i2c_driver_install(i2c_master_port, conf.mode, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
+bool I2C_transmit(i2c_device_t *dev, uint8_t regAddr, const uint8_t *data, uint8_t length){
+	/* Register address and data must be contiguous: build the frame on the stack, no heap allocation */
+	uint8_t frame[UINT8_MAX + 1];
+	esp_err_t rc;
+	frame[0] = regAddr;
+	memcpy(&frame[1], data, length);
+	rc = i2c_master_transmit(dev->handle, frame, length + 1, I2C_MASTER_TIMEOUT_MS);
+	if(rc != ESP_OK){
+		ESP_LOGE("i2c", "write 0x%02x: esp_err_t = %d", dev->address, rc);
+		return false;
+	}
 	return true;
+}
+
+bool I2C_batchFlush(i2c_device_t *dev){
+	bool status = true;
+	if(dev->batch_length > 0){
+		status = I2C_transmit(dev, dev->batch_reg, dev->batch_data, dev->batch_length);
+		dev->batch_length = 0;
+	}
+	return status;
+}
+
+void I2C_asyncTask(void *pvParameter){
+	i2c_async_t job;
+	bool status;
+	while(true){
+		xQueueReceive(async_queue, &job, portMAX_DELAY);
+		status = I2C_writeRead(job.devAddr, &job.regAddr, 1, job.data, job.length, 0);
+		if(job.callback != NULL){
+			job.callback(job.param, status);
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+
+/** Initialize I2C0
+ */
+bool I2C_initialize( uint32_t clockRateHz )
+{
+	if(bus_handle != NULL){
+		return true;
+	}
+	i2c_master_bus_config_t bus_config = {
+		.i2c_port = I2C_MASTER_NUM,
+		.sda_io_num = I2C_MASTER_SDA_IO,
+		.scl_io_num = I2C_MASTER_SCL_IO,
+		.clk_source = I2C_CLK_SRC_DEFAULT,
+		.glitch_ignore_cnt = I2C_GLITCH_IGNORE_CNT,
+		.flags.enable_internal_pullup = true,
+	};
+	bus_clock = clockRateHz;
+	if(devices_lock == NULL){
+		devices_lock = xSemaphoreCreateMutex();
+	}
+	/* Asynchronous reads: queue and task exist before any read can be queued */
+	if(async_queue == NULL){
+		async_queue = xQueueCreate(I2C_ASYNC_QUEUE_SIZE, sizeof(i2c_async_t));
+	}
+	if(async_task_handle == NULL && async_queue != NULL){
+		if(xTaskCreate(I2C_asyncTask, "i2c_async", 2048, NULL, 5, &async_task_handle) != pdPASS){
+			async_task_handle = NULL;
+		}
+	}
+	if(devices_lock == NULL || async_task_handle == NULL){
+		ESP_LOGE("i2c", "no memory for the driver");
+		return false;
+	}
+	return i2c_new_master_bus(&bus_config, &bus_handle) == ESP_OK;
 };
 
 
@@ -124,42 +286,78 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-	ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
+	uint8_t i, reg;
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev == NULL){
+		return 0;
+	}
+	/* Served from the shadow if all registers are there */
+	for(i = 0; i < length && RegInMap(dev->valid, (uint8_t)(regAddr + i)); i++);
+	if(i == length){
+		for(i = 0; i < length; i++){
+			data[i] = dev->shadow[(uint8_t)(regAddr + i)];
+		}
+		return length;
+	}
+	/* Pending writes go first, they may change what is read */
+	I2C_batchFlush(dev);
+	/* Register address and data in the same transaction, with a repeated start */
+	if(!I2C_writeRead(devAddr, &regAddr, 1, data, length, timeout)){
+		return 0;
+	}
+	for(i = 0; i < length; i++){
+		reg = regAddr + i;
+		if(RegInMap(dev->cacheable, reg)){
+			dev->shadow[reg] = data[i];
+			RegSetInMap(dev->valid, reg);
+		}
+	}
 	return length;
 }
 
 bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 
 	uint8_t data1[] = {(uint8_t)(data>>8), (uint8_t)(data & 0xff)};
-	I2C_writeBytes(devAddr, regAddr, 2, data1);
-	return true;
+	return I2C_writeBytes(devAddr, regAddr, 2, data1);
 }
 
 void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, reg, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev != NULL){
+		I2C_batchFlush(dev);
+		ESP_ERROR_CHECK(i2c_master_transmit(dev->handle, &reg, 1, I2C_MASTER_TIMEOUT_MS));
+	}
+}
+
+bool I2C_writeRead(uint8_t devAddr, const uint8_t *txData, uint8_t txLength, uint8_t *rxData, uint8_t rxLength, uint16_t timeout){
+	esp_err_t rc;
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev == NULL){
+		return false;
+	}
+	rc = i2c_master_transmit_receive(dev->handle, txData, txLength, rxData, rxLength, I2C_timeout(timeout));
+	if(rc != ESP_OK){
+		ESP_LOGE("i2c", "read 0x%02x: esp_err_t = %d", devAddr, rc);
+		return false;
+	}
+	return true;
+}
+
+bool I2C_readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, i2c_callback_t callback, void *param){
+	i2c_async_t job = {devAddr, regAddr, length, data, callback, param};
+	i2c_device_t *dev;
+	if(async_task_handle == NULL){
+		return false;
+	}
+	dev = I2C_getDevice(devAddr);
+	if(dev == NULL){
+		return false;
+	}
+	/* Pending writes go first, they may change what is read */
+	if(!I2C_batchFlush(dev)){
+		return false;
+	}
+	return xQueueSend(async_queue, &job, 0) == pdTRUE;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -212,21 +410,10 @@ bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t l
  * @return Status of operation (true = success)
  */
 bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
-	return true;
+	return I2C_writeBytes(devAddr, regAddr, 1, &data);
 }
 
-/** Write single byte to an 8-bit device register.
+/** Write multiple bytes to an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param length Number of bytes to write
@@ -234,20 +421,79 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  * @return Status of operation (true = success)
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
+	uint8_t i, reg;
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev == NULL){
+		return false;
+	}
+	/* Write-through shadow */
+	for(i = 0; i < length; i++){
+		reg = regAddr + i;
+		if(RegInMap(dev->cacheable, reg)){
+			dev->shadow[reg] = data[i];
+			RegSetInMap(dev->valid, reg);
+		}
+	}
+	if(!dev->batch){
+		return I2C_transmit(dev, regAddr, data, length);
+	}
+	/* Batch: append to pending burst if registers are consecutive, otherwise start a new one */
+	if(dev->batch_length == 0 || regAddr != (uint8_t)(dev->batch_reg + dev->batch_length) || 
+		dev->batch_length + length > I2C_BATCH_SIZE){
+		if(!I2C_batchFlush(dev)){
+			return false;
+		}
+		if(length > I2C_BATCH_SIZE){
+			return I2C_transmit(dev, regAddr, data, length);
+		}
+		dev->batch_reg = regAddr;
+	}
+	memcpy(&dev->batch_data[dev->batch_length], data, length);
+	dev->batch_length += length;
 	return true;
 }
 
+bool I2C_shadowEnable(uint8_t devAddr, uint8_t firstReg, uint8_t lastReg){
+	uint16_t reg;
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev == NULL || lastReg < firstReg || lastReg - firstReg + 1 > UINT8_MAX){
+		return false;
+	}
+	I2C_batchFlush(dev);
+	/* Load the whole range in one burst read */
+	if(!I2C_writeRead(devAddr, &firstReg, 1, &dev->shadow[firstReg], lastReg - firstReg + 1, 0)){
+		return false;
+	}
+	for(reg = firstReg; reg <= lastReg; reg++){
+		RegSetInMap(dev->cacheable, reg);
+		RegSetInMap(dev->valid, reg);
+	}
+	return true;
+}
+
+void I2C_shadowInvalidate(uint8_t devAddr){
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev != NULL){
+		memset(dev->valid, 0, sizeof(dev->valid));
+	}
+}
+
+void I2C_batchBegin(uint8_t devAddr){
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev != NULL){
+		dev->batch = true;
+	}
+}
+
+bool I2C_batchEnd(uint8_t devAddr){
+	i2c_device_t *dev = I2C_getDevice(devAddr);
+	if(dev == NULL){
+		return false;
+	}
+	dev->batch = false;
+	return I2C_batchFlush(dev);
+}
+
 
 /**
  * read word
@@ -259,9 +505,9 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
  */
 int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout){
 	uint8_t msb[2] = {0,0};
-	I2C_readBytes(devAddr, regAddr, 2, msb, 0);
+	int8_t count = I2C_readBytes(devAddr, regAddr, 2, msb, timeout);
 	*data = (int16_t)((msb[0] << 8) | msb[1]);
-	return 0;
+	return count;
 }
 
 /*==================[end of file]============================================*/
@@ -11,6 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include "pwm_mcu.h"
+#include <stdbool.h>
 #include "driver/ledc.h"
 /*==================[macros and definitions]=================================*/
 #define DC_MAX  1023
@@ -27,6 +28,8 @@ static ledc_channel_config_t ledc_channel_cfg = {
     .duty           = 0,       /*!< Starts in 0% */
     .hpoint         = 0
 };
+static const ledc_channel_t pwm_channel[] = {LEDC_CHANNEL_0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3};
+static bool fade_installed = false;     /*!< LEDC fade service installed */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -117,6 +120,10 @@ void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
         duty_cycle = DC_100;
     }
     uint32_t dc = ((uint32_t)duty_cycle * DC_MAX) / DC_100;
+    if(fade_installed){
+        /* An ongoing fade would hold the duty update until it ends */
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_channel[out]);
+    }
     switch(out){
         case PWM_0:
             ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, dc);
@@ -137,6 +144,24 @@ void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
     }
 }
 
+void PWMFade(pwm_out_t out, uint8_t duty_cycle, uint32_t time_ms){
+    if(time_ms == 0){
+        PWMSetDutyCycle(out, duty_cycle);
+        return;
+    }
+    if(duty_cycle > DC_100){
+        duty_cycle = DC_100;
+    }
+    uint32_t dc = ((uint32_t)duty_cycle * DC_MAX) / DC_100;
+    if(!fade_installed){
+        ledc_fade_func_install(0);
+        fade_installed = true;
+    }
+    ledc_fade_stop(LEDC_LOW_SPEED_MODE, pwm_channel[out]);
+    ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, pwm_channel[out], dc, time_ms);
+    ledc_fade_start(LEDC_LOW_SPEED_MODE, pwm_channel[out], LEDC_FADE_NO_WAIT);
+}
+
 uint8_t PWMSetFreq(pwm_out_t out, uint32_t freq){
     switch(out){
         case PWM_0:
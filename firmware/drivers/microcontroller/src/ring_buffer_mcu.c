@@ -0,0 +1,107 @@
+/**
+ * @file ring_buffer_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Lock-free single producer, single consumer ring buffer
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ring_buffer_mcu.h"
+#include <stdint.h>
+#include <string.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool RingInit(ring_mcu_t *ring, void *buffer, uint16_t item_size, uint32_t size){
+	if(size == 0 || (size & (size - 1)) != 0){
+		return false;
+	}
+	ring->buffer = buffer;
+	ring->size = size;
+	ring->item_size = item_size;
+	ring->head = 0;
+	ring->tail = 0;
+	ring->dropped = 0;
+	ring->threshold = 1;
+	ring->task = NULL;
+	ring->pending = false;
+	return true;
+}
+
+void RingNotify(ring_mcu_t *ring, TaskHandle_t task, uint32_t threshold){
+	if(threshold == 0){
+		threshold = 1;
+	}else if(threshold > ring->size){
+		threshold = ring->size;
+	}
+	ring->threshold = threshold;
+	ring->task = task;
+}
+
+bool IRAM_ATTR RingPush(ring_mcu_t *ring, const void *item){
+	BaseType_t task_woken = pdFALSE;
+	uint32_t head = ring->head;
+	uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+	if(head - tail >= ring->size){
+		ring->dropped++;
+		return false;
+	}
+	memcpy(&ring->buffer[(head & (ring->size - 1)) * ring->item_size], item, ring->item_size);
+	/* Item written before it's published */
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	if(ring->task != NULL && head + 1 - tail >= ring->threshold &&
+			!__atomic_load_n(&ring->pending, __ATOMIC_SEQ_CST)){
+		ring->pending = true;
+		if(xPortInIsrContext()){
+			vTaskNotifyGiveFromISR(ring->task, &task_woken);
+			portYIELD_FROM_ISR(task_woken);
+		}else{
+			xTaskNotifyGive(ring->task);
+		}
+	}
+	return true;
+}
+
+uint32_t RingPop(ring_mcu_t *ring, void *items, uint32_t max){
+	uint32_t tail = ring->tail;
+	uint32_t head, count, start, first;
+
+	/* Cleared before reading head: later pushes notify again */
+	__atomic_store_n(&ring->pending, false, __ATOMIC_SEQ_CST);
+	head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	count = head - tail;
+	if(count > max){
+		count = max;
+	}
+	if(count > 0 && items != NULL){
+		start = tail & (ring->size - 1);
+		first = ring->size - start;
+		if(first > count){
+			first = count;
+		}
+		memcpy(items, &ring->buffer[start * ring->item_size], first * ring->item_size);
+		memcpy((uint8_t *)items + first * ring->item_size, ring->buffer, (count - first) * ring->item_size);
+	}
+	/* Items read before their space is released */
+	__atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+	return count;
+}
+
+uint32_t RingCount(ring_mcu_t *ring){
+	return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
+/*==================[end of file]============================================*/
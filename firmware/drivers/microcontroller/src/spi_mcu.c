@@ -22,6 +22,7 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_DEV_NUM		3		/*!< Number of devices that share the SPI bus */
 /*==================[internal data declaration]==============================*/
 spi_device_handle_t spi_1, spi_2, spi_3;
 const spi_bus_config_t bus_cfg = {
@@ -39,21 +40,61 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+/**
+ * @brief Queued transaction, from the preallocated pool
+ */
+typedef struct {
+	spi_transaction_t trans;		/*!< IDF transaction (trans.user points back to the slot) */
+	spi_callback_t func_p;			/*!< Called when the transaction ends (ISR context) */
+	void *param_p;					/*!< Parameter for func_p */
+} spi_queued_t;
+static spi_queued_t queued_trans[SPI_DEV_NUM][SPI_QUEUE_SIZE];	/*!< Transaction pool for queued transfers */
+static uint8_t queued_head[SPI_DEV_NUM];							/*!< Next free slot in queued_trans */
+static uint8_t queued_count[SPI_DEV_NUM];							/*!< Number of queued transactions not yet reaped */
 /*==================[internal functions declaration]=========================*/
+static void IRAM_ATTR SpiQueuedDone(spi_transaction_t *t){
+	spi_queued_t *q = t->user;
+	if(q->func_p != NULL){
+		q->func_p(q->param_p);
+	}
+}
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
-	spi_1_isr_p(spi_1_user_data);
+	if(t->user != NULL){
+		SpiQueuedDone(t);
+	}else if(transfer_mode_1 == SPI_INTERRUPT){
+		spi_1_isr_p(spi_1_user_data);
+	}
 }
 static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
-	spi_2_isr_p(spi_2_user_data);
+	if(t->user != NULL){
+		SpiQueuedDone(t);
+	}else if(transfer_mode_2 == SPI_INTERRUPT){
+		spi_2_isr_p(spi_2_user_data);
+	}
 }
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
-	spi_3_isr_p(spi_3_user_data);
+	if(t->user != NULL){
+		SpiQueuedDone(t);
+	}else if(transfer_mode_3 == SPI_INTERRUPT){
+		spi_3_isr_p(spi_3_user_data);
+	}
 }
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static spi_device_handle_t SpiGetHandle(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return spi_1;
+        case SPI_2:
+            return spi_2;
+        case SPI_3:
+            return spi_3;
+    }
+    return NULL;
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
@@ -65,35 +106,32 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .queue_size = SPI_QUEUE_SIZE,                        
     };
     switch(spi->device){
         case SPI_1:
             dev_cfg.spics_io_num = PIN_NUM_CS1;
             transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
+            /* Always installed: queued transactions report their end even in polling mode */
+            dev_cfg.post_cb = spi_1_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
             spi_1_isr_p = spi->func_p;
             spi_1_user_data = spi->param_p;
             break;
         case SPI_2:
             dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_2 = spi->transfer_mode;
+            /* Always installed: queued transactions report their end even in polling mode */
+            dev_cfg.post_cb = spi_2_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
             spi_2_isr_p = spi->func_p;
             spi_2_user_data = spi->param_p;
             break;
         case SPI_3:
             dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_3 = spi->transfer_mode;
+            /* Always installed: queued transactions report their end even in polling mode */
+            dev_cfg.post_cb = spi_3_isr;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
             spi_3_isr_p = spi->func_p;
             spi_3_user_data = spi->param_p;
@@ -104,6 +142,7 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device, 0);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
@@ -144,6 +183,7 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device, 0);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
@@ -183,6 +223,7 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device, 0);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = buffer_size * 8;
@@ -222,6 +263,55 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     }
 }
 
+void SpiQueue(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size, 
+        spi_callback_t func_p, void *param_p){
+    spi_device_handle_t handle = SpiGetHandle(device);
+    spi_transaction_t *done;
+    spi_queued_t *q;
+    /* Recycle the slots of transactions already ended, without waiting */
+    while(queued_count[device] > 0 && spi_device_get_trans_result(handle, &done, 0) == ESP_OK){
+        queued_count[device]--;
+    }
+    /* If every slot is in flight, wait for the oldest one to be free */
+    if(queued_count[device] == SPI_QUEUE_SIZE){
+        SpiQueueWait(device, SPI_QUEUE_SIZE - 1);
+    }
+    q = &queued_trans[device][queued_head[device]];
+    memset(&q->trans, 0, sizeof(spi_transaction_t));
+    q->trans.length = buffer_size * 8;
+    q->trans.tx_buffer = tx_buffer;
+    if(rx_buffer != NULL){
+        q->trans.rxlength = buffer_size * 8;
+        q->trans.rx_buffer = rx_buffer;
+    }
+    q->trans.user = q;
+    q->func_p = func_p;
+    q->param_p = param_p;
+    spi_device_queue_trans(handle, &q->trans, portMAX_DELAY);
+    queued_head[device] = (queued_head[device] + 1) % SPI_QUEUE_SIZE;
+    queued_count[device]++;
+}
+
+void SpiWriteQueued(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
+    SpiQueue(device, tx_buffer, NULL, tx_buffer_size, NULL, NULL);
+}
+
+void SpiQueueWait(spi_dev_t device, uint8_t pending){
+    spi_transaction_t *t;
+    while(queued_count[device] > pending){
+        spi_device_get_trans_result(SpiGetHandle(device), &t, portMAX_DELAY);
+        queued_count[device]--;
+    }
+}
+
+void SpiAcquire(spi_dev_t device){
+    spi_device_acquire_bus(SpiGetHandle(device), portMAX_DELAY);
+}
+
+void SpiRelease(spi_dev_t device){
+    spi_device_release_bus(SpiGetHandle(device));
+}
+
 uint8_t SpiDeInit(spi_dev_t device){
     return 0;
 }
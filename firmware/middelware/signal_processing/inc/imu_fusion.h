@@ -0,0 +1,86 @@
+#ifndef IMU_FUSION_H_
+#define IMU_FUSION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup IMU_Fusion IMU Fusion
+ */
+
+/** \brief Orientation of the MPU6050 from the esp-dsp 13 states EKF
+ * 
+ * Samples come from the MPU6050 data ready pipeline (INT pin, no polling). 
+ * A fusion task runs the ekf_imu13states filter with each gyroscope sample and 
+ * corrects it with the accelerometer, and publishes the orientation quaternion. 
+ * 
+ * There is no magnetometer: roll and pitch are absolute, yaw is integrated 
+ * from the gyroscope and drifts slowly. 
+ * The EKF is heavy for the ESP32-C6 (no FPU): rates up to ~100 Hz are recommended.
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Orientation estimated by the filter
+ */
+typedef struct {
+    int64_t timestamp;      /*!< Time of the sample (us since boot) */
+    float q[4];             /*!< Orientation quaternion (w, x, y, z) */
+} imu_orientation_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the sensor fusion
+ * 
+ * MPU6050_initialize must be called before. Uses the MPU6050 data ready pipeline, 
+ * so the MPU6050 FIFO stream can't be used at the same time.
+ * 
+ * @param int_pin   GPIO connected to MPU6050 INT pin
+ * @param rate      Sample rate in Hz (4 to 1000)
+ * @return true on success
+ */
+bool ImuFusionStart(gpio_t int_pin, uint16_t rate);
+
+/**
+ * @brief Get the latest orientation
+ * 
+ * @param orientation   Latest orientation published by the filter
+ * @param timeout       Time to wait for a new orientation (ms, 0 = don't wait)
+ * @return true if a new orientation was read
+ */
+bool ImuFusionRead(imu_orientation_t *orientation, uint32_t timeout);
+
+/**
+ * @brief Stop the sensor fusion
+ */
+void ImuFusionStop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IMU_FUSION_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,93 @@
+#ifndef MAHONY_FILTER_H_
+#define MAHONY_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Mahony_Filter Mahony Filter
+ */
+
+/** \brief Fixed point Mahony orientation filter
+ * 
+ * Lightweight alternative to the ekf_imu13states EKF: integer only, no heap, 
+ * a few hundred cycles per sample. Takes the raw samples of MPU6050_getMotion6 
+ * (or the FIFO stream) and keeps the orientation quaternion in Q30 
+ * (1.0 = 1 << 30). The gyroscope is integrated and corrected towards the 
+ * measured gravity with a PI controller (Kp, Ki). 
+ * 
+ * Roll and pitch are absolute; without magnetometer, yaw is only integrated 
+ * (Ki removes gyroscope bias on the X and Y axes, not on the vertical axis). 
+ * 
+ * Host benchmark and comparison against the EKF: tools/imu_bench/imu_bench.py
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define MAHONY_Q30_ONE      (1L << 30)      /*!< 1.0 in Q30 */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize the filter
+ * 
+ * The orientation is taken from the accelerometer on the first update.
+ * 
+ * @param rate          Sample rate (Hz)
+ * @param gyro_range    Gyroscope full scale range (degrees/s: 250, 500, 1000 or 2000)
+ * @param kp            Proportional gain (1/s). Higher follows the accelerometer faster (typ. 2)
+ * @param ki            Integral gain (1/s^2). 0 disables gyroscope bias compensation (typ. 0.1)
+ */
+void MahonyInit(uint16_t rate, uint16_t gyro_range, float kp, float ki);
+
+/**
+ * @brief Update the orientation with a new sample
+ * 
+ * Raw values as read by MPU6050_getMotion6. Accelerometer range doesn't matter 
+ * (only direction is used). Accelerometer is ignored if it reads zero.
+ * 
+ * @param ax, ay, az    Raw accelerometer sample
+ * @param gx, gy, gz    Raw gyroscope sample
+ */
+void MahonyUpdate(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz);
+
+/**
+ * @brief Get the orientation quaternion in fixed point
+ * 
+ * @param q     Quaternion (w, x, y, z) in Q30
+ */
+void MahonyGetQuaternionQ30(int32_t q[4]);
+
+/**
+ * @brief Get the orientation quaternion
+ * 
+ * @param q     Quaternion (w, x, y, z)
+ */
+void MahonyGetQuaternion(float q[4]);
+
+/**
+ * @brief Get the orientation as Euler angles (Z-Y-X)
+ * 
+ * @param roll      Rotation around X (degrees)
+ * @param pitch     Rotation around Y (degrees)
+ * @param yaw       Rotation around Z (degrees)
+ */
+void MahonyGetEuler(float * roll, float * pitch, float * yaw);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MAHONY_FILTER_H_ */
+
+/*==================[end of file]============================================*/
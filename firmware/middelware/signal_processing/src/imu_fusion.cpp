@@ -0,0 +1,126 @@
+/**
+ * @file imu_fusion.cpp
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Orientation of the MPU6050 from the esp-dsp 13 states EKF
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "imu_fusion.h"
+#include "ekf_imu13states.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+extern "C" {
+#include "mpu6050.h"
+}
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_QUEUE_SIZE   4
+#define FUSION_STACK_SIZE   4096
+#define FUSION_PRIORITY     5
+/** Measurement noise: magnetometer (not trusted, there is none) and accelerometer */
+#define R_MAGN              1000.0f
+#define R_ACCEL             0.01f
+/** Accelerometer not used when its norm is outside 1 g +/- this value (linear acceleration) */
+#define ACCEL_TOLERANCE     0.2f
+/*==================[internal data declaration]==============================*/
+static ekf_imu13states *ekf13 = NULL;
+static QueueHandle_t sample_queue = NULL;
+static QueueHandle_t orientation_mailbox = NULL;
+static TaskHandle_t fusion_task = NULL;
+static volatile int64_t start_time = 0;     /* Samples before the last ImuFusionStart are discarded */
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Called by the MPU6050 driver task with each sample
+ */
+static void ImuFusionSample(const mpu6050_sample_t *sample, void *param);
+
+/**
+ * @brief Runs the filter with each sample and publishes the orientation
+ */
+static void ImuFusionTask(void *pvParameter);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void ImuFusionSample(const mpu6050_sample_t *sample, void *param){
+    /* Never block the driver task: drop the sample if fusion is behind */
+    xQueueSend(sample_queue, sample, 0);
+}
+
+static void ImuFusionTask(void *pvParameter){
+    static mpu6050_sample_t sample;
+    static imu_orientation_t orientation;
+    float R[6] = {R_MAGN, R_MAGN, R_MAGN, R_ACCEL, R_ACCEL, R_ACCEL};
+    float accel[3], magn[3];
+    int64_t last = 0;
+    float dt, norm;
+
+    while(true){
+        xQueueReceive(sample_queue, &sample, portMAX_DELAY);
+        /* Restarted (ImuFusionStart): the filter is reset here, where it's used */
+        if(ulTaskNotifyTake(pdTRUE, 0) > 0){
+            ekf13->Init();
+            last = 0;
+        }
+        if(sample.timestamp < start_time){
+            continue;
+        }
+        if(last != 0){
+            dt = (sample.timestamp - last) * 1e-6f;
+            ekf13->Process(sample.gyro, dt);
+            norm = sqrtf(sample.accel[0] * sample.accel[0] + sample.accel[1] * sample.accel[1] + 
+                sample.accel[2] * sample.accel[2]);
+            if(fabsf(norm - 1.0f) < ACCEL_TOLERANCE){
+                /* Without magnetometer the expected value is used as measurement (no innovation) */
+                dspm::Mat magn_ampl(&ekf13->X.data[7], 3, 1);
+                dspm::Mat magn_offset(&ekf13->X.data[10], 3, 1);
+                dspm::Mat expected = ekf::quat2rotm(ekf13->X.data).t() * magn_ampl + magn_offset;
+                for(uint8_t i = 0; i < 3; i++){
+                    accel[i] = sample.accel[i] / norm;
+                    magn[i] = expected.data[i];
+                }
+                ekf13->UpdateRefMeasurement(accel, magn, R);
+            }
+        }
+        last = sample.timestamp;
+        orientation.timestamp = sample.timestamp;
+        for(uint8_t i = 0; i < 4; i++){
+            orientation.q[i] = ekf13->X.data[i];
+        }
+        xQueueOverwrite(orientation_mailbox, &orientation);
+    }
+}
+/*==================[external functions definition]==========================*/
+bool ImuFusionStart(gpio_t int_pin, uint16_t rate){
+    if(ekf13 == NULL){
+        ekf13 = new ekf_imu13states();
+        sample_queue = xQueueCreate(SAMPLE_QUEUE_SIZE, sizeof(mpu6050_sample_t));
+        orientation_mailbox = xQueueCreate(1, sizeof(imu_orientation_t));
+        xTaskCreate(ImuFusionTask, "imu_fusion", FUSION_STACK_SIZE, NULL, FUSION_PRIORITY, &fusion_task);
+    }
+    start_time = esp_timer_get_time();
+    xQueueReset(sample_queue);
+    xQueueReset(orientation_mailbox);
+    xTaskNotifyGive(fusion_task);
+    return MPU6050_dataReadyStart(int_pin, rate, ImuFusionSample, NULL);
+}
+
+bool ImuFusionRead(imu_orientation_t *orientation, uint32_t timeout){
+    if(orientation_mailbox == NULL){
+        return false;
+    }
+    return xQueueReceive(orientation_mailbox, orientation, pdMS_TO_TICKS(timeout)) == pdTRUE;
+}
+
+void ImuFusionStop(void){
+    MPU6050_dataReadyStop();
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,173 @@
+/**
+ * @file mahony_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Fixed point Mahony orientation filter
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <math.h>
+#include "mahony_filter.h"
+/*==================[macros and definitions]=================================*/
+#define Q30             30
+#define Q30_FLOAT       1073741824.0f
+/** Product of two Q30 values */
+#define QMUL(a, b)      ((int32_t)(((int64_t)(a) * (b)) >> Q30))
+/** Gyroscope scale in Q40: raw * gyro_scale >> 10 gives half angle increment in Q30 */
+#define GYRO_SCALE_Q    40
+#define RAD_PER_DEG     0.01745329252f
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Filter state
+ */
+static struct {
+    int32_t q[4];           /*!< Orientation quaternion (w, x, y, z), Q30 */
+    int32_t integral[3];    /*!< Integral of the error, gyroscope correction (rad/s), Q30 */
+    int32_t gyro_scale;     /*!< raw gyroscope to half angle increment (rad), Q40 */
+    int32_t kp_half_dt;     /*!< Kp * dt / 2, Q30 */
+    int32_t ki_dt;          /*!< Ki * dt, Q30 */
+    int32_t half_dt;        /*!< dt / 2 (s), Q30 */
+    bool aligned;           /*!< Orientation initialized from accelerometer */
+} ahrs;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Integer square root
+ */
+static uint32_t isqrt(uint32_t x);
+
+/**
+ * @brief Set roll and pitch from the accelerometer (yaw = 0)
+ */
+static void MahonyAlign(int16_t ax, int16_t ay, int16_t az);
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t isqrt(uint32_t x){
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while(bit > x){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(x >= root + bit){
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        }else{
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static void MahonyAlign(int16_t ax, int16_t ay, int16_t az){
+    float roll = atan2f(ay, az) / 2;
+    float pitch = atan2f(-ax, sqrtf((float)ay * ay + (float)az * az)) / 2;
+    float cr = cosf(roll), sr = sinf(roll), cp = cosf(pitch), sp = sinf(pitch);
+
+    ahrs.q[0] = cr * cp * Q30_FLOAT;
+    ahrs.q[1] = sr * cp * Q30_FLOAT;
+    ahrs.q[2] = cr * sp * Q30_FLOAT;
+    ahrs.q[3] = -sr * sp * Q30_FLOAT;
+}
+/*==================[external functions definition]==========================*/
+void MahonyInit(uint16_t rate, uint16_t gyro_range, float kp, float ki){
+    float dt = 1.0f / rate;
+
+    ahrs.q[0] = MAHONY_Q30_ONE;
+    ahrs.q[1] = ahrs.q[2] = ahrs.q[3] = 0;
+    ahrs.integral[0] = ahrs.integral[1] = ahrs.integral[2] = 0;
+    ahrs.gyro_scale = gyro_range / 32768.0f * RAD_PER_DEG * dt / 2 * (float)(1LL << GYRO_SCALE_Q);
+    ahrs.kp_half_dt = kp * dt / 2 * Q30_FLOAT;
+    ahrs.ki_dt = ki * dt * Q30_FLOAT;
+    ahrs.half_dt = dt / 2 * Q30_FLOAT;
+    ahrs.aligned = false;
+}
+
+void MahonyUpdate(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz){
+    int32_t *q = ahrs.q;
+    int32_t a[3], v[3], e[3], h[3];
+    int32_t q0, q1, q2, q3, norm;
+    uint32_t length;
+    int64_t inv;
+    uint8_t i;
+
+    length = isqrt((uint32_t)(ax * ax) + (uint32_t)(ay * ay) + (uint32_t)(az * az));
+    if(length != 0 && !ahrs.aligned){
+        MahonyAlign(ax, ay, az);
+        ahrs.aligned = true;
+    }
+    for(i = 0; i < 3; i++){
+        h[i] = QMUL(ahrs.integral[i], ahrs.half_dt);
+    }
+    if(length != 0){
+        /* Measured gravity direction, Q30 */
+        inv = (1LL << (Q30 + 16)) / length;
+        a[0] = (ax * inv) >> 16;
+        a[1] = (ay * inv) >> 16;
+        a[2] = (az * inv) >> 16;
+        /* Gravity direction expected from the orientation, Q30 */
+        v[0] = 2 * (QMUL(q[1], q[3]) - QMUL(q[0], q[2]));
+        v[1] = 2 * (QMUL(q[0], q[1]) + QMUL(q[2], q[3]));
+        v[2] = QMUL(q[0], q[0]) - QMUL(q[1], q[1]) - QMUL(q[2], q[2]) + QMUL(q[3], q[3]);
+        /* Error = measured x expected */
+        e[0] = QMUL(a[1], v[2]) - QMUL(a[2], v[1]);
+        e[1] = QMUL(a[2], v[0]) - QMUL(a[0], v[2]);
+        e[2] = QMUL(a[0], v[1]) - QMUL(a[1], v[0]);
+        for(i = 0; i < 3; i++){
+            ahrs.integral[i] += QMUL(e[i], ahrs.ki_dt);
+            h[i] += QMUL(e[i], ahrs.kp_half_dt);
+        }
+    }
+    /* Half angle increment, Q30 */
+    h[0] += ((int64_t)gx * ahrs.gyro_scale) >> (GYRO_SCALE_Q - Q30);
+    h[1] += ((int64_t)gy * ahrs.gyro_scale) >> (GYRO_SCALE_Q - Q30);
+    h[2] += ((int64_t)gz * ahrs.gyro_scale) >> (GYRO_SCALE_Q - Q30);
+    /* q += q * (0, h) */
+    q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+    q[0] = q0 - QMUL(q1, h[0]) - QMUL(q2, h[1]) - QMUL(q3, h[2]);
+    q[1] = q1 + QMUL(q0, h[0]) + QMUL(q2, h[2]) - QMUL(q3, h[1]);
+    q[2] = q2 + QMUL(q0, h[1]) - QMUL(q1, h[2]) + QMUL(q3, h[0]);
+    q[3] = q3 + QMUL(q0, h[2]) + QMUL(q1, h[1]) - QMUL(q2, h[0]);
+    /* Normalize: norm is close to 1, one Newton step of 1/sqrt(x) is enough */
+    norm = QMUL(q[0], q[0]) + QMUL(q[1], q[1]) + QMUL(q[2], q[2]) + QMUL(q[3], q[3]);
+    norm = (3 * MAHONY_Q30_ONE - norm) / 2;
+    for(i = 0; i < 4; i++){
+        q[i] = QMUL(q[i], norm);
+    }
+}
+
+void MahonyGetQuaternionQ30(int32_t q[4]){
+    uint8_t i;
+    for(i = 0; i < 4; i++){
+        q[i] = ahrs.q[i];
+    }
+}
+
+void MahonyGetQuaternion(float q[4]){
+    uint8_t i;
+    for(i = 0; i < 4; i++){
+        q[i] = ahrs.q[i] / Q30_FLOAT;
+    }
+}
+
+void MahonyGetEuler(float * roll, float * pitch, float * yaw){
+    float q[4];
+    float s;
+
+    MahonyGetQuaternion(q);
+    *roll = atan2f(2 * (q[0] * q[1] + q[2] * q[3]), 1 - 2 * (q[1] * q[1] + q[2] * q[2])) / RAD_PER_DEG;
+    s = 2 * (q[0] * q[2] - q[3] * q[1]);
+    s = s > 1 ? 1 : (s < -1 ? -1 : s);
+    *pitch = asinf(s) / RAD_PER_DEG;
+    *yaw = atan2f(2 * (q[0] * q[3] + q[1] * q[2]), 1 - 2 * (q[2] * q[2] + q[3] * q[3])) / RAD_PER_DEG;
+}
+/*==================[end of file]============================================*/
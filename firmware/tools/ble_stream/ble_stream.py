@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+Decoder of the BLE sample stream (drivers/microcontroller ble_stream.h).
+
+Each notification of characteristic 0xFFF1 is a block (little endian):
+ - seq (uint16), timestamp of the first sample in us (uint32), channels (uint8),
+   samples per channel (uint8).
+ - One coding nibble per channel (low nibble first): 0-11 bits per difference to the
+   previous sample (zigzag coded), 15: 12 bits samples.
+ - Bit stream (LSB first): per channel, first sample (12 bits) and the rest of them.
+
+Recordings store one notification per record: length (uint16, little endian) and packet.
+
+Usage:
+    ble_stream.py decode stream.bin [-o stream.csv]
+        Decode a recording to CSV (timestamp_us,ch0,ch1,...); lost blocks are reported.
+    ble_stream.py record DEVICE_NAME stream.bin [--rate 1000] [--time 10]
+        Start the stream and record it (requires bleak).
+    ble_stream.py test [--channels 4] [--rate 1000] [--payload 244] [--drop 0]
+        Build ble_stream.c on the host, encode synthetic biosignals and check the decoder.
+"""
+import argparse
+import asyncio
+import csv
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MCU = os.path.join(HERE, '..', '..', 'drivers', 'microcontroller')
+
+HEADER = struct.Struct('<HIBB')
+RAW = 0x0F
+SAMPLE_BITS = 12
+CMD_STOP, CMD_START, CMD_RATE = 0x00, 0x01, 0x02
+UUID_DATA = '0000fff1-0000-1000-8000-00805f9b34fb'
+UUID_CONTROL = '0000fff2-0000-1000-8000-00805f9b34fb'
+
+
+class BitReader:
+    def __init__(self, data):
+        self.value = int.from_bytes(data, 'little')
+        self.pos = 0
+
+    def get(self, bits):
+        v = (self.value >> self.pos) & ((1 << bits) - 1)
+        self.pos += bits
+        return v
+
+
+def decode(packet):
+    """Returns (seq, timestamp_us, samples) with samples[channel][n]."""
+    seq, timestamp, channels, block = HEADER.unpack_from(packet)
+    nibbles = (channels + 1) // 2
+    coding = [(packet[HEADER.size + ch // 2] >> ((ch & 1) * 4)) & 0x0F for ch in range(channels)]
+    bits = BitReader(packet[HEADER.size + nibbles:])
+    samples = []
+    for ch in range(channels):
+        s = [bits.get(SAMPLE_BITS)]
+        for _ in range(block - 1):
+            if coding[ch] == RAW:
+                s.append(bits.get(SAMPLE_BITS))
+            else:
+                zz = bits.get(coding[ch]) if coding[ch] else 0
+                s.append(s[-1] + ((zz >> 1) ^ -(zz & 1)))
+        samples.append(s)
+    return seq, timestamp, samples
+
+
+def read_recording(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    packets, i = [], 0
+    while i + 2 <= len(data):
+        n = data[i] | data[i + 1] << 8
+        packets.append(data[i + 2:i + 2 + n])
+        i += 2 + n
+    return packets
+
+
+def frames(packets, rate=None):
+    """Yields (seq, timestamp_us, frame) per frame and counts lost blocks (sequence gaps)."""
+    lost, last = 0, None
+    for p in packets:
+        seq, timestamp, samples = decode(p)
+        if last is not None:
+            lost += (seq - last - 1) & 0xFFFF
+        last = seq
+        block = len(samples[0])
+        for n in range(block):
+            t = timestamp + (n * 1000000 // rate if rate else 0)
+            yield seq, t, [s[n] for s in samples]
+    frames.lost = lost
+
+
+def cmd_decode(args):
+    packets = read_recording(args.recording)
+    out = open(args.output, 'w', newline='') if args.output else sys.stdout
+    writer = csv.writer(out)
+    count = 0
+    for seq, t, frame in frames(packets, args.rate):
+        writer.writerow([t] + frame)
+        count += 1
+    if args.output:
+        out.close()
+    print('%d blocks, %d frames, %d blocks lost' % (len(packets), count, frames.lost), file=sys.stderr)
+
+
+def cmd_record(args):
+    from bleak import BleakClient, BleakScanner
+
+    async def run():
+        device = await BleakScanner.find_device_by_name(args.device)
+        if device is None:
+            sys.exit('%s not found' % args.device)
+        with open(args.recording, 'wb') as f:
+            async with BleakClient(device) as client:
+                def store(_, data):
+                    f.write(struct.pack('<H', len(data)) + bytes(data))
+                await client.start_notify(UUID_DATA, store)
+                await client.write_gatt_char(UUID_CONTROL, struct.pack('<BH', CMD_START, args.rate))
+                await asyncio.sleep(args.time)
+                await client.write_gatt_char(UUID_CONTROL, bytes([CMD_STOP]))
+                await client.stop_notify(UUID_DATA)
+    asyncio.run(run())
+
+
+def build(out):
+    exe = os.path.join(out, 'ble_stream_rec')
+    subprocess.run(['cc', '-O2', '-Wall', '-I' + os.path.join(HERE, 'host'), '-I' + os.path.join(MCU, 'inc'),
+                    os.path.join(HERE, 'ble_stream_rec.c'), os.path.join(MCU, 'src', 'ble_stream.c'),
+                    '-lm', '-o', exe], check=True)
+    return exe
+
+
+def cmd_test(args):
+    with tempfile.TemporaryDirectory() as out:
+        rec, ref = os.path.join(out, 'stream.bin'), os.path.join(out, 'stream.csv')
+        subprocess.run([build(out), rec, '--ref', ref, '--channels', str(args.channels), '--rate', str(args.rate),
+                        '--payload', str(args.payload), '--drop', str(args.drop)], check=True)
+        packets = read_recording(rec)
+        with open(ref) as f:
+            reference = [[int(v) for v in line.split(',')] for line in f]
+    if not packets:
+        print('%d channels, %d bytes payload: no packets (stream not started or all dropped)' %
+              (args.channels, args.payload))
+        return 1
+    errors = count = 0
+    block = len(decode(packets[0])[2][0])
+    for seq, t, frame in frames(packets, args.rate):
+        k = seq * block + count % block
+        errors += frame != reference[k]
+        count += 1
+        if t != k * 1000000 // args.rate:
+            errors += 1
+    raw = count * args.channels * SAMPLE_BITS / 8
+    size = sum(len(p) for p in packets)
+    print('%d channels, %d samples per block, %d blocks (%d lost), %d frames, %d errors' %
+          (args.channels, block, len(packets), frames.lost, count, errors))
+    print('%.2f bytes/frame (12 bits packed: %.2f, 16 bits: %d), %.1f%% of packed size' %
+          (size / count, raw / count, 2 * args.channels, 100 * size / raw))
+    print('%.0f bytes/s at %d Hz' % (size / count * args.rate, args.rate))
+    return 1 if errors or (args.drop == 0 and frames.lost) else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('decode')
+    p.add_argument('recording')
+    p.add_argument('-o', '--output')
+    p.add_argument('--rate', type=int, help='sample rate, to timestamp every frame')
+    p = sub.add_parser('record')
+    p.add_argument('device')
+    p.add_argument('recording')
+    p.add_argument('--rate', type=int, default=1000)
+    p.add_argument('--time', type=float, default=10)
+    p = sub.add_parser('test')
+    p.add_argument('--channels', type=int, default=4)
+    p.add_argument('--rate', type=int, default=1000)
+    p.add_argument('--payload', type=int, default=244)
+    p.add_argument('--drop', type=int, default=0)
+    args = parser.parse_args()
+    return {'decode': cmd_decode, 'record': cmd_record, 'test': cmd_test}[args.command](args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
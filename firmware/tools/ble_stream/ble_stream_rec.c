@@ -0,0 +1,115 @@
+/**
+ * @file ble_stream_rec.c
+ * @brief Host recording of the BLE sample stream (ble_stream.c)
+ *
+ * Runs ble_stream.c over synthetic biosignals and writes every notification to a
+ * recording, as the host would receive them, plus the original samples to check the
+ * decoder. Built and run by ble_stream.py (test).
+ *
+ * Recording: one record per notification, length (uint16_t, little endian) and packet.
+ * Reference: CSV, one line per frame, one column per channel.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ble_mcu.h"
+#include "ble_stream.h"
+
+static FILE *rec;
+static read_func control;
+static int64_t now_us;
+static uint16_t payload = 244;
+static int drop = 0;            /* drop every n-th packet (link losses), 0: none */
+static int packets = 0;
+
+/* ble_mcu.c replacements */
+uint16_t BleMaxPayload(void){
+    return payload;
+}
+
+void BleStreamControl(read_func func_p){
+    control = func_p;
+}
+
+bool BleStreamNotify(const uint8_t *packet, uint16_t length){
+    uint8_t len[2] = {length & 0xFF, length >> 8};
+
+    packets++;
+    if(length > payload || (drop && packets % drop == 0)){
+        return false;
+    }
+    fwrite(len, 1, 2, rec);
+    fwrite(packet, 1, length, rec);
+    return true;
+}
+
+int64_t esp_timer_get_time(void){
+    return now_us;
+}
+
+static float gauss(void){
+    float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+    return sqrtf(-2 * logf(u1)) * cosf(2 * M_PI * u2);
+}
+
+static uint16_t adc(float x){
+    long v = lrintf(x);
+    return v > 4095 ? 4095 : (v < 0 ? 0 : v);
+}
+
+/* ECG like pulses, breathing, muscle bursts and a quiet channel (12 bits ADC counts) */
+static void synthetic(float t, uint16_t *frame, int channels){
+    float beat = fmodf(t, 0.8f);
+    float ecg = 900 * expf(-powf((beat - 0.2f) / 0.012f, 2)) + 120 * expf(-powf((beat - 0.45f) / 0.05f, 2));
+    float burst = fmodf(t, 3.0f) < 1.0f ? 300 : 20;
+    float ch[4] = {
+        1500 + ecg + 3 * gauss(),
+        2048 + 600 * sinf(2 * M_PI * 0.25f * t) + 2 * gauss(),
+        2048 + burst * gauss(),
+        1000 + gauss(),
+    };
+    for(int i = 0; i < channels; i++){
+        frame[i] = adc(ch[i % 4]);
+    }
+}
+
+int main(int argc, char **argv){
+    int channels = 4, rate = 1000;
+    float duration = 10;
+    const char *rec_path = "stream.bin", *ref_path = "stream.csv";
+
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "--channels") && i + 1 < argc) channels = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--rate") && i + 1 < argc) rate = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--duration") && i + 1 < argc) duration = atof(argv[++i]);
+        else if(!strcmp(argv[i], "--payload") && i + 1 < argc) payload = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--drop") && i + 1 < argc) drop = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--ref") && i + 1 < argc) ref_path = argv[++i];
+        else rec_path = argv[i];
+    }
+    rec = fopen(rec_path, "wb");
+    FILE *ref = fopen(ref_path, "w");
+    if(rec == NULL || ref == NULL){
+        perror("open");
+        return 1;
+    }
+    srand(1);
+    BleStreamInit(channels, rate, NULL);
+    /* Host writes BLE_STREAM_CMD_START with the rate to the control characteristic */
+    uint8_t cmd[3] = {BLE_STREAM_CMD_START, rate & 0xFF, rate >> 8};
+    control(cmd, sizeof(cmd));
+    for(long k = 0; k < duration * rate; k++){
+        uint16_t frame[BLE_STREAM_MAX_CHANNELS];
+        now_us = k * 1000000LL / rate;
+        synthetic((float)k / rate, frame, channels);
+        BleStreamPush(frame);
+        for(int i = 0; i < channels; i++){
+            fprintf(ref, i ? ",%d" : "%d", frame[i]);
+        }
+        fputc('\n', ref);
+    }
+    fclose(rec);
+    fclose(ref);
+    return 0;
+}
@@ -0,0 +1,4 @@
+/* Host build of ble_stream.c (tools/ble_stream) */
+#pragma once
+#include <stdint.h>
+int64_t esp_timer_get_time(void);
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+Create anti-aliased fonts (FONT_AA4) for the ILI9341 driver from the 1 bit per pixel
+fonts in fonts.c.
+
+A big font is scaled down by an integer factor with a box filter: the coverage of each
+output pixel (0 to 15) is the number of pixels set in its factor x factor block. Each
+glyph is stored row by row, 4 bits per pixel (high nibble first), rows padded to a whole
+byte.
+
+Usage:
+    font_aa.py ../drivers/devices/src/fonts.c ../drivers/devices/src/fonts_aa.c 59:2 89:2
+creates font_30_aa (from font_59) and font_45_aa (from font_89).
+"""
+import argparse
+import re
+
+from font_rle import data_array, info_array
+
+
+def glyph_bits(data, offset, width, height):
+    bytes_row = (width + 7) // 8
+    return [[(data[offset + r * bytes_row + j // 8] >> (7 - j % 8)) & 1 for j in range(width)]
+            for r in range(height)]
+
+
+def scale_glyph(bits, factor):
+    height, width = len(bits), len(bits[0]) if bits else 0
+    out_h, out_w = -(-height // factor), -(-width // factor)
+    rows = []
+    for r in range(out_h):
+        row = []
+        for c in range(out_w):
+            count = sum(bits[y][x] for y in range(r * factor, min((r + 1) * factor, height))
+                        for x in range(c * factor, min((c + 1) * factor, width)))
+            row.append((count * 15 + factor * factor // 2) // (factor * factor))
+        rows.append(row)
+    return rows
+
+
+def pack_glyph(rows):
+    out = bytearray()
+    for row in rows:
+        if len(row) % 2:
+            row = row + [0]
+        out += bytes((row[k] << 4) | row[k + 1] for k in range(0, len(row), 2))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='fonts.c')
+    parser.add_argument('output', help='C source file to create')
+    parser.add_argument('fonts', nargs='+', help='height:factor of each font to convert')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        src = f.read()
+    fonts = []
+    for spec in args.fonts:
+        height, factor = (int(v) for v in spec.split(':'))
+        data = data_array(src, 'font%d_data' % height)
+        info = info_array(src, 'font%d_info' % height)
+        out_height = -(-height // factor)
+        aa, aa_info = bytearray(), []
+        for width, offset in info:
+            rows = scale_glyph(glyph_bits(data, offset, width, height), factor)
+            aa_info.append((-(-width // factor), len(aa)))
+            aa += pack_glyph(rows)
+        fonts.append((out_height, height, aa, aa_info))
+
+    with open(args.output, 'w') as out:
+        out.write('/**\n * @file %s\n * @brief Anti-aliased fonts (4 bits per pixel). Created with tools/font_aa.py\n */\n\n'
+                  % args.output.split('/')[-1])
+        out.write('/*==================[inclusions]=============================================*/\n#include "fonts.h"\n')
+        out.write('/*==================[internal data definition]===============================*/\n')
+        for height, source, aa, aa_info in fonts:
+            out.write('/**\n * @brief %d pixels height anti-aliased data array (from %d pixels font).\n */\n'
+                      % (height, source))
+            out.write('const uint8_t font%d_aa_data[] = {\n' % height)
+            for k in range(0, len(aa), 16):
+                out.write('\t' + ', '.join('0x%02X' % b for b in aa[k:k + 16]) + ',\n')
+            out.write('};\n\n')
+            out.write('char_info_t font%d_aa_info[] = {\n' % height)
+            for k, (width, offset) in enumerate(aa_info):
+                out.write('\t{%d, %d}, \t\t/* %s */ \n' % (width, offset, chr(ord(' ') + k)))
+            out.write('};\n\n')
+        out.write('/*==================[external data definition]===============================*/\n\n')
+        for height, _, _, _ in fonts:
+            out.write('Font_t font_%d_aa = {\n\t%d,\n\tfont%d_aa_info,\n\tfont%d_aa_data,\n\tFONT_AA4\n};\n\n'
+                      % (height, height, height, height))
+        out.write('/*==================[end of file]============================================*/\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+Convert the 1 bit per pixel fonts (fonts.c) and icons (icons.c) to the run-length
+compressed format (FONT_RLE) drawn by the ILI9341 driver.
+
+Each glyph is stored row by row. A row starts with a header byte:
+ - bits 0-6: number of run lengths (nibbles) of the row.
+ - bit 7: the row is repeated, next byte is the number of extra repetitions.
+Then run lengths follow, 4 bits each (high nibble first), alternating background and
+foreground pixels and starting with background. Runs longer than 15 pixels are split
+with an empty run of the other color (15, 0, ...).
+
+Only fonts and icons that get smaller are converted (small fonts have short runs and
+are better stored as bitmaps).
+
+Usage:
+    font_rle.py ../drivers/devices/src/fonts.c ../drivers/devices/src/fonts_rle.c
+    font_rle.py ../drivers/devices/src/icons.c ../drivers/devices/src/icons_rle.c --icons
+"""
+import argparse
+import io
+import re
+import sys
+
+
+def c_array(src, pattern):
+    m = re.search(pattern + r'\[\] = \{(.*?)\n\};', src, re.S)
+    body = '\n'.join(line.split('//')[0] for line in m.group(1).split('\n'))
+    return re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+
+
+def data_array(src, name):
+    return [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', c_array(src, r'const uint8_t ' + name))]
+
+
+def info_array(src, name):
+    return [(int(w), int(o)) for w, o in re.findall(r'\{\s*(\d+)\s*,\s*(\d+)\s*\}', c_array(src, r'char_info_t ' + name))]
+
+
+def rows_of(data, offset, width, height):
+    """Run lengths of each row, starting with background"""
+    bytes_row = (width + 7) // 8
+    rows = []
+    for r in range(height):
+        runs, color, count = [], 0, 0
+        for j in range(width):
+            bit = (data[offset + r * bytes_row + j // 8] >> (7 - j % 8)) & 1
+            if bit == color:
+                count += 1
+            else:
+                runs.append(count)
+                color, count = bit, 1
+        runs.append(count)
+        rows.append(runs)
+    return rows
+
+
+def encode_glyph(rows):
+    out = bytearray()
+    i = 0
+    while i < len(rows):
+        j = i + 1
+        while j < len(rows) and rows[j] == rows[i] and j - i <= 255:
+            j += 1
+        nibbles = []
+        for run in rows[i]:
+            while run > 15:
+                nibbles += [15, 0]
+                run -= 15
+            nibbles.append(run)
+        if len(nibbles) > 127:
+            raise ValueError('row too complex')
+        if len(nibbles) % 2:
+            nibbles.append(0)
+            count = len(nibbles) - 1
+        else:
+            count = len(nibbles)
+        if j - i > 1:
+            out += bytes((0x80 | count, j - i - 1))
+        else:
+            out.append(count)
+        out += bytes((nibbles[k] << 4) | nibbles[k + 1] for k in range(0, len(nibbles), 2))
+        i = j
+    return out
+
+
+def decode_glyph(data, width, height):
+    rows, i = [], 0
+    while len(rows) < height:
+        header = data[i]
+        i += 1
+        repeat = 1
+        if header & 0x80:
+            repeat += data[i]
+            i += 1
+        count = header & 0x7F
+        nibbles = []
+        for k in range((count + 1) // 2):
+            nibbles += [data[i + k] >> 4, data[i + k] & 0x0F]
+        i += (count + 1) // 2
+        bits, color = [], 0
+        for run in nibbles[:count]:
+            bits += [color] * run
+            color ^= 1
+        assert len(bits) == width
+        rows += [bits] * repeat
+    return rows
+
+
+def write_array(f, ctype, name, data):
+    f.write('const %s %s[] = {\n' % (ctype, name))
+    for k in range(0, len(data), 16):
+        f.write('\t' + ', '.join('0x%02X' % b for b in data[k:k + 16]) + ',\n')
+    f.write('};\n\n')
+
+
+def convert_fonts(src, out):
+    fonts = []
+    heights = sorted(int(h) for h in re.findall(r'const uint8_t font(\d+)_data', src))
+    if not heights:
+        sys.exit('no font data found')
+    for height in heights:
+        data = data_array(src, 'font%d_data' % height)
+        info = info_array(src, 'font%d_info' % height)
+        rle, rle_info = bytearray(), []
+        for width, offset in info:
+            glyph = rows_of(data, offset, width, height)
+            encoded = encode_glyph(glyph)
+            assert [sum(([c % 2] * r for c, r in enumerate(row)), []) for row in glyph] == decode_glyph(encoded, width, height)
+            rle_info.append((width, len(rle)))
+            rle += encoded
+        print('font_%d: %d -> %d bytes' % (height, len(data), len(rle)), file=sys.stderr)
+        if len(rle) < len(data):
+            fonts.append((height, rle, rle_info))
+
+    out.write('/*==================[inclusions]=============================================*/\n#include "fonts.h"\n')
+    out.write('/*==================[internal data definition]===============================*/\n')
+    for height, rle, rle_info in fonts:
+        out.write('/**\n * @brief %d pixels height run-length compressed data array.\n */\n' % height)
+        write_array(out, 'uint8_t', 'font%d_rle_data' % height, rle)
+        out.write('char_info_t font%d_rle_info[] = {\n' % height)
+        for k, (width, offset) in enumerate(rle_info):
+            out.write('\t{%d, %d}, \t\t/* %s */ \n' % (width, offset, chr(ord(' ') + k)))
+        out.write('};\n\n')
+    out.write('/*==================[external data definition]===============================*/\n\n')
+    for height, _, _ in fonts:
+        out.write('Font_t font_%d_rle = {\n\t%d,\n\tfont%d_rle_info,\n\tfont%d_rle_data,\n\tFONT_RLE\n};\n\n'
+                  % (height, height, height, height))
+    out.write('/*==================[end of file]============================================*/\n')
+
+
+def convert_icons(src, out):
+    icons, found = [], 0
+    for height, width, offset, name in re.findall(
+            r'icon_font_t icon_\d+ = \{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\w+)\s*(?:,[^}]*)?\}', src):
+        found += 1
+        height, width, offset = int(height), int(width), int(offset)
+        data = data_array(src, name)
+        rle, offsets = bytearray(), []
+        for icon in range(len(data) // offset):
+            offsets.append(len(rle))
+            rle += encode_glyph(rows_of(data, icon * offset, width, height))
+        print('icon_%d: %d -> %d bytes' % (height, len(data), len(rle) + 2 * len(offsets)), file=sys.stderr)
+        if len(rle) + 2 * len(offsets) < len(data):
+            icons.append((height, width, rle, offsets))
+    if not found:
+        sys.exit('no icon_font_t found')
+
+    out.write('/*==================[inclusions]=============================================*/\n#include "icons.h"\n')
+    out.write('/*==================[internal data definition]===============================*/\n')
+    for height, width, rle, offsets in icons:
+        out.write('/**\n * @brief %dx%d pixels run-length compressed icons array.\n */\n' % (height, width))
+        write_array(out, 'uint8_t', 'icon%d_rle_data' % height, rle)
+        out.write('const uint16_t icon%d_rle_offsets[] = {\n' % height)
+        for k in range(0, len(offsets), 12):
+            out.write('\t' + ', '.join('%d' % o for o in offsets[k:k + 12]) + ',\n')
+        out.write('};\n\n')
+    out.write('/*==================[external data definition]===============================*/\n\n')
+    for height, width, _, _ in icons:
+        out.write('icon_font_t icon_%d_rle = {\n\t%d,\n\t%d,\n\t0,\n\ticon%d_rle_data,\n\tFONT_RLE,\n\ticon%d_rle_offsets\n};\n\n'
+                  % (height, height, width, height, height))
+    out.write('/*==================[end of file]============================================*/\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='fonts.c or icons.c')
+    parser.add_argument('output', help='C source file to create')
+    parser.add_argument('--icons', action='store_true', help='input is icons.c')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        src = f.read()
+    # Written to the file only if the conversion succeeds
+    out = io.StringIO()
+    out.write('/**\n * @file %s\n * @brief Run-length compressed version of %s. Created with tools/font_rle.py\n */\n\n'
+              % (args.output.split('/')[-1], args.input.split('/')[-1]))
+    if args.icons:
+        convert_icons(src, out)
+    else:
+        convert_fonts(src, out)
+    with open(args.output, 'w') as f:
+        f.write(out.getvalue())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Convert a picture to the run-length compressed format drawn by ILI9341DrawRleImage.
+
+Input can be an image file (PNG, BMP, JPG... requires Pillow: pip install pillow) or a
+C source file with a RGB565 uint8_t array (2 bytes/pixel, high byte first) as the ones
+used with ILI9341DrawPicture. Output is a C source file with an ili9341_rle_image_t.
+
+Pixels are stored as 1 byte indexes to a palette of up to 256 RGB565 colors. Pictures
+with more colors are reduced to the most used ones (each pixel takes the nearest
+color), use --colors 0 to keep 2 bytes RGB565 pixels instead (no palette, lossless).
+
+Compressed format: a sequence of packets, each one starting with a header byte.
+ - header & 0x80 != 0: run, the next pixel is repeated (header & 0x7F) + 1 times.
+ - header & 0x80 == 0: literal, the next header + 1 pixels are copied as is.
+
+Usage:
+    image_rle.py logo.png logo_rle.c --name logo
+    image_rle.py esp_edu_pic.c esp_edu_pic_rle.c --name esp_edu_pic --width 240 --height 320
+"""
+import argparse
+import re
+import sys
+from collections import Counter
+
+MAX_PACKET = 128
+
+
+def read_c_array(path):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    values = [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]{1,2}\b', body)]
+    return [(values[i] << 8) | values[i + 1] for i in range(0, len(values) - 1, 2)]
+
+
+def read_image(path):
+    from PIL import Image
+    img = Image.open(path).convert('RGB')
+    pixels = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in img.getdata()]
+    return img.width, img.height, pixels
+
+
+def rgb(color):
+    return (color >> 11) << 3, ((color >> 5) & 0x3F) << 2, (color & 0x1F) << 3
+
+
+def make_palette(pixels, colors):
+    """Most used colors, and the index of the nearest one for each pixel"""
+    palette = [c for c, _ in Counter(pixels).most_common(colors)]
+    nearest = {c: i for i, c in enumerate(palette)}
+    for c in set(pixels) - set(nearest):
+        r, g, b = rgb(c)
+        nearest[c] = min(range(len(palette)),
+                         key=lambda i: sum((x - y) ** 2 for x, y in zip(rgb(palette[i]), (r, g, b))))
+    return palette, [nearest[c] for c in pixels]
+
+
+def pack(symbol, size):
+    return bytes((symbol >> 8, symbol & 0xFF)) if size == 2 else bytes((symbol,))
+
+
+def encode(pixels, size):
+    """RLE of a list of symbols of size bytes (1: palette index, 2: RGB565)"""
+    out = bytearray()
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+        if run > 1:
+            out.append(0x80 | (run - 1))
+            out += pack(pixels[i], size)
+            i += run
+            continue
+        # Literal packet: up to the next pair of equal pixels
+        start = i
+        while i < n and i - start < MAX_PACKET:
+            if i + 1 < n and pixels[i + 1] == pixels[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        for p in pixels[start:i]:
+            out += pack(p, size)
+    return out
+
+
+def decode(data, size):
+    pixels = []
+    i = 0
+    unpack = (lambda k: (data[k] << 8) | data[k + 1]) if size == 2 else (lambda k: data[k])
+    while i < len(data):
+        header = data[i]
+        if header & 0x80:
+            pixels += [unpack(i + 1)] * ((header & 0x7F) + 1)
+            i += 1 + size
+        else:
+            count = header + 1
+            pixels += [unpack(i + 1 + size * k) for k in range(count)]
+            i += 1 + size * count
+    return pixels
+
+
+def write_c(path, name, width, height, palette, data):
+    size = len(data) + 2 * len(palette)
+    with open(path, 'w') as f:
+        f.write('#include <stddef.h>\n#include <stdint.h>\n#include "ili9341.h"\n\n')
+        f.write('/* %dx%d pixels, %d colors, %d bytes (%d bytes uncompressed). Created with tools/image_rle.py */\n'
+                % (width, height, len(palette), size, width * height * 2))
+        if palette:
+            f.write('const uint16_t %s_palette[] = {\n' % name)
+            for k in range(0, len(palette), 12):
+                f.write(' ' + ','.join('0x%04x' % c for c in palette[k:k + 12]) + ',\n')
+            f.write('};\n\n')
+        f.write('const uint8_t %s_data[] = {\n' % name)
+        for k in range(0, len(data), 30):
+            f.write(' ' + ','.join('0x%02x' % b for b in data[k:k + 30]) + ',\n')
+        f.write('};\n\n')
+        f.write('const ili9341_rle_image_t %s = {\n\t%d,\n\t%d,\n\t%s,\n\tsizeof(%s_data),\n\t%s_data\n};\n'
+                % (name, width, height, name + '_palette' if palette else 'NULL', name, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='image file or C source with a RGB565 array')
+    parser.add_argument('output', help='C source file to create')
+    parser.add_argument('--name', required=True, help='name of the ili9341_rle_image_t variable')
+    parser.add_argument('--width', type=int, help='picture width (C source input only)')
+    parser.add_argument('--height', type=int, help='picture height (C source input only)')
+    parser.add_argument('--colors', type=int, default=256,
+                        help='palette size (up to 256), 0 for RGB565 pixels without palette')
+    args = parser.parse_args()
+
+    if args.input.endswith(('.c', '.h')):
+        if args.width is None or args.height is None:
+            parser.error('--width and --height are required for C source input')
+        width, height = args.width, args.height
+        pixels = read_c_array(args.input)
+        if len(pixels) != width * height:
+            parser.error('array has %d pixels, expected %d' % (len(pixels), width * height))
+    else:
+        width, height, pixels = read_image(args.input)
+
+    if not 0 <= args.colors <= 256:
+        parser.error('--colors must be between 0 and 256')
+    if args.colors:
+        palette, symbols = make_palette(pixels, args.colors)
+        if len(set(pixels)) > args.colors:
+            print('warning: %d colors reduced to %d' % (len(set(pixels)), args.colors), file=sys.stderr)
+        size = 1
+    else:
+        palette, symbols, size = [], pixels, 2
+
+    data = encode(symbols, size)
+    assert decode(data, size) == symbols
+    write_c(args.output, args.name, width, height, palette, data)
+    total = len(data) + 2 * len(palette)
+    print('%dx%d: %d -> %d bytes (%.1fx)' % (width, height, width * height * 2, total,
+                                            width * height * 2 / total), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
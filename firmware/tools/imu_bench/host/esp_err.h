@@ -0,0 +1,7 @@
+/* Host build of esp-dsp (tools/imu_bench) */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+typedef int esp_err_t;
+#define ESP_OK      0
+#define ESP_FAIL    -1
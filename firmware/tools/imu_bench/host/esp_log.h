@@ -0,0 +1,7 @@
+/* Host build of esp-dsp (tools/imu_bench) */
+#pragma once
+#include <stdio.h>
+#define ESP_LOGD(tag, ...)  ((void)0)
+#define ESP_LOGI(tag, ...)  ((void)0)
+#define ESP_LOGW(tag, ...)  ((void)0)
+#define ESP_LOGE(tag, ...)  ((void)0)
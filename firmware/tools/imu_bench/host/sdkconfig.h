@@ -0,0 +1 @@
+/* Host build of esp-dsp (tools/imu_bench): no target options, ANSI C implementations only */
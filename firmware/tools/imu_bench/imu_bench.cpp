@@ -0,0 +1,206 @@
+/**
+ * @file imu_bench.cpp
+ * @brief Host benchmark of the fixed point Mahony filter against the esp-dsp EKF
+ *
+ * Runs mahony_filter.c and ekf_imu13states (as used by imu_fusion.cpp) over the same 
+ * MPU6050 samples and reports time per sample and tilt (roll/pitch) differences.
+ * Built and run by imu_bench.py.
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "ekf_imu13states.h"
+extern "C" {
+#include "mahony_filter.h"
+}
+
+#define RAD_PER_DEG     0.01745329252f
+#define SETTLE_TIME     2.0f        /* s, not included in the statistics */
+
+struct sample_t {
+    int16_t raw[6];                 /* ax, ay, az, gx, gy, gz */
+    float g[3];                     /* reference gravity direction in sensor frame, synthetic data only */
+};
+
+struct stats_t {
+    double sum2 = 0, max = 0;
+    int n = 0;
+    void add(float d){
+        d = fabsf(d);
+        sum2 += d * d;
+        max = d > max ? d : max;
+        n++;
+    }
+    double rms() const { return n ? sqrt(sum2 / n) : 0; }
+};
+
+/* Gravity direction in sensor frame for orientation q (w, x, y, z) */
+static void gravity(const float q[4], float g[3]){
+    g[0] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    g[1] = 2 * (q[0] * q[1] + q[2] * q[3]);
+    g[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+/* Tilt error: angle between two gravity directions (degrees), independent of yaw */
+static float tilt(const float a[3], const float b[3]){
+    float c = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) /
+        sqrtf((a[0] * a[0] + a[1] * a[1] + a[2] * a[2]) * (b[0] * b[0] + b[1] * b[1] + b[2] * b[2]));
+    return acosf(c > 1 ? 1 : (c < -1 ? -1 : c)) / RAD_PER_DEG;
+}
+
+static float gauss(){
+    float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+    return sqrtf(-2 * logf(u1)) * cosf(2 * M_PI * u2);
+}
+
+static int16_t saturate(float x){
+    return x > 32767 ? 32767 : (x < -32768 ? -32768 : (int16_t)lrintf(x));
+}
+
+/* Smooth rotation with gyroscope bias and noise, and noisy accelerometer (2 g range) */
+static std::vector<sample_t> synthetic(int rate, int gyro_range, float duration){
+    std::vector<sample_t> data;
+    const float bias[3] = {0.01f, -0.02f, 0.015f};
+    double q[4] = {1, 0, 0, 0};
+    float dt = 1.0f / rate, lsb_dps = 32768.0f / gyro_range;
+
+    srand(1);
+    for(int k = 0; k < duration * rate; k++){
+        float t = k * dt;
+        float w[3] = {1.0f * sinf(2 * M_PI * 0.2f * t), 0.7f * sinf(2 * M_PI * 0.13f * t + 1), 0.5f * sinf(2 * M_PI * 0.07f * t)};
+        sample_t s;
+        float qf[4] = {(float)q[0], (float)q[1], (float)q[2], (float)q[3]};
+        gravity(qf, s.g);
+        for(int i = 0; i < 3; i++){
+            s.raw[i] = saturate((s.g[i] + 0.01f * gauss()) * 16384);
+            s.raw[3 + i] = saturate(((w[i] + bias[i]) / RAD_PER_DEG + 0.05f * gauss()) * lsb_dps);
+        }
+        data.push_back(s);
+        /* Exact rotation over dt */
+        double angle = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]) * dt;
+        if(angle > 0){
+            double c = cos(angle / 2), sn = sin(angle / 2) / (angle / dt);
+            double r[4] = {c, w[0] * sn, w[1] * sn, w[2] * sn};
+            double p[4] = {q[0] * r[0] - q[1] * r[1] - q[2] * r[2] - q[3] * r[3],
+                           q[0] * r[1] + q[1] * r[0] + q[2] * r[3] - q[3] * r[2],
+                           q[0] * r[2] - q[1] * r[3] + q[2] * r[0] + q[3] * r[1],
+                           q[0] * r[3] + q[1] * r[2] - q[2] * r[1] + q[3] * r[0]};
+            memcpy(q, p, sizeof(q));
+        }
+    }
+    return data;
+}
+
+/* CSV with raw MPU6050_getMotion6 values: ax,ay,az,gx,gy,gz (extra leading columns, e.g. timestamp, are skipped) */
+static std::vector<sample_t> load(const char *path){
+    std::vector<sample_t> data;
+    char line[256];
+    FILE *f = fopen(path, "r");
+
+    if(f == NULL){
+        perror(path);
+        exit(1);
+    }
+    while(fgets(line, sizeof(line), f)){
+        long v[16];
+        int n = 0;
+        char *p = line, *end;
+        while(n < 16){
+            v[n] = strtol(p, &end, 10);
+            if(end == p){
+                break;
+            }
+            n++;
+            p = end + strspn(end, ", \t;");
+        }
+        if(n < 6){
+            continue;       /* header */
+        }
+        sample_t s;
+        for(int i = 0; i < 6; i++){
+            s.raw[i] = v[n - 6 + i];
+        }
+        s.g[0] = s.g[1] = s.g[2] = NAN;
+        data.push_back(s);
+    }
+    fclose(f);
+    return data;
+}
+
+int main(int argc, char **argv){
+    int rate = 500, gyro_range = 500;
+    float kp = 2.0f, ki = 0.1f, duration = 60;
+    const char *path = NULL;
+
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "--rate") && i + 1 < argc) rate = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--gyro-range") && i + 1 < argc) gyro_range = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--kp") && i + 1 < argc) kp = atof(argv[++i]);
+        else if(!strcmp(argv[i], "--ki") && i + 1 < argc) ki = atof(argv[++i]);
+        else if(!strcmp(argv[i], "--duration") && i + 1 < argc) duration = atof(argv[++i]);
+        else path = argv[i];
+    }
+    std::vector<sample_t> data = path ? load(path) : synthetic(rate, gyro_range, duration);
+    size_t n = data.size();
+    std::vector<float> m_g(3 * n), e_g(3 * n);
+    float dt = 1.0f / rate, gyro_scale = gyro_range / 32768.0f * RAD_PER_DEG;
+
+    /* Mahony */
+    MahonyInit(rate, gyro_range, kp, ki);
+    double m_time = 0;
+    for(size_t k = 0; k < n; k++){
+        const int16_t *r = data[k].raw;
+        auto t0 = std::chrono::steady_clock::now();
+        MahonyUpdate(r[0], r[1], r[2], r[3], r[4], r[5]);
+        m_time += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        float q[4];
+        MahonyGetQuaternion(q);
+        gravity(q, &m_g[3 * k]);
+    }
+
+    /* EKF, same measurement setup as imu_fusion.cpp */
+    ekf_imu13states *ekf13 = new ekf_imu13states();
+    ekf13->Init();
+    float R[6] = {1000, 1000, 1000, 0.01f, 0.01f, 0.01f};
+    double e_time = 0;
+    for(size_t k = 0; k < n; k++){
+        const int16_t *r = data[k].raw;
+        float gyro[3], accel[3], magn[3];
+        auto t0 = std::chrono::steady_clock::now();
+        float norm = sqrtf((float)r[0] * r[0] + (float)r[1] * r[1] + (float)r[2] * r[2]);
+        for(int i = 0; i < 3; i++){
+            gyro[i] = r[3 + i] * gyro_scale;
+        }
+        ekf13->Process(gyro, dt);
+        dspm::Mat magn_ampl(&ekf13->X.data[7], 3, 1);
+        dspm::Mat magn_offset(&ekf13->X.data[10], 3, 1);
+        dspm::Mat expected = ekf::quat2rotm(ekf13->X.data).t() * magn_ampl + magn_offset;
+        for(int i = 0; i < 3; i++){
+            accel[i] = r[i] / norm;
+            magn[i] = expected.data[i];
+        }
+        ekf13->UpdateRefMeasurement(accel, magn, R);
+        e_time += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        gravity(ekf13->X.data, &e_g[3 * k]);
+    }
+
+    stats_t diff, m_ref, e_ref;
+    for(size_t k = SETTLE_TIME * rate; k < n; k++){
+        diff.add(tilt(&m_g[3 * k], &e_g[3 * k]));
+        if(!std::isnan(data[k].g[0])){
+            m_ref.add(tilt(&m_g[3 * k], data[k].g));
+            e_ref.add(tilt(&e_g[3 * k], data[k].g));
+        }
+    }
+    printf("%zu samples at %d Hz (%s)\n", n, rate, path ? path : "synthetic");
+    printf("time per sample (host): Mahony %.0f ns, EKF %.0f ns (x%.0f)\n", m_time / n, e_time / n, e_time / m_time);
+    printf("tilt Mahony vs EKF: rms %.2f, max %.2f degrees\n", diff.rms(), diff.max);
+    if(m_ref.n){
+        printf("tilt error Mahony:  rms %.2f, max %.2f degrees\n", m_ref.rms(), m_ref.max);
+        printf("tilt error EKF:     rms %.2f, max %.2f degrees\n", e_ref.rms(), e_ref.max);
+    }
+    return 0;
+}
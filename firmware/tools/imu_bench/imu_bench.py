@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""
+Host benchmark and accuracy comparison of the fixed point Mahony filter (mahony_filter.c)
+against the esp-dsp 13 states EKF (ekf_imu13states, as used by imu_fusion.cpp).
+
+Builds imu_bench.cpp with the host compiler together with the ANSI C parts of esp-dsp
+and runs it. Without a recording, a synthetic motion with known orientation, gyroscope
+bias and sensor noise is generated and both filters are also compared to it.
+
+Recordings are CSV files with the raw MPU6050_getMotion6 values per line
+(ax,ay,az,gx,gy,gz; leading columns such as a timestamp are ignored).
+
+Times are measured on the host: they show the relative cost of both filters, not the
+time on the ESP32-C6.
+
+Usage:
+    imu_bench.py [recording.csv] [--rate 500] [--gyro-range 500] [--kp 2] [--ki 0.1]
+"""
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DSP = os.path.join(HERE, '..', '..', 'middelware', 'signal_processing')
+ESP_DSP = os.path.join(DSP, 'esp-dsp', 'modules')
+
+
+def sources():
+    c = [os.path.join(DSP, 'src', 'mahony_filter.c')]
+    for pattern in ('matrix/*/float/*_ansi.c', 'math/*/float/*_ansi.c', 'dotprod/float/*_ansi.c'):
+        c += glob.glob(os.path.join(ESP_DSP, pattern))
+    cpp = [os.path.join(HERE, 'imu_bench.cpp'),
+           os.path.join(ESP_DSP, 'matrix', 'mat', 'mat.cpp'),
+           os.path.join(ESP_DSP, 'kalman', 'ekf', 'common', 'ekf.cpp'),
+           os.path.join(ESP_DSP, 'kalman', 'ekf_imu13states', 'ekf_imu13states.cpp')]
+    return c, cpp
+
+
+def includes():
+    dirs = [os.path.join(HERE, 'host'), os.path.join(DSP, 'inc')]
+    dirs += [d for d in glob.glob(os.path.join(ESP_DSP, '**', 'include'), recursive=True) if '/test/' not in d]
+    return ['-I' + d for d in dirs]
+
+
+def build(out):
+    c, cpp = sources()
+    flags = ['-O2', '-w'] + includes()
+    objs = []
+    for src in c + cpp:
+        obj = os.path.join(out, '%d.o' % len(objs))
+        compiler = 'cc' if src.endswith('.c') else 'c++'
+        subprocess.run([compiler] + flags + ['-c', src, '-o', obj], check=True)
+        objs.append(obj)
+    exe = os.path.join(out, 'imu_bench')
+    subprocess.run(['c++'] + objs + ['-lm', '-o', exe], check=True)
+    return exe
+
+
+def main():
+    with tempfile.TemporaryDirectory() as out:
+        exe = build(out)
+        return subprocess.run([exe] + sys.argv[1:]).returncode
+
+
+if __name__ == '__main__':
+    sys.exit(main())
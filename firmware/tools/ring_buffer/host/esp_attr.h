@@ -0,0 +1,3 @@
+/* Host build of ring_buffer_mcu.c (ring_stress.py) */
+#pragma once
+#define IRAM_ATTR
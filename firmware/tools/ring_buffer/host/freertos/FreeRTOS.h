@@ -0,0 +1,8 @@
+/* Host build of ring_buffer_mcu.c (ring_stress.py) */
+#pragma once
+#include <stdint.h>
+typedef int BaseType_t;
+#define pdFALSE 0
+#define pdTRUE 1
+#define portYIELD_FROM_ISR(x) (void)(x)
+BaseType_t xPortInIsrContext(void);
@@ -0,0 +1,6 @@
+/* Host build of ring_buffer_mcu.c (ring_stress.py): notifications counted by ring_stress.c */
+#pragma once
+#include "FreeRTOS.h"
+typedef void *TaskHandle_t;
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
@@ -0,0 +1,260 @@
+/**
+ * @file ring_stress.c
+ * @brief Host stress test of the single producer, single consumer ring buffer (ring_buffer_mcu.c)
+ *
+ * - Model: random pushes and (partial, discarding) pops from one thread, checked against
+ *   a reference queue, with the free running counters starting just before they wrap.
+ * - Threshold: notifications are given once when threshold items are stored, again only
+ *   after a pop.
+ * - Threads: a producer thread (the ISR) and a consumer thread blocked until notified,
+ *   popping random block sizes. Order and integrity of every item are checked, and a
+ *   consumer left waiting with threshold items stored is reported as a missed notification.
+ *
+ * Built and run by ring_stress.py.
+ */
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ring_buffer_mcu.h"
+
+#define WRAP_START	0xFFFFFF00u		/* Free running counters wrap during the tests */
+#define ITEM_WORDS	3
+
+static sem_t notification;			/* Task notification of the consumer */
+static volatile int notifications = 0;
+static __thread int in_isr = 0;		/* Producer thread: pushes "from an ISR" */
+static int errors = 0;
+
+/* FreeRTOS replacements */
+BaseType_t xPortInIsrContext(void){
+	return in_isr;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken){
+	__atomic_add_fetch(&notifications, 1, __ATOMIC_SEQ_CST);
+	sem_post(&notification);
+	*woken = pdTRUE;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task){
+	__atomic_add_fetch(&notifications, 1, __ATOMIC_SEQ_CST);
+	sem_post(&notification);
+	return pdTRUE;
+}
+
+#define CHECK(cond, ...) do { if(!(cond)){ printf("  FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); errors++; return; } } while(0)
+
+static void ring_reset(ring_mcu_t *ring){
+	/* Counters close to overflow: index and count arithmetic must be right across it */
+	ring->head = WRAP_START;
+	ring->tail = WRAP_START;
+}
+
+/* Single thread, against a reference queue */
+static void test_model(uint32_t size, uint16_t item_size, uint32_t ops){
+	ring_mcu_t ring;
+	uint8_t *storage = malloc(size * item_size);
+	uint8_t *model = malloc(size * item_size);	/* Reference queue (linear) */
+	uint8_t *out = malloc((size + 3) * item_size);
+	uint8_t item[16];
+	uint32_t model_count = 0, dropped = 0, next = 0, i, k, n, max;
+
+	CHECK(RingInit(&ring, storage, item_size, size), "RingInit(%u)", size);
+	ring_reset(&ring);
+	for(i = 0; i < ops; i++){
+		if(rand() % 2){
+			n = rand() % (size + 2);
+			for(k = 0; k < n; k++){
+				memset(item, next * 31 + 7, item_size);
+				item[0] = next;
+				if(RingPush(&ring, item)){
+					CHECK(model_count < size, "push accepted with ring full");
+					memcpy(&model[model_count * item_size], item, item_size);
+					model_count++;
+				}else{
+					CHECK(model_count == size, "push refused with %u of %u items", model_count, size);
+					dropped++;
+				}
+				next++;
+			}
+		}else{
+			max = rand() % (size + 3);
+			if(rand() % 8 == 0){
+				n = RingPop(&ring, NULL, max);
+			}else{
+				n = RingPop(&ring, out, max);
+				CHECK(memcmp(out, model, n * item_size) == 0, "popped items differ (op %u)", i);
+			}
+			CHECK(n == (max < model_count ? max : model_count), "popped %u, expected %u", n,
+				max < model_count ? max : model_count);
+			memmove(model, &model[n * item_size], (model_count - n) * item_size);
+			model_count -= n;
+		}
+		CHECK(RingCount(&ring) == model_count, "count %u, expected %u", RingCount(&ring), model_count);
+		CHECK(ring.dropped == dropped, "dropped %u, expected %u", ring.dropped, dropped);
+	}
+	CHECK(ring.head - WRAP_START > 0x100, "counters didn't wrap");
+	printf("  model size %u, item %u bytes: %u ops, %u pushed, %u dropped\n", size, item_size, ops, next, dropped);
+	free(storage);
+	free(model);
+	free(out);
+}
+
+static int notes_taken(void){
+	int n = 0;
+	while(sem_trywait(&notification) == 0){
+		n++;
+	}
+	return n;
+}
+
+/* Notification threshold, single thread */
+static void test_threshold(void){
+	ring_mcu_t ring;
+	uint32_t storage[16], v = 0, i;
+
+	RingInit(&ring, storage, sizeof(uint32_t), 16);
+	ring_reset(&ring);
+	notes_taken();
+	RingNotify(&ring, (TaskHandle_t)1, 4);
+	for(i = 0; i < 3; i++){
+		RingPush(&ring, &v);
+	}
+	CHECK(notes_taken() == 0, "notified below threshold");
+	RingPush(&ring, &v);
+	CHECK(notes_taken() == 1, "not notified at threshold");
+	for(i = 0; i < 8; i++){
+		RingPush(&ring, &v);
+	}
+	CHECK(notes_taken() == 0, "notified again before a pop");
+	/* Partial pop: 10 left, the next push notifies again */
+	RingPop(&ring, NULL, 2);
+	RingPush(&ring, &v);
+	CHECK(notes_taken() == 1, "not notified after a partial pop");
+	RingPop(&ring, NULL, 16);
+	for(i = 0; i < 3; i++){
+		RingPush(&ring, &v);
+	}
+	CHECK(notes_taken() == 0, "notified below threshold after pop");
+	/* Threshold clamped to 1 .. size */
+	RingNotify(&ring, (TaskHandle_t)1, 0);
+	CHECK(ring.threshold == 1, "threshold 0 -> %u", ring.threshold);
+	RingNotify(&ring, (TaskHandle_t)1, 100);
+	CHECK(ring.threshold == 16, "threshold 100 -> %u", ring.threshold);
+	/* No task: no notification */
+	RingPop(&ring, NULL, 16);
+	RingNotify(&ring, NULL, 1);
+	RingPush(&ring, &v);
+	CHECK(notes_taken() == 0, "notified without task");
+	CHECK(!RingInit(&ring, storage, sizeof(uint32_t), 12), "RingInit accepted size 12");
+	printf("  threshold: ok\n");
+}
+
+static struct {
+	ring_mcu_t ring;
+	uint32_t items;
+	volatile int done;
+	volatile int abort;				/* Consumer failed: producer stops */
+} shared;
+
+static void *producer(void *arg){
+	uint32_t item[ITEM_WORDS], i = 0;
+
+	in_isr = 1;
+	while(i < shared.items && !shared.abort){
+		item[0] = i;
+		item[1] = ~i;
+		item[2] = i * 2654435761u;
+		if(RingPush(&shared.ring, item)){
+			i++;
+			/* Bursts and pauses */
+			if(rand() % 1024 == 0){
+				sched_yield();
+			}
+		}else{
+			sched_yield();
+		}
+	}
+	__atomic_store_n(&shared.done, 1, __ATOMIC_SEQ_CST);
+	sem_post(&notification);
+	return NULL;
+}
+
+/* Producer and consumer threads */
+static void test_threads(uint32_t size, uint32_t threshold, uint32_t items){
+	static uint32_t storage[1024][ITEM_WORDS];
+	uint32_t block[1024 + 3][ITEM_WORDS];
+	uint32_t expected = 0, n, k, max, wakes = 0;
+	struct timespec ts;
+	pthread_t thread;
+
+	RingInit(&shared.ring, storage, sizeof(storage[0]), size);
+	ring_reset(&shared.ring);
+	shared.items = items;
+	shared.done = 0;
+	shared.abort = 0;
+	notes_taken();
+	notifications = 0;
+	RingNotify(&shared.ring, (TaskHandle_t)1, threshold);
+	pthread_create(&thread, NULL, producer, NULL);
+	while(expected < items){
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ts.tv_nsec += 200000000;
+		if(ts.tv_nsec >= 1000000000){
+			ts.tv_sec++;
+			ts.tv_nsec -= 1000000000;
+		}
+		/* ulTaskNotifyTake(pdTRUE, ...) */
+		if(sem_timedwait(&notification, &ts) != 0 && errno == ETIMEDOUT &&
+				!shared.done && RingCount(&shared.ring) >= threshold){
+			printf("  FAIL: missed notification, %u items stored (threshold %u)\n", RingCount(&shared.ring), threshold);
+			errors++;
+			shared.abort = 1;
+			break;
+		}
+		notes_taken();
+		wakes++;
+		do{
+			max = 1 + rand() % (size + 3);
+			n = RingPop(&shared.ring, block, max);
+			for(k = 0; k < n; k++, expected++){
+				if(block[k][0] != expected || block[k][1] != ~expected || block[k][2] != expected * 2654435761u){
+					printf("  FAIL: item %u corrupted or out of order (got %u)\n", expected, block[k][0]);
+					errors++;
+					shared.abort = 1;
+					pthread_join(thread, NULL);
+					return;
+				}
+			}
+		}while(n > 0);
+	}
+	pthread_join(thread, NULL);
+	if(RingCount(&shared.ring) != 0){
+		printf("  FAIL: %u items left\n", RingCount(&shared.ring));
+		errors++;
+	}
+	printf("  threads size %u, threshold %u: %u items, %u wakes, %d notifications, %u full ring retries\n",
+		size, threshold, expected, wakes, notifications, shared.ring.dropped);
+}
+
+int main(int argc, char **argv){
+	uint32_t items = (argc > 1) ? strtoul(argv[1], NULL, 0) : 2000000;
+
+	srand(1);
+	sem_init(&notification, 0, 0);
+	test_model(1, 1, 20000);
+	test_model(8, 3, 200000);
+	test_model(64, 12, 200000);
+	test_threshold();
+	test_threads(64, 16, items);
+	test_threads(8, 1, items);
+	test_threads(256, 256, items);
+	test_threads(1024, 100, items);
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""
+Host stress test of the lock-free ring buffer (drivers/microcontroller ring_buffer_mcu.c).
+
+Builds ring_stress.c with ring_buffer_mcu.c and runs it: a single thread test against a
+reference queue (partial and discarding pops, full ring drops, counters wrapping), the
+notification threshold, and a producer thread against a consumer thread blocked until
+notified, checking order and integrity of every item.
+
+The host has other memory ordering and timing than the ESP32-C6: a pass shows the
+algorithm is right, not the timing on the target.
+
+Usage:
+    ring_stress.py [--items 2000000]
+"""
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MCU = os.path.join(HERE, '..', '..', 'drivers', 'microcontroller')
+
+
+def build(out):
+    exe = os.path.join(out, 'ring_stress')
+    subprocess.run(['cc', '-O2', '-Wall', '-pthread', '-I' + os.path.join(HERE, 'host'), '-I' + os.path.join(MCU, 'inc'),
+                    os.path.join(HERE, 'ring_stress.c'), os.path.join(MCU, 'src', 'ring_buffer_mcu.c'),
+                    '-o', exe], check=True)
+    return exe
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--items', type=int, default=2000000, help='items per producer/consumer run')
+    args = parser.parse_args()
+    with tempfile.TemporaryDirectory() as out:
+        return subprocess.run([build(out), str(args.items)]).returncode
+
+
+if __name__ == '__main__':
+    sys.exit(main())